@@ -0,0 +1,116 @@
+/**
+ * \file vcblockchain/arena.h
+ *
+ * \brief Bump arena allocator for request / response scoped allocations.
+ *
+ * An arena hands out memory by bumping a cursor through large chunks obtained
+ * from a backing allocator. Individual releases are no-ops; instead, every
+ * allocation made from the arena is reclaimed at once by resetting it. This
+ * matches the lifetime of a single request on the server, or a single response
+ * on the client: decode, handle, encode, then discard everything.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VCBLOCKCHAIN_ARENA_HEADER_GUARD
+#define VCBLOCKCHAIN_ARENA_HEADER_GUARD
+
+#include <stddef.h>
+#include <vpr/allocator.h>
+#include <vpr/disposable.h>
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif /*__cplusplus*/
+
+/**
+ * \brief Alignment of every allocation returned by an arena.
+ */
+#define VCBLOCKCHAIN_ARENA_ALIGNMENT 16U
+
+/**
+ * \brief Default chunk size for an arena, large enough to hold a typical
+ * request and response without growing.
+ */
+#define VCBLOCKCHAIN_ARENA_DEFAULT_CHUNK_SIZE (64U * 1024U)
+
+/**
+ * \brief A chunk of memory owned by an arena.
+ */
+typedef struct vcblockchain_arena_chunk vcblockchain_arena_chunk;
+
+/**
+ * \brief A bump arena.
+ *
+ * The \ref alloc_opts member can be passed to any function in this library
+ * that accepts an \ref allocator_options_t pointer, including every
+ * encode / decode function and \ref vccrypt_buffer_init. Buffers allocated
+ * this way may still be disposed as usual; the dispose wipes the buffer, but
+ * the memory itself is only reclaimed by \ref vcblockchain_arena_reset or by
+ * disposing the arena.
+ *
+ * An arena is not thread safe. Each worker thread should own its own arena and
+ * reset it at the end of each request, so the chunks it has grown to hold are
+ * reused across requests instead of being returned to the backing allocator.
+ */
+typedef struct vcblockchain_arena
+{
+    /** \brief this structure is disposable. */
+    disposable_t hdr;
+    /** \brief the allocator options that allocate from this arena. */
+    allocator_options_t alloc_opts;
+    /** \brief the allocator used to allocate chunks. */
+    allocator_options_t* backing_alloc_opts;
+    /** \brief the minimum size of a chunk. */
+    size_t chunk_size;
+    /** \brief the first chunk in this arena. */
+    vcblockchain_arena_chunk* head;
+    /** \brief the chunk from which allocations are currently made. */
+    vcblockchain_arena_chunk* current;
+} vcblockchain_arena;
+
+/**
+ * \brief Initialize an arena.
+ *
+ * \param arena                     The arena to initialize.
+ * \param backing_alloc_opts        The allocator used to allocate chunks for
+ *                                  this arena. It must outlive the arena.
+ * \param chunk_size                The minimum chunk size for this arena. If
+ *                                  zero, then
+ *                                  \ref VCBLOCKCHAIN_ARENA_DEFAULT_CHUNK_SIZE
+ *                                  is used.
+ *
+ * No memory is allocated until the first allocation is made from the arena.
+ * On success, the \p arena is owned by the caller and must be disposed by
+ * calling \ref dispose() when it is no longer needed. Disposing the arena
+ * returns all chunks to the backing allocator.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ */
+int vcblockchain_arena_init(
+    vcblockchain_arena* arena, allocator_options_t* backing_alloc_opts,
+    size_t chunk_size);
+
+/**
+ * \brief Reset an arena, reclaiming every allocation made from it.
+ *
+ * \param arena                     The arena to reset.
+ *
+ * This is a constant time operation. Chunks are retained by the arena and
+ * reused by subsequent allocations. Any pointer previously returned by the
+ * arena is invalid after this call, so all structures decoded or buffers
+ * encoded with this arena must no longer be in use. Note that memory is not
+ * wiped by a reset; buffers holding sensitive data should be disposed before
+ * the arena is reset.
+ */
+void vcblockchain_arena_reset(vcblockchain_arena* arena);
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif /*__cplusplus*/
+
+#endif /*VCBLOCKCHAIN_ARENA_HEADER_GUARD*/
@@ -0,0 +1,297 @@
+/**
+ * \file vcblockchain/async_client.h
+ *
+ * \brief Asynchronous client driven by an event loop.
+ *
+ * The sendreq and recvresp functions in \ref protocol.h block on the socket,
+ * which forces a service built on an event loop to dedicate a thread to each
+ * connection. An async client never touches the socket. Instead, it holds the
+ * sealed requests waiting to be written, and accepts whatever bytes the event
+ * loop reads, completing each response as soon as the whole of it arrives.
+ * The event loop, whether built on epoll, kqueue or libevent, only has to move
+ * bytes between the socket and the client:
+ *
+ *   - when the socket is readable, read what is available and pass it to
+ *     \ref vcblockchain_async_client_input;
+ *   - when \ref vcblockchain_async_client_output returns pending data and the
+ *     socket is writable, write it and pass the number of bytes written to
+ *     \ref vcblockchain_async_client_output_consume;
+ *   - when the time returned by \ref vcblockchain_async_client_next_deadline
+ *     arrives, call \ref vcblockchain_async_client_expire.
+ *
+ * Any request can be sent this way: acquire an offset with a completion
+ * function, encode the request with the matching encode function in
+ * \ref serialization.h, then submit it. Responses are routed by offset through
+ * a \ref vcblockchain_client_mux, so a single thread can drive as many requests
+ * in flight as the pipeline depth allows. Each completion function receives
+ * the full response, which can be passed to the matching decode function.
+ *
+ * An async client is not thread safe; it should be owned by the thread that
+ * runs its event loop.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VCBLOCKCHAIN_ASYNC_CLIENT_HEADER_GUARD
+#define VCBLOCKCHAIN_ASYNC_CLIENT_HEADER_GUARD
+
+#include <rcpr/resource.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <vcblockchain/client_mux.h>
+#include <vccrypt/suite.h>
+#include <vpr/allocator.h>
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif /*__cplusplus*/
+
+/**
+ * \brief An async client.
+ */
+typedef struct vcblockchain_async_client vcblockchain_async_client;
+
+/**
+ * \brief Create an async client for an established connection.
+ *
+ * \param client                    Pointer to the pointer to receive the async
+ *                                  client on success.
+ * \param alloc_opts                The allocator used to allocate the client
+ *                                  and its buffers. It must outlive the client.
+ * \param suite                     The crypto suite used to seal requests and
+ *                                  open responses.
+ * \param shared_secret             The shared secret for this connection,
+ *                                  which must outlive the client.
+ * \param client_iv                 The next client IV for this connection.
+ * \param server_iv                 The next server IV for this connection.
+ * \param depth                     The maximum number of requests in flight.
+ *                                  If zero, then
+ *                                  \ref VCBLOCKCHAIN_CLIENT_MUX_DEFAULT_DEPTH
+ *                                  is used.
+ *
+ * The handshake is performed beforehand, for instance with the lower level
+ * handshake functions on a blocking socket, after which the socket can be
+ * switched to non-blocking mode and handed to the event loop. Once an async
+ * client has been created, every packet on this connection must go through
+ * the client, or the IVs will fall out of step.
+ *
+ * On success, \p client is set to an async client instance. This instance is
+ * a \ref resource that is owned by the caller and must be released by calling
+ * \ref resource_release on its resource handle when it is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if the client could not be
+ *        allocated.
+ */
+int vcblockchain_async_client_create(
+    vcblockchain_async_client** client, allocator_options_t* alloc_opts,
+    vccrypt_suite_options_t* suite, const vccrypt_buffer_t* shared_secret,
+    uint64_t client_iv, uint64_t server_iv, uint32_t depth);
+
+/**
+ * \brief Get the resource handle for the given async client.
+ *
+ * \param client    The async client instance to access.
+ *
+ * \returns the resource handle for this async client instance.
+ */
+RCPR_SYM(resource)* vcblockchain_async_client_resource_handle(
+    vcblockchain_async_client* client);
+
+/**
+ * \brief Acquire an offset for a new asynchronous request.
+ *
+ * \param client                    The async client.
+ * \param completion                The function to call with each response for
+ *                                  this offset.
+ * \param context                   The context passed to \p completion.
+ * \param deadline                  The time by which the first response must
+ *                                  arrive, on the clock passed to
+ *                                  \ref vcblockchain_async_client_expire, or
+ *                                  zero if the request has no deadline.
+ * \param offset                    Pointer to receive the offset to use when
+ *                                  encoding the request.
+ *
+ * The request is then encoded with the matching encode function in
+ * \ref serialization.h using this offset, and queued by calling
+ * \ref vcblockchain_async_client_submit. If it can't be encoded or queued,
+ * then the offset must be returned by calling
+ * \ref vcblockchain_async_client_release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_PIPELINE_FULL if the pipeline is full. The caller
+ *        should wait for responses to free an offset.
+ */
+int vcblockchain_async_client_acquire(
+    vcblockchain_async_client* client,
+    vcblockchain_client_mux_completion_fn completion, void* context,
+    uint64_t deadline, uint32_t* offset);
+
+/**
+ * \brief Release an offset without waiting for a response.
+ *
+ * \param client                    The async client.
+ * \param offset                    The offset to release.
+ *
+ * This is used when a request could not be encoded or queued, or to stop
+ * waiting on an offset whose completion function asked to keep waiting. It
+ * must not be called from a completion function for the offset being
+ * completed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the offset is not in flight.
+ */
+int vcblockchain_async_client_release(
+    vcblockchain_async_client* client, uint32_t offset);
+
+/**
+ * \brief Seal an encoded request and queue it to be written.
+ *
+ * \param client                    The async client.
+ * \param request                   The encoded request, which carries an
+ *                                  offset acquired from this client.
+ * \param request_size              The size of the encoded request.
+ *
+ * This function does not touch the socket. The sealed request is appended to
+ * the output of this client, which the event loop writes to the socket once
+ * it is writable; see \ref vcblockchain_async_client_output.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if the output could not be grown.
+ *      - a non-zero error code if the request could not be sealed.
+ */
+int vcblockchain_async_client_submit(
+    vcblockchain_async_client* client, const void* request,
+    size_t request_size);
+
+/**
+ * \brief Get the data waiting to be written to the socket.
+ *
+ * \param client                    The async client.
+ * \param data                      Pointer to receive the data to write. It
+ *                                  remains valid until the output is next
+ *                                  submitted to or consumed.
+ * \param size                      Pointer to receive the size of the data to
+ *                                  write, which is zero if there is none.
+ *
+ * When the socket is writable, the event loop writes as much of this data as
+ * the socket accepts, then passes the number of bytes written to
+ * \ref vcblockchain_async_client_output_consume. While the size is zero, the
+ * event loop need not wait for the socket to become writable.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ */
+int vcblockchain_async_client_output(
+    vcblockchain_async_client* client, const void** data, size_t* size);
+
+/**
+ * \brief Discard data that has been written to the socket.
+ *
+ * \param client                    The async client.
+ * \param size                      The number of bytes written to the socket.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided,
+ *        or if \p size is larger than the data waiting to be written.
+ */
+int vcblockchain_async_client_output_consume(
+    vcblockchain_async_client* client, size_t size);
+
+/**
+ * \brief Accept data read from the socket and complete any responses in it.
+ *
+ * \param client                    The async client.
+ * \param data                      The data read from the socket.
+ * \param size                      The size of the data read from the socket.
+ *
+ * When the socket is readable, the event loop reads whatever is available and
+ * passes it to this function. The data need not hold whole packets; a partial
+ * packet is kept until the rest of it arrives. Each complete response is
+ * authenticated, decrypted and routed to the completion function for its
+ * offset before this function returns. A completion function may acquire and
+ * submit new requests, but must not call this function.
+ *
+ * Any error returned by this function leaves the connection out of step, and
+ * the connection should be closed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if the input could not be grown.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_UNAUTHORIZED_PACKET if a packet could not be
+ *        authenticated.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if a response is for an
+ *        offset that is not in flight.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_async_client_input(
+    vcblockchain_async_client* client, const void* data, size_t size);
+
+/**
+ * \brief Fail every request whose deadline has passed.
+ *
+ * \param client                    The async client.
+ * \param now                       The current time, on the same clock as the
+ *                                  deadlines passed to
+ *                                  \ref vcblockchain_async_client_acquire.
+ *
+ * The completion function for each expired request is called with a status of
+ * \ref VCBLOCKCHAIN_ERROR_REQUEST_TIMED_OUT, a request id of zero, and no
+ * payload; its return value is ignored. The offset is then abandoned with
+ * \ref vcblockchain_client_mux_abandon, so it is free for a new request at
+ * once, and a late response is quietly discarded instead of being mistaken for
+ * an error.
+ *
+ * The event loop calls this function when the timeout given by
+ * \ref vcblockchain_async_client_next_deadline elapses.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ */
+int vcblockchain_async_client_expire(
+    vcblockchain_async_client* client, uint64_t now);
+
+/**
+ * \brief Get the earliest deadline of any request in flight.
+ *
+ * \param client                    The async client.
+ *
+ * The event loop uses this to bound how long it waits for the socket, so that
+ * it can call \ref vcblockchain_async_client_expire in time.
+ *
+ * \returns the earliest deadline, or zero if no request in flight has one.
+ */
+uint64_t vcblockchain_async_client_next_deadline(
+    const vcblockchain_async_client* client);
+
+/**
+ * \brief Return true if the given async client is valid.
+ *
+ * \param client    The async client instance to check.
+ *
+ * \note This function is only available at model check time.
+ *
+ * \returns true if the instance is valid.
+ */
+bool prop_vcblockchain_async_client_valid(
+    const vcblockchain_async_client* client);
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif /*__cplusplus*/
+
+#endif /*VCBLOCKCHAIN_ASYNC_CLIENT_HEADER_GUARD*/
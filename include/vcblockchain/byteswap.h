@@ -43,13 +43,7 @@ extern "C" {
  */
 inline int32_t vcbswap_32(int32_t val)
 {
-    uint32_t v = (uint32_t)val;
-
-    return
-        ((v & 0xFF000000) >> 24)
-      | ((v & 0x00FF0000) >> 8)
-      | ((v & 0x0000FF00) << 8)
-      | ((v & 0x000000FF) << 24);
+    return (int32_t)__builtin_bswap32((uint32_t)val);
 }
 #endif /*VCBLOCKCHAIN_VCBSWAP_32_IMPL*/
 
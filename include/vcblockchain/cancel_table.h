@@ -0,0 +1,153 @@
+/**
+ * \file vcblockchain/cancel_table.h
+ *
+ * \brief Track the requests in flight on a connection so they can be cancelled.
+ *
+ * A server registers each request with the cancel table of its connection when
+ * it starts handling it, and removes it once the final response has been sent.
+ * When a \ref PROTOCOL_REQ_ID_REQUEST_CANCEL request arrives, the server marks
+ * the target request as cancelled. Long running handlers poll the table
+ * between steps of their work, and stop early once their request has been
+ * cancelled, answering it with
+ * \ref VCBLOCKCHAIN_ERROR_PROTOCOL_REQUEST_CANCELLED.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VCBLOCKCHAIN_CANCEL_TABLE_HEADER_GUARD
+#define VCBLOCKCHAIN_CANCEL_TABLE_HEADER_GUARD
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <vpr/allocator.h>
+#include <vpr/disposable.h>
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif /*__cplusplus*/
+
+/**
+ * \brief A slot in a cancel table.
+ */
+typedef struct vcblockchain_cancel_table_entry
+{
+    /** \brief the offset of the request in this slot. */
+    uint32_t offset;
+    /** \brief true if this slot holds a request in flight. */
+    bool in_flight;
+    /** \brief true if the request in this slot has been cancelled. */
+    bool cancelled;
+} vcblockchain_cancel_table_entry;
+
+/**
+ * \brief A fixed capacity table of the requests in flight on a connection.
+ *
+ * Registering a request returns a token naming its slot, so a handler can
+ * check for cancellation with a single load. A cancel table is not thread
+ * safe. It should be owned by the fiber or thread that services its
+ * connection.
+ */
+typedef struct vcblockchain_cancel_table
+{
+    /** \brief this structure is disposable. */
+    disposable_t hdr;
+    /** \brief the allocator used to allocate the slots. */
+    allocator_options_t* alloc_opts;
+    /** \brief the slots in this table. */
+    vcblockchain_cancel_table_entry* entries;
+    /** \brief the number of slots in this table. */
+    size_t capacity;
+    /** \brief the number of requests in flight. */
+    size_t count;
+} vcblockchain_cancel_table;
+
+/**
+ * \brief Initialize a cancel table.
+ *
+ * \param table                     The cancel table to initialize.
+ * \param alloc_opts                The allocator used to allocate the slots for
+ *                                  this table. It must outlive the table.
+ * \param capacity                  The maximum number of requests in flight
+ *                                  that this table can track.
+ *
+ * On success, the \p table is owned by the caller and must be disposed by
+ * calling \ref dispose() when it is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if the slots could not be allocated.
+ */
+int vcblockchain_cancel_table_init(
+    vcblockchain_cancel_table* table, allocator_options_t* alloc_opts,
+    size_t capacity);
+
+/**
+ * \brief Register a request that is now in flight.
+ *
+ * \param table                     The cancel table.
+ * \param offset                    The offset of the request.
+ * \param token                     Pointer to receive the token for this
+ *                                  request, which is passed to
+ *                                  \ref vcblockchain_cancel_table_is_cancelled
+ *                                  and \ref vcblockchain_cancel_table_end.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided,
+ *        or if a request with this offset is already in flight.
+ *      - VCBLOCKCHAIN_ERROR_CANCEL_TABLE_FULL if the table is full.
+ */
+int vcblockchain_cancel_table_begin(
+    vcblockchain_cancel_table* table, uint32_t offset, size_t* token);
+
+/**
+ * \brief Cancel the request in flight at the given offset.
+ *
+ * \param table                     The cancel table.
+ * \param offset                    The offset of the request to cancel.
+ *
+ * Cancelling a request that has already been cancelled succeeds again.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS if the request was marked as cancelled.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_REQUEST_NOT_FOUND if no request with this
+ *        offset is in flight.
+ */
+int vcblockchain_cancel_table_cancel(
+    vcblockchain_cancel_table* table, uint32_t offset);
+
+/**
+ * \brief Remove a request from the table once its final response is sent.
+ *
+ * \param table                     The cancel table.
+ * \param token                     The token returned when this request was
+ *                                  registered.
+ */
+void vcblockchain_cancel_table_end(
+    vcblockchain_cancel_table* table, size_t token);
+
+/**
+ * \brief Check whether a request in flight has been cancelled.
+ *
+ * \param table                     The cancel table.
+ * \param token                     The token returned when this request was
+ *                                  registered.
+ *
+ * \returns true if the request has been cancelled, or false otherwise.
+ */
+static inline bool vcblockchain_cancel_table_is_cancelled(
+    const vcblockchain_cancel_table* table, size_t token)
+{
+    return table->entries[token].cancelled;
+}
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif /*__cplusplus*/
+
+#endif /*VCBLOCKCHAIN_CANCEL_TABLE_HEADER_GUARD*/
@@ -0,0 +1,314 @@
+/**
+ * \file vcblockchain/client_mux.h
+ *
+ * \brief Pipelined client that matches responses to requests by offset.
+ *
+ * Every request carries an offset that is echoed back in its response, so a
+ * client may have many requests in flight on a single connection. The client
+ * multiplexer hands out these offsets and remembers who is waiting on each
+ * one. A client acquires an offset for each request, sends the request with
+ * the matching sendreq function, and then calls
+ * \ref vcblockchain_client_mux_dispatch to read responses as they arrive. Each
+ * response is routed to the completion function registered for its offset,
+ * regardless of the order in which the server answers.
+ *
+ * Keeping the pipeline full hides the round trip to the agent: instead of
+ * paying one round trip per request, as a lock-step request / response loop
+ * does, a client pays roughly one round trip per pipeline depth.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VCBLOCKCHAIN_CLIENT_MUX_HEADER_GUARD
+#define VCBLOCKCHAIN_CLIENT_MUX_HEADER_GUARD
+
+#include <rcpr/allocator.h>
+#include <rcpr/psock.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <vcblockchain/flow_credit.h>
+#include <vccrypt/suite.h>
+#include <vpr/allocator.h>
+#include <vpr/disposable.h>
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif /*__cplusplus*/
+
+/**
+ * \brief Default pipeline depth for a client multiplexer.
+ */
+#define VCBLOCKCHAIN_CLIENT_MUX_DEFAULT_DEPTH 32U
+
+/**
+ * \brief Completion function called with each response for an offset.
+ *
+ * \param context                   The context registered with this offset.
+ * \param request_id                The request id of the response.
+ * \param offset                    The offset of the response.
+ * \param status                    The status of the response.
+ * \param payload                   The full response, including its header,
+ *                                  which can be passed to the matching
+ *                                  response decode function. It is only valid
+ *                                  for the duration of this call.
+ * \param payload_size              The size of the response.
+ *
+ * \returns true to keep waiting for further responses on this offset, as for
+ * a subscription, or false if this was the final response for the offset.
+ */
+typedef bool (*vcblockchain_client_mux_completion_fn)(
+    void* context, uint32_t request_id, uint32_t offset, uint32_t status,
+    const void* payload, size_t payload_size);
+
+/**
+ * \brief A slot in a client multiplexer.
+ */
+typedef struct vcblockchain_client_mux_slot
+{
+    /** \brief the completion function for this slot. */
+    vcblockchain_client_mux_completion_fn completion;
+    /** \brief the context for the completion function. */
+    void* context;
+    /** \brief the offset currently assigned to this slot. */
+    uint32_t offset;
+    /** \brief the number of times this slot has been reused. */
+    uint32_t generation;
+    /** \brief the latest generation whose request was abandoned. */
+    uint32_t abandoned_generation;
+    /** \brief the next free slot, if this slot is free. */
+    uint32_t next_free;
+    /** \brief true if a request is in flight in this slot. */
+    bool in_flight;
+} vcblockchain_client_mux_slot;
+
+/**
+ * \brief A client multiplexer.
+ *
+ * Each slot maps to the offsets congruent to its index modulo the pipeline
+ * depth, so a response is matched to its waiter in constant time. A client
+ * multiplexer is not thread safe; it should be owned by the fiber or thread
+ * that owns its connection.
+ */
+typedef struct vcblockchain_client_mux
+{
+    /** \brief this structure is disposable. */
+    disposable_t hdr;
+    /** \brief the allocator used to allocate the slots. */
+    allocator_options_t* alloc_opts;
+    /** \brief the slots in this multiplexer. */
+    vcblockchain_client_mux_slot* slots;
+    /** \brief the pipeline depth, which is the number of slots. */
+    uint32_t depth;
+    /** \brief the number of requests in flight. */
+    uint32_t in_flight;
+    /** \brief the first free slot, or \ref depth if there is none. */
+    uint32_t free_head;
+    /** \brief the request credits, or NULL if flow control is off. */
+    vcblockchain_flow_credit* flow_credit;
+} vcblockchain_client_mux;
+
+/**
+ * \brief Initialize a client multiplexer.
+ *
+ * \param mux                       The client multiplexer to initialize.
+ * \param alloc_opts                The allocator used to allocate the slots.
+ *                                  It must outlive the multiplexer.
+ * \param depth                     The maximum number of requests in flight.
+ *                                  If zero, then
+ *                                  \ref VCBLOCKCHAIN_CLIENT_MUX_DEFAULT_DEPTH
+ *                                  is used.
+ *
+ * On success, the \p mux is owned by the caller and must be disposed by
+ * calling \ref dispose() when it is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if the slots could not be allocated.
+ */
+int vcblockchain_client_mux_init(
+    vcblockchain_client_mux* mux, allocator_options_t* alloc_opts,
+    uint32_t depth);
+
+/**
+ * \brief Acquire an offset for a new request.
+ *
+ * \param mux                       The client multiplexer.
+ * \param completion                The function to call with each response for
+ *                                  this offset.
+ * \param context                   The context passed to \p completion.
+ * \param offset                    Pointer to receive the offset to use when
+ *                                  sending the request.
+ *
+ * If sending the request fails, the offset must be returned by calling
+ * \ref vcblockchain_client_mux_release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_PIPELINE_FULL if the pipeline is full. The caller
+ *        should dispatch responses until an offset is freed.
+ */
+int vcblockchain_client_mux_acquire(
+    vcblockchain_client_mux* mux,
+    vcblockchain_client_mux_completion_fn completion, void* context,
+    uint32_t* offset);
+
+/**
+ * \brief Release an offset without waiting for a response.
+ *
+ * \param mux                       The client multiplexer.
+ * \param offset                    The offset to release.
+ *
+ * This is used when a request could not be sent, or to stop waiting on an
+ * offset whose completion function asked to keep waiting. It must not be
+ * called from a completion function for the offset being completed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the offset is not in flight.
+ */
+int vcblockchain_client_mux_release(
+    vcblockchain_client_mux* mux, uint32_t offset);
+
+/**
+ * \brief Stop waiting for the response to a request that has been sent.
+ *
+ * \param mux                       The client multiplexer.
+ * \param offset                    The offset to abandon.
+ *
+ * This is used when a request has timed out. Its slot is freed at once, so
+ * the pipeline does not shrink while the server is silent. If the response
+ * arrives later, then \ref vcblockchain_client_mux_complete discards it, since
+ * the slot is given a new offset before it is reused. Like
+ * \ref vcblockchain_client_mux_release, this must not be called from a
+ * completion function for the offset being completed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the offset is not in flight.
+ */
+int vcblockchain_client_mux_abandon(
+    vcblockchain_client_mux* mux, uint32_t offset);
+
+/**
+ * \brief Route a response that has already been read to its waiter.
+ *
+ * \param mux                       The client multiplexer.
+ * \param payload                   The decrypted response, including its
+ *                                  header.
+ * \param payload_size              The size of the response.
+ *
+ * This is used by clients that read and decrypt responses themselves, such as
+ * a client driven by an event loop. The completion function for the
+ * response's offset is called before this function returns. Unless it asks to
+ * keep waiting, the offset is then freed for reuse.
+ *
+ * If flow credits are attached, then a flow credit grant response is applied
+ * to them instead. A late response for an abandoned offset is discarded.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the response is for
+ *        an offset that is neither in flight nor abandoned, or if a grant
+ *        returns more flow credits than were consumed.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE if the response
+ *        is too small to hold a header.
+ */
+int vcblockchain_client_mux_complete(
+    vcblockchain_client_mux* mux, const void* payload, size_t payload_size);
+
+/**
+ * \brief Read a single response and route it to its waiter.
+ *
+ * \param mux                       The client multiplexer.
+ * \param sock                      The socket from which the response is read.
+ * \param a                         The allocator to use for this operation.
+ * \param suite                     The crypto suite to use for this read.
+ * \param server_iv                 Pointer to the server_iv to use, updated as
+ *                                  a consequence of this call.
+ * \param shared_secret             The shared secret key for this connection.
+ *
+ * The completion function for the response's offset is called before this
+ * function returns. Unless it asks to keep waiting, the offset is then freed
+ * for reuse.
+ *
+ * If flow credits are attached, then a flow credit grant response is applied
+ * to them instead. A late response for an abandoned offset is discarded.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the response is for
+ *        an offset that is neither in flight nor abandoned.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE if the response
+ *        is too small to hold a header.
+ *      - a non-zero error response if reading the response failed.
+ */
+status vcblockchain_client_mux_dispatch(
+    vcblockchain_client_mux* mux, RCPR_SYM(psock)* sock,
+    RCPR_SYM(allocator)* a, vccrypt_suite_options_t* suite,
+    uint64_t* server_iv, const vccrypt_buffer_t* shared_secret);
+
+/**
+ * \brief Attach the flow credits for sending requests.
+ *
+ * \param mux                       The client multiplexer.
+ * \param credit                    The flow credit account holding the credits
+ *                                  granted by the agent, initialized with the
+ *                                  window from the negotiation. It must
+ *                                  outlive the multiplexer. If NULL, then flow
+ *                                  control is turned off.
+ *
+ * Once flow credits are attached, every flow credit grant response is applied
+ * to them instead of being routed by offset, so they must only be attached
+ * after the negotiation has completed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ */
+int vcblockchain_client_mux_flow_credit_attach(
+    vcblockchain_client_mux* mux, vcblockchain_flow_credit* credit);
+
+/**
+ * \brief Consume the flow credits for a request, dispatching responses until
+ * the agent grants enough of them.
+ *
+ * \param mux                       The client multiplexer.
+ * \param sock                      The socket from which responses are read.
+ * \param a                         The allocator to use for this operation.
+ * \param suite                     The crypto suite to use for each read.
+ * \param server_iv                 Pointer to the server_iv to use, updated as
+ *                                  a consequence of this call.
+ * \param shared_secret             The shared secret key for this connection.
+ * \param request_size              The size of the encoded request.
+ *
+ * This is called before sending each request. While the credits granted by
+ * the agent are exhausted, this function blocks, dispatching responses with
+ * \ref vcblockchain_client_mux_dispatch until a grant arrives. A client that
+ * must not block can call \ref vcblockchain_flow_credit_consume on the
+ * attached credits instead, and treat
+ * \ref VCBLOCKCHAIN_ERROR_FLOW_CREDIT_EXHAUSTED as backpressure. If no flow
+ * credits are attached, then this function returns at once.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided,
+ *        or if the request is larger than the byte window.
+ *      - a non-zero error code if dispatching a response failed.
+ */
+status vcblockchain_client_mux_flow_credit_consume(
+    vcblockchain_client_mux* mux, RCPR_SYM(psock)* sock,
+    RCPR_SYM(allocator)* a, vccrypt_suite_options_t* suite,
+    uint64_t* server_iv, const vccrypt_buffer_t* shared_secret,
+    size_t request_size);
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif /*__cplusplus*/
+
+#endif /*VCBLOCKCHAIN_CLIENT_MUX_HEADER_GUARD*/
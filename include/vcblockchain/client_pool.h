@@ -0,0 +1,202 @@
+/**
+ * \file vcblockchain/client_pool.h
+ *
+ * \brief A pool of authenticated client sessions to a single agent.
+ *
+ * Opening a client session costs a TCP connection, the handshake request and
+ * acknowledgement round trips, and a key agreement, all before the first
+ * useful request is sent. A client pool pays these costs ahead of time. It
+ * keeps a fixed number of sessions open, hands out idle sessions on demand,
+ * and replaces sessions that have failed when it is maintained.
+ *
+ * Idle sessions are reused in last in, first out order, so a lightly loaded
+ * service keeps reusing the same few sessions, whose connections and arenas
+ * are warm, while the rest stand by.
+ *
+ * A client pool creates no threads. The caller maintains it periodically, for
+ * instance from a housekeeping timer, and it is not thread safe.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VCBLOCKCHAIN_CLIENT_POOL_HEADER_GUARD
+#define VCBLOCKCHAIN_CLIENT_POOL_HEADER_GUARD
+
+#include <rcpr/allocator.h>
+#include <rcpr/psock.h>
+#include <rcpr/resource.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <vcblockchain/client_session.h>
+#include <vccrypt/suite.h>
+#include <vpr/allocator.h>
+#include <vpr/uuid.h>
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif /*__cplusplus*/
+
+/**
+ * \brief A client pool.
+ */
+typedef struct vcblockchain_client_pool vcblockchain_client_pool;
+
+/**
+ * \brief Function used by a client pool to open a connection to the agent.
+ *
+ * \param context                   The context registered with the pool.
+ * \param sock                      Pointer to receive the connected socket,
+ *                                  which is owned by the pool on success.
+ *
+ * The agent's address should be resolved once, for instance with
+ * \ref vcblockchain_inet_resolve_address, and cached in the context, so that
+ * replacing a session does not repeat the lookup.
+ *
+ * \returns a status code indicating success or failure.
+ */
+typedef status (*vcblockchain_client_pool_connect_fn)(
+    void* context, RCPR_SYM(psock)** sock);
+
+/**
+ * \brief Create a pool of client sessions to a single agent.
+ *
+ * \param pool                      Pointer to the pointer to receive the client
+ *                                  pool on success.
+ * \param alloc_opts                The allocator used to allocate the pool. It
+ *                                  must outlive the pool.
+ * \param a                         The allocator used by each session to
+ *                                  receive responses. It must outlive the
+ *                                  pool.
+ * \param suite                     The crypto suite to use for each session.
+ *                                  It must outlive the pool.
+ * \param connect                   The function used to open each connection.
+ * \param connect_context           The context passed to \p connect.
+ * \param client_id                 The entity UUID for the client.
+ * \param client_privkey            The client private key.
+ * \param server_id                 The UUID that the agent must present.
+ * \param server_pubkey             The public key that the agent must present.
+ * \param size                      The number of sessions to keep.
+ *
+ * Every argument is borrowed and must outlive the pool. The pool starts out
+ * empty; call \ref vcblockchain_client_pool_maintain to open its sessions
+ * before the first request arrives.
+ *
+ * On success, \p pool is set to a client pool instance. This instance is a
+ * \ref resource that is owned by the caller and must be released by calling
+ * \ref resource_release on its resource handle when it is no longer needed.
+ * Every session acquired from the pool must be returned to it first.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if the pool could not be allocated.
+ */
+int vcblockchain_client_pool_create(
+    vcblockchain_client_pool** pool, allocator_options_t* alloc_opts,
+    RCPR_SYM(allocator)* a, vccrypt_suite_options_t* suite,
+    vcblockchain_client_pool_connect_fn connect, void* connect_context,
+    const vpr_uuid* client_id, const vccrypt_buffer_t* client_privkey,
+    const vpr_uuid* server_id, const vccrypt_buffer_t* server_pubkey,
+    uint32_t size);
+
+/**
+ * \brief Get the resource handle for the given client pool.
+ *
+ * \param pool      The client pool instance to access.
+ *
+ * \returns the resource handle for this client pool instance.
+ */
+RCPR_SYM(resource)* vcblockchain_client_pool_resource_handle(
+    vcblockchain_client_pool* pool);
+
+/**
+ * \brief Acquire a session from a client pool.
+ *
+ * \param pool                      The client pool.
+ * \param session                   Pointer to receive the session.
+ *
+ * The most recently returned idle session is handed out first, since its
+ * connection, buffers and arena are the most likely to still be warm. If no
+ * session is idle, then an empty entry is connected on the spot, paying the
+ * full cost of the connection and handshake.
+ *
+ * The session remains owned by the pool. It must be returned by calling
+ * \ref vcblockchain_client_pool_release, and must not be released directly.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_POOL_EXHAUSTED if every session is in use.
+ *      - a non-zero error code if a new session could not be opened.
+ */
+int vcblockchain_client_pool_acquire(
+    vcblockchain_client_pool* pool, vcblockchain_client_session** session);
+
+/**
+ * \brief Return a session to a client pool.
+ *
+ * \param pool                      The client pool.
+ * \param session                   The session to return, which was acquired
+ *                                  from this pool.
+ * \param healthy                   true if the session can be reused. This
+ *                                  must be false if a request on the session
+ *                                  failed, or if a response is still
+ *                                  outstanding, since the session is then out
+ *                                  of step with its connection.
+ *
+ * A healthy session goes on top of the idle stack, to be handed out next. An
+ * unhealthy session is closed, and its entry is reconnected by the next call
+ * to \ref vcblockchain_client_pool_maintain.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the session was not acquired from
+ *        this pool.
+ */
+int vcblockchain_client_pool_release(
+    vcblockchain_client_pool* pool, vcblockchain_client_session* session,
+    bool healthy);
+
+/**
+ * \brief Check the idle sessions in a client pool and replace failed ones.
+ *
+ * \param pool                      The client pool.
+ *
+ * Each idle session is probed with a status request. A session whose probe
+ * fails is closed. Every empty entry, whether its session failed a probe or
+ * was returned as unhealthy, is then reconnected, so that the pool holds its
+ * full number of sessions again. New sessions go to the bottom of the idle
+ * stack, so that warmer sessions are still handed out first.
+ *
+ * This keeps connection and handshake costs out of the request path. The
+ * caller runs it from a housekeeping timer or thread; the pool is not thread
+ * safe, so calls to this function must be serialized with every other call on
+ * the pool. Because a probe blocks until its response arrives, the connect
+ * function should set a receive timeout on each socket it opens.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS if every session is healthy.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - the first error encountered while opening a session. Sessions that
+ *        could not be opened are retried by the next call.
+ */
+int vcblockchain_client_pool_maintain(vcblockchain_client_pool* pool);
+
+/**
+ * \brief Return true if the given client pool is valid.
+ *
+ * \param pool      The client pool instance to check.
+ *
+ * \note This function is only available at model check time.
+ *
+ * \returns true if the instance is valid.
+ */
+bool prop_vcblockchain_client_pool_valid(const vcblockchain_client_pool* pool);
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif /*__cplusplus*/
+
+#endif /*VCBLOCKCHAIN_CLIENT_POOL_HEADER_GUARD*/
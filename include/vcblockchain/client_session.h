@@ -0,0 +1,1849 @@
+/**
+ * \file vcblockchain/client_session.h
+ *
+ * \brief A client session bundling the state of a protected connection.
+ *
+ * The lower level sendreq and recvresp functions in \ref protocol.h take the
+ * socket, crypto suite, IVs, shared secret and request offset as separate
+ * parameters, which leaves the caller responsible for keeping the IVs in step
+ * with the connection. A client session owns this state instead. It is created
+ * by performing the handshake, after which every request is sent through the
+ * session, which assigns its offset and advances the IVs.
+ *
+ * The buffers used to encode and encrypt requests, and to decrypt responses,
+ * are allocated from an arena owned by the session and reused from one call to
+ * the next, so a long-lived session does not return to the backing allocator
+ * for each request. A client session is not thread safe; it should be owned by
+ * the fiber or thread that owns its connection.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VCBLOCKCHAIN_CLIENT_SESSION_HEADER_GUARD
+#define VCBLOCKCHAIN_CLIENT_SESSION_HEADER_GUARD
+
+#include <rcpr/allocator.h>
+#include <rcpr/psock.h>
+#include <rcpr/resource.h>
+#include <vcblockchain/protocol.h>
+#include <vccrypt/suite.h>
+#include <vpr/uuid.h>
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif /*__cplusplus*/
+
+/**
+ * \brief A client session.
+ */
+typedef struct vcblockchain_client_session vcblockchain_client_session;
+
+/**
+ * \brief Perform the handshake with the API and create a client session for
+ * the resulting connection.
+ *
+ * \param session                   Pointer to the pointer to receive the
+ *                                  client session on success.
+ * \param sock                      The socket connected to the API. The
+ *                                  session borrows this socket, which must
+ *                                  outlive the session.
+ * \param a                         The allocator used to receive responses.
+ *                                  It must outlive the session.
+ * \param suite                     The crypto suite to use for this session.
+ *                                  The session is allocated from its
+ *                                  allocator, which must outlive the session.
+ * \param client_id                 The entity UUID for the client.
+ * \param client_privkey            The client private key.
+ * \param server_id                 The uuid pointer to receive the server's
+ *                                  uuid.
+ * \param server_pubkey             The buffer to hold the public key received
+ *                                  from the server. THIS SHOULD BE VERIFIED BY
+ *                                  THE CALLER TO PREVENT MITM ATTACKS. This
+ *                                  buffer should not be initialized prior to
+ *                                  calling this function. On success, it is
+ *                                  initialized and owned by the caller, and
+ *                                  must be disposed when no longer needed.
+ *
+ * This function sends the handshake request, receives and verifies the
+ * handshake response, then sends the handshake acknowledgement and receives
+ * its response. The session takes ownership of the resulting shared secret
+ * and IVs, and assigns the offset of every request sent through it.
+ *
+ * On success, \p session is set to a client session instance. This instance is
+ * a \ref resource that is owned by the caller and must be released by calling
+ * \ref resource_release on its resource handle when it is no longer needed.
+ *
+ * \note TO PREVENT A MAN-IN-THE-MIDDLE ATTACK, the \p server_pubkey must be
+ * compared against a cached server public key. If these do not match, then the
+ * session must be released without being used.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the response to the
+ *        handshake acknowledgement was not a handshake acknowledgement.
+ *      - the status returned by the server if it rejected the handshake.
+ *      - a non-zero error code on failure.
+ */
+status vcblockchain_client_session_create(
+    vcblockchain_client_session** session, RCPR_SYM(psock)* sock,
+    RCPR_SYM(allocator)* a, vccrypt_suite_options_t* suite,
+    const vpr_uuid* client_id, const vccrypt_buffer_t* client_privkey,
+    vpr_uuid* server_id, vccrypt_buffer_t* server_pubkey);
+
+/**
+ * \brief Perform the handshake with the API and create a client session for
+ * the resulting connection, sending the first request of the session with the
+ * handshake acknowledgement.
+ *
+ * \param session                   Pointer to the pointer to receive the
+ *                                  client session on success.
+ * \param sock                      The socket connected to the API. The
+ *                                  session borrows this socket, which must
+ *                                  outlive the session.
+ * \param a                         The allocator used to receive responses.
+ *                                  It must outlive the session.
+ * \param suite                     The crypto suite to use for this session.
+ *                                  The session is allocated from its
+ *                                  allocator, which must outlive the session.
+ * \param client_id                 The entity UUID for the client.
+ * \param client_privkey            The client private key.
+ * \param server_id                 The uuid pointer to receive the server's
+ *                                  uuid.
+ * \param server_pubkey             The buffer to hold the public key received
+ *                                  from the server. THIS SHOULD BE VERIFIED BY
+ *                                  THE CALLER TO PREVENT MITM ATTACKS. This
+ *                                  buffer should not be initialized prior to
+ *                                  calling this function. On success, it is
+ *                                  initialized and owned by the caller, and
+ *                                  must be disposed when no longer needed.
+ * \param request                   The encoded first request. It must be
+ *                                  encoded with offset 0.
+ * \param request_size              The size of the encoded first request.
+ *
+ * This function works like \ref vcblockchain_client_session_create, except
+ * that the first request is written along with the handshake acknowledgement,
+ * which saves a round trip for short-lived connections. The server answers
+ * with the handshake acknowledgement response, which this function reads, and
+ * then the response to the first request, which the caller reads with \ref
+ * vcblockchain_client_session_recvresp_raw or a typed receive function. Later
+ * requests sent through the session are assigned offsets starting at 1.
+ *
+ * The first request is sent before the server has accepted the handshake
+ * acknowledgement. If the server rejects it, then the request is discarded
+ * unanswered, and this function fails.
+ *
+ * On success, \p session is set to a client session instance. This instance is
+ * a \ref resource that is owned by the caller and must be released by calling
+ * \ref resource_release on its resource handle when it is no longer needed.
+ *
+ * \note TO PREVENT A MAN-IN-THE-MIDDLE ATTACK, the \p server_pubkey must be
+ * compared against a cached server public key. If these do not match, then the
+ * session must be released without being used.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the response to the
+ *        handshake acknowledgement was not a handshake acknowledgement.
+ *      - the status returned by the server if it rejected the handshake.
+ *      - a non-zero error code on failure.
+ */
+status vcblockchain_client_session_create_with_request(
+    vcblockchain_client_session** session, RCPR_SYM(psock)* sock,
+    RCPR_SYM(allocator)* a, vccrypt_suite_options_t* suite,
+    const vpr_uuid* client_id, const vccrypt_buffer_t* client_privkey,
+    vpr_uuid* server_id, vccrypt_buffer_t* server_pubkey,
+    const void* request, uint32_t request_size);
+
+/**
+ * \brief Resume a previous session with the API using a resumption ticket,
+ * and create a client session for the resulting connection.
+ *
+ * \param session                   Pointer to the pointer to receive the
+ *                                  client session on success.
+ * \param sock                      The socket connected to the API. The
+ *                                  session borrows this socket, which must
+ *                                  outlive the session.
+ * \param a                         The allocator used to receive responses.
+ *                                  It must outlive the session.
+ * \param suite                     The crypto suite to use for this session.
+ *                                  The session is allocated from its
+ *                                  allocator, which must outlive the session.
+ * \param client_id                 The entity UUID for the client.
+ * \param ticket                    The resumption ticket issued during a
+ *                                  previous session.
+ * \param resumption_secret         The resumption secret bound to this ticket.
+ *
+ * The ticket is requested during an earlier session with
+ * \ref vcblockchain_client_session_sendreq_resumption_ticket_get, and its
+ * resumption secret derived with
+ * \ref vcblockchain_client_session_resumption_secret_create.
+ *
+ * This function sends the ticket with a fresh key nonce, then receives and
+ * verifies the response, which derives new session keys from the resumption
+ * secret and both key nonces. This takes a single round trip and no key
+ * agreement. The server has already been authenticated by the handshake that
+ * issued the ticket, so no server key is returned.
+ *
+ * On success, \p session is set to a client session instance. This instance is
+ * a \ref resource that is owned by the caller and must be released by calling
+ * \ref resource_release on its resource handle when it is no longer needed.
+ *
+ * If the server rejected the ticket, such as because it has expired, then its
+ * status is returned. The ticket should be discarded, and a new connection
+ * created with \ref vcblockchain_client_session_create.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the response could
+ *        not be verified.
+ *      - the status returned by the server if it rejected the ticket.
+ *      - a non-zero error code on failure.
+ */
+status vcblockchain_client_session_resume(
+    vcblockchain_client_session** session, RCPR_SYM(psock)* sock,
+    RCPR_SYM(allocator)* a, vccrypt_suite_options_t* suite,
+    const vpr_uuid* client_id, const vccrypt_buffer_t* ticket,
+    const vccrypt_buffer_t* resumption_secret);
+
+/**
+ * \brief Get the resource handle for the given client session.
+ *
+ * \param session   The client session instance to access.
+ *
+ * \returns the resource handle for this client session instance.
+ */
+RCPR_SYM(resource)* vcblockchain_client_session_resource_handle(
+    vcblockchain_client_session* session);
+
+/**
+ * \brief Send a get latest block id request to the API.
+ *
+ * \param session                   The client session to use for this request.
+ * \param offset                    Pointer to receive the offset assigned to
+ *                                  this request by the session. The response to
+ *                                  this request echoes this offset.
+ *
+ * This function sends the get latest block request to the server.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_REKEY_PENDING if a rekey has been requested, but
+ *        its response has not yet been applied.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_sendreq_latest_block_id_get(
+    vcblockchain_client_session* session, uint32_t* offset);
+
+/**
+ * \brief Send a get latest block id request to the API that only returns the
+ * block id if it differs from the one known to the client.
+ *
+ * \param session                   The client session to use for this request.
+ * \param offset                    Pointer to receive the offset assigned to
+ *                                  this request by the session. The response to
+ *                                  this request echoes this offset.
+ * \param timeout_ms                The maximum time in milliseconds that the
+ *                                  server may hold this request open waiting
+ *                                  for a new block, or 0 to answer at once.
+ * \param block_id                  The latest block id known to the client.
+ *
+ * This function sends the conditional get latest block request to the server.
+ * If the latest block id differs from \p block_id, then the server responds at
+ * once with the new block id. Otherwise, the server waits up to \p timeout_ms
+ * for a new block, and responds with a header-only response with a status of
+ * \ref VCBLOCKCHAIN_ERROR_PROTOCOL_NOT_MODIFIED if none arrives.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_REKEY_PENDING if a rekey has been requested, but
+ *        its response has not yet been applied.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_sendreq_latest_block_id_get_if_changed(
+    vcblockchain_client_session* session, uint32_t* offset, uint32_t timeout_ms,
+    const vpr_uuid* block_id);
+
+/**
+ * \brief Send a transaction submission request.
+ *
+ * \param session                   The client session to use for this request.
+ * \param offset                    Pointer to receive the offset assigned to
+ *                                  this request by the session. The response to
+ *                                  this request echoes this offset.
+ * \param txn_id                    The transaction id for this request.
+ * \param artifact_id               The artifact id for this request.
+ * \param cert                      Pointer to the certificate for this request.
+ * \param cert_size                 The size of this certificate.
+ *
+ * This function sends a transaction submission request to the server.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_REKEY_PENDING if a rekey has been requested, but
+ *        its response has not yet been applied.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_sendreq_transaction_submit(
+    vcblockchain_client_session* session, uint32_t* offset,
+    const vpr_uuid* txn_id, const vpr_uuid* artifact_id, const void* cert,
+    size_t cert_size);
+
+/**
+ * \brief Send a transaction submit batch request.
+ *
+ * \param session                   The client session to use for this request.
+ * \param offset                    Pointer to receive the offset assigned to
+ *                                  this request by the session. The response to
+ *                                  this request echoes this offset.
+ * \param txns                      Array of transactions to submit.
+ * \param count                     The number of transactions to submit.
+ *
+ * This function submits several transactions in a single packet. The
+ * certificates are encrypted directly from \p txns into the packet, without
+ * first being copied into an encoded request. The server answers with a single
+ * response holding the submit status of each transaction, which can be read
+ * using \ref vcblockchain_client_session_recvresp_transaction_submit_batch.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the batch is empty or too large.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_REKEY_PENDING if a rekey has been requested, but
+ *        its response has not yet been applied.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_sendreq_transaction_submit_batch(
+    vcblockchain_client_session* session, uint32_t* offset,
+    const protocol_transaction_submit_batch_item* txns, size_t count);
+
+/**
+ * \brief Send a transaction submission request that waits for canonization.
+ *
+ * \param session                   The client session to use for this request.
+ * \param offset                    Pointer to receive the offset assigned to
+ *                                  this request by the session. The response to
+ *                                  this request echoes this offset.
+ * \param timeout_ms                The maximum time in milliseconds to wait for
+ *                                  this transaction to be canonized, or 0 to
+ *                                  use the agent's default deadline.
+ * \param txn_id                    The transaction id for this request.
+ * \param artifact_id               The artifact id for this request.
+ * \param cert                      Pointer to the certificate for this request.
+ * \param cert_size                 The size of this certificate.
+ *
+ * This function sends a transaction submission request to the server. The
+ * server responds to this request once the transaction has been accepted, and
+ * then sends a transaction canonized notification with the offset of this
+ * request once the transaction is in a block. This notification can be read
+ * with \ref vcblockchain_client_session_recvresp_transaction_canonized. If the
+ * deadline expires first, then the server instead sends an error response with
+ * \ref VCBLOCKCHAIN_ERROR_PROTOCOL_CANONIZATION_EXPIRED.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_REKEY_PENDING if a rekey has been requested, but
+ *        its response has not yet been applied.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_sendreq_transaction_submit_await(
+    vcblockchain_client_session* session, uint32_t* offset, uint32_t timeout_ms,
+    const vpr_uuid* txn_id, const vpr_uuid* artifact_id, const void* cert,
+    size_t cert_size);
+
+/**
+ * \brief Send a block get request.
+ *
+ * \param session                   The client session to use for this request.
+ * \param offset                    Pointer to receive the offset assigned to
+ *                                  this request by the session. The response to
+ *                                  this request echoes this offset.
+ * \param block_id                  The block UUID to get, or zero_uuid for the
+ *                                  first block, or 0xff uuid for last block.
+ *
+ * This function sends a block get request to the server.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_REKEY_PENDING if a rekey has been requested, but
+ *        its response has not yet been applied.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_sendreq_block_get(
+    vcblockchain_client_session* session, uint32_t* offset,
+    const vpr_uuid* block_id);
+
+/**
+ * \brief Send a block get fields request.
+ *
+ * \param session                   The client session to use for this request.
+ * \param offset                    Pointer to receive the offset assigned to
+ *                                  this request by the session. The response to
+ *                                  this request echoes this offset.
+ * \param block_id                  The block UUID to get.
+ * \param field_mask                The \ref protocol_block_field values to
+ *                                  return.
+ *
+ * This function sends a block get request to the server that only returns the
+ * fields in \p field_mask. Walking the block chain only requires \ref
+ * PROTOCOL_BLOCK_FIELD_NEXT_BLOCK_ID or \ref
+ * PROTOCOL_BLOCK_FIELD_PREV_BLOCK_ID, and avoids transferring the certificate.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_REKEY_PENDING if a rekey has been requested, but
+ *        its response has not yet been applied.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_sendreq_block_get_fields(
+    vcblockchain_client_session* session, uint32_t* offset,
+    const vpr_uuid* block_id, uint32_t field_mask);
+
+/**
+ * \brief Send a block range get request.
+ *
+ * \param session                   The client session to use for this request.
+ * \param offset                    Pointer to receive the offset assigned to
+ *                                  this request by the session. The response to
+ *                                  this request echoes this offset.
+ * \param start_height              The height of the first block to get.
+ * \param count                     The maximum number of blocks to get.
+ * \param max_bytes                 The maximum number of bytes of block data
+ *                                  to return, or 0 to leave this up to the
+ *                                  server.
+ *
+ * This function requests up to \p count consecutive blocks starting at \p
+ * start_height in a single round trip. The server returns these blocks over one
+ * or more responses, which can be read using \ref
+ * vcblockchain_client_session_recvresp_block_range_get. If the range is
+ * truncated by \p max_bytes, the last response holds the height from which to
+ * resume.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if \p count is zero.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_REKEY_PENDING if a rekey has been requested, but
+ *        its response has not yet been applied.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_sendreq_block_range_get(
+    vcblockchain_client_session* session, uint32_t* offset,
+    uint64_t start_height, uint32_t count, uint32_t max_bytes);
+
+/**
+ * \brief Send a block transaction ids get request.
+ *
+ * \param session                   The client session to use for this request.
+ * \param offset                    Pointer to receive the offset assigned to
+ *                                  this request by the session. The response to
+ *                                  this request echoes this offset.
+ * \param block_id                  The block id.
+ * \param include_states            Set to true to also get the state of each
+ *                                  transaction.
+ *
+ * This function requests the ordered list of transaction ids for the given
+ * block, which is much smaller than the block certificate when only the ids are
+ * needed. The response can be read using \ref
+ * vcblockchain_client_session_recvresp_block_txn_ids_get.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_REKEY_PENDING if a rekey has been requested, but
+ *        its response has not yet been applied.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_sendreq_block_txn_ids_get(
+    vcblockchain_client_session* session, uint32_t* offset,
+    const vpr_uuid* block_id, bool include_states);
+
+/**
+ * \brief Send a block get next id request.
+ *
+ * \param session                   The client session to use for this request.
+ * \param offset                    Pointer to receive the offset assigned to
+ *                                  this request by the session. The response to
+ *                                  this request echoes this offset.
+ * \param block_id                  The block UUID to get, or zero_uuid for the
+ *                                  first block, or 0xff uuid for last block.
+ *
+ * This function sends a block get request to the server.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_REKEY_PENDING if a rekey has been requested, but
+ *        its response has not yet been applied.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_sendreq_block_next_id_get(
+    vcblockchain_client_session* session, uint32_t* offset,
+    const vpr_uuid* block_id);
+
+/**
+ * \brief Send a block get prev id request.
+ *
+ * \param session                   The client session to use for this request.
+ * \param offset                    Pointer to receive the offset assigned to
+ *                                  this request by the session. The response to
+ *                                  this request echoes this offset.
+ * \param block_id                  The block UUID to get, or zero_uuid for the
+ *                                  first block, or 0xff uuid for last block.
+ *
+ * This function sends a block get prev id request to the server.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_REKEY_PENDING if a rekey has been requested, but
+ *        its response has not yet been applied.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_sendreq_block_prev_id_get(
+    vcblockchain_client_session* session, uint32_t* offset,
+    const vpr_uuid* block_id);
+
+/**
+ * \brief Send a block id by height get request.
+ *
+ * \param session                   The client session to use for this request.
+ * \param offset                    Pointer to receive the offset assigned to
+ *                                  this request by the session. The response to
+ *                                  this request echoes this offset.
+ * \param height                    The block height for which to query the
+ *                                  block id.
+ *
+ * This function sends a block get request to the server.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_REKEY_PENDING if a rekey has been requested, but
+ *        its response has not yet been applied.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_sendreq_block_id_by_height_get(
+    vcblockchain_client_session* session, uint32_t* offset, uint64_t height);
+
+/**
+ * \brief Send an artifact get first transaction id request.
+ *
+ * \param session                   The client session to use for this request.
+ * \param offset                    Pointer to receive the offset assigned to
+ *                                  this request by the session. The response to
+ *                                  this request echoes this offset.
+ * \param artifact_id               The artifact UUID to get.
+ *
+ * This function sends an artifact get first transaction request to the server.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_REKEY_PENDING if a rekey has been requested, but
+ *        its response has not yet been applied.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_sendreq_artifact_first_txn_id_get(
+    vcblockchain_client_session* session, uint32_t* offset,
+    const vpr_uuid* artifact_id);
+
+/**
+ * \brief Send an artifact get last transaction id request.
+ *
+ * \param session                   The client session to use for this request.
+ * \param offset                    Pointer to receive the offset assigned to
+ *                                  this request by the session. The response to
+ *                                  this request echoes this offset.
+ * \param artifact_id               The artifact UUID to get.
+ *
+ * This function sends an artifact get last transaction request to the server.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_REKEY_PENDING if a rekey has been requested, but
+ *        its response has not yet been applied.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_sendreq_artifact_last_txn_id_get(
+    vcblockchain_client_session* session, uint32_t* offset,
+    const vpr_uuid* artifact_id);
+
+/**
+ * \brief Send an artifact get last transaction id request to the API that only
+ * returns the transaction id if it differs from the one known to the client.
+ *
+ * \param session                   The client session to use for this request.
+ * \param offset                    Pointer to receive the offset assigned to
+ *                                  this request by the session. The response to
+ *                                  this request echoes this offset.
+ * \param timeout_ms                The maximum time in milliseconds that the
+ *                                  server may hold this request open waiting
+ *                                  for a new transaction, or 0 to answer at
+ *                                  once.
+ * \param artifact_id               The artifact UUID to get.
+ * \param last_txn_id               The last transaction id for this artifact
+ *                                  known to the client.
+ *
+ * This function sends the conditional artifact get last transaction request to
+ * the server. If the last transaction id for this artifact differs from \p
+ * last_txn_id, then the server responds at once with the new transaction id.
+ * Otherwise, the server waits up to \p timeout_ms for a new transaction, and
+ * responds with a header-only response with a status of \ref
+ * VCBLOCKCHAIN_ERROR_PROTOCOL_NOT_MODIFIED if none arrives.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_REKEY_PENDING if a rekey has been requested, but
+ *        its response has not yet been applied.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_sendreq_artifact_last_txn_id_get_if_changed(
+    vcblockchain_client_session* session, uint32_t* offset, uint32_t timeout_ms,
+    const vpr_uuid* artifact_id, const vpr_uuid* last_txn_id);
+
+/**
+ * \brief Send an artifact transaction page get request.
+ *
+ * \param session                   The client session to use for this request.
+ * \param offset                    Pointer to receive the offset assigned to
+ *                                  this request by the session. The response to
+ *                                  this request echoes this offset.
+ * \param artifact_id               The artifact id.
+ * \param cursor_txn_id             The page starts after this transaction. If
+ *                                  this is the zero uuid, then the page starts
+ *                                  at the first transaction in \p direction.
+ * \param direction                 The \ref protocol_txn_page_direction for
+ *                                  this page.
+ * \param page_size                 The maximum number of transactions to
+ *                                  return.
+ * \param include_certs             Set to true to return the transaction
+ *                                  certificates.
+ *
+ * This function requests a page of up to \p page_size transactions for an
+ * artifact in a single round trip. The response holds a cursor which can be
+ * passed as \p cursor_txn_id to request the following page, and has the \ref
+ * PROTOCOL_TXN_PAGE_FLAG_MORE flag set if more transactions remain.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if \p direction is unknown or
+ *        \p page_size is zero.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_REKEY_PENDING if a rekey has been requested, but
+ *        its response has not yet been applied.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_sendreq_artifact_txn_page_get(
+    vcblockchain_client_session* session, uint32_t* offset,
+    const vpr_uuid* artifact_id, const vpr_uuid* cursor_txn_id,
+    uint32_t direction, uint32_t page_size, bool include_certs);
+
+/**
+ * \brief Send an artifact latest transaction get request.
+ *
+ * \param session                   The client session to use for this request.
+ * \param offset                    Pointer to receive the offset assigned to
+ *                                  this request by the session. The response to
+ *                                  this request echoes this offset.
+ * \param artifact_id               The artifact UUID to get.
+ *
+ * This function requests the latest transaction for the given artifact,
+ * returning the same data as a transaction get request in a single round trip.
+ * The response can be read using \ref
+ * vcblockchain_client_session_recvresp_artifact_latest_txn_get.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_REKEY_PENDING if a rekey has been requested, but
+ *        its response has not yet been applied.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_sendreq_artifact_latest_txn_get(
+    vcblockchain_client_session* session, uint32_t* offset,
+    const vpr_uuid* artifact_id);
+
+/**
+ * \brief Send a txn get request.
+ *
+ * \param session                   The client session to use for this request.
+ * \param offset                    Pointer to receive the offset assigned to
+ *                                  this request by the session. The response to
+ *                                  this request echoes this offset.
+ * \param txn_id                    The transaction UUID to get.
+ *
+ * This function sends a transaction get request to the server.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_REKEY_PENDING if a rekey has been requested, but
+ *        its response has not yet been applied.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_sendreq_txn_get(
+    vcblockchain_client_session* session, uint32_t* offset,
+    const vpr_uuid* txn_id);
+
+/**
+ * \brief Send a txn get fields request.
+ *
+ * \param session                   The client session to use for this request.
+ * \param offset                    Pointer to receive the offset assigned to
+ *                                  this request by the session. The response to
+ *                                  this request echoes this offset.
+ * \param txn_id                    The transaction UUID to get.
+ * \param field_mask                The \ref protocol_txn_field values to
+ *                                  return.
+ *
+ * This function sends a transaction get request to the server that only returns
+ * the fields in \p field_mask. Walking the transaction chain only requires \ref
+ * PROTOCOL_TXN_FIELD_NEXT_TXN_ID or \ref PROTOCOL_TXN_FIELD_PREV_TXN_ID, and
+ * avoids transferring the certificate.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_REKEY_PENDING if a rekey has been requested, but
+ *        its response has not yet been applied.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_sendreq_txn_get_fields(
+    vcblockchain_client_session* session, uint32_t* offset,
+    const vpr_uuid* txn_id, uint32_t field_mask);
+
+/**
+ * \brief Send a transaction get next id request.
+ *
+ * \param session                   The client session to use for this request.
+ * \param offset                    Pointer to receive the offset assigned to
+ *                                  this request by the session. The response to
+ *                                  this request echoes this offset.
+ * \param txn_id                    The txn UUID to query.
+ *
+ * This function sends a transaction get request to the server.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_REKEY_PENDING if a rekey has been requested, but
+ *        its response has not yet been applied.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_sendreq_txn_next_id_get(
+    vcblockchain_client_session* session, uint32_t* offset,
+    const vpr_uuid* txn_id);
+
+/**
+ * \brief Send a transaction get prev id request.
+ *
+ * \param session                   The client session to use for this request.
+ * \param offset                    Pointer to receive the offset assigned to
+ *                                  this request by the session. The response to
+ *                                  this request echoes this offset.
+ * \param txn_id                    The txn UUID to query.
+ *
+ * This function sends a transaction get request to the server.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_REKEY_PENDING if a rekey has been requested, but
+ *        its response has not yet been applied.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_sendreq_txn_prev_id_get(
+    vcblockchain_client_session* session, uint32_t* offset,
+    const vpr_uuid* txn_id);
+
+/**
+ * \brief Send a transaction get block id request.
+ *
+ * \param session                   The client session to use for this request.
+ * \param offset                    Pointer to receive the offset assigned to
+ *                                  this request by the session. The response to
+ *                                  this request echoes this offset.
+ * \param txn_id                    The txn UUID to query.
+ *
+ * This function sends a transaction get block id request to the server.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_REKEY_PENDING if a rekey has been requested, but
+ *        its response has not yet been applied.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_sendreq_txn_block_id_get(
+    vcblockchain_client_session* session, uint32_t* offset,
+    const vpr_uuid* txn_id);
+
+/**
+ * \brief Send a status get request.
+ *
+ * \param session                   The client session to use for this request.
+ * \param offset                    Pointer to receive the offset assigned to
+ *                                  this request by the session. The response to
+ *                                  this request echoes this offset.
+ *
+ * This function sends a status get request to the server.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_REKEY_PENDING if a rekey has been requested, but
+ *        its response has not yet been applied.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_sendreq_status_get(
+    vcblockchain_client_session* session, uint32_t* offset);
+
+/**
+ * \brief Send a resumption ticket get request.
+ *
+ * \param session                   The client session to use for this request.
+ * \param offset                    Pointer to receive the offset assigned to
+ *                                  this request by the session. The response to
+ *                                  this request echoes this offset.
+ *
+ * This function sends a resumption ticket get request to the server. The
+ * ticket in the response can be presented on a later connection to
+ * \ref vcblockchain_client_session_resume, which skips the key agreement of a
+ * full handshake.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_REKEY_PENDING if a rekey has been requested, but
+ *        its response has not yet been applied.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_sendreq_resumption_ticket_get(
+    vcblockchain_client_session* session, uint32_t* offset);
+
+/**
+ * \brief Derive the resumption secret for a ticket issued to this session.
+ *
+ * \param session                   The client session that was issued the
+ *                                  ticket.
+ * \param ticket                    The resumption ticket from a resumption
+ *                                  ticket get response.
+ * \param resumption_secret         The buffer to receive the resumption
+ *                                  secret. Must not have been previously
+ *                                  initialized. On success, it is initialized
+ *                                  and owned by the caller, and must be
+ *                                  disposed when no longer needed.
+ *
+ * The ticket and its resumption secret should be stored together, and passed
+ * to \ref vcblockchain_client_session_resume to resume the session on a later
+ * connection. The resumption secret must be kept as confidential as a private
+ * key.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered.
+ *      - a non-zero error code on failure.
+ */
+status vcblockchain_client_session_resumption_secret_create(
+    vcblockchain_client_session* session, const vccrypt_buffer_t* ticket,
+    vccrypt_buffer_t* resumption_secret);
+
+/**
+ * \brief Send a rekey request.
+ *
+ * \param session                   The client session to use for this request.
+ * \param offset                    Pointer to receive the offset assigned to
+ *                                  this request by the session. The response to
+ *                                  this request echoes this offset.
+ *
+ * This function asks the server to replace the shared secret of this session
+ * with one derived from it and fresh nonces, which refreshes the keys of a
+ * long-lived connection without a new handshake. The new secret applies to
+ * every client packet after this request, and to every server packet after
+ * the rekey response.
+ *
+ * Responses to earlier requests may still be received while the rekey is
+ * pending. No other request may be sent until the rekey response has been
+ * received and passed to \ref vcblockchain_client_session_rekey_apply, since
+ * the server would not be able to read it. If the request is sent, but its key
+ * nonce can't be kept, then the session is marked as failed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_REKEY_PENDING if a rekey is already pending.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_CRYPTO if the key nonce could not be
+ *        copied.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_sendreq_rekey(
+    vcblockchain_client_session* session, uint32_t* offset);
+
+/**
+ * \brief Switch to the shared secret agreed by a rekey response.
+ *
+ * \param session                   The client session with a pending rekey.
+ * \param payload                   The rekey response, as received by \ref
+ *                                  vcblockchain_client_session_recvresp_raw.
+ * \param payload_size              The size of the rekey response.
+ *
+ * This must be called as soon as the rekey response is received, before any
+ * other response is read, since the server switches to the new secret right
+ * after sending it. On success, the session sends and receives every later
+ * packet with the new secret, and requests may be sent again.
+ *
+ * If the server refused the rekey, then the session keeps its current secret,
+ * requests may be sent again, and the status from the response is returned.
+ * On any other failure, the server may already have switched to a secret that
+ * the session does not hold, so the session is marked as failed, and every
+ * later request or response on it returns VCBLOCKCHAIN_ERROR_SESSION_FAILED.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided, or
+ *        if no rekey is pending.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the server switches
+ *        at an IV other than the next one.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_CRYPTO if the new secret could not be
+ *        copied.
+ *      - the status from the response if the server refused the rekey.
+ *      - a non-zero error code on failure.
+ */
+status vcblockchain_client_session_rekey_apply(
+    vcblockchain_client_session* session, const void* payload,
+    uint32_t payload_size);
+
+/**
+ * \brief Send a connection close request.
+ *
+ * \param session                   The client session to use for this request.
+ * \param offset                    Pointer to receive the offset assigned to
+ *                                  this request by the session. The response to
+ *                                  this request echoes this offset.
+ *
+ * This function sends a connection close request to the server.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_REKEY_PENDING if a rekey has been requested, but
+ *        its response has not yet been applied.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_sendreq_connection_close(
+    vcblockchain_client_session* session, uint32_t* offset);
+
+/**
+ * \brief Send a request cancellation request.
+ *
+ * \param session                   The client session to use for this request.
+ * \param offset                    Pointer to receive the offset assigned to
+ *                                  this request by the session. The response to
+ *                                  this request echoes this offset.
+ * \param target_offset             The offset of the request to cancel.
+ *
+ * This function asks the server to abandon the request in flight at \p
+ * target_offset. That request is answered with \ref
+ * VCBLOCKCHAIN_ERROR_PROTOCOL_REQUEST_CANCELLED instead of its normal response,
+ * unless it completed first. Either way, the response to this request arrives
+ * after the final response for \p target_offset.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_REKEY_PENDING if a rekey has been requested, but
+ *        its response has not yet been applied.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_sendreq_request_cancel(
+    vcblockchain_client_session* session, uint32_t* offset,
+    uint32_t target_offset);
+
+/**
+ * \brief Send a latest block id assertion request.
+ *
+ * \param session                   The client session to use for this request.
+ * \param offset                    Pointer to receive the offset assigned to
+ *                                  this request by the session. The response to
+ *                                  this request echoes this offset.
+ * \param latest_block_id           The latest block id for this request.
+ *
+ * This function sends a connection close request to the server.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_REKEY_PENDING if a rekey has been requested, but
+ *        its response has not yet been applied.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_sendreq_assert_latest_block_id(
+    vcblockchain_client_session* session, uint32_t* offset,
+    const vpr_uuid* latest_block_id);
+
+/**
+ * \brief Send a latest block assertion cancellation request.
+ *
+ * \param session                   The client session to use for this request.
+ * \param offset                    Pointer to receive the offset assigned to
+ *                                  this request by the session. The response to
+ *                                  this request echoes this offset.
+ *
+ * This function cancels a pending latest block id assertion or block
+ * subscription.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_REKEY_PENDING if a rekey has been requested, but
+ *        its response has not yet been applied.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_sendreq_assert_latest_block_id_cancel(
+    vcblockchain_client_session* session, uint32_t* offset);
+
+/**
+ * \brief Send a block subscription request.
+ *
+ * \param session                   The client session to use for this request.
+ * \param offset                    Pointer to receive the offset assigned to
+ *                                  this request by the session. The response to
+ *                                  this request echoes this offset.
+ * \param latest_block_id           The latest block id known to the client.
+ *                                  Notifications are sent for every block
+ *                                  after this one.
+ * \param include_cert              Set to true if notifications should include
+ *                                  the block certificate.
+ *
+ * This function subscribes to new blocks. The server responds to this request
+ * once, and then sends a block notification with the offset of this request for
+ * each new block, until the subscription is cancelled with \ref
+ * vcblockchain_client_session_sendreq_assert_latest_block_id_cancel.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_REKEY_PENDING if a rekey has been requested, but
+ *        its response has not yet been applied.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_sendreq_block_subscribe(
+    vcblockchain_client_session* session, uint32_t* offset,
+    const vpr_uuid* latest_block_id, bool include_cert);
+
+/**
+ * \brief Send an artifact subscription request.
+ *
+ * \param session                   The client session to use for this request.
+ * \param offset                    Pointer to receive the offset assigned to
+ *                                  this request by the session. The response to
+ *                                  this request echoes this offset.
+ * \param artifact_ids              The artifact ids to watch.
+ * \param count                     The number of artifact ids.
+ *
+ * This function adds artifacts to the set of artifacts watched on this
+ * connection. The server responds to this request once, and then sends an
+ * artifact notification with the offset of this request each time a transaction
+ * for one of these artifacts is canonized, until the artifact is removed with
+ * \ref vcblockchain_client_session_sendreq_artifact_unsubscribe.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_REKEY_PENDING if a rekey has been requested, but
+ *        its response has not yet been applied.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_sendreq_artifact_subscribe(
+    vcblockchain_client_session* session, uint32_t* offset,
+    const vpr_uuid* artifact_ids, size_t count);
+
+/**
+ * \brief Send an artifact unsubscription request.
+ *
+ * \param session                   The client session to use for this request.
+ * \param offset                    Pointer to receive the offset assigned to
+ *                                  this request by the session. The response to
+ *                                  this request echoes this offset.
+ * \param artifact_ids              The artifact ids to stop watching. This may
+ *                                  be NULL if \p count is zero.
+ * \param count                     The number of artifact ids. If zero, then
+ *                                  every watched artifact is removed.
+ *
+ * This function removes artifacts from the set of artifacts watched on this
+ * connection. No further notifications are sent for these artifacts once the
+ * server has responded to this request.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_REKEY_PENDING if a rekey has been requested, but
+ *        its response has not yet been applied.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_sendreq_artifact_unsubscribe(
+    vcblockchain_client_session* session, uint32_t* offset,
+    const vpr_uuid* artifact_ids, size_t count);
+
+/**
+ * \brief Send a batch request.
+ *
+ * \param session                   The client session to use for this request.
+ * \param offset                    Pointer to receive the offset assigned to
+ *                                  this request by the session. The response to
+ *                                  this request echoes this offset.
+ * \param requests                  Array of encoded requests, each created by
+ *                                  the matching request encode function.
+ * \param count                     The number of requests in the batch.
+ *
+ * This function sends every request in \p requests to the server in a single
+ * authenticated packet. Each request keeps its own offset, and the server
+ * answers with a single batch response holding one status and one encoded
+ * response per request, in the same order.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the batch is empty, too large, or
+ *        holds a malformed or nested batch request.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_REKEY_PENDING if a rekey has been requested, but
+ *        its response has not yet been applied.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_sendreq_batch(
+    vcblockchain_client_session* session, uint32_t* offset,
+    const vccrypt_buffer_t* requests, size_t count);
+
+/**
+ * \brief Send an extended API enable request.
+ *
+ * This request enables the connected entity to field extended API requests to
+ * it through the blockchain agent. The blockchain agent will authenticate and
+ * authorize other entities wishing to send requests to this entity, but from
+ * there, will only forward requests to this entity. It is up to this entity to
+ * perform any additional parameter checks on any requests it receives.
+ *
+ * \param session                   The client session to use for this request.
+ * \param offset                    Pointer to receive the offset assigned to
+ *                                  this request by the session. The response to
+ *                                  this request echoes this offset.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_REKEY_PENDING if a rekey has been requested, but
+ *        its response has not yet been applied.
+ *      - a non-zero error code on failure.
+ */
+status vcblockchain_client_session_sendreq_extended_api_enable(
+    vcblockchain_client_session* session, uint32_t* offset);
+
+/**
+ * \brief Send an extended API request.
+ *
+ * \param session                   The client session to use for this request.
+ * \param offset                    Pointer to receive the offset assigned to
+ *                                  this request by the session. The response to
+ *                                  this request echoes this offset.
+ * \param entity_id                 The entity to which this request should be
+ *                                  sent.
+ * \param verb_id                   The verb id for this request.
+ * \param request_body              The body of the request to be sent.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_REKEY_PENDING if a rekey has been requested, but
+ *        its response has not yet been applied.
+ *      - a non-zero error code on failure.
+ */
+status vcblockchain_client_session_sendreq_extended_api(
+    vcblockchain_client_session* session, uint32_t* offset,
+    const vpr_uuid* entity_id, const vpr_uuid* verb_id,
+    const vccrypt_buffer_t* request_body);
+
+/**
+ * \brief Send a response to an extended API request.
+ *
+ * \param session                   The client session to use for this request.
+ * \param offset                    The offset provided by agentd for the
+ *                                  original extended request. Unlike regular
+ *                                  offsets, these are 64-bit and are only used
+ *                                  once.
+ * \param status                    The status to pass to the client.
+ * \param response_body             The body of the response to be sent.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_REKEY_PENDING if a rekey has been requested, but
+ *        its response has not yet been applied.
+ *      - a non-zero error code on failure.
+ */
+status vcblockchain_client_session_sendreq_extended_api_response(
+    vcblockchain_client_session* session, uint64_t offset, uint32_t status,
+    const vccrypt_buffer_t* response_body);
+
+/**
+ * \brief Send a flow credit grant request.
+ *
+ * \param session                   The client session to use for this request.
+ * \param offset                    Pointer to receive the offset assigned to
+ *                                  this request by the session. The response to
+ *                                  this request echoes this offset.
+ * \param request_credits           The number of requests granted. The client
+ *                                  does not limit the number of responses, so
+ *                                  this should be zero.
+ * \param byte_credits              The number of response bytes granted.
+ *
+ * The first grant sent on a session negotiates flow control, and its response
+ * can be read using \ref
+ * vcblockchain_client_session_recvresp_flow_credit_grant. Later grants return
+ * credits as the client frees capacity, and are not answered.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_REKEY_PENDING if a rekey has been requested, but
+ *        its response has not yet been applied.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_sendreq_flow_credit_grant(
+    vcblockchain_client_session* session, uint32_t* offset,
+    uint32_t request_credits, uint64_t byte_credits);
+
+/**
+ * \brief Receive a response from the API, adopting the decrypted payload.
+ *
+ * \param session                   The client session from which this response
+ *                                  is read.
+ * \param payload                   Pointer to receive the decrypted payload on
+ *                                  success.
+ * \param payload_size              Pointer to receive the size of the payload
+ *                                  on success.
+ *
+ * This call reads a response from the protocol. On success, \p payload is set
+ * to the plaintext exactly as it was decrypted by the socket layer. Unlike \ref
+ * vcblockchain_protocol_recvresp, the payload is not copied into a crypto
+ * buffer. It is allocated by the session allocator, is owned by the caller, and
+ * must be released by calling \ref
+ * vcblockchain_client_session_recvresp_raw_release when no longer needed. The
+ * caller can decode it in place by passing it to the matching response decode
+ * function.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_READ if reading from the socket failed.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_recvresp_raw(
+    vcblockchain_client_session* session, void** payload,
+    uint32_t* payload_size);
+
+/**
+ * \brief Release a payload received by \ref
+ * vcblockchain_client_session_recvresp_raw.
+ *
+ * \param session                   The client session used to receive this
+ *                                  payload.
+ * \param payload                   The payload to release.
+ * \param payload_size              The size of the payload.
+ *
+ * The payload is plaintext from an authenticated channel, so it is wiped before
+ * it is returned to the allocator.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - a non-zero error response if reclaiming the payload failed.
+ */
+status vcblockchain_client_session_recvresp_raw_release(
+    vcblockchain_client_session* session, void* payload, uint32_t payload_size);
+
+/**
+ * \brief Receive a transaction get response from the API and decode it.
+ *
+ * \param session                   The client session from which this response
+ *                                  is read.
+ * \param alloc_opts                The allocator to use for the decoded
+ *                                  response.
+ * \param resp                      The response structure to initialize.
+ *
+ * This call reads the response to a request sent by \ref
+ * vcblockchain_client_session_sendreq_txn_get, decoding it directly from the
+ * decrypted payload. On success, \p resp is initialized and owned by the
+ * caller, who must \ref dispose() it when it is no longer needed. If the server
+ * returned an error status, then \p resp is not initialized.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_READ if reading from the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the response was not a
+ *        transaction get response.
+ *      - the status returned by the server if the request failed.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_recvresp_txn_get(
+    vcblockchain_client_session* session, allocator_options_t* alloc_opts,
+    protocol_resp_txn_get* resp);
+
+/**
+ * \brief Receive an artifact transaction page get response from the API and
+ * decode it.
+ *
+ * \param session                   The client session from which this response
+ *                                  is read.
+ * \param alloc_opts                The allocator to use for the decoded
+ *                                  response.
+ * \param resp                      The response structure to initialize.
+ *
+ * This call reads the response to a request sent by \ref
+ * vcblockchain_client_session_sendreq_artifact_txn_page_get, decoding it
+ * directly from the decrypted payload. On success, \p resp is initialized and
+ * owned by the caller, who must \ref dispose() it when it is no longer needed.
+ * If the server returned an error status, then \p resp is not initialized.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_READ if reading from the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the response was not a
+ *        artifact transaction page get response.
+ *      - the status returned by the server if the request failed.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_recvresp_artifact_txn_page_get(
+    vcblockchain_client_session* session, allocator_options_t* alloc_opts,
+    protocol_resp_artifact_txn_page_get* resp);
+
+/**
+ * \brief Receive an artifact latest transaction get response from the API and
+ * decode it.
+ *
+ * \param session                   The client session from which this response
+ *                                  is read.
+ * \param alloc_opts                The allocator to use for the decoded
+ *                                  response.
+ * \param resp                      The response structure to initialize.
+ *
+ * This call reads the response to a request sent by \ref
+ * vcblockchain_client_session_sendreq_artifact_latest_txn_get, decoding it
+ * directly from the decrypted payload into a transaction get response. On
+ * success, \p resp is initialized and owned by the caller, who must \ref
+ * dispose() it when it is no longer needed. If the server returned an error
+ * status, then \p resp is not initialized.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_READ if reading from the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the response was not a
+ *        artifact latest transaction get response.
+ *      - the status returned by the server if the request failed.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_recvresp_artifact_latest_txn_get(
+    vcblockchain_client_session* session, allocator_options_t* alloc_opts,
+    protocol_resp_txn_get* resp);
+
+/**
+ * \brief Receive a block get response from the API and decode it.
+ *
+ * \param session                   The client session from which this response
+ *                                  is read.
+ * \param alloc_opts                The allocator to use for the decoded
+ *                                  response.
+ * \param resp                      The response structure to initialize.
+ *
+ * This call reads the response to a request sent by \ref
+ * vcblockchain_client_session_sendreq_block_get, decoding it directly from the
+ * decrypted payload. On success, \p resp is initialized and owned by the
+ * caller, who must \ref dispose() it when it is no longer needed. If the server
+ * returned an error status, then \p resp is not initialized.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_READ if reading from the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the response was not a
+ *        block get response.
+ *      - the status returned by the server if the request failed.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_recvresp_block_get(
+    vcblockchain_client_session* session, allocator_options_t* alloc_opts,
+    protocol_resp_block_get* resp);
+
+/**
+ * \brief Receive a block range get response from the API and decode it.
+ *
+ * \param session                   The client session from which this response
+ *                                  is read.
+ * \param alloc_opts                The allocator to use for the decoded
+ *                                  response.
+ * \param resp                      The response structure to initialize.
+ *
+ * This call reads the response to a request sent by \ref
+ * vcblockchain_client_session_sendreq_block_range_get, decoding it directly
+ * from the decrypted payload. On success, \p resp is initialized and owned by
+ * the caller, who must \ref dispose() it when it is no longer needed. If the
+ * server returned an error status, then \p resp is not initialized.
+ *
+ * A block range may be returned over several responses. While the \ref
+ * PROTOCOL_BLOCK_RANGE_FLAG_MORE flag is set in \p resp, the caller should call
+ * this function again to receive the next run of blocks.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_READ if reading from the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the response was not a
+ *        block range get response.
+ *      - the status returned by the server if the request failed.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_recvresp_block_range_get(
+    vcblockchain_client_session* session, allocator_options_t* alloc_opts,
+    protocol_resp_block_range_get* resp);
+
+/**
+ * \brief Receive a block transaction ids get response from the API and decode
+ * it.
+ *
+ * \param session                   The client session from which this response
+ *                                  is read.
+ * \param alloc_opts                The allocator to use for the decoded
+ *                                  response.
+ * \param resp                      The response structure to initialize.
+ *
+ * This call reads the response to a request sent by \ref
+ * vcblockchain_client_session_sendreq_block_txn_ids_get, decoding it directly
+ * from the decrypted payload. On success, \p resp is initialized and owned by
+ * the caller, who must \ref dispose() it when it is no longer needed. If the
+ * server returned an error status, then \p resp is not initialized.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_READ if reading from the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the response was not a
+ *        block transaction ids get response.
+ *      - the status returned by the server if the request failed.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_recvresp_block_txn_ids_get(
+    vcblockchain_client_session* session, allocator_options_t* alloc_opts,
+    protocol_resp_block_txn_ids_get* resp);
+
+/**
+ * \brief Receive a transaction submit batch response from the API and decode
+ * it.
+ *
+ * \param session                   The client session from which this response
+ *                                  is read.
+ * \param alloc_opts                The allocator to use for the decoded
+ *                                  response.
+ * \param resp                      The response structure to initialize.
+ *
+ * This call reads the response to a request sent by \ref
+ * vcblockchain_client_session_sendreq_transaction_submit_batch, decoding it
+ * directly from the decrypted payload. On success, \p resp is initialized and
+ * owned by the caller, who must \ref dispose() it when it is no longer needed.
+ * If the server returned an error status, then \p resp is not initialized. The
+ * submit status of each transaction is held in the statuses array of \p resp.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_READ if reading from the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the response was not a
+ *        transaction submit batch response.
+ *      - the status returned by the server if the request failed.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_recvresp_transaction_submit_batch(
+    vcblockchain_client_session* session, allocator_options_t* alloc_opts,
+    protocol_resp_transaction_submit_batch* resp);
+
+/**
+ * \brief Wait for a transaction canonized notification from the API and decode
+ * it.
+ *
+ * \param session                   The client session from which this response
+ *                                  is read.
+ * \param resp                      The notification structure to initialize.
+ *
+ * This call waits for the outcome of a request sent by \ref
+ * vcblockchain_client_session_sendreq_transaction_submit_await. If the next
+ * response is the acknowledgement for this submission, then it is consumed, and
+ * this call continues to wait for the notification that follows it. The
+ * notification is decoded directly from the decrypted payload. On success, \p
+ * resp is initialized and owned by the caller, who must \ref dispose() it when
+ * it is no longer needed. If the submission failed or its deadline expired,
+ * then the status returned by the server is returned, and \p resp is not
+ * initialized.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_READ if reading from the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the response was not
+ *        a transaction canonized notification.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_CANONIZATION_EXPIRED if the transaction
+ *        was not canonized before the deadline.
+ *      - the status returned by the server if the request failed.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_recvresp_transaction_canonized(
+    vcblockchain_client_session* session,
+    protocol_resp_transaction_canonized* resp);
+
+/**
+ * \brief Receive a block notification from the API and decode it.
+ *
+ * \param session                   The client session from which this response
+ *                                  is read.
+ * \param alloc_opts                The allocator to use for the decoded
+ *                                  notification.
+ * \param resp                      The notification structure to initialize.
+ *
+ * This call reads the next notification for a subscription created by \ref
+ * vcblockchain_client_session_sendreq_block_subscribe, decoding it directly
+ * from the decrypted payload. On success, \p resp is initialized and owned by
+ * the caller, who must \ref dispose() it when it is no longer needed. If the
+ * server returned an error status, then \p resp is not initialized.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_READ if reading from the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the response was not a
+ *        block notification.
+ *      - the status returned by the server if the request failed.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_recvresp_block_notification(
+    vcblockchain_client_session* session, allocator_options_t* alloc_opts,
+    protocol_resp_block_notification* resp);
+
+/**
+ * \brief Receive an artifact notification from the API and decode it.
+ *
+ * \param session                   The client session from which this response
+ *                                  is read.
+ * \param resp                      The notification structure to initialize.
+ *
+ * This call reads the next notification for a subscription created by \ref
+ * vcblockchain_client_session_sendreq_artifact_subscribe, decoding it directly
+ * from the decrypted payload. On success, \p resp is initialized and owned by
+ * the caller, who must \ref dispose() it when it is no longer needed. If the
+ * server returned an error status, then \p resp is not initialized.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_READ if reading from the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the response was not
+ *        an artifact notification.
+ *      - the status returned by the server if the request failed.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_recvresp_artifact_notification(
+    vcblockchain_client_session* session,
+    protocol_resp_artifact_notification* resp);
+
+/**
+ * \brief Receive a extended API response from the API and decode it.
+ *
+ * \param session                   The client session from which this response
+ *                                  is read.
+ * \param alloc_opts                The allocator to use for the decoded
+ *                                  response.
+ * \param resp                      The response structure to initialize.
+ *
+ * This call reads the response to a request sent by \ref
+ * vcblockchain_client_session_sendreq_extended_api, decoding it directly from
+ * the decrypted payload. On success, \p resp is initialized and owned by the
+ * caller, who must \ref dispose() it when it is no longer needed. If the server
+ * returned an error status, then \p resp is not initialized.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_READ if reading from the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the response was not a
+ *        extended API response.
+ *      - the status returned by the server if the request failed.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_recvresp_extended_api(
+    vcblockchain_client_session* session, allocator_options_t* alloc_opts,
+    protocol_resp_extended_api* resp);
+
+/**
+ * \brief Receive a flow credit grant response from the API and decode it.
+ *
+ * \param session                   The client session from which this response
+ *                                  is read.
+ * \param resp                      The response structure to initialize.
+ *
+ * This call reads the agent's answer to the first grant sent by \ref
+ * vcblockchain_client_session_sendreq_flow_credit_grant, decoding it directly
+ * from the decrypted payload. On success, \p resp is initialized and owned by
+ * the caller, who must \ref dispose() it when it is no longer needed. If the
+ * agent refused the grant, then \p resp is not initialized, and flow control
+ * stays off for the session.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_READ if reading from the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the response was not a
+ *        flow credit grant response.
+ *      - the status returned by the server if it refused the grant.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_recvresp_flow_credit_grant(
+    vcblockchain_client_session* session,
+    protocol_resp_flow_credit_grant* resp);
+
+/**
+ * \brief Return true if the given client session is valid.
+ *
+ * \param session   The client session instance to check.
+ *
+ * \note This function is only available at model check time.
+ *
+ * \returns true if the instance is valid.
+ */
+bool prop_vcblockchain_client_session_valid(
+    const vcblockchain_client_session* session);
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif /*__cplusplus*/
+
+#endif /*VCBLOCKCHAIN_CLIENT_SESSION_HEADER_GUARD*/
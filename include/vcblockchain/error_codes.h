@@ -100,6 +100,79 @@ extern "C" {
  */
 #define VCBLOCKCHAIN_ERROR_INET_RESOLUTION_FAILURE 0x510d
 
+/**
+ * \brief A submitted transaction was not canonized before its deadline.
+ */
+#define VCBLOCKCHAIN_ERROR_PROTOCOL_CANONIZATION_EXPIRED 0x510e
+
+/**
+ * \brief The value requested by a conditional get has not changed from the
+ * value known to the client.
+ */
+#define VCBLOCKCHAIN_ERROR_PROTOCOL_NOT_MODIFIED 0x510f
+
+/**
+ * \brief A request was cancelled by the client before it completed.
+ */
+#define VCBLOCKCHAIN_ERROR_PROTOCOL_REQUEST_CANCELLED 0x5110
+
+/**
+ * \brief A cancel request named an offset with no request in flight.
+ */
+#define VCBLOCKCHAIN_ERROR_PROTOCOL_REQUEST_NOT_FOUND 0x5111
+
+/**
+ * \brief A cancel table has no room to track another request in flight.
+ */
+#define VCBLOCKCHAIN_ERROR_CANCEL_TABLE_FULL 0x5112
+
+/**
+ * \brief A client multiplexer already has as many requests in flight as its
+ * pipeline depth allows.
+ */
+#define VCBLOCKCHAIN_ERROR_PIPELINE_FULL 0x5113
+
+/**
+ * \brief A buffer does not yet hold a complete packet.
+ */
+#define VCBLOCKCHAIN_ERROR_SSOCK_PACKET_INCOMPLETE 0x5114
+
+/**
+ * \brief A request did not complete before its deadline.
+ */
+#define VCBLOCKCHAIN_ERROR_REQUEST_TIMED_OUT 0x5115
+
+/**
+ * \brief Every session in a client pool is in use.
+ */
+#define VCBLOCKCHAIN_ERROR_POOL_EXHAUSTED 0x5116
+
+/**
+ * \brief A resumption ticket was rejected, so a full handshake is required.
+ */
+#define VCBLOCKCHAIN_ERROR_PROTOCOL_TICKET_REJECTED 0x5117
+
+/**
+ * \brief A stream writer or reader has no room to open another stream.
+ */
+#define VCBLOCKCHAIN_ERROR_STREAM_TABLE_FULL 0x5118
+
+/**
+ * \brief A sender has used up the flow credits granted by its receiver.
+ */
+#define VCBLOCKCHAIN_ERROR_FLOW_CREDIT_EXHAUSTED 0x5119
+
+/**
+ * \brief A request can't be sent while a rekey of its session is pending.
+ */
+#define VCBLOCKCHAIN_ERROR_REKEY_PENDING 0x511A
+
+/**
+ * \brief A session can't be used after a failure left its keys out of step
+ * with the server.
+ */
+#define VCBLOCKCHAIN_ERROR_SESSION_FAILED 0x511B
+
 /**
  * @}
  */
@@ -0,0 +1,186 @@
+/**
+ * \file vcblockchain/flow_credit.h
+ *
+ * \brief Credit-based flow control for pipelined requests.
+ *
+ * Once a client pipelines requests, nothing else stops it from queueing more
+ * work than the agent can buffer, or the agent from sending more response
+ * bytes than the client can buffer. With flow control, each receiver grants
+ * its sender a window of credits: a number of requests and a number of bytes.
+ * The sender consumes credits for each message it sends, and stops once they
+ * run out. The receiver returns credits with a grant as it frees capacity. The
+ * agent grants the client request and request byte credits, and the client
+ * grants the agent response byte credits.
+ *
+ * A flow credit account tracks one direction of a connection. The sender's
+ * account holds the credits it may still use. The receiver's account mirrors
+ * the sender's, so that it can reject a sender that overruns its window, and
+ * also holds the capacity it has freed but not yet granted.
+ *
+ *   - the sender calls \ref vcblockchain_flow_credit_consume before sending
+ *     each message. If it fails with
+ *     \ref VCBLOCKCHAIN_ERROR_FLOW_CREDIT_EXHAUSTED, then the sender waits for
+ *     a grant, and passes the grant to \ref vcblockchain_flow_credit_grant.
+ *   - the receiver calls \ref vcblockchain_flow_credit_consume on each message
+ *     it receives, and closes the connection if this fails. As it frees the
+ *     capacity held by each message, it calls
+ *     \ref vcblockchain_flow_credit_release, and then sends whatever
+ *     \ref vcblockchain_flow_credit_grant_due returns.
+ *
+ * Flow control is negotiated with the first request of a connection, which
+ * can be sent along with the handshake ack by
+ * \ref vcblockchain_client_session_create_with_request. The client sends a
+ * flow credit grant request holding its receive window. The agent answers
+ * with a flow credit grant response holding its own, or with an error if it
+ * does not support flow control, in which case flow control is off for the
+ * connection. A window of zero leaves that kind of credit unlimited. On a
+ * client session, these are sent and read with
+ * \ref vcblockchain_client_session_sendreq_flow_credit_grant and
+ * \ref vcblockchain_client_session_recvresp_flow_credit_grant.
+ *
+ * A client built on a \ref vcblockchain_client_mux attaches its request
+ * credits with \ref vcblockchain_client_mux_flow_credit_attach. The
+ * multiplexer then applies each grant from the agent as responses are
+ * dispatched, and \ref vcblockchain_client_mux_flow_credit_consume blocks
+ * until a request can be sent.
+ *
+ * A message can never be larger than the byte window. Payloads larger than
+ * the window can be sent as frames on a logical stream; see \ref stream.h.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VCBLOCKCHAIN_FLOW_CREDIT_HEADER_GUARD
+#define VCBLOCKCHAIN_FLOW_CREDIT_HEADER_GUARD
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif /*__cplusplus*/
+
+/**
+ * \brief A flow credit account for one direction of a connection.
+ */
+typedef struct vcblockchain_flow_credit
+{
+    /** \brief the request window, or zero if requests are unlimited. */
+    uint32_t request_window;
+    /** \brief the byte window, or zero if bytes are unlimited. */
+    uint64_t byte_window;
+    /** \brief the number of requests the sender may still send. */
+    uint32_t request_credits;
+    /** \brief the number of bytes the sender may still send. */
+    uint64_t byte_credits;
+    /** \brief the requests freed by the receiver but not yet granted. */
+    uint32_t requests_freed;
+    /** \brief the bytes freed by the receiver but not yet granted. */
+    uint64_t bytes_freed;
+} vcblockchain_flow_credit;
+
+/**
+ * \brief Initialize a flow credit account with a full window.
+ *
+ * \param credit                    The flow credit account to initialize.
+ * \param request_window            The number of requests in the window, or
+ *                                  zero if requests are unlimited.
+ * \param byte_window               The number of bytes in the window, or zero
+ *                                  if bytes are unlimited.
+ *
+ * The windows are the ones exchanged when flow control is negotiated. A
+ * sender initializes its account with the window granted by its receiver,
+ * and a receiver initializes its account with the window it granted.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ */
+int vcblockchain_flow_credit_init(
+    vcblockchain_flow_credit* credit, uint32_t request_window,
+    uint64_t byte_window);
+
+/**
+ * \brief Consume the credits for a message.
+ *
+ * \param credit                    The flow credit account.
+ * \param requests                  The number of requests in the message.
+ * \param bytes                     The size of the message.
+ *
+ * On failure, no credits are consumed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided,
+ *        or if the message is larger than the window, so that it could never
+ *        be sent.
+ *      - VCBLOCKCHAIN_ERROR_FLOW_CREDIT_EXHAUSTED if there are not enough
+ *        credits left. A sender should wait for a grant, and a receiver
+ *        should close the connection.
+ */
+int vcblockchain_flow_credit_consume(
+    vcblockchain_flow_credit* credit, uint32_t requests, uint64_t bytes);
+
+/**
+ * \brief Apply a grant received from the receiver.
+ *
+ * \param credit                    The flow credit account.
+ * \param requests                  The number of requests granted.
+ * \param bytes                     The number of bytes granted.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the grant returns
+ *        more credits than were consumed.
+ */
+int vcblockchain_flow_credit_grant(
+    vcblockchain_flow_credit* credit, uint32_t requests, uint64_t bytes);
+
+/**
+ * \brief Free the capacity held by a message that has been received.
+ *
+ * \param credit                    The flow credit account.
+ * \param requests                  The number of requests in the message.
+ * \param bytes                     The size of the message.
+ *
+ * The freed credits are returned to the sender by the next grant that
+ * \ref vcblockchain_flow_credit_grant_due reports.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided,
+ *        or if more credits are freed than were consumed.
+ */
+int vcblockchain_flow_credit_release(
+    vcblockchain_flow_credit* credit, uint32_t requests, uint64_t bytes);
+
+/**
+ * \brief Take the credits that are due to be granted to the sender.
+ *
+ * \param credit                    The flow credit account.
+ * \param requests                  Pointer to receive the number of requests
+ *                                  to grant.
+ * \param bytes                     Pointer to receive the number of bytes to
+ *                                  grant.
+ *
+ * To keep grants infrequent, freed credits are held until at least half of a
+ * window has been freed, or until every consumed credit has been freed, so
+ * that a sender that is waiting always receives a grant. If both counts are
+ * zero, then no grant is due. Otherwise, the receiver must send a grant with
+ * these counts, which are now counted as available to the sender.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ */
+int vcblockchain_flow_credit_grant_due(
+    vcblockchain_flow_credit* credit, uint32_t* requests, uint64_t* bytes);
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif /*__cplusplus*/
+
+#endif /*VCBLOCKCHAIN_FLOW_CREDIT_HEADER_GUARD*/
@@ -13,4 +13,10 @@
 #define VCBLOCKCHAIN_LIMIT_MAXIMUM_ENCRYPTED_PACKET_SIZE \
     (250ULL * 1024ULL * 1024ULL)
 
+/* Set the maximum number of requests in a batch to 1024. */
+#define VCBLOCKCHAIN_LIMIT_MAXIMUM_BATCH_COUNT 1024
+
+/* Set the maximum number of artifacts in a subscription request to 1024. */
+#define VCBLOCKCHAIN_LIMIT_MAXIMUM_ARTIFACT_SUBSCRIPTION_COUNT 1024
+
 #endif /*VCBLOCKCHAIN_LIMITS_HEADER_GUARD*/
@@ -12,6 +12,7 @@
 
 #include <rcpr/psock.h>
 #include <vccrypt/suite.h>
+#include <vcblockchain/protocol/data.h>
 #include <vpr/allocator.h>
 
 /* make this header C++ friendly. */
@@ -154,6 +155,176 @@ status vcblockchain_protocol_sendreq_handshake_ack(
     uint64_t* server_iv, const vccrypt_buffer_t* shared_secret,
     const vccrypt_buffer_t* server_challenge_nonce);
 
+/**
+ * \brief Send a handshake acknowledge to the API, along with the first request
+ * of the session.
+ *
+ * \param sock                      The socket to which this request is written.
+ * \param suite                     The crypto suite to use for this handshake.
+ * \param client_iv                 Pointer to receive the updated client IV.
+ * \param server_iv                 Pointer to receive the updated server IV.
+ * \param shared_secret             The shared secret key for this request.
+ * \param server_challenge_nonce    The server challenge nonce for this request.
+ * \param request                   The encoded first request, such as one built
+ *                                  by a request encode function.
+ * \param request_size              The size of the encoded first request.
+ *
+ * This function seals the handshake acknowledgement and the first request as
+ * consecutive authorized packets, then writes both to the server in a single
+ * write, so they leave in the same segment. The server reads them in order, so
+ * it answers with the handshake acknowledgement response and then the response
+ * to the first request, without waiting for another round trip. The caller
+ * reads both responses in that order.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_protocol_sendreq_handshake_ack_with_request(
+    RCPR_SYM(psock)* sock, vccrypt_suite_options_t* suite, uint64_t* client_iv,
+    uint64_t* server_iv, const vccrypt_buffer_t* shared_secret,
+    const vccrypt_buffer_t* server_challenge_nonce, const void* request,
+    uint32_t request_size);
+
+/**
+ * \brief Send a handshake resume request to the API.
+ *
+ * \param sock              The socket to which this request is written.
+ * \param suite             The crypto suite to use for this handshake.
+ * \param client_id         The entity UUID for the client.
+ * \param ticket            The resumption ticket issued by the agent during a
+ *                          previous session.
+ * \param key_nonce         Buffer to receive the client key nonce for this
+ *                          request. This buffer must not have been previously
+ *                          initialized. On success, this is initialized and
+ *                          owned by the caller; it must be disposed by the
+ *                          caller when no longer needed.
+ *
+ * This function generates entropy data for the key nonce based on the suite,
+ * and sends it to the server with the ticket. No challenge nonce is needed,
+ * since the server can only answer with a valid MAC if it can open the ticket.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if a write to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if an out-of-memory issue was
+ *        encountered.
+ *      - a non-zero error code on failure.
+ */
+status vcblockchain_protocol_sendreq_handshake_resume(
+    RCPR_SYM(psock)* sock, vccrypt_suite_options_t* suite,
+    const vpr_uuid* client_id, const vccrypt_buffer_t* ticket,
+    vccrypt_buffer_t* key_nonce);
+
+/**
+ * \brief Receive a handshake resume response from the API.
+ *
+ * \param sock                      The socket from which this response is read.
+ * \param a                         The allocator to use for this operation.
+ * \param suite                     The crypto suite to use to verify this
+ *                                  response.
+ * \param resumption_secret         The resumption secret bound to the ticket
+ *                                  presented in the request.
+ * \param client_key_nonce          The client key nonce for this handshake.
+ * \param shared_secret             The buffer to receive the shared secret for
+ *                                  this session. Must not have been previously
+ *                                  initialized. On success, it is initialized
+ *                                  and populated with the shared secret. This
+ *                                  is owned by the caller and must be disposed
+ *                                  when no longer needed.
+ * \param client_iv                 Pointer to receive the client IV.
+ * \param server_iv                 Pointer to receive the server IV.
+ * \param offset                    The offset for this response.
+ * \param status                    The status for this response.
+ *
+ * The shared secret for the resumed session is derived from the resumption
+ * secret and both key nonces, and the response is verified with it. A valid
+ * response proves that the server opened the ticket. The client proves the
+ * same by sending its first authenticated request, so no acknowledgement is
+ * sent, and the IVs are set as if one had been.
+ *
+ * If the server rejected the ticket, then its status is returned. The caller
+ * should discard the ticket and fall back to a full handshake.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_READ if a read on the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the response could
+ *        not be verified.
+ *      - the status returned by the server if it rejected the ticket.
+ *      - a non-zero error code on failure.
+ */
+status vcblockchain_protocol_recvresp_handshake_resume(
+    RCPR_SYM(psock)* sock, RCPR_SYM(allocator)* a,
+    vccrypt_suite_options_t* suite, const vccrypt_buffer_t* resumption_secret,
+    const vccrypt_buffer_t* client_key_nonce, vccrypt_buffer_t* shared_secret,
+    uint64_t* client_iv, uint64_t* server_iv, uint32_t* offset,
+    uint32_t* status);
+
+/**
+ * \brief Derive the resumption secret bound to a resumption ticket.
+ *
+ * \param resumption_secret         The buffer to receive the resumption
+ *                                  secret. Must not have been previously
+ *                                  initialized. On success, it is initialized
+ *                                  and owned by the caller, and must be
+ *                                  disposed when no longer needed.
+ * \param suite                     The crypto suite to use for this operation.
+ * \param shared_secret             The shared secret of the session for which
+ *                                  the ticket was issued.
+ * \param ticket                    The resumption ticket.
+ *
+ * The resumption secret is the short MAC of the ticket, keyed by the shared
+ * secret of the session that was issued the ticket. The client keeps it with
+ * the ticket in place of that shared secret. The agent recovers the shared
+ * secret by opening the ticket, and derives the same resumption secret.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered.
+ *      - a non-zero error code on failure.
+ */
+status vcblockchain_protocol_resumption_secret_create(
+    vccrypt_buffer_t* resumption_secret, vccrypt_suite_options_t* suite,
+    const vccrypt_buffer_t* shared_secret, const vccrypt_buffer_t* ticket);
+
+/**
+ * \brief Derive the shared secret for a resumed session.
+ *
+ * \param shared_secret             The buffer to receive the shared secret.
+ *                                  Must not have been previously initialized.
+ *                                  On success, it is initialized and owned by
+ *                                  the caller, and must be disposed when no
+ *                                  longer needed.
+ * \param suite                     The crypto suite to use for this operation.
+ * \param resumption_secret         The resumption secret bound to the ticket
+ *                                  presented for this session.
+ * \param client_key_nonce          The client key nonce for this session.
+ * \param server_key_nonce          The server key nonce for this session.
+ *
+ * The shared secret is the short MAC of the client key nonce followed by the
+ * server key nonce, keyed by the resumption secret. Since both nonces are
+ * fresh, each resumed session gets its own keys, and a single MAC replaces the
+ * key agreement of a full handshake.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered.
+ *      - a non-zero error code on failure.
+ */
+status vcblockchain_protocol_resumed_shared_secret_create(
+    vccrypt_buffer_t* shared_secret, vccrypt_suite_options_t* suite,
+    const vccrypt_buffer_t* resumption_secret,
+    const vccrypt_buffer_t* client_key_nonce,
+    const vccrypt_buffer_t* server_key_nonce);
+
 /**
  * \brief Send a get latest block id request to the API.
  *
@@ -180,6 +351,42 @@ status vcblockchain_protocol_sendreq_latest_block_id_get(
     RCPR_SYM(psock)* sock, vccrypt_suite_options_t* suite, uint64_t* client_iv,
     const vccrypt_buffer_t* shared_secret, uint32_t offset);
 
+/**
+ * \brief Send a get latest block id request to the API that only returns the
+ * block id if it differs from the one known to the client.
+ *
+ * \param sock                      The socket to which this request is written.
+ * \param suite                     The crypto suite to use for this handshake.
+ * \param client_iv                 Pointer to the client IV, updated by this
+ *                                  call.
+ * \param shared_secret             The shared secret key for this request.
+ * \param offset                    The offset to use for this request. It
+ *                                  should be unique per any outbound request
+ *                                  for which a response has not yet been
+ *                                  received.
+ * \param timeout_ms                The maximum time in milliseconds that the
+ *                                  server may hold this request open waiting
+ *                                  for a new block, or 0 to answer at once.
+ * \param block_id                  The latest block id known to the client.
+ *
+ * This function sends the conditional get latest block request to the server.
+ * If the latest block id differs from \p block_id, then the server responds at
+ * once with the new block id. Otherwise, the server waits up to \p timeout_ms
+ * for a new block, and responds with a header-only response with a status of
+ * \ref VCBLOCKCHAIN_ERROR_PROTOCOL_NOT_MODIFIED if none arrives.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_protocol_sendreq_latest_block_id_get_if_changed(
+    RCPR_SYM(psock)* sock, vccrypt_suite_options_t* suite, uint64_t* client_iv,
+    const vccrypt_buffer_t* shared_secret, uint32_t offset,
+    uint32_t timeout_ms, const vpr_uuid* block_id);
+
 /**
  * \brief Send a transaction submission request.
  *
@@ -213,7 +420,7 @@ status vcblockchain_protocol_sendreq_transaction_submit(
     size_t cert_size);
 
 /**
- * \brief Send a block get request.
+ * \brief Send a transaction submit batch request.
  *
  * \param sock                      The socket to which this request is written.
  * \param suite                     The crypto suite to use for this handshake.
@@ -224,25 +431,30 @@ status vcblockchain_protocol_sendreq_transaction_submit(
  *                                  should be unique per any outbound request
  *                                  for which a response has not yet been
  *                                  received.
- * \param block_id                  The block UUID to get, or zero_uuid for the
- *                                  first block, or 0xff uuid for last block.
+ * \param txns                      Array of transactions to submit.
+ * \param count                     The number of transactions to submit.
  *
- * This function sends a block get request to the server.
+ * This function submits several transactions in a single packet. The
+ * certificates are encrypted directly from \p txns into the packet, without
+ * first being copied into an encoded request. The server answers with a single
+ * response holding the submit status of each transaction, which can be read
+ * using \ref vcblockchain_protocol_recvresp_transaction_submit_batch.
  *
  * \returns a status code indicating success or failure.
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the batch is empty or too large.
  *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
  *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
  *        out-of-memory error.
  *      - a non-zero error response if something else has failed.
  */
-status vcblockchain_protocol_sendreq_block_get(
+status vcblockchain_protocol_sendreq_transaction_submit_batch(
     RCPR_SYM(psock)* sock, vccrypt_suite_options_t* suite, uint64_t* client_iv,
     const vccrypt_buffer_t* shared_secret, uint32_t offset,
-    const vpr_uuid* block_id);
+    const protocol_transaction_submit_batch_item* txns, size_t count);
 
 /**
- * \brief Send a block get next id request.
+ * \brief Send a transaction submission request that waits for canonization.
  *
  * \param sock                      The socket to which this request is written.
  * \param suite                     The crypto suite to use for this handshake.
@@ -253,10 +465,21 @@ status vcblockchain_protocol_sendreq_block_get(
  *                                  should be unique per any outbound request
  *                                  for which a response has not yet been
  *                                  received.
- * \param block_id                  The block UUID to get, or zero_uuid for the
- *                                  first block, or 0xff uuid for last block.
+ * \param timeout_ms                The maximum time in milliseconds to wait for
+ *                                  this transaction to be canonized, or 0 to
+ *                                  use the agent's default deadline.
+ * \param txn_id                    The transaction id for this request.
+ * \param artifact_id               The artifact id for this request.
+ * \param cert                      Pointer to the certificate for this request.
+ * \param cert_size                 The size of this certificate.
  *
- * This function sends a block get request to the server.
+ * This function sends a transaction submission request to the server. The
+ * server responds to this request once the transaction has been accepted, and
+ * then sends a transaction canonized notification with the offset of this
+ * request once the transaction is in a block. This notification can be read
+ * with \ref vcblockchain_protocol_recvresp_transaction_canonized. If the
+ * deadline expires first, then the server instead sends an error response
+ * with \ref VCBLOCKCHAIN_ERROR_PROTOCOL_CANONIZATION_EXPIRED.
  *
  * \returns a status code indicating success or failure.
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
@@ -265,13 +488,14 @@ status vcblockchain_protocol_sendreq_block_get(
  *        out-of-memory error.
  *      - a non-zero error response if something else has failed.
  */
-status vcblockchain_protocol_sendreq_block_next_id_get(
+status vcblockchain_protocol_sendreq_transaction_submit_await(
     RCPR_SYM(psock)* sock, vccrypt_suite_options_t* suite, uint64_t* client_iv,
     const vccrypt_buffer_t* shared_secret, uint32_t offset,
-    const vpr_uuid* block_id);
+    uint32_t timeout_ms, const vpr_uuid* txn_id, const vpr_uuid* artifact_id,
+    const void* cert, size_t cert_size);
 
 /**
- * \brief Send a block get prev id request.
+ * \brief Send a block get request.
  *
  * \param sock                      The socket to which this request is written.
  * \param suite                     The crypto suite to use for this handshake.
@@ -285,7 +509,7 @@ status vcblockchain_protocol_sendreq_block_next_id_get(
  * \param block_id                  The block UUID to get, or zero_uuid for the
  *                                  first block, or 0xff uuid for last block.
  *
- * This function sends a block get prev id request to the server.
+ * This function sends a block get request to the server.
  *
  * \returns a status code indicating success or failure.
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
@@ -294,13 +518,13 @@ status vcblockchain_protocol_sendreq_block_next_id_get(
  *        out-of-memory error.
  *      - a non-zero error response if something else has failed.
  */
-status vcblockchain_protocol_sendreq_block_prev_id_get(
+status vcblockchain_protocol_sendreq_block_get(
     RCPR_SYM(psock)* sock, vccrypt_suite_options_t* suite, uint64_t* client_iv,
     const vccrypt_buffer_t* shared_secret, uint32_t offset,
     const vpr_uuid* block_id);
 
 /**
- * \brief Send a block id by height get request.
+ * \brief Send a block get fields request.
  *
  * \param sock                      The socket to which this request is written.
  * \param suite                     The crypto suite to use for this handshake.
@@ -311,10 +535,15 @@ status vcblockchain_protocol_sendreq_block_prev_id_get(
  *                                  should be unique per any outbound request
  *                                  for which a response has not yet been
  *                                  received.
- * \param height                    The block height for which to query the
- *                                  block id.
+ * \param block_id                  The block UUID to get.
+ * \param field_mask                The \ref protocol_block_field values to
+ *                                  return.
  *
- * This function sends a block get request to the server.
+ * This function sends a block get request to the server that only returns
+ * the fields in \p field_mask. Walking the block chain only requires
+ * \ref PROTOCOL_BLOCK_FIELD_NEXT_BLOCK_ID or
+ * \ref PROTOCOL_BLOCK_FIELD_PREV_BLOCK_ID, and avoids transferring the
+ * certificate.
  *
  * \returns a status code indicating success or failure.
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
@@ -323,12 +552,13 @@ status vcblockchain_protocol_sendreq_block_prev_id_get(
  *        out-of-memory error.
  *      - a non-zero error response if something else has failed.
  */
-status vcblockchain_protocol_sendreq_block_id_by_height_get(
+status vcblockchain_protocol_sendreq_block_get_fields(
     RCPR_SYM(psock)* sock, vccrypt_suite_options_t* suite, uint64_t* client_iv,
-    const vccrypt_buffer_t* shared_secret, uint32_t offset, uint64_t height);
+    const vccrypt_buffer_t* shared_secret, uint32_t offset,
+    const vpr_uuid* block_id, uint32_t field_mask);
 
 /**
- * \brief Send an artifact get first transaction id request.
+ * \brief Send a block range get request.
  *
  * \param sock                      The socket to which this request is written.
  * \param suite                     The crypto suite to use for this handshake.
@@ -339,24 +569,34 @@ status vcblockchain_protocol_sendreq_block_id_by_height_get(
  *                                  should be unique per any outbound request
  *                                  for which a response has not yet been
  *                                  received.
- * \param artifact_id               The artifact UUID to get.
- *
- * This function sends an artifact get first transaction request to the server.
+ * \param start_height              The height of the first block to get.
+ * \param count                     The maximum number of blocks to get.
+ * \param max_bytes                 The maximum number of bytes of block data
+ *                                  to return, or 0 to leave this up to the
+ *                                  server.
+ *
+ * This function requests up to \p count consecutive blocks starting at
+ * \p start_height in a single round trip. The server returns these blocks
+ * over one or more responses, which can be read using
+ * \ref vcblockchain_protocol_recvresp_block_range_get. If the range is
+ * truncated by \p max_bytes, the last response holds the height from which to
+ * resume.
  *
  * \returns a status code indicating success or failure.
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if \p count is zero.
  *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
  *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
  *        out-of-memory error.
  *      - a non-zero error response if something else has failed.
  */
-status vcblockchain_protocol_sendreq_artifact_first_txn_id_get(
+status vcblockchain_protocol_sendreq_block_range_get(
     RCPR_SYM(psock)* sock, vccrypt_suite_options_t* suite, uint64_t* client_iv,
     const vccrypt_buffer_t* shared_secret, uint32_t offset,
-    const vpr_uuid* artifact_id);
+    uint64_t start_height, uint32_t count, uint32_t max_bytes);
 
 /**
- * \brief Send an artifact get last transaction id request.
+ * \brief Send a block transaction ids get request.
  *
  * \param sock                      The socket to which this request is written.
  * \param suite                     The crypto suite to use for this handshake.
@@ -367,9 +607,14 @@ status vcblockchain_protocol_sendreq_artifact_first_txn_id_get(
  *                                  should be unique per any outbound request
  *                                  for which a response has not yet been
  *                                  received.
- * \param artifact_id               The artifact UUID to get.
+ * \param block_id                  The block id.
+ * \param include_states            Set to true to also get the state of each
+ *                                  transaction.
  *
- * This function sends an artifact get last transaction request to the server.
+ * This function requests the ordered list of transaction ids for the given
+ * block, which is much smaller than the block certificate when only the ids
+ * are needed. The response can be read using
+ * \ref vcblockchain_protocol_recvresp_block_txn_ids_get.
  *
  * \returns a status code indicating success or failure.
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
@@ -378,13 +623,13 @@ status vcblockchain_protocol_sendreq_artifact_first_txn_id_get(
  *        out-of-memory error.
  *      - a non-zero error response if something else has failed.
  */
-status vcblockchain_protocol_sendreq_artifact_last_txn_id_get(
+status vcblockchain_protocol_sendreq_block_txn_ids_get(
     RCPR_SYM(psock)* sock, vccrypt_suite_options_t* suite, uint64_t* client_iv,
     const vccrypt_buffer_t* shared_secret, uint32_t offset,
-    const vpr_uuid* artifact_id);
+    const vpr_uuid* block_id, bool include_states);
 
 /**
- * \brief Send a txn get request.
+ * \brief Send a block get next id request.
  *
  * \param sock                      The socket to which this request is written.
  * \param suite                     The crypto suite to use for this handshake.
@@ -395,9 +640,10 @@ status vcblockchain_protocol_sendreq_artifact_last_txn_id_get(
  *                                  should be unique per any outbound request
  *                                  for which a response has not yet been
  *                                  received.
- * \param txn_id                    The transaction UUID to get.
+ * \param block_id                  The block UUID to get, or zero_uuid for the
+ *                                  first block, or 0xff uuid for last block.
  *
- * This function sends a transaction get request to the server.
+ * This function sends a block get request to the server.
  *
  * \returns a status code indicating success or failure.
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
@@ -406,13 +652,13 @@ status vcblockchain_protocol_sendreq_artifact_last_txn_id_get(
  *        out-of-memory error.
  *      - a non-zero error response if something else has failed.
  */
-status vcblockchain_protocol_sendreq_txn_get(
+status vcblockchain_protocol_sendreq_block_next_id_get(
     RCPR_SYM(psock)* sock, vccrypt_suite_options_t* suite, uint64_t* client_iv,
     const vccrypt_buffer_t* shared_secret, uint32_t offset,
-    const vpr_uuid* txn_id);
+    const vpr_uuid* block_id);
 
 /**
- * \brief Send a transaction get next id request.
+ * \brief Send a block get prev id request.
  *
  * \param sock                      The socket to which this request is written.
  * \param suite                     The crypto suite to use for this handshake.
@@ -423,9 +669,10 @@ status vcblockchain_protocol_sendreq_txn_get(
  *                                  should be unique per any outbound request
  *                                  for which a response has not yet been
  *                                  received.
- * \param txn_id                    The txn UUID to query.
+ * \param block_id                  The block UUID to get, or zero_uuid for the
+ *                                  first block, or 0xff uuid for last block.
  *
- * This function sends a transaction get request to the server.
+ * This function sends a block get prev id request to the server.
  *
  * \returns a status code indicating success or failure.
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
@@ -434,13 +681,13 @@ status vcblockchain_protocol_sendreq_txn_get(
  *        out-of-memory error.
  *      - a non-zero error response if something else has failed.
  */
-status vcblockchain_protocol_sendreq_txn_next_id_get(
+status vcblockchain_protocol_sendreq_block_prev_id_get(
     RCPR_SYM(psock)* sock, vccrypt_suite_options_t* suite, uint64_t* client_iv,
     const vccrypt_buffer_t* shared_secret, uint32_t offset,
-    const vpr_uuid* txn_id);
+    const vpr_uuid* block_id);
 
 /**
- * \brief Send a transaction get prev id request.
+ * \brief Send a block id by height get request.
  *
  * \param sock                      The socket to which this request is written.
  * \param suite                     The crypto suite to use for this handshake.
@@ -451,9 +698,10 @@ status vcblockchain_protocol_sendreq_txn_next_id_get(
  *                                  should be unique per any outbound request
  *                                  for which a response has not yet been
  *                                  received.
- * \param txn_id                    The txn UUID to query.
+ * \param height                    The block height for which to query the
+ *                                  block id.
  *
- * This function sends a transaction get request to the server.
+ * This function sends a block get request to the server.
  *
  * \returns a status code indicating success or failure.
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
@@ -462,13 +710,12 @@ status vcblockchain_protocol_sendreq_txn_next_id_get(
  *        out-of-memory error.
  *      - a non-zero error response if something else has failed.
  */
-status vcblockchain_protocol_sendreq_txn_prev_id_get(
+status vcblockchain_protocol_sendreq_block_id_by_height_get(
     RCPR_SYM(psock)* sock, vccrypt_suite_options_t* suite, uint64_t* client_iv,
-    const vccrypt_buffer_t* shared_secret, uint32_t offset,
-    const vpr_uuid* txn_id);
+    const vccrypt_buffer_t* shared_secret, uint32_t offset, uint64_t height);
 
 /**
- * \brief Send a transaction get block id request.
+ * \brief Send an artifact get first transaction id request.
  *
  * \param sock                      The socket to which this request is written.
  * \param suite                     The crypto suite to use for this handshake.
@@ -479,9 +726,9 @@ status vcblockchain_protocol_sendreq_txn_prev_id_get(
  *                                  should be unique per any outbound request
  *                                  for which a response has not yet been
  *                                  received.
- * \param txn_id                    The txn UUID to query.
+ * \param artifact_id               The artifact UUID to get.
  *
- * This function sends a transaction get block id request to the server.
+ * This function sends an artifact get first transaction request to the server.
  *
  * \returns a status code indicating success or failure.
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
@@ -490,13 +737,13 @@ status vcblockchain_protocol_sendreq_txn_prev_id_get(
  *        out-of-memory error.
  *      - a non-zero error response if something else has failed.
  */
-status vcblockchain_protocol_sendreq_txn_block_id_get(
+status vcblockchain_protocol_sendreq_artifact_first_txn_id_get(
     RCPR_SYM(psock)* sock, vccrypt_suite_options_t* suite, uint64_t* client_iv,
     const vccrypt_buffer_t* shared_secret, uint32_t offset,
-    const vpr_uuid* txn_id);
+    const vpr_uuid* artifact_id);
 
 /**
- * \brief Send a status get request.
+ * \brief Send an artifact get last transaction id request.
  *
  * \param sock                      The socket to which this request is written.
  * \param suite                     The crypto suite to use for this handshake.
@@ -507,8 +754,9 @@ status vcblockchain_protocol_sendreq_txn_block_id_get(
  *                                  should be unique per any outbound request
  *                                  for which a response has not yet been
  *                                  received.
+ * \param artifact_id               The artifact UUID to get.
  *
- * This function sends a status get request to the server.
+ * This function sends an artifact get last transaction request to the server.
  *
  * \returns a status code indicating success or failure.
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
@@ -517,12 +765,14 @@ status vcblockchain_protocol_sendreq_txn_block_id_get(
  *        out-of-memory error.
  *      - a non-zero error response if something else has failed.
  */
-status vcblockchain_protocol_sendreq_status_get(
+status vcblockchain_protocol_sendreq_artifact_last_txn_id_get(
     RCPR_SYM(psock)* sock, vccrypt_suite_options_t* suite, uint64_t* client_iv,
-    const vccrypt_buffer_t* shared_secret, uint32_t offset);
+    const vccrypt_buffer_t* shared_secret, uint32_t offset,
+    const vpr_uuid* artifact_id);
 
 /**
- * \brief Send a connection close request.
+ * \brief Send an artifact get last transaction id request to the API that only
+ * returns the transaction id if it differs from the one known to the client.
  *
  * \param sock                      The socket to which this request is written.
  * \param suite                     The crypto suite to use for this handshake.
@@ -533,8 +783,20 @@ status vcblockchain_protocol_sendreq_status_get(
  *                                  should be unique per any outbound request
  *                                  for which a response has not yet been
  *                                  received.
+ * \param timeout_ms                The maximum time in milliseconds that the
+ *                                  server may hold this request open waiting
+ *                                  for a new transaction, or 0 to answer at
+ *                                  once.
+ * \param artifact_id               The artifact UUID to get.
+ * \param last_txn_id               The last transaction id for this artifact
+ *                                  known to the client.
  *
- * This function sends a connection close request to the server.
+ * This function sends the conditional artifact get last transaction request to
+ * the server. If the last transaction id for this artifact differs from \p
+ * last_txn_id, then the server responds at once with the new transaction id.
+ * Otherwise, the server waits up to \p timeout_ms for a new transaction, and
+ * responds with a header-only response with a status of \ref
+ * VCBLOCKCHAIN_ERROR_PROTOCOL_NOT_MODIFIED if none arrives.
  *
  * \returns a status code indicating success or failure.
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
@@ -543,12 +805,14 @@ status vcblockchain_protocol_sendreq_status_get(
  *        out-of-memory error.
  *      - a non-zero error response if something else has failed.
  */
-status vcblockchain_protocol_sendreq_connection_close(
+status vcblockchain_protocol_sendreq_artifact_last_txn_id_get_if_changed(
     RCPR_SYM(psock)* sock, vccrypt_suite_options_t* suite, uint64_t* client_iv,
-    const vccrypt_buffer_t* shared_secret, uint32_t offset);
+    const vccrypt_buffer_t* shared_secret, uint32_t offset,
+    uint32_t timeout_ms, const vpr_uuid* artifact_id,
+    const vpr_uuid* last_txn_id);
 
 /**
- * \brief Send a latest block id assertion request.
+ * \brief Send an artifact transaction page get request.
  *
  * \param sock                      The socket to which this request is written.
  * \param suite                     The crypto suite to use for this handshake.
@@ -559,24 +823,39 @@ status vcblockchain_protocol_sendreq_connection_close(
  *                                  should be unique per any outbound request
  *                                  for which a response has not yet been
  *                                  received.
- * \param latest_block_id           The latest block id for this request.
- *
- * This function sends a connection close request to the server.
+ * \param artifact_id               The artifact id.
+ * \param cursor_txn_id             The page starts after this transaction. If
+ *                                  this is the zero uuid, then the page starts
+ *                                  at the first transaction in \p direction.
+ * \param direction                 The \ref protocol_txn_page_direction for
+ *                                  this page.
+ * \param page_size                 The maximum number of transactions to
+ *                                  return.
+ * \param include_certs             Set to true to return the transaction
+ *                                  certificates.
+ *
+ * This function requests a page of up to \p page_size transactions for an
+ * artifact in a single round trip. The response holds a cursor which can be
+ * passed as \p cursor_txn_id to request the following page, and has the
+ * \ref PROTOCOL_TXN_PAGE_FLAG_MORE flag set if more transactions remain.
  *
  * \returns a status code indicating success or failure.
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if \p direction is unknown or
+ *        \p page_size is zero.
  *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
  *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
  *        out-of-memory error.
  *      - a non-zero error response if something else has failed.
  */
-status vcblockchain_protocol_sendreq_assert_latest_block_id(
+status vcblockchain_protocol_sendreq_artifact_txn_page_get(
     RCPR_SYM(psock)* sock, vccrypt_suite_options_t* suite, uint64_t* client_iv,
     const vccrypt_buffer_t* shared_secret, uint32_t offset,
-    const vpr_uuid* latest_block_id);
+    const vpr_uuid* artifact_id, const vpr_uuid* cursor_txn_id,
+    uint32_t direction, uint32_t page_size, bool include_certs);
 
 /**
- * \brief Send a latest block assertion cancellation request.
+ * \brief Send an artifact latest transaction get request.
  *
  * \param sock                      The socket to which this request is written.
  * \param suite                     The crypto suite to use for this handshake.
@@ -587,8 +866,12 @@ status vcblockchain_protocol_sendreq_assert_latest_block_id(
  *                                  should be unique per any outbound request
  *                                  for which a response has not yet been
  *                                  received.
+ * \param artifact_id               The artifact UUID to get.
  *
- * This function sends a connection close request to the server.
+ * This function requests the latest transaction for the given artifact,
+ * returning the same data as a transaction get request in a single round trip.
+ * The response can be read using
+ * \ref vcblockchain_protocol_recvresp_artifact_latest_txn_get.
  *
  * \returns a status code indicating success or failure.
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
@@ -597,45 +880,563 @@ status vcblockchain_protocol_sendreq_assert_latest_block_id(
  *        out-of-memory error.
  *      - a non-zero error response if something else has failed.
  */
-status vcblockchain_protocol_sendreq_assert_latest_block_id_cancel(
+status vcblockchain_protocol_sendreq_artifact_latest_txn_get(
     RCPR_SYM(psock)* sock, vccrypt_suite_options_t* suite, uint64_t* client_iv,
-    const vccrypt_buffer_t* shared_secret, uint32_t offset);
+    const vccrypt_buffer_t* shared_secret, uint32_t offset,
+    const vpr_uuid* artifact_id);
 
 /**
- * \brief Send an extended API enable request.
- *
- * This request enables the connected entity to field extended API requests to
- * it through the blockchain agent. The blockchain agent will authenticate and
- * authorize other entities wishing to send requests to this entity, but from
- * there, will only forward requests to this entity. It is up to this entity to
- * perform any additional parameter checks on any requests it receives.
+ * \brief Send a txn get request.
  *
  * \param sock                      The socket to which this request is written.
- * \param suite                     The crypto suite to use for this request.
+ * \param suite                     The crypto suite to use for this handshake.
  * \param client_iv                 Pointer to the client IV, updated by this
  *                                  call.
- * \param shared_secret             The shared secret to use for this request.
+ * \param shared_secret             The shared secret key for this request.
  * \param offset                    The offset to use for this request. It
  *                                  should be unique per any outbound request
  *                                  for which a response has not yet been
  *                                  received.
+ * \param txn_id                    The transaction UUID to get.
+ *
+ * This function sends a transaction get request to the server.
  *
  * \returns a status code indicating success or failure.
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
- *      - a non-zero error code on failure.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
  */
-status vcblockchain_protocol_sendreq_extended_api_enable(
+status vcblockchain_protocol_sendreq_txn_get(
     RCPR_SYM(psock)* sock, vccrypt_suite_options_t* suite, uint64_t* client_iv,
-    const vccrypt_buffer_t* shared_secret, uint32_t offset);
+    const vccrypt_buffer_t* shared_secret, uint32_t offset,
+    const vpr_uuid* txn_id);
 
 /**
- * \brief Send an extended API request.
+ * \brief Send a txn get fields request.
  *
  * \param sock                      The socket to which this request is written.
- * \param suite                     The crypto suite to use for this request.
+ * \param suite                     The crypto suite to use for this handshake.
  * \param client_iv                 Pointer to the client IV, updated by this
  *                                  call.
- * \param shared_secret             The shared secret to use for this request.
+ * \param shared_secret             The shared secret key for this request.
+ * \param offset                    The offset to use for this request. It
+ *                                  should be unique per any outbound request
+ *                                  for which a response has not yet been
+ *                                  received.
+ * \param txn_id                    The transaction UUID to get.
+ * \param field_mask                The \ref protocol_txn_field values to
+ *                                  return.
+ *
+ * This function sends a transaction get request to the server that only
+ * returns the fields in \p field_mask. Walking the transaction chain only
+ * requires \ref PROTOCOL_TXN_FIELD_NEXT_TXN_ID or
+ * \ref PROTOCOL_TXN_FIELD_PREV_TXN_ID, and avoids transferring the
+ * certificate.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_protocol_sendreq_txn_get_fields(
+    RCPR_SYM(psock)* sock, vccrypt_suite_options_t* suite, uint64_t* client_iv,
+    const vccrypt_buffer_t* shared_secret, uint32_t offset,
+    const vpr_uuid* txn_id, uint32_t field_mask);
+
+/**
+ * \brief Send a transaction get next id request.
+ *
+ * \param sock                      The socket to which this request is written.
+ * \param suite                     The crypto suite to use for this handshake.
+ * \param client_iv                 Pointer to the client IV, updated by this
+ *                                  call.
+ * \param shared_secret             The shared secret key for this request.
+ * \param offset                    The offset to use for this request. It
+ *                                  should be unique per any outbound request
+ *                                  for which a response has not yet been
+ *                                  received.
+ * \param txn_id                    The txn UUID to query.
+ *
+ * This function sends a transaction get request to the server.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_protocol_sendreq_txn_next_id_get(
+    RCPR_SYM(psock)* sock, vccrypt_suite_options_t* suite, uint64_t* client_iv,
+    const vccrypt_buffer_t* shared_secret, uint32_t offset,
+    const vpr_uuid* txn_id);
+
+/**
+ * \brief Send a transaction get prev id request.
+ *
+ * \param sock                      The socket to which this request is written.
+ * \param suite                     The crypto suite to use for this handshake.
+ * \param client_iv                 Pointer to the client IV, updated by this
+ *                                  call.
+ * \param shared_secret             The shared secret key for this request.
+ * \param offset                    The offset to use for this request. It
+ *                                  should be unique per any outbound request
+ *                                  for which a response has not yet been
+ *                                  received.
+ * \param txn_id                    The txn UUID to query.
+ *
+ * This function sends a transaction get request to the server.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_protocol_sendreq_txn_prev_id_get(
+    RCPR_SYM(psock)* sock, vccrypt_suite_options_t* suite, uint64_t* client_iv,
+    const vccrypt_buffer_t* shared_secret, uint32_t offset,
+    const vpr_uuid* txn_id);
+
+/**
+ * \brief Send a transaction get block id request.
+ *
+ * \param sock                      The socket to which this request is written.
+ * \param suite                     The crypto suite to use for this handshake.
+ * \param client_iv                 Pointer to the client IV, updated by this
+ *                                  call.
+ * \param shared_secret             The shared secret key for this request.
+ * \param offset                    The offset to use for this request. It
+ *                                  should be unique per any outbound request
+ *                                  for which a response has not yet been
+ *                                  received.
+ * \param txn_id                    The txn UUID to query.
+ *
+ * This function sends a transaction get block id request to the server.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_protocol_sendreq_txn_block_id_get(
+    RCPR_SYM(psock)* sock, vccrypt_suite_options_t* suite, uint64_t* client_iv,
+    const vccrypt_buffer_t* shared_secret, uint32_t offset,
+    const vpr_uuid* txn_id);
+
+/**
+ * \brief Send a status get request.
+ *
+ * \param sock                      The socket to which this request is written.
+ * \param suite                     The crypto suite to use for this handshake.
+ * \param client_iv                 Pointer to the client IV, updated by this
+ *                                  call.
+ * \param shared_secret             The shared secret key for this request.
+ * \param offset                    The offset to use for this request. It
+ *                                  should be unique per any outbound request
+ *                                  for which a response has not yet been
+ *                                  received.
+ *
+ * This function sends a status get request to the server.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_protocol_sendreq_status_get(
+    RCPR_SYM(psock)* sock, vccrypt_suite_options_t* suite, uint64_t* client_iv,
+    const vccrypt_buffer_t* shared_secret, uint32_t offset);
+
+/**
+ * \brief Send a resumption ticket get request.
+ *
+ * \param sock                      The socket to which this request is written.
+ * \param suite                     The crypto suite to use for this handshake.
+ * \param client_iv                 Pointer to the client IV, updated by this
+ *                                  call.
+ * \param shared_secret             The shared secret key for this request.
+ * \param offset                    The offset to use for this request. It
+ *                                  should be unique per any outbound request
+ *                                  for which a response has not yet been
+ *                                  received.
+ *
+ * This function sends a resumption ticket get request to the server.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_protocol_sendreq_resumption_ticket_get(
+    RCPR_SYM(psock)* sock, vccrypt_suite_options_t* suite, uint64_t* client_iv,
+    const vccrypt_buffer_t* shared_secret, uint32_t offset);
+
+/**
+ * \brief Send a rekey request to the API.
+ *
+ * \param sock                      The socket to which this request is written.
+ * \param suite                     The crypto suite to use for this request.
+ * \param client_iv                 Pointer to the client IV, updated by this
+ *                                  call.
+ * \param shared_secret             The shared secret key for this request.
+ * \param offset                    The offset to use for this request. It
+ *                                  should be unique per any outbound request
+ *                                  for which a response has not yet been
+ *                                  received.
+ * \param key_nonce                 Buffer to receive the client key nonce for
+ *                                  this request. This buffer must not have
+ *                                  been previously initialized. On success,
+ *                                  this is initialized and owned by the
+ *                                  caller; it must be disposed by the caller
+ *                                  when no longer needed.
+ *
+ * This function generates a fresh key nonce, and asks the server to switch to
+ * a new shared secret, derived by \ref
+ * vcblockchain_protocol_rekeyed_shared_secret_create, starting with the client
+ * packet that follows this request. On success, \p client_iv is that boundary.
+ * The caller must not send another packet until it has received the rekey
+ * response, since the new secret depends on the server key nonce. Responses to
+ * requests sent before this one keep arriving in the meantime.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_protocol_sendreq_rekey(
+    RCPR_SYM(psock)* sock, vccrypt_suite_options_t* suite, uint64_t* client_iv,
+    const vccrypt_buffer_t* shared_secret, uint32_t offset,
+    vccrypt_buffer_t* key_nonce);
+
+/**
+ * \brief Derive the next shared secret for a session being rekeyed.
+ *
+ * \param shared_secret             The buffer to receive the shared secret.
+ *                                  Must not have been previously initialized.
+ *                                  On success, it is initialized and owned by
+ *                                  the caller, and must be disposed when no
+ *                                  longer needed.
+ * \param suite                     The crypto suite to use for this operation.
+ * \param current_secret            The shared secret currently in use.
+ * \param client_key_nonce          The client key nonce for this rekey.
+ * \param server_key_nonce          The server key nonce for this rekey.
+ *
+ * The new shared secret is the short MAC of a fixed label, the client key
+ * nonce, and the server key nonce, keyed by the current shared secret. The
+ * label keeps it distinct from the other secrets derived from the current
+ * shared secret, such as a resumption secret. Since the MAC is one-way, a
+ * later secret does not reveal the secrets before it.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered.
+ *      - a non-zero error code on failure.
+ */
+status vcblockchain_protocol_rekeyed_shared_secret_create(
+    vccrypt_buffer_t* shared_secret, vccrypt_suite_options_t* suite,
+    const vccrypt_buffer_t* current_secret,
+    const vccrypt_buffer_t* client_key_nonce,
+    const vccrypt_buffer_t* server_key_nonce);
+
+/**
+ * \brief Send a connection close request.
+ *
+ * \param sock                      The socket to which this request is written.
+ * \param suite                     The crypto suite to use for this handshake.
+ * \param client_iv                 Pointer to the client IV, updated by this
+ *                                  call.
+ * \param shared_secret             The shared secret key for this request.
+ * \param offset                    The offset to use for this request. It
+ *                                  should be unique per any outbound request
+ *                                  for which a response has not yet been
+ *                                  received.
+ *
+ * This function sends a connection close request to the server.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_protocol_sendreq_connection_close(
+    RCPR_SYM(psock)* sock, vccrypt_suite_options_t* suite, uint64_t* client_iv,
+    const vccrypt_buffer_t* shared_secret, uint32_t offset);
+
+/**
+ * \brief Send a request cancellation request.
+ *
+ * \param sock                      The socket to which this request is written.
+ * \param suite                     The crypto suite to use for this handshake.
+ * \param client_iv                 Pointer to the client IV, updated by this
+ *                                  call.
+ * \param shared_secret             The shared secret key for this request.
+ * \param offset                    The offset to use for this request. It
+ *                                  should be unique per any outbound request
+ *                                  for which a response has not yet been
+ *                                  received.
+ * \param target_offset             The offset of the request to cancel.
+ *
+ * This function asks the server to abandon the request in flight at
+ * \p target_offset. That request is answered with
+ * \ref VCBLOCKCHAIN_ERROR_PROTOCOL_REQUEST_CANCELLED instead of its normal
+ * response, unless it completed first. Either way, the response to this
+ * request arrives after the final response for \p target_offset.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_protocol_sendreq_request_cancel(
+    RCPR_SYM(psock)* sock, vccrypt_suite_options_t* suite, uint64_t* client_iv,
+    const vccrypt_buffer_t* shared_secret, uint32_t offset,
+    uint32_t target_offset);
+
+/**
+ * \brief Send a latest block id assertion request.
+ *
+ * \param sock                      The socket to which this request is written.
+ * \param suite                     The crypto suite to use for this handshake.
+ * \param client_iv                 Pointer to the client IV, updated by this
+ *                                  call.
+ * \param shared_secret             The shared secret key for this request.
+ * \param offset                    The offset to use for this request. It
+ *                                  should be unique per any outbound request
+ *                                  for which a response has not yet been
+ *                                  received.
+ * \param latest_block_id           The latest block id for this request.
+ *
+ * This function sends a connection close request to the server.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_protocol_sendreq_assert_latest_block_id(
+    RCPR_SYM(psock)* sock, vccrypt_suite_options_t* suite, uint64_t* client_iv,
+    const vccrypt_buffer_t* shared_secret, uint32_t offset,
+    const vpr_uuid* latest_block_id);
+
+/**
+ * \brief Send a latest block assertion cancellation request.
+ *
+ * \param sock                      The socket to which this request is written.
+ * \param suite                     The crypto suite to use for this handshake.
+ * \param client_iv                 Pointer to the client IV, updated by this
+ *                                  call.
+ * \param shared_secret             The shared secret key for this request.
+ * \param offset                    The offset to use for this request. It
+ *                                  should be unique per any outbound request
+ *                                  for which a response has not yet been
+ *                                  received.
+ *
+ * This function cancels a pending latest block id assertion or block
+ * subscription.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_protocol_sendreq_assert_latest_block_id_cancel(
+    RCPR_SYM(psock)* sock, vccrypt_suite_options_t* suite, uint64_t* client_iv,
+    const vccrypt_buffer_t* shared_secret, uint32_t offset);
+
+/**
+ * \brief Send a block subscription request.
+ *
+ * \param sock                      The socket to which this request is written.
+ * \param suite                     The crypto suite to use for this handshake.
+ * \param client_iv                 Pointer to the client IV, updated by this
+ *                                  call.
+ * \param shared_secret             The shared secret key for this request.
+ * \param offset                    The offset to use for this request. It
+ *                                  should be unique per any outbound request
+ *                                  for which a response has not yet been
+ *                                  received.
+ * \param latest_block_id           The latest block id known to the client.
+ *                                  Notifications are sent for every block
+ *                                  after this one.
+ * \param include_cert              Set to true if notifications should include
+ *                                  the block certificate.
+ *
+ * This function subscribes to new blocks. The server responds to this request
+ * once, and then sends a block notification with the offset of this request
+ * for each new block, until the subscription is cancelled with \ref
+ * vcblockchain_protocol_sendreq_assert_latest_block_id_cancel.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_protocol_sendreq_block_subscribe(
+    RCPR_SYM(psock)* sock, vccrypt_suite_options_t* suite, uint64_t* client_iv,
+    const vccrypt_buffer_t* shared_secret, uint32_t offset,
+    const vpr_uuid* latest_block_id, bool include_cert);
+
+/**
+ * \brief Send an artifact subscription request.
+ *
+ * \param sock                      The socket to which this request is written.
+ * \param suite                     The crypto suite to use for this handshake.
+ * \param client_iv                 Pointer to the client IV, updated by this
+ *                                  call.
+ * \param shared_secret             The shared secret key for this request.
+ * \param offset                    The offset to use for this request. It
+ *                                  should be unique per any outbound request
+ *                                  for which a response has not yet been
+ *                                  received.
+ * \param artifact_ids              The artifact ids to watch.
+ * \param count                     The number of artifact ids.
+ *
+ * This function adds artifacts to the set of artifacts watched on this
+ * connection. The server responds to this request once, and then sends an
+ * artifact notification with the offset of this request each time a
+ * transaction for one of these artifacts is canonized, until the artifact is
+ * removed with \ref vcblockchain_protocol_sendreq_artifact_unsubscribe.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_protocol_sendreq_artifact_subscribe(
+    RCPR_SYM(psock)* sock, vccrypt_suite_options_t* suite, uint64_t* client_iv,
+    const vccrypt_buffer_t* shared_secret, uint32_t offset,
+    const vpr_uuid* artifact_ids, size_t count);
+
+/**
+ * \brief Send an artifact unsubscription request.
+ *
+ * \param sock                      The socket to which this request is written.
+ * \param suite                     The crypto suite to use for this handshake.
+ * \param client_iv                 Pointer to the client IV, updated by this
+ *                                  call.
+ * \param shared_secret             The shared secret key for this request.
+ * \param offset                    The offset to use for this request. It
+ *                                  should be unique per any outbound request
+ *                                  for which a response has not yet been
+ *                                  received.
+ * \param artifact_ids              The artifact ids to stop watching. This may
+ *                                  be NULL if \p count is zero.
+ * \param count                     The number of artifact ids. If zero, then
+ *                                  every watched artifact is removed.
+ *
+ * This function removes artifacts from the set of artifacts watched on this
+ * connection. No further notifications are sent for these artifacts once the
+ * server has responded to this request.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_protocol_sendreq_artifact_unsubscribe(
+    RCPR_SYM(psock)* sock, vccrypt_suite_options_t* suite, uint64_t* client_iv,
+    const vccrypt_buffer_t* shared_secret, uint32_t offset,
+    const vpr_uuid* artifact_ids, size_t count);
+
+/**
+ * \brief Send a batch request.
+ *
+ * \param sock                      The socket to which this request is written.
+ * \param suite                     The crypto suite to use for this handshake.
+ * \param client_iv                 Pointer to the client IV, updated by this
+ *                                  call.
+ * \param shared_secret             The shared secret key for this request.
+ * \param offset                    The offset to use for this request. It
+ *                                  should be unique per any outbound request
+ *                                  for which a response has not yet been
+ *                                  received.
+ * \param requests                  Array of encoded requests, each created by
+ *                                  the matching request encode function.
+ * \param count                     The number of requests in the batch.
+ *
+ * This function sends every request in \p requests to the server in a single
+ * authenticated packet. Each request keeps its own offset, and the server
+ * answers with a single batch response holding one status and one encoded
+ * response per request, in the same order.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the batch is empty, too large, or
+ *        holds a malformed or nested batch request.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_protocol_sendreq_batch(
+    RCPR_SYM(psock)* sock, vccrypt_suite_options_t* suite, uint64_t* client_iv,
+    const vccrypt_buffer_t* shared_secret, uint32_t offset,
+    const vccrypt_buffer_t* requests, size_t count);
+
+/**
+ * \brief Send an extended API enable request.
+ *
+ * This request enables the connected entity to field extended API requests to
+ * it through the blockchain agent. The blockchain agent will authenticate and
+ * authorize other entities wishing to send requests to this entity, but from
+ * there, will only forward requests to this entity. It is up to this entity to
+ * perform any additional parameter checks on any requests it receives.
+ *
+ * \param sock                      The socket to which this request is written.
+ * \param suite                     The crypto suite to use for this request.
+ * \param client_iv                 Pointer to the client IV, updated by this
+ *                                  call.
+ * \param shared_secret             The shared secret to use for this request.
+ * \param offset                    The offset to use for this request. It
+ *                                  should be unique per any outbound request
+ *                                  for which a response has not yet been
+ *                                  received.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status vcblockchain_protocol_sendreq_extended_api_enable(
+    RCPR_SYM(psock)* sock, vccrypt_suite_options_t* suite, uint64_t* client_iv,
+    const vccrypt_buffer_t* shared_secret, uint32_t offset);
+
+/**
+ * \brief Send an extended API request.
+ *
+ * \param sock                      The socket to which this request is written.
+ * \param suite                     The crypto suite to use for this request.
+ * \param client_iv                 Pointer to the client IV, updated by this
+ *                                  call.
+ * \param shared_secret             The shared secret to use for this request.
  * \param offset                    The offset to use for this request. It
  *                                  should be unique per any outbound request
  *                                  for which a response has not yet been
@@ -647,40 +1448,248 @@ status vcblockchain_protocol_sendreq_extended_api_enable(
  *
  * \returns a status code indicating success or failure.
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
- *      - a non-zero error code on failure.
+ *      - a non-zero error code on failure.
+ */
+status vcblockchain_protocol_sendreq_extended_api(
+    RCPR_SYM(psock)* sock, vccrypt_suite_options_t* suite, uint64_t* client_iv,
+    const vccrypt_buffer_t* shared_secret, uint32_t offset,
+    const vpr_uuid* entity_id, const vpr_uuid* verb_id,
+    const vccrypt_buffer_t* request_body);
+
+/**
+ * \brief Send a response to an extended API request.
+ *
+ * \param sock                      The socket to which this request is written.
+ * \param suite                     The crypto suite to use for this request.
+ * \param client_iv                 Pointer to the client IV, updated by this
+ *                                  call.
+ * \param shared_secret             The shared secret to use for this request.
+ * \param offset                    The offset provided by agentd for the
+ *                                  original extended request. Unlike regular
+ *                                  offsets, these are 64-bit and are only used
+ *                                  once.
+ * \param status                    The status to pass to the client.
+ * \param response_body             The body of the response to be sent.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status vcblockchain_protocol_sendreq_extended_api_response(
+    RCPR_SYM(psock)* sock, vccrypt_suite_options_t* suite, uint64_t* client_iv,
+    const vccrypt_buffer_t* shared_secret, uint64_t offset, uint32_t status,
+    const vccrypt_buffer_t* response_body);
+
+/**
+ * \brief Send a flow credit grant request.
+ *
+ * \param sock                      The socket to which this request is written.
+ * \param suite                     The crypto suite to use for this request.
+ * \param client_iv                 Pointer to the client IV, updated by this
+ *                                  call.
+ * \param shared_secret             The shared secret key for this request.
+ * \param offset                    The offset to use for this request. It
+ *                                  should be unique per any outbound request
+ *                                  for which a response has not yet been
+ *                                  received.
+ * \param request_credits           The number of requests granted. The client
+ *                                  does not limit the number of responses, so
+ *                                  this should be zero.
+ * \param byte_credits              The number of response bytes granted.
+ *
+ * The first grant sent on a connection negotiates flow control, and its
+ * response can be read using \ref
+ * vcblockchain_protocol_recvresp_flow_credit_grant. Later grants return
+ * credits as the client frees capacity, and are not answered.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_protocol_sendreq_flow_credit_grant(
+    RCPR_SYM(psock)* sock, vccrypt_suite_options_t* suite, uint64_t* client_iv,
+    const vccrypt_buffer_t* shared_secret, uint32_t offset,
+    uint32_t request_credits, uint64_t byte_credits);
+
+/**
+ * \brief Receive a response from the API.
+ *
+ * \param sock                      The socket from which this response is read.
+ * \param a                         The allocator to use for this operation.
+ * \param suite                     The crypto suite to use for this read.
+ * \param server_iv                 Pointer to the server_iv to use, updated as
+ *                                  a consequence of this call.
+ * \param shared_secret             The shared secret key for this request.
+ * \param response                  Pointer to an uninitialized buffer. On
+ *                                  success, this buffer is initialized with the
+ *                                  response and must be disposed by the caller
+ *                                  when no longer needed.
+ *
+ * \note - this function requires that the handshake request send / receive, and
+ * the handshake ack send have each been performed before it can be used.
+ *
+ * This call reads a response from the protocol. On success, the server_iv is
+ * incremented, and the response buffer is initialized with the response
+ * received, and must be disposed by the caller when no longer needed. This
+ * response is the raw bytes of the response as decrypted by this call. The
+ * caller can decode this response into a structure by calling \ref
+ * vcblockchain_protocol_response_decode.
+ *
+ * This copies the decrypted payload into \p response. Callers that decode the
+ * response immediately should prefer \ref vcblockchain_protocol_recvresp_raw
+ * or one of the typed receive functions, which avoid this copy.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_READ if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_protocol_recvresp(
+    RCPR_SYM(psock)* sock, RCPR_SYM(allocator)* a,
+    vccrypt_suite_options_t* suite, uint64_t* server_iv,
+    const vccrypt_buffer_t* shared_secret, vccrypt_buffer_t* response);
+
+/**
+ * \brief Receive a response from the API, adopting the decrypted payload.
+ *
+ * \param sock                      The socket from which this response is read.
+ * \param a                         The allocator to use for this operation.
+ * \param suite                     The crypto suite to use for this read.
+ * \param server_iv                 Pointer to the server_iv to use, updated as
+ *                                  a consequence of this call.
+ * \param shared_secret             The shared secret key for this request.
+ * \param payload                   Pointer to receive the decrypted payload on
+ *                                  success.
+ * \param payload_size              Pointer to receive the size of the payload
+ *                                  on success.
+ *
+ * \note - this function requires that the handshake request send / receive, and
+ * the handshake ack send have each been performed before it can be used.
+ *
+ * This call reads a response from the protocol. On success, the server_iv is
+ * incremented, and \p payload is set to the plaintext exactly as it was
+ * decrypted by the socket layer. Unlike \ref vcblockchain_protocol_recvresp,
+ * the payload is not copied into a crypto buffer. It is allocated by \p a, is
+ * owned by the caller, and must be released by calling
+ * \ref vcblockchain_protocol_recvresp_raw_release when no longer needed. The
+ * caller can decode it in place by passing it to the matching response decode
+ * function.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_READ if reading from the socket failed.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_protocol_recvresp_raw(
+    RCPR_SYM(psock)* sock, RCPR_SYM(allocator)* a,
+    vccrypt_suite_options_t* suite, uint64_t* server_iv,
+    const vccrypt_buffer_t* shared_secret, void** payload,
+    uint32_t* payload_size);
+
+/**
+ * \brief Release a payload received by \ref vcblockchain_protocol_recvresp_raw.
+ *
+ * \param a                         The allocator used to receive this payload.
+ * \param payload                   The payload to release.
+ * \param payload_size              The size of the payload.
+ *
+ * The payload is plaintext from an authenticated channel, so it is wiped before
+ * it is returned to the allocator.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - a non-zero error response if reclaiming the payload failed.
+ */
+status vcblockchain_protocol_recvresp_raw_release(
+    RCPR_SYM(allocator)* a, void* payload, uint32_t payload_size);
+
+/**
+ * \brief Receive a transaction get response from the API and decode it.
+ *
+ * \param sock                      The socket from which this response is read.
+ * \param a                         The allocator to use for this operation.
+ * \param suite                     The crypto suite to use for this read.
+ * \param server_iv                 Pointer to the server_iv to use, updated as
+ *                                  a consequence of this call.
+ * \param shared_secret             The shared secret key for this request.
+ * \param alloc_opts                The allocator to use for the decoded
+ *                                  response.
+ * \param resp                      The response structure to initialize.
+ *
+ * \note - this function requires that the handshake request send / receive, and
+ * the handshake ack send have each been performed before it can be used.
+ *
+ * This call reads the response to a request sent by \ref
+ * vcblockchain_protocol_sendreq_txn_get, decoding it directly from the
+ * decrypted payload. On success, the server_iv is incremented, and \p resp is
+ * initialized and owned by the caller, who must \ref dispose() it when it is no
+ * longer needed. The server_iv is also incremented if the server returned an
+ * error status, in which case \p resp is not initialized.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_READ if reading from the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the response was not a
+ *        transaction get response.
+ *      - the status returned by the server if the request failed.
+ *      - a non-zero error response if something else has failed.
  */
-status vcblockchain_protocol_sendreq_extended_api(
-    RCPR_SYM(psock)* sock, vccrypt_suite_options_t* suite, uint64_t* client_iv,
-    const vccrypt_buffer_t* shared_secret, uint32_t offset,
-    const vpr_uuid* entity_id, const vpr_uuid* verb_id,
-    const vccrypt_buffer_t* request_body);
+status vcblockchain_protocol_recvresp_txn_get(
+    RCPR_SYM(psock)* sock, RCPR_SYM(allocator)* a,
+    vccrypt_suite_options_t* suite, uint64_t* server_iv,
+    const vccrypt_buffer_t* shared_secret, allocator_options_t* alloc_opts,
+    protocol_resp_txn_get* resp);
 
 /**
- * \brief Send a response to an extended API request.
+ * \brief Receive an artifact transaction page get response from the API and
+ * decode it.
  *
- * \param sock                      The socket to which this request is written.
- * \param suite                     The crypto suite to use for this request.
- * \param client_iv                 Pointer to the client IV, updated by this
- *                                  call.
- * \param shared_secret             The shared secret to use for this request.
- * \param offset                    The offset provided by agentd for the
- *                                  original extended request. Unlike regular
- *                                  offsets, these are 64-bit and are only used
- *                                  once.
- * \param status                    The status to pass to the client.
- * \param response_body             The body of the response to be sent.
+ * \param sock                      The socket from which this response is read.
+ * \param a                         The allocator to use for this operation.
+ * \param suite                     The crypto suite to use for this read.
+ * \param server_iv                 Pointer to the server_iv to use, updated as
+ *                                  a consequence of this call.
+ * \param shared_secret             The shared secret key for this request.
+ * \param alloc_opts                The allocator to use for the decoded
+ *                                  response.
+ * \param resp                      The response structure to initialize.
+ *
+ * \note - this function requires that the handshake request send / receive, and
+ * the handshake ack send have each been performed before it can be used.
+ *
+ * This call reads the response to a request sent by \ref
+ * vcblockchain_protocol_sendreq_artifact_txn_page_get, decoding it directly
+ * from the decrypted payload. On success, the server_iv is incremented, and
+ * \p resp is initialized and owned by the caller, who must \ref dispose() it
+ * when it is no longer needed. The server_iv is also incremented if the server
+ * returned an error status, in which case \p resp is not initialized.
  *
  * \returns a status code indicating success or failure.
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
- *      - a non-zero error code on failure.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_READ if reading from the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the response was not a
+ *        artifact transaction page get response.
+ *      - the status returned by the server if the request failed.
+ *      - a non-zero error response if something else has failed.
  */
-status vcblockchain_protocol_sendreq_extended_api_response(
-    RCPR_SYM(psock)* sock, vccrypt_suite_options_t* suite, uint64_t* client_iv,
-    const vccrypt_buffer_t* shared_secret, uint64_t offset, uint32_t status,
-    const vccrypt_buffer_t* response_body);
+status vcblockchain_protocol_recvresp_artifact_txn_page_get(
+    RCPR_SYM(psock)* sock, RCPR_SYM(allocator)* a,
+    vccrypt_suite_options_t* suite, uint64_t* server_iv,
+    const vccrypt_buffer_t* shared_secret, allocator_options_t* alloc_opts,
+    protocol_resp_artifact_txn_page_get* resp);
 
 /**
- * \brief Receive a response from the API.
+ * \brief Receive an artifact latest transaction get response from the API and
+ * decode it.
  *
  * \param sock                      The socket from which this response is read.
  * \param a                         The allocator to use for this operation.
@@ -688,32 +1697,385 @@ status vcblockchain_protocol_sendreq_extended_api_response(
  * \param server_iv                 Pointer to the server_iv to use, updated as
  *                                  a consequence of this call.
  * \param shared_secret             The shared secret key for this request.
- * \param response                  Pointer to an uninitialized buffer. On
- *                                  success, this buffer is initialized with the
- *                                  response and must be disposed by the caller
- *                                  when no longer needed.
+ * \param alloc_opts                The allocator to use for the decoded
+ *                                  response.
+ * \param resp                      The response structure to initialize.
  *
  * \note - this function requires that the handshake request send / receive, and
  * the handshake ack send have each been performed before it can be used.
  *
- * This call reads a response from the protocol. On success, the server_iv is
- * incremented, and the response buffer is initialized with the response
- * received, and must be disposed by the caller when no longer needed. This
- * response is the raw bytes of the response as decrypted by this call. The
- * caller can decode this response into a structure by calling \ref
- * vcblockchain_protocol_response_decode.
+ * This call reads the response to a request sent by \ref
+ * vcblockchain_protocol_sendreq_artifact_latest_txn_get, decoding it directly
+ * from the decrypted payload into a transaction get response. On success, the
+ * server_iv is incremented, and \p resp is initialized and owned by the caller,
+ * who must \ref dispose() it when it is no longer needed. The server_iv is
+ * also incremented if the server returned an error status, in which case
+ * \p resp is not initialized.
  *
  * \returns a status code indicating success or failure.
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
- *      - VCBLOCKCHAIN_ERROR_SSOCK_READ if writing to the socket failed.
- *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
- *        out-of-memory error.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_READ if reading from the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the response was not a
+ *        artifact latest transaction get response.
+ *      - the status returned by the server if the request failed.
  *      - a non-zero error response if something else has failed.
  */
-status vcblockchain_protocol_recvresp(
+status vcblockchain_protocol_recvresp_artifact_latest_txn_get(
     RCPR_SYM(psock)* sock, RCPR_SYM(allocator)* a,
     vccrypt_suite_options_t* suite, uint64_t* server_iv,
-    const vccrypt_buffer_t* shared_secret, vccrypt_buffer_t* response);
+    const vccrypt_buffer_t* shared_secret, allocator_options_t* alloc_opts,
+    protocol_resp_txn_get* resp);
+
+/**
+ * \brief Receive a block get response from the API and decode it.
+ *
+ * \param sock                      The socket from which this response is read.
+ * \param a                         The allocator to use for this operation.
+ * \param suite                     The crypto suite to use for this read.
+ * \param server_iv                 Pointer to the server_iv to use, updated as
+ *                                  a consequence of this call.
+ * \param shared_secret             The shared secret key for this request.
+ * \param alloc_opts                The allocator to use for the decoded
+ *                                  response.
+ * \param resp                      The response structure to initialize.
+ *
+ * \note - this function requires that the handshake request send / receive, and
+ * the handshake ack send have each been performed before it can be used.
+ *
+ * This call reads the response to a request sent by \ref
+ * vcblockchain_protocol_sendreq_block_get, decoding it directly from the
+ * decrypted payload. On success, the server_iv is incremented, and \p resp is
+ * initialized and owned by the caller, who must \ref dispose() it when it is no
+ * longer needed. The server_iv is also incremented if the server returned an
+ * error status, in which case \p resp is not initialized.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_READ if reading from the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the response was not a
+ *        block get response.
+ *      - the status returned by the server if the request failed.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_protocol_recvresp_block_get(
+    RCPR_SYM(psock)* sock, RCPR_SYM(allocator)* a,
+    vccrypt_suite_options_t* suite, uint64_t* server_iv,
+    const vccrypt_buffer_t* shared_secret, allocator_options_t* alloc_opts,
+    protocol_resp_block_get* resp);
+
+/**
+ * \brief Receive a block range get response from the API and decode it.
+ *
+ * \param sock                      The socket from which this response is read.
+ * \param a                         The allocator to use for this operation.
+ * \param suite                     The crypto suite to use for this read.
+ * \param server_iv                 Pointer to the server_iv to use, updated as
+ *                                  a consequence of this call.
+ * \param shared_secret             The shared secret key for this request.
+ * \param alloc_opts                The allocator to use for the decoded
+ *                                  response.
+ * \param resp                      The response structure to initialize.
+ *
+ * \note - this function requires that the handshake request send / receive, and
+ * the handshake ack send have each been performed before it can be used.
+ *
+ * This call reads the response to a request sent by \ref
+ * vcblockchain_protocol_sendreq_block_range_get, decoding it directly from the
+ * decrypted payload. On success, the server_iv is incremented, and \p resp is
+ * initialized and owned by the caller, who must \ref dispose() it when it is no
+ * longer needed. The server_iv is also incremented if the server returned an
+ * error status, in which case \p resp is not initialized.
+ *
+ * A block range may be returned over several responses. While the
+ * \ref PROTOCOL_BLOCK_RANGE_FLAG_MORE flag is set in \p resp, the caller
+ * should call this function again to receive the next run of blocks.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_READ if reading from the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the response was not a
+ *        block range get response.
+ *      - the status returned by the server if the request failed.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_protocol_recvresp_block_range_get(
+    RCPR_SYM(psock)* sock, RCPR_SYM(allocator)* a,
+    vccrypt_suite_options_t* suite, uint64_t* server_iv,
+    const vccrypt_buffer_t* shared_secret, allocator_options_t* alloc_opts,
+    protocol_resp_block_range_get* resp);
+
+/**
+ * \brief Receive a block transaction ids get response from the API and decode
+ * it.
+ *
+ * \param sock                      The socket from which this response is read.
+ * \param a                         The allocator to use for this operation.
+ * \param suite                     The crypto suite to use for this read.
+ * \param server_iv                 Pointer to the server_iv to use, updated as
+ *                                  a consequence of this call.
+ * \param shared_secret             The shared secret key for this request.
+ * \param alloc_opts                The allocator to use for the decoded
+ *                                  response.
+ * \param resp                      The response structure to initialize.
+ *
+ * \note - this function requires that the handshake request send / receive, and
+ * the handshake ack send have each been performed before it can be used.
+ *
+ * This call reads the response to a request sent by \ref
+ * vcblockchain_protocol_sendreq_block_txn_ids_get, decoding it directly from
+ * the decrypted payload. On success, the server_iv is incremented, and \p resp
+ * is initialized and owned by the caller, who must \ref dispose() it when it is
+ * no longer needed. The server_iv is also incremented if the server returned an
+ * error status, in which case \p resp is not initialized.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_READ if reading from the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the response was not a
+ *        block transaction ids get response.
+ *      - the status returned by the server if the request failed.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_protocol_recvresp_block_txn_ids_get(
+    RCPR_SYM(psock)* sock, RCPR_SYM(allocator)* a,
+    vccrypt_suite_options_t* suite, uint64_t* server_iv,
+    const vccrypt_buffer_t* shared_secret, allocator_options_t* alloc_opts,
+    protocol_resp_block_txn_ids_get* resp);
+
+/**
+ * \brief Receive a transaction submit batch response from the API and decode
+ * it.
+ *
+ * \param sock                      The socket from which this response is read.
+ * \param a                         The allocator to use for this operation.
+ * \param suite                     The crypto suite to use for this read.
+ * \param server_iv                 Pointer to the server_iv to use, updated as
+ *                                  a consequence of this call.
+ * \param shared_secret             The shared secret key for this request.
+ * \param alloc_opts                The allocator to use for the decoded
+ *                                  response.
+ * \param resp                      The response structure to initialize.
+ *
+ * \note - this function requires that the handshake request send / receive, and
+ * the handshake ack send have each been performed before it can be used.
+ *
+ * This call reads the response to a request sent by \ref
+ * vcblockchain_protocol_sendreq_transaction_submit_batch, decoding it directly
+ * from the decrypted payload. On success, the server_iv is incremented, and
+ * \p resp is initialized and owned by the caller, who must \ref dispose() it
+ * when it is no longer needed. The server_iv is also incremented if the server
+ * returned an error status, in which case \p resp is not initialized. The
+ * submit status of each transaction is held in the statuses array of \p resp.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_READ if reading from the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the response was not a
+ *        transaction submit batch response.
+ *      - the status returned by the server if the request failed.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_protocol_recvresp_transaction_submit_batch(
+    RCPR_SYM(psock)* sock, RCPR_SYM(allocator)* a,
+    vccrypt_suite_options_t* suite, uint64_t* server_iv,
+    const vccrypt_buffer_t* shared_secret, allocator_options_t* alloc_opts,
+    protocol_resp_transaction_submit_batch* resp);
+
+/**
+ * \brief Wait for a transaction canonized notification from the API and decode
+ * it.
+ *
+ * \param sock                      The socket from which this response is read.
+ * \param a                         The allocator to use for this operation.
+ * \param suite                     The crypto suite to use for this read.
+ * \param server_iv                 Pointer to the server_iv to use, updated as
+ *                                  a consequence of this call.
+ * \param shared_secret             The shared secret key for this request.
+ * \param resp                      The notification structure to initialize.
+ *
+ * \note - this function requires that the handshake request send / receive, and
+ * the handshake ack send have each been performed before it can be used.
+ *
+ * This call waits for the outcome of a request sent by \ref
+ * vcblockchain_protocol_sendreq_transaction_submit_await. If the next response
+ * is the acknowledgement for this submission, then it is consumed, and this
+ * call continues to wait for the notification that follows it. The
+ * notification is decoded directly from the decrypted payload. The server_iv
+ * is incremented once for each response read. On success, \p resp is
+ * initialized and owned by the caller, who must \ref dispose() it when it is
+ * no longer needed. If the submission failed or its deadline expired, then the
+ * status returned by the server is returned, and \p resp is not initialized.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_READ if reading from the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the response was not
+ *        a transaction canonized notification.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_CANONIZATION_EXPIRED if the transaction
+ *        was not canonized before the deadline.
+ *      - the status returned by the server if the request failed.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_protocol_recvresp_transaction_canonized(
+    RCPR_SYM(psock)* sock, RCPR_SYM(allocator)* a,
+    vccrypt_suite_options_t* suite, uint64_t* server_iv,
+    const vccrypt_buffer_t* shared_secret,
+    protocol_resp_transaction_canonized* resp);
+
+/**
+ * \brief Receive a block notification from the API and decode it.
+ *
+ * \param sock                      The socket from which this response is read.
+ * \param a                         The allocator to use for this operation.
+ * \param suite                     The crypto suite to use for this read.
+ * \param server_iv                 Pointer to the server_iv to use, updated as
+ *                                  a consequence of this call.
+ * \param shared_secret             The shared secret key for this request.
+ * \param alloc_opts                The allocator to use for the decoded
+ *                                  notification.
+ * \param resp                      The notification structure to initialize.
+ *
+ * \note - this function requires that the handshake request send / receive, and
+ * the handshake ack send have each been performed before it can be used.
+ *
+ * This call reads the next notification for a subscription created by \ref
+ * vcblockchain_protocol_sendreq_block_subscribe, decoding it directly from the
+ * decrypted payload. On success, the server_iv is incremented, and \p resp is
+ * initialized and owned by the caller, who must \ref dispose() it when it is
+ * no longer needed. The server_iv is also incremented if the server returned an
+ * error status, in which case \p resp is not initialized.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_READ if reading from the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the response was not a
+ *        block notification.
+ *      - the status returned by the server if the request failed.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_protocol_recvresp_block_notification(
+    RCPR_SYM(psock)* sock, RCPR_SYM(allocator)* a,
+    vccrypt_suite_options_t* suite, uint64_t* server_iv,
+    const vccrypt_buffer_t* shared_secret, allocator_options_t* alloc_opts,
+    protocol_resp_block_notification* resp);
+
+/**
+ * \brief Receive an artifact notification from the API and decode it.
+ *
+ * \param sock                      The socket from which this response is read.
+ * \param a                         The allocator to use for this operation.
+ * \param suite                     The crypto suite to use for this read.
+ * \param server_iv                 Pointer to the server_iv to use, updated as
+ *                                  a consequence of this call.
+ * \param shared_secret             The shared secret key for this request.
+ * \param resp                      The notification structure to initialize.
+ *
+ * \note - this function requires that the handshake request send / receive, and
+ * the handshake ack send have each been performed before it can be used.
+ *
+ * This call reads the next notification for a subscription created by \ref
+ * vcblockchain_protocol_sendreq_artifact_subscribe, decoding it directly from
+ * the decrypted payload. On success, the server_iv is incremented, and \p resp
+ * is initialized and owned by the caller, who must \ref dispose() it when it is
+ * no longer needed. The server_iv is also incremented if the server returned an
+ * error status, in which case \p resp is not initialized.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_READ if reading from the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the response was not
+ *        an artifact notification.
+ *      - the status returned by the server if the request failed.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_protocol_recvresp_artifact_notification(
+    RCPR_SYM(psock)* sock, RCPR_SYM(allocator)* a,
+    vccrypt_suite_options_t* suite, uint64_t* server_iv,
+    const vccrypt_buffer_t* shared_secret,
+    protocol_resp_artifact_notification* resp);
+
+/**
+ * \brief Receive a extended API response from the API and decode it.
+ *
+ * \param sock                      The socket from which this response is read.
+ * \param a                         The allocator to use for this operation.
+ * \param suite                     The crypto suite to use for this read.
+ * \param server_iv                 Pointer to the server_iv to use, updated as
+ *                                  a consequence of this call.
+ * \param shared_secret             The shared secret key for this request.
+ * \param alloc_opts                The allocator to use for the decoded
+ *                                  response.
+ * \param resp                      The response structure to initialize.
+ *
+ * \note - this function requires that the handshake request send / receive, and
+ * the handshake ack send have each been performed before it can be used.
+ *
+ * This call reads the response to a request sent by \ref
+ * vcblockchain_protocol_sendreq_extended_api, decoding it directly from the
+ * decrypted payload. On success, the server_iv is incremented, and \p resp is
+ * initialized and owned by the caller, who must \ref dispose() it when it is no
+ * longer needed. The server_iv is also incremented if the server returned an
+ * error status, in which case \p resp is not initialized.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_READ if reading from the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the response was not a
+ *        extended API response.
+ *      - the status returned by the server if the request failed.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_protocol_recvresp_extended_api(
+    RCPR_SYM(psock)* sock, RCPR_SYM(allocator)* a,
+    vccrypt_suite_options_t* suite, uint64_t* server_iv,
+    const vccrypt_buffer_t* shared_secret, allocator_options_t* alloc_opts,
+    protocol_resp_extended_api* resp);
+
+/**
+ * \brief Receive a flow credit grant response from the API and decode it.
+ *
+ * \param sock                      The socket from which this response is read.
+ * \param a                         The allocator to use for this operation.
+ * \param suite                     The crypto suite to use for this read.
+ * \param server_iv                 Pointer to the server_iv to use, updated as
+ *                                  a consequence of this call.
+ * \param shared_secret             The shared secret key for this request.
+ * \param resp                      The response structure to initialize.
+ *
+ * \note - this function requires that the handshake request send / receive, and
+ * the handshake ack send have each been performed before it can be used.
+ *
+ * This call reads the agent's answer to the first grant sent by \ref
+ * vcblockchain_protocol_sendreq_flow_credit_grant, decoding it directly from
+ * the decrypted payload. On success, the server_iv is incremented, and \p resp
+ * is initialized and owned by the caller, who must \ref dispose() it when it is
+ * no longer needed. The server_iv is also incremented if the agent refused the
+ * grant, in which case \p resp is not initialized, and flow control stays off
+ * for the connection.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_READ if reading from the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the response was not a
+ *        flow credit grant response.
+ *      - the status returned by the server if it refused the grant.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_protocol_recvresp_flow_credit_grant(
+    RCPR_SYM(psock)* sock, RCPR_SYM(allocator)* a,
+    vccrypt_suite_options_t* suite, uint64_t* server_iv,
+    const vccrypt_buffer_t* shared_secret,
+    protocol_resp_flow_credit_grant* resp);
 
 /**
  * \brief Decode the header values of a response.
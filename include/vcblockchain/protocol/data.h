@@ -31,25 +31,52 @@ typedef enum protocol_request_id
     PROTOCOL_REQ_ID_BLOCK_ID_GET_NEXT = 0x00000005,
     PROTOCOL_REQ_ID_BLOCK_ID_GET_PREV = 0x00000006,
     PROTOCOL_REQ_ID_BLOCK_ID_BY_HEIGHT_GET = 0x00000007,
+    PROTOCOL_REQ_ID_BLOCK_BY_ID_GET_FIELDS = 0x00000008,
+    PROTOCOL_REQ_ID_BLOCK_RANGE_GET = 0x00000009,
+    PROTOCOL_REQ_ID_BLOCK_TXN_IDS_GET = 0x0000000A,
+    PROTOCOL_REQ_ID_LATEST_BLOCK_ID_GET_IF_CHANGED = 0x0000000B,
 
     PROTOCOL_REQ_ID_TRANSACTION_BY_ID_GET = 0x00000010,
     PROTOCOL_REQ_ID_TRANSACTION_ID_GET_NEXT = 0x00000011,
     PROTOCOL_REQ_ID_TRANSACTION_ID_GET_PREV = 0x00000012,
     PROTOCOL_REQ_ID_TRANSACTION_ID_GET_BLOCK_ID = 0x00000013,
+    PROTOCOL_REQ_ID_TRANSACTION_BY_ID_GET_FIELDS = 0x00000014,
+    PROTOCOL_REQ_ID_TRANSACTION_SUBMIT_BATCH = 0x00000018,
+    PROTOCOL_REQ_ID_TRANSACTION_SUBMIT_AWAIT = 0x00000019,
+    PROTOCOL_REQ_ID_TRANSACTION_CANONIZED = 0x0000001A,
 
     PROTOCOL_REQ_ID_ARTIFACT_FIRST_TXN_BY_ID_GET = 0x00000020,
     PROTOCOL_REQ_ID_ARTIFACT_LAST_TXN_BY_ID_GET = 0x00000021,
+    PROTOCOL_REQ_ID_ARTIFACT_TXN_PAGE_GET = 0x00000022,
+    PROTOCOL_REQ_ID_ARTIFACT_LATEST_TXN_GET = 0x00000023,
+    PROTOCOL_REQ_ID_ARTIFACT_LAST_TXN_BY_ID_GET_IF_CHANGED = 0x00000024,
 
     PROTOCOL_REQ_ID_ASSERT_LATEST_BLOCK_ID = 0x00000030,
     PROTOCOL_REQ_ID_ASSERT_LATEST_BLOCK_ID_CANCEL = 0x00000031,
+    PROTOCOL_REQ_ID_BLOCK_SUBSCRIBE = 0x00000032,
+    PROTOCOL_REQ_ID_BLOCK_NOTIFICATION = 0x00000033,
+    PROTOCOL_REQ_ID_ARTIFACT_SUBSCRIBE = 0x00000034,
+    PROTOCOL_REQ_ID_ARTIFACT_UNSUBSCRIBE = 0x00000035,
+    PROTOCOL_REQ_ID_ARTIFACT_NOTIFICATION = 0x00000036,
+
+    PROTOCOL_REQ_ID_BATCH = 0x00000040,
 
     PROTOCOL_REQ_ID_EXTENDED_API_ENABLE = 0x00000050,
     PROTOCOL_REQ_ID_EXTENDED_API_SENDRECV = 0x00000051,
     PROTOCOL_REQ_ID_EXTENDED_API_CLIENTREQ = 0x00000052,
     PROTOCOL_REQ_ID_EXTENDED_API_SENDRESP = 0x00000053,
 
+    PROTOCOL_REQ_ID_HANDSHAKE_RESUME = 0x00000060,
+    PROTOCOL_REQ_ID_RESUMPTION_TICKET_GET = 0x00000061,
+    PROTOCOL_REQ_ID_REKEY = 0x00000062,
+
+    PROTOCOL_REQ_ID_STREAM_FRAME = 0x00000070,
+    PROTOCOL_REQ_ID_FLOW_CREDIT_GRANT = 0x00000071,
+
     PROTOCOL_REQ_ID_STATUS_GET = 0x0000A000,
 
+    PROTOCOL_REQ_ID_REQUEST_CANCEL = 0x0000FF00,
+
     PROTOCOL_REQ_ID_CLOSE = 0x0000FFFF,
 } protocol_request_id;
 
@@ -60,8 +87,44 @@ typedef enum protocol_version
 {
     PROTOCOL_VERSION_0_1_DEMO = 0x00000001,
     PROTOCOL_VERSION_0_2_FORWARD_SECRECY = 0x00000002,
+    PROTOCOL_VERSION_0_3_RESUMPTION = 0x00000003,
 } protocol_version;
 
+/**
+ * \brief Fields that can be requested by a block get fields request.
+ *
+ * The block id is always returned. Fields not in the mask are omitted from the
+ * response.
+ */
+typedef enum protocol_block_field
+{
+    PROTOCOL_BLOCK_FIELD_PREV_BLOCK_ID = 0x00000001,
+    PROTOCOL_BLOCK_FIELD_NEXT_BLOCK_ID = 0x00000002,
+    PROTOCOL_BLOCK_FIELD_FIRST_TXN_ID = 0x00000004,
+    PROTOCOL_BLOCK_FIELD_BLOCK_HEIGHT = 0x00000008,
+    PROTOCOL_BLOCK_FIELD_BLOCK_CERT = 0x00000010,
+
+    PROTOCOL_BLOCK_FIELD_ALL = 0x0000001F,
+} protocol_block_field;
+
+/**
+ * \brief Fields that can be requested by a transaction get fields request.
+ *
+ * The transaction id is always returned. Fields not in the mask are omitted
+ * from the response.
+ */
+typedef enum protocol_txn_field
+{
+    PROTOCOL_TXN_FIELD_PREV_TXN_ID = 0x00000001,
+    PROTOCOL_TXN_FIELD_NEXT_TXN_ID = 0x00000002,
+    PROTOCOL_TXN_FIELD_ARTIFACT_ID = 0x00000004,
+    PROTOCOL_TXN_FIELD_BLOCK_ID = 0x00000008,
+    PROTOCOL_TXN_FIELD_TXN_STATE = 0x00000010,
+    PROTOCOL_TXN_FIELD_TXN_CERT = 0x00000020,
+
+    PROTOCOL_TXN_FIELD_ALL = 0x0000003F,
+} protocol_txn_field;
+
 /**
  * \brief The decoded protocol request for the handshake request.
  */
@@ -149,22 +212,32 @@ typedef struct protocol_resp_handshake_ack
 } protocol_resp_handshake_ack;
 
 /**
- * \brief The decoded protocol request for the latest block id get request.
+ * \brief The decoded protocol request for the handshake resume request.
  */
-typedef struct protocol_req_latest_block_id_get
+typedef struct protocol_req_handshake_resume
 {
     /** \brief this structure is disposable. */
     disposable_t hdr;
     /** \brief the protocol request id. */
     uint32_t request_id;
-    /** \brief the offset. */
+    /** \brief the protocol request offset. */
     uint32_t offset;
-} protocol_req_latest_block_id_get;
+    /** \brief the protocol version. */
+    uint32_t protocol_version;
+    /** \brief the crypto suite. */
+    uint32_t crypto_suite;
+    /** \brief the client uuid. */
+    vpr_uuid client_id;
+    /** \brief the client key nonce. */
+    vccrypt_buffer_t client_key_nonce;
+    /** \brief the resumption ticket issued by the agent. */
+    vccrypt_buffer_t ticket;
+} protocol_req_handshake_resume;
 
 /**
- * \brief The decoded protocol response for the latest block id get response.
+ * \brief The decoded protocol response for the handshake resume request.
  */
-typedef struct protocol_resp_latest_block_id_get
+typedef struct protocol_resp_handshake_resume
 {
     /** \brief this structure is disposable. */
     disposable_t hdr;
@@ -174,14 +247,20 @@ typedef struct protocol_resp_latest_block_id_get
     uint32_t offset;
     /** \brief the protocol response status. */
     uint32_t status;
-    /** \brief the block id. */
-    vpr_uuid block_id;
-} protocol_resp_latest_block_id_get;
+    /** \brief flag to determine whether key nonce is set. */
+    bool server_key_nonce_set;
+    /** \brief the server key nonce. */
+    vccrypt_buffer_t server_key_nonce;
+    /** \brief flag to determine whether cr hmac is set. */
+    bool server_cr_hmac_set;
+    /** \brief the server proof that it could open the ticket. */
+    vccrypt_buffer_t server_cr_hmac;
+} protocol_resp_handshake_resume;
 
 /**
- * \brief The decoded protocol request for the transaction submit request.
+ * \brief The decoded protocol request for the resumption ticket get request.
  */
-typedef struct protocol_req_transaction_submit
+typedef struct protocol_req_resumption_ticket_get
 {
     /** \brief this structure is disposable. */
     disposable_t hdr;
@@ -189,18 +268,12 @@ typedef struct protocol_req_transaction_submit
     uint32_t request_id;
     /** \brief the offset. */
     uint32_t offset;
-    /** \brief the transaction id. */
-    vpr_uuid txn_id;
-    /** \brief the artifact id. */
-    vpr_uuid artifact_id;
-    /** \brief the certificate. */
-    vccrypt_buffer_t cert;
-} protocol_req_transaction_submit;
+} protocol_req_resumption_ticket_get;
 
 /**
- * \brief The decoded protocol response for the transaction submit response.
+ * \brief The decoded protocol response for the resumption ticket get request.
  */
-typedef struct protocol_resp_transaction_submit
+typedef struct protocol_resp_resumption_ticket_get
 {
     /** \brief this structure is disposable. */
     disposable_t hdr;
@@ -210,12 +283,14 @@ typedef struct protocol_resp_transaction_submit
     uint32_t offset;
     /** \brief the protocol response status. */
     uint32_t status;
-} protocol_resp_transaction_submit;
+    /** \brief the resumption ticket, which is opaque to the client. */
+    vccrypt_buffer_t ticket;
+} protocol_resp_resumption_ticket_get;
 
 /**
- * \brief The decoded protocol request for the block get request.
+ * \brief The decoded protocol request for the rekey request.
  */
-typedef struct protocol_req_block_get
+typedef struct protocol_req_rekey
 {
     /** \brief this structure is disposable. */
     disposable_t hdr;
@@ -223,14 +298,16 @@ typedef struct protocol_req_block_get
     uint32_t request_id;
     /** \brief the offset. */
     uint32_t offset;
-    /** \brief the transaction id. */
-    vpr_uuid block_id;
-} protocol_req_block_get;
+    /** \brief the first client IV that uses the new shared secret. */
+    uint64_t client_switch_iv;
+    /** \brief the client key nonce. */
+    vccrypt_buffer_t client_key_nonce;
+} protocol_req_rekey;
 
 /**
- * \brief The decoded protocol response for the block get response.
+ * \brief The decoded protocol response for the rekey request.
  */
-typedef struct protocol_resp_block_get
+typedef struct protocol_resp_rekey
 {
     /** \brief this structure is disposable. */
     disposable_t hdr;
@@ -240,26 +317,18 @@ typedef struct protocol_resp_block_get
     uint32_t offset;
     /** \brief the protocol response status. */
     uint32_t status;
-    /** \brief the block id. */
-    vpr_uuid block_id;
-    /** \brief the previous block id. */
-    vpr_uuid prev_block_id;
-    /** \brief the next block id. */
-    vpr_uuid next_block_id;
-    /** \brief the first transaction id in the block. */
-    vpr_uuid first_txn_id;
-    /** \brief the block height. */
-    uint64_t block_height;
-    /** \brief the serialized block size. */
-    uint64_t block_size;
-    /** \brief the block certificate. */
-    vccrypt_buffer_t block_cert;
-} protocol_resp_block_get;
+    /** \brief the first server IV that uses the new shared secret. */
+    uint64_t server_switch_iv;
+    /** \brief flag to determine whether key nonce is set. */
+    bool server_key_nonce_set;
+    /** \brief the server key nonce. */
+    vccrypt_buffer_t server_key_nonce;
+} protocol_resp_rekey;
 
 /**
- * \brief The decoded protocol request for the block next id get request.
+ * \brief The decoded protocol request for the flow credit grant request.
  */
-typedef struct protocol_req_block_next_id_get
+typedef struct protocol_req_flow_credit_grant
 {
     /** \brief this structure is disposable. */
     disposable_t hdr;
@@ -267,14 +336,16 @@ typedef struct protocol_req_block_next_id_get
     uint32_t request_id;
     /** \brief the offset. */
     uint32_t offset;
-    /** \brief the block id. */
-    vpr_uuid block_id;
-} protocol_req_block_next_id_get;
+    /** \brief the number of requests granted. */
+    uint32_t request_credits;
+    /** \brief the number of bytes granted. */
+    uint64_t byte_credits;
+} protocol_req_flow_credit_grant;
 
 /**
- * \brief The decoded protocol response for the block next id get response.
+ * \brief The decoded protocol response for the flow credit grant request.
  */
-typedef struct protocol_resp_block_next_id_get
+typedef struct protocol_resp_flow_credit_grant
 {
     /** \brief this structure is disposable. */
     disposable_t hdr;
@@ -284,14 +355,16 @@ typedef struct protocol_resp_block_next_id_get
     uint32_t offset;
     /** \brief the protocol response status. */
     uint32_t status;
-    /** \brief the next block id. */
-    vpr_uuid next_block_id;
-} protocol_resp_block_next_id_get;
+    /** \brief the number of requests granted. */
+    uint32_t request_credits;
+    /** \brief the number of bytes granted. */
+    uint64_t byte_credits;
+} protocol_resp_flow_credit_grant;
 
 /**
- * \brief The decoded protocol request for the block prev id get request.
+ * \brief The decoded protocol request for the latest block id get request.
  */
-typedef struct protocol_req_block_prev_id_get
+typedef struct protocol_req_latest_block_id_get
 {
     /** \brief this structure is disposable. */
     disposable_t hdr;
@@ -299,14 +372,12 @@ typedef struct protocol_req_block_prev_id_get
     uint32_t request_id;
     /** \brief the offset. */
     uint32_t offset;
-    /** \brief the block id. */
-    vpr_uuid block_id;
-} protocol_req_block_prev_id_get;
+} protocol_req_latest_block_id_get;
 
 /**
- * \brief The decoded protocol response for the block prev id get response.
+ * \brief The decoded protocol response for the latest block id get response.
  */
-typedef struct protocol_resp_block_prev_id_get
+typedef struct protocol_resp_latest_block_id_get
 {
     /** \brief this structure is disposable. */
     disposable_t hdr;
@@ -316,15 +387,15 @@ typedef struct protocol_resp_block_prev_id_get
     uint32_t offset;
     /** \brief the protocol response status. */
     uint32_t status;
-    /** \brief the prev block id. */
-    vpr_uuid prev_block_id;
-} protocol_resp_block_prev_id_get;
+    /** \brief the block id. */
+    vpr_uuid block_id;
+} protocol_resp_latest_block_id_get;
 
 /**
- * \brief The decoded protocol request for the artifact first txn id get
+ * \brief The decoded protocol request for the conditional latest block id get
  * request.
  */
-typedef struct protocol_req_artifact_first_txn_id_get
+typedef struct protocol_req_latest_block_id_get_if_changed
 {
     /** \brief this structure is disposable. */
     disposable_t hdr;
@@ -332,15 +403,17 @@ typedef struct protocol_req_artifact_first_txn_id_get
     uint32_t request_id;
     /** \brief the offset. */
     uint32_t offset;
-    /** \brief the artifact id. */
-    vpr_uuid artifact_id;
-} protocol_req_artifact_first_txn_id_get;
+    /** \brief the maximum time to hold this request, in milliseconds. */
+    uint32_t timeout_ms;
+    /** \brief the latest block id known to the client. */
+    vpr_uuid block_id;
+} protocol_req_latest_block_id_get_if_changed;
 
 /**
- * \brief The decoded protocol response for the artifact first txn id get
+ * \brief The decoded protocol response for the conditional latest block id get
  * response.
  */
-typedef struct protocol_resp_artifact_first_txn_id_get
+typedef struct protocol_resp_latest_block_id_get_if_changed
 {
     /** \brief this structure is disposable. */
     disposable_t hdr;
@@ -350,15 +423,14 @@ typedef struct protocol_resp_artifact_first_txn_id_get
     uint32_t offset;
     /** \brief the protocol response status. */
     uint32_t status;
-    /** \brief the first transaction id. */
-    vpr_uuid first_txn_id;
-} protocol_resp_artifact_first_txn_id_get;
+    /** \brief the block id, if it was modified. */
+    vpr_uuid block_id;
+} protocol_resp_latest_block_id_get_if_changed;
 
 /**
- * \brief The decoded protocol request for the artifact last txn id get
- * request.
+ * \brief The decoded protocol request for the transaction submit request.
  */
-typedef struct protocol_req_artifact_last_txn_id_get
+typedef struct protocol_req_transaction_submit
 {
     /** \brief this structure is disposable. */
     disposable_t hdr;
@@ -366,15 +438,18 @@ typedef struct protocol_req_artifact_last_txn_id_get
     uint32_t request_id;
     /** \brief the offset. */
     uint32_t offset;
+    /** \brief the transaction id. */
+    vpr_uuid txn_id;
     /** \brief the artifact id. */
     vpr_uuid artifact_id;
-} protocol_req_artifact_last_txn_id_get;
+    /** \brief the certificate. */
+    vccrypt_buffer_t cert;
+} protocol_req_transaction_submit;
 
 /**
- * \brief The decoded protocol response for the artifact last txn id get
- * response.
+ * \brief The decoded protocol response for the transaction submit response.
  */
-typedef struct protocol_resp_artifact_last_txn_id_get
+typedef struct protocol_resp_transaction_submit
 {
     /** \brief this structure is disposable. */
     disposable_t hdr;
@@ -384,14 +459,29 @@ typedef struct protocol_resp_artifact_last_txn_id_get
     uint32_t offset;
     /** \brief the protocol response status. */
     uint32_t status;
-    /** \brief the last transaction id. */
-    vpr_uuid last_txn_id;
-} protocol_resp_artifact_last_txn_id_get;
+} protocol_resp_transaction_submit;
 
 /**
- * \brief The decoded protocol request for the txn get request.
+ * \brief A single transaction in a transaction submit batch.
  */
-typedef struct protocol_req_txn_get
+typedef struct protocol_transaction_submit_batch_item
+{
+    /** \brief the transaction id. */
+    vpr_uuid txn_id;
+    /** \brief the artifact id. */
+    vpr_uuid artifact_id;
+    /** \brief the certificate, owned by the caller when encoding, or by the
+     * decoded request when decoding. */
+    const uint8_t* cert;
+    /** \brief the size of the certificate. */
+    size_t cert_size;
+} protocol_transaction_submit_batch_item;
+
+/**
+ * \brief The decoded protocol request for the transaction submit batch
+ * request.
+ */
+typedef struct protocol_req_transaction_submit_batch
 {
     /** \brief this structure is disposable. */
     disposable_t hdr;
@@ -399,14 +489,21 @@ typedef struct protocol_req_txn_get
     uint32_t request_id;
     /** \brief the offset. */
     uint32_t offset;
-    /** \brief the transaction id. */
-    vpr_uuid txn_id;
-} protocol_req_txn_get;
+    /** \brief the number of transactions in this batch. */
+    uint32_t count;
+    /** \brief the transactions in this batch. */
+    protocol_transaction_submit_batch_item* items;
+    /** \brief the buffer holding the item array. */
+    vccrypt_buffer_t items_buffer;
+    /** \brief the buffer holding the transaction certificates. */
+    vccrypt_buffer_t body;
+} protocol_req_transaction_submit_batch;
 
 /**
- * \brief The decoded protocol response for the transaction get response.
+ * \brief The decoded protocol response for the transaction submit batch
+ * request.
  */
-typedef struct protocol_resp_txn_get
+typedef struct protocol_resp_transaction_submit_batch
 {
     /** \brief this structure is disposable. */
     disposable_t hdr;
@@ -416,44 +513,58 @@ typedef struct protocol_resp_txn_get
     uint32_t offset;
     /** \brief the protocol response status. */
     uint32_t status;
+    /** \brief the number of transactions in this batch. */
+    uint32_t count;
+    /** \brief the submit status of each transaction, in batch order. */
+    uint32_t* statuses;
+    /** \brief the buffer holding the status array. */
+    vccrypt_buffer_t statuses_buffer;
+} protocol_resp_transaction_submit_batch;
+
+/**
+ * \brief The decoded protocol request for the transaction submit and await
+ * request.
+ */
+typedef struct protocol_req_transaction_submit_await
+{
+    /** \brief this structure is disposable. */
+    disposable_t hdr;
+    /** \brief the protocol request id. */
+    uint32_t request_id;
+    /** \brief the offset. */
+    uint32_t offset;
+    /** \brief the canonization timeout in milliseconds, or 0 for the default.
+     */
+    uint32_t timeout_ms;
     /** \brief the transaction id. */
     vpr_uuid txn_id;
-    /** \brief the previous transaction id. */
-    vpr_uuid prev_txn_id;
-    /** \brief the next transaction id. */
-    vpr_uuid next_txn_id;
-    /** \brief the artifact id to which this transaction belongs. */
+    /** \brief the artifact id. */
     vpr_uuid artifact_id;
-    /** \brief the block id for the block in which this transaction was
-     * canonized. */
-    vpr_uuid block_id;
-    /** \brief the serialized transaction state. */
-    uint32_t txn_state;
-    /** \brief the serialized transaction size. */
-    uint64_t txn_size;
-    /** \brief the transaction certificate. */
-    vccrypt_buffer_t txn_cert;
-} protocol_resp_txn_get;
+    /** \brief the certificate. */
+    vccrypt_buffer_t cert;
+} protocol_req_transaction_submit_await;
 
 /**
- * \brief The decoded protocol request for the block id by height get request.
+ * \brief The decoded protocol response for the transaction submit and await
+ * response.
  */
-typedef struct protocol_req_block_id_by_height_get
+typedef struct protocol_resp_transaction_submit_await
 {
     /** \brief this structure is disposable. */
     disposable_t hdr;
     /** \brief the protocol request id. */
     uint32_t request_id;
-    /** \brief the offset. */
+    /** \brief the protocol request offset. */
     uint32_t offset;
-    /** \brief the block height. */
-    uint64_t height;
-} protocol_req_block_id_by_height_get;
+    /** \brief the protocol response status. */
+    uint32_t status;
+} protocol_resp_transaction_submit_await;
 
 /**
- * \brief The decoded protocol response for the block next id get response.
+ * \brief The decoded transaction canonized notification, sent with the offset
+ * of a transaction submit and await request.
  */
-typedef struct protocol_resp_block_id_by_height_get
+typedef struct protocol_resp_transaction_canonized
 {
     /** \brief this structure is disposable. */
     disposable_t hdr;
@@ -463,14 +574,18 @@ typedef struct protocol_resp_block_id_by_height_get
     uint32_t offset;
     /** \brief the protocol response status. */
     uint32_t status;
+    /** \brief the transaction id. */
+    vpr_uuid txn_id;
     /** \brief the block id. */
     vpr_uuid block_id;
-} protocol_resp_block_id_by_height_get;
+    /** \brief the block height. */
+    uint64_t block_height;
+} protocol_resp_transaction_canonized;
 
 /**
- * \brief The decoded protocol request for the transaction next id get request.
+ * \brief The decoded protocol request for the block get request.
  */
-typedef struct protocol_req_txn_next_id_get
+typedef struct protocol_req_block_get
 {
     /** \brief this structure is disposable. */
     disposable_t hdr;
@@ -478,15 +593,14 @@ typedef struct protocol_req_txn_next_id_get
     uint32_t request_id;
     /** \brief the offset. */
     uint32_t offset;
-    /** \brief the txn id. */
-    vpr_uuid txn_id;
-} protocol_req_txn_next_id_get;
+    /** \brief the transaction id. */
+    vpr_uuid block_id;
+} protocol_req_block_get;
 
 /**
- * \brief The decoded protocol response for the transaction next id get
- * response.
+ * \brief The decoded protocol response for the block get response.
  */
-typedef struct protocol_resp_txn_next_id_get
+typedef struct protocol_resp_block_get
 {
     /** \brief this structure is disposable. */
     disposable_t hdr;
@@ -496,14 +610,26 @@ typedef struct protocol_resp_txn_next_id_get
     uint32_t offset;
     /** \brief the protocol response status. */
     uint32_t status;
-    /** \brief the next txn id. */
-    vpr_uuid next_txn_id;
-} protocol_resp_txn_next_id_get;
+    /** \brief the block id. */
+    vpr_uuid block_id;
+    /** \brief the previous block id. */
+    vpr_uuid prev_block_id;
+    /** \brief the next block id. */
+    vpr_uuid next_block_id;
+    /** \brief the first transaction id in the block. */
+    vpr_uuid first_txn_id;
+    /** \brief the block height. */
+    uint64_t block_height;
+    /** \brief the serialized block size. */
+    uint64_t block_size;
+    /** \brief the block certificate. */
+    vccrypt_buffer_t block_cert;
+} protocol_resp_block_get;
 
 /**
- * \brief The decoded protocol request for the transaction prev id get request.
+ * \brief The decoded protocol request for the block get fields request.
  */
-typedef struct protocol_req_txn_prev_id_get
+typedef struct protocol_req_block_get_fields
 {
     /** \brief this structure is disposable. */
     disposable_t hdr;
@@ -511,15 +637,18 @@ typedef struct protocol_req_txn_prev_id_get
     uint32_t request_id;
     /** \brief the offset. */
     uint32_t offset;
-    /** \brief the txn id. */
-    vpr_uuid txn_id;
-} protocol_req_txn_prev_id_get;
+    /** \brief the block id. */
+    vpr_uuid block_id;
+    /** \brief the requested \ref protocol_block_field values. */
+    uint32_t field_mask;
+} protocol_req_block_get_fields;
 
 /**
- * \brief The decoded protocol response for the transaction prev id get
- * response.
+ * \brief The decoded protocol response for the block get fields response.
+ *
+ * Fields not in \ref field_mask are zeroed.
  */
-typedef struct protocol_resp_txn_prev_id_get
+typedef struct protocol_resp_block_get_fields
 {
     /** \brief this structure is disposable. */
     disposable_t hdr;
@@ -529,13 +658,646 @@ typedef struct protocol_resp_txn_prev_id_get
     uint32_t offset;
     /** \brief the protocol response status. */
     uint32_t status;
-    /** \brief the prev txn id. */
-    vpr_uuid prev_txn_id;
-} protocol_resp_txn_prev_id_get;
-
-/**
- * \brief The decoded protocol request for the transaction block id get request.
- */
+    /** \brief the \ref protocol_block_field values in this response. */
+    uint32_t field_mask;
+    /** \brief the block id. */
+    vpr_uuid block_id;
+    /** \brief the previous block id. */
+    vpr_uuid prev_block_id;
+    /** \brief the next block id. */
+    vpr_uuid next_block_id;
+    /** \brief the first transaction id in the block. */
+    vpr_uuid first_txn_id;
+    /** \brief the block height. */
+    uint64_t block_height;
+    /** \brief the block certificate. */
+    vccrypt_buffer_t block_cert;
+} protocol_resp_block_get_fields;
+
+/**
+ * \brief Flags for a block range get response.
+ */
+typedef enum protocol_block_range_flag
+{
+    /** \brief more responses to this request follow this one. */
+    PROTOCOL_BLOCK_RANGE_FLAG_MORE = 0x00000001,
+    /** \brief the byte limit was reached; resume from the next height. */
+    PROTOCOL_BLOCK_RANGE_FLAG_TRUNCATED = 0x00000002,
+} protocol_block_range_flag;
+
+/**
+ * \brief A single block in a block range get response.
+ *
+ * This holds the same fields as a block get response.
+ */
+typedef struct protocol_block_range_record
+{
+    /** \brief the block id. */
+    vpr_uuid block_id;
+    /** \brief the previous block id. */
+    vpr_uuid prev_block_id;
+    /** \brief the next block id. */
+    vpr_uuid next_block_id;
+    /** \brief the first transaction id in the block. */
+    vpr_uuid first_txn_id;
+    /** \brief the block height. */
+    uint64_t block_height;
+    /** \brief the serialized block size. */
+    uint64_t block_size;
+    /** \brief the block certificate, owned by the decoded response. */
+    const uint8_t* block_cert;
+    /** \brief the size of the block certificate. */
+    size_t block_cert_size;
+} protocol_block_range_record;
+
+/**
+ * \brief The decoded protocol request for the block range get request.
+ */
+typedef struct protocol_req_block_range_get
+{
+    /** \brief this structure is disposable. */
+    disposable_t hdr;
+    /** \brief the protocol request id. */
+    uint32_t request_id;
+    /** \brief the offset. */
+    uint32_t offset;
+    /** \brief the height of the first block to get. */
+    uint64_t start_height;
+    /** \brief the maximum number of blocks to get. */
+    uint32_t count;
+    /** \brief the maximum number of bytes to return, or 0 for no limit. */
+    uint32_t max_bytes;
+} protocol_req_block_range_get;
+
+/**
+ * \brief The decoded protocol response for the block range get request.
+ *
+ * A single request may be answered by several responses, each of which holds
+ * a run of consecutive blocks. Every response but the last has the
+ * \ref PROTOCOL_BLOCK_RANGE_FLAG_MORE flag set. If the last response has the
+ * \ref PROTOCOL_BLOCK_RANGE_FLAG_TRUNCATED flag set, then the range can be
+ * resumed by requesting blocks starting at \p next_height.
+ */
+typedef struct protocol_resp_block_range_get
+{
+    /** \brief this structure is disposable. */
+    disposable_t hdr;
+    /** \brief the protocol request id. */
+    uint32_t request_id;
+    /** \brief the protocol request offset. */
+    uint32_t offset;
+    /** \brief the protocol response status. */
+    uint32_t status;
+    /** \brief the \ref protocol_block_range_flag values for this response. */
+    uint32_t flags;
+    /** \brief the height of the block following the last block returned. */
+    uint64_t next_height;
+    /** \brief the number of blocks in this response. */
+    uint32_t count;
+    /** \brief the blocks in this response. */
+    protocol_block_range_record* records;
+    /** \brief the buffer holding the record array. */
+    vccrypt_buffer_t records_buffer;
+    /** \brief the buffer holding the encoded blocks. */
+    vccrypt_buffer_t body;
+} protocol_resp_block_range_get;
+
+/**
+ * \brief The decoded protocol request for the block transaction ids get
+ * request.
+ */
+typedef struct protocol_req_block_txn_ids_get
+{
+    /** \brief this structure is disposable. */
+    disposable_t hdr;
+    /** \brief the protocol request id. */
+    uint32_t request_id;
+    /** \brief the offset. */
+    uint32_t offset;
+    /** \brief the block id. */
+    vpr_uuid block_id;
+    /** \brief true if transaction states should be returned. */
+    bool include_states;
+} protocol_req_block_txn_ids_get;
+
+/**
+ * \brief The decoded protocol response for the block transaction ids get
+ * request.
+ */
+typedef struct protocol_resp_block_txn_ids_get
+{
+    /** \brief this structure is disposable. */
+    disposable_t hdr;
+    /** \brief the protocol request id. */
+    uint32_t request_id;
+    /** \brief the protocol request offset. */
+    uint32_t offset;
+    /** \brief the protocol response status. */
+    uint32_t status;
+    /** \brief true if transaction states were returned. */
+    bool include_states;
+    /** \brief the number of transactions in the block. */
+    uint32_t count;
+    /** \brief the transaction ids, in block order. */
+    vpr_uuid* txn_ids;
+    /** \brief the transaction states, in block order, or NULL if transaction
+     * states were not returned. */
+    uint32_t* txn_states;
+    /** \brief the buffer holding the transaction ids. */
+    vccrypt_buffer_t txn_ids_buffer;
+    /** \brief the buffer holding the transaction states. */
+    vccrypt_buffer_t txn_states_buffer;
+} protocol_resp_block_txn_ids_get;
+
+/**
+ * \brief The decoded protocol request for the block next id get request.
+ */
+typedef struct protocol_req_block_next_id_get
+{
+    /** \brief this structure is disposable. */
+    disposable_t hdr;
+    /** \brief the protocol request id. */
+    uint32_t request_id;
+    /** \brief the offset. */
+    uint32_t offset;
+    /** \brief the block id. */
+    vpr_uuid block_id;
+} protocol_req_block_next_id_get;
+
+/**
+ * \brief The decoded protocol response for the block next id get response.
+ */
+typedef struct protocol_resp_block_next_id_get
+{
+    /** \brief this structure is disposable. */
+    disposable_t hdr;
+    /** \brief the protocol request id. */
+    uint32_t request_id;
+    /** \brief the protocol request offset. */
+    uint32_t offset;
+    /** \brief the protocol response status. */
+    uint32_t status;
+    /** \brief the next block id. */
+    vpr_uuid next_block_id;
+} protocol_resp_block_next_id_get;
+
+/**
+ * \brief The decoded protocol request for the block prev id get request.
+ */
+typedef struct protocol_req_block_prev_id_get
+{
+    /** \brief this structure is disposable. */
+    disposable_t hdr;
+    /** \brief the protocol request id. */
+    uint32_t request_id;
+    /** \brief the offset. */
+    uint32_t offset;
+    /** \brief the block id. */
+    vpr_uuid block_id;
+} protocol_req_block_prev_id_get;
+
+/**
+ * \brief The decoded protocol response for the block prev id get response.
+ */
+typedef struct protocol_resp_block_prev_id_get
+{
+    /** \brief this structure is disposable. */
+    disposable_t hdr;
+    /** \brief the protocol request id. */
+    uint32_t request_id;
+    /** \brief the protocol request offset. */
+    uint32_t offset;
+    /** \brief the protocol response status. */
+    uint32_t status;
+    /** \brief the prev block id. */
+    vpr_uuid prev_block_id;
+} protocol_resp_block_prev_id_get;
+
+/**
+ * \brief The decoded protocol request for the artifact first txn id get
+ * request.
+ */
+typedef struct protocol_req_artifact_first_txn_id_get
+{
+    /** \brief this structure is disposable. */
+    disposable_t hdr;
+    /** \brief the protocol request id. */
+    uint32_t request_id;
+    /** \brief the offset. */
+    uint32_t offset;
+    /** \brief the artifact id. */
+    vpr_uuid artifact_id;
+} protocol_req_artifact_first_txn_id_get;
+
+/**
+ * \brief The decoded protocol response for the artifact first txn id get
+ * response.
+ */
+typedef struct protocol_resp_artifact_first_txn_id_get
+{
+    /** \brief this structure is disposable. */
+    disposable_t hdr;
+    /** \brief the protocol request id. */
+    uint32_t request_id;
+    /** \brief the protocol request offset. */
+    uint32_t offset;
+    /** \brief the protocol response status. */
+    uint32_t status;
+    /** \brief the first transaction id. */
+    vpr_uuid first_txn_id;
+} protocol_resp_artifact_first_txn_id_get;
+
+/**
+ * \brief The decoded protocol request for the artifact last txn id get
+ * request.
+ */
+typedef struct protocol_req_artifact_last_txn_id_get
+{
+    /** \brief this structure is disposable. */
+    disposable_t hdr;
+    /** \brief the protocol request id. */
+    uint32_t request_id;
+    /** \brief the offset. */
+    uint32_t offset;
+    /** \brief the artifact id. */
+    vpr_uuid artifact_id;
+} protocol_req_artifact_last_txn_id_get;
+
+/**
+ * \brief The decoded protocol response for the artifact last txn id get
+ * response.
+ */
+typedef struct protocol_resp_artifact_last_txn_id_get
+{
+    /** \brief this structure is disposable. */
+    disposable_t hdr;
+    /** \brief the protocol request id. */
+    uint32_t request_id;
+    /** \brief the protocol request offset. */
+    uint32_t offset;
+    /** \brief the protocol response status. */
+    uint32_t status;
+    /** \brief the last transaction id. */
+    vpr_uuid last_txn_id;
+} protocol_resp_artifact_last_txn_id_get;
+
+/**
+ * \brief The decoded protocol request for the conditional artifact last txn id
+ * get request.
+ */
+typedef struct protocol_req_artifact_last_txn_id_get_if_changed
+{
+    /** \brief this structure is disposable. */
+    disposable_t hdr;
+    /** \brief the protocol request id. */
+    uint32_t request_id;
+    /** \brief the offset. */
+    uint32_t offset;
+    /** \brief the maximum time to hold this request, in milliseconds. */
+    uint32_t timeout_ms;
+    /** \brief the artifact id. */
+    vpr_uuid artifact_id;
+    /** \brief the last transaction id known to the client. */
+    vpr_uuid last_txn_id;
+} protocol_req_artifact_last_txn_id_get_if_changed;
+
+/**
+ * \brief The decoded protocol response for the conditional artifact last txn
+ * id get response.
+ */
+typedef struct protocol_resp_artifact_last_txn_id_get_if_changed
+{
+    /** \brief this structure is disposable. */
+    disposable_t hdr;
+    /** \brief the protocol request id. */
+    uint32_t request_id;
+    /** \brief the protocol request offset. */
+    uint32_t offset;
+    /** \brief the protocol response status. */
+    uint32_t status;
+    /** \brief the last transaction id, if it was modified. */
+    vpr_uuid last_txn_id;
+} protocol_resp_artifact_last_txn_id_get_if_changed;
+
+/**
+ * \brief The direction in which to page through an artifact's transactions.
+ */
+typedef enum protocol_txn_page_direction
+{
+    /** \brief page from the first transaction towards the last. */
+    PROTOCOL_TXN_PAGE_DIRECTION_FORWARD = 0x00000000,
+    /** \brief page from the last transaction towards the first. */
+    PROTOCOL_TXN_PAGE_DIRECTION_BACKWARD = 0x00000001,
+} protocol_txn_page_direction;
+
+/**
+ * \brief Flags for an artifact transaction page get response.
+ */
+typedef enum protocol_txn_page_flag
+{
+    /** \brief more transactions follow this page in the requested direction. */
+    PROTOCOL_TXN_PAGE_FLAG_MORE = 0x00000001,
+} protocol_txn_page_flag;
+
+/**
+ * \brief A single transaction in an artifact transaction page.
+ *
+ * This holds the same fields as a transaction get response.
+ */
+typedef struct protocol_txn_page_record
+{
+    /** \brief the transaction id. */
+    vpr_uuid txn_id;
+    /** \brief the previous transaction id. */
+    vpr_uuid prev_txn_id;
+    /** \brief the next transaction id. */
+    vpr_uuid next_txn_id;
+    /** \brief the artifact id to which this transaction belongs. */
+    vpr_uuid artifact_id;
+    /** \brief the block id for the block in which this transaction was
+     * canonized. */
+    vpr_uuid block_id;
+    /** \brief the serialized transaction state. */
+    uint32_t txn_state;
+    /** \brief the serialized transaction size. */
+    uint64_t txn_size;
+    /** \brief the transaction certificate, owned by the decoded response. */
+    const uint8_t* txn_cert;
+    /** \brief the size of the transaction certificate. */
+    size_t txn_cert_size;
+} protocol_txn_page_record;
+
+/**
+ * \brief The decoded protocol request for the artifact transaction page get
+ * request.
+ */
+typedef struct protocol_req_artifact_txn_page_get
+{
+    /** \brief this structure is disposable. */
+    disposable_t hdr;
+    /** \brief the protocol request id. */
+    uint32_t request_id;
+    /** \brief the offset. */
+    uint32_t offset;
+    /** \brief the artifact id. */
+    vpr_uuid artifact_id;
+    /** \brief the page starts after this transaction, or at the start of the
+     * history if this is the zero uuid. */
+    vpr_uuid cursor_txn_id;
+    /** \brief the \ref protocol_txn_page_direction for this page. */
+    uint32_t direction;
+    /** \brief the maximum number of transactions in this page. */
+    uint32_t page_size;
+    /** \brief true if transaction certificates should be returned. */
+    bool include_certs;
+} protocol_req_artifact_txn_page_get;
+
+/**
+ * \brief The decoded protocol response for the artifact transaction page get
+ * request.
+ */
+typedef struct protocol_resp_artifact_txn_page_get
+{
+    /** \brief this structure is disposable. */
+    disposable_t hdr;
+    /** \brief the protocol request id. */
+    uint32_t request_id;
+    /** \brief the protocol request offset. */
+    uint32_t offset;
+    /** \brief the protocol response status. */
+    uint32_t status;
+    /** \brief the \ref protocol_txn_page_flag values for this response. */
+    uint32_t flags;
+    /** \brief the cursor to use to request the next page. */
+    vpr_uuid next_cursor;
+    /** \brief the number of transactions in this page. */
+    uint32_t count;
+    /** \brief the transactions in this page. */
+    protocol_txn_page_record* records;
+    /** \brief the buffer holding the record array. */
+    vccrypt_buffer_t records_buffer;
+    /** \brief the buffer holding the encoded transactions. */
+    vccrypt_buffer_t body;
+} protocol_resp_artifact_txn_page_get;
+
+/**
+ * \brief The decoded protocol request for the artifact latest transaction get
+ * request.
+ *
+ * The response to this request is decoded as a \ref protocol_resp_txn_get.
+ */
+typedef struct protocol_req_artifact_latest_txn_get
+{
+    /** \brief this structure is disposable. */
+    disposable_t hdr;
+    /** \brief the protocol request id. */
+    uint32_t request_id;
+    /** \brief the offset. */
+    uint32_t offset;
+    /** \brief the artifact id. */
+    vpr_uuid artifact_id;
+} protocol_req_artifact_latest_txn_get;
+
+/**
+ * \brief The decoded protocol request for the txn get request.
+ */
+typedef struct protocol_req_txn_get
+{
+    /** \brief this structure is disposable. */
+    disposable_t hdr;
+    /** \brief the protocol request id. */
+    uint32_t request_id;
+    /** \brief the offset. */
+    uint32_t offset;
+    /** \brief the transaction id. */
+    vpr_uuid txn_id;
+} protocol_req_txn_get;
+
+/**
+ * \brief The decoded protocol response for the transaction get response.
+ */
+typedef struct protocol_resp_txn_get
+{
+    /** \brief this structure is disposable. */
+    disposable_t hdr;
+    /** \brief the protocol request id. */
+    uint32_t request_id;
+    /** \brief the protocol request offset. */
+    uint32_t offset;
+    /** \brief the protocol response status. */
+    uint32_t status;
+    /** \brief the transaction id. */
+    vpr_uuid txn_id;
+    /** \brief the previous transaction id. */
+    vpr_uuid prev_txn_id;
+    /** \brief the next transaction id. */
+    vpr_uuid next_txn_id;
+    /** \brief the artifact id to which this transaction belongs. */
+    vpr_uuid artifact_id;
+    /** \brief the block id for the block in which this transaction was
+     * canonized. */
+    vpr_uuid block_id;
+    /** \brief the serialized transaction state. */
+    uint32_t txn_state;
+    /** \brief the serialized transaction size. */
+    uint64_t txn_size;
+    /** \brief the transaction certificate. */
+    vccrypt_buffer_t txn_cert;
+} protocol_resp_txn_get;
+
+/**
+ * \brief The decoded protocol request for the txn get fields request.
+ */
+typedef struct protocol_req_txn_get_fields
+{
+    /** \brief this structure is disposable. */
+    disposable_t hdr;
+    /** \brief the protocol request id. */
+    uint32_t request_id;
+    /** \brief the offset. */
+    uint32_t offset;
+    /** \brief the transaction id. */
+    vpr_uuid txn_id;
+    /** \brief the requested \ref protocol_txn_field values. */
+    uint32_t field_mask;
+} protocol_req_txn_get_fields;
+
+/**
+ * \brief The decoded protocol response for the transaction get fields
+ * response.
+ *
+ * Fields not in \ref field_mask are zeroed.
+ */
+typedef struct protocol_resp_txn_get_fields
+{
+    /** \brief this structure is disposable. */
+    disposable_t hdr;
+    /** \brief the protocol request id. */
+    uint32_t request_id;
+    /** \brief the protocol request offset. */
+    uint32_t offset;
+    /** \brief the protocol response status. */
+    uint32_t status;
+    /** \brief the \ref protocol_txn_field values in this response. */
+    uint32_t field_mask;
+    /** \brief the transaction id. */
+    vpr_uuid txn_id;
+    /** \brief the previous transaction id. */
+    vpr_uuid prev_txn_id;
+    /** \brief the next transaction id. */
+    vpr_uuid next_txn_id;
+    /** \brief the artifact id to which this transaction belongs. */
+    vpr_uuid artifact_id;
+    /** \brief the block id for the block in which this transaction was
+     * canonized. */
+    vpr_uuid block_id;
+    /** \brief the serialized transaction state. */
+    uint32_t txn_state;
+    /** \brief the transaction certificate. */
+    vccrypt_buffer_t txn_cert;
+} protocol_resp_txn_get_fields;
+
+/**
+ * \brief The decoded protocol request for the block id by height get request.
+ */
+typedef struct protocol_req_block_id_by_height_get
+{
+    /** \brief this structure is disposable. */
+    disposable_t hdr;
+    /** \brief the protocol request id. */
+    uint32_t request_id;
+    /** \brief the offset. */
+    uint32_t offset;
+    /** \brief the block height. */
+    uint64_t height;
+} protocol_req_block_id_by_height_get;
+
+/**
+ * \brief The decoded protocol response for the block next id get response.
+ */
+typedef struct protocol_resp_block_id_by_height_get
+{
+    /** \brief this structure is disposable. */
+    disposable_t hdr;
+    /** \brief the protocol request id. */
+    uint32_t request_id;
+    /** \brief the protocol request offset. */
+    uint32_t offset;
+    /** \brief the protocol response status. */
+    uint32_t status;
+    /** \brief the block id. */
+    vpr_uuid block_id;
+} protocol_resp_block_id_by_height_get;
+
+/**
+ * \brief The decoded protocol request for the transaction next id get request.
+ */
+typedef struct protocol_req_txn_next_id_get
+{
+    /** \brief this structure is disposable. */
+    disposable_t hdr;
+    /** \brief the protocol request id. */
+    uint32_t request_id;
+    /** \brief the offset. */
+    uint32_t offset;
+    /** \brief the txn id. */
+    vpr_uuid txn_id;
+} protocol_req_txn_next_id_get;
+
+/**
+ * \brief The decoded protocol response for the transaction next id get
+ * response.
+ */
+typedef struct protocol_resp_txn_next_id_get
+{
+    /** \brief this structure is disposable. */
+    disposable_t hdr;
+    /** \brief the protocol request id. */
+    uint32_t request_id;
+    /** \brief the protocol request offset. */
+    uint32_t offset;
+    /** \brief the protocol response status. */
+    uint32_t status;
+    /** \brief the next txn id. */
+    vpr_uuid next_txn_id;
+} protocol_resp_txn_next_id_get;
+
+/**
+ * \brief The decoded protocol request for the transaction prev id get request.
+ */
+typedef struct protocol_req_txn_prev_id_get
+{
+    /** \brief this structure is disposable. */
+    disposable_t hdr;
+    /** \brief the protocol request id. */
+    uint32_t request_id;
+    /** \brief the offset. */
+    uint32_t offset;
+    /** \brief the txn id. */
+    vpr_uuid txn_id;
+} protocol_req_txn_prev_id_get;
+
+/**
+ * \brief The decoded protocol response for the transaction prev id get
+ * response.
+ */
+typedef struct protocol_resp_txn_prev_id_get
+{
+    /** \brief this structure is disposable. */
+    disposable_t hdr;
+    /** \brief the protocol request id. */
+    uint32_t request_id;
+    /** \brief the protocol request offset. */
+    uint32_t offset;
+    /** \brief the protocol response status. */
+    uint32_t status;
+    /** \brief the prev txn id. */
+    vpr_uuid prev_txn_id;
+} protocol_resp_txn_prev_id_get;
+
+/**
+ * \brief The decoded protocol request for the transaction block id get request.
+ */
 typedef struct protocol_req_txn_block_id_get
 {
     /** \brief this structure is disposable. */
@@ -622,6 +1384,50 @@ typedef struct protocol_resp_connection_close
     uint32_t status;
 } protocol_resp_connection_close;
 
+/**
+ * \brief The decoded protocol request for cancelling a request in flight.
+ *
+ * Every request still receives exactly one response. If the request at \ref
+ * target_offset is still in flight, the agent abandons it and answers it with
+ * an error response carrying \ref VCBLOCKCHAIN_ERROR_PROTOCOL_REQUEST_CANCELLED
+ * in place of its normal response. The cancel response is always sent after
+ * the final response for \ref target_offset, so once it arrives, the client may
+ * reuse that offset.
+ */
+typedef struct protocol_req_request_cancel
+{
+    /** \brief this structure is disposable. */
+    disposable_t hdr;
+    /** \brief the protocol request id. */
+    uint32_t request_id;
+    /** \brief the offset. */
+    uint32_t offset;
+    /** \brief the offset of the request to cancel. */
+    uint32_t target_offset;
+} protocol_req_request_cancel;
+
+/**
+ * \brief The decoded protocol response for a request cancellation.
+ *
+ * The status is \ref VCBLOCKCHAIN_STATUS_SUCCESS if the target request was
+ * cancelled, or \ref VCBLOCKCHAIN_ERROR_PROTOCOL_REQUEST_NOT_FOUND if it had
+ * already completed or was never sent, in which case its own response is
+ * unaffected.
+ */
+typedef struct protocol_resp_request_cancel
+{
+    /** \brief this structure is disposable. */
+    disposable_t hdr;
+    /** \brief the protocol request id. */
+    uint32_t request_id;
+    /** \brief the protocol request offset. */
+    uint32_t offset;
+    /** \brief the protocol response status. */
+    uint32_t status;
+    /** \brief the offset of the request to cancel. */
+    uint32_t target_offset;
+} protocol_resp_request_cancel;
+
 /**
  * \brief The decoded protocol request for the latest block id assertion.
  */
@@ -682,6 +1488,249 @@ typedef struct protocol_resp_assert_latest_block_id_cancel
     uint32_t status;
 } protocol_resp_assert_latest_block_id_cancel;
 
+/**
+ * \brief The decoded protocol request for a block subscription.
+ *
+ * A block subscription shares the latest block id watch with \ref
+ * protocol_req_assert_latest_block_id, and is cancelled in the same way.
+ * Unlike the assertion, it is not removed once it fires; instead, the agent
+ * sends a \ref protocol_resp_block_notification for each block after
+ * \ref latest_block_id as it is added to the blockchain, until the watch is
+ * cancelled.
+ */
+typedef struct protocol_req_block_subscribe
+{
+    /** \brief this structure is disposable. */
+    disposable_t hdr;
+    /** \brief the protocol request id. */
+    uint32_t request_id;
+    /** \brief the offset. */
+    uint32_t offset;
+    /** \brief the latest block id known to the client. */
+    vpr_uuid latest_block_id;
+    /** \brief true if notifications should include the block certificate. */
+    bool include_cert;
+} protocol_req_block_subscribe;
+
+/**
+ * \brief The decoded protocol response for a block subscription.
+ */
+typedef struct protocol_resp_block_subscribe
+{
+    /** \brief this structure is disposable. */
+    disposable_t hdr;
+    /** \brief the protocol request id. */
+    uint32_t request_id;
+    /** \brief the protocol request offset. */
+    uint32_t offset;
+    /** \brief the protocol response status. */
+    uint32_t status;
+} protocol_resp_block_subscribe;
+
+/**
+ * \brief The decoded unsolicited notification for a new block.
+ *
+ * The offset is that of the \ref protocol_req_block_subscribe request which
+ * created the subscription.
+ */
+typedef struct protocol_resp_block_notification
+{
+    /** \brief this structure is disposable. */
+    disposable_t hdr;
+    /** \brief the protocol request id. */
+    uint32_t request_id;
+    /** \brief the protocol request offset. */
+    uint32_t offset;
+    /** \brief the protocol response status. */
+    uint32_t status;
+    /** \brief the block id. */
+    vpr_uuid block_id;
+    /** \brief the previous block id. */
+    vpr_uuid prev_block_id;
+    /** \brief the block height. */
+    uint64_t block_height;
+    /** \brief the block certificate, empty if it was not requested. */
+    vccrypt_buffer_t block_cert;
+} protocol_resp_block_notification;
+
+/**
+ * \brief The decoded protocol request for an artifact subscription.
+ *
+ * The artifacts are added to the set of artifacts watched on this connection.
+ * When a transaction for any watched artifact is canonized, the agent sends a
+ * \ref protocol_resp_artifact_notification with the offset of this request.
+ */
+typedef struct protocol_req_artifact_subscribe
+{
+    /** \brief this structure is disposable. */
+    disposable_t hdr;
+    /** \brief the protocol request id. */
+    uint32_t request_id;
+    /** \brief the offset. */
+    uint32_t offset;
+    /** \brief the number of artifact ids. */
+    uint32_t count;
+    /** \brief the artifact ids, owned by artifact_ids_buffer. */
+    vpr_uuid* artifact_ids;
+    /** \brief the buffer holding the artifact ids. */
+    vccrypt_buffer_t artifact_ids_buffer;
+} protocol_req_artifact_subscribe;
+
+/**
+ * \brief The decoded protocol response for an artifact subscription.
+ */
+typedef struct protocol_resp_artifact_subscribe
+{
+    /** \brief this structure is disposable. */
+    disposable_t hdr;
+    /** \brief the protocol request id. */
+    uint32_t request_id;
+    /** \brief the protocol request offset. */
+    uint32_t offset;
+    /** \brief the protocol response status. */
+    uint32_t status;
+} protocol_resp_artifact_subscribe;
+
+/**
+ * \brief The decoded protocol request for an artifact unsubscription.
+ *
+ * The artifacts are removed from the set of artifacts watched on this
+ * connection. If count is zero, then every artifact is removed.
+ */
+typedef struct protocol_req_artifact_unsubscribe
+{
+    /** \brief this structure is disposable. */
+    disposable_t hdr;
+    /** \brief the protocol request id. */
+    uint32_t request_id;
+    /** \brief the offset. */
+    uint32_t offset;
+    /** \brief the number of artifact ids. */
+    uint32_t count;
+    /** \brief the artifact ids, owned by artifact_ids_buffer. */
+    vpr_uuid* artifact_ids;
+    /** \brief the buffer holding the artifact ids. */
+    vccrypt_buffer_t artifact_ids_buffer;
+} protocol_req_artifact_unsubscribe;
+
+/**
+ * \brief The decoded protocol response for an artifact unsubscription.
+ */
+typedef struct protocol_resp_artifact_unsubscribe
+{
+    /** \brief this structure is disposable. */
+    disposable_t hdr;
+    /** \brief the protocol request id. */
+    uint32_t request_id;
+    /** \brief the protocol request offset. */
+    uint32_t offset;
+    /** \brief the protocol response status. */
+    uint32_t status;
+} protocol_resp_artifact_unsubscribe;
+
+/**
+ * \brief The decoded unsolicited notification for a canonized artifact
+ * transaction.
+ *
+ * The offset is that of the \ref protocol_req_artifact_subscribe request which
+ * added this artifact to the watched set.
+ */
+typedef struct protocol_resp_artifact_notification
+{
+    /** \brief this structure is disposable. */
+    disposable_t hdr;
+    /** \brief the protocol request id. */
+    uint32_t request_id;
+    /** \brief the protocol request offset. */
+    uint32_t offset;
+    /** \brief the protocol response status. */
+    uint32_t status;
+    /** \brief the artifact id. */
+    vpr_uuid artifact_id;
+    /** \brief the transaction id. */
+    vpr_uuid txn_id;
+    /** \brief the block id for the block in which this transaction was
+     * canonized. */
+    vpr_uuid block_id;
+    /** \brief the serialized transaction state. */
+    uint32_t txn_state;
+} protocol_resp_artifact_notification;
+
+/**
+ * \brief A single encoded request in a batch.
+ */
+typedef struct protocol_batch_item
+{
+    /** \brief the encoded request, owned by the decoded batch. */
+    const uint8_t* data;
+    /** \brief the size of the encoded request. */
+    size_t size;
+} protocol_batch_item;
+
+/**
+ * \brief A single encoded response in a batch response.
+ */
+typedef struct protocol_batch_resp_item
+{
+    /** \brief the status of this request. */
+    uint32_t status;
+    /** \brief the encoded response, owned by the decoded batch. */
+    const uint8_t* data;
+    /** \brief the size of the encoded response. */
+    size_t size;
+} protocol_batch_resp_item;
+
+/**
+ * \brief The decoded protocol request for a batch of requests.
+ *
+ * Each item is a complete encoded request with its own request id and offset,
+ * which can be decoded with the matching request decode function.
+ */
+typedef struct protocol_req_batch
+{
+    /** \brief this structure is disposable. */
+    disposable_t hdr;
+    /** \brief the protocol request id. */
+    uint32_t request_id;
+    /** \brief the offset. */
+    uint32_t offset;
+    /** \brief the number of requests in this batch. */
+    uint32_t count;
+    /** \brief the requests in this batch. */
+    protocol_batch_item* items;
+    /** \brief the buffer holding the item array. */
+    vccrypt_buffer_t items_buffer;
+    /** \brief the buffer holding the encoded requests. */
+    vccrypt_buffer_t body;
+} protocol_req_batch;
+
+/**
+ * \brief The decoded protocol response for a batch of requests.
+ *
+ * Each item holds the status of the matching request in the batch, along with
+ * its complete encoded response, which can be decoded with the matching
+ * response decode function.
+ */
+typedef struct protocol_resp_batch
+{
+    /** \brief this structure is disposable. */
+    disposable_t hdr;
+    /** \brief the protocol request id. */
+    uint32_t request_id;
+    /** \brief the protocol request offset. */
+    uint32_t offset;
+    /** \brief the protocol response status. */
+    uint32_t status;
+    /** \brief the number of responses in this batch. */
+    uint32_t count;
+    /** \brief the responses in this batch. */
+    protocol_batch_resp_item* items;
+    /** \brief the buffer holding the item array. */
+    vccrypt_buffer_t items_buffer;
+    /** \brief the buffer holding the encoded responses. */
+    vccrypt_buffer_t body;
+} protocol_resp_batch;
+
 /**
  * \brief The decoded protocol request for enabling the extended API for a given
  * entity.
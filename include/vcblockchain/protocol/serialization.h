@@ -10,6 +10,7 @@
 #define VCBLOCKCHAIN_PROTOCOL_SERIALIZATION_HEADER_GUARD
 
 #include <vcblockchain/protocol/data.h>
+#include <vcblockchain/psock.h>
 #include <vccrypt/suite.h>
 
 /* make this header C++ friendly. */
@@ -195,6 +196,112 @@ int vcblockchain_protocol_decode_resp_handshake_ack(
     protocol_resp_handshake_ack* resp,
     const void* payload, size_t payload_size);
 
+/**
+ * \brief Encode a handshake resume request using the given parameters.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded handshake packet.
+ * \param suite                     The crypto suite to use for this request.
+ * \param offset                    The offset for this request.
+ * \param client_id                 The client uuid for this request.
+ * \param client_key_nonce          The client key nonce for this request.
+ * \param ticket                    The resumption ticket issued by the agent
+ *                                  during a previous session.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * request.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the nonce has the wrong size or the
+ *        ticket is empty.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_req_handshake_resume(
+    vccrypt_buffer_t* buffer, vccrypt_suite_options_t* suite,
+    uint32_t offset, const vpr_uuid* client_id,
+    const vccrypt_buffer_t* client_key_nonce, const vccrypt_buffer_t* ticket);
+
+/**
+ * \brief Decode a handshake resume request using the given parameters.
+ *
+ * \param req                       The decoded request buffer.
+ * \param suite                     The crypto suite to use for this request.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p req structure is initialized with the decoded values.  The
+ * caller owns this structure and must \ref dispose() it when it is no longer
+ * needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE if the payload is
+ *        too small to hold a ticket.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the request id,
+ *        protocol version, or crypto suite is unexpected.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_decode_req_handshake_resume(
+    protocol_req_handshake_resume* req, vccrypt_suite_options_t* suite,
+    const void* payload, size_t payload_size);
+
+/**
+ * \brief Encode a handshake resume response using the given parameters.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded handshake response
+ *                                  packet.
+ * \param suite                     The crypto suite to use for this response.
+ * \param offset                    The offset for this response.
+ * \param status                    The status for this response.
+ * \param server_key_nonce          The agent key nonce.
+ * \param server_cr_hmac            The agent proof that it opened the ticket.
+ *
+ * A rejected resumption, such as for an expired ticket, is encoded with
+ * \ref vcblockchain_protocol_encode_error_resp instead, using
+ * \ref VCBLOCKCHAIN_ERROR_PROTOCOL_TICKET_REJECTED as its status, which tells
+ * the client to fall back to a full handshake.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * response.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_resp_handshake_resume(
+    vccrypt_buffer_t* buffer, vccrypt_suite_options_t* suite,
+    uint32_t offset, uint32_t status,
+    const vccrypt_buffer_t* server_key_nonce,
+    const vccrypt_buffer_t* server_cr_hmac);
+
+/**
+ * \brief Decode a handshake resume response using the given parameters.
+ *
+ * \param resp                      The decoded response buffer.
+ * \param suite                     The crypto suite to use for this request.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p resp structure is initialized with the decoded values.
+ * The caller owns this structure and must \ref dispose() it when it is no
+ * longer needed.
+ *
+ * If the agent rejected the ticket, then the response only holds a header, and
+ * the status from the response is returned.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - the status from the response if the agent rejected the ticket.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_decode_resp_handshake_resume(
+    protocol_resp_handshake_resume* resp, vccrypt_suite_options_t* suite,
+    const void* payload, size_t payload_size);
+
 /**
  * \brief Encode a latest block id get request.
  *
@@ -277,6 +384,99 @@ int vcblockchain_protocol_decode_resp_latest_block_id_get(
     protocol_resp_latest_block_id_get* resp,
     const void* payload, size_t payload_size);
 
+/**
+ * \brief Encode a conditional latest block id get request.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded request packet.
+ * \param alloc_opts                The allocator to use for this request.
+ * \param offset                    The offset to use for this request.
+ * \param timeout_ms                The maximum time in milliseconds that the
+ *                                  agent may hold this request open waiting
+ *                                  for a new block, or 0 to answer at once.
+ * \param block_id                  The latest block id known to the client.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * request.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_req_latest_block_id_get_if_changed(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, uint32_t timeout_ms, const vpr_uuid* block_id);
+
+/**
+ * \brief Decode a conditional latest block id get request.
+ *
+ * \param req                       The decoded request buffer.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p req structure is initialized with the decoded values. The
+ * caller owns this structure and must \ref dispose() it when it is no longer
+ * needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_decode_req_latest_block_id_get_if_changed(
+    protocol_req_latest_block_id_get_if_changed* req, const void* payload,
+    size_t payload_size);
+
+/**
+ * \brief Encode a conditional latest block id get response using the given
+ * parameters.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded response.
+ * \param alloc_opts                The allocator options to use to allocate the
+ *                                  buffer.
+ * \param offset                    The offset for this response.
+ * \param status                    The status for this response.
+ * \param block_id                  The latest block id, which may be NULL if
+ *                                  it was not modified.
+ *
+ * If the status is \ref VCBLOCKCHAIN_ERROR_PROTOCOL_NOT_MODIFIED, then the
+ * latest block id is the one sent by the client, so only the response header
+ * is encoded.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * response.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_resp_latest_block_id_get_if_changed(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, uint32_t status, const vpr_uuid* block_id);
+
+/**
+ * \brief Decode a conditional latest block id get response.
+ *
+ * \param resp                      The decoded response buffer.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p resp structure is initialized with the decoded values.
+ * The caller owns this structure and must \ref dispose() it when it is no
+ * longer needed. If the status is \ref
+ * VCBLOCKCHAIN_ERROR_PROTOCOL_NOT_MODIFIED, then the response only holds a
+ * header, and the block id is left zeroed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_decode_resp_latest_block_id_get_if_changed(
+    protocol_resp_latest_block_id_get_if_changed* resp,
+    const void* payload, size_t payload_size);
+
 /**
  * \brief Encode a transaction submit request.
  *
@@ -341,12 +541,1715 @@ int vcblockchain_protocol_decode_req_transaction_submit(
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-int vcblockchain_protocol_encode_resp_transaction_submit(
+int vcblockchain_protocol_encode_resp_transaction_submit(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, uint32_t status);
+
+/**
+ * \brief Decode a transaction submit response.
+ *
+ * \param resp                      The decoded response buffer.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p resp structure is initialized with the decoded values.
+ * The caller owns this structure and must \ref dispose() it when it is no
+ * longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_decode_resp_transaction_submit(
+    protocol_resp_transaction_submit* resp,
+    const void* payload, size_t payload_size);
+
+/**
+ * \brief Encode a transaction submit batch request.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded request packet.
+ * \param alloc_opts                The allocator to use for this request.
+ * \param offset                    The offset to use for this request.
+ * \param txns                      Array of transactions to submit.
+ * \param count                     The number of transactions to submit.
+ *
+ * Each transaction is written as a size-prefixed record holding its
+ * transaction id, artifact id, and certificate. The server answers with a
+ * single response holding the submit status of each transaction, in the same
+ * order.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * request.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the batch is empty, too large, or
+ *        holds a transaction without a certificate.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_req_transaction_submit_batch(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, const protocol_transaction_submit_batch_item* txns,
+    size_t count);
+
+/**
+ * \brief Encode a transaction submit batch request as a vector of segments
+ * that reference the caller's certificates.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the segment vector and the encoded
+ *                                  record headers.
+ * \param alloc_opts                The allocator to use for this request.
+ * \param offset                    The offset to use for this request.
+ * \param txns                      Array of transactions to submit.
+ * \param count                     The number of transactions to submit.
+ * \param vec                       Pointer to receive the segment vector.
+ * \param vec_count                 Pointer to receive the number of segments.
+ *
+ * This encodes the same request as
+ * \ref vcblockchain_protocol_encode_req_transaction_submit_batch, but without
+ * copying the certificates. Only the request header and the record header for
+ * each transaction are written to \p buffer; the segment vector interleaves
+ * these headers with the certificates in \p txns. The concatenation of every
+ * segment is the encoded request, which can be written with
+ * \ref psock_write_authed_datav.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the segment
+ * vector and the encoded headers, and \p vec points into this buffer. The
+ * caller owns this buffer and must \ref dispose() it when it is no longer
+ * needed. The certificates in \p txns must remain valid for as long as the
+ * segment vector is in use.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the batch is empty, too large, or
+ *        holds a transaction without a certificate.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_req_transaction_submit_batch_vec(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, const protocol_transaction_submit_batch_item* txns,
+    size_t count, const vcblockchain_psock_iovec** vec, size_t* vec_count);
+
+/**
+ * \brief Decode a transaction submit batch request.
+ *
+ * \param req                       The decoded request buffer.
+ * \param alloc_opts                The allocator to use for this request.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p req structure is initialized with the decoded values.
+ * Each item's certificate is owned by \p req. The caller owns this structure
+ * and must \ref dispose() it when it is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the payload is malformed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered.
+ */
+int vcblockchain_protocol_decode_req_transaction_submit_batch(
+    protocol_req_transaction_submit_batch* req,
+    allocator_options_t* alloc_opts, const void* payload, size_t payload_size);
+
+/**
+ * \brief Encode a transaction submit batch response using the given
+ * parameters.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded response.
+ * \param alloc_opts                The allocator options to use to allocate the
+ *                                  buffer.
+ * \param offset                    The offset for this response.
+ * \param status                    The status for this response.
+ * \param statuses                  Array holding the submit status of each
+ *                                  transaction, in batch order.
+ * \param count                     The number of transactions in the batch.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * response.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the batch is too large.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_resp_transaction_submit_batch(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, uint32_t status, const uint32_t* statuses, size_t count);
+
+/**
+ * \brief Decode a transaction submit batch response.
+ *
+ * \param resp                      The decoded response buffer.
+ * \param alloc_opts                The allocator to use for this response.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p resp structure is initialized with the decoded values.
+ * The status array is owned by \p resp. The caller owns this structure and
+ * must \ref dispose() it when it is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the payload is malformed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered.
+ */
+int vcblockchain_protocol_decode_resp_transaction_submit_batch(
+    protocol_resp_transaction_submit_batch* resp,
+    allocator_options_t* alloc_opts, const void* payload, size_t payload_size);
+
+/**
+ * \brief Encode a transaction submit and await request.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded request packet.
+ * \param alloc_opts                The allocator to use for this request.
+ * \param offset                    The offset to use for this request.
+ * \param timeout_ms                The maximum time in milliseconds to wait for
+ *                                  this transaction to be canonized, or 0 to
+ *                                  use the agent's default deadline.
+ * \param txn_id                    The id of this transaction.
+ * \param artifact_id               The artifact id of this transaction.
+ * \param cert                      Pointer to the certificate data for this
+ *                                  transaction.
+ * \param cert_size                 The size of this certificate in bytes.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * request.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_req_transaction_submit_await(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, uint32_t timeout_ms, const vpr_uuid* txn_id,
+    const vpr_uuid* artifact_id, const void* cert, size_t cert_size);
+
+/**
+ * \brief Decode a transaction submit and await request.
+ *
+ * \param req                       The decoded request buffer.
+ * \param alloc_opts                The allocator options to use.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p req structure is initialized with the decoded values. The
+ * caller owns this structure and must \ref dispose() it when it is no longer
+ * needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_decode_req_transaction_submit_await(
+    protocol_req_transaction_submit_await* req,
+    allocator_options_t* alloc_opts, const void* payload, size_t payload_size);
+
+/**
+ * \brief Encode a transaction submit and await response.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded response.
+ * \param alloc_opts                The allocator options to use to allocate the
+ *                                  buffer.
+ * \param offset                    The offset for this response.
+ * \param status                    The status for this response.
+ *
+ * This response acknowledges the submission. If it is successful, then a
+ * transaction canonized notification follows with the same offset once the
+ * transaction is canonized, or an error response if the deadline expires first.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * response.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_resp_transaction_submit_await(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, uint32_t status);
+
+/**
+ * \brief Decode a transaction submit and await response.
+ *
+ * \param resp                      The decoded response buffer.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p resp structure is initialized with the decoded values.
+ * The caller owns this structure and must \ref dispose() it when it is no
+ * longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_decode_resp_transaction_submit_await(
+    protocol_resp_transaction_submit_await* resp, const void* payload,
+    size_t payload_size);
+
+/**
+ * \brief Encode a transaction canonized notification for a transaction submit
+ * and await request.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded notification.
+ * \param alloc_opts                The allocator options to use to allocate the
+ *                                  buffer.
+ * \param offset                    The offset of the transaction submit and
+ *                                  await request.
+ * \param txn_id                    The canonized transaction id.
+ * \param block_id                  The block id for the block in which this
+ *                                  transaction was canonized.
+ * \param block_height              The height of this block.
+ *
+ * If the deadline for the request expires before the transaction is canonized,
+ * then the agent should instead use \ref
+ * vcblockchain_protocol_encode_error_resp to send an error response with the
+ * \ref PROTOCOL_REQ_ID_TRANSACTION_CANONIZED request id and a status of
+ * \ref VCBLOCKCHAIN_ERROR_PROTOCOL_CANONIZATION_EXPIRED.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * notification.  The caller owns this buffer and must \ref dispose() it when it
+ * is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_resp_transaction_canonized(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, const vpr_uuid* txn_id, const vpr_uuid* block_id,
+    uint64_t block_height);
+
+/**
+ * \brief Decode a transaction canonized notification.
+ *
+ * \param resp                      The decoded notification buffer.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p resp structure is initialized with the decoded values.
+ * The caller owns this structure and must \ref dispose() it when it is no
+ * longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_decode_resp_transaction_canonized(
+    protocol_resp_transaction_canonized* resp, const void* payload,
+    size_t payload_size);
+
+/**
+ * \brief Encode a block get request.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded request packet.
+ * \param alloc_opts                The allocator to use for this request.
+ * \param offset                    The offset to use for this request.
+ * \param block_id                  The id of block to get.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * request.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_req_block_get(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, const vpr_uuid* block_id);
+
+/**
+ * \brief Decode a block get request.
+ *
+ * \param req                       The decoded request buffer.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p req structure is initialized with the decoded values. The
+ * caller owns this structure and must \ref dispose() it when it is no longer
+ * needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_decode_req_block_get(
+    protocol_req_block_get* req, const void* payload, size_t payload_size);
+
+/**
+ * \brief Encode a block get response using the given parameters.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded response.
+ * \param alloc_opts                The allocator options to use to allocate the
+ *                                  buffer.
+ * \param offset                    The offset for this response.
+ * \param status                    The status for this response.
+ * \param block_id                  The block id.
+ * \param prev_block_id             The previous block id.
+ * \param next_block_id             The next block id.
+ * \param first_txn_id              The first transaction id in the block.
+ * \param block_height              The block height.
+ * \param ser_block_cert_size       The serialized block cert size.
+ * \param block_cert                Pointer to the start of the block
+ *                                  certificate.
+ * \param block_cert_size           The block cert size.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * response.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_resp_block_get(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, uint32_t status, const vpr_uuid* block_id,
+    const vpr_uuid* prev_block_id, const vpr_uuid* next_block_id,
+    const vpr_uuid* first_txn_id, uint64_t block_height,
+    uint64_t ser_block_cert_size, const void* block_cert,
+    size_t block_cert_size);
+
+/**
+ * \brief Decode a block get response.
+ *
+ * \param resp                      The decoded response buffer.
+ * \param alloc_opts                The allocator to use for this response.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p resp structure is initialized with the decoded values.
+ * The caller owns this structure and must \ref dispose() it when it is no
+ * longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_decode_resp_block_get(
+    protocol_resp_block_get* resp, allocator_options_t* alloc_opts,
+    const void* payload, size_t payload_size);
+
+/**
+ * \brief Encode a block get fields request.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded request packet.
+ * \param alloc_opts                The allocator to use for this request.
+ * \param offset                    The offset to use for this request.
+ * \param block_id                  The id of the block to get.
+ * \param field_mask                The \ref protocol_block_field values to
+ *                                  return.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * request.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the field mask has unknown bits.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_req_block_get_fields(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, const vpr_uuid* block_id, uint32_t field_mask);
+
+/**
+ * \brief Decode a block get fields request.
+ *
+ * \param req                       The decoded request buffer.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p req structure is initialized with the decoded values. The
+ * caller owns this structure and must \ref dispose() it when it is no longer
+ * needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the payload is malformed or the
+ *        field mask has unknown bits.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_decode_req_block_get_fields(
+    protocol_req_block_get_fields* req, const void* payload,
+    size_t payload_size);
+
+/**
+ * \brief Encode a block get fields response using the given parameters.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded response.
+ * \param alloc_opts                The allocator options to use to allocate the
+ *                                  buffer.
+ * \param offset                    The offset for this response.
+ * \param status                    The status for this response.
+ * \param field_mask                The \ref protocol_block_field values to
+ *                                  encode.
+ * \param block_id                  The block id.
+ * \param prev_block_id             The previous block id.
+ * \param next_block_id             The next block id.
+ * \param first_txn_id              The first transaction id in this block.
+ * \param block_height              The block height.
+ * \param block_cert                Pointer to the start of the block
+ *                                  certificate.
+ * \param block_cert_size           The block cert size.
+ *
+ * Only the fields in \p field_mask are encoded; the pointers for the remaining
+ * fields may be NULL.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * response.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the field mask has unknown bits or
+ *        a requested field is NULL.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_resp_block_get_fields(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, uint32_t status, uint32_t field_mask,
+    const vpr_uuid* block_id, const vpr_uuid* prev_block_id,
+    const vpr_uuid* next_block_id, const vpr_uuid* first_txn_id,
+    uint64_t block_height, const void* block_cert, size_t block_cert_size);
+
+/**
+ * \brief Decode a block get fields response.
+ *
+ * \param resp                      The decoded response buffer.
+ * \param alloc_opts                The allocator to use for this response.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p resp structure is initialized with the decoded values.
+ * Fields not present in the response field mask are zeroed. The caller owns
+ * this structure and must \ref dispose() it when it is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the payload is malformed or the
+ *        field mask has unknown bits.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_decode_resp_block_get_fields(
+    protocol_resp_block_get_fields* resp, allocator_options_t* alloc_opts,
+    const void* payload, size_t payload_size);
+
+/**
+ * \brief Encode a block range get request.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded request packet.
+ * \param alloc_opts                The allocator to use for this request.
+ * \param offset                    The offset to use for this request.
+ * \param start_height              The height of the first block to get.
+ * \param count                     The maximum number of blocks to get.
+ * \param max_bytes                 The maximum number of bytes of block data
+ *                                  to return, or 0 to leave this up to the
+ *                                  server.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * request.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if \p count is zero.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_req_block_range_get(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, uint64_t start_height, uint32_t count,
+    uint32_t max_bytes);
+
+/**
+ * \brief Decode a block range get request.
+ *
+ * \param req                       The decoded request buffer.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p req structure is initialized with the decoded values. The
+ * caller owns this structure and must \ref dispose() it when it is no longer
+ * needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_decode_req_block_range_get(
+    protocol_req_block_range_get* req, const void* payload,
+    size_t payload_size);
+
+/**
+ * \brief Encode a block range get response using the given parameters.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded response.
+ * \param alloc_opts                The allocator options to use to allocate the
+ *                                  buffer.
+ * \param offset                    The offset for this response.
+ * \param status                    The status for this response.
+ * \param flags                     The \ref protocol_block_range_flag values
+ *                                  for this response.
+ * \param next_height               The height of the block following the last
+ *                                  block in this response.
+ * \param records                   Array of consecutive blocks to return.
+ * \param count                     The number of blocks to return.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * response.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the blocks don't fit in a single
+ *        packet.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_resp_block_range_get(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, uint32_t status, uint32_t flags, uint64_t next_height,
+    const protocol_block_range_record* records, size_t count);
+
+/**
+ * \brief Decode a block range get response.
+ *
+ * \param resp                      The decoded response buffer.
+ * \param alloc_opts                The allocator to use for this response.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p resp structure is initialized with the decoded values.
+ * Each record's block certificate is owned by \p resp. The caller owns this
+ * structure and must \ref dispose() it when it is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the payload is malformed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered.
+ */
+int vcblockchain_protocol_decode_resp_block_range_get(
+    protocol_resp_block_range_get* resp, allocator_options_t* alloc_opts,
+    const void* payload, size_t payload_size);
+
+/**
+ * \brief Encode a block transaction ids get request.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded request packet.
+ * \param alloc_opts                The allocator to use for this request.
+ * \param offset                    The offset to use for this request.
+ * \param block_id                  The block id.
+ * \param include_states            Set to true to return the state of each
+ *                                  transaction.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * request.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_req_block_txn_ids_get(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, const vpr_uuid* block_id, bool include_states);
+
+/**
+ * \brief Decode a block transaction ids get request.
+ *
+ * \param req                       The decoded request buffer.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p req structure is initialized with the decoded values. The
+ * caller owns this structure and must \ref dispose() it when it is no longer
+ * needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_decode_req_block_txn_ids_get(
+    protocol_req_block_txn_ids_get* req, const void* payload,
+    size_t payload_size);
+
+/**
+ * \brief Encode a block transaction ids get response using the given
+ * parameters.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded response.
+ * \param alloc_opts                The allocator options to use to allocate the
+ *                                  buffer.
+ * \param offset                    The offset for this response.
+ * \param status                    The status for this response.
+ * \param txn_ids                   Array of transaction ids, in block order.
+ * \param txn_states                Array of transaction states, in block order,
+ *                                  or NULL to omit transaction states.
+ * \param count                     The number of transactions in the block.
+ *
+ * The transaction ids are packed back to back, followed by the transaction
+ * states if \p txn_states is not NULL.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * response.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the transaction ids don't fit in a
+ *        single packet.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_resp_block_txn_ids_get(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, uint32_t status, const vpr_uuid* txn_ids,
+    const uint32_t* txn_states, size_t count);
+
+/**
+ * \brief Decode a block transaction ids get response.
+ *
+ * \param resp                      The decoded response buffer.
+ * \param alloc_opts                The allocator to use for this response.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p resp structure is initialized with the decoded values.
+ * The transaction id and state arrays are owned by \p resp. The caller owns
+ * this structure and must \ref dispose() it when it is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - the status from the response if the request failed.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE if the payload
+ *        has the wrong size.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the payload is not a
+ *        block transaction ids get response.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered.
+ */
+int vcblockchain_protocol_decode_resp_block_txn_ids_get(
+    protocol_resp_block_txn_ids_get* resp, allocator_options_t* alloc_opts,
+    const void* payload, size_t payload_size);
+
+/**
+ * \brief Encode a block next id get request.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded request packet.
+ * \param alloc_opts                The allocator to use for this request.
+ * \param offset                    The offset to use for this request.
+ * \param block_id                  The id of block to get.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * request.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_req_block_next_id_get(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, const vpr_uuid* block_id);
+
+/**
+ * \brief Decode a block next id get request.
+ *
+ * \param req                       The decoded request buffer.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p req structure is initialized with the decoded values. The
+ * caller owns this structure and must \ref dispose() it when it is no longer
+ * needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_decode_req_block_next_id_get(
+    protocol_req_block_next_id_get* req, const void* payload,
+    size_t payload_size);
+
+/**
+ * \brief Encode a block next id get response using the given parameters.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded response.
+ * \param alloc_opts                The allocator options to use to allocate the
+ *                                  buffer.
+ * \param offset                    The offset for this response.
+ * \param status                    The status for this response.
+ * \param next_block_id             The next block id.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * response.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_resp_block_next_id_get(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, uint32_t status, const vpr_uuid* next_block_id);
+
+/**
+ * \brief Decode a block next id get response.
+ *
+ * \param resp                      The decoded response buffer.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p resp structure is initialized with the decoded values.
+ * The caller owns this structure and must \ref dispose() it when it is no
+ * longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_decode_resp_block_next_id_get(
+    protocol_resp_block_next_id_get* resp, const void* payload,
+    size_t payload_size);
+
+/**
+ * \brief Encode a block prev id get request.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded request packet.
+ * \param alloc_opts                The allocator to use for this request.
+ * \param offset                    The offset to use for this request.
+ * \param block_id                  The id of block to get.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * request.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_req_block_prev_id_get(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, const vpr_uuid* block_id);
+
+/**
+ * \brief Decode a block prev id get request.
+ *
+ * \param req                       The decoded request buffer.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p req structure is initialized with the decoded values. The
+ * caller owns this structure and must \ref dispose() it when it is no longer
+ * needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_decode_req_block_prev_id_get(
+    protocol_req_block_prev_id_get* req, const void* payload,
+    size_t payload_size);
+
+/**
+ * \brief Encode a block prev id get response using the given parameters.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded response.
+ * \param alloc_opts                The allocator options to use to allocate the
+ *                                  buffer.
+ * \param offset                    The offset for this response.
+ * \param status                    The status for this response.
+ * \param prev_block_id             The prev block id.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * response.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_resp_block_prev_id_get(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, uint32_t status, const vpr_uuid* prev_block_id);
+
+/**
+ * \brief Decode a block prev id get response.
+ *
+ * \param resp                      The decoded response buffer.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p resp structure is initialized with the decoded values.
+ * The caller owns this structure and must \ref dispose() it when it is no
+ * longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_decode_resp_block_prev_id_get(
+    protocol_resp_block_prev_id_get* resp, const void* payload,
+    size_t payload_size);
+
+/**
+ * \brief Encode an artifact first txn id get request.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded request packet.
+ * \param alloc_opts                The allocator to use for this request.
+ * \param offset                    The offset to use for this request.
+ * \param artifact_id               The id of artifact to get.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * request.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_req_artifact_first_txn_id_get(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, const vpr_uuid* artifact_id);
+
+/**
+ * \brief Decode an artifact first txn id get request.
+ *
+ * \param req                       The decoded request buffer.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p req structure is initialized with the decoded values. The
+ * caller owns this structure and must \ref dispose() it when it is no longer
+ * needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_decode_req_artifact_first_txn_id_get(
+    protocol_req_artifact_first_txn_id_get* req, const void* payload,
+    size_t payload_size);
+
+/**
+ * \brief Encode an artifact first txn id get response using the given
+ * parameters.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded response.
+ * \param alloc_opts                The allocator options to use to allocate the
+ *                                  buffer.
+ * \param offset                    The offset for this response.
+ * \param status                    The status for this response.
+ * \param first_txn_id              The first transaction id.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * response.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_resp_artifact_first_txn_id_get(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, uint32_t status, const vpr_uuid* first_txn_id);
+
+/**
+ * \brief Decode an artifact first txn id get response.
+ *
+ * \param resp                      The decoded response buffer.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p resp structure is initialized with the decoded values.
+ * The caller owns this structure and must \ref dispose() it when it is no
+ * longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_decode_resp_artifact_first_txn_id_get(
+    protocol_resp_artifact_first_txn_id_get* resp, const void* payload,
+    size_t payload_size);
+
+/**
+ * \brief Encode an artifact last txn id get request.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded request packet.
+ * \param alloc_opts                The allocator to use for this request.
+ * \param offset                    The offset to use for this request.
+ * \param artifact_id               The id of artifact to get.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * request.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_req_artifact_last_txn_id_get(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, const vpr_uuid* artifact_id);
+
+/**
+ * \brief Decode an artifact last txn id get request.
+ *
+ * \param req                       The decoded request buffer.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p req structure is initialized with the decoded values. The
+ * caller owns this structure and must \ref dispose() it when it is no longer
+ * needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_decode_req_artifact_last_txn_id_get(
+    protocol_req_artifact_last_txn_id_get* req, const void* payload,
+    size_t payload_size);
+
+/**
+ * \brief Encode an artifact last txn id get response using the given
+ * parameters.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded response.
+ * \param alloc_opts                The allocator options to use to allocate the
+ *                                  buffer.
+ * \param offset                    The offset for this response.
+ * \param status                    The status for this response.
+ * \param last_txn_id               The last transaction id.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * response.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_resp_artifact_last_txn_id_get(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, uint32_t status, const vpr_uuid* last_txn_id);
+
+/**
+ * \brief Decode an artifact last txn id get response.
+ *
+ * \param resp                      The decoded response buffer.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p resp structure is initialized with the decoded values.
+ * The caller owns this structure and must \ref dispose() it when it is no
+ * longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_decode_resp_artifact_last_txn_id_get(
+    protocol_resp_artifact_last_txn_id_get* resp, const void* payload,
+    size_t payload_size);
+
+/**
+ * \brief Encode a conditional artifact last txn id get request.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded request packet.
+ * \param alloc_opts                The allocator to use for this request.
+ * \param offset                    The offset to use for this request.
+ * \param timeout_ms                The maximum time in milliseconds that the
+ *                                  agent may hold this request open waiting
+ *                                  for a new transaction, or 0 to answer at
+ *                                  once.
+ * \param artifact_id               The id of the artifact to get.
+ * \param last_txn_id               The last transaction id for this artifact
+ *                                  known to the client.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * request.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_req_artifact_last_txn_id_get_if_changed(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, uint32_t timeout_ms, const vpr_uuid* artifact_id,
+    const vpr_uuid* last_txn_id);
+
+/**
+ * \brief Decode a conditional artifact last txn id get request.
+ *
+ * \param req                       The decoded request buffer.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p req structure is initialized with the decoded values. The
+ * caller owns this structure and must \ref dispose() it when it is no longer
+ * needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_decode_req_artifact_last_txn_id_get_if_changed(
+    protocol_req_artifact_last_txn_id_get_if_changed* req, const void* payload,
+    size_t payload_size);
+
+/**
+ * \brief Encode a conditional artifact last txn id get response using the given
+ * parameters.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded response.
+ * \param alloc_opts                The allocator options to use to allocate the
+ *                                  buffer.
+ * \param offset                    The offset for this response.
+ * \param status                    The status for this response.
+ * \param last_txn_id               The last transaction id, which may be NULL
+ *                                  if it was not modified.
+ *
+ * If the status is \ref VCBLOCKCHAIN_ERROR_PROTOCOL_NOT_MODIFIED, then the
+ * last transaction id is the one sent by the client, so only the response
+ * header is encoded.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * response.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_resp_artifact_last_txn_id_get_if_changed(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, uint32_t status, const vpr_uuid* last_txn_id);
+
+/**
+ * \brief Decode a conditional artifact last txn id get response.
+ *
+ * \param resp                      The decoded response buffer.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p resp structure is initialized with the decoded values.
+ * The caller owns this structure and must \ref dispose() it when it is no
+ * longer needed. If the status is \ref
+ * VCBLOCKCHAIN_ERROR_PROTOCOL_NOT_MODIFIED, then the response only holds a
+ * header, and the last transaction id is left zeroed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_decode_resp_artifact_last_txn_id_get_if_changed(
+    protocol_resp_artifact_last_txn_id_get_if_changed* resp,
+    const void* payload, size_t payload_size);
+
+/**
+ * \brief Encode an artifact transaction page get request.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded request packet.
+ * \param alloc_opts                The allocator to use for this request.
+ * \param offset                    The offset to use for this request.
+ * \param artifact_id               The artifact id.
+ * \param cursor_txn_id             The page starts after this transaction. If
+ *                                  this is the zero uuid, then the page starts
+ *                                  at the first transaction in \p direction.
+ * \param direction                 The \ref protocol_txn_page_direction for
+ *                                  this page.
+ * \param page_size                 The maximum number of transactions to
+ *                                  return.
+ * \param include_certs             Set to true to return the transaction
+ *                                  certificates.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * request.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if \p direction is unknown or
+ *        \p page_size is zero.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_req_artifact_txn_page_get(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, const vpr_uuid* artifact_id,
+    const vpr_uuid* cursor_txn_id, uint32_t direction, uint32_t page_size,
+    bool include_certs);
+
+/**
+ * \brief Decode an artifact transaction page get request.
+ *
+ * \param req                       The decoded request buffer.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p req structure is initialized with the decoded values. The
+ * caller owns this structure and must \ref dispose() it when it is no longer
+ * needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the direction is unknown or the
+ *        page size is zero.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_decode_req_artifact_txn_page_get(
+    protocol_req_artifact_txn_page_get* req, const void* payload,
+    size_t payload_size);
+
+/**
+ * \brief Encode an artifact transaction page get response using the given
+ * parameters.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded response.
+ * \param alloc_opts                The allocator options to use to allocate the
+ *                                  buffer.
+ * \param offset                    The offset for this response.
+ * \param status                    The status for this response.
+ * \param flags                     The \ref protocol_txn_page_flag values for
+ *                                  this response.
+ * \param next_cursor               The cursor to use to request the next page,
+ *                                  which is the id of the last transaction in
+ *                                  this page.
+ * \param records                   Array of transactions in this page.
+ * \param count                     The number of transactions in this page.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * response.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the page doesn't fit in a single
+ *        packet.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_resp_artifact_txn_page_get(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, uint32_t status, uint32_t flags,
+    const vpr_uuid* next_cursor,
+    const protocol_txn_page_record* records, size_t count);
+
+/**
+ * \brief Decode an artifact transaction page get response.
+ *
+ * \param resp                      The decoded response buffer.
+ * \param alloc_opts                The allocator to use for this response.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p resp structure is initialized with the decoded values.
+ * Each record's transaction certificate is owned by \p resp. The caller owns
+ * this structure and must \ref dispose() it when it is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - the status from the response if the request failed.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE if the payload
+ *        has the wrong size.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the payload is not an
+ *        artifact transaction page get response.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered.
+ */
+int vcblockchain_protocol_decode_resp_artifact_txn_page_get(
+    protocol_resp_artifact_txn_page_get* resp, allocator_options_t* alloc_opts,
+    const void* payload, size_t payload_size);
+
+/**
+ * \brief Encode an artifact latest txn get request.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded request packet.
+ * \param alloc_opts                The allocator to use for this request.
+ * \param offset                    The offset to use for this request.
+ * \param artifact_id               The id of artifact to get.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * request.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_req_artifact_latest_txn_get(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, const vpr_uuid* artifact_id);
+
+/**
+ * \brief Decode an artifact latest txn get request.
+ *
+ * \param req                       The decoded request buffer.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p req structure is initialized with the decoded values. The
+ * caller owns this structure and must \ref dispose() it when it is no longer
+ * needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_decode_req_artifact_latest_txn_get(
+    protocol_req_artifact_latest_txn_get* req, const void* payload,
+    size_t payload_size);
+
+/**
+ * \brief Encode an artifact latest transaction get response using the given
+ * parameters.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded response.
+ * \param alloc_opts                The allocator options to use to allocate the
+ *                                  buffer.
+ * \param offset                    The offset for this response.
+ * \param status                    The status for this response.
+ * \param txn_id                    The latest transaction id.
+ * \param prev_txn_id               The previous transaction id.
+ * \param next_txn_id               The next transaction id.
+ * \param artifact_id               The artifact id for this transaction.
+ * \param block_id                  The block id for this transaction.
+ * \param ser_txn_cert_size         The serialized transaction cert size.
+ * \param txn_cert                  Pointer to the start of the transaction
+ *                                  certificate.
+ * \param txn_cert_size             The transaction cert size.
+ * \param txn_state                 The transaction state.
+ *
+ * This response has the same layout as a transaction get response, apart from
+ * its request id.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * response.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_resp_artifact_latest_txn_get(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, uint32_t status, const vpr_uuid* txn_id,
+    const vpr_uuid* prev_txn_id, const vpr_uuid* next_txn_id,
+    const vpr_uuid* artifact_id, const vpr_uuid* block_id,
+    uint64_t ser_txn_cert_size, const void* txn_cert, size_t txn_cert_size,
+    uint32_t txn_state);
+
+/**
+ * \brief Decode an artifact latest transaction get response.
+ *
+ * \param resp                      The decoded response buffer.
+ * \param alloc_opts                The allocator to use for this response.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * This response has the same layout as a transaction get response, so it is
+ * decoded into a \ref protocol_resp_txn_get. The request_id field of \p resp
+ * holds \ref PROTOCOL_REQ_ID_ARTIFACT_LATEST_TXN_GET.
+ *
+ * On success, the \p resp structure is initialized with the decoded values.
+ * The caller owns this structure and must \ref dispose() it when it is no
+ * longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_decode_resp_artifact_latest_txn_get(
+    protocol_resp_txn_get* resp, allocator_options_t* alloc_opts,
+    const void* payload, size_t payload_size);
+
+/**
+ * \brief Encode a transaction get request.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded request packet.
+ * \param alloc_opts                The allocator to use for this request.
+ * \param offset                    The offset to use for this request.
+ * \param txn_id                    The id of transaction to get.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * request.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_req_txn_get(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, const vpr_uuid* txn_id);
+
+/**
+ * \brief Decode a transaction get request.
+ *
+ * \param req                       The decoded request buffer.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p req structure is initialized with the decoded values. The
+ * caller owns this structure and must \ref dispose() it when it is no longer
+ * needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_decode_req_txn_get(
+    protocol_req_txn_get* req, const void* payload, size_t payload_size);
+
+/**
+ * \brief Encode a transaction get response using the given parameters.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded response.
+ * \param alloc_opts                The allocator options to use to allocate the
+ *                                  buffer.
+ * \param offset                    The offset for this response.
+ * \param status                    The status for this response.
+ * \param txn_id                    The transaction id.
+ * \param prev_txn_id               The previous transaction id.
+ * \param next_txn_id               The next transaction id.
+ * \param artifact_id               The artifact id for this transaction.
+ * \param block_id                  The block id for this transaction.
+ * \param ser_txn_cert_size         The serialized transaction cert size.
+ * \param txn_cert                  Pointer to the start of the transaction
+ *                                  certificate.
+ * \param txn_cert_size             The transaction cert size.
+ * \param txn_state                 The transaction state.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * response.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_resp_txn_get(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, uint32_t status, const vpr_uuid* txn_id,
+    const vpr_uuid* prev_txn_id, const vpr_uuid* next_txn_id,
+    const vpr_uuid* artifact_id, const vpr_uuid* block_id,
+    uint64_t ser_txn_cert_size, const void* txn_cert, size_t txn_cert_size,
+    uint32_t txn_state);
+
+/**
+ * \brief Decode a transaction get response.
+ *
+ * \param resp                      The decoded response buffer.
+ * \param alloc_opts                The allocator to use for this response.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p resp structure is initialized with the decoded values.
+ * The caller owns this structure and must \ref dispose() it when it is no
+ * longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_decode_resp_txn_get(
+    protocol_resp_txn_get* resp, allocator_options_t* alloc_opts,
+    const void* payload, size_t payload_size);
+
+/**
+ * \brief Encode a transaction get fields request.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded request packet.
+ * \param alloc_opts                The allocator to use for this request.
+ * \param offset                    The offset to use for this request.
+ * \param txn_id                    The id of transaction to get.
+ * \param field_mask                The \ref protocol_txn_field values to
+ *                                  return.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * request.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the field mask has unknown bits.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_req_txn_get_fields(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, const vpr_uuid* txn_id, uint32_t field_mask);
+
+/**
+ * \brief Decode a transaction get fields request.
+ *
+ * \param req                       The decoded request buffer.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p req structure is initialized with the decoded values. The
+ * caller owns this structure and must \ref dispose() it when it is no longer
+ * needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the payload is malformed or the
+ *        field mask has unknown bits.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_decode_req_txn_get_fields(
+    protocol_req_txn_get_fields* req, const void* payload, size_t payload_size);
+
+/**
+ * \brief Encode a transaction get fields response using the given parameters.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded response.
+ * \param alloc_opts                The allocator options to use to allocate the
+ *                                  buffer.
+ * \param offset                    The offset for this response.
+ * \param status                    The status for this response.
+ * \param field_mask                The \ref protocol_txn_field values to
+ *                                  encode.
+ * \param txn_id                    The transaction id.
+ * \param prev_txn_id               The previous transaction id.
+ * \param next_txn_id               The next transaction id.
+ * \param artifact_id               The artifact id for this transaction.
+ * \param block_id                  The block id for this transaction.
+ * \param txn_state                 The transaction state.
+ * \param txn_cert                  Pointer to the start of the transaction
+ *                                  certificate.
+ * \param txn_cert_size             The transaction cert size.
+ *
+ * Only the fields in \p field_mask are encoded; the pointers for the remaining
+ * fields may be NULL.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * response.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the field mask has unknown bits or
+ *        a requested field is NULL.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_resp_txn_get_fields(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, uint32_t status, uint32_t field_mask,
+    const vpr_uuid* txn_id, const vpr_uuid* prev_txn_id,
+    const vpr_uuid* next_txn_id, const vpr_uuid* artifact_id,
+    const vpr_uuid* block_id, uint32_t txn_state, const void* txn_cert,
+    size_t txn_cert_size);
+
+/**
+ * \brief Decode a transaction get fields response.
+ *
+ * \param resp                      The decoded response buffer.
+ * \param alloc_opts                The allocator to use for this response.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p resp structure is initialized with the decoded values.
+ * Fields not present in the response field mask are zeroed. The caller owns
+ * this structure and must \ref dispose() it when it is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the payload is malformed or the
+ *        field mask has unknown bits.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_decode_resp_txn_get_fields(
+    protocol_resp_txn_get_fields* resp, allocator_options_t* alloc_opts,
+    const void* payload, size_t payload_size);
+
+/**
+ * \brief Encode a block id by height get request.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded request packet.
+ * \param alloc_opts                The allocator to use for this request.
+ * \param offset                    The offset to use for this request.
+ * \param height                    The block height of block id to get.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * request.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_req_block_id_by_height_get(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, uint64_t height);
+
+/**
+ * \brief Decode a block id by height get request.
+ *
+ * \param req                       The decoded request buffer.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p req structure is initialized with the decoded values. The
+ * caller owns this structure and must \ref dispose() it when it is no longer
+ * needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_decode_req_block_id_by_height_get(
+    protocol_req_block_id_by_height_get* req, const void* payload,
+    size_t payload_size);
+
+/**
+ * \brief Encode a block id by height get response using the given parameters.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded response.
+ * \param alloc_opts                The allocator options to use to allocate the
+ *                                  buffer.
+ * \param offset                    The offset for this response.
+ * \param status                    The status for this response.
+ * \param block_id                  The block id.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * response.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_resp_block_id_by_height_get(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, uint32_t status, const vpr_uuid* block_id);
+
+/**
+ * \brief Decode a block id by height get response.
+ *
+ * \param resp                      The decoded response buffer.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p resp structure is initialized with the decoded values.
+ * The caller owns this structure and must \ref dispose() it when it is no
+ * longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_decode_resp_block_id_by_height_get(
+    protocol_resp_block_id_by_height_get* resp, const void* payload,
+    size_t payload_size);
+
+/**
+ * \brief Encode a transaction next id get request.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded request packet.
+ * \param alloc_opts                The allocator to use for this request.
+ * \param offset                    The offset to use for this request.
+ * \param txn_id                    The id of txn to get.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * request.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_req_txn_next_id_get(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, const vpr_uuid* txn_id);
+
+/**
+ * \brief Decode a transaction next id get request.
+ *
+ * \param req                       The decoded request buffer.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p req structure is initialized with the decoded values. The
+ * caller owns this structure and must \ref dispose() it when it is no longer
+ * needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_decode_req_txn_next_id_get(
+    protocol_req_txn_next_id_get* req, const void* payload,
+    size_t payload_size);
+
+/**
+ * \brief Encode a transaction next id get response using the given parameters.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded response.
+ * \param alloc_opts                The allocator options to use to allocate the
+ *                                  buffer.
+ * \param offset                    The offset for this response.
+ * \param status                    The status for this response.
+ * \param next_txn_id               The next txn id.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * response.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_resp_txn_next_id_get(
     vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
-    uint32_t offset, uint32_t status);
+    uint32_t offset, uint32_t status, const vpr_uuid* next_txn_id);
 
 /**
- * \brief Decode a transaction submit response.
+ * \brief Decode a transaction next id get response.
  *
  * \param resp                      The decoded response buffer.
  * \param payload                   Pointer to the payload to decode.
@@ -360,18 +2263,18 @@ int vcblockchain_protocol_encode_resp_transaction_submit(
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-int vcblockchain_protocol_decode_resp_transaction_submit(
-    protocol_resp_transaction_submit* resp,
-    const void* payload, size_t payload_size);
+int vcblockchain_protocol_decode_resp_txn_next_id_get(
+    protocol_resp_txn_next_id_get* resp, const void* payload,
+    size_t payload_size);
 
 /**
- * \brief Encode a block get request.
+ * \brief Encode a transaction prev id get request.
  *
  * \param buffer                    Pointer to an uninitialized buffer to
  *                                  receive the encoded request packet.
  * \param alloc_opts                The allocator to use for this request.
  * \param offset                    The offset to use for this request.
- * \param block_id                  The id of block to get.
+ * \param txn_id                    The id of txn to get.
  *
  * On success, the \p buffer is initialized with a buffer holding the encoded
  * request.  The caller owns this buffer and must \ref dispose() it when it is
@@ -381,12 +2284,12 @@ int vcblockchain_protocol_decode_resp_transaction_submit(
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-int vcblockchain_protocol_encode_req_block_get(
+int vcblockchain_protocol_encode_req_txn_prev_id_get(
     vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
-    uint32_t offset, const vpr_uuid* block_id);
+    uint32_t offset, const vpr_uuid* txn_id);
 
 /**
- * \brief Decode a block get request.
+ * \brief Decode a transaction prev id get request.
  *
  * \param req                       The decoded request buffer.
  * \param payload                   Pointer to the payload to decode.
@@ -400,11 +2303,12 @@ int vcblockchain_protocol_encode_req_block_get(
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-int vcblockchain_protocol_decode_req_block_get(
-    protocol_req_block_get* req, const void* payload, size_t payload_size);
+int vcblockchain_protocol_decode_req_txn_prev_id_get(
+    protocol_req_txn_prev_id_get* req, const void* payload,
+    size_t payload_size);
 
 /**
- * \brief Encode a block get response using the given parameters.
+ * \brief Encode a transaction prev id get response using the given parameters.
  *
  * \param buffer                    Pointer to an uninitialized buffer to
  *                                  receive the encoded response.
@@ -412,15 +2316,7 @@ int vcblockchain_protocol_decode_req_block_get(
  *                                  buffer.
  * \param offset                    The offset for this response.
  * \param status                    The status for this response.
- * \param block_id                  The block id.
- * \param prev_block_id             The previous block id.
- * \param next_block_id             The next block id.
- * \param first_txn_id              The first transaction id in the block.
- * \param block_height              The block height.
- * \param ser_block_cert_size       The serialized block cert size.
- * \param block_cert                Pointer to the start of the block
- *                                  certificate.
- * \param block_cert_size           The block cert size.
+ * \param prev_txn_id               The prev txn id.
  *
  * On success, the \p buffer is initialized with a buffer holding the encoded
  * response.  The caller owns this buffer and must \ref dispose() it when it is
@@ -430,19 +2326,14 @@ int vcblockchain_protocol_decode_req_block_get(
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-int vcblockchain_protocol_encode_resp_block_get(
+int vcblockchain_protocol_encode_resp_txn_prev_id_get(
     vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
-    uint32_t offset, uint32_t status, const vpr_uuid* block_id,
-    const vpr_uuid* prev_block_id, const vpr_uuid* next_block_id,
-    const vpr_uuid* first_txn_id, uint64_t block_height,
-    uint64_t ser_block_cert_size, const void* block_cert,
-    size_t block_cert_size);
+    uint32_t offset, uint32_t status, const vpr_uuid* prev_txn_id);
 
 /**
- * \brief Decode a block get response.
+ * \brief Decode a transaction prev id get response.
  *
  * \param resp                      The decoded response buffer.
- * \param alloc_opts                The allocator to use for this response.
  * \param payload                   Pointer to the payload to decode.
  * \param payload_size              Size of the payload.
  *
@@ -454,18 +2345,18 @@ int vcblockchain_protocol_encode_resp_block_get(
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-int vcblockchain_protocol_decode_resp_block_get(
-    protocol_resp_block_get* resp, allocator_options_t* alloc_opts,
-    const void* payload, size_t payload_size);
+int vcblockchain_protocol_decode_resp_txn_prev_id_get(
+    protocol_resp_txn_prev_id_get* resp, const void* payload,
+    size_t payload_size);
 
 /**
- * \brief Encode a block next id get request.
+ * \brief Encode a transaction block id get request.
  *
  * \param buffer                    Pointer to an uninitialized buffer to
  *                                  receive the encoded request packet.
  * \param alloc_opts                The allocator to use for this request.
  * \param offset                    The offset to use for this request.
- * \param block_id                  The id of block to get.
+ * \param txn_id                    The id of txn to get.
  *
  * On success, the \p buffer is initialized with a buffer holding the encoded
  * request.  The caller owns this buffer and must \ref dispose() it when it is
@@ -475,12 +2366,12 @@ int vcblockchain_protocol_decode_resp_block_get(
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-int vcblockchain_protocol_encode_req_block_next_id_get(
+int vcblockchain_protocol_encode_req_txn_block_id_get(
     vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
-    uint32_t offset, const vpr_uuid* block_id);
+    uint32_t offset, const vpr_uuid* txn_id);
 
 /**
- * \brief Decode a block next id get request.
+ * \brief Decode a transaction block id get request.
  *
  * \param req                       The decoded request buffer.
  * \param payload                   Pointer to the payload to decode.
@@ -494,12 +2385,12 @@ int vcblockchain_protocol_encode_req_block_next_id_get(
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-int vcblockchain_protocol_decode_req_block_next_id_get(
-    protocol_req_block_next_id_get* req, const void* payload,
+int vcblockchain_protocol_decode_req_txn_block_id_get(
+    protocol_req_txn_block_id_get* req, const void* payload,
     size_t payload_size);
 
 /**
- * \brief Encode a block next id get response using the given parameters.
+ * \brief Encode a transaction block id get response using the given parameters.
  *
  * \param buffer                    Pointer to an uninitialized buffer to
  *                                  receive the encoded response.
@@ -507,7 +2398,7 @@ int vcblockchain_protocol_decode_req_block_next_id_get(
  *                                  buffer.
  * \param offset                    The offset for this response.
  * \param status                    The status for this response.
- * \param next_block_id             The next block id.
+ * \param block_id                  The block id.
  *
  * On success, the \p buffer is initialized with a buffer holding the encoded
  * response.  The caller owns this buffer and must \ref dispose() it when it is
@@ -517,12 +2408,12 @@ int vcblockchain_protocol_decode_req_block_next_id_get(
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-int vcblockchain_protocol_encode_resp_block_next_id_get(
+int vcblockchain_protocol_encode_resp_txn_block_id_get(
     vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
-    uint32_t offset, uint32_t status, const vpr_uuid* next_block_id);
+    uint32_t offset, uint32_t status, const vpr_uuid* block_id);
 
 /**
- * \brief Decode a block next id get response.
+ * \brief Decode a transaction block id get response.
  *
  * \param resp                      The decoded response buffer.
  * \param payload                   Pointer to the payload to decode.
@@ -536,18 +2427,17 @@ int vcblockchain_protocol_encode_resp_block_next_id_get(
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-int vcblockchain_protocol_decode_resp_block_next_id_get(
-    protocol_resp_block_next_id_get* resp, const void* payload,
+int vcblockchain_protocol_decode_resp_txn_block_id_get(
+    protocol_resp_txn_block_id_get* resp, const void* payload,
     size_t payload_size);
 
 /**
- * \brief Encode a block prev id get request.
+ * \brief Encode a status get request.
  *
  * \param buffer                    Pointer to an uninitialized buffer to
  *                                  receive the encoded request packet.
  * \param alloc_opts                The allocator to use for this request.
  * \param offset                    The offset to use for this request.
- * \param block_id                  The id of block to get.
  *
  * On success, the \p buffer is initialized with a buffer holding the encoded
  * request.  The caller owns this buffer and must \ref dispose() it when it is
@@ -557,12 +2447,11 @@ int vcblockchain_protocol_decode_resp_block_next_id_get(
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-int vcblockchain_protocol_encode_req_block_prev_id_get(
-    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
-    uint32_t offset, const vpr_uuid* block_id);
+int vcblockchain_protocol_encode_req_status_get(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts, uint32_t offset);
 
 /**
- * \brief Decode a block prev id get request.
+ * \brief Decode a status get request.
  *
  * \param req                       The decoded request buffer.
  * \param payload                   Pointer to the payload to decode.
@@ -576,12 +2465,11 @@ int vcblockchain_protocol_encode_req_block_prev_id_get(
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-int vcblockchain_protocol_decode_req_block_prev_id_get(
-    protocol_req_block_prev_id_get* req, const void* payload,
-    size_t payload_size);
+int vcblockchain_protocol_decode_req_status_get(
+    protocol_req_status_get* req, const void* payload, size_t payload_size);
 
 /**
- * \brief Encode a block prev id get response using the given parameters.
+ * \brief Encode a status get response using the given parameters.
  *
  * \param buffer                    Pointer to an uninitialized buffer to
  *                                  receive the encoded response.
@@ -589,7 +2477,6 @@ int vcblockchain_protocol_decode_req_block_prev_id_get(
  *                                  buffer.
  * \param offset                    The offset for this response.
  * \param status                    The status for this response.
- * \param prev_block_id             The prev block id.
  *
  * On success, the \p buffer is initialized with a buffer holding the encoded
  * response.  The caller owns this buffer and must \ref dispose() it when it is
@@ -599,12 +2486,12 @@ int vcblockchain_protocol_decode_req_block_prev_id_get(
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-int vcblockchain_protocol_encode_resp_block_prev_id_get(
+int vcblockchain_protocol_encode_resp_status_get(
     vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
-    uint32_t offset, uint32_t status, const vpr_uuid* prev_block_id);
+    uint32_t offset, uint32_t status);
 
 /**
- * \brief Decode a block prev id get response.
+ * \brief Decode a status get response.
  *
  * \param resp                      The decoded response buffer.
  * \param payload                   Pointer to the payload to decode.
@@ -618,18 +2505,16 @@ int vcblockchain_protocol_encode_resp_block_prev_id_get(
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-int vcblockchain_protocol_decode_resp_block_prev_id_get(
-    protocol_resp_block_prev_id_get* resp, const void* payload,
-    size_t payload_size);
+int vcblockchain_protocol_decode_resp_status_get(
+    protocol_resp_status_get* resp, const void* payload, size_t payload_size);
 
 /**
- * \brief Encode an artifact first txn id get request.
+ * \brief Encode a resumption ticket get request.
  *
  * \param buffer                    Pointer to an uninitialized buffer to
  *                                  receive the encoded request packet.
  * \param alloc_opts                The allocator to use for this request.
  * \param offset                    The offset to use for this request.
- * \param artifact_id               The id of artifact to get.
  *
  * On success, the \p buffer is initialized with a buffer holding the encoded
  * request.  The caller owns this buffer and must \ref dispose() it when it is
@@ -639,12 +2524,11 @@ int vcblockchain_protocol_decode_resp_block_prev_id_get(
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-int vcblockchain_protocol_encode_req_artifact_first_txn_id_get(
-    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
-    uint32_t offset, const vpr_uuid* artifact_id);
+int vcblockchain_protocol_encode_req_resumption_ticket_get(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts, uint32_t offset);
 
 /**
- * \brief Decode an artifact first txn id get request.
+ * \brief Decode a resumption ticket get request.
  *
  * \param req                       The decoded request buffer.
  * \param payload                   Pointer to the payload to decode.
@@ -658,13 +2542,12 @@ int vcblockchain_protocol_encode_req_artifact_first_txn_id_get(
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-int vcblockchain_protocol_decode_req_artifact_first_txn_id_get(
-    protocol_req_artifact_first_txn_id_get* req, const void* payload,
+int vcblockchain_protocol_decode_req_resumption_ticket_get(
+    protocol_req_resumption_ticket_get* req, const void* payload,
     size_t payload_size);
 
 /**
- * \brief Encode an artifact first txn id get response using the given
- * parameters.
+ * \brief Encode a resumption ticket get response using the given parameters.
  *
  * \param buffer                    Pointer to an uninitialized buffer to
  *                                  receive the encoded response.
@@ -672,7 +2555,10 @@ int vcblockchain_protocol_decode_req_artifact_first_txn_id_get(
  *                                  buffer.
  * \param offset                    The offset for this response.
  * \param status                    The status for this response.
- * \param first_txn_id              The first transaction id.
+ * \param ticket                    The resumption ticket for this response.
+ *                                  The agent seals the material it needs to
+ *                                  resume the session in this ticket, which is
+ *                                  opaque to the client.
  *
  * On success, the \p buffer is initialized with a buffer holding the encoded
  * response.  The caller owns this buffer and must \ref dispose() it when it is
@@ -682,37 +2568,42 @@ int vcblockchain_protocol_decode_req_artifact_first_txn_id_get(
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-int vcblockchain_protocol_encode_resp_artifact_first_txn_id_get(
+int vcblockchain_protocol_encode_resp_resumption_ticket_get(
     vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
-    uint32_t offset, uint32_t status, const vpr_uuid* first_txn_id);
+    uint32_t offset, uint32_t status, const vccrypt_buffer_t* ticket);
 
 /**
- * \brief Decode an artifact first txn id get response.
+ * \brief Decode a resumption ticket get response.
  *
  * \param resp                      The decoded response buffer.
+ * \param alloc_opts                The allocator options to use for this
+ *                                  operation.
  * \param payload                   Pointer to the payload to decode.
  * \param payload_size              Size of the payload.
  *
- * On success, the \p resp structure is initialized with the decoded values.
- * The caller owns this structure and must \ref dispose() it when it is no
- * longer needed.
+ * On success, the \p resp structure is initialized with the decoded values. The
+ * caller owns this structure and must \ref dispose() it when it is no longer
+ * needed. If the agent did not issue a ticket, then the response holds only a
+ * header, and the ticket is left empty.
  *
  * \returns a status code indicating success or failure.
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-int vcblockchain_protocol_decode_resp_artifact_first_txn_id_get(
-    protocol_resp_artifact_first_txn_id_get* resp, const void* payload,
-    size_t payload_size);
+int vcblockchain_protocol_decode_resp_resumption_ticket_get(
+    protocol_resp_resumption_ticket_get* resp, allocator_options_t* alloc_opts,
+    const void* payload, size_t payload_size);
 
 /**
- * \brief Encode an artifact last txn id get request.
+ * \brief Encode a rekey request using the given parameters.
  *
  * \param buffer                    Pointer to an uninitialized buffer to
  *                                  receive the encoded request packet.
- * \param alloc_opts                The allocator to use for this request.
- * \param offset                    The offset to use for this request.
- * \param artifact_id               The id of artifact to get.
+ * \param suite                     The crypto suite to use for this request.
+ * \param offset                    The offset for this request.
+ * \param client_switch_iv          The first client IV that uses the new
+ *                                  shared secret.
+ * \param client_key_nonce          The client key nonce for this request.
  *
  * On success, the \p buffer is initialized with a buffer holding the encoded
  * request.  The caller owns this buffer and must \ref dispose() it when it is
@@ -720,42 +2611,53 @@ int vcblockchain_protocol_decode_resp_artifact_first_txn_id_get(
  *
  * \returns a status code indicating success or failure.
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the nonce has the wrong size.
  *      - a non-zero error code on failure.
  */
-int vcblockchain_protocol_encode_req_artifact_last_txn_id_get(
-    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
-    uint32_t offset, const vpr_uuid* artifact_id);
+int vcblockchain_protocol_encode_req_rekey(
+    vccrypt_buffer_t* buffer, vccrypt_suite_options_t* suite,
+    uint32_t offset, uint64_t client_switch_iv,
+    const vccrypt_buffer_t* client_key_nonce);
 
 /**
- * \brief Decode an artifact last txn id get request.
+ * \brief Decode a rekey request.
  *
- * \param req                       The decoded request buffer.
+ * \param req                       The request structure to receive the
+ *                                  decoded request.
+ * \param suite                     The crypto suite to use for this request.
  * \param payload                   Pointer to the payload to decode.
  * \param payload_size              Size of the payload.
  *
- * On success, the \p req structure is initialized with the decoded values. The
- * caller owns this structure and must \ref dispose() it when it is no longer
- * needed.
+ * On success, the \p req structure is initialized with the decoded values.
+ * The caller owns this structure and must \ref dispose() it when it is no
+ * longer needed.
  *
  * \returns a status code indicating success or failure.
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE if the payload
+ *        has the wrong size.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the payload is not a
+ *        rekey request.
  *      - a non-zero error code on failure.
  */
-int vcblockchain_protocol_decode_req_artifact_last_txn_id_get(
-    protocol_req_artifact_last_txn_id_get* req, const void* payload,
-    size_t payload_size);
+int vcblockchain_protocol_decode_req_rekey(
+    protocol_req_rekey* req, vccrypt_suite_options_t* suite,
+    const void* payload, size_t payload_size);
 
 /**
- * \brief Encode an artifact last txn id get response using the given
- * parameters.
+ * \brief Encode a rekey response using the given parameters.
  *
  * \param buffer                    Pointer to an uninitialized buffer to
- *                                  receive the encoded response.
- * \param alloc_opts                The allocator options to use to allocate the
- *                                  buffer.
+ *                                  receive the encoded response packet.
+ * \param suite                     The crypto suite to use for this response.
  * \param offset                    The offset for this response.
  * \param status                    The status for this response.
- * \param last_txn_id               The last transaction id.
+ * \param server_switch_iv          The first server IV that uses the new
+ *                                  shared secret.
+ * \param server_key_nonce          The agent key nonce.
+ *
+ * A refused rekey is encoded with \ref vcblockchain_protocol_encode_error_resp
+ * instead, in which case both sides keep the current shared secret.
  *
  * On success, the \p buffer is initialized with a buffer holding the encoded
  * response.  The caller owns this buffer and must \ref dispose() it when it is
@@ -763,16 +2665,19 @@ int vcblockchain_protocol_decode_req_artifact_last_txn_id_get(
  *
  * \returns a status code indicating success or failure.
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the nonce has the wrong size.
  *      - a non-zero error code on failure.
  */
-int vcblockchain_protocol_encode_resp_artifact_last_txn_id_get(
-    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
-    uint32_t offset, uint32_t status, const vpr_uuid* last_txn_id);
+int vcblockchain_protocol_encode_resp_rekey(
+    vccrypt_buffer_t* buffer, vccrypt_suite_options_t* suite,
+    uint32_t offset, uint32_t status, uint64_t server_switch_iv,
+    const vccrypt_buffer_t* server_key_nonce);
 
 /**
- * \brief Decode an artifact last txn id get response.
+ * \brief Decode a rekey response using the given parameters.
  *
  * \param resp                      The decoded response buffer.
+ * \param suite                     The crypto suite to use for this request.
  * \param payload                   Pointer to the payload to decode.
  * \param payload_size              Size of the payload.
  *
@@ -780,22 +2685,34 @@ int vcblockchain_protocol_encode_resp_artifact_last_txn_id_get(
  * The caller owns this structure and must \ref dispose() it when it is no
  * longer needed.
  *
+ * If the agent refused the rekey, then the response only holds a header, and
+ * the status from the response is returned.
+ *
  * \returns a status code indicating success or failure.
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - the status from the response if the agent refused the rekey.
  *      - a non-zero error code on failure.
  */
-int vcblockchain_protocol_decode_resp_artifact_last_txn_id_get(
-    protocol_resp_artifact_last_txn_id_get* resp, const void* payload,
-    size_t payload_size);
+int vcblockchain_protocol_decode_resp_rekey(
+    protocol_resp_rekey* resp, vccrypt_suite_options_t* suite,
+    const void* payload, size_t payload_size);
 
 /**
- * \brief Encode a transaction get request.
+ * \brief Encode a flow credit grant request.
  *
  * \param buffer                    Pointer to an uninitialized buffer to
  *                                  receive the encoded request packet.
  * \param alloc_opts                The allocator to use for this request.
  * \param offset                    The offset to use for this request.
- * \param txn_id                    The id of transaction to get.
+ * \param request_credits           The number of requests granted. The client
+ *                                  does not limit the number of responses, so
+ *                                  this should be zero.
+ * \param byte_credits              The number of response bytes granted.
+ *
+ * The first grant sent on a connection negotiates flow control. It carries the
+ * whole of the client's receive window, and the agent answers it with a grant
+ * response that carries the whole of its own. Later grants return credits as
+ * the client frees capacity, and are not answered.
  *
  * On success, the \p buffer is initialized with a buffer holding the encoded
  * request.  The caller owns this buffer and must \ref dispose() it when it is
@@ -805,12 +2722,12 @@ int vcblockchain_protocol_decode_resp_artifact_last_txn_id_get(
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-int vcblockchain_protocol_encode_req_txn_get(
+int vcblockchain_protocol_encode_req_flow_credit_grant(
     vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
-    uint32_t offset, const vpr_uuid* txn_id);
+    uint32_t offset, uint32_t request_credits, uint64_t byte_credits);
 
 /**
- * \brief Decode a transaction get request.
+ * \brief Decode a flow credit grant request.
  *
  * \param req                       The decoded request buffer.
  * \param payload                   Pointer to the payload to decode.
@@ -822,13 +2739,18 @@ int vcblockchain_protocol_encode_req_txn_get(
  *
  * \returns a status code indicating success or failure.
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE if the payload
+ *        has the wrong size.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the payload is not a
+ *        flow credit grant request.
  *      - a non-zero error code on failure.
  */
-int vcblockchain_protocol_decode_req_txn_get(
-    protocol_req_txn_get* req, const void* payload, size_t payload_size);
+int vcblockchain_protocol_decode_req_flow_credit_grant(
+    protocol_req_flow_credit_grant* req, const void* payload,
+    size_t payload_size);
 
 /**
- * \brief Encode a transaction get response using the given parameters.
+ * \brief Encode a flow credit grant response using the given parameters.
  *
  * \param buffer                    Pointer to an uninitialized buffer to
  *                                  receive the encoded response.
@@ -836,16 +2758,13 @@ int vcblockchain_protocol_decode_req_txn_get(
  *                                  buffer.
  * \param offset                    The offset for this response.
  * \param status                    The status for this response.
- * \param txn_id                    The transaction id.
- * \param prev_txn_id               The previous transaction id.
- * \param next_txn_id               The next transaction id.
- * \param artifact_id               The artifact id for this transaction.
- * \param block_id                  The block id for this transaction.
- * \param ser_txn_cert_size         The serialized transaction cert size.
- * \param txn_cert                  Pointer to the start of the transaction
- *                                  certificate.
- * \param txn_cert_size             The transaction cert size.
- * \param txn_state                 The transaction state.
+ * \param request_credits           The number of requests granted.
+ * \param byte_credits              The number of request bytes granted.
+ *
+ * The agent answers the first grant on a connection with the whole of its
+ * receive window. After that, it sends a grant with an offset of zero whenever
+ * it frees enough capacity. The client recognizes these grants by their
+ * request id, so they never complete a request in flight.
  *
  * On success, the \p buffer is initialized with a buffer holding the encoded
  * response.  The caller owns this buffer and must \ref dispose() it when it is
@@ -855,42 +2774,46 @@ int vcblockchain_protocol_decode_req_txn_get(
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-int vcblockchain_protocol_encode_resp_txn_get(
+int vcblockchain_protocol_encode_resp_flow_credit_grant(
     vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
-    uint32_t offset, uint32_t status, const vpr_uuid* txn_id,
-    const vpr_uuid* prev_txn_id, const vpr_uuid* next_txn_id,
-    const vpr_uuid* artifact_id, const vpr_uuid* block_id,
-    uint64_t ser_txn_cert_size, const void* txn_cert, size_t txn_cert_size,
-    uint32_t txn_state);
+    uint32_t offset, uint32_t status, uint32_t request_credits,
+    uint64_t byte_credits);
 
 /**
- * \brief Decode a transaction get response.
+ * \brief Decode a flow credit grant response.
  *
  * \param resp                      The decoded response buffer.
- * \param alloc_opts                The allocator to use for this response.
  * \param payload                   Pointer to the payload to decode.
  * \param payload_size              Size of the payload.
  *
- * On success, the \p resp structure is initialized with the decoded values.
- * The caller owns this structure and must \ref dispose() it when it is no
- * longer needed.
+ * On success, the \p resp structure is initialized with the decoded values. The
+ * caller owns this structure and must \ref dispose() it when it is no longer
+ * needed.
+ *
+ * An agent that does not support flow control answers the first grant with an
+ * error response, which only holds a header. In that case, the status from the
+ * response is returned, and flow control stays off for the connection.
  *
  * \returns a status code indicating success or failure.
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - the status from the response if the agent refused the grant.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE if the payload
+ *        has the wrong size.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the payload is not a
+ *        flow credit grant response.
  *      - a non-zero error code on failure.
  */
-int vcblockchain_protocol_decode_resp_txn_get(
-    protocol_resp_txn_get* resp, allocator_options_t* alloc_opts,
-    const void* payload, size_t payload_size);
+int vcblockchain_protocol_decode_resp_flow_credit_grant(
+    protocol_resp_flow_credit_grant* resp, const void* payload,
+    size_t payload_size);
 
 /**
- * \brief Encode a block id by height get request.
+ * \brief Encode a connection close request.
  *
  * \param buffer                    Pointer to an uninitialized buffer to
  *                                  receive the encoded request packet.
  * \param alloc_opts                The allocator to use for this request.
  * \param offset                    The offset to use for this request.
- * \param height                    The block height of block id to get.
  *
  * On success, the \p buffer is initialized with a buffer holding the encoded
  * request.  The caller owns this buffer and must \ref dispose() it when it is
@@ -900,12 +2823,11 @@ int vcblockchain_protocol_decode_resp_txn_get(
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-int vcblockchain_protocol_encode_req_block_id_by_height_get(
-    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
-    uint32_t offset, uint64_t height);
+int vcblockchain_protocol_encode_req_connection_close(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts, uint32_t offset);
 
 /**
- * \brief Decode a block id by height get request.
+ * \brief Decode a connection close request.
  *
  * \param req                       The decoded request buffer.
  * \param payload                   Pointer to the payload to decode.
@@ -919,12 +2841,12 @@ int vcblockchain_protocol_encode_req_block_id_by_height_get(
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-int vcblockchain_protocol_decode_req_block_id_by_height_get(
-    protocol_req_block_id_by_height_get* req, const void* payload,
+int vcblockchain_protocol_decode_req_connection_close(
+    protocol_req_connection_close* req, const void* payload,
     size_t payload_size);
 
 /**
- * \brief Encode a block id by height get response using the given parameters.
+ * \brief Encode a connection close response using the given parameters.
  *
  * \param buffer                    Pointer to an uninitialized buffer to
  *                                  receive the encoded response.
@@ -932,7 +2854,6 @@ int vcblockchain_protocol_decode_req_block_id_by_height_get(
  *                                  buffer.
  * \param offset                    The offset for this response.
  * \param status                    The status for this response.
- * \param block_id                  The block id.
  *
  * On success, the \p buffer is initialized with a buffer holding the encoded
  * response.  The caller owns this buffer and must \ref dispose() it when it is
@@ -942,12 +2863,12 @@ int vcblockchain_protocol_decode_req_block_id_by_height_get(
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-int vcblockchain_protocol_encode_resp_block_id_by_height_get(
+int vcblockchain_protocol_encode_resp_connection_close(
     vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
-    uint32_t offset, uint32_t status, const vpr_uuid* block_id);
+    uint32_t offset, uint32_t status);
 
 /**
- * \brief Decode a block id by height get response.
+ * \brief Decode a connection close response.
  *
  * \param resp                      The decoded response buffer.
  * \param payload                   Pointer to the payload to decode.
@@ -961,18 +2882,18 @@ int vcblockchain_protocol_encode_resp_block_id_by_height_get(
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-int vcblockchain_protocol_decode_resp_block_id_by_height_get(
-    protocol_resp_block_id_by_height_get* resp, const void* payload,
+int vcblockchain_protocol_decode_resp_connection_close(
+    protocol_resp_connection_close* resp, const void* payload,
     size_t payload_size);
 
 /**
- * \brief Encode a transaction next id get request.
+ * \brief Encode a request cancellation request.
  *
  * \param buffer                    Pointer to an uninitialized buffer to
  *                                  receive the encoded request packet.
  * \param alloc_opts                The allocator to use for this request.
  * \param offset                    The offset to use for this request.
- * \param txn_id                    The id of txn to get.
+ * \param target_offset             The offset of the request to cancel.
  *
  * On success, the \p buffer is initialized with a buffer holding the encoded
  * request.  The caller owns this buffer and must \ref dispose() it when it is
@@ -982,12 +2903,12 @@ int vcblockchain_protocol_decode_resp_block_id_by_height_get(
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-int vcblockchain_protocol_encode_req_txn_next_id_get(
-    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
-    uint32_t offset, const vpr_uuid* txn_id);
+int vcblockchain_protocol_encode_req_request_cancel(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts, uint32_t offset,
+    uint32_t target_offset);
 
 /**
- * \brief Decode a transaction next id get request.
+ * \brief Decode a request cancellation request.
  *
  * \param req                       The decoded request buffer.
  * \param payload                   Pointer to the payload to decode.
@@ -1001,12 +2922,11 @@ int vcblockchain_protocol_encode_req_txn_next_id_get(
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-int vcblockchain_protocol_decode_req_txn_next_id_get(
-    protocol_req_txn_next_id_get* req, const void* payload,
-    size_t payload_size);
+int vcblockchain_protocol_decode_req_request_cancel(
+    protocol_req_request_cancel* req, const void* payload, size_t payload_size);
 
 /**
- * \brief Encode a transaction next id get response using the given parameters.
+ * \brief Encode a request cancellation response.
  *
  * \param buffer                    Pointer to an uninitialized buffer to
  *                                  receive the encoded response.
@@ -1014,7 +2934,7 @@ int vcblockchain_protocol_decode_req_txn_next_id_get(
  *                                  buffer.
  * \param offset                    The offset for this response.
  * \param status                    The status for this response.
- * \param next_txn_id               The next txn id.
+ * \param target_offset             The offset of the request to cancel.
  *
  * On success, the \p buffer is initialized with a buffer holding the encoded
  * response.  The caller owns this buffer and must \ref dispose() it when it is
@@ -1024,12 +2944,12 @@ int vcblockchain_protocol_decode_req_txn_next_id_get(
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-int vcblockchain_protocol_encode_resp_txn_next_id_get(
+int vcblockchain_protocol_encode_resp_request_cancel(
     vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
-    uint32_t offset, uint32_t status, const vpr_uuid* next_txn_id);
+    uint32_t offset, uint32_t status, uint32_t target_offset);
 
 /**
- * \brief Decode a transaction next id get response.
+ * \brief Decode a request cancellation response.
  *
  * \param resp                      The decoded response buffer.
  * \param payload                   Pointer to the payload to decode.
@@ -1043,18 +2963,41 @@ int vcblockchain_protocol_encode_resp_txn_next_id_get(
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-int vcblockchain_protocol_decode_resp_txn_next_id_get(
-    protocol_resp_txn_next_id_get* resp, const void* payload,
+int vcblockchain_protocol_decode_resp_request_cancel(
+    protocol_resp_request_cancel* resp, const void* payload,
     size_t payload_size);
 
 /**
- * \brief Encode a transaction prev id get request.
+ * \brief Encode an error response using the given parameters.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded response.
+ * \param alloc_opts                The allocator options to use to allocate the
+ *                                  buffer.
+ * \param req_id                    The request id for this response.
+ * \param offset                    The offset for this response.
+ * \param status                    The status for this response.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * response.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_error_resp(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t req_id, uint32_t offset, uint32_t status);
+
+/**
+ * \brief Encode a latest block id assertion request.
  *
  * \param buffer                    Pointer to an uninitialized buffer to
  *                                  receive the encoded request packet.
  * \param alloc_opts                The allocator to use for this request.
  * \param offset                    The offset to use for this request.
- * \param txn_id                    The id of txn to get.
+ * \param latest_block_id           The latest block id for this request.
  *
  * On success, the \p buffer is initialized with a buffer holding the encoded
  * request.  The caller owns this buffer and must \ref dispose() it when it is
@@ -1064,12 +3007,12 @@ int vcblockchain_protocol_decode_resp_txn_next_id_get(
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-int vcblockchain_protocol_encode_req_txn_prev_id_get(
-    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
-    uint32_t offset, const vpr_uuid* txn_id);
+int vcblockchain_protocol_encode_req_assert_latest_block_id(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts, uint32_t offset,
+    const vpr_uuid* latest_block_id);
 
 /**
- * \brief Decode a transaction prev id get request.
+ * \brief Decode a latest block id assertion request.
  *
  * \param req                       The decoded request buffer.
  * \param payload                   Pointer to the payload to decode.
@@ -1083,12 +3026,12 @@ int vcblockchain_protocol_encode_req_txn_prev_id_get(
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-int vcblockchain_protocol_decode_req_txn_prev_id_get(
-    protocol_req_txn_prev_id_get* req, const void* payload,
+int vcblockchain_protocol_decode_req_assert_latest_block_id(
+    protocol_req_assert_latest_block_id* req, const void* payload,
     size_t payload_size);
 
 /**
- * \brief Encode a transaction prev id get response using the given parameters.
+ * \brief Encode a latest block id assertion response.
  *
  * \param buffer                    Pointer to an uninitialized buffer to
  *                                  receive the encoded response.
@@ -1096,7 +3039,6 @@ int vcblockchain_protocol_decode_req_txn_prev_id_get(
  *                                  buffer.
  * \param offset                    The offset for this response.
  * \param status                    The status for this response.
- * \param prev_txn_id               The prev txn id.
  *
  * On success, the \p buffer is initialized with a buffer holding the encoded
  * response.  The caller owns this buffer and must \ref dispose() it when it is
@@ -1106,12 +3048,12 @@ int vcblockchain_protocol_decode_req_txn_prev_id_get(
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-int vcblockchain_protocol_encode_resp_txn_prev_id_get(
+int vcblockchain_protocol_encode_resp_assert_latest_block_id(
     vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
-    uint32_t offset, uint32_t status, const vpr_uuid* prev_txn_id);
+    uint32_t offset, uint32_t status);
 
 /**
- * \brief Decode a transaction prev id get response.
+ * \brief Decode a latest block id assertion response.
  *
  * \param resp                      The decoded response buffer.
  * \param payload                   Pointer to the payload to decode.
@@ -1125,18 +3067,17 @@ int vcblockchain_protocol_encode_resp_txn_prev_id_get(
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-int vcblockchain_protocol_decode_resp_txn_prev_id_get(
-    protocol_resp_txn_prev_id_get* resp, const void* payload,
+int vcblockchain_protocol_decode_resp_assert_latest_block_id(
+    protocol_resp_assert_latest_block_id* resp, const void* payload,
     size_t payload_size);
 
 /**
- * \brief Encode a transaction block id get request.
+ * \brief Encode a latest block id assertion cancel request.
  *
  * \param buffer                    Pointer to an uninitialized buffer to
  *                                  receive the encoded request packet.
  * \param alloc_opts                The allocator to use for this request.
  * \param offset                    The offset to use for this request.
- * \param txn_id                    The id of txn to get.
  *
  * On success, the \p buffer is initialized with a buffer holding the encoded
  * request.  The caller owns this buffer and must \ref dispose() it when it is
@@ -1146,12 +3087,11 @@ int vcblockchain_protocol_decode_resp_txn_prev_id_get(
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-int vcblockchain_protocol_encode_req_txn_block_id_get(
-    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
-    uint32_t offset, const vpr_uuid* txn_id);
+int vcblockchain_protocol_encode_req_assert_latest_block_id_cancel(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts, uint32_t offset);
 
 /**
- * \brief Decode a transaction block id get request.
+ * \brief Decode a latest block id assertion cancel request.
  *
  * \param req                       The decoded request buffer.
  * \param payload                   Pointer to the payload to decode.
@@ -1165,12 +3105,12 @@ int vcblockchain_protocol_encode_req_txn_block_id_get(
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-int vcblockchain_protocol_decode_req_txn_block_id_get(
-    protocol_req_txn_block_id_get* req, const void* payload,
+int vcblockchain_protocol_decode_req_assert_latest_block_id_cancel(
+    protocol_req_assert_latest_block_id_cancel* req, const void* payload,
     size_t payload_size);
 
 /**
- * \brief Encode a transaction block id get response using the given parameters.
+ * \brief Encode a latest block id assertion cancel response.
  *
  * \param buffer                    Pointer to an uninitialized buffer to
  *                                  receive the encoded response.
@@ -1178,7 +3118,6 @@ int vcblockchain_protocol_decode_req_txn_block_id_get(
  *                                  buffer.
  * \param offset                    The offset for this response.
  * \param status                    The status for this response.
- * \param block_id                  The block id.
  *
  * On success, the \p buffer is initialized with a buffer holding the encoded
  * response.  The caller owns this buffer and must \ref dispose() it when it is
@@ -1188,12 +3127,12 @@ int vcblockchain_protocol_decode_req_txn_block_id_get(
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-int vcblockchain_protocol_encode_resp_txn_block_id_get(
+int vcblockchain_protocol_encode_resp_assert_latest_block_id_cancel(
     vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
-    uint32_t offset, uint32_t status, const vpr_uuid* block_id);
+    uint32_t offset, uint32_t status);
 
 /**
- * \brief Decode a transaction block id get response.
+ * \brief Decode a latest block id assertion cancel response.
  *
  * \param resp                      The decoded response buffer.
  * \param payload                   Pointer to the payload to decode.
@@ -1207,17 +3146,22 @@ int vcblockchain_protocol_encode_resp_txn_block_id_get(
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-int vcblockchain_protocol_decode_resp_txn_block_id_get(
-    protocol_resp_txn_block_id_get* resp, const void* payload,
+int vcblockchain_protocol_decode_resp_assert_latest_block_id_cancel(
+    protocol_resp_assert_latest_block_id_cancel* resp, const void* payload,
     size_t payload_size);
 
 /**
- * \brief Encode a status get request.
+ * \brief Encode a block subscription request.
  *
  * \param buffer                    Pointer to an uninitialized buffer to
  *                                  receive the encoded request packet.
  * \param alloc_opts                The allocator to use for this request.
  * \param offset                    The offset to use for this request.
+ * \param latest_block_id           The latest block id known to the client.
+ *                                  Notifications are sent for every block
+ *                                  after this one.
+ * \param include_cert              Set to true if notifications should include
+ *                                  the block certificate.
  *
  * On success, the \p buffer is initialized with a buffer holding the encoded
  * request.  The caller owns this buffer and must \ref dispose() it when it is
@@ -1227,11 +3171,12 @@ int vcblockchain_protocol_decode_resp_txn_block_id_get(
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-int vcblockchain_protocol_encode_req_status_get(
-    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts, uint32_t offset);
+int vcblockchain_protocol_encode_req_block_subscribe(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts, uint32_t offset,
+    const vpr_uuid* latest_block_id, bool include_cert);
 
 /**
- * \brief Decode a status get request.
+ * \brief Decode a block subscription request.
  *
  * \param req                       The decoded request buffer.
  * \param payload                   Pointer to the payload to decode.
@@ -1245,11 +3190,12 @@ int vcblockchain_protocol_encode_req_status_get(
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-int vcblockchain_protocol_decode_req_status_get(
-    protocol_req_status_get* req, const void* payload, size_t payload_size);
+int vcblockchain_protocol_decode_req_block_subscribe(
+    protocol_req_block_subscribe* req, const void* payload,
+    size_t payload_size);
 
 /**
- * \brief Encode a status get response using the given parameters.
+ * \brief Encode a block subscription response.
  *
  * \param buffer                    Pointer to an uninitialized buffer to
  *                                  receive the encoded response.
@@ -1266,12 +3212,12 @@ int vcblockchain_protocol_decode_req_status_get(
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-int vcblockchain_protocol_encode_resp_status_get(
+int vcblockchain_protocol_encode_resp_block_subscribe(
     vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
     uint32_t offset, uint32_t status);
 
 /**
- * \brief Decode a status get response.
+ * \brief Decode a block subscription response.
  *
  * \param resp                      The decoded response buffer.
  * \param payload                   Pointer to the payload to decode.
@@ -1285,16 +3231,72 @@ int vcblockchain_protocol_encode_resp_status_get(
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-int vcblockchain_protocol_decode_resp_status_get(
-    protocol_resp_status_get* resp, const void* payload, size_t payload_size);
+int vcblockchain_protocol_decode_resp_block_subscribe(
+    protocol_resp_block_subscribe* resp, const void* payload,
+    size_t payload_size);
 
 /**
- * \brief Encode a connection close request.
+ * \brief Encode a block notification for a block subscription.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded notification.
+ * \param alloc_opts                The allocator options to use to allocate the
+ *                                  buffer.
+ * \param offset                    The offset of the block subscription
+ *                                  request.
+ * \param block_id                  The block id.
+ * \param prev_block_id             The previous block id.
+ * \param block_height              The block height.
+ * \param block_cert                Pointer to the start of the block
+ *                                  certificate, or NULL if the subscriber did
+ *                                  not request certificates.
+ * \param block_cert_size           The block cert size.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * notification.  The caller owns this buffer and must \ref dispose() it when it
+ * is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_resp_block_notification(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, const vpr_uuid* block_id, const vpr_uuid* prev_block_id,
+    uint64_t block_height, const void* block_cert, size_t block_cert_size);
+
+/**
+ * \brief Decode a block notification.
+ *
+ * \param resp                      The decoded notification buffer.
+ * \param alloc_opts                The allocator to use for this notification.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p resp structure is initialized with the decoded values.
+ * The caller owns this structure and must \ref dispose() it when it is no
+ * longer needed. If the notification does not include a block certificate,
+ * then the block_cert buffer is left empty, with a NULL data pointer.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_decode_resp_block_notification(
+    protocol_resp_block_notification* resp, allocator_options_t* alloc_opts,
+    const void* payload, size_t payload_size);
+
+/**
+ * \brief Encode an artifact subscription request.
  *
  * \param buffer                    Pointer to an uninitialized buffer to
  *                                  receive the encoded request packet.
  * \param alloc_opts                The allocator to use for this request.
  * \param offset                    The offset to use for this request.
+ * \param artifact_ids              The artifact ids to watch.
+ * \param count                     The number of artifact ids, which must be
+ *                                  between 1 and the maximum artifact
+ *                                  subscription count.
  *
  * On success, the \p buffer is initialized with a buffer holding the encoded
  * request.  The caller owns this buffer and must \ref dispose() it when it is
@@ -1302,32 +3304,38 @@ int vcblockchain_protocol_decode_resp_status_get(
  *
  * \returns a status code indicating success or failure.
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
- *      - a non-zero error code on failure.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered.
  */
-int vcblockchain_protocol_encode_req_connection_close(
-    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts, uint32_t offset);
+int vcblockchain_protocol_encode_req_artifact_subscribe(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts, uint32_t offset,
+    const vpr_uuid* artifact_ids, size_t count);
 
 /**
- * \brief Decode a connection close request.
+ * \brief Decode an artifact subscription request.
  *
  * \param req                       The decoded request buffer.
+ * \param alloc_opts                The allocator to use for this request.
  * \param payload                   Pointer to the payload to decode.
  * \param payload_size              Size of the payload.
  *
  * On success, the \p req structure is initialized with the decoded values. The
- * caller owns this structure and must \ref dispose() it when it is no longer
- * needed.
+ * artifact id array is owned by \p req. The caller owns this structure and
+ * must \ref dispose() it when it is no longer needed.
  *
  * \returns a status code indicating success or failure.
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
- *      - a non-zero error code on failure.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the payload is malformed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered.
  */
-int vcblockchain_protocol_decode_req_connection_close(
-    protocol_req_connection_close* req, const void* payload,
-    size_t payload_size);
+int vcblockchain_protocol_decode_req_artifact_subscribe(
+    protocol_req_artifact_subscribe* req, allocator_options_t* alloc_opts,
+    const void* payload, size_t payload_size);
 
 /**
- * \brief Encode a connection close response using the given parameters.
+ * \brief Encode an artifact subscription response.
  *
  * \param buffer                    Pointer to an uninitialized buffer to
  *                                  receive the encoded response.
@@ -1344,12 +3352,12 @@ int vcblockchain_protocol_decode_req_connection_close(
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-int vcblockchain_protocol_encode_resp_connection_close(
+int vcblockchain_protocol_encode_resp_artifact_subscribe(
     vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
     uint32_t offset, uint32_t status);
 
 /**
- * \brief Decode a connection close response.
+ * \brief Decode an artifact subscription response.
  *
  * \param resp                      The decoded response buffer.
  * \param payload                   Pointer to the payload to decode.
@@ -1363,41 +3371,23 @@ int vcblockchain_protocol_encode_resp_connection_close(
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-int vcblockchain_protocol_decode_resp_connection_close(
-    protocol_resp_connection_close* resp, const void* payload,
+int vcblockchain_protocol_decode_resp_artifact_subscribe(
+    protocol_resp_artifact_subscribe* resp, const void* payload,
     size_t payload_size);
 
 /**
- * \brief Encode an error response using the given parameters.
- *
- * \param buffer                    Pointer to an uninitialized buffer to
- *                                  receive the encoded response.
- * \param alloc_opts                The allocator options to use to allocate the
- *                                  buffer.
- * \param req_id                    The request id for this response.
- * \param offset                    The offset for this response.
- * \param status                    The status for this response.
- *
- * On success, the \p buffer is initialized with a buffer holding the encoded
- * response.  The caller owns this buffer and must \ref dispose() it when it is
- * no longer needed.
- *
- * \returns a status code indicating success or failure.
- *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
- *      - a non-zero error code on failure.
- */
-int vcblockchain_protocol_encode_error_resp(
-    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
-    uint32_t req_id, uint32_t offset, uint32_t status);
-
-/**
- * \brief Encode a latest block id assertion request.
+ * \brief Encode an artifact unsubscription request.
  *
  * \param buffer                    Pointer to an uninitialized buffer to
  *                                  receive the encoded request packet.
  * \param alloc_opts                The allocator to use for this request.
  * \param offset                    The offset to use for this request.
- * \param latest_block_id           The latest block id for this request.
+ * \param artifact_ids              The artifact ids to stop watching. This may
+ *                                  be NULL if \p count is zero.
+ * \param count                     The number of artifact ids, which must be
+ *                                  no more than the maximum artifact
+ *                                  subscription count. If zero, then every
+ *                                  watched artifact is removed.
  *
  * On success, the \p buffer is initialized with a buffer holding the encoded
  * request.  The caller owns this buffer and must \ref dispose() it when it is
@@ -1405,33 +3395,39 @@ int vcblockchain_protocol_encode_error_resp(
  *
  * \returns a status code indicating success or failure.
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
- *      - a non-zero error code on failure.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered.
  */
-int vcblockchain_protocol_encode_req_assert_latest_block_id(
+int vcblockchain_protocol_encode_req_artifact_unsubscribe(
     vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts, uint32_t offset,
-    const vpr_uuid* latest_block_id);
+    const vpr_uuid* artifact_ids, size_t count);
 
 /**
- * \brief Decode a latest block id assertion request.
+ * \brief Decode an artifact unsubscription request.
  *
  * \param req                       The decoded request buffer.
+ * \param alloc_opts                The allocator to use for this request.
  * \param payload                   Pointer to the payload to decode.
  * \param payload_size              Size of the payload.
  *
  * On success, the \p req structure is initialized with the decoded values. The
- * caller owns this structure and must \ref dispose() it when it is no longer
- * needed.
+ * artifact id array is owned by \p req, and is NULL if the request removes
+ * every watched artifact. The caller owns this structure and must \ref
+ * dispose() it when it is no longer needed.
  *
  * \returns a status code indicating success or failure.
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
- *      - a non-zero error code on failure.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the payload is malformed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered.
  */
-int vcblockchain_protocol_decode_req_assert_latest_block_id(
-    protocol_req_assert_latest_block_id* req, const void* payload,
-    size_t payload_size);
+int vcblockchain_protocol_decode_req_artifact_unsubscribe(
+    protocol_req_artifact_unsubscribe* req, allocator_options_t* alloc_opts,
+    const void* payload, size_t payload_size);
 
 /**
- * \brief Encode a latest block id assertion response.
+ * \brief Encode an artifact unsubscription response.
  *
  * \param buffer                    Pointer to an uninitialized buffer to
  *                                  receive the encoded response.
@@ -1448,12 +3444,12 @@ int vcblockchain_protocol_decode_req_assert_latest_block_id(
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-int vcblockchain_protocol_encode_resp_assert_latest_block_id(
+int vcblockchain_protocol_encode_resp_artifact_unsubscribe(
     vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
     uint32_t offset, uint32_t status);
 
 /**
- * \brief Decode a latest block id assertion response.
+ * \brief Decode an artifact unsubscription response.
  *
  * \param resp                      The decoded response buffer.
  * \param payload                   Pointer to the payload to decode.
@@ -1467,17 +3463,72 @@ int vcblockchain_protocol_encode_resp_assert_latest_block_id(
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-int vcblockchain_protocol_decode_resp_assert_latest_block_id(
-    protocol_resp_assert_latest_block_id* resp, const void* payload,
+int vcblockchain_protocol_decode_resp_artifact_unsubscribe(
+    protocol_resp_artifact_unsubscribe* resp, const void* payload,
     size_t payload_size);
 
 /**
- * \brief Encode a latest block id assertion cancel request.
+ * \brief Encode an artifact notification for an artifact subscription.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded notification.
+ * \param alloc_opts                The allocator options to use to allocate the
+ *                                  buffer.
+ * \param offset                    The offset of the artifact subscription
+ *                                  request.
+ * \param artifact_id               The artifact id.
+ * \param txn_id                    The canonized transaction id.
+ * \param block_id                  The block id for the block in which this
+ *                                  transaction was canonized.
+ * \param txn_state                 The transaction state.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * notification.  The caller owns this buffer and must \ref dispose() it when it
+ * is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_resp_artifact_notification(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, const vpr_uuid* artifact_id, const vpr_uuid* txn_id,
+    const vpr_uuid* block_id, uint32_t txn_state);
+
+/**
+ * \brief Decode an artifact notification.
+ *
+ * \param resp                      The decoded notification buffer.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p resp structure is initialized with the decoded values.
+ * The caller owns this structure and must \ref dispose() it when it is no
+ * longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_decode_resp_artifact_notification(
+    protocol_resp_artifact_notification* resp, const void* payload,
+    size_t payload_size);
+
+/**
+ * \brief Encode a batch request.
  *
  * \param buffer                    Pointer to an uninitialized buffer to
  *                                  receive the encoded request packet.
  * \param alloc_opts                The allocator to use for this request.
  * \param offset                    The offset to use for this request.
+ * \param requests                  Array of encoded requests to send in this
+ *                                  batch, each created by one of the request
+ *                                  encode functions.
+ * \param count                     The number of requests in the batch.
+ *
+ * Each request in the batch keeps its own request id and offset, and the
+ * server answers with a single batch response holding one response per
+ * request, in the same order. Batches cannot be nested.
  *
  * On success, the \p buffer is initialized with a buffer holding the encoded
  * request.  The caller owns this buffer and must \ref dispose() it when it is
@@ -1485,39 +3536,52 @@ int vcblockchain_protocol_decode_resp_assert_latest_block_id(
  *
  * \returns a status code indicating success or failure.
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the batch is empty, too large, or
+ *        holds a request that is malformed or itself a batch.
  *      - a non-zero error code on failure.
  */
-int vcblockchain_protocol_encode_req_assert_latest_block_id_cancel(
-    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts, uint32_t offset);
+int vcblockchain_protocol_encode_req_batch(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, const vccrypt_buffer_t* requests, size_t count);
 
 /**
- * \brief Decode a latest block id assertion cancel request.
+ * \brief Decode a batch request.
  *
  * \param req                       The decoded request buffer.
+ * \param alloc_opts                The allocator to use for this request.
  * \param payload                   Pointer to the payload to decode.
  * \param payload_size              Size of the payload.
  *
- * On success, the \p req structure is initialized with the decoded values. The
- * caller owns this structure and must \ref dispose() it when it is no longer
- * needed.
+ * On success, the \p req structure is initialized with the decoded values.
+ * Each item in the batch points to an encoded request owned by \p req, which
+ * can be decoded with the matching request decode function. The caller owns
+ * this structure and must \ref dispose() it when it is no longer needed.
  *
  * \returns a status code indicating success or failure.
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
- *      - a non-zero error code on failure.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the payload is malformed, or if it
+ *        holds a request that is itself a batch.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered.
  */
-int vcblockchain_protocol_decode_req_assert_latest_block_id_cancel(
-    protocol_req_assert_latest_block_id_cancel* req, const void* payload,
-    size_t payload_size);
+int vcblockchain_protocol_decode_req_batch(
+    protocol_req_batch* req, allocator_options_t* alloc_opts,
+    const void* payload, size_t payload_size);
 
 /**
- * \brief Encode a latest block id assertion cancel response.
+ * \brief Encode a batch response using the given parameters.
  *
  * \param buffer                    Pointer to an uninitialized buffer to
  *                                  receive the encoded response.
  * \param alloc_opts                The allocator options to use to allocate the
  *                                  buffer.
- * \param offset                    The offset for this response.
- * \param status                    The status for this response.
+ * \param offset                    The offset of the batch request.
+ * \param status                    The status of the batch as a whole.
+ * \param statuses                  Array of statuses, one per request in the
+ *                                  batch.
+ * \param responses                 Array of encoded responses, one per request
+ *                                  in the batch. A response may be empty.
+ * \param count                     The number of responses in the batch.
  *
  * On success, the \p buffer is initialized with a buffer holding the encoded
  * response.  The caller owns this buffer and must \ref dispose() it when it is
@@ -1525,30 +3589,37 @@ int vcblockchain_protocol_decode_req_assert_latest_block_id_cancel(
  *
  * \returns a status code indicating success or failure.
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the batch is too large.
  *      - a non-zero error code on failure.
  */
-int vcblockchain_protocol_encode_resp_assert_latest_block_id_cancel(
+int vcblockchain_protocol_encode_resp_batch(
     vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
-    uint32_t offset, uint32_t status);
+    uint32_t offset, uint32_t status, const uint32_t* statuses,
+    const vccrypt_buffer_t* responses, size_t count);
 
 /**
- * \brief Decode a latest block id assertion cancel response.
+ * \brief Decode a batch response.
  *
  * \param resp                      The decoded response buffer.
+ * \param alloc_opts                The allocator to use for this response.
  * \param payload                   Pointer to the payload to decode.
  * \param payload_size              Size of the payload.
  *
  * On success, the \p resp structure is initialized with the decoded values.
- * The caller owns this structure and must \ref dispose() it when it is no
- * longer needed.
+ * Each item holds the status of the matching request and points to an encoded
+ * response owned by \p resp, which can be decoded with the matching response
+ * decode function. The caller owns this structure and must \ref dispose() it
+ * when it is no longer needed.
  *
  * \returns a status code indicating success or failure.
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
- *      - a non-zero error code on failure.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the payload is malformed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered.
  */
-int vcblockchain_protocol_decode_resp_assert_latest_block_id_cancel(
-    protocol_resp_assert_latest_block_id_cancel* resp, const void* payload,
-    size_t payload_size);
+int vcblockchain_protocol_decode_resp_batch(
+    protocol_resp_batch* resp, allocator_options_t* alloc_opts,
+    const void* payload, size_t payload_size);
 
 /**
  * \brief Encode an extended API enable request.
@@ -24,6 +24,17 @@ enum vcblockchain_psock_boxed_type
     VCBLOCKCHAIN_PSOCK_BOXED_TYPE_AUTHED_PACKET         = 0x00000030,
 };
 
+/**
+ * \brief A segment of a payload that is gathered from several buffers.
+ */
+typedef struct vcblockchain_psock_iovec
+{
+    /** \brief the segment data. */
+    const void* data;
+    /** \brief the size of the segment data. */
+    size_t size;
+} vcblockchain_psock_iovec;
+
 /**
  * \brief Write an authenticated data packet.
  *
@@ -45,6 +56,103 @@ int psock_write_authed_data(
     RCPR_SYM(psock)* sock, uint64_t iv, const void* val, uint32_t size,
     vccrypt_suite_options_t* suite, const vccrypt_buffer_t* secret);
 
+/**
+ * \brief Write an authenticated data packet whose payload is gathered from a
+ * vector of segments.
+ *
+ * On success, the authenticated data packet value will be written, along with
+ * type information and size. The payload of this packet is the concatenation
+ * of each segment in \p vec. Each segment is encrypted directly into the
+ * packet, so the caller does not need to first copy the segments into a
+ * contiguous buffer.
+ *
+ * \param sock          The psock instance to which this packet is written.
+ * \param iv            The 64-bit IV to use for this packet.
+ * \param vec           The payload segments to write.
+ * \param vec_count     The number of payload segments.
+ * \param suite         The crypto suite to use for authenticating this packet.
+ * \param secret        The shared secret between the peer and host.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the payload is too large for a
+ *        single packet.
+ *      - a non-zero error code on failure.
+ */
+int psock_write_authed_datav(
+    RCPR_SYM(psock)* sock, uint64_t iv, const vcblockchain_psock_iovec* vec,
+    size_t vec_count, vccrypt_suite_options_t* suite,
+    const vccrypt_buffer_t* secret);
+
+/**
+ * \brief Seal an authenticated data packet whose payload is gathered from a
+ * vector of segments, without writing it.
+ *
+ * On success, \p packet holds the encrypted and authenticated packet, exactly
+ * as \ref psock_write_authed_datav would write it to the socket. Sealing does
+ * not touch the socket, so packets for the same connection may be sealed in
+ * parallel, as long as each uses a distinct IV and they are written to the
+ * socket in IV order.
+ *
+ * \param packet        The buffer to receive the sealed packet. This buffer
+ *                      must not have been previously initialized. On success,
+ *                      it is initialized and owned by the caller, and must be
+ *                      disposed when no longer needed.
+ * \param iv            The 64-bit IV to use for this packet.
+ * \param vec           The payload segments to seal.
+ * \param vec_count     The number of payload segments.
+ * \param suite         The crypto suite to use for authenticating this packet.
+ * \param secret        The shared secret between the peer and host.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the payload is too large for a
+ *        single packet.
+ *      - a non-zero error code on failure.
+ */
+int psock_seal_authed_datav(
+    vccrypt_buffer_t* packet, uint64_t iv, const vcblockchain_psock_iovec* vec,
+    size_t vec_count, vccrypt_suite_options_t* suite,
+    const vccrypt_buffer_t* secret);
+
+/**
+ * \brief Authenticate and decrypt an authenticated data packet held in a
+ * buffer.
+ *
+ * This is the counterpart of \ref psock_seal_authed_datav, for callers that
+ * read from the socket themselves, such as a client driven by an event loop.
+ * The buffer may hold a partial packet, or more than one packet. If it does
+ * not yet hold the whole of the first packet, then this function fails with
+ * \ref VCBLOCKCHAIN_ERROR_SSOCK_PACKET_INCOMPLETE, and the caller should try
+ * again once more data has arrived.
+ *
+ * \param payload       The buffer to receive the decrypted payload. This
+ *                      buffer must not have been previously initialized. On
+ *                      success, it is initialized and owned by the caller, and
+ *                      must be disposed when no longer needed.
+ * \param packet_size   Pointer to receive the size of the packet at the start
+ *                      of \p data. On success, the caller should discard this
+ *                      many bytes. If the packet is incomplete, this is set to
+ *                      the number of bytes needed to make progress.
+ * \param data          The data read from the socket.
+ * \param data_size     The size of the data read from the socket.
+ * \param iv            The 64-bit IV to expect for this packet.
+ * \param suite         The crypto suite to use for authenticating this packet.
+ * \param secret        The shared secret between the peer and host.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_PACKET_INCOMPLETE if \p data does not yet
+ *        hold a complete packet.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_UNAUTHORIZED_PACKET if the packet could not
+ *        be authenticated.
+ *      - a non-zero error code on failure.
+ */
+int psock_open_authed_data(
+    vccrypt_buffer_t* payload, size_t* packet_size, const void* data,
+    size_t data_size, uint64_t iv, vccrypt_suite_options_t* suite,
+    const vccrypt_buffer_t* secret);
+
 /**
  * \brief Read an authenticated data packet.
  *
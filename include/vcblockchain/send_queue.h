@@ -0,0 +1,204 @@
+/**
+ * \file vcblockchain/send_queue.h
+ *
+ * \brief Concurrent send path for a connection shared by several threads.
+ *
+ * The lower level sendreq functions seal and write a packet, then increment
+ * the client IV, so threads sharing a connection must hold a lock across the
+ * encode, the encryption and the write. A send queue only serializes the
+ * write. A thread reserves the next client IV with a single atomic increment,
+ * then seals its packet with that IV in parallel with other threads. Sealed
+ * packets are placed in a ring ordered by IV. Whichever thread finds the packet
+ * at the head of the ring ready writes it, and every ready packet after it, to
+ * the socket in IV order; the other threads return without waiting.
+ *
+ * The crypto suite passed to a send queue is shared by every sending thread,
+ * so its allocator must be thread safe. In particular, it must not be an
+ * arena.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VCBLOCKCHAIN_SEND_QUEUE_HEADER_GUARD
+#define VCBLOCKCHAIN_SEND_QUEUE_HEADER_GUARD
+
+#include <rcpr/psock.h>
+#include <rcpr/resource.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <vccrypt/suite.h>
+#include <vpr/allocator.h>
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif /*__cplusplus*/
+
+/**
+ * \brief Default number of sealed packets a send queue can hold.
+ */
+#define VCBLOCKCHAIN_SEND_QUEUE_DEFAULT_DEPTH 64U
+
+/**
+ * \brief A send queue.
+ */
+typedef struct vcblockchain_send_queue vcblockchain_send_queue;
+
+/**
+ * \brief Create a send queue for a connection.
+ *
+ * \param queue                     Pointer to the pointer to receive the send
+ *                                  queue on success.
+ * \param alloc_opts                The allocator used to allocate the queue.
+ *                                  It must outlive the queue.
+ * \param sock                      The socket to which packets are written.
+ *                                  The queue borrows this socket, which must
+ *                                  outlive the queue.
+ * \param suite                     The crypto suite used to seal packets. Its
+ *                                  allocator must be thread safe.
+ * \param shared_secret             The shared secret for this connection,
+ *                                  which must outlive the queue.
+ * \param client_iv                 The next client IV for this connection.
+ * \param depth                     The number of sealed packets that can wait
+ *                                  to be written. If zero, then
+ *                                  \ref VCBLOCKCHAIN_SEND_QUEUE_DEFAULT_DEPTH
+ *                                  is used.
+ *
+ * Once a send queue has been created, every packet sent to the server on this
+ * connection must go through the queue, or the IVs will fall out of step.
+ *
+ * On success, \p queue is set to a send queue instance. This instance is a
+ * \ref resource that is owned by the caller and must be released by calling
+ * \ref resource_release on its resource handle when it is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if the queue could not be allocated.
+ */
+int vcblockchain_send_queue_create(
+    vcblockchain_send_queue** queue, allocator_options_t* alloc_opts,
+    RCPR_SYM(psock)* sock, vccrypt_suite_options_t* suite,
+    const vccrypt_buffer_t* shared_secret, uint64_t client_iv,
+    uint32_t depth);
+
+/**
+ * \brief Get the resource handle for the given send queue.
+ *
+ * \param queue     The send queue instance to access.
+ *
+ * \returns the resource handle for this send queue instance.
+ */
+RCPR_SYM(resource)* vcblockchain_send_queue_resource_handle(
+    vcblockchain_send_queue* queue);
+
+/**
+ * \brief Reserve the next client IV.
+ *
+ * \param queue                     The send queue.
+ * \param iv                        Pointer to receive the reserved IV.
+ *
+ * This function is lock free and may be called from any thread. Every
+ * reserved IV must be passed to \ref vcblockchain_send_queue_submit exactly
+ * once, even if the packet for it could not be encoded, since no later packet
+ * can be written until it has been. A thread must not hold more reserved IVs
+ * than the depth of the queue.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ */
+int vcblockchain_send_queue_reserve(
+    vcblockchain_send_queue* queue, uint64_t* iv);
+
+/**
+ * \brief Seal a payload with a reserved IV and queue it to be written.
+ *
+ * \param queue                     The send queue.
+ * \param iv                        The IV reserved for this payload.
+ * \param payload                   The payload to seal, such as an encoded
+ *                                  request. If NULL, then the reservation is
+ *                                  abandoned, which fails the queue.
+ * \param payload_size              The size of the payload.
+ *
+ * The payload is sealed on the calling thread, without holding any lock. The
+ * sealed packet is then queued. If every packet before it has been written,
+ * then the calling thread writes it, along with any packets queued after it
+ * that are ready. Otherwise, this function returns without waiting, and the
+ * packet is written by the thread that submits the packet it follows.
+ *
+ * If the ring is full, then this function spins on \c sched_yield until the
+ * slot for \p iv has been written. That slot is only freed once every earlier
+ * IV has been submitted, so if a reserved IV is never submitted, this function
+ * blocks without bound.
+ *
+ * Because a packet may be written by another thread, a failure to write it is
+ * reported by the next call made to the queue. Once a packet could not be
+ * sealed or written, no further packets are written, since the server would
+ * reject every packet after the gap.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if this or an earlier packet could not
+ *        be written.
+ *      - a non-zero error code if this or an earlier packet could not be
+ *        sealed.
+ */
+int vcblockchain_send_queue_submit(
+    vcblockchain_send_queue* queue, uint64_t iv, const void* payload,
+    uint32_t payload_size);
+
+/**
+ * \brief Reserve an IV for a payload, then seal and queue it.
+ *
+ * \param queue                     The send queue.
+ * \param payload                   The payload to send, such as an encoded
+ *                                  request.
+ * \param payload_size              The size of the payload.
+ *
+ * This is equivalent to calling \ref vcblockchain_send_queue_reserve followed
+ * by \ref vcblockchain_send_queue_submit.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if this or an earlier packet could not
+ *        be written.
+ *      - a non-zero error code if this or an earlier packet could not be
+ *        sealed.
+ */
+int vcblockchain_send_queue_send(
+    vcblockchain_send_queue* queue, const void* payload,
+    uint32_t payload_size);
+
+/**
+ * \brief Get the next client IV that has not been reserved.
+ *
+ * \param queue                     The send queue.
+ *
+ * Once every reserved IV has been submitted and written, this is the client IV
+ * to use if the connection goes back to the lower level sendreq functions.
+ *
+ * \returns the next unreserved client IV.
+ */
+uint64_t vcblockchain_send_queue_client_iv(
+    const vcblockchain_send_queue* queue);
+
+/**
+ * \brief Return true if the given send queue is valid.
+ *
+ * \param queue     The send queue instance to check.
+ *
+ * \note This function is only available at model check time.
+ *
+ * \returns true if the instance is valid.
+ */
+bool prop_vcblockchain_send_queue_valid(const vcblockchain_send_queue* queue);
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif /*__cplusplus*/
+
+#endif /*VCBLOCKCHAIN_SEND_QUEUE_HEADER_GUARD*/
@@ -0,0 +1,302 @@
+/**
+ * \file vcblockchain/stream.h
+ *
+ * \brief Logical streams with priority lanes over a single connection.
+ *
+ * Each payload sent over a connection is sealed into a single packet, so one
+ * large payload, such as a block of up to 250 MB, holds up every small
+ * response queued behind it. A stream writer splits each payload it is given
+ * into frames on a numbered logical stream, and hands out one frame at a time.
+ * Frames from streams with a more urgent priority are handed out first, and
+ * streams that share a priority take turns a frame at a time. The sender seals
+ * each frame into its own packet, so an interactive query waits for at most one
+ * frame of bulk data instead of the whole of it. A stream reader on the other
+ * side reassembles the frames of each stream, handing back each payload once
+ * all of it has arrived.
+ *
+ * Each frame starts with \ref PROTOCOL_REQ_ID_STREAM_FRAME, followed by the
+ * stream id and the frame flags, in network byte order. The first frame of a
+ * stream is flagged with \ref VCBLOCKCHAIN_STREAM_FRAME_FLAG_START and also
+ * carries the size of the whole payload as a 64-bit value, so the reader can
+ * bound and allocate it up front. The last frame of a stream is flagged with
+ * \ref VCBLOCKCHAIN_STREAM_FRAME_FLAG_FIN. The rest of each frame is the next
+ * chunk of the payload. By convention, the stream id is the offset of the
+ * request that the payload answers, so that the reassembled payload can be
+ * routed like any other response.
+ *
+ * Neither the writer nor the reader touches a socket or a cipher. Frames can
+ * be sealed and written with \ref psock_write_authed_data, a
+ * \ref vcblockchain_send_queue or a \ref vcblockchain_async_client, and read
+ * back the same way. Neither is thread safe.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VCBLOCKCHAIN_STREAM_HEADER_GUARD
+#define VCBLOCKCHAIN_STREAM_HEADER_GUARD
+
+#include <rcpr/resource.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <vccrypt/buffer.h>
+#include <vpr/allocator.h>
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif /*__cplusplus*/
+
+/**
+ * \brief Priority for interactive traffic, such as small queries.
+ */
+#define VCBLOCKCHAIN_STREAM_PRIORITY_INTERACTIVE 0U
+
+/**
+ * \brief Priority for bulk traffic, such as blocks fetched during a sync.
+ */
+#define VCBLOCKCHAIN_STREAM_PRIORITY_BULK 1U
+
+/**
+ * \brief Flag marking the first frame of a stream.
+ */
+#define VCBLOCKCHAIN_STREAM_FRAME_FLAG_START 0x00000001U
+
+/**
+ * \brief Flag marking the last frame of a stream.
+ */
+#define VCBLOCKCHAIN_STREAM_FRAME_FLAG_FIN 0x00000002U
+
+/**
+ * \brief Size of the header at the start of every frame.
+ */
+#define VCBLOCKCHAIN_STREAM_FRAME_HEADER_SIZE (3U * sizeof(uint32_t))
+
+/**
+ * \brief Size of the header at the start of the first frame of a stream,
+ * which also carries the size of the payload.
+ */
+#define VCBLOCKCHAIN_STREAM_FRAME_START_HEADER_SIZE \
+    (VCBLOCKCHAIN_STREAM_FRAME_HEADER_SIZE + sizeof(uint64_t))
+
+/**
+ * \brief Default number of payload bytes carried by each frame.
+ */
+#define VCBLOCKCHAIN_STREAM_DEFAULT_CHUNK_SIZE 65536U
+
+/**
+ * \brief Default number of streams that can be open at once.
+ */
+#define VCBLOCKCHAIN_STREAM_DEFAULT_MAX_STREAMS 64U
+
+/**
+ * \brief A stream writer.
+ */
+typedef struct vcblockchain_stream_writer vcblockchain_stream_writer;
+
+/**
+ * \brief A stream reader.
+ */
+typedef struct vcblockchain_stream_reader vcblockchain_stream_reader;
+
+/**
+ * \brief Create a stream writer.
+ *
+ * \param writer                    Pointer to the pointer to receive the
+ *                                  stream writer on success.
+ * \param alloc_opts                The allocator used to allocate the writer.
+ *                                  It must outlive the writer.
+ * \param max_streams               The number of streams that can be open at
+ *                                  once. If zero, then
+ *                                  \ref VCBLOCKCHAIN_STREAM_DEFAULT_MAX_STREAMS
+ *                                  is used.
+ * \param chunk_size                The maximum number of payload bytes in each
+ *                                  frame. If zero, then
+ *                                  \ref VCBLOCKCHAIN_STREAM_DEFAULT_CHUNK_SIZE
+ *                                  is used.
+ *
+ * On success, \p writer is set to a stream writer instance. This instance is a
+ * \ref resource that is owned by the caller and must be released by calling
+ * \ref resource_release on its resource handle when it is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if the writer could not be
+ *        allocated.
+ */
+int vcblockchain_stream_writer_create(
+    vcblockchain_stream_writer** writer, allocator_options_t* alloc_opts,
+    uint32_t max_streams, uint32_t chunk_size);
+
+/**
+ * \brief Open a stream to send the given payload.
+ *
+ * \param writer                    The stream writer.
+ * \param stream_id                 The id of the stream, which must not be
+ *                                  open.
+ * \param priority                  The priority of the stream. Lower values
+ *                                  are more urgent.
+ * \param payload                   The payload to send, such as an encoded
+ *                                  response. It must not be empty. On success,
+ *                                  the payload is moved into the writer, and
+ *                                  this buffer is left empty.
+ *
+ * Frames are handed out in priority order, so a stream is not framed while a
+ * stream with a more urgent priority has frames left. Bulk streams should use
+ * a less urgent priority than interactive ones, and interactive payloads
+ * should be small, or they will starve the bulk streams.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided,
+ *        or if the stream is already open.
+ *      - VCBLOCKCHAIN_ERROR_STREAM_TABLE_FULL if as many streams are open as
+ *        the writer allows.
+ */
+int vcblockchain_stream_writer_submit(
+    vcblockchain_stream_writer* writer, uint32_t stream_id, uint32_t priority,
+    vccrypt_buffer_t* payload);
+
+/**
+ * \brief Get the next frame to send.
+ *
+ * \param writer                    The stream writer.
+ * \param frame                     Pointer to receive the frame. It remains
+ *                                  valid until the writer is next called.
+ * \param frame_size                Pointer to receive the size of the frame,
+ *                                  which is zero if no stream is open.
+ *
+ * The frame is taken from the open stream with the most urgent priority.
+ * Streams with the same priority take turns. Once the last frame of a stream
+ * has been handed out, the stream is closed and its payload is released.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ */
+int vcblockchain_stream_writer_next_frame(
+    vcblockchain_stream_writer* writer, const void** frame,
+    size_t* frame_size);
+
+/**
+ * \brief Get the resource handle for the given stream writer.
+ *
+ * \param writer    The stream writer instance to access.
+ *
+ * \returns the resource handle for this stream writer instance.
+ */
+RCPR_SYM(resource)* vcblockchain_stream_writer_resource_handle(
+    vcblockchain_stream_writer* writer);
+
+/**
+ * \brief Create a stream reader.
+ *
+ * \param reader                    Pointer to the pointer to receive the
+ *                                  stream reader on success.
+ * \param alloc_opts                The allocator used to allocate the reader
+ *                                  and the payloads it reassembles. It must
+ *                                  outlive the reader.
+ * \param max_streams               The number of streams that can be open at
+ *                                  once. If zero, then
+ *                                  \ref VCBLOCKCHAIN_STREAM_DEFAULT_MAX_STREAMS
+ *                                  is used.
+ * \param max_payload_size          The largest payload that a stream may
+ *                                  carry. If zero, then the maximum encrypted
+ *                                  packet size from \ref limits.h is used.
+ *
+ * Together, \p max_streams and \p max_payload_size bound the memory that a
+ * peer can make the reader hold.
+ *
+ * On success, \p reader is set to a stream reader instance. This instance is a
+ * \ref resource that is owned by the caller and must be released by calling
+ * \ref resource_release on its resource handle when it is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if the reader could not be
+ *        allocated.
+ */
+int vcblockchain_stream_reader_create(
+    vcblockchain_stream_reader** reader, allocator_options_t* alloc_opts,
+    uint32_t max_streams, uint64_t max_payload_size);
+
+/**
+ * \brief Accept a frame, and hand back the payload of its stream if the frame
+ * completes it.
+ *
+ * \param reader                    The stream reader.
+ * \param frame                     The frame, as read from the connection.
+ * \param frame_size                The size of the frame.
+ * \param stream_id                 Pointer to receive the id of the stream to
+ *                                  which the frame belongs.
+ * \param payload                   Pointer to the buffer to receive the
+ *                                  payload if the frame completes its stream.
+ *                                  On completion, this buffer is owned by the
+ *                                  caller and must be disposed.
+ * \param complete                  Pointer to receive true if the frame
+ *                                  completed its stream, and false otherwise.
+ *
+ * Any error returned by this function means that the peer has broken the
+ * framing, and the connection should be closed. If the frame belongs to an
+ * open stream, or opens one, then that stream is closed and its partial
+ * payload is released before the error is returned.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if a payload could not be
+ *        allocated.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE if the frame is
+ *        truncated, or if a stream is larger than its declared size or than
+ *        the reader allows.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the frame is not a
+ *        stream frame, or if its flags don't match the state of its stream.
+ *      - VCBLOCKCHAIN_ERROR_STREAM_TABLE_FULL if the frame opens a stream
+ *        while as many streams are open as the reader allows.
+ */
+int vcblockchain_stream_reader_input(
+    vcblockchain_stream_reader* reader, const void* frame, size_t frame_size,
+    uint32_t* stream_id, vccrypt_buffer_t* payload, bool* complete);
+
+/**
+ * \brief Get the resource handle for the given stream reader.
+ *
+ * \param reader    The stream reader instance to access.
+ *
+ * \returns the resource handle for this stream reader instance.
+ */
+RCPR_SYM(resource)* vcblockchain_stream_reader_resource_handle(
+    vcblockchain_stream_reader* reader);
+
+/**
+ * \brief Return true if the given stream writer is valid.
+ *
+ * \param writer    The stream writer instance to check.
+ *
+ * \note This function is only available at model check time.
+ *
+ * \returns true if the instance is valid.
+ */
+bool prop_vcblockchain_stream_writer_valid(
+    const vcblockchain_stream_writer* writer);
+
+/**
+ * \brief Return true if the given stream reader is valid.
+ *
+ * \param reader    The stream reader instance to check.
+ *
+ * \note This function is only available at model check time.
+ *
+ * \returns true if the instance is valid.
+ */
+bool prop_vcblockchain_stream_reader_valid(
+    const vcblockchain_stream_reader* reader);
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif /*__cplusplus*/
+
+#endif /*VCBLOCKCHAIN_STREAM_HEADER_GUARD*/
@@ -0,0 +1,57 @@
+/**
+ * \file arena/arena_internal.h
+ *
+ * \brief Internal definitions for the bump arena.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VCBLOCKCHAIN_ARENA_INTERNAL_HEADER_GUARD
+#define VCBLOCKCHAIN_ARENA_INTERNAL_HEADER_GUARD
+
+#include <stdint.h>
+#include <vcblockchain/arena.h>
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif /*__cplusplus*/
+
+/**
+ * \brief A chunk of memory owned by an arena.
+ *
+ * The usable memory for this chunk immediately follows the header, which is
+ * padded to \ref VCBLOCKCHAIN_ARENA_ALIGNMENT.
+ */
+struct vcblockchain_arena_chunk
+{
+    vcblockchain_arena_chunk* next;
+    size_t size;
+    size_t used;
+};
+
+/**
+ * \brief The size of a chunk header, rounded up to the arena alignment.
+ */
+#define VCBLOCKCHAIN_ARENA_CHUNK_HEADER_SIZE \
+    ((sizeof(vcblockchain_arena_chunk) + VCBLOCKCHAIN_ARENA_ALIGNMENT - 1) \
+        & ~((size_t)VCBLOCKCHAIN_ARENA_ALIGNMENT - 1))
+
+/**
+ * \brief Get the usable memory for a chunk.
+ *
+ * \param chunk         The chunk.
+ *
+ * \returns a pointer to the first usable byte of this chunk.
+ */
+static inline uint8_t* arena_chunk_data(vcblockchain_arena_chunk* chunk)
+{
+    return ((uint8_t*)chunk) + VCBLOCKCHAIN_ARENA_CHUNK_HEADER_SIZE;
+}
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif /*__cplusplus*/
+
+#endif /*VCBLOCKCHAIN_ARENA_INTERNAL_HEADER_GUARD*/
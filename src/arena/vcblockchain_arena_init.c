@@ -0,0 +1,247 @@
+/**
+ * \file arena/vcblockchain_arena_init.c
+ *
+ * \brief Initialize a bump arena.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vcblockchain/error_codes.h>
+
+#include "arena_internal.h"
+
+/* forward decls. */
+static void arena_dispose(void* disp);
+static void arena_alloc_opts_dispose(void* disp);
+static void* arena_allocate(void* context, size_t size);
+static void arena_release(void* context, void* mem);
+static void* arena_reallocate(
+    void* context, void* mem, size_t old_size, size_t new_size);
+static int arena_control(void* context, uint32_t key, void* value);
+
+/**
+ * \brief Initialize an arena.
+ *
+ * \param arena                     The arena to initialize.
+ * \param backing_alloc_opts        The allocator used to allocate chunks for
+ *                                  this arena. It must outlive the arena.
+ * \param chunk_size                The minimum chunk size for this arena. If
+ *                                  zero, then
+ *                                  \ref VCBLOCKCHAIN_ARENA_DEFAULT_CHUNK_SIZE
+ *                                  is used.
+ *
+ * No memory is allocated until the first allocation is made from the arena.
+ * On success, the \p arena is owned by the caller and must be disposed by
+ * calling \ref dispose() when it is no longer needed. Disposing the arena
+ * returns all chunks to the backing allocator.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ */
+int vcblockchain_arena_init(
+    vcblockchain_arena* arena, allocator_options_t* backing_alloc_opts,
+    size_t chunk_size)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != arena);
+    MODEL_ASSERT(NULL != backing_alloc_opts);
+
+    /* runtime parameter checks. */
+    if (NULL == arena || NULL == backing_alloc_opts)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* clear the arena. */
+    memset(arena, 0, sizeof(*arena));
+    arena->hdr.dispose = &arena_dispose;
+
+    /* wire the arena into its allocator options. */
+    arena->alloc_opts.hdr.dispose = &arena_alloc_opts_dispose;
+    arena->alloc_opts.allocator_fn = &arena_allocate;
+    arena->alloc_opts.allocator_release_fn = &arena_release;
+    arena->alloc_opts.allocator_realloc_fn = &arena_reallocate;
+    arena->alloc_opts.allocator_control_fn = &arena_control;
+    arena->alloc_opts.context = arena;
+
+    /* set the backing allocator and chunk size. */
+    arena->backing_alloc_opts = backing_alloc_opts;
+    arena->chunk_size =
+        (0U == chunk_size) ? VCBLOCKCHAIN_ARENA_DEFAULT_CHUNK_SIZE : chunk_size;
+
+    /* success. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
+
+/**
+ * \brief Dispose of an arena, releasing all of its chunks.
+ *
+ * \param disp      The arena to dispose.
+ */
+static void arena_dispose(void* disp)
+{
+    vcblockchain_arena* arena = (vcblockchain_arena*)disp;
+
+    /* release every chunk. */
+    vcblockchain_arena_chunk* chunk = arena->head;
+    while (NULL != chunk)
+    {
+        vcblockchain_arena_chunk* next = chunk->next;
+        release(arena->backing_alloc_opts, chunk);
+        chunk = next;
+    }
+
+    memset(arena, 0, sizeof(vcblockchain_arena));
+}
+
+/**
+ * \brief The allocator options are owned by the arena, so disposing them
+ * directly does nothing.
+ *
+ * \param disp      The allocator options to dispose.
+ */
+static void arena_alloc_opts_dispose(void* disp)
+{
+    (void)disp;
+}
+
+/**
+ * \brief Allocate memory from the arena.
+ *
+ * \param context   The arena.
+ * \param size      The size of the allocation.
+ *
+ * \returns the allocated memory, or NULL if a chunk could not be allocated.
+ */
+static void* arena_allocate(void* context, size_t size)
+{
+    vcblockchain_arena* arena = (vcblockchain_arena*)context;
+    vcblockchain_arena_chunk* chunk = arena->current;
+
+    /* round the size up to the arena alignment, guarding against overflow. */
+    if (size > SIZE_MAX - VCBLOCKCHAIN_ARENA_ALIGNMENT)
+    {
+        return NULL;
+    }
+    size_t aligned_size =
+        (size + VCBLOCKCHAIN_ARENA_ALIGNMENT - 1)
+            & ~((size_t)VCBLOCKCHAIN_ARENA_ALIGNMENT - 1);
+
+    /* fast path: bump the cursor in the current chunk. */
+    if (NULL != chunk && chunk->size - chunk->used >= aligned_size)
+    {
+        uint8_t* mem = arena_chunk_data(chunk) + chunk->used;
+        chunk->used += aligned_size;
+
+        return mem;
+    }
+
+    /* reuse the next chunk retained from before the last reset. */
+    if (NULL != chunk && NULL != chunk->next
+     && chunk->next->size >= aligned_size)
+    {
+        chunk = chunk->next;
+        chunk->used = aligned_size;
+        arena->current = chunk;
+
+        return arena_chunk_data(chunk);
+    }
+
+    /* otherwise, allocate a new chunk large enough for this request. */
+    size_t chunk_size =
+        (aligned_size > arena->chunk_size) ? aligned_size : arena->chunk_size;
+    if (chunk_size > SIZE_MAX - VCBLOCKCHAIN_ARENA_CHUNK_HEADER_SIZE)
+    {
+        return NULL;
+    }
+
+    vcblockchain_arena_chunk* new_chunk =
+        (vcblockchain_arena_chunk*)
+        allocate(
+            arena->backing_alloc_opts,
+            VCBLOCKCHAIN_ARENA_CHUNK_HEADER_SIZE + chunk_size);
+    if (NULL == new_chunk)
+    {
+        return NULL;
+    }
+
+    /* link the new chunk after the current chunk. */
+    new_chunk->size = chunk_size;
+    new_chunk->used = aligned_size;
+    if (NULL == chunk)
+    {
+        new_chunk->next = arena->head;
+        arena->head = new_chunk;
+    }
+    else
+    {
+        new_chunk->next = chunk->next;
+        chunk->next = new_chunk;
+    }
+
+    arena->current = new_chunk;
+
+    return arena_chunk_data(new_chunk);
+}
+
+/**
+ * \brief Release memory to the arena.
+ *
+ * Memory is only reclaimed when the arena is reset, so this does nothing.
+ *
+ * \param context   The arena.
+ * \param mem       The memory to release.
+ */
+static void arena_release(void* context, void* mem)
+{
+    (void)context;
+    (void)mem;
+}
+
+/**
+ * \brief Reallocate memory from the arena.
+ *
+ * \param context   The arena.
+ * \param mem       The memory to reallocate.
+ * \param old_size  The size of the previous allocation.
+ * \param new_size  The requested size.
+ *
+ * \returns the reallocated memory, or NULL if this allocation failed.
+ */
+static void* arena_reallocate(
+    void* context, void* mem, size_t old_size, size_t new_size)
+{
+    void* new_mem = arena_allocate(context, new_size);
+    if (NULL == new_mem)
+    {
+        return NULL;
+    }
+
+    if (NULL != mem)
+    {
+        memcpy(new_mem, mem, (old_size < new_size) ? old_size : new_size);
+    }
+
+    return new_mem;
+}
+
+/**
+ * \brief The arena does not support any control keys.
+ *
+ * \param context   The arena.
+ * \param key       The control key.
+ * \param value     The control value.
+ *
+ * \returns VCBLOCKCHAIN_ERROR_INVALID_ARG.
+ */
+static int arena_control(void* context, uint32_t key, void* value)
+{
+    (void)context;
+    (void)key;
+    (void)value;
+
+    return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+}
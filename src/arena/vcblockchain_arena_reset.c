@@ -0,0 +1,37 @@
+/**
+ * \file arena/vcblockchain_arena_reset.c
+ *
+ * \brief Reset a bump arena.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+
+#include "arena_internal.h"
+
+/**
+ * \brief Reset an arena, reclaiming every allocation made from it.
+ *
+ * \param arena                     The arena to reset.
+ *
+ * This is a constant time operation. Chunks are retained by the arena and
+ * reused by subsequent allocations. Any pointer previously returned by the
+ * arena is invalid after this call, so all structures decoded or buffers
+ * encoded with this arena must no longer be in use. Note that memory is not
+ * wiped by a reset; buffers holding sensitive data should be disposed before
+ * the arena is reset.
+ */
+void vcblockchain_arena_reset(vcblockchain_arena* arena)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != arena);
+
+    /* rewind to the first chunk. Later chunks are rewound as they are reused
+     * by the allocator. */
+    arena->current = arena->head;
+    if (NULL != arena->head)
+    {
+        arena->head->used = 0U;
+    }
+}
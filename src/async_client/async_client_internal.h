@@ -0,0 +1,160 @@
+/**
+ * \file async_client/async_client_internal.h
+ *
+ * \brief Internal methods and definitions for async_client.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VCBLOCKCHAIN_ASYNC_CLIENT_INTERNAL_HEADER_GUARD
+#define VCBLOCKCHAIN_ASYNC_CLIENT_INTERNAL_HEADER_GUARD
+
+#include <cbmc/model_assert.h>
+#include <rcpr/resource/protected.h>
+#include <string.h>
+#include <vcblockchain/async_client.h>
+#include <vcblockchain/error_codes.h>
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif /*__cplusplus*/
+
+/**
+ * \brief Minimum capacity of an async client buffer.
+ */
+#define ASYNC_CLIENT_BUFFER_MINIMUM_CAPACITY 4096U
+
+/**
+ * \brief The waiter for a request in flight.
+ *
+ * Waiters are indexed like the slots of the client multiplexer, so the waiter
+ * for an offset is found in constant time.
+ */
+typedef struct async_client_waiter
+{
+    vcblockchain_client_mux_completion_fn completion;
+    void* context;
+    uint64_t deadline;
+} async_client_waiter;
+
+/**
+ * \brief A byte buffer holding data waiting to be written or decrypted.
+ *
+ * The bytes from start up to end are pending. Consumed bytes are only moved
+ * out of the way when more room is needed.
+ */
+typedef struct async_client_buffer
+{
+    uint8_t* data;
+    size_t start;
+    size_t end;
+    size_t capacity;
+} async_client_buffer;
+
+/**
+ * \brief An async client.
+ */
+struct vcblockchain_async_client
+{
+    RCPR_SYM(resource) hdr;
+    allocator_options_t* alloc_opts;
+    vccrypt_suite_options_t* suite;
+    const vccrypt_buffer_t* shared_secret;
+    uint64_t client_iv;
+    uint64_t server_iv;
+    vcblockchain_client_mux mux;
+    async_client_waiter* waiters;
+    async_client_buffer output;
+    async_client_buffer input;
+
+    RCPR_MODEL_STRUCT_TAG(vcblockchain_async_client);
+};
+
+/**
+ * \brief Append data to an async client buffer, growing it if needed.
+ *
+ * \param alloc_opts    The allocator used to grow the buffer.
+ * \param buffer        The buffer to which data is appended.
+ * \param data          The data to append.
+ * \param size          The size of the data to append.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if the buffer could not be grown.
+ */
+static inline int async_client_buffer_append(
+    allocator_options_t* alloc_opts, async_client_buffer* buffer,
+    const void* data, size_t size)
+{
+    /* first, reclaim the space held by consumed bytes. */
+    if (size > buffer->capacity - buffer->end && buffer->start > 0)
+    {
+        memmove(
+            buffer->data, buffer->data + buffer->start,
+            buffer->end - buffer->start);
+        buffer->end -= buffer->start;
+        buffer->start = 0;
+    }
+
+    /* grow the buffer if it still can't hold the data. */
+    if (size > buffer->capacity - buffer->end)
+    {
+        size_t capacity = 2 * buffer->capacity;
+        if (capacity < buffer->end + size)
+        {
+            capacity = buffer->end + size;
+        }
+        if (capacity < ASYNC_CLIENT_BUFFER_MINIMUM_CAPACITY)
+        {
+            capacity = ASYNC_CLIENT_BUFFER_MINIMUM_CAPACITY;
+        }
+
+        uint8_t* grown = (uint8_t*)allocate(alloc_opts, capacity);
+        if (NULL == grown)
+        {
+            return VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+        }
+
+        if (NULL != buffer->data)
+        {
+            memcpy(grown, buffer->data, buffer->end);
+            release(alloc_opts, buffer->data);
+        }
+
+        buffer->data = grown;
+        buffer->capacity = capacity;
+    }
+
+    /* append the data. */
+    memcpy(buffer->data + buffer->end, data, size);
+    buffer->end += size;
+
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
+
+/**
+ * \brief Discard bytes from the front of an async client buffer.
+ *
+ * \param buffer        The buffer from which bytes are discarded.
+ * \param size          The number of bytes to discard, which must not exceed
+ *                      the number of pending bytes.
+ */
+static inline void async_client_buffer_consume(
+    async_client_buffer* buffer, size_t size)
+{
+    buffer->start += size;
+
+    /* once the buffer is drained, start again from the beginning. */
+    if (buffer->start == buffer->end)
+    {
+        buffer->start = buffer->end = 0;
+    }
+}
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif /*__cplusplus*/
+
+#endif /*VCBLOCKCHAIN_ASYNC_CLIENT_INTERNAL_HEADER_GUARD*/
@@ -0,0 +1,106 @@
+/**
+ * \file async_client/vcblockchain_async_client_acquire.c
+ *
+ * \brief Acquire an offset for a new asynchronous request.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "async_client_internal.h"
+
+/* forward decls. */
+static bool async_client_complete(
+    void* context, uint32_t request_id, uint32_t offset, uint32_t status,
+    const void* payload, size_t payload_size);
+
+/**
+ * \brief Acquire an offset for a new asynchronous request.
+ *
+ * \param client                    The async client.
+ * \param completion                The function to call with each response for
+ *                                  this offset.
+ * \param context                   The context passed to \p completion.
+ * \param deadline                  The time by which the first response must
+ *                                  arrive, on the clock passed to
+ *                                  \ref vcblockchain_async_client_expire, or
+ *                                  zero if the request has no deadline.
+ * \param offset                    Pointer to receive the offset to use when
+ *                                  encoding the request.
+ *
+ * The request is then encoded with the matching encode function in
+ * \ref serialization.h using this offset, and queued by calling
+ * \ref vcblockchain_async_client_submit. If it can't be encoded or queued,
+ * then the offset must be returned by calling
+ * \ref vcblockchain_async_client_release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_PIPELINE_FULL if the pipeline is full. The caller
+ *        should wait for responses to free an offset.
+ */
+int vcblockchain_async_client_acquire(
+    vcblockchain_async_client* client,
+    vcblockchain_client_mux_completion_fn completion, void* context,
+    uint64_t deadline, uint32_t* offset)
+{
+    int retval;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_vcblockchain_async_client_valid(client));
+    MODEL_ASSERT(NULL != completion);
+    MODEL_ASSERT(NULL != offset);
+
+    /* runtime parameter checks. */
+    if (NULL == client || NULL == completion || NULL == offset)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* the multiplexer routes responses back to this client. */
+    retval =
+        vcblockchain_client_mux_acquire(
+            &client->mux, &async_client_complete, client, offset);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* register the waiter. */
+    async_client_waiter* waiter =
+        client->waiters + (*offset % client->mux.depth);
+    waiter->completion = completion;
+    waiter->context = context;
+    waiter->deadline = deadline;
+
+    /* success. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
+
+/**
+ * \brief Route a response from the multiplexer to its waiter.
+ *
+ * The deadline is cleared, since it only applies to the first response.
+ */
+static bool async_client_complete(
+    void* context, uint32_t request_id, uint32_t offset, uint32_t status,
+    const void* payload, size_t payload_size)
+{
+    vcblockchain_async_client* client = (vcblockchain_async_client*)context;
+    async_client_waiter* waiter =
+        client->waiters + (offset % client->mux.depth);
+
+    waiter->deadline = 0;
+    bool keep_waiting =
+        waiter->completion(
+            waiter->context, request_id, offset, status, payload,
+            payload_size);
+
+    /* the waiter is idle once the multiplexer frees its offset. */
+    if (!keep_waiting)
+    {
+        memset(waiter, 0, sizeof(async_client_waiter));
+    }
+
+    return keep_waiting;
+}
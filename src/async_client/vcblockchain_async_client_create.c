@@ -0,0 +1,160 @@
+/**
+ * \file async_client/vcblockchain_async_client_create.c
+ *
+ * \brief Create an async client for an established connection.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "async_client_internal.h"
+
+RCPR_IMPORT_resource;
+
+/* forward decls. */
+static status async_client_resource_release(resource* r);
+
+/**
+ * \brief Create an async client for an established connection.
+ *
+ * \param client                    Pointer to the pointer to receive the async
+ *                                  client on success.
+ * \param alloc_opts                The allocator used to allocate the client
+ *                                  and its buffers. It must outlive the client.
+ * \param suite                     The crypto suite used to seal requests and
+ *                                  open responses.
+ * \param shared_secret             The shared secret for this connection,
+ *                                  which must outlive the client.
+ * \param client_iv                 The next client IV for this connection.
+ * \param server_iv                 The next server IV for this connection.
+ * \param depth                     The maximum number of requests in flight.
+ *                                  If zero, then
+ *                                  \ref VCBLOCKCHAIN_CLIENT_MUX_DEFAULT_DEPTH
+ *                                  is used.
+ *
+ * The handshake is performed beforehand, for instance with the lower level
+ * handshake functions on a blocking socket, after which the socket can be
+ * switched to non-blocking mode and handed to the event loop. Once an async
+ * client has been created, every packet on this connection must go through
+ * the client, or the IVs will fall out of step.
+ *
+ * On success, \p client is set to an async client instance. This instance is
+ * a \ref resource that is owned by the caller and must be released by calling
+ * \ref resource_release on its resource handle when it is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if the client could not be
+ *        allocated.
+ */
+int vcblockchain_async_client_create(
+    vcblockchain_async_client** client, allocator_options_t* alloc_opts,
+    vccrypt_suite_options_t* suite, const vccrypt_buffer_t* shared_secret,
+    uint64_t client_iv, uint64_t server_iv, uint32_t depth)
+{
+    int retval;
+    vcblockchain_async_client* tmp;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != client);
+    MODEL_ASSERT(NULL != alloc_opts);
+    MODEL_ASSERT(NULL != suite);
+    MODEL_ASSERT(NULL != shared_secret);
+
+    /* runtime parameter checks. */
+    if (
+        NULL == client || NULL == alloc_opts || NULL == suite
+     || NULL == shared_secret)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* allocate memory for the client. */
+    tmp = (vcblockchain_async_client*)
+        allocate(alloc_opts, sizeof(vcblockchain_async_client));
+    if (NULL == tmp)
+    {
+        retval = VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+        goto done;
+    }
+
+    /* initialize the client. */
+    memset(tmp, 0, sizeof(vcblockchain_async_client));
+    resource_init(&tmp->hdr, &async_client_resource_release);
+    tmp->alloc_opts = alloc_opts;
+    tmp->suite = suite;
+    tmp->shared_secret = shared_secret;
+    tmp->client_iv = client_iv;
+    tmp->server_iv = server_iv;
+
+    /* initialize the multiplexer. */
+    retval = vcblockchain_client_mux_init(&tmp->mux, alloc_opts, depth);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_client;
+    }
+
+    /* allocate a waiter for each slot in the multiplexer. */
+    size_t waiters_size = tmp->mux.depth * sizeof(async_client_waiter);
+    tmp->waiters = (async_client_waiter*)allocate(alloc_opts, waiters_size);
+    if (NULL == tmp->waiters)
+    {
+        retval = VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+        goto cleanup_mux;
+    }
+
+    /* every waiter starts out idle. */
+    memset(tmp->waiters, 0, waiters_size);
+
+    /* success. */
+    *client = tmp;
+    retval = VCBLOCKCHAIN_STATUS_SUCCESS;
+    goto done;
+
+cleanup_mux:
+    dispose((disposable_t*)&tmp->mux);
+
+cleanup_client:
+    memset(tmp, 0, sizeof(vcblockchain_async_client));
+    release(alloc_opts, tmp);
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Release the async client resource.
+ */
+static status async_client_resource_release(resource* r)
+{
+    vcblockchain_async_client* client = (vcblockchain_async_client*)r;
+
+    /* cache the allocator. */
+    allocator_options_t* alloc_opts = client->alloc_opts;
+
+    /* release the waiters. */
+    memset(client->waiters, 0, client->mux.depth * sizeof(async_client_waiter));
+    release(alloc_opts, client->waiters);
+
+    /* dispose the multiplexer. */
+    dispose((disposable_t*)&client->mux);
+
+    /* release the buffers. */
+    if (NULL != client->output.data)
+    {
+        memset(client->output.data, 0, client->output.capacity);
+        release(alloc_opts, client->output.data);
+    }
+    if (NULL != client->input.data)
+    {
+        memset(client->input.data, 0, client->input.capacity);
+        release(alloc_opts, client->input.data);
+    }
+
+    /* clear and release the structure. */
+    memset(client, 0, sizeof(vcblockchain_async_client));
+    release(alloc_opts, client);
+
+    /* success. */
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,76 @@
+/**
+ * \file async_client/vcblockchain_async_client_expire.c
+ *
+ * \brief Fail every request whose deadline has passed.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "async_client_internal.h"
+
+/**
+ * \brief Fail every request whose deadline has passed.
+ *
+ * \param client                    The async client.
+ * \param now                       The current time, on the same clock as the
+ *                                  deadlines passed to
+ *                                  \ref vcblockchain_async_client_acquire.
+ *
+ * The completion function for each expired request is called with a status of
+ * \ref VCBLOCKCHAIN_ERROR_REQUEST_TIMED_OUT, a request id of zero, and no
+ * payload; its return value is ignored. The offset is then abandoned with
+ * \ref vcblockchain_client_mux_abandon, so it is free for a new request at
+ * once, and a late response is quietly discarded instead of being mistaken for
+ * an error.
+ *
+ * The event loop calls this function when the timeout given by
+ * \ref vcblockchain_async_client_next_deadline elapses.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ */
+int vcblockchain_async_client_expire(
+    vcblockchain_async_client* client, uint64_t now)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_vcblockchain_async_client_valid(client));
+
+    /* runtime parameter checks. */
+    if (NULL == client)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    for (uint32_t i = 0; i < client->mux.depth; ++i)
+    {
+        async_client_waiter* waiter = client->waiters + i;
+
+        /* skip idle waiters and waiters with time left. */
+        if (
+            NULL == waiter->completion || 0 == waiter->deadline
+         || waiter->deadline > now)
+        {
+            continue;
+        }
+
+        /* free the offset, so that the pipeline does not shrink while the
+         * server is silent. */
+        uint32_t offset = client->mux.slots[i].offset;
+        int retval = vcblockchain_client_mux_abandon(&client->mux, offset);
+        if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        /* fail the request; the waiter is idle from here on. */
+        async_client_waiter expired = *waiter;
+        memset(waiter, 0, sizeof(async_client_waiter));
+        expired.completion(
+            expired.context, 0U, offset, VCBLOCKCHAIN_ERROR_REQUEST_TIMED_OUT,
+            NULL, 0U);
+    }
+
+    /* success. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
@@ -0,0 +1,101 @@
+/**
+ * \file async_client/vcblockchain_async_client_input.c
+ *
+ * \brief Accept data read from the socket and complete any responses in it.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <vcblockchain/psock.h>
+
+#include "async_client_internal.h"
+
+/**
+ * \brief Accept data read from the socket and complete any responses in it.
+ *
+ * \param client                    The async client.
+ * \param data                      The data read from the socket.
+ * \param size                      The size of the data read from the socket.
+ *
+ * When the socket is readable, the event loop reads whatever is available and
+ * passes it to this function. The data need not hold whole packets; a partial
+ * packet is kept until the rest of it arrives. Each complete response is
+ * authenticated, decrypted and routed to the completion function for its
+ * offset before this function returns. A completion function may acquire and
+ * submit new requests, but must not call this function.
+ *
+ * Any error returned by this function leaves the connection out of step, and
+ * the connection should be closed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if the input could not be grown.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_UNAUTHORIZED_PACKET if a packet could not be
+ *        authenticated.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if a response is for an
+ *        offset that is not in flight.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_async_client_input(
+    vcblockchain_async_client* client, const void* data, size_t size)
+{
+    int retval;
+    size_t packet_size;
+    vccrypt_buffer_t payload;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_vcblockchain_async_client_valid(client));
+    MODEL_ASSERT(NULL != data || 0 == size);
+
+    /* runtime parameter checks. */
+    if (NULL == client || (NULL == data && 0 != size))
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* hold the data with any partial packet left from the last call. */
+    if (size > 0)
+    {
+        retval =
+            async_client_buffer_append(
+                client->alloc_opts, &client->input, data, size);
+        if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    /* complete each whole response in the input. */
+    for (;;)
+    {
+        retval =
+            psock_open_authed_data(
+                &payload, &packet_size,
+                client->input.data + client->input.start,
+                client->input.end - client->input.start, client->server_iv,
+                client->suite, client->shared_secret);
+        if (VCBLOCKCHAIN_ERROR_SSOCK_PACKET_INCOMPLETE == retval)
+        {
+            return VCBLOCKCHAIN_STATUS_SUCCESS;
+        }
+        else if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        /* this packet has been read. */
+        client->server_iv += 1;
+        async_client_buffer_consume(&client->input, packet_size);
+
+        /* route the response to its waiter. */
+        retval =
+            vcblockchain_client_mux_complete(
+                &client->mux, payload.data, payload.size);
+        dispose((disposable_t*)&payload);
+        if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+}
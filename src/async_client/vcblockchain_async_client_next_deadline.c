@@ -0,0 +1,41 @@
+/**
+ * \file async_client/vcblockchain_async_client_next_deadline.c
+ *
+ * \brief Get the earliest deadline of any request in flight.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "async_client_internal.h"
+
+/**
+ * \brief Get the earliest deadline of any request in flight.
+ *
+ * \param client                    The async client.
+ *
+ * The event loop uses this to bound how long it waits for the socket, so that
+ * it can call \ref vcblockchain_async_client_expire in time.
+ *
+ * \returns the earliest deadline, or zero if no request in flight has one.
+ */
+uint64_t vcblockchain_async_client_next_deadline(
+    const vcblockchain_async_client* client)
+{
+    uint64_t deadline = 0;
+
+    MODEL_ASSERT(prop_vcblockchain_async_client_valid(client));
+
+    for (uint32_t i = 0; i < client->mux.depth; ++i)
+    {
+        const async_client_waiter* waiter = client->waiters + i;
+
+        if (
+            NULL != waiter->completion && 0 != waiter->deadline
+         && (0 == deadline || waiter->deadline < deadline))
+        {
+            deadline = waiter->deadline;
+        }
+    }
+
+    return deadline;
+}
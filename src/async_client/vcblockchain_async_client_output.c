@@ -0,0 +1,48 @@
+/**
+ * \file async_client/vcblockchain_async_client_output.c
+ *
+ * \brief Get the data waiting to be written to the socket.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "async_client_internal.h"
+
+/**
+ * \brief Get the data waiting to be written to the socket.
+ *
+ * \param client                    The async client.
+ * \param data                      Pointer to receive the data to write. It
+ *                                  remains valid until the output is next
+ *                                  submitted to or consumed.
+ * \param size                      Pointer to receive the size of the data to
+ *                                  write, which is zero if there is none.
+ *
+ * When the socket is writable, the event loop writes as much of this data as
+ * the socket accepts, then passes the number of bytes written to
+ * \ref vcblockchain_async_client_output_consume. While the size is zero, the
+ * event loop need not wait for the socket to become writable.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ */
+int vcblockchain_async_client_output(
+    vcblockchain_async_client* client, const void** data, size_t* size)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_vcblockchain_async_client_valid(client));
+    MODEL_ASSERT(NULL != data);
+    MODEL_ASSERT(NULL != size);
+
+    /* runtime parameter checks. */
+    if (NULL == client || NULL == data || NULL == size)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* success. */
+    *data = client->output.data + client->output.start;
+    *size = client->output.end - client->output.start;
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
@@ -0,0 +1,39 @@
+/**
+ * \file async_client/vcblockchain_async_client_output_consume.c
+ *
+ * \brief Discard data that has been written to the socket.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "async_client_internal.h"
+
+/**
+ * \brief Discard data that has been written to the socket.
+ *
+ * \param client                    The async client.
+ * \param size                      The number of bytes written to the socket.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided,
+ *        or if \p size is larger than the data waiting to be written.
+ */
+int vcblockchain_async_client_output_consume(
+    vcblockchain_async_client* client, size_t size)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_vcblockchain_async_client_valid(client));
+
+    /* runtime parameter checks. */
+    if (
+        NULL == client
+     || size > client->output.end - client->output.start)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* success. */
+    async_client_buffer_consume(&client->output, size);
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
@@ -0,0 +1,54 @@
+/**
+ * \file async_client/vcblockchain_async_client_release.c
+ *
+ * \brief Release an offset without waiting for a response.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "async_client_internal.h"
+
+/**
+ * \brief Release an offset without waiting for a response.
+ *
+ * \param client                    The async client.
+ * \param offset                    The offset to release.
+ *
+ * This is used when a request could not be encoded or queued, or to stop
+ * waiting on an offset whose completion function asked to keep waiting. It
+ * must not be called from a completion function for the offset being
+ * completed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the offset is not in flight.
+ */
+int vcblockchain_async_client_release(
+    vcblockchain_async_client* client, uint32_t offset)
+{
+    int retval;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_vcblockchain_async_client_valid(client));
+
+    /* runtime parameter checks. */
+    if (NULL == client)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* release the offset. */
+    retval = vcblockchain_client_mux_release(&client->mux, offset);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* the waiter is now idle. */
+    memset(
+        client->waiters + (offset % client->mux.depth), 0,
+        sizeof(async_client_waiter));
+
+    /* success. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
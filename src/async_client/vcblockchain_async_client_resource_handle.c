@@ -0,0 +1,24 @@
+/**
+ * \file async_client/vcblockchain_async_client_resource_handle.c
+ *
+ * \brief Get the resource handle for the given async client.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "async_client_internal.h"
+
+/**
+ * \brief Get the resource handle for the given async client.
+ *
+ * \param client    The async client instance to access.
+ *
+ * \returns the resource handle for this async client instance.
+ */
+RCPR_SYM(resource)* vcblockchain_async_client_resource_handle(
+    vcblockchain_async_client* client)
+{
+    MODEL_ASSERT(prop_vcblockchain_async_client_valid(client));
+
+    return &client->hdr;
+}
@@ -0,0 +1,81 @@
+/**
+ * \file async_client/vcblockchain_async_client_submit.c
+ *
+ * \brief Seal an encoded request and queue it to be written.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <vcblockchain/psock.h>
+
+#include "async_client_internal.h"
+
+/**
+ * \brief Seal an encoded request and queue it to be written.
+ *
+ * \param client                    The async client.
+ * \param request                   The encoded request, which carries an
+ *                                  offset acquired from this client.
+ * \param request_size              The size of the encoded request.
+ *
+ * This function does not touch the socket. The sealed request is appended to
+ * the output of this client, which the event loop writes to the socket once
+ * it is writable; see \ref vcblockchain_async_client_output.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if the output could not be grown.
+ *      - a non-zero error code if the request could not be sealed.
+ */
+int vcblockchain_async_client_submit(
+    vcblockchain_async_client* client, const void* request,
+    size_t request_size)
+{
+    int retval;
+    vccrypt_buffer_t packet;
+    vcblockchain_psock_iovec vec;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_vcblockchain_async_client_valid(client));
+    MODEL_ASSERT(NULL != request);
+
+    /* runtime parameter checks. */
+    if (NULL == client || NULL == request)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* seal the request with the next client IV. */
+    vec.data = request;
+    vec.size = request_size;
+    retval =
+        psock_seal_authed_datav(
+            &packet, client->client_iv, &vec, 1, client->suite,
+            client->shared_secret);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* queue the packet to be written. */
+    retval =
+        async_client_buffer_append(
+            client->alloc_opts, &client->output, packet.data, packet.size);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_packet;
+    }
+
+    /* the IV is only used up once the packet has been queued. */
+    client->client_iv += 1;
+
+    /* success. */
+    retval = VCBLOCKCHAIN_STATUS_SUCCESS;
+
+cleanup_packet:
+    dispose((disposable_t*)&packet);
+
+done:
+    return retval;
+}
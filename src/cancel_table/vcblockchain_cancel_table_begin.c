@@ -0,0 +1,77 @@
+/**
+ * \file cancel_table/vcblockchain_cancel_table_begin.c
+ *
+ * \brief Register a request in flight with a cancel table.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vcblockchain/cancel_table.h>
+#include <vcblockchain/error_codes.h>
+
+/**
+ * \brief Register a request that is now in flight.
+ *
+ * \param table                     The cancel table.
+ * \param offset                    The offset of the request.
+ * \param token                     Pointer to receive the token for this
+ *                                  request, which is passed to
+ *                                  \ref vcblockchain_cancel_table_is_cancelled
+ *                                  and \ref vcblockchain_cancel_table_end.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided,
+ *        or if a request with this offset is already in flight.
+ *      - VCBLOCKCHAIN_ERROR_CANCEL_TABLE_FULL if the table is full.
+ */
+int vcblockchain_cancel_table_begin(
+    vcblockchain_cancel_table* table, uint32_t offset, size_t* token)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != table);
+    MODEL_ASSERT(NULL != token);
+
+    /* runtime parameter checks. */
+    if (NULL == table || NULL == token)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* there must be a free slot. */
+    if (table->count >= table->capacity)
+    {
+        return VCBLOCKCHAIN_ERROR_CANCEL_TABLE_FULL;
+    }
+
+    /* find the first free slot, rejecting a duplicate offset. */
+    size_t free_slot = table->capacity;
+    for (size_t i = 0; i < table->capacity; ++i)
+    {
+        vcblockchain_cancel_table_entry* entry = table->entries + i;
+
+        if (!entry->in_flight)
+        {
+            if (free_slot == table->capacity)
+            {
+                free_slot = i;
+            }
+        }
+        else if (entry->offset == offset)
+        {
+            return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+        }
+    }
+
+    /* claim the slot. */
+    vcblockchain_cancel_table_entry* entry = table->entries + free_slot;
+    entry->offset = offset;
+    entry->in_flight = true;
+    entry->cancelled = false;
+    ++table->count;
+
+    /* success. */
+    *token = free_slot;
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
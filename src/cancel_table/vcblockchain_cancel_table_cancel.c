@@ -0,0 +1,53 @@
+/**
+ * \file cancel_table/vcblockchain_cancel_table_cancel.c
+ *
+ * \brief Cancel a request in flight.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vcblockchain/cancel_table.h>
+#include <vcblockchain/error_codes.h>
+
+/**
+ * \brief Cancel the request in flight at the given offset.
+ *
+ * \param table                     The cancel table.
+ * \param offset                    The offset of the request to cancel.
+ *
+ * Cancelling a request that has already been cancelled succeeds again.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS if the request was marked as cancelled.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_REQUEST_NOT_FOUND if no request with this
+ *        offset is in flight.
+ */
+int vcblockchain_cancel_table_cancel(
+    vcblockchain_cancel_table* table, uint32_t offset)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != table);
+
+    /* runtime parameter checks. */
+    if (NULL == table)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* look for the request in flight with this offset. */
+    for (size_t i = 0; i < table->capacity; ++i)
+    {
+        vcblockchain_cancel_table_entry* entry = table->entries + i;
+
+        if (entry->in_flight && entry->offset == offset)
+        {
+            entry->cancelled = true;
+            return VCBLOCKCHAIN_STATUS_SUCCESS;
+        }
+    }
+
+    /* the request has already completed, or was never sent. */
+    return VCBLOCKCHAIN_ERROR_PROTOCOL_REQUEST_NOT_FOUND;
+}
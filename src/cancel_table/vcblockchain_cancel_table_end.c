@@ -0,0 +1,33 @@
+/**
+ * \file cancel_table/vcblockchain_cancel_table_end.c
+ *
+ * \brief Remove a completed request from a cancel table.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vcblockchain/cancel_table.h>
+
+/**
+ * \brief Remove a request from the table once its final response is sent.
+ *
+ * \param table                     The cancel table.
+ * \param token                     The token returned when this request was
+ *                                  registered.
+ */
+void vcblockchain_cancel_table_end(
+    vcblockchain_cancel_table* table, size_t token)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != table);
+    MODEL_ASSERT(token < table->capacity);
+    MODEL_ASSERT(table->entries[token].in_flight);
+
+    /* free the slot. */
+    vcblockchain_cancel_table_entry* entry = table->entries + token;
+    entry->offset = 0U;
+    entry->in_flight = false;
+    entry->cancelled = false;
+    --table->count;
+}
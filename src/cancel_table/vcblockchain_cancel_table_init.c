@@ -0,0 +1,85 @@
+/**
+ * \file cancel_table/vcblockchain_cancel_table_init.c
+ *
+ * \brief Initialize a cancel table.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vcblockchain/cancel_table.h>
+#include <vcblockchain/error_codes.h>
+
+/* forward decls. */
+static void cancel_table_dispose(void* disp);
+
+/**
+ * \brief Initialize a cancel table.
+ *
+ * \param table                     The cancel table to initialize.
+ * \param alloc_opts                The allocator used to allocate the slots for
+ *                                  this table. It must outlive the table.
+ * \param capacity                  The maximum number of requests in flight
+ *                                  that this table can track.
+ *
+ * On success, the \p table is owned by the caller and must be disposed by
+ * calling \ref dispose() when it is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if the slots could not be allocated.
+ */
+int vcblockchain_cancel_table_init(
+    vcblockchain_cancel_table* table, allocator_options_t* alloc_opts,
+    size_t capacity)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != table);
+    MODEL_ASSERT(NULL != alloc_opts);
+    MODEL_ASSERT(capacity > 0U);
+
+    /* runtime parameter checks. */
+    if (NULL == table || NULL == alloc_opts || 0U == capacity
+     || capacity > SIZE_MAX / sizeof(vcblockchain_cancel_table_entry))
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* allocate the slots. */
+    size_t entries_size = capacity * sizeof(vcblockchain_cancel_table_entry);
+    vcblockchain_cancel_table_entry* entries =
+        (vcblockchain_cancel_table_entry*)allocate(alloc_opts, entries_size);
+    if (NULL == entries)
+    {
+        return VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* every slot starts out free. */
+    memset(entries, 0, entries_size);
+
+    /* initialize the table. */
+    memset(table, 0, sizeof(*table));
+    table->hdr.dispose = &cancel_table_dispose;
+    table->alloc_opts = alloc_opts;
+    table->entries = entries;
+    table->capacity = capacity;
+
+    /* success. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
+
+/**
+ * \brief Dispose of a cancel table, releasing its slots.
+ *
+ * \param disp      The cancel table to dispose.
+ */
+static void cancel_table_dispose(void* disp)
+{
+    vcblockchain_cancel_table* table = (vcblockchain_cancel_table*)disp;
+
+    release(table->alloc_opts, table->entries);
+
+    memset(table, 0, sizeof(vcblockchain_cancel_table));
+}
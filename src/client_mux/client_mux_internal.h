@@ -0,0 +1,84 @@
+/**
+ * \file client_mux/client_mux_internal.h
+ *
+ * \brief Internal definitions for the client multiplexer.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VCBLOCKCHAIN_CLIENT_MUX_INTERNAL_HEADER_GUARD
+#define VCBLOCKCHAIN_CLIENT_MUX_INTERNAL_HEADER_GUARD
+
+#include <vcblockchain/client_mux.h>
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif /*__cplusplus*/
+
+/**
+ * \brief Look up the slot holding a request in flight.
+ *
+ * \param mux           The client multiplexer.
+ * \param offset        The offset of the request.
+ *
+ * \returns the slot for this offset, or NULL if no request with this offset is
+ * in flight.
+ */
+static inline vcblockchain_client_mux_slot* client_mux_slot_for_offset(
+    vcblockchain_client_mux* mux, uint32_t offset)
+{
+    vcblockchain_client_mux_slot* slot = mux->slots + (offset % mux->depth);
+
+    if (!slot->in_flight || slot->offset != offset)
+    {
+        return NULL;
+    }
+
+    return slot;
+}
+
+/**
+ * \brief Check whether an offset belongs to an abandoned request.
+ *
+ * \param mux           The client multiplexer.
+ * \param offset        The offset of the response.
+ *
+ * An offset is late if its slot has abandoned its generation, or a later one.
+ * Earlier generations of a slot have all been answered or abandoned, so a
+ * response for one of them can only be a late one.
+ *
+ * \returns true if a response for this offset should be discarded.
+ */
+static inline bool client_mux_offset_is_late(
+    vcblockchain_client_mux* mux, uint32_t offset)
+{
+    vcblockchain_client_mux_slot* slot = mux->slots + (offset % mux->depth);
+    uint32_t generation = offset / mux->depth;
+
+    return 0U != generation && generation <= slot->abandoned_generation;
+}
+
+/**
+ * \brief Return a slot to the free list.
+ *
+ * \param mux           The client multiplexer.
+ * \param slot          The slot to free.
+ */
+static inline void client_mux_slot_free(
+    vcblockchain_client_mux* mux, vcblockchain_client_mux_slot* slot)
+{
+    slot->completion = NULL;
+    slot->context = NULL;
+    slot->in_flight = false;
+    slot->next_free = mux->free_head;
+    mux->free_head = (uint32_t)(slot - mux->slots);
+    --mux->in_flight;
+}
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif /*__cplusplus*/
+
+#endif /*VCBLOCKCHAIN_CLIENT_MUX_INTERNAL_HEADER_GUARD*/
@@ -0,0 +1,59 @@
+/**
+ * \file client_mux/vcblockchain_client_mux_abandon.c
+ *
+ * \brief Stop waiting for the response to a request that has been sent.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vcblockchain/error_codes.h>
+
+#include "client_mux_internal.h"
+
+/**
+ * \brief Stop waiting for the response to a request that has been sent.
+ *
+ * \param mux                       The client multiplexer.
+ * \param offset                    The offset to abandon.
+ *
+ * This is used when a request has timed out. Its slot is freed at once, so
+ * the pipeline does not shrink while the server is silent. If the response
+ * arrives later, then \ref vcblockchain_client_mux_complete discards it, since
+ * the slot is given a new offset before it is reused. Like
+ * \ref vcblockchain_client_mux_release, this must not be called from a
+ * completion function for the offset being completed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the offset is not in flight.
+ */
+int vcblockchain_client_mux_abandon(
+    vcblockchain_client_mux* mux, uint32_t offset)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != mux);
+
+    /* runtime parameter checks. */
+    if (NULL == mux)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* look up the slot. */
+    vcblockchain_client_mux_slot* slot =
+        client_mux_slot_for_offset(mux, offset);
+    if (NULL == slot)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* remember the abandoned generation, so a late response is discarded. */
+    slot->abandoned_generation = slot->generation;
+
+    /* free the slot. */
+    client_mux_slot_free(mux, slot);
+
+    /* success. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
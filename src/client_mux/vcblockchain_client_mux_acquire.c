@@ -0,0 +1,75 @@
+/**
+ * \file client_mux/vcblockchain_client_mux_acquire.c
+ *
+ * \brief Acquire an offset for a new request.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vcblockchain/error_codes.h>
+
+#include "client_mux_internal.h"
+
+/**
+ * \brief Acquire an offset for a new request.
+ *
+ * \param mux                       The client multiplexer.
+ * \param completion                The function to call with each response for
+ *                                  this offset.
+ * \param context                   The context passed to \p completion.
+ * \param offset                    Pointer to receive the offset to use when
+ *                                  sending the request.
+ *
+ * If sending the request fails, the offset must be returned by calling
+ * \ref vcblockchain_client_mux_release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_PIPELINE_FULL if the pipeline is full. The caller
+ *        should dispatch responses until an offset is freed.
+ */
+int vcblockchain_client_mux_acquire(
+    vcblockchain_client_mux* mux,
+    vcblockchain_client_mux_completion_fn completion, void* context,
+    uint32_t* offset)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != mux);
+    MODEL_ASSERT(NULL != completion);
+    MODEL_ASSERT(NULL != offset);
+
+    /* runtime parameter checks. */
+    if (NULL == mux || NULL == completion || NULL == offset)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* there must be a free slot. */
+    if (mux->free_head >= mux->depth)
+    {
+        return VCBLOCKCHAIN_ERROR_PIPELINE_FULL;
+    }
+
+    /* pop the first free slot. */
+    uint32_t index = mux->free_head;
+    vcblockchain_client_mux_slot* slot = mux->slots + index;
+    mux->free_head = slot->next_free;
+
+    /* give this slot a fresh offset, so a stale response for its previous
+     * request cannot be mistaken for a response to this one. The generation
+     * wraps before the offset would overflow. */
+    slot->generation = (slot->generation + 1U) % (UINT32_MAX / mux->depth);
+    slot->offset = slot->generation * mux->depth + index;
+
+    /* register the waiter. */
+    slot->completion = completion;
+    slot->context = context;
+    slot->in_flight = true;
+    ++mux->in_flight;
+
+    /* success. */
+    *offset = slot->offset;
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
@@ -0,0 +1,140 @@
+/**
+ * \file client_mux/vcblockchain_client_mux_complete.c
+ *
+ * \brief Route a response that has already been read to its waiter.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol.h>
+#include <vcblockchain/protocol/serialization.h>
+
+#include "client_mux_internal.h"
+
+/* forward decls. */
+static int client_mux_flow_credit_grant(
+    vcblockchain_client_mux* mux, const void* payload, size_t payload_size);
+
+/**
+ * \brief Route a response that has already been read to its waiter.
+ *
+ * \param mux                       The client multiplexer.
+ * \param payload                   The decrypted response, including its
+ *                                  header.
+ * \param payload_size              The size of the response.
+ *
+ * This is used by clients that read and decrypt responses themselves, such as
+ * a client driven by an event loop. The completion function for the
+ * response's offset is called before this function returns. Unless it asks to
+ * keep waiting, the offset is then freed for reuse.
+ *
+ * If flow credits are attached, then a flow credit grant response is applied
+ * to them instead. A late response for an abandoned offset is discarded.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the response is for
+ *        an offset that is neither in flight nor abandoned, or if a grant
+ *        returns more flow credits than were consumed.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE if the response
+ *        is too small to hold a header.
+ */
+int vcblockchain_client_mux_complete(
+    vcblockchain_client_mux* mux, const void* payload, size_t payload_size)
+{
+    int retval;
+    uint32_t request_id, offset, resp_status;
+    vccrypt_buffer_t view;
+    vcblockchain_client_mux_slot* slot;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != mux);
+    MODEL_ASSERT(NULL != payload);
+
+    /* runtime parameter checks. */
+    if (NULL == mux || NULL == payload)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* decode the header through a view of the payload; this view does not
+     * own the payload, so it is never disposed. */
+    view.data = (void*)payload;
+    view.size = payload_size;
+    retval =
+        vcblockchain_protocol_response_decode_header(
+            &request_id, &offset, &resp_status, &view);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* a grant from the agent returns flow credits, and has no waiter. */
+    if (
+        NULL != mux->flow_credit
+     && PROTOCOL_REQ_ID_FLOW_CREDIT_GRANT == request_id)
+    {
+        return client_mux_flow_credit_grant(mux, payload, payload_size);
+    }
+
+    /* find the waiter for this offset. */
+    slot = client_mux_slot_for_offset(mux, offset);
+    if (NULL == slot)
+    {
+        /* a late response for an abandoned request is discarded. */
+        if (client_mux_offset_is_late(mux, offset))
+        {
+            return VCBLOCKCHAIN_STATUS_SUCCESS;
+        }
+
+        return VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE;
+    }
+
+    /* complete the request, freeing its slot unless it keeps waiting. */
+    if (!slot->completion(
+            slot->context, request_id, offset, resp_status, payload,
+            payload_size))
+    {
+        client_mux_slot_free(mux, slot);
+    }
+
+    /* success. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
+
+/**
+ * \brief Apply a flow credit grant from the agent.
+ *
+ * \param mux                       The client multiplexer.
+ * \param payload                   The decrypted grant response.
+ * \param payload_size              The size of the grant response.
+ *
+ * \returns a status code indicating success or failure.
+ */
+static int client_mux_flow_credit_grant(
+    vcblockchain_client_mux* mux, const void* payload, size_t payload_size)
+{
+    int retval;
+    protocol_resp_flow_credit_grant resp;
+
+    /* decode the grant. */
+    retval =
+        vcblockchain_protocol_decode_resp_flow_credit_grant(
+            &resp, payload, payload_size);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* return the credits. */
+    retval =
+        vcblockchain_flow_credit_grant(
+            mux->flow_credit, resp.request_credits, resp.byte_credits);
+
+    dispose((disposable_t*)&resp);
+
+    return retval;
+}
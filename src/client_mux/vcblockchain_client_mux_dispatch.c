@@ -0,0 +1,95 @@
+/**
+ * \file client_mux/vcblockchain_client_mux_dispatch.c
+ *
+ * \brief Read a single response and route it to its waiter.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol.h>
+
+#include "client_mux_internal.h"
+
+/**
+ * \brief Read a single response and route it to its waiter.
+ *
+ * \param mux                       The client multiplexer.
+ * \param sock                      The socket from which the response is read.
+ * \param a                         The allocator to use for this operation.
+ * \param suite                     The crypto suite to use for this read.
+ * \param server_iv                 Pointer to the server_iv to use, updated as
+ *                                  a consequence of this call.
+ * \param shared_secret             The shared secret key for this connection.
+ *
+ * The completion function for the response's offset is called before this
+ * function returns. Unless it asks to keep waiting, the offset is then freed
+ * for reuse.
+ *
+ * If flow credits are attached, then a flow credit grant response is applied
+ * to them instead. A late response for an abandoned offset is discarded.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the response is for
+ *        an offset that is neither in flight nor abandoned.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE if the response
+ *        is too small to hold a header.
+ *      - a non-zero error response if reading the response failed.
+ */
+status vcblockchain_client_mux_dispatch(
+    vcblockchain_client_mux* mux, RCPR_SYM(psock)* sock,
+    RCPR_SYM(allocator)* a, vccrypt_suite_options_t* suite,
+    uint64_t* server_iv, const vccrypt_buffer_t* shared_secret)
+{
+    int retval, release_retval;
+    void* payload = NULL;
+    uint32_t payload_size = 0U;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != mux);
+    MODEL_ASSERT(NULL != sock);
+    MODEL_ASSERT(NULL != a);
+    MODEL_ASSERT(NULL != suite);
+    MODEL_ASSERT(NULL != server_iv);
+    MODEL_ASSERT(NULL != shared_secret);
+
+    /* runtime parameter checks. */
+    if (NULL == mux)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* read the next response. */
+    retval =
+        vcblockchain_protocol_recvresp_raw(
+            sock, a, suite, server_iv, shared_secret, &payload,
+            &payload_size);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* route the response to its waiter. */
+    retval = vcblockchain_client_mux_complete(mux, payload, payload_size);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_payload;
+    }
+
+    /* success. */
+    retval = VCBLOCKCHAIN_STATUS_SUCCESS;
+
+cleanup_payload:
+    release_retval =
+        vcblockchain_protocol_recvresp_raw_release(a, payload, payload_size);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != release_retval
+     && VCBLOCKCHAIN_STATUS_SUCCESS == retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
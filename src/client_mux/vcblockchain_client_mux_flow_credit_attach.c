@@ -0,0 +1,47 @@
+/**
+ * \file client_mux/vcblockchain_client_mux_flow_credit_attach.c
+ *
+ * \brief Attach the flow credits for sending requests.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vcblockchain/error_codes.h>
+
+#include "client_mux_internal.h"
+
+/**
+ * \brief Attach the flow credits for sending requests.
+ *
+ * \param mux                       The client multiplexer.
+ * \param credit                    The flow credit account holding the credits
+ *                                  granted by the agent, initialized with the
+ *                                  window from the negotiation. It must
+ *                                  outlive the multiplexer. If NULL, then flow
+ *                                  control is turned off.
+ *
+ * Once flow credits are attached, every flow credit grant response is applied
+ * to them instead of being routed by offset, so they must only be attached
+ * after the negotiation has completed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ */
+int vcblockchain_client_mux_flow_credit_attach(
+    vcblockchain_client_mux* mux, vcblockchain_flow_credit* credit)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != mux);
+
+    /* runtime parameter checks. */
+    if (NULL == mux)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* success. */
+    mux->flow_credit = credit;
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
@@ -0,0 +1,89 @@
+/**
+ * \file client_mux/vcblockchain_client_mux_flow_credit_consume.c
+ *
+ * \brief Consume the flow credits for a request, dispatching responses until
+ * the agent grants enough of them.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vcblockchain/error_codes.h>
+
+#include "client_mux_internal.h"
+
+/**
+ * \brief Consume the flow credits for a request, dispatching responses until
+ * the agent grants enough of them.
+ *
+ * \param mux                       The client multiplexer.
+ * \param sock                      The socket from which responses are read.
+ * \param a                         The allocator to use for this operation.
+ * \param suite                     The crypto suite to use for each read.
+ * \param server_iv                 Pointer to the server_iv to use, updated as
+ *                                  a consequence of this call.
+ * \param shared_secret             The shared secret key for this connection.
+ * \param request_size              The size of the encoded request.
+ *
+ * This is called before sending each request. While the credits granted by
+ * the agent are exhausted, this function blocks, dispatching responses with
+ * \ref vcblockchain_client_mux_dispatch until a grant arrives. A client that
+ * must not block can call \ref vcblockchain_flow_credit_consume on the
+ * attached credits instead, and treat
+ * \ref VCBLOCKCHAIN_ERROR_FLOW_CREDIT_EXHAUSTED as backpressure. If no flow
+ * credits are attached, then this function returns at once.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided,
+ *        or if the request is larger than the byte window.
+ *      - a non-zero error code if dispatching a response failed.
+ */
+status vcblockchain_client_mux_flow_credit_consume(
+    vcblockchain_client_mux* mux, RCPR_SYM(psock)* sock,
+    RCPR_SYM(allocator)* a, vccrypt_suite_options_t* suite,
+    uint64_t* server_iv, const vccrypt_buffer_t* shared_secret,
+    size_t request_size)
+{
+    int retval;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != mux);
+    MODEL_ASSERT(NULL != sock);
+    MODEL_ASSERT(NULL != a);
+    MODEL_ASSERT(NULL != suite);
+    MODEL_ASSERT(NULL != server_iv);
+    MODEL_ASSERT(NULL != shared_secret);
+
+    /* runtime parameter checks. */
+    if (NULL == mux)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* without flow control, every request may be sent. */
+    if (NULL == mux->flow_credit)
+    {
+        return VCBLOCKCHAIN_STATUS_SUCCESS;
+    }
+
+    /* dispatch responses until the agent grants enough credits. */
+    for (;;)
+    {
+        retval =
+            vcblockchain_flow_credit_consume(
+                mux->flow_credit, 1U, (uint64_t)request_size);
+        if (VCBLOCKCHAIN_ERROR_FLOW_CREDIT_EXHAUSTED != retval)
+        {
+            return retval;
+        }
+
+        retval =
+            vcblockchain_client_mux_dispatch(
+                mux, sock, a, suite, server_iv, shared_secret);
+        if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+}
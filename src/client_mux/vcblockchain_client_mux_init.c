@@ -0,0 +1,98 @@
+/**
+ * \file client_mux/vcblockchain_client_mux_init.c
+ *
+ * \brief Initialize a client multiplexer.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vcblockchain/error_codes.h>
+
+#include "client_mux_internal.h"
+
+/* forward decls. */
+static void client_mux_dispose(void* disp);
+
+/**
+ * \brief Initialize a client multiplexer.
+ *
+ * \param mux                       The client multiplexer to initialize.
+ * \param alloc_opts                The allocator used to allocate the slots.
+ *                                  It must outlive the multiplexer.
+ * \param depth                     The maximum number of requests in flight.
+ *                                  If zero, then
+ *                                  \ref VCBLOCKCHAIN_CLIENT_MUX_DEFAULT_DEPTH
+ *                                  is used.
+ *
+ * On success, the \p mux is owned by the caller and must be disposed by
+ * calling \ref dispose() when it is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if the slots could not be allocated.
+ */
+int vcblockchain_client_mux_init(
+    vcblockchain_client_mux* mux, allocator_options_t* alloc_opts,
+    uint32_t depth)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != mux);
+    MODEL_ASSERT(NULL != alloc_opts);
+
+    /* runtime parameter checks. */
+    if (NULL == mux || NULL == alloc_opts || UINT32_MAX == depth)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* use the default depth if none was given. */
+    if (0U == depth)
+    {
+        depth = VCBLOCKCHAIN_CLIENT_MUX_DEFAULT_DEPTH;
+    }
+
+    /* allocate the slots. */
+    size_t slots_size = (size_t)depth * sizeof(vcblockchain_client_mux_slot);
+    vcblockchain_client_mux_slot* slots =
+        (vcblockchain_client_mux_slot*)allocate(alloc_opts, slots_size);
+    if (NULL == slots)
+    {
+        return VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* chain every slot onto the free list, in order. */
+    memset(slots, 0, slots_size);
+    for (uint32_t i = 0; i < depth; ++i)
+    {
+        slots[i].offset = i;
+        slots[i].next_free = i + 1;
+    }
+
+    /* initialize the multiplexer. */
+    memset(mux, 0, sizeof(*mux));
+    mux->hdr.dispose = &client_mux_dispose;
+    mux->alloc_opts = alloc_opts;
+    mux->slots = slots;
+    mux->depth = depth;
+    mux->free_head = 0U;
+
+    /* success. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
+
+/**
+ * \brief Dispose of a client multiplexer, releasing its slots.
+ *
+ * \param disp      The client multiplexer to dispose.
+ */
+static void client_mux_dispose(void* disp)
+{
+    vcblockchain_client_mux* mux = (vcblockchain_client_mux*)disp;
+
+    release(mux->alloc_opts, mux->slots);
+
+    memset(mux, 0, sizeof(vcblockchain_client_mux));
+}
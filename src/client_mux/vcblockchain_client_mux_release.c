@@ -0,0 +1,53 @@
+/**
+ * \file client_mux/vcblockchain_client_mux_release.c
+ *
+ * \brief Release an offset without waiting for a response.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vcblockchain/error_codes.h>
+
+#include "client_mux_internal.h"
+
+/**
+ * \brief Release an offset without waiting for a response.
+ *
+ * \param mux                       The client multiplexer.
+ * \param offset                    The offset to release.
+ *
+ * This is used when a request could not be sent, or to stop waiting on an
+ * offset whose completion function asked to keep waiting. It must not be
+ * called from a completion function for the offset being completed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the offset is not in flight.
+ */
+int vcblockchain_client_mux_release(
+    vcblockchain_client_mux* mux, uint32_t offset)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != mux);
+
+    /* runtime parameter checks. */
+    if (NULL == mux)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* look up the slot. */
+    vcblockchain_client_mux_slot* slot =
+        client_mux_slot_for_offset(mux, offset);
+    if (NULL == slot)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* free the slot. */
+    client_mux_slot_free(mux, slot);
+
+    /* success. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
@@ -0,0 +1,38 @@
+/**
+ * \file client_pool/client_pool_entry_close.c
+ *
+ * \brief Close the connection held by a client pool entry.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <string.h>
+
+#include "client_pool_internal.h"
+
+RCPR_IMPORT_psock;
+RCPR_IMPORT_resource;
+
+/**
+ * \brief Close the connection held by an entry, leaving it empty.
+ *
+ * \param entry         The entry to close.
+ */
+void client_pool_entry_close(client_pool_entry* entry)
+{
+    MODEL_ASSERT(NULL != entry);
+
+    /* the session borrows the socket, so it is released first. */
+    if (NULL != entry->session)
+    {
+        resource_release(
+            vcblockchain_client_session_resource_handle(entry->session));
+    }
+
+    if (NULL != entry->sock)
+    {
+        resource_release(psock_resource_handle(entry->sock));
+    }
+
+    memset(entry, 0, sizeof(client_pool_entry));
+}
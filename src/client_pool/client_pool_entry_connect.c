@@ -0,0 +1,85 @@
+/**
+ * \file client_pool/client_pool_entry_connect.c
+ *
+ * \brief Connect a client pool entry and perform the handshake.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <string.h>
+#include <vccrypt/compare.h>
+
+#include "client_pool_internal.h"
+
+/**
+ * \brief Connect an empty entry and perform the handshake.
+ *
+ * \param pool          The client pool.
+ * \param entry         The empty entry to connect.
+ *
+ * The server must present the identity and public key that the pool was
+ * created with; otherwise, the connection is closed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the server presented
+ *        a different identity or public key.
+ *      - a non-zero error code if the connection or handshake failed.
+ */
+int client_pool_entry_connect(
+    vcblockchain_client_pool* pool, client_pool_entry* entry)
+{
+    int retval;
+    vpr_uuid server_id;
+    vccrypt_buffer_t server_pubkey;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_vcblockchain_client_pool_valid(pool));
+    MODEL_ASSERT(NULL != entry);
+    MODEL_ASSERT(NULL == entry->sock);
+
+    /* open a new connection. */
+    retval = pool->connect(pool->connect_context, &entry->sock);
+    if (STATUS_SUCCESS != retval)
+    {
+        entry->sock = NULL;
+        goto done;
+    }
+
+    /* perform the handshake. */
+    retval =
+        vcblockchain_client_session_create(
+            &entry->session, entry->sock, pool->alloc, pool->suite,
+            pool->client_id, pool->client_privkey, &server_id,
+            &server_pubkey);
+    if (STATUS_SUCCESS != retval)
+    {
+        entry->session = NULL;
+        goto close_entry;
+    }
+
+    /* prevent a man-in-the-middle attack by checking the server identity. */
+    bool identity_matches =
+        0 == memcmp(&server_id, pool->server_id, sizeof(server_id))
+     && server_pubkey.size == pool->server_pubkey->size
+     && 0 ==
+            crypto_memcmp(
+                server_pubkey.data, pool->server_pubkey->data,
+                server_pubkey.size);
+    dispose((disposable_t*)&server_pubkey);
+    if (!identity_matches)
+    {
+        retval = VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE;
+        goto close_entry;
+    }
+
+    /* success. */
+    retval = VCBLOCKCHAIN_STATUS_SUCCESS;
+    goto done;
+
+close_entry:
+    client_pool_entry_close(entry);
+
+done:
+    return retval;
+}
@@ -0,0 +1,91 @@
+/**
+ * \file client_pool/client_pool_internal.h
+ *
+ * \brief Internal methods and definitions for client_pool.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VCBLOCKCHAIN_CLIENT_POOL_INTERNAL_HEADER_GUARD
+#define VCBLOCKCHAIN_CLIENT_POOL_INTERNAL_HEADER_GUARD
+
+#include <cbmc/model_assert.h>
+#include <rcpr/resource/protected.h>
+#include <vcblockchain/client_pool.h>
+#include <vcblockchain/error_codes.h>
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif /*__cplusplus*/
+
+/**
+ * \brief A connection held by a client pool.
+ *
+ * An entry with no socket is empty, and is reconnected by the next call to
+ * \ref vcblockchain_client_pool_maintain.
+ */
+typedef struct client_pool_entry
+{
+    RCPR_SYM(psock)* sock;
+    vcblockchain_client_session* session;
+    bool leased;
+} client_pool_entry;
+
+/**
+ * \brief A client pool.
+ *
+ * The idle array is a stack of the indices of idle entries. The most recently
+ * returned entry is on top, and is the next one handed out.
+ */
+struct vcblockchain_client_pool
+{
+    RCPR_SYM(resource) hdr;
+    allocator_options_t* alloc_opts;
+    RCPR_SYM(allocator)* alloc;
+    vccrypt_suite_options_t* suite;
+    vcblockchain_client_pool_connect_fn connect;
+    void* connect_context;
+    const vpr_uuid* client_id;
+    const vccrypt_buffer_t* client_privkey;
+    const vpr_uuid* server_id;
+    const vccrypt_buffer_t* server_pubkey;
+    client_pool_entry* entries;
+    uint32_t* idle;
+    uint32_t idle_count;
+    uint32_t size;
+
+    RCPR_MODEL_STRUCT_TAG(vcblockchain_client_pool);
+};
+
+/**
+ * \brief Connect an empty entry and perform the handshake.
+ *
+ * \param pool          The client pool.
+ * \param entry         The empty entry to connect.
+ *
+ * The server must present the identity and public key that the pool was
+ * created with; otherwise, the connection is closed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the server presented
+ *        a different identity or public key.
+ *      - a non-zero error code if the connection or handshake failed.
+ */
+int client_pool_entry_connect(
+    vcblockchain_client_pool* pool, client_pool_entry* entry);
+
+/**
+ * \brief Close the connection held by an entry, leaving it empty.
+ *
+ * \param entry         The entry to close.
+ */
+void client_pool_entry_close(client_pool_entry* entry);
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif /*__cplusplus*/
+
+#endif /*VCBLOCKCHAIN_CLIENT_POOL_INTERNAL_HEADER_GUARD*/
@@ -0,0 +1,77 @@
+/**
+ * \file client_pool/vcblockchain_client_pool_acquire.c
+ *
+ * \brief Acquire a session from a client pool.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "client_pool_internal.h"
+
+/**
+ * \brief Acquire a session from a client pool.
+ *
+ * \param pool                      The client pool.
+ * \param session                   Pointer to receive the session.
+ *
+ * The most recently returned idle session is handed out first, since its
+ * connection, buffers and arena are the most likely to still be warm. If no
+ * session is idle, then an empty entry is connected on the spot, paying the
+ * full cost of the connection and handshake.
+ *
+ * The session remains owned by the pool. It must be returned by calling
+ * \ref vcblockchain_client_pool_release, and must not be released directly.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_POOL_EXHAUSTED if every session is in use.
+ *      - a non-zero error code if a new session could not be opened.
+ */
+int vcblockchain_client_pool_acquire(
+    vcblockchain_client_pool* pool, vcblockchain_client_session** session)
+{
+    int retval;
+    client_pool_entry* entry;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_vcblockchain_client_pool_valid(pool));
+    MODEL_ASSERT(NULL != session);
+
+    /* runtime parameter checks. */
+    if (NULL == pool || NULL == session)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* hand out the session on top of the idle stack. */
+    if (pool->idle_count > 0)
+    {
+        entry = pool->entries + pool->idle[--pool->idle_count];
+        goto success;
+    }
+
+    /* otherwise, connect an empty entry. */
+    for (uint32_t i = 0; i < pool->size; ++i)
+    {
+        entry = pool->entries + i;
+        if (NULL == entry->sock)
+        {
+            retval = client_pool_entry_connect(pool, entry);
+            if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+
+            goto success;
+        }
+    }
+
+    /* every session is in use. */
+    return VCBLOCKCHAIN_ERROR_POOL_EXHAUSTED;
+
+success:
+    entry->leased = true;
+    *session = entry->session;
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
@@ -0,0 +1,170 @@
+/**
+ * \file client_pool/vcblockchain_client_pool_create.c
+ *
+ * \brief Create a pool of client sessions to a single agent.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <string.h>
+
+#include "client_pool_internal.h"
+
+RCPR_IMPORT_resource;
+
+/* forward decls. */
+static status client_pool_resource_release(resource* r);
+
+/**
+ * \brief Create a pool of client sessions to a single agent.
+ *
+ * \param pool                      Pointer to the pointer to receive the client
+ *                                  pool on success.
+ * \param alloc_opts                The allocator used to allocate the pool. It
+ *                                  must outlive the pool.
+ * \param a                         The allocator used by each session to
+ *                                  receive responses. It must outlive the
+ *                                  pool.
+ * \param suite                     The crypto suite to use for each session.
+ *                                  It must outlive the pool.
+ * \param connect                   The function used to open each connection.
+ * \param connect_context           The context passed to \p connect.
+ * \param client_id                 The entity UUID for the client.
+ * \param client_privkey            The client private key.
+ * \param server_id                 The UUID that the agent must present.
+ * \param server_pubkey             The public key that the agent must present.
+ * \param size                      The number of sessions to keep.
+ *
+ * Every argument is borrowed and must outlive the pool. The pool starts out
+ * empty; call \ref vcblockchain_client_pool_maintain to open its sessions
+ * before the first request arrives.
+ *
+ * On success, \p pool is set to a client pool instance. This instance is a
+ * \ref resource that is owned by the caller and must be released by calling
+ * \ref resource_release on its resource handle when it is no longer needed.
+ * Every session acquired from the pool must be returned to it first.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if the pool could not be allocated.
+ */
+int vcblockchain_client_pool_create(
+    vcblockchain_client_pool** pool, allocator_options_t* alloc_opts,
+    RCPR_SYM(allocator)* a, vccrypt_suite_options_t* suite,
+    vcblockchain_client_pool_connect_fn connect, void* connect_context,
+    const vpr_uuid* client_id, const vccrypt_buffer_t* client_privkey,
+    const vpr_uuid* server_id, const vccrypt_buffer_t* server_pubkey,
+    uint32_t size)
+{
+    int retval;
+    vcblockchain_client_pool* tmp;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != pool);
+    MODEL_ASSERT(NULL != alloc_opts);
+    MODEL_ASSERT(NULL != a);
+    MODEL_ASSERT(NULL != suite);
+    MODEL_ASSERT(NULL != connect);
+    MODEL_ASSERT(NULL != client_id);
+    MODEL_ASSERT(NULL != client_privkey);
+    MODEL_ASSERT(NULL != server_id);
+    MODEL_ASSERT(NULL != server_pubkey);
+    MODEL_ASSERT(size > 0);
+
+    /* runtime parameter checks. */
+    if (
+        NULL == pool || NULL == alloc_opts || NULL == a || NULL == suite
+     || NULL == connect || NULL == client_id || NULL == client_privkey
+     || NULL == server_id || NULL == server_pubkey || 0 == size)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* allocate memory for the pool. */
+    tmp = (vcblockchain_client_pool*)
+        allocate(alloc_opts, sizeof(vcblockchain_client_pool));
+    if (NULL == tmp)
+    {
+        retval = VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+        goto done;
+    }
+
+    /* initialize the pool. */
+    memset(tmp, 0, sizeof(vcblockchain_client_pool));
+    resource_init(&tmp->hdr, &client_pool_resource_release);
+    tmp->alloc_opts = alloc_opts;
+    tmp->alloc = a;
+    tmp->suite = suite;
+    tmp->connect = connect;
+    tmp->connect_context = connect_context;
+    tmp->client_id = client_id;
+    tmp->client_privkey = client_privkey;
+    tmp->server_id = server_id;
+    tmp->server_pubkey = server_pubkey;
+    tmp->size = size;
+
+    /* allocate the entries, which all start out empty. */
+    size_t entries_size = size * sizeof(client_pool_entry);
+    tmp->entries = (client_pool_entry*)allocate(alloc_opts, entries_size);
+    if (NULL == tmp->entries)
+    {
+        retval = VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+        goto cleanup_pool;
+    }
+
+    memset(tmp->entries, 0, entries_size);
+
+    /* allocate the idle stack. */
+    tmp->idle = (uint32_t*)allocate(alloc_opts, size * sizeof(uint32_t));
+    if (NULL == tmp->idle)
+    {
+        retval = VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+        goto cleanup_entries;
+    }
+
+    /* success. */
+    *pool = tmp;
+    retval = VCBLOCKCHAIN_STATUS_SUCCESS;
+    goto done;
+
+cleanup_entries:
+    release(alloc_opts, tmp->entries);
+
+cleanup_pool:
+    memset(tmp, 0, sizeof(vcblockchain_client_pool));
+    release(alloc_opts, tmp);
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Release the client pool resource.
+ */
+static status client_pool_resource_release(resource* r)
+{
+    vcblockchain_client_pool* pool = (vcblockchain_client_pool*)r;
+
+    /* cache the allocator. */
+    allocator_options_t* alloc_opts = pool->alloc_opts;
+
+    /* close every connection. */
+    for (uint32_t i = 0; i < pool->size; ++i)
+    {
+        MODEL_ASSERT(!pool->entries[i].leased);
+
+        client_pool_entry_close(pool->entries + i);
+    }
+
+    /* release the entries and the idle stack. */
+    release(alloc_opts, pool->entries);
+    release(alloc_opts, pool->idle);
+
+    /* clear and release the structure. */
+    memset(pool, 0, sizeof(vcblockchain_client_pool));
+    release(alloc_opts, pool);
+
+    /* success. */
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,168 @@
+/**
+ * \file client_pool/vcblockchain_client_pool_maintain.c
+ *
+ * \brief Check the idle sessions in a client pool and replace failed ones.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <string.h>
+#include <vcblockchain/protocol/data.h>
+
+#include "client_pool_internal.h"
+
+/* forward decls. */
+static int client_pool_probe(vcblockchain_client_session* session);
+
+/**
+ * \brief Check the idle sessions in a client pool and replace failed ones.
+ *
+ * \param pool                      The client pool.
+ *
+ * Each idle session is probed with a status request. A session whose probe
+ * fails is closed. Every empty entry, whether its session failed a probe or
+ * was returned as unhealthy, is then reconnected, so that the pool holds its
+ * full number of sessions again. New sessions go to the bottom of the idle
+ * stack, so that warmer sessions are still handed out first.
+ *
+ * This keeps connection and handshake costs out of the request path. The
+ * caller runs it from a housekeeping timer or thread; the pool is not thread
+ * safe, so calls to this function must be serialized with every other call on
+ * the pool. Because a probe blocks until its response arrives, the connect
+ * function should set a receive timeout on each socket it opens.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS if every session is healthy.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - the first error encountered while opening a session. Sessions that
+ *        could not be opened are retried by the next call.
+ */
+int vcblockchain_client_pool_maintain(vcblockchain_client_pool* pool)
+{
+    int retval = VCBLOCKCHAIN_STATUS_SUCCESS;
+    uint32_t kept = 0;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_vcblockchain_client_pool_valid(pool));
+
+    /* runtime parameter checks. */
+    if (NULL == pool)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* probe the idle sessions, keeping the survivors in stack order. */
+    for (uint32_t i = 0; i < pool->idle_count; ++i)
+    {
+        client_pool_entry* entry = pool->entries + pool->idle[i];
+
+        if (VCBLOCKCHAIN_STATUS_SUCCESS == client_pool_probe(entry->session))
+        {
+            pool->idle[kept++] = pool->idle[i];
+        }
+        else
+        {
+            client_pool_entry_close(entry);
+        }
+    }
+
+    pool->idle_count = kept;
+
+    /* replace every empty entry. */
+    for (uint32_t i = 0; i < pool->size; ++i)
+    {
+        client_pool_entry* entry = pool->entries + i;
+        if (NULL != entry->sock)
+        {
+            continue;
+        }
+
+        int connect_retval = client_pool_entry_connect(pool, entry);
+        if (VCBLOCKCHAIN_STATUS_SUCCESS != connect_retval)
+        {
+            if (VCBLOCKCHAIN_STATUS_SUCCESS == retval)
+            {
+                retval = connect_retval;
+            }
+
+            continue;
+        }
+
+        /* the new session goes to the bottom of the idle stack. */
+        memmove(
+            pool->idle + 1, pool->idle, pool->idle_count * sizeof(uint32_t));
+        pool->idle[0] = i;
+        ++pool->idle_count;
+    }
+
+    return retval;
+}
+
+/**
+ * \brief Probe a session with a status request.
+ *
+ * \param session                   The session to probe.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS if the agent answered the probe.
+ *      - a non-zero error code if the session is no longer usable.
+ */
+static int client_pool_probe(vcblockchain_client_session* session)
+{
+    int retval, release_retval;
+    uint32_t offset, request_id, resp_offset, resp_status;
+    void* payload;
+    uint32_t payload_size;
+    vccrypt_buffer_t view;
+
+    /* send the probe. */
+    retval = vcblockchain_client_session_sendreq_status_get(session, &offset);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* receive the answer. */
+    retval =
+        vcblockchain_client_session_recvresp_raw(
+            session, &payload, &payload_size);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* decode the header through a view of the payload; this view does not
+     * own the payload, so it is never disposed. */
+    view.data = payload;
+    view.size = payload_size;
+    retval =
+        vcblockchain_protocol_response_decode_header(
+            &request_id, &resp_offset, &resp_status, &view);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_payload;
+    }
+
+    /* the answer must be a successful response to this probe. */
+    if (PROTOCOL_REQ_ID_STATUS_GET != request_id || offset != resp_offset)
+    {
+        retval = VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE;
+        goto cleanup_payload;
+    }
+
+    /* success. */
+    retval = (int)resp_status;
+
+cleanup_payload:
+    release_retval =
+        vcblockchain_client_session_recvresp_raw_release(
+            session, payload, payload_size);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != release_retval
+     && VCBLOCKCHAIN_STATUS_SUCCESS == retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
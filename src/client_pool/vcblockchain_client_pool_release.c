@@ -0,0 +1,69 @@
+/**
+ * \file client_pool/vcblockchain_client_pool_release.c
+ *
+ * \brief Return a session to a client pool.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "client_pool_internal.h"
+
+/**
+ * \brief Return a session to a client pool.
+ *
+ * \param pool                      The client pool.
+ * \param session                   The session to return, which was acquired
+ *                                  from this pool.
+ * \param healthy                   true if the session can be reused. This
+ *                                  must be false if a request on the session
+ *                                  failed, or if a response is still
+ *                                  outstanding, since the session is then out
+ *                                  of step with its connection.
+ *
+ * A healthy session goes on top of the idle stack, to be handed out next. An
+ * unhealthy session is closed, and its entry is reconnected by the next call
+ * to \ref vcblockchain_client_pool_maintain.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the session was not acquired from
+ *        this pool.
+ */
+int vcblockchain_client_pool_release(
+    vcblockchain_client_pool* pool, vcblockchain_client_session* session,
+    bool healthy)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_vcblockchain_client_pool_valid(pool));
+    MODEL_ASSERT(NULL != session);
+
+    /* runtime parameter checks. */
+    if (NULL == pool || NULL == session)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    for (uint32_t i = 0; i < pool->size; ++i)
+    {
+        client_pool_entry* entry = pool->entries + i;
+        if (!entry->leased || entry->session != session)
+        {
+            continue;
+        }
+
+        /* close an unhealthy session. */
+        if (!healthy)
+        {
+            client_pool_entry_close(entry);
+            return VCBLOCKCHAIN_STATUS_SUCCESS;
+        }
+
+        /* push a healthy session onto the idle stack. */
+        entry->leased = false;
+        pool->idle[pool->idle_count++] = i;
+        return VCBLOCKCHAIN_STATUS_SUCCESS;
+    }
+
+    /* this session is not leased from this pool. */
+    return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+}
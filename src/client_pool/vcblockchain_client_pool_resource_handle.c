@@ -0,0 +1,24 @@
+/**
+ * \file client_pool/vcblockchain_client_pool_resource_handle.c
+ *
+ * \brief Get the resource handle for the given client pool.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "client_pool_internal.h"
+
+/**
+ * \brief Get the resource handle for the given client pool.
+ *
+ * \param pool      The client pool instance to access.
+ *
+ * \returns the resource handle for this client pool instance.
+ */
+RCPR_SYM(resource)* vcblockchain_client_pool_resource_handle(
+    vcblockchain_client_pool* pool)
+{
+    MODEL_ASSERT(prop_vcblockchain_client_pool_valid(pool));
+
+    return &pool->hdr;
+}
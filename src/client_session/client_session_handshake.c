@@ -0,0 +1,216 @@
+/**
+ * \file client_session/client_session_handshake.c
+ *
+ * \brief Perform the handshake with the API and create a client session.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <string.h>
+#include <vcblockchain/protocol/serialization.h>
+
+#include "client_session_internal.h"
+
+/**
+ * \brief Perform the handshake with the API and create a client session for
+ * the resulting connection.
+ *
+ * \param session                   Pointer to the pointer to receive the
+ *                                  client session on success.
+ * \param sock                      The socket connected to the API.
+ * \param a                         The allocator used to receive responses.
+ * \param suite                     The crypto suite to use for this session.
+ * \param client_id                 The entity UUID for the client.
+ * \param client_privkey            The client private key.
+ * \param server_id                 The uuid pointer to receive the server's
+ *                                  uuid.
+ * \param server_pubkey             The buffer to hold the public key received
+ *                                  from the server.
+ * \param request                   The encoded first request to send with the
+ *                                  handshake acknowledgement, or NULL to send
+ *                                  the acknowledgement alone.
+ * \param request_size              The size of the encoded first request.
+ *
+ * The arguments have already been checked by the caller.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the response to the
+ *        handshake acknowledgement was not a handshake acknowledgement.
+ *      - the status returned by the server if it rejected the handshake.
+ *      - a non-zero error code on failure.
+ */
+status client_session_handshake(
+    vcblockchain_client_session** session, RCPR_SYM(psock)* sock,
+    RCPR_SYM(allocator)* a, vccrypt_suite_options_t* suite,
+    const vpr_uuid* client_id, const vccrypt_buffer_t* client_privkey,
+    vpr_uuid* server_id, vccrypt_buffer_t* server_pubkey,
+    const void* request, uint32_t request_size)
+{
+    status retval, release_retval;
+    vcblockchain_client_session* tmp;
+    vccrypt_buffer_t client_key_nonce;
+    vccrypt_buffer_t client_challenge_nonce;
+    vccrypt_buffer_t server_challenge_nonce;
+    protocol_resp_handshake_ack ack;
+    uint32_t offset, resp_status;
+    void* payload = NULL;
+    uint32_t payload_size = 0U;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != session);
+    MODEL_ASSERT(NULL != sock);
+    MODEL_ASSERT(NULL != a);
+    MODEL_ASSERT(NULL != suite);
+    MODEL_ASSERT(NULL != client_id);
+    MODEL_ASSERT(NULL != client_privkey);
+    MODEL_ASSERT(NULL != server_id);
+    MODEL_ASSERT(NULL != server_pubkey);
+
+    /* allocate memory for the session. */
+    tmp = (vcblockchain_client_session*)
+        allocate(suite->alloc_opts, sizeof(vcblockchain_client_session));
+    if (NULL == tmp)
+    {
+        retval = VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+        goto done;
+    }
+
+    /* clear the session. */
+    memset(tmp, 0, sizeof(vcblockchain_client_session));
+
+    /* send the handshake request. */
+    retval =
+        vcblockchain_protocol_sendreq_handshake_request(
+            sock, suite, client_id, &client_key_nonce,
+            &client_challenge_nonce);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto free_tmp;
+    }
+
+    /* receive the handshake response, computing the shared secret. */
+    retval =
+        vcblockchain_protocol_recvresp_handshake_request(
+            sock, a, suite, server_id, server_pubkey, client_privkey,
+            &client_key_nonce, &client_challenge_nonce,
+            &server_challenge_nonce, &tmp->shared_secret, &offset,
+            &resp_status);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_client_nonces;
+    }
+
+    /* the server must have accepted the handshake request. */
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != resp_status)
+    {
+        retval = (status)resp_status;
+        goto cleanup_server_handshake;
+    }
+
+    /* send the handshake ack, which sets the IVs for this session. */
+    if (NULL == request)
+    {
+        retval =
+            vcblockchain_protocol_sendreq_handshake_ack(
+                sock, suite, &tmp->client_iv, &tmp->server_iv,
+                &tmp->shared_secret, &server_challenge_nonce);
+    }
+    else
+    {
+        /* the first request rides along with the ack, using offset 0. */
+        retval =
+            vcblockchain_protocol_sendreq_handshake_ack_with_request(
+                sock, suite, &tmp->client_iv, &tmp->server_iv,
+                &tmp->shared_secret, &server_challenge_nonce, request,
+                request_size);
+    }
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_server_handshake;
+    }
+
+    /* receive the handshake ack response. */
+    retval =
+        vcblockchain_protocol_recvresp_raw(
+            sock, a, suite, &tmp->server_iv, &tmp->shared_secret, &payload,
+            &payload_size);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_server_handshake;
+    }
+
+    /* decode the handshake ack response, then release its payload. */
+    retval =
+        vcblockchain_protocol_decode_resp_handshake_ack(
+            &ack, payload, payload_size);
+    release_retval =
+        vcblockchain_protocol_recvresp_raw_release(a, payload, payload_size);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_server_handshake;
+    }
+
+    /* the response must be an ack, and the server must have accepted it. */
+    if (PROTOCOL_REQ_ID_HANDSHAKE_ACKNOWLEDGE != ack.request_id)
+    {
+        retval = VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE;
+    }
+    else
+    {
+        retval = (status)ack.status;
+    }
+
+    dispose((disposable_t*)&ack);
+
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_server_handshake;
+    }
+
+    /* create the arena and suite, and initialize the resource. */
+    retval = client_session_init(tmp, sock, a, suite);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_server_handshake;
+    }
+
+    /* the first request, if one was sent, used the first offset. */
+    if (NULL != request)
+    {
+        tmp->next_offset = 1U;
+    }
+
+    /* success. set session to tmp. */
+    *session = tmp;
+    retval = VCBLOCKCHAIN_STATUS_SUCCESS;
+    goto cleanup_server_challenge_nonce;
+
+cleanup_server_handshake:
+    dispose((disposable_t*)&tmp->shared_secret);
+    dispose((disposable_t*)server_pubkey);
+
+cleanup_server_challenge_nonce:
+    dispose((disposable_t*)&server_challenge_nonce);
+
+cleanup_client_nonces:
+    dispose((disposable_t*)&client_key_nonce);
+    dispose((disposable_t*)&client_challenge_nonce);
+
+free_tmp:
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        memset(tmp, 0, sizeof(vcblockchain_client_session));
+        release(suite->alloc_opts, tmp);
+    }
+
+done:
+    return retval;
+}
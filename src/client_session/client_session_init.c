@@ -0,0 +1,108 @@
+/**
+ * \file client_session/client_session_init.c
+ *
+ * \brief Initialize a client session once its handshake has completed.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <string.h>
+
+#include "client_session_internal.h"
+
+RCPR_IMPORT_resource;
+
+/* forward decls. */
+static status client_session_resource_release(resource* r);
+
+/**
+ * \brief Initialize a client session once its handshake has completed.
+ *
+ * \param session       The session, which already holds the shared secret and
+ *                      IVs set by the handshake.
+ * \param sock          The socket connected to the API.
+ * \param a             The allocator used to receive responses.
+ * \param suite         The crypto suite used for the handshake.
+ *
+ * This creates the session arena and the session suite, and initializes the
+ * resource. The suite is created from the allocator of \p suite, and only its
+ * buffer allocator is pointed at the arena. On failure, the shared secret is
+ * left for the caller to dispose.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered.
+ */
+status client_session_init(
+    vcblockchain_client_session* session, RCPR_SYM(psock)* sock,
+    RCPR_SYM(allocator)* a, vccrypt_suite_options_t* suite)
+{
+    status retval;
+
+    /* create the arena from which per-call buffers are allocated. */
+    retval = vcblockchain_arena_init(&session->arena, suite->alloc_opts, 0U);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* create the session suite from the caller's allocator, since anything
+     * the suite allocates for itself must outlive the arena resets. */
+    retval =
+        vccrypt_suite_options_init(
+            &session->suite, suite->alloc_opts, suite->suite_id);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        dispose((disposable_t*)&session->arena);
+        return VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* buffers allocated through the suite for a single call come from the
+     * arena. */
+    session->suite.alloc_opts = &session->arena.alloc_opts;
+
+    /* initialize the resource. */
+    resource_init(&session->hdr, &client_session_resource_release);
+
+    /* set the remaining session values. */
+    session->alloc_opts = suite->alloc_opts;
+    session->sock = sock;
+    session->alloc = a;
+    session->next_offset = 0U;
+
+    /* success. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
+
+/**
+ * \brief Release the client session resource.
+ */
+static status client_session_resource_release(resource* r)
+{
+    vcblockchain_client_session* session = (vcblockchain_client_session*)r;
+
+    /* cache the allocator. */
+    allocator_options_t* alloc_opts = session->alloc_opts;
+
+    /* dispose the suite with the allocator from which it was created. */
+    session->suite.alloc_opts = alloc_opts;
+    dispose((disposable_t*)&session->suite);
+    dispose((disposable_t*)&session->arena);
+    dispose((disposable_t*)&session->shared_secret);
+
+    /* dispose the key nonce of a rekey that was never applied. */
+    if (session->rekey_pending)
+    {
+        dispose((disposable_t*)&session->rekey_key_nonce);
+    }
+
+    /* clear the structure. */
+    memset(session, 0, sizeof(vcblockchain_client_session));
+
+    /* release the structure. */
+    release(alloc_opts, session);
+
+    /* success. */
+    return STATUS_SUCCESS;
+}
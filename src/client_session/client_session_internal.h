@@ -0,0 +1,122 @@
+/**
+ * \file client_session/client_session_internal.h
+ *
+ * \brief Internal methods and definitions for client_session.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VCBLOCKCHAIN_CLIENT_SESSION_INTERNAL_HEADER_GUARD
+#define VCBLOCKCHAIN_CLIENT_SESSION_INTERNAL_HEADER_GUARD
+
+#include <cbmc/model_assert.h>
+#include <rcpr/resource/protected.h>
+#include <vcblockchain/arena.h>
+#include <vcblockchain/client_session.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol.h>
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif /*__cplusplus*/
+
+/**
+ * \brief A client session.
+ *
+ * The session suite is created from the caller's allocator, so that anything
+ * it allocates for itself outlives each call. Only the suite's buffer
+ * allocator points at the session arena, so the buffers created to encode and
+ * encrypt a request, or to decrypt a response, are carved out of chunks that
+ * the session keeps between calls. The arena is reset at the end of every
+ * call. Nothing that outlives a call may be allocated from it; in particular,
+ * the shared secret and the key nonce of a pending rekey are allocated from
+ * the caller's allocator.
+ */
+struct vcblockchain_client_session
+{
+    RCPR_SYM(resource) hdr;
+    allocator_options_t* alloc_opts;
+    RCPR_SYM(psock)* sock;
+    RCPR_SYM(allocator)* alloc;
+    vcblockchain_arena arena;
+    vccrypt_suite_options_t suite;
+    vccrypt_buffer_t shared_secret;
+    uint64_t client_iv;
+    uint64_t server_iv;
+    uint32_t next_offset;
+    bool rekey_pending;
+    bool failed;
+    vccrypt_buffer_t rekey_key_nonce;
+
+    RCPR_MODEL_STRUCT_TAG(vcblockchain_client_session);
+};
+
+/**
+ * \brief Perform the handshake with the API and create a client session for
+ * the resulting connection.
+ *
+ * \param session           Pointer to the pointer to receive the client
+ *                          session on success.
+ * \param sock              The socket connected to the API.
+ * \param a                 The allocator used to receive responses.
+ * \param suite             The crypto suite to use for this session.
+ * \param client_id         The entity UUID for the client.
+ * \param client_privkey    The client private key.
+ * \param server_id         The uuid pointer to receive the server's uuid.
+ * \param server_pubkey     The buffer to hold the public key received from
+ *                          the server.
+ * \param request           The encoded first request to send with the
+ *                          handshake acknowledgement, or NULL to send the
+ *                          acknowledgement alone.
+ * \param request_size      The size of the encoded first request.
+ *
+ * This holds the handshake shared by \ref vcblockchain_client_session_create
+ * and \ref vcblockchain_client_session_create_with_request, which check the
+ * arguments before calling it.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the response to the
+ *        handshake acknowledgement was not a handshake acknowledgement.
+ *      - the status returned by the server if it rejected the handshake.
+ *      - a non-zero error code on failure.
+ */
+status client_session_handshake(
+    vcblockchain_client_session** session, RCPR_SYM(psock)* sock,
+    RCPR_SYM(allocator)* a, vccrypt_suite_options_t* suite,
+    const vpr_uuid* client_id, const vccrypt_buffer_t* client_privkey,
+    vpr_uuid* server_id, vccrypt_buffer_t* server_pubkey,
+    const void* request, uint32_t request_size);
+
+/**
+ * \brief Initialize a client session once its handshake has completed.
+ *
+ * \param session       The session, which already holds the shared secret and
+ *                      IVs set by the handshake.
+ * \param sock          The socket connected to the API.
+ * \param a             The allocator used to receive responses.
+ * \param suite         The crypto suite used for the handshake.
+ *
+ * This creates the session arena and the session suite, and initializes the
+ * resource. The suite is created from the allocator of \p suite, and only its
+ * buffer allocator is pointed at the arena. On failure, the shared secret is
+ * left for the caller to dispose.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered.
+ */
+status client_session_init(
+    vcblockchain_client_session* session, RCPR_SYM(psock)* sock,
+    RCPR_SYM(allocator)* a, vccrypt_suite_options_t* suite);
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif /*__cplusplus*/
+
+#endif /*VCBLOCKCHAIN_CLIENT_SESSION_INTERNAL_HEADER_GUARD*/
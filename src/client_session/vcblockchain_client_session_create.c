@@ -0,0 +1,90 @@
+/**
+ * \file client_session/vcblockchain_client_session_create.c
+ *
+ * \brief Perform the handshake with the API and create a client session.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "client_session_internal.h"
+
+/**
+ * \brief Perform the handshake with the API and create a client session for
+ * the resulting connection.
+ *
+ * \param session                   Pointer to the pointer to receive the
+ *                                  client session on success.
+ * \param sock                      The socket connected to the API. The
+ *                                  session borrows this socket, which must
+ *                                  outlive the session.
+ * \param a                         The allocator used to receive responses.
+ *                                  It must outlive the session.
+ * \param suite                     The crypto suite to use for this session.
+ *                                  The session is allocated from its
+ *                                  allocator, which must outlive the session.
+ * \param client_id                 The entity UUID for the client.
+ * \param client_privkey            The client private key.
+ * \param server_id                 The uuid pointer to receive the server's
+ *                                  uuid.
+ * \param server_pubkey             The buffer to hold the public key received
+ *                                  from the server. THIS SHOULD BE VERIFIED BY
+ *                                  THE CALLER TO PREVENT MITM ATTACKS. This
+ *                                  buffer should not be initialized prior to
+ *                                  calling this function. On success, it is
+ *                                  initialized and owned by the caller, and
+ *                                  must be disposed when no longer needed.
+ *
+ * This function sends the handshake request, receives and verifies the
+ * handshake response, then sends the handshake acknowledgement and receives
+ * its response. The session takes ownership of the resulting shared secret
+ * and IVs, and assigns the offset of every request sent through it.
+ *
+ * On success, \p session is set to a client session instance. This instance is
+ * a \ref resource that is owned by the caller and must be released by calling
+ * \ref resource_release on its resource handle when it is no longer needed.
+ *
+ * \note TO PREVENT A MAN-IN-THE-MIDDLE ATTACK, the \p server_pubkey must be
+ * compared against a cached server public key. If these do not match, then the
+ * session must be released without being used.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the response to the
+ *        handshake acknowledgement was not a handshake acknowledgement.
+ *      - the status returned by the server if it rejected the handshake.
+ *      - a non-zero error code on failure.
+ */
+status vcblockchain_client_session_create(
+    vcblockchain_client_session** session, RCPR_SYM(psock)* sock,
+    RCPR_SYM(allocator)* a, vccrypt_suite_options_t* suite,
+    const vpr_uuid* client_id, const vccrypt_buffer_t* client_privkey,
+    vpr_uuid* server_id, vccrypt_buffer_t* server_pubkey)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != session);
+    MODEL_ASSERT(NULL != sock);
+    MODEL_ASSERT(NULL != a);
+    MODEL_ASSERT(NULL != suite);
+    MODEL_ASSERT(NULL != client_id);
+    MODEL_ASSERT(NULL != client_privkey);
+    MODEL_ASSERT(NULL != server_id);
+    MODEL_ASSERT(NULL != server_pubkey);
+
+    /* runtime parameter checks. */
+    if (
+        NULL == session || NULL == sock || NULL == a || NULL == suite
+     || NULL == client_id || NULL == client_privkey || NULL == server_id
+     || NULL == server_pubkey)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* perform the handshake, sending the acknowledgement alone. */
+    return
+        client_session_handshake(
+            session, sock, a, suite, client_id, client_privkey, server_id,
+            server_pubkey, NULL, 0U);
+}
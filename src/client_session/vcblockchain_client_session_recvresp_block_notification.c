@@ -0,0 +1,69 @@
+/**
+ * \file
+ * client_session/vcblockchain_client_session_recvresp_block_notification.c
+ *
+ * \brief Receive a block notification from the API and decode it.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "client_session_internal.h"
+
+/**
+ * \brief Receive a block notification from the API and decode it.
+ *
+ * \param session                   The client session from which this response
+ *                                  is read.
+ * \param alloc_opts                The allocator to use for the decoded
+ *                                  notification.
+ * \param resp                      The notification structure to initialize.
+ *
+ * This call reads the next notification for a subscription created by \ref
+ * vcblockchain_client_session_sendreq_block_subscribe, decoding it directly
+ * from the decrypted payload. On success, \p resp is initialized and owned by
+ * the caller, who must \ref dispose() it when it is no longer needed. If the
+ * server returned an error status, then \p resp is not initialized.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_READ if reading from the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the response was not a
+ *        block notification.
+ *      - the status returned by the server if the request failed.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_recvresp_block_notification(
+    vcblockchain_client_session* session, allocator_options_t* alloc_opts,
+    protocol_resp_block_notification* resp)
+{
+    status retval;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_vcblockchain_client_session_valid(session));
+
+    /* runtime parameter checks. */
+    if (NULL == session)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* a failed session can't be used again. */
+    if (session->failed)
+    {
+        return VCBLOCKCHAIN_ERROR_SESSION_FAILED;
+    }
+
+    /* read the response using the keys for this session. */
+    retval =
+        vcblockchain_protocol_recvresp_block_notification(
+            session->sock, session->alloc, &session->suite, &session->server_iv,
+            &session->shared_secret, alloc_opts, resp);
+
+    /* reclaim the buffers used to decrypt this response. */
+    vcblockchain_arena_reset(&session->arena);
+
+    return retval;
+}
@@ -0,0 +1,67 @@
+/**
+ * \file client_session/vcblockchain_client_session_recvresp_flow_credit_grant.c
+ *
+ * \brief Receive a flow credit grant response from the API and decode it.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "client_session_internal.h"
+
+/**
+ * \brief Receive a flow credit grant response from the API and decode it.
+ *
+ * \param session                   The client session from which this response
+ *                                  is read.
+ * \param resp                      The response structure to initialize.
+ *
+ * This call reads the agent's answer to the first grant sent by \ref
+ * vcblockchain_client_session_sendreq_flow_credit_grant, decoding it directly
+ * from the decrypted payload. On success, \p resp is initialized and owned by
+ * the caller, who must \ref dispose() it when it is no longer needed. If the
+ * agent refused the grant, then \p resp is not initialized, and flow control
+ * stays off for the session.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_READ if reading from the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the response was not a
+ *        flow credit grant response.
+ *      - the status returned by the server if it refused the grant.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_recvresp_flow_credit_grant(
+    vcblockchain_client_session* session,
+    protocol_resp_flow_credit_grant* resp)
+{
+    status retval;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_vcblockchain_client_session_valid(session));
+
+    /* runtime parameter checks. */
+    if (NULL == session)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* a failed session can't be used again. */
+    if (session->failed)
+    {
+        return VCBLOCKCHAIN_ERROR_SESSION_FAILED;
+    }
+
+    /* read the response using the keys for this session. */
+    retval =
+        vcblockchain_protocol_recvresp_flow_credit_grant(
+            session->sock, session->alloc, &session->suite, &session->server_iv,
+            &session->shared_secret, resp);
+
+    /* reclaim the buffers used to decrypt this response. */
+    vcblockchain_arena_reset(&session->arena);
+
+    return retval;
+}
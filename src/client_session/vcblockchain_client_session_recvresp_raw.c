@@ -0,0 +1,69 @@
+/**
+ * \file client_session/vcblockchain_client_session_recvresp_raw.c
+ *
+ * \brief Receive a response from the API, adopting the decrypted payload.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "client_session_internal.h"
+
+/**
+ * \brief Receive a response from the API, adopting the decrypted payload.
+ *
+ * \param session                   The client session from which this response
+ *                                  is read.
+ * \param payload                   Pointer to receive the decrypted payload on
+ *                                  success.
+ * \param payload_size              Pointer to receive the size of the payload
+ *                                  on success.
+ *
+ * This call reads a response from the protocol. On success, \p payload is set
+ * to the plaintext exactly as it was decrypted by the socket layer. Unlike \ref
+ * vcblockchain_protocol_recvresp, the payload is not copied into a crypto
+ * buffer. It is allocated by the session allocator, is owned by the caller, and
+ * must be released by calling \ref
+ * vcblockchain_client_session_recvresp_raw_release when no longer needed. The
+ * caller can decode it in place by passing it to the matching response decode
+ * function.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_READ if reading from the socket failed.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_recvresp_raw(
+    vcblockchain_client_session* session, void** payload,
+    uint32_t* payload_size)
+{
+    status retval;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_vcblockchain_client_session_valid(session));
+
+    /* runtime parameter checks. */
+    if (NULL == session)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* a failed session can't be used again. */
+    if (session->failed)
+    {
+        return VCBLOCKCHAIN_ERROR_SESSION_FAILED;
+    }
+
+    /* read the response using the keys for this session. */
+    retval =
+        vcblockchain_protocol_recvresp_raw(
+            session->sock, session->alloc, &session->suite, &session->server_iv,
+            &session->shared_secret, payload, payload_size);
+
+    /* reclaim the buffers used to decrypt this response. */
+    vcblockchain_arena_reset(&session->arena);
+
+    return retval;
+}
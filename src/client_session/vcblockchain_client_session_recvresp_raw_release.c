@@ -0,0 +1,45 @@
+/**
+ * \file client_session/vcblockchain_client_session_recvresp_raw_release.c
+ *
+ * \brief Release a payload received by \ref
+ * vcblockchain_client_session_recvresp_raw.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "client_session_internal.h"
+
+/**
+ * \brief Release a payload received by \ref
+ * vcblockchain_client_session_recvresp_raw.
+ *
+ * \param session                   The client session used to receive this
+ *                                  payload.
+ * \param payload                   The payload to release.
+ * \param payload_size              The size of the payload.
+ *
+ * The payload is plaintext from an authenticated channel, so it is wiped before
+ * it is returned to the allocator.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - a non-zero error response if reclaiming the payload failed.
+ */
+status vcblockchain_client_session_recvresp_raw_release(
+    vcblockchain_client_session* session, void* payload, uint32_t payload_size)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_vcblockchain_client_session_valid(session));
+
+    /* runtime parameter checks. */
+    if (NULL == session)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* the payload was allocated by the session allocator. */
+    return
+        vcblockchain_protocol_recvresp_raw_release(
+            session->alloc, payload, payload_size);
+}
@@ -0,0 +1,75 @@
+/**
+ * \file
+ * client_session/vcblockchain_client_session_recvresp_transaction_canonized.c
+ *
+ * \brief Wait for a transaction canonized notification from the API and decode
+ * it.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "client_session_internal.h"
+
+/**
+ * \brief Wait for a transaction canonized notification from the API and decode
+ * it.
+ *
+ * \param session                   The client session from which this response
+ *                                  is read.
+ * \param resp                      The notification structure to initialize.
+ *
+ * This call waits for the outcome of a request sent by \ref
+ * vcblockchain_client_session_sendreq_transaction_submit_await. If the next
+ * response is the acknowledgement for this submission, then it is consumed, and
+ * this call continues to wait for the notification that follows it. The
+ * notification is decoded directly from the decrypted payload. On success, \p
+ * resp is initialized and owned by the caller, who must \ref dispose() it when
+ * it is no longer needed. If the submission failed or its deadline expired,
+ * then the status returned by the server is returned, and \p resp is not
+ * initialized.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_READ if reading from the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the response was not
+ *        a transaction canonized notification.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_CANONIZATION_EXPIRED if the transaction
+ *        was not canonized before the deadline.
+ *      - the status returned by the server if the request failed.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_recvresp_transaction_canonized(
+    vcblockchain_client_session* session,
+    protocol_resp_transaction_canonized* resp)
+{
+    status retval;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_vcblockchain_client_session_valid(session));
+
+    /* runtime parameter checks. */
+    if (NULL == session)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* a failed session can't be used again. */
+    if (session->failed)
+    {
+        return VCBLOCKCHAIN_ERROR_SESSION_FAILED;
+    }
+
+    /* read the response using the keys for this session. */
+    retval =
+        vcblockchain_protocol_recvresp_transaction_canonized(
+            session->sock, session->alloc, &session->suite, &session->server_iv,
+            &session->shared_secret, resp);
+
+    /* reclaim the buffers used to decrypt this response. */
+    vcblockchain_arena_reset(&session->arena);
+
+    return retval;
+}
@@ -0,0 +1,181 @@
+/**
+ * \file client_session/vcblockchain_client_session_rekey_apply.c
+ *
+ * \brief Switch to the shared secret agreed by a rekey response.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <string.h>
+#include <vcblockchain/protocol/serialization.h>
+
+#include "client_session_internal.h"
+
+/* forward decls. */
+static bool rekey_refused(
+    const void* payload, uint32_t payload_size, status retval);
+
+/**
+ * \brief Switch to the shared secret agreed by a rekey response.
+ *
+ * \param session                   The client session with a pending rekey.
+ * \param payload                   The rekey response, as received by \ref
+ *                                  vcblockchain_client_session_recvresp_raw.
+ * \param payload_size              The size of the rekey response.
+ *
+ * This must be called as soon as the rekey response is received, before any
+ * other response is read, since the server switches to the new secret right
+ * after sending it. On success, the session sends and receives every later
+ * packet with the new secret, and requests may be sent again.
+ *
+ * If the server refused the rekey, then the session keeps its current secret,
+ * requests may be sent again, and the status from the response is returned.
+ * On any other failure, the server may already have switched to a secret that
+ * the session does not hold, so the session is marked as failed, and every
+ * later request or response on it returns VCBLOCKCHAIN_ERROR_SESSION_FAILED.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided, or
+ *        if no rekey is pending.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the server switches
+ *        at an IV other than the next one.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_CRYPTO if the new secret could not be
+ *        copied.
+ *      - the status from the response if the server refused the rekey.
+ *      - a non-zero error code on failure.
+ */
+status vcblockchain_client_session_rekey_apply(
+    vcblockchain_client_session* session, const void* payload,
+    uint32_t payload_size)
+{
+    status retval;
+    protocol_resp_rekey resp;
+    vccrypt_buffer_t local_secret, new_secret;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_vcblockchain_client_session_valid(session));
+    MODEL_ASSERT(NULL != payload);
+
+    /* runtime parameter checks. */
+    if (NULL == session || NULL == payload || !session->rekey_pending)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* decode the response using the session suite. */
+    retval =
+        vcblockchain_protocol_decode_resp_rekey(
+            &resp, &session->suite, payload, payload_size);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        /* a refusal leaves both sides on the current secret. */
+        if (rekey_refused(payload, payload_size, retval))
+        {
+            goto end_rekey;
+        }
+
+        goto fail_session;
+    }
+
+    /* the server must switch with the packet after its response. */
+    if (resp.server_switch_iv != session->server_iv)
+    {
+        retval = VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE;
+        goto cleanup_resp;
+    }
+
+    /* derive the new secret. */
+    retval =
+        vcblockchain_protocol_rekeyed_shared_secret_create(
+            &local_secret, &session->suite, &session->shared_secret,
+            &session->rekey_key_nonce, &resp.server_key_nonce);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_resp;
+    }
+
+    /* the secret outlives this call, so copy it out of the arena. */
+    retval =
+        vccrypt_buffer_init(
+            &new_secret, session->alloc_opts, local_secret.size);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        retval = VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+        goto cleanup_local_secret;
+    }
+
+    /* copy the secret. */
+    retval = vccrypt_buffer_copy(&new_secret, &local_secret);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        retval = VCBLOCKCHAIN_ERROR_SSOCK_CRYPTO;
+        dispose((disposable_t*)&new_secret);
+        goto cleanup_local_secret;
+    }
+
+    /* replace the current secret. */
+    dispose((disposable_t*)&session->shared_secret);
+    vccrypt_buffer_move(&session->shared_secret, &new_secret);
+
+    /* success. */
+    retval = VCBLOCKCHAIN_STATUS_SUCCESS;
+
+cleanup_local_secret:
+    dispose((disposable_t*)&local_secret);
+
+cleanup_resp:
+    dispose((disposable_t*)&resp);
+
+fail_session:
+    /* unless the new secret is in place, the session is out of step with a
+     * server that may already have switched. */
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        session->failed = true;
+    }
+
+end_rekey:
+    dispose((disposable_t*)&session->rekey_key_nonce);
+    session->rekey_pending = false;
+    vcblockchain_arena_reset(&session->arena);
+
+    return retval;
+}
+
+/**
+ * \brief Check whether a rekey response that failed to decode is a
+ * well-formed refusal.
+ *
+ * \param payload                   The rekey response.
+ * \param payload_size              The size of the rekey response.
+ * \param retval                    The status returned by the decoder.
+ *
+ * \returns true if the response is a rekey response header whose failure
+ * status was returned by the decoder, and false otherwise.
+ */
+static bool rekey_refused(
+    const void* payload, uint32_t payload_size, status retval)
+{
+    uint32_t request_id, offset, resp_status;
+    vccrypt_buffer_t view;
+
+    /* decode the header through a view of the payload; this view does not
+     * own the payload, so it is never disposed. */
+    view.data = (void*)payload;
+    view.size = payload_size;
+    if (
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            != vcblockchain_protocol_response_decode_header(
+                    &request_id, &offset, &resp_status, &view))
+    {
+        return false;
+    }
+
+    return
+        PROTOCOL_REQ_ID_REKEY == request_id
+     && VCBLOCKCHAIN_STATUS_SUCCESS != resp_status
+     && (status)resp_status == retval;
+}
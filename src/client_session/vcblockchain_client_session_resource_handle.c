@@ -0,0 +1,24 @@
+/**
+ * \file client_session/vcblockchain_client_session_resource_handle.c
+ *
+ * \brief Get the resource handle for the given client session.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "client_session_internal.h"
+
+/**
+ * \brief Get the resource handle for the given client session.
+ *
+ * \param session   The client session instance to access.
+ *
+ * \returns the resource handle for this client session instance.
+ */
+RCPR_SYM(resource)* vcblockchain_client_session_resource_handle(
+    vcblockchain_client_session* session)
+{
+    MODEL_ASSERT(prop_vcblockchain_client_session_valid(session));
+
+    return &session->hdr;
+}
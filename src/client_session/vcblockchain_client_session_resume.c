@@ -0,0 +1,148 @@
+/**
+ * \file client_session/vcblockchain_client_session_resume.c
+ *
+ * \brief Resume a previous session with a resumption ticket.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <string.h>
+
+#include "client_session_internal.h"
+
+/**
+ * \brief Resume a previous session with the API using a resumption ticket,
+ * and create a client session for the resulting connection.
+ *
+ * \param session                   Pointer to the pointer to receive the
+ *                                  client session on success.
+ * \param sock                      The socket connected to the API. The
+ *                                  session borrows this socket, which must
+ *                                  outlive the session.
+ * \param a                         The allocator used to receive responses.
+ *                                  It must outlive the session.
+ * \param suite                     The crypto suite to use for this session.
+ *                                  The session is allocated from its
+ *                                  allocator, which must outlive the session.
+ * \param client_id                 The entity UUID for the client.
+ * \param ticket                    The resumption ticket issued during a
+ *                                  previous session.
+ * \param resumption_secret         The resumption secret bound to this ticket.
+ *
+ * The ticket is requested during an earlier session with
+ * \ref vcblockchain_client_session_sendreq_resumption_ticket_get, and its
+ * resumption secret derived with
+ * \ref vcblockchain_client_session_resumption_secret_create.
+ *
+ * This function sends the ticket with a fresh key nonce, then receives and
+ * verifies the response, which derives new session keys from the resumption
+ * secret and both key nonces. This takes a single round trip and no key
+ * agreement. The server has already been authenticated by the handshake that
+ * issued the ticket, so no server key is returned.
+ *
+ * On success, \p session is set to a client session instance. This instance is
+ * a \ref resource that is owned by the caller and must be released by calling
+ * \ref resource_release on its resource handle when it is no longer needed.
+ *
+ * If the server rejected the ticket, such as because it has expired, then its
+ * status is returned. The ticket should be discarded, and a new connection
+ * created with \ref vcblockchain_client_session_create.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the response could
+ *        not be verified.
+ *      - the status returned by the server if it rejected the ticket.
+ *      - a non-zero error code on failure.
+ */
+status vcblockchain_client_session_resume(
+    vcblockchain_client_session** session, RCPR_SYM(psock)* sock,
+    RCPR_SYM(allocator)* a, vccrypt_suite_options_t* suite,
+    const vpr_uuid* client_id, const vccrypt_buffer_t* ticket,
+    const vccrypt_buffer_t* resumption_secret)
+{
+    status retval;
+    vcblockchain_client_session* tmp;
+    vccrypt_buffer_t client_key_nonce;
+    uint32_t offset, resp_status;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != session);
+    MODEL_ASSERT(NULL != sock);
+    MODEL_ASSERT(NULL != a);
+    MODEL_ASSERT(NULL != suite);
+    MODEL_ASSERT(NULL != client_id);
+    MODEL_ASSERT(NULL != ticket);
+    MODEL_ASSERT(NULL != resumption_secret);
+
+    /* runtime parameter checks. */
+    if (
+        NULL == session || NULL == sock || NULL == a || NULL == suite
+     || NULL == client_id || NULL == ticket || NULL == resumption_secret)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* allocate memory for the session. */
+    tmp = (vcblockchain_client_session*)
+        allocate(suite->alloc_opts, sizeof(vcblockchain_client_session));
+    if (NULL == tmp)
+    {
+        retval = VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+        goto done;
+    }
+
+    /* clear the session. */
+    memset(tmp, 0, sizeof(vcblockchain_client_session));
+
+    /* send the handshake resume request. */
+    retval =
+        vcblockchain_protocol_sendreq_handshake_resume(
+            sock, suite, client_id, ticket, &client_key_nonce);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto free_tmp;
+    }
+
+    /* receive the response, deriving the shared secret and IVs. */
+    retval =
+        vcblockchain_protocol_recvresp_handshake_resume(
+            sock, a, suite, resumption_secret, &client_key_nonce,
+            &tmp->shared_secret, &tmp->client_iv, &tmp->server_iv, &offset,
+            &resp_status);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_client_key_nonce;
+    }
+
+    /* create the arena and suite, and initialize the resource. */
+    retval = client_session_init(tmp, sock, a, suite);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_shared_secret;
+    }
+
+    /* success. set session to tmp. */
+    *session = tmp;
+    retval = VCBLOCKCHAIN_STATUS_SUCCESS;
+    goto cleanup_client_key_nonce;
+
+cleanup_shared_secret:
+    dispose((disposable_t*)&tmp->shared_secret);
+
+cleanup_client_key_nonce:
+    dispose((disposable_t*)&client_key_nonce);
+
+free_tmp:
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        memset(tmp, 0, sizeof(vcblockchain_client_session));
+        release(suite->alloc_opts, tmp);
+    }
+
+done:
+    return retval;
+}
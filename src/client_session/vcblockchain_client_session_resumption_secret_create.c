@@ -0,0 +1,91 @@
+/**
+ * \file client_session/vcblockchain_client_session_resumption_secret_create.c
+ *
+ * \brief Derive the resumption secret for a ticket issued to this session.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "client_session_internal.h"
+
+/**
+ * \brief Derive the resumption secret for a ticket issued to this session.
+ *
+ * \param session                   The client session that was issued the
+ *                                  ticket.
+ * \param ticket                    The resumption ticket from a resumption
+ *                                  ticket get response.
+ * \param resumption_secret         The buffer to receive the resumption
+ *                                  secret. Must not have been previously
+ *                                  initialized. On success, it is initialized
+ *                                  and owned by the caller, and must be
+ *                                  disposed when no longer needed.
+ *
+ * The ticket and its resumption secret should be stored together, and passed
+ * to \ref vcblockchain_client_session_resume to resume the session on a later
+ * connection. The resumption secret must be kept as confidential as a private
+ * key.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered.
+ *      - a non-zero error code on failure.
+ */
+status vcblockchain_client_session_resumption_secret_create(
+    vcblockchain_client_session* session, const vccrypt_buffer_t* ticket,
+    vccrypt_buffer_t* resumption_secret)
+{
+    status retval;
+    vccrypt_buffer_t local_secret;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_vcblockchain_client_session_valid(session));
+    MODEL_ASSERT(NULL != ticket);
+    MODEL_ASSERT(NULL != resumption_secret);
+
+    /* runtime parameter checks. */
+    if (NULL == session || NULL == ticket || NULL == resumption_secret)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* derive the secret using the session suite. */
+    retval =
+        vcblockchain_protocol_resumption_secret_create(
+            &local_secret, &session->suite, &session->shared_secret, ticket);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto reset_arena;
+    }
+
+    /* the secret outlives this call, so copy it out of the arena. */
+    retval =
+        vccrypt_buffer_init(
+            resumption_secret, session->alloc_opts, local_secret.size);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        retval = VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+        goto cleanup_local_secret;
+    }
+
+    /* copy the secret. */
+    retval = vccrypt_buffer_copy(resumption_secret, &local_secret);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        dispose((disposable_t*)resumption_secret);
+        goto cleanup_local_secret;
+    }
+
+    /* success. */
+    retval = VCBLOCKCHAIN_STATUS_SUCCESS;
+
+cleanup_local_secret:
+    dispose((disposable_t*)&local_secret);
+
+reset_arena:
+    vcblockchain_arena_reset(&session->arena);
+
+    return retval;
+}
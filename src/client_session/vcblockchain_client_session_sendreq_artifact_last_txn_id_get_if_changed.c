@@ -0,0 +1,95 @@
+/**
+ * \file
+ * client_session/vcblockchain_client_session_sendreq_artifact_last_txn_id_get_if_changed.c
+ *
+ * \brief Send an artifact get last transaction id request to the API that only
+ * returns the transaction id if it differs from the one known to the client.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "client_session_internal.h"
+
+/**
+ * \brief Send an artifact get last transaction id request to the API that only
+ * returns the transaction id if it differs from the one known to the client.
+ *
+ * \param session                   The client session to use for this request.
+ * \param offset                    Pointer to receive the offset assigned to
+ *                                  this request by the session. The response to
+ *                                  this request echoes this offset.
+ * \param timeout_ms                The maximum time in milliseconds that the
+ *                                  server may hold this request open waiting
+ *                                  for a new transaction, or 0 to answer at
+ *                                  once.
+ * \param artifact_id               The artifact UUID to get.
+ * \param last_txn_id               The last transaction id for this artifact
+ *                                  known to the client.
+ *
+ * This function sends the conditional artifact get last transaction request to
+ * the server. If the last transaction id for this artifact differs from \p
+ * last_txn_id, then the server responds at once with the new transaction id.
+ * Otherwise, the server waits up to \p timeout_ms for a new transaction, and
+ * responds with a header-only response with a status of \ref
+ * VCBLOCKCHAIN_ERROR_PROTOCOL_NOT_MODIFIED if none arrives.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_REKEY_PENDING if a rekey has been requested, but
+ *        its response has not yet been applied.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_sendreq_artifact_last_txn_id_get_if_changed(
+    vcblockchain_client_session* session, uint32_t* offset, uint32_t timeout_ms,
+    const vpr_uuid* artifact_id, const vpr_uuid* last_txn_id)
+{
+    status retval;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_vcblockchain_client_session_valid(session));
+    MODEL_ASSERT(NULL != offset);
+
+    /* runtime parameter checks. */
+    if (NULL == session || NULL == offset)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* a failed session can't be used again. */
+    if (session->failed)
+    {
+        return VCBLOCKCHAIN_ERROR_SESSION_FAILED;
+    }
+
+    /* no request may be sent while a rekey is pending, since the server
+     * would not be able to read it. */
+    if (session->rekey_pending)
+    {
+        return VCBLOCKCHAIN_ERROR_REKEY_PENDING;
+    }
+
+    /* send the request using the next offset for this session. */
+    retval =
+        vcblockchain_protocol_sendreq_artifact_last_txn_id_get_if_changed(
+            session->sock, &session->suite, &session->client_iv,
+            &session->shared_secret, session->next_offset, timeout_ms,
+            artifact_id, last_txn_id);
+
+    /* reclaim the buffers used to encode and encrypt this request. */
+    vcblockchain_arena_reset(&session->arena);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* success. */
+    *offset = session->next_offset++;
+
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
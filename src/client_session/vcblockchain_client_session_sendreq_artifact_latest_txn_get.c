@@ -0,0 +1,84 @@
+/**
+ * \file
+ * client_session/vcblockchain_client_session_sendreq_artifact_latest_txn_get.c
+ *
+ * \brief Send an artifact latest transaction get request.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "client_session_internal.h"
+
+/**
+ * \brief Send an artifact latest transaction get request.
+ *
+ * \param session                   The client session to use for this request.
+ * \param offset                    Pointer to receive the offset assigned to
+ *                                  this request by the session. The response to
+ *                                  this request echoes this offset.
+ * \param artifact_id               The artifact UUID to get.
+ *
+ * This function requests the latest transaction for the given artifact,
+ * returning the same data as a transaction get request in a single round trip.
+ * The response can be read using \ref
+ * vcblockchain_client_session_recvresp_artifact_latest_txn_get.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_REKEY_PENDING if a rekey has been requested, but
+ *        its response has not yet been applied.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_sendreq_artifact_latest_txn_get(
+    vcblockchain_client_session* session, uint32_t* offset,
+    const vpr_uuid* artifact_id)
+{
+    status retval;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_vcblockchain_client_session_valid(session));
+    MODEL_ASSERT(NULL != offset);
+
+    /* runtime parameter checks. */
+    if (NULL == session || NULL == offset)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* a failed session can't be used again. */
+    if (session->failed)
+    {
+        return VCBLOCKCHAIN_ERROR_SESSION_FAILED;
+    }
+
+    /* no request may be sent while a rekey is pending, since the server
+     * would not be able to read it. */
+    if (session->rekey_pending)
+    {
+        return VCBLOCKCHAIN_ERROR_REKEY_PENDING;
+    }
+
+    /* send the request using the next offset for this session. */
+    retval =
+        vcblockchain_protocol_sendreq_artifact_latest_txn_get(
+            session->sock, &session->suite, &session->client_iv,
+            &session->shared_secret, session->next_offset, artifact_id);
+
+    /* reclaim the buffers used to encode and encrypt this request. */
+    vcblockchain_arena_reset(&session->arena);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* success. */
+    *offset = session->next_offset++;
+
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
@@ -0,0 +1,96 @@
+/**
+ * \file
+ * client_session/vcblockchain_client_session_sendreq_artifact_txn_page_get.c
+ *
+ * \brief Send an artifact transaction page get request.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "client_session_internal.h"
+
+/**
+ * \brief Send an artifact transaction page get request.
+ *
+ * \param session                   The client session to use for this request.
+ * \param offset                    Pointer to receive the offset assigned to
+ *                                  this request by the session. The response to
+ *                                  this request echoes this offset.
+ * \param artifact_id               The artifact id.
+ * \param cursor_txn_id             The page starts after this transaction. If
+ *                                  this is the zero uuid, then the page starts
+ *                                  at the first transaction in \p direction.
+ * \param direction                 The \ref protocol_txn_page_direction for
+ *                                  this page.
+ * \param page_size                 The maximum number of transactions to
+ *                                  return.
+ * \param include_certs             Set to true to return the transaction
+ *                                  certificates.
+ *
+ * This function requests a page of up to \p page_size transactions for an
+ * artifact in a single round trip. The response holds a cursor which can be
+ * passed as \p cursor_txn_id to request the following page, and has the \ref
+ * PROTOCOL_TXN_PAGE_FLAG_MORE flag set if more transactions remain.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if \p direction is unknown or
+ *        \p page_size is zero.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_REKEY_PENDING if a rekey has been requested, but
+ *        its response has not yet been applied.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_sendreq_artifact_txn_page_get(
+    vcblockchain_client_session* session, uint32_t* offset,
+    const vpr_uuid* artifact_id, const vpr_uuid* cursor_txn_id,
+    uint32_t direction, uint32_t page_size, bool include_certs)
+{
+    status retval;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_vcblockchain_client_session_valid(session));
+    MODEL_ASSERT(NULL != offset);
+
+    /* runtime parameter checks. */
+    if (NULL == session || NULL == offset)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* a failed session can't be used again. */
+    if (session->failed)
+    {
+        return VCBLOCKCHAIN_ERROR_SESSION_FAILED;
+    }
+
+    /* no request may be sent while a rekey is pending, since the server
+     * would not be able to read it. */
+    if (session->rekey_pending)
+    {
+        return VCBLOCKCHAIN_ERROR_REKEY_PENDING;
+    }
+
+    /* send the request using the next offset for this session. */
+    retval =
+        vcblockchain_protocol_sendreq_artifact_txn_page_get(
+            session->sock, &session->suite, &session->client_iv,
+            &session->shared_secret, session->next_offset, artifact_id,
+            cursor_txn_id, direction, page_size, include_certs);
+
+    /* reclaim the buffers used to encode and encrypt this request. */
+    vcblockchain_arena_reset(&session->arena);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* success. */
+    *offset = session->next_offset++;
+
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
@@ -0,0 +1,70 @@
+/**
+ * \file
+ * client_session/vcblockchain_client_session_sendreq_extended_api_response.c
+ *
+ * \brief Send a response to an extended API request.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "client_session_internal.h"
+
+/**
+ * \brief Send a response to an extended API request.
+ *
+ * \param session                   The client session to use for this request.
+ * \param offset                    The offset provided by agentd for the
+ *                                  original extended request. Unlike regular
+ *                                  offsets, these are 64-bit and are only used
+ *                                  once.
+ * \param status                    The status to pass to the client.
+ * \param response_body             The body of the response to be sent.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_REKEY_PENDING if a rekey has been requested, but
+ *        its response has not yet been applied.
+ *      - a non-zero error code on failure.
+ */
+status vcblockchain_client_session_sendreq_extended_api_response(
+    vcblockchain_client_session* session, uint64_t offset, uint32_t status,
+    const vccrypt_buffer_t* response_body)
+{
+    int retval;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_vcblockchain_client_session_valid(session));
+
+    /* runtime parameter checks. */
+    if (NULL == session)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* a failed session can't be used again. */
+    if (session->failed)
+    {
+        return VCBLOCKCHAIN_ERROR_SESSION_FAILED;
+    }
+
+    /* no request may be sent while a rekey is pending, since the server
+     * would not be able to read it. */
+    if (session->rekey_pending)
+    {
+        return VCBLOCKCHAIN_ERROR_REKEY_PENDING;
+    }
+
+    /* send the response using the keys for this session. */
+    retval =
+        vcblockchain_protocol_sendreq_extended_api_response(
+            session->sock, &session->suite, &session->client_iv,
+            &session->shared_secret, offset, status, response_body);
+
+    /* reclaim the buffers used to encode and encrypt this response. */
+    vcblockchain_arena_reset(&session->arena);
+
+    return retval;
+}
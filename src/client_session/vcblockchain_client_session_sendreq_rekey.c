@@ -0,0 +1,121 @@
+/**
+ * \file client_session/vcblockchain_client_session_sendreq_rekey.c
+ *
+ * \brief Send a rekey request.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "client_session_internal.h"
+
+/**
+ * \brief Send a rekey request.
+ *
+ * \param session                   The client session to use for this request.
+ * \param offset                    Pointer to receive the offset assigned to
+ *                                  this request by the session. The response to
+ *                                  this request echoes this offset.
+ *
+ * This function asks the server to replace the shared secret of this session
+ * with one derived from it and fresh nonces, which refreshes the keys of a
+ * long-lived connection without a new handshake. The new secret applies to
+ * every client packet after this request, and to every server packet after
+ * the rekey response.
+ *
+ * Responses to earlier requests may still be received while the rekey is
+ * pending. No other request may be sent until the rekey response has been
+ * received and passed to \ref vcblockchain_client_session_rekey_apply, since
+ * the server would not be able to read it. If the request is sent, but its key
+ * nonce can't be kept, then the session is marked as failed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_REKEY_PENDING if a rekey is already pending.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_CRYPTO if the key nonce could not be
+ *        copied.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_sendreq_rekey(
+    vcblockchain_client_session* session, uint32_t* offset)
+{
+    status retval;
+    vccrypt_buffer_t local_key_nonce;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_vcblockchain_client_session_valid(session));
+    MODEL_ASSERT(NULL != offset);
+
+    /* runtime parameter checks. */
+    if (NULL == session || NULL == offset)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* a failed session can't be used again. */
+    if (session->failed)
+    {
+        return VCBLOCKCHAIN_ERROR_SESSION_FAILED;
+    }
+
+    /* only one rekey may be pending at a time. */
+    if (session->rekey_pending)
+    {
+        return VCBLOCKCHAIN_ERROR_REKEY_PENDING;
+    }
+
+    /* send the request using the next offset for this session. */
+    retval =
+        vcblockchain_protocol_sendreq_rekey(
+            session->sock, &session->suite, &session->client_iv,
+            &session->shared_secret, session->next_offset, &local_key_nonce);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto reset_arena;
+    }
+
+    /* the nonce is needed when the response arrives, so copy it out. */
+    retval =
+        vccrypt_buffer_init(
+            &session->rekey_key_nonce, session->alloc_opts,
+            local_key_nonce.size);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        retval = VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+        goto cleanup_local_key_nonce;
+    }
+
+    /* copy the nonce. */
+    retval = vccrypt_buffer_copy(&session->rekey_key_nonce, &local_key_nonce);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        retval = VCBLOCKCHAIN_ERROR_SSOCK_CRYPTO;
+        dispose((disposable_t*)&session->rekey_key_nonce);
+        goto cleanup_local_key_nonce;
+    }
+
+    /* success. */
+    session->rekey_pending = true;
+    *offset = session->next_offset++;
+    retval = VCBLOCKCHAIN_STATUS_SUCCESS;
+
+cleanup_local_key_nonce:
+    dispose((disposable_t*)&local_key_nonce);
+
+    /* once the request is sent, the server switches to a secret that can't be
+     * derived without the nonce. */
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        session->failed = true;
+    }
+
+reset_arena:
+    vcblockchain_arena_reset(&session->arena);
+
+    return retval;
+}
@@ -0,0 +1,95 @@
+/**
+ * \file
+ * client_session/vcblockchain_client_session_sendreq_transaction_submit_await.c
+ *
+ * \brief Send a transaction submission request that waits for canonization.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "client_session_internal.h"
+
+/**
+ * \brief Send a transaction submission request that waits for canonization.
+ *
+ * \param session                   The client session to use for this request.
+ * \param offset                    Pointer to receive the offset assigned to
+ *                                  this request by the session. The response to
+ *                                  this request echoes this offset.
+ * \param timeout_ms                The maximum time in milliseconds to wait for
+ *                                  this transaction to be canonized, or 0 to
+ *                                  use the agent's default deadline.
+ * \param txn_id                    The transaction id for this request.
+ * \param artifact_id               The artifact id for this request.
+ * \param cert                      Pointer to the certificate for this request.
+ * \param cert_size                 The size of this certificate.
+ *
+ * This function sends a transaction submission request to the server. The
+ * server responds to this request once the transaction has been accepted, and
+ * then sends a transaction canonized notification with the offset of this
+ * request once the transaction is in a block. This notification can be read
+ * with \ref vcblockchain_client_session_recvresp_transaction_canonized. If the
+ * deadline expires first, then the server instead sends an error response with
+ * \ref VCBLOCKCHAIN_ERROR_PROTOCOL_CANONIZATION_EXPIRED.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SESSION_FAILED if an earlier failure left the
+ *        session unusable.
+ *      - VCBLOCKCHAIN_ERROR_REKEY_PENDING if a rekey has been requested, but
+ *        its response has not yet been applied.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_client_session_sendreq_transaction_submit_await(
+    vcblockchain_client_session* session, uint32_t* offset, uint32_t timeout_ms,
+    const vpr_uuid* txn_id, const vpr_uuid* artifact_id, const void* cert,
+    size_t cert_size)
+{
+    status retval;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_vcblockchain_client_session_valid(session));
+    MODEL_ASSERT(NULL != offset);
+
+    /* runtime parameter checks. */
+    if (NULL == session || NULL == offset)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* a failed session can't be used again. */
+    if (session->failed)
+    {
+        return VCBLOCKCHAIN_ERROR_SESSION_FAILED;
+    }
+
+    /* no request may be sent while a rekey is pending, since the server
+     * would not be able to read it. */
+    if (session->rekey_pending)
+    {
+        return VCBLOCKCHAIN_ERROR_REKEY_PENDING;
+    }
+
+    /* send the request using the next offset for this session. */
+    retval =
+        vcblockchain_protocol_sendreq_transaction_submit_await(
+            session->sock, &session->suite, &session->client_iv,
+            &session->shared_secret, session->next_offset, timeout_ms, txn_id,
+            artifact_id, cert, cert_size);
+
+    /* reclaim the buffers used to encode and encrypt this request. */
+    vcblockchain_arena_reset(&session->arena);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* success. */
+    *offset = session->next_offset++;
+
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
@@ -0,0 +1,76 @@
+/**
+ * \file flow_credit/vcblockchain_flow_credit_consume.c
+ *
+ * \brief Consume the credits for a message.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <stddef.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/flow_credit.h>
+
+/**
+ * \brief Consume the credits for a message.
+ *
+ * \param credit                    The flow credit account.
+ * \param requests                  The number of requests in the message.
+ * \param bytes                     The size of the message.
+ *
+ * On failure, no credits are consumed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided,
+ *        or if the message is larger than the window, so that it could never
+ *        be sent.
+ *      - VCBLOCKCHAIN_ERROR_FLOW_CREDIT_EXHAUSTED if there are not enough
+ *        credits left. A sender should wait for a grant, and a receiver
+ *        should close the connection.
+ */
+int vcblockchain_flow_credit_consume(
+    vcblockchain_flow_credit* credit, uint32_t requests, uint64_t bytes)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != credit);
+
+    /* runtime parameter checks. */
+    if (NULL == credit)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* a window of zero is unlimited, so only check the limited windows. */
+    bool limit_requests = (0U != credit->request_window);
+    bool limit_bytes = (0U != credit->byte_window);
+
+    /* a message larger than the window could never be sent. */
+    if (
+        (limit_requests && requests > credit->request_window)
+     || (limit_bytes && bytes > credit->byte_window))
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* check both kinds of credit before consuming either. */
+    if (
+        (limit_requests && requests > credit->request_credits)
+     || (limit_bytes && bytes > credit->byte_credits))
+    {
+        return VCBLOCKCHAIN_ERROR_FLOW_CREDIT_EXHAUSTED;
+    }
+
+    /* consume the credits. */
+    if (limit_requests)
+    {
+        credit->request_credits -= requests;
+    }
+    if (limit_bytes)
+    {
+        credit->byte_credits -= bytes;
+    }
+
+    /* success. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
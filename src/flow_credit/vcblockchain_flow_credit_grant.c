@@ -0,0 +1,65 @@
+/**
+ * \file flow_credit/vcblockchain_flow_credit_grant.c
+ *
+ * \brief Apply a grant received from the receiver.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <stddef.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/flow_credit.h>
+
+/**
+ * \brief Apply a grant received from the receiver.
+ *
+ * \param credit                    The flow credit account.
+ * \param requests                  The number of requests granted.
+ * \param bytes                     The number of bytes granted.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the grant returns
+ *        more credits than were consumed.
+ */
+int vcblockchain_flow_credit_grant(
+    vcblockchain_flow_credit* credit, uint32_t requests, uint64_t bytes)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != credit);
+
+    /* runtime parameter checks. */
+    if (NULL == credit)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* a window of zero is unlimited, so only check the limited windows. */
+    bool limit_requests = (0U != credit->request_window);
+    bool limit_bytes = (0U != credit->byte_window);
+
+    /* the receiver can't return more credits than were consumed. */
+    if (
+        (limit_requests
+            && requests > credit->request_window - credit->request_credits)
+     || (limit_bytes
+            && bytes > credit->byte_window - credit->byte_credits))
+    {
+        return VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE;
+    }
+
+    /* return the credits. */
+    if (limit_requests)
+    {
+        credit->request_credits += requests;
+    }
+    if (limit_bytes)
+    {
+        credit->byte_credits += bytes;
+    }
+
+    /* success. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
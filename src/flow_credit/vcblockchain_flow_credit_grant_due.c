@@ -0,0 +1,80 @@
+/**
+ * \file flow_credit/vcblockchain_flow_credit_grant_due.c
+ *
+ * \brief Take the credits that are due to be granted to the sender.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <stddef.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/flow_credit.h>
+
+/**
+ * \brief Take the credits that are due to be granted to the sender.
+ *
+ * \param credit                    The flow credit account.
+ * \param requests                  Pointer to receive the number of requests
+ *                                  to grant.
+ * \param bytes                     Pointer to receive the number of bytes to
+ *                                  grant.
+ *
+ * To keep grants infrequent, freed credits are held until at least half of a
+ * window has been freed, or until every consumed credit has been freed, so
+ * that a sender that is waiting always receives a grant. If both counts are
+ * zero, then no grant is due. Otherwise, the receiver must send a grant with
+ * these counts, which are now counted as available to the sender.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ */
+int vcblockchain_flow_credit_grant_due(
+    vcblockchain_flow_credit* credit, uint32_t* requests, uint64_t* bytes)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != credit);
+    MODEL_ASSERT(NULL != requests);
+    MODEL_ASSERT(NULL != bytes);
+
+    /* runtime parameter checks. */
+    if (NULL == credit || NULL == requests || NULL == bytes)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* a grant is due once half a window has been freed. */
+    bool due =
+        (credit->requests_freed > 0U
+            && credit->requests_freed >= credit->request_window / 2U)
+     || (credit->bytes_freed > 0U
+            && credit->bytes_freed >= credit->byte_window / 2U);
+
+    /* a grant is also due once everything consumed has been freed, since the
+     * sender may be waiting for a message that is smaller than half a
+     * window, but larger than what it has left. */
+    due = due
+     || ((credit->requests_freed > 0U || credit->bytes_freed > 0U)
+      && credit->request_credits + credit->requests_freed
+            == credit->request_window
+      && credit->byte_credits + credit->bytes_freed == credit->byte_window);
+
+    if (!due)
+    {
+        *requests = 0U;
+        *bytes = 0U;
+        return VCBLOCKCHAIN_STATUS_SUCCESS;
+    }
+
+    /* hand the freed credits back to the sender. */
+    *requests = credit->requests_freed;
+    *bytes = credit->bytes_freed;
+    credit->request_credits += credit->requests_freed;
+    credit->byte_credits += credit->bytes_freed;
+    credit->requests_freed = 0U;
+    credit->bytes_freed = 0U;
+
+    /* success. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
@@ -0,0 +1,53 @@
+/**
+ * \file flow_credit/vcblockchain_flow_credit_init.c
+ *
+ * \brief Initialize a flow credit account with a full window.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/flow_credit.h>
+
+/**
+ * \brief Initialize a flow credit account with a full window.
+ *
+ * \param credit                    The flow credit account to initialize.
+ * \param request_window            The number of requests in the window, or
+ *                                  zero if requests are unlimited.
+ * \param byte_window               The number of bytes in the window, or zero
+ *                                  if bytes are unlimited.
+ *
+ * The windows are the ones exchanged when flow control is negotiated. A
+ * sender initializes its account with the window granted by its receiver,
+ * and a receiver initializes its account with the window it granted.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ */
+int vcblockchain_flow_credit_init(
+    vcblockchain_flow_credit* credit, uint32_t request_window,
+    uint64_t byte_window)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != credit);
+
+    /* runtime parameter checks. */
+    if (NULL == credit)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* the sender starts out with the whole window. */
+    memset(credit, 0, sizeof(*credit));
+    credit->request_window = request_window;
+    credit->byte_window = byte_window;
+    credit->request_credits = request_window;
+    credit->byte_credits = byte_window;
+
+    /* success. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
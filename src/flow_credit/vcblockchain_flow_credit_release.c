@@ -0,0 +1,71 @@
+/**
+ * \file flow_credit/vcblockchain_flow_credit_release.c
+ *
+ * \brief Free the capacity held by a message that has been received.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <stddef.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/flow_credit.h>
+
+/**
+ * \brief Free the capacity held by a message that has been received.
+ *
+ * \param credit                    The flow credit account.
+ * \param requests                  The number of requests in the message.
+ * \param bytes                     The size of the message.
+ *
+ * The freed credits are returned to the sender by the next grant that
+ * \ref vcblockchain_flow_credit_grant_due reports.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided,
+ *        or if more credits are freed than were consumed.
+ */
+int vcblockchain_flow_credit_release(
+    vcblockchain_flow_credit* credit, uint32_t requests, uint64_t bytes)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != credit);
+
+    /* runtime parameter checks. */
+    if (NULL == credit)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* a window of zero is unlimited, so only check the limited windows. */
+    bool limit_requests = (0U != credit->request_window);
+    bool limit_bytes = (0U != credit->byte_window);
+
+    /* only consumed credits that have not already been freed can be freed. */
+    if (
+        (limit_requests
+            && requests
+                > credit->request_window - credit->request_credits
+                    - credit->requests_freed)
+     || (limit_bytes
+            && bytes
+                > credit->byte_window - credit->byte_credits
+                    - credit->bytes_freed))
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* hold the freed credits until a grant is due. */
+    if (limit_requests)
+    {
+        credit->requests_freed += requests;
+    }
+    if (limit_bytes)
+    {
+        credit->bytes_freed += bytes;
+    }
+
+    /* success. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
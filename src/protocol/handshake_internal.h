@@ -0,0 +1,50 @@
+/**
+ * \file protocol/handshake_internal.h
+ *
+ * \brief Internal helpers shared by the handshake functions.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VCBLOCKCHAIN_PROTOCOL_HANDSHAKE_INTERNAL_HEADER_GUARD
+#define VCBLOCKCHAIN_PROTOCOL_HANDSHAKE_INTERNAL_HEADER_GUARD
+
+#include <vccrypt/suite.h>
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif /*__cplusplus*/
+
+/**
+ * \brief Compute the payload of the handshake acknowledgement.
+ *
+ * \param digest                    The buffer to receive the response to the
+ *                                  server challenge. This buffer must not have
+ *                                  been previously initialized. On success, it
+ *                                  is initialized and owned by the caller, and
+ *                                  must be disposed when no longer needed.
+ * \param suite                     The crypto suite to use for this handshake.
+ * \param shared_secret             The shared secret key for this handshake.
+ * \param server_challenge_nonce    The server challenge nonce to answer.
+ *
+ * The acknowledgement is a short MAC of the server challenge nonce, keyed by
+ * the shared secret.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+int protocol_handshake_ack_digest_create(
+    vccrypt_buffer_t* digest, vccrypt_suite_options_t* suite,
+    const vccrypt_buffer_t* shared_secret,
+    const vccrypt_buffer_t* server_challenge_nonce);
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif /*__cplusplus*/
+
+#endif /*VCBLOCKCHAIN_PROTOCOL_HANDSHAKE_INTERNAL_HEADER_GUARD*/
@@ -0,0 +1,97 @@
+/**
+ * \file protocol/protocol_handshake_ack_digest_create.c
+ *
+ * \brief Compute the payload of the handshake acknowledgement.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vcblockchain/error_codes.h>
+
+#include "handshake_internal.h"
+
+/**
+ * \brief Compute the payload of the handshake acknowledgement.
+ *
+ * \param digest                    The buffer to receive the response to the
+ *                                  server challenge. This buffer must not have
+ *                                  been previously initialized. On success, it
+ *                                  is initialized and owned by the caller, and
+ *                                  must be disposed when no longer needed.
+ * \param suite                     The crypto suite to use for this handshake.
+ * \param shared_secret             The shared secret key for this handshake.
+ * \param server_challenge_nonce    The server challenge nonce to answer.
+ *
+ * The acknowledgement is a short MAC of the server challenge nonce, keyed by
+ * the shared secret.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+int protocol_handshake_ack_digest_create(
+    vccrypt_buffer_t* digest, vccrypt_suite_options_t* suite,
+    const vccrypt_buffer_t* shared_secret,
+    const vccrypt_buffer_t* server_challenge_nonce)
+{
+    int retval;
+    vccrypt_mac_context_t mac;
+
+    /* parameter sanity checking. */
+    MODEL_ASSERT(NULL != digest);
+    MODEL_ASSERT(NULL != suite);
+    MODEL_ASSERT(NULL != shared_secret);
+    MODEL_ASSERT(NULL != server_challenge_nonce);
+
+    /* create a buffer for holding the digest. */
+    if (VCCRYPT_STATUS_SUCCESS !=
+        vccrypt_suite_buffer_init_for_mac_authentication_code(
+            suite, digest, true))
+    {
+        retval = VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+        goto done;
+    }
+
+    /* create a mac instance for building the response to the challenge. */
+    retval =
+        vccrypt_suite_mac_short_init(
+            suite, &mac, (vccrypt_buffer_t*)shared_secret);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_digest;
+    }
+
+    /* digest the server challenge nonce. */
+    retval =
+        vccrypt_mac_digest(
+            &mac, server_challenge_nonce->data, server_challenge_nonce->size);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_mac;
+    }
+
+    /* finalize the digest. */
+    retval = vccrypt_mac_finalize(&mac, digest);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_mac;
+    }
+
+    /* success. */
+    retval = VCBLOCKCHAIN_STATUS_SUCCESS;
+
+cleanup_mac:
+    dispose((disposable_t*)&mac);
+
+cleanup_digest:
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        dispose((disposable_t*)digest);
+    }
+
+done:
+    return retval;
+}
@@ -0,0 +1,64 @@
+/**
+ * \file protocol/recvresp_internal.h
+ *
+ * \brief Internal helpers for the typed response receive functions.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VCBLOCKCHAIN_PROTOCOL_RECVRESP_INTERNAL_HEADER_GUARD
+#define VCBLOCKCHAIN_PROTOCOL_RECVRESP_INTERNAL_HEADER_GUARD
+
+#include <vcblockchain/error_codes.h>
+
+#include "wire_internal.h"
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif /*__cplusplus*/
+
+/**
+ * \brief Check the header of a received response before decoding it.
+ *
+ * \param payload                   The received payload.
+ * \param payload_size              The size of the received payload.
+ * \param expected_request_id       The request id that this response must
+ *                                  have.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS if the response can be decoded.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE if the payload is
+ *        too small to hold a response header.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the response is for a
+ *        different request.
+ *      - the status returned by the server if it is not successful.
+ */
+static inline int vcblockchain_protocol_recvresp_check_header(
+    const void* payload, uint32_t payload_size, uint32_t expected_request_id)
+{
+    /* the response must hold at least a request id and status. */
+    if (payload_size < 2 * sizeof(uint32_t))
+    {
+        return VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE;
+    }
+
+    vcblockchain_wire_reader reader;
+    vcblockchain_wire_reader_init(&reader, payload, payload_size);
+
+    /* verify that this is the response we expect. */
+    if (expected_request_id != vcblockchain_wire_read_u32(&reader))
+    {
+        return VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE;
+    }
+
+    /* error responses only carry a header, so pass the status through. */
+    return (int)vcblockchain_wire_read_u32(&reader);
+}
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif /*__cplusplus*/
+
+#endif /*VCBLOCKCHAIN_PROTOCOL_RECVRESP_INTERNAL_HEADER_GUARD*/
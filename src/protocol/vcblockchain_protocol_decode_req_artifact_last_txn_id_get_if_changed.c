@@ -0,0 +1,90 @@
+/**
+ * \file
+ * protocol/vcblockchain_protocol_decode_req_artifact_last_txn_id_get_if_changed.c
+ *
+ * \brief Decode a conditional artifact last txn id get request.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+
+#include "wire_internal.h"
+
+/* forward decls. */
+static void dispose_protocol_req_artifact_last_txn_id_get_if_changed(
+    void* disp);
+
+/**
+ * \brief Decode a conditional artifact last txn id get request.
+ *
+ * \param req                       The decoded request buffer.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p req structure is initialized with the decoded values. The
+ * caller owns this structure and must \ref dispose() it when it is no longer
+ * needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_decode_req_artifact_last_txn_id_get_if_changed(
+    protocol_req_artifact_last_txn_id_get_if_changed* req, const void* payload,
+    size_t payload_size)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != req);
+    MODEL_ASSERT(NULL != payload);
+
+    /* runtime parameter checks. */
+    if (NULL == req || NULL == payload)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* verify that the payload size is correct. */
+    const size_t expected_payload_size = 3 * sizeof(uint32_t) + 2 * 16;
+    if (expected_payload_size != payload_size)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* initialize the request buffer. */
+    memset(req, 0, sizeof(*req));
+    req->hdr.dispose =
+        &dispose_protocol_req_artifact_last_txn_id_get_if_changed;
+
+    /* set the request id, offset, and timeout. */
+    vcblockchain_wire_reader reader;
+    vcblockchain_wire_reader_init(&reader, payload, payload_size);
+    req->request_id = vcblockchain_wire_read_u32(&reader);
+    req->offset = vcblockchain_wire_read_u32(&reader);
+    req->timeout_ms = vcblockchain_wire_read_u32(&reader);
+
+    /* copy the ids. */
+    vcblockchain_wire_read_uuid(&reader, &req->artifact_id);
+    vcblockchain_wire_read_uuid(&reader, &req->last_txn_id);
+
+    /* success. */
+    /* req is owned by the caller. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
+
+/**
+ * \brief Dispose of a decoded request structure.
+ *
+ * \param disp      The structure to dispose.
+ */
+static void dispose_protocol_req_artifact_last_txn_id_get_if_changed(
+    void* disp)
+{
+    protocol_req_artifact_last_txn_id_get_if_changed* req =
+        (protocol_req_artifact_last_txn_id_get_if_changed*)disp;
+
+    memset(req, 0, sizeof(protocol_req_artifact_last_txn_id_get_if_changed));
+}
@@ -0,0 +1,129 @@
+/**
+ * \file protocol/vcblockchain_protocol_decode_req_artifact_unsubscribe.c
+ *
+ * \brief Decode an artifact unsubscription request into a struct.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/limits.h>
+#include <vcblockchain/protocol/serialization.h>
+
+#include "wire_internal.h"
+
+/* forward decls. */
+static void dispose_protocol_req_artifact_unsubscribe(void* disp);
+
+/**
+ * \brief Decode an artifact unsubscription request.
+ *
+ * \param req                       The decoded request buffer.
+ * \param alloc_opts                The allocator to use for this request.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p req structure is initialized with the decoded values. The
+ * artifact id array is owned by \p req, and is NULL if the request removes
+ * every watched artifact. The caller owns this structure and must \ref
+ * dispose() it when it is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the payload is malformed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered.
+ */
+int vcblockchain_protocol_decode_req_artifact_unsubscribe(
+    protocol_req_artifact_unsubscribe* req, allocator_options_t* alloc_opts,
+    const void* payload, size_t payload_size)
+{
+    int retval;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != req);
+    MODEL_ASSERT(NULL != alloc_opts);
+    MODEL_ASSERT(NULL != payload);
+
+    /* runtime parameter checks. */
+    if (NULL == req || NULL == alloc_opts || NULL == payload)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* verify that the payload holds the header. */
+    const size_t header_size =
+          3 * sizeof(uint32_t); /* request id, offset, and count. */
+    if (payload_size < header_size)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* initialize the request structure. */
+    memset(req, 0, sizeof(*req));
+    req->hdr.dispose = &dispose_protocol_req_artifact_unsubscribe;
+
+    /* set the header values. */
+    vcblockchain_wire_reader reader;
+    vcblockchain_wire_reader_init(&reader, payload, payload_size);
+    req->request_id = vcblockchain_wire_read_u32(&reader);
+    req->offset = vcblockchain_wire_read_u32(&reader);
+    req->count = vcblockchain_wire_read_u32(&reader);
+
+    /* the body must hold exactly count packed artifact ids. */
+    const size_t body_size = payload_size - header_size;
+    if (req->count > VCBLOCKCHAIN_LIMIT_MAXIMUM_ARTIFACT_SUBSCRIPTION_COUNT
+     || body_size != req->count * sizeof(vpr_uuid))
+    {
+        retval = VCBLOCKCHAIN_ERROR_INVALID_ARG;
+        goto cleanup_req;
+    }
+
+    /* an empty request removes every watched artifact. */
+    if (0U == req->count)
+    {
+        return VCBLOCKCHAIN_STATUS_SUCCESS;
+    }
+
+    /* copy the packed artifact ids. */
+    if (VCCRYPT_STATUS_SUCCESS !=
+        vccrypt_buffer_init(&req->artifact_ids_buffer, alloc_opts, body_size))
+    {
+        retval = VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+        goto cleanup_req;
+    }
+
+    req->artifact_ids = (vpr_uuid*)req->artifact_ids_buffer.data;
+    vcblockchain_wire_read_bytes(
+        &reader, req->artifact_ids_buffer.data, body_size);
+
+    /* success. */
+    /* req is owned by the caller. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+
+cleanup_req:
+    dispose((disposable_t*)req);
+
+    return retval;
+}
+
+/**
+ * \brief Dispose of a decoded request structure.
+ *
+ * \param disp      The structure to dispose.
+ */
+static void dispose_protocol_req_artifact_unsubscribe(void* disp)
+{
+    protocol_req_artifact_unsubscribe* req =
+        (protocol_req_artifact_unsubscribe*)disp;
+
+    /* dispose of the artifact id buffer, if it was allocated. */
+    if (NULL != req->artifact_ids_buffer.data)
+    {
+        dispose((disposable_t*)&req->artifact_ids_buffer);
+    }
+
+    memset(req, 0, sizeof(protocol_req_artifact_unsubscribe));
+}
@@ -6,12 +6,13 @@
  * \copyright 2022 Velo Payments, Inc.  All rights reserved.
  */
 
-#include <arpa/inet.h>
 #include <cbmc/model_assert.h>
 #include <string.h>
 #include <vcblockchain/error_codes.h>
 #include <vcblockchain/protocol/serialization.h>
 
+#include "wire_internal.h"
+
 /* forward decls. */
 static void dispose_protocol_req_assert_latest_block_id(void* disp);
 
@@ -58,12 +59,13 @@ int vcblockchain_protocol_decode_req_assert_latest_block_id(
     req->hdr.dispose = &dispose_protocol_req_assert_latest_block_id;
 
     /* set the request id and offset. */
-    const uint32_t* u32arr = (const uint32_t*)payload;
-    req->request_id = ntohl(u32arr[0]);
-    req->offset = ntohl(u32arr[1]);
+    vcblockchain_wire_reader reader;
+    vcblockchain_wire_reader_init(&reader, payload, payload_size);
+    req->request_id = vcblockchain_wire_read_u32(&reader);
+    req->offset = vcblockchain_wire_read_u32(&reader);
 
     /* set the latest block id. */
-    memcpy(&req->latest_block_id, u32arr + 2, sizeof(req->latest_block_id));
+    vcblockchain_wire_read_uuid(&reader, &req->latest_block_id);
 
     /* success. */
     /* req is owned by the caller. */
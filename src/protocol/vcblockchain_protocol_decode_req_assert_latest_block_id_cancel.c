@@ -7,12 +7,13 @@
  * \copyright 2022 Velo Payments, Inc.  All rights reserved.
  */
 
-#include <arpa/inet.h>
 #include <cbmc/model_assert.h>
 #include <string.h>
 #include <vcblockchain/error_codes.h>
 #include <vcblockchain/protocol/serialization.h>
 
+#include "wire_internal.h"
+
 /* forward decls. */
 static void dispose_protocol_req_assert_latest_block_id_cancel(void* disp);
 
@@ -57,9 +58,10 @@ int vcblockchain_protocol_decode_req_assert_latest_block_id_cancel(
     req->hdr.dispose = &dispose_protocol_req_assert_latest_block_id_cancel;
 
     /* set the request id and offset. */
-    const uint32_t* u32arr = (const uint32_t*)payload;
-    req->request_id = ntohl(u32arr[0]);
-    req->offset = ntohl(u32arr[1]);
+    vcblockchain_wire_reader reader;
+    vcblockchain_wire_reader_init(&reader, payload, payload_size);
+    req->request_id = vcblockchain_wire_read_u32(&reader);
+    req->offset = vcblockchain_wire_read_u32(&reader);
 
     /* success. */
     /* req is owned by the caller. */
@@ -0,0 +1,183 @@
+/**
+ * \file protocol/vcblockchain_protocol_decode_req_batch.c
+ *
+ * \brief Decode a batch request into a struct.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/limits.h>
+#include <vcblockchain/protocol/serialization.h>
+
+#include "wire_internal.h"
+
+/* forward decls. */
+static void dispose_protocol_req_batch(void* disp);
+
+/**
+ * \brief Decode a batch request.
+ *
+ * \param req                       The decoded request buffer.
+ * \param alloc_opts                The allocator to use for this request.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p req structure is initialized with the decoded values.
+ * Each item in the batch points to an encoded request owned by \p req, which
+ * can be decoded with the matching request decode function. The caller owns
+ * this structure and must \ref dispose() it when it is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the payload is malformed, or if it
+ *        holds a request that is itself a batch.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered.
+ */
+int vcblockchain_protocol_decode_req_batch(
+    protocol_req_batch* req, allocator_options_t* alloc_opts,
+    const void* payload, size_t payload_size)
+{
+    int retval;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != req);
+    MODEL_ASSERT(NULL != alloc_opts);
+    MODEL_ASSERT(NULL != payload);
+
+    /* runtime parameter checks. */
+    if (NULL == req || NULL == alloc_opts || NULL == payload)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* verify that the payload holds the header. */
+    const size_t header_size = 3 * sizeof(uint32_t);
+    if (payload_size < header_size)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* initialize the request buffer. */
+    memset(req, 0, sizeof(*req));
+    req->hdr.dispose = &dispose_protocol_req_batch;
+
+    /* set the request id, offset, and count. */
+    vcblockchain_wire_reader reader;
+    vcblockchain_wire_reader_init(&reader, payload, payload_size);
+    req->request_id = vcblockchain_wire_read_u32(&reader);
+    req->offset = vcblockchain_wire_read_u32(&reader);
+    req->count = vcblockchain_wire_read_u32(&reader);
+    if (0 == req->count || req->count > VCBLOCKCHAIN_LIMIT_MAXIMUM_BATCH_COUNT)
+    {
+        retval = VCBLOCKCHAIN_ERROR_INVALID_ARG;
+        goto cleanup_req;
+    }
+
+    /* verify that every size-prefixed request fits in the payload. */
+    vcblockchain_wire_reader body_reader = reader;
+    for (uint32_t i = 0; i < req->count; ++i)
+    {
+        if (vcblockchain_wire_reader_remaining(&body_reader) < sizeof(uint32_t))
+        {
+            retval = VCBLOCKCHAIN_ERROR_INVALID_ARG;
+            goto cleanup_req;
+        }
+
+        /* each request must have a request id and offset. */
+        uint32_t size = vcblockchain_wire_read_u32(&body_reader);
+        if (
+            size < 2 * sizeof(uint32_t)
+         || vcblockchain_wire_reader_remaining(&body_reader) < size)
+        {
+            retval = VCBLOCKCHAIN_ERROR_INVALID_ARG;
+            goto cleanup_req;
+        }
+
+        /* batches can't be nested. */
+        vcblockchain_wire_reader item_reader;
+        vcblockchain_wire_reader_init(
+            &item_reader, vcblockchain_wire_read_skip(&body_reader, size),
+            size);
+        if (PROTOCOL_REQ_ID_BATCH == vcblockchain_wire_read_u32(&item_reader))
+        {
+            retval = VCBLOCKCHAIN_ERROR_INVALID_ARG;
+            goto cleanup_req;
+        }
+    }
+
+    /* there must not be any trailing data. */
+    if (0 != vcblockchain_wire_reader_remaining(&body_reader))
+    {
+        retval = VCBLOCKCHAIN_ERROR_INVALID_ARG;
+        goto cleanup_req;
+    }
+
+    /* copy the body of the batch. */
+    const size_t body_size = payload_size - header_size;
+    if (VCCRYPT_STATUS_SUCCESS !=
+        vccrypt_buffer_init(&req->body, alloc_opts, body_size))
+    {
+        retval = VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+        goto cleanup_req;
+    }
+
+    vcblockchain_wire_read_bytes(&reader, req->body.data, body_size);
+
+    /* create the item array. */
+    if (VCCRYPT_STATUS_SUCCESS !=
+        vccrypt_buffer_init(
+            &req->items_buffer, alloc_opts,
+            req->count * sizeof(protocol_batch_item)))
+    {
+        retval = VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+        goto cleanup_req;
+    }
+
+    req->items = (protocol_batch_item*)req->items_buffer.data;
+
+    /* point each item at its request in the body. */
+    vcblockchain_wire_reader_init(&body_reader, req->body.data, body_size);
+    for (uint32_t i = 0; i < req->count; ++i)
+    {
+        req->items[i].size = vcblockchain_wire_read_u32(&body_reader);
+        req->items[i].data =
+            vcblockchain_wire_read_skip(&body_reader, req->items[i].size);
+    }
+
+    /* success. */
+    /* req is owned by the caller. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+
+cleanup_req:
+    dispose((disposable_t*)req);
+
+    return retval;
+}
+
+/**
+ * \brief Dispose of a decoded request structure.
+ *
+ * \param disp      The structure to dispose.
+ */
+static void dispose_protocol_req_batch(void* disp)
+{
+    protocol_req_batch* req = (protocol_req_batch*)disp;
+
+    /* dispose of the item array, if allocated. */
+    if (NULL != req->items_buffer.data)
+    {
+        dispose((disposable_t*)&req->items_buffer);
+    }
+
+    /* dispose of the body, if allocated. */
+    if (NULL != req->body.data)
+    {
+        dispose((disposable_t*)&req->body);
+    }
+
+    memset(req, 0, sizeof(protocol_req_batch));
+}
@@ -6,12 +6,13 @@
  * \copyright 2020 Velo Payments, Inc.  All rights reserved.
  */
 
-#include <arpa/inet.h>
 #include <cbmc/model_assert.h>
 #include <string.h>
 #include <vcblockchain/error_codes.h>
 #include <vcblockchain/protocol/serialization.h>
 
+#include "wire_internal.h"
+
 /* forward decls. */
 static void dispose_protocol_req_block_get(void* disp);
 
@@ -55,13 +56,13 @@ int vcblockchain_protocol_decode_req_block_get(
     req->hdr.dispose = &dispose_protocol_req_block_get;
 
     /* set the request id and offset. */
-    const uint32_t* u32arr = (const uint32_t*)payload;
-    req->request_id = ntohl(u32arr[0]);
-    req->offset = ntohl(u32arr[1]);
+    vcblockchain_wire_reader reader;
+    vcblockchain_wire_reader_init(&reader, payload, payload_size);
+    req->request_id = vcblockchain_wire_read_u32(&reader);
+    req->offset = vcblockchain_wire_read_u32(&reader);
 
     /* copy the block id. */
-    const uint8_t* barr = (const uint8_t*)(u32arr + 2);
-    memcpy(&req->block_id, barr, 16);
+    vcblockchain_wire_read_uuid(&reader, &req->block_id);
 
     /* success. */
     /* req is owned by the caller. */
@@ -0,0 +1,94 @@
+/**
+ * \file protocol/vcblockchain_protocol_decode_req_block_get_fields.c
+ *
+ * \brief Decode a block get fields request into a struct.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+
+#include "wire_internal.h"
+
+/* forward decls. */
+static void dispose_protocol_req_block_get_fields(void* disp);
+
+/**
+ * \brief Decode a block get fields request.
+ *
+ * \param req                       The decoded request buffer.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p req structure is initialized with the decoded values. The
+ * caller owns this structure and must \ref dispose() it when it is no longer
+ * needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the payload is malformed or the
+ *        field mask has unknown bits.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_decode_req_block_get_fields(
+    protocol_req_block_get_fields* req, const void* payload,
+    size_t payload_size)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != req);
+    MODEL_ASSERT(NULL != payload);
+
+    /* runtime parameter checks. */
+    if (NULL == req || NULL == payload)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* verify that the payload size is correct. */
+    const size_t expected_payload_size = 3 * sizeof(uint32_t) + 16;
+    if (expected_payload_size != payload_size)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* initialize the request buffer. */
+    memset(req, 0, sizeof(*req));
+    req->hdr.dispose = &dispose_protocol_req_block_get_fields;
+
+    /* set the request id and offset. */
+    vcblockchain_wire_reader reader;
+    vcblockchain_wire_reader_init(&reader, payload, payload_size);
+    req->request_id = vcblockchain_wire_read_u32(&reader);
+    req->offset = vcblockchain_wire_read_u32(&reader);
+
+    /* copy the block id. */
+    vcblockchain_wire_read_uuid(&reader, &req->block_id);
+
+    /* read the field mask, rejecting fields we don't know about. */
+    req->field_mask = vcblockchain_wire_read_u32(&reader);
+    if (0 != (req->field_mask & ~PROTOCOL_BLOCK_FIELD_ALL))
+    {
+        dispose((disposable_t*)req);
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* success. */
+    /* req is owned by the caller. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
+
+/**
+ * \brief Dispose of a decoded request structure.
+ *
+ * \param disp      The structure to dispose.
+ */
+static void dispose_protocol_req_block_get_fields(void* disp)
+{
+    protocol_req_block_get_fields* req =
+        (protocol_req_block_get_fields*)disp;
+
+    memset(req, 0, sizeof(protocol_req_block_get_fields));
+}
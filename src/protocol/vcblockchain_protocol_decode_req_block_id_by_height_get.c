@@ -6,13 +6,13 @@
  * \copyright 2021 Velo Payments, Inc.  All rights reserved.
  */
 
-#include <arpa/inet.h>
 #include <cbmc/model_assert.h>
 #include <string.h>
-#include <vcblockchain/byteswap.h>
 #include <vcblockchain/error_codes.h>
 #include <vcblockchain/protocol/serialization.h>
 
+#include "wire_internal.h"
+
 /* forward decls. */
 static void dispose_protocol_req_block_id_by_height_get(void* disp);
 
@@ -57,13 +57,13 @@ int vcblockchain_protocol_decode_req_block_id_by_height_get(
     req->hdr.dispose = &dispose_protocol_req_block_id_by_height_get;
 
     /* set the request id and offset. */
-    const uint32_t* u32arr = (const uint32_t*)payload;
-    req->request_id = ntohl(u32arr[0]);
-    req->offset = ntohl(u32arr[1]);
+    vcblockchain_wire_reader reader;
+    vcblockchain_wire_reader_init(&reader, payload, payload_size);
+    req->request_id = vcblockchain_wire_read_u32(&reader);
+    req->offset = vcblockchain_wire_read_u32(&reader);
 
     /* copy the block height. */
-    const uint64_t* b64 = (const uint64_t*)(u32arr + 2);
-    req->height = ntohll(*b64);
+    req->height = vcblockchain_wire_read_u64(&reader);
 
     /* success. */
     /* req is owned by the caller. */
@@ -7,12 +7,13 @@
  * \copyright 2022 Velo Payments, Inc.  All rights reserved.
  */
 
-#include <arpa/inet.h>
 #include <cbmc/model_assert.h>
 #include <string.h>
 #include <vcblockchain/error_codes.h>
 #include <vcblockchain/protocol/serialization.h>
 
+#include "wire_internal.h"
+
 /* forward decls. */
 static void dispose_protocol_req_extended_api(void* disp);
 
@@ -61,16 +62,14 @@ int vcblockchain_protocol_decode_req_extended_api(
     req->hdr.dispose = &dispose_protocol_req_extended_api;
 
     /* set the request id and offset. */
-    const uint32_t* u32arr = (const uint32_t*)payload;
-    req->request_id = ntohl(u32arr[0]);
-    req->offset = ntohl(u32arr[1]);
+    vcblockchain_wire_reader reader;
+    vcblockchain_wire_reader_init(&reader, payload, payload_size);
+    req->request_id = vcblockchain_wire_read_u32(&reader);
+    req->offset = vcblockchain_wire_read_u32(&reader);
 
     /* copy the UUIDs. */
-    const uint8_t* u8arr = (const uint8_t*)(u32arr + 2);
-    memcpy(&req->entity_id, u8arr, sizeof(req->entity_id));
-    u8arr += sizeof(req->entity_id);
-    memcpy(&req->verb_id, u8arr, sizeof(req->verb_id));
-    u8arr += sizeof(req->verb_id);
+    vcblockchain_wire_read_uuid(&reader, &req->entity_id);
+    vcblockchain_wire_read_uuid(&reader, &req->verb_id);
 
     /* compute the request body size. */
     const size_t request_body_size = payload_size - expected_payload_size;
@@ -85,7 +84,8 @@ int vcblockchain_protocol_decode_req_extended_api(
     }
 
     /* copy the request body. */
-    memcpy(req->request_body.data, u8arr, request_body_size);
+    vcblockchain_wire_read_bytes(
+        &reader, req->request_body.data, request_body_size);
 
     /* success. */
     /* req is owned by the caller. */
@@ -6,13 +6,13 @@
  * \copyright 2022 Velo Payments, Inc.  All rights reserved.
  */
 
-#include <arpa/inet.h>
 #include <cbmc/model_assert.h>
 #include <string.h>
-#include <vcblockchain/byteswap.h>
 #include <vcblockchain/error_codes.h>
 #include <vcblockchain/protocol/serialization.h>
 
+#include "wire_internal.h"
+
 /* forward decls. */
 static void dispose_protocol_req_extended_api_response(void* disp);
 
@@ -62,25 +62,17 @@ int vcblockchain_protocol_decode_req_extended_api_response(
     req->hdr.dispose = &dispose_protocol_req_extended_api_response;
 
     /* make working with the payload more convenient. */
-    const uint8_t* barr = (const uint8_t*)payload;
+    vcblockchain_wire_reader reader;
+    vcblockchain_wire_reader_init(&reader, payload, payload_size);
 
     /* copy the request id. */
-    uint32_t net_request_id;
-    memcpy(&net_request_id, barr, sizeof(net_request_id));
-    barr += sizeof(net_request_id);
-    req->request_id = ntohl(net_request_id);
+    req->request_id = vcblockchain_wire_read_u32(&reader);
 
     /* copy the offset. */
-    uint64_t net_offset;
-    memcpy(&net_offset, barr, sizeof(net_offset));
-    barr += sizeof(net_offset);
-    req->offset = ntohll(net_offset);
+    req->offset = vcblockchain_wire_read_u64(&reader);
 
     /* copy the status. */
-    uint32_t net_status;
-    memcpy(&net_status, barr, sizeof(net_status));
-    barr += sizeof(net_status);
-    req->status = ntohl(net_status);
+    req->status = vcblockchain_wire_read_u32(&reader);
 
     /* compute the response body size. */
     const size_t response_body_size = payload_size - expected_payload_size;
@@ -95,8 +87,8 @@ int vcblockchain_protocol_decode_req_extended_api_response(
     }
 
     /* copy the response body. */
-    memcpy(req->response_body.data, barr, req->response_body.size);
-    barr += req->response_body.size;
+    vcblockchain_wire_read_bytes(
+        &reader, req->response_body.data, req->response_body.size);
 
     /* success. */
     /* req is owned by the caller. */
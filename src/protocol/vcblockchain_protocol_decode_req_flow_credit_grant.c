@@ -0,0 +1,98 @@
+/**
+ * \file protocol/vcblockchain_protocol_decode_req_flow_credit_grant.c
+ *
+ * \brief Decode a flow credit grant request into a struct.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+
+#include "wire_internal.h"
+
+/* forward decls. */
+static void dispose_protocol_req_flow_credit_grant(void* disp);
+
+/**
+ * \brief Decode a flow credit grant request.
+ *
+ * \param req                       The decoded request buffer.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p req structure is initialized with the decoded values. The
+ * caller owns this structure and must \ref dispose() it when it is no longer
+ * needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE if the payload
+ *        has the wrong size.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the payload is not a
+ *        flow credit grant request.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_decode_req_flow_credit_grant(
+    protocol_req_flow_credit_grant* req, const void* payload,
+    size_t payload_size)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != req);
+    MODEL_ASSERT(NULL != payload);
+
+    /* runtime parameter checks. */
+    if (NULL == req || NULL == payload)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* verify that the payload size is correct. */
+    const size_t expected_payload_size =
+          sizeof(uint32_t) /* request_id */
+        + sizeof(uint32_t) /* offset */
+        + sizeof(uint32_t) /* request_credits */
+        + sizeof(uint64_t); /* byte_credits */
+    if (expected_payload_size != payload_size)
+    {
+        return VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE;
+    }
+
+    /* initialize the request buffer. */
+    memset(req, 0, sizeof(*req));
+    req->hdr.dispose = &dispose_protocol_req_flow_credit_grant;
+
+    /* read the request id. */
+    vcblockchain_wire_reader reader;
+    vcblockchain_wire_reader_init(&reader, payload, payload_size);
+    req->request_id = vcblockchain_wire_read_u32(&reader);
+    if (PROTOCOL_REQ_ID_FLOW_CREDIT_GRANT != req->request_id)
+    {
+        memset(req, 0, sizeof(*req));
+        return VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE;
+    }
+
+    /* read the rest of the request. */
+    req->offset = vcblockchain_wire_read_u32(&reader);
+    req->request_credits = vcblockchain_wire_read_u32(&reader);
+    req->byte_credits = vcblockchain_wire_read_u64(&reader);
+
+    /* success. */
+    /* req is owned by the caller. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
+
+/**
+ * \brief Dispose of a decoded request structure.
+ *
+ * \param disp      The structure to dispose.
+ */
+static void dispose_protocol_req_flow_credit_grant(void* disp)
+{
+    protocol_req_flow_credit_grant* req =
+        (protocol_req_flow_credit_grant*)disp;
+
+    memset(req, 0, sizeof(protocol_req_flow_credit_grant));
+}
@@ -6,13 +6,14 @@
  * \copyright 2020 Velo Payments, Inc.  All rights reserved.
  */
 
-#include <arpa/inet.h>
 #include <cbmc/model_assert.h>
 #include <vcblockchain/error_codes.h>
 #include <vcblockchain/protocol/data.h>
 #include <vcblockchain/protocol/serialization.h>
 #include <string.h>
 
+#include "wire_internal.h"
+
 /* forward decls. */
 static void dispose_protocol_req_handshake_request(void* disp);
 
@@ -37,8 +38,6 @@ int vcblockchain_protocol_decode_req_handshake_request(
     const void* payload, size_t payload_size)
 {
     int retval;
-    uint32_t net_request_id, net_offset, net_protocol_version;
-    uint32_t net_crypto_suite;
 
     /* parameter sanity checks. */
     MODEL_ASSERT(NULL != req);
@@ -47,10 +46,10 @@ int vcblockchain_protocol_decode_req_handshake_request(
 
     /* compute the expected payload size. */
     size_t expected_payload_size =
-          sizeof(net_request_id)
-        + sizeof(net_offset)
-        + sizeof(net_protocol_version)
-        + sizeof(net_crypto_suite)
+          sizeof(uint32_t) /* request_id */
+        + sizeof(uint32_t) /* offset */
+        + sizeof(uint32_t) /* protocol_version */
+        + sizeof(uint32_t) /* crypto_suite */
         + sizeof(vpr_uuid)
         + suite->key_cipher_opts.minimum_nonce_size
         + suite->key_cipher_opts.minimum_nonce_size;
@@ -84,13 +83,12 @@ int vcblockchain_protocol_decode_req_handshake_request(
         goto cleanup_client_key_nonce;
     }
 
-    /* byte pointer for convenience. */
-    const uint8_t* buf = (const uint8_t*)payload;
+    /* read cursor for convenience. */
+    vcblockchain_wire_reader reader;
+    vcblockchain_wire_reader_init(&reader, payload, payload_size);
 
     /* read the request id. */
-    memcpy(&net_request_id, buf, sizeof(net_request_id));
-    req->request_id = ntohl(net_request_id);
-    buf += sizeof(net_request_id);
+    req->request_id = vcblockchain_wire_read_u32(&reader);
     if (PROTOCOL_REQ_ID_HANDSHAKE_INITIATE != req->request_id)
     {
         retval = VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE;
@@ -98,14 +96,10 @@ int vcblockchain_protocol_decode_req_handshake_request(
     }
 
     /* read the request offset. */
-    memcpy(&net_offset, buf, sizeof(net_offset));
-    req->offset = ntohl(net_offset);
-    buf += sizeof(net_offset);
+    req->offset = vcblockchain_wire_read_u32(&reader);
 
     /* read the protocol version. */
-    memcpy(&net_protocol_version, buf, sizeof(net_protocol_version));
-    req->protocol_version = ntohl(net_protocol_version);
-    buf += sizeof(net_protocol_version);
+    req->protocol_version = vcblockchain_wire_read_u32(&reader);
     if (PROTOCOL_VERSION_0_1_DEMO != req->protocol_version)
     {
         retval = VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE;
@@ -113,9 +107,7 @@ int vcblockchain_protocol_decode_req_handshake_request(
     }
 
     /* read the crypto suite. */
-    memcpy(&net_crypto_suite, buf, sizeof(net_crypto_suite));
-    req->crypto_suite = ntohl(net_crypto_suite);
-    buf += sizeof(net_crypto_suite);
+    req->crypto_suite = vcblockchain_wire_read_u32(&reader);
     if (req->crypto_suite != suite->suite_id)
     {
         retval = VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE;
@@ -123,18 +115,16 @@ int vcblockchain_protocol_decode_req_handshake_request(
     }
 
     /* read the client entity id. */
-    memcpy(&req->client_id, buf, sizeof(req->client_id));
-    buf += sizeof(req->client_id);
+    vcblockchain_wire_read_uuid(&reader, &req->client_id);
 
     /* read the client key nonce. */
-    memcpy(req->client_key_nonce.data, buf, req->client_key_nonce.size);
-    buf += req->client_key_nonce.size;
+    vcblockchain_wire_read_bytes(
+        &reader, req->client_key_nonce.data, req->client_key_nonce.size);
 
     /* read the client challenge nonce. */
-    memcpy(
-        req->client_challenge_nonce.data, buf,
+    vcblockchain_wire_read_bytes(
+        &reader, req->client_challenge_nonce.data,
         req->client_challenge_nonce.size);
-    buf += req->client_challenge_nonce.size;
 
     /* success. */
     retval = VCBLOCKCHAIN_STATUS_SUCCESS;
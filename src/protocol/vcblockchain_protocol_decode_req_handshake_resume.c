@@ -0,0 +1,163 @@
+/**
+ * \file protocol/vcblockchain_protocol_decode_req_handshake_resume.c
+ *
+ * \brief Decode a handshake resume request into a request structure.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/data.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <string.h>
+
+#include "wire_internal.h"
+
+/* forward decls. */
+static void dispose_protocol_req_handshake_resume(void* disp);
+
+/**
+ * \brief Decode a handshake resume request using the given parameters.
+ *
+ * \param req                       The decoded request buffer.
+ * \param suite                     The crypto suite to use for this request.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p req structure is initialized with the decoded values.  The
+ * caller owns this structure and must \ref dispose() it when it is no longer
+ * needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE if the payload is
+ *        too small to hold a ticket.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the request id,
+ *        protocol version, or crypto suite is unexpected.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_decode_req_handshake_resume(
+    protocol_req_handshake_resume* req, vccrypt_suite_options_t* suite,
+    const void* payload, size_t payload_size)
+{
+    int retval;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != req);
+    MODEL_ASSERT(NULL != suite);
+    MODEL_ASSERT(NULL != payload);
+
+    /* compute the size of the request without the ticket. */
+    size_t fixed_payload_size =
+          sizeof(uint32_t) /* request_id */
+        + sizeof(uint32_t) /* offset */
+        + sizeof(uint32_t) /* protocol_version */
+        + sizeof(uint32_t) /* crypto_suite */
+        + sizeof(vpr_uuid)
+        + suite->key_cipher_opts.minimum_nonce_size;
+
+    /* the ticket can't be empty. */
+    if (payload_size <= fixed_payload_size)
+    {
+        retval = VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE;
+        goto done;
+    }
+
+    /* set up the request buffer. */
+    memset(req, 0, sizeof(protocol_req_handshake_resume));
+    req->hdr.dispose = &dispose_protocol_req_handshake_resume;
+
+    /* allocate client_key_nonce buffer. */
+    retval =
+        vccrypt_suite_buffer_init_for_cipher_key_agreement_nonce(
+            suite, &req->client_key_nonce);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_req;
+    }
+
+    /* allocate the ticket buffer. */
+    retval =
+        vccrypt_buffer_init(
+            &req->ticket, suite->alloc_opts,
+            payload_size - fixed_payload_size);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_client_key_nonce;
+    }
+
+    /* read cursor for convenience. */
+    vcblockchain_wire_reader reader;
+    vcblockchain_wire_reader_init(&reader, payload, payload_size);
+
+    /* read the request id. */
+    req->request_id = vcblockchain_wire_read_u32(&reader);
+    if (PROTOCOL_REQ_ID_HANDSHAKE_RESUME != req->request_id)
+    {
+        retval = VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE;
+        goto cleanup_ticket;
+    }
+
+    /* read the request offset. */
+    req->offset = vcblockchain_wire_read_u32(&reader);
+
+    /* read the protocol version. */
+    req->protocol_version = vcblockchain_wire_read_u32(&reader);
+    if (PROTOCOL_VERSION_0_3_RESUMPTION != req->protocol_version)
+    {
+        retval = VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE;
+        goto cleanup_ticket;
+    }
+
+    /* read the crypto suite. */
+    req->crypto_suite = vcblockchain_wire_read_u32(&reader);
+    if (req->crypto_suite != suite->suite_id)
+    {
+        retval = VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE;
+        goto cleanup_ticket;
+    }
+
+    /* read the client entity id. */
+    vcblockchain_wire_read_uuid(&reader, &req->client_id);
+
+    /* read the client key nonce. */
+    vcblockchain_wire_read_bytes(
+        &reader, req->client_key_nonce.data, req->client_key_nonce.size);
+
+    /* read the ticket. */
+    vcblockchain_wire_read_bytes(&reader, req->ticket.data, req->ticket.size);
+
+    /* success. */
+    retval = VCBLOCKCHAIN_STATUS_SUCCESS;
+    /* on success, the request struct is owned by the caller. */
+    goto done;
+
+cleanup_ticket:
+    dispose((disposable_t*)&req->ticket);
+
+cleanup_client_key_nonce:
+    dispose((disposable_t*)&req->client_key_nonce);
+
+cleanup_req:
+    memset(req, 0, sizeof(protocol_req_handshake_resume));
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Dispose of the decoded request buffer.
+ */
+static void dispose_protocol_req_handshake_resume(void* disp)
+{
+    protocol_req_handshake_resume* req = (protocol_req_handshake_resume*)disp;
+
+    /* clean up the client key nonce. */
+    dispose((disposable_t*)&req->client_key_nonce);
+    /* clean up the ticket. */
+    dispose((disposable_t*)&req->ticket);
+
+    /* clear the structure. */
+    memset(req, 0, sizeof(protocol_req_handshake_resume));
+}
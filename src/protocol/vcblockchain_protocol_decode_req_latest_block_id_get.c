@@ -6,12 +6,13 @@
  * \copyright 2020 Velo Payments, Inc.  All rights reserved.
  */
 
-#include <arpa/inet.h>
 #include <cbmc/model_assert.h>
 #include <string.h>
 #include <vcblockchain/error_codes.h>
 #include <vcblockchain/protocol/serialization.h>
 
+#include "wire_internal.h"
+
 /* forward decls. */
 static void dispose_protocol_req_latest_block_id_get(void* disp);
 
@@ -56,9 +57,12 @@ int vcblockchain_protocol_decode_req_latest_block_id_get(
     /* initialize the request structure. */
     memset(req, 0, sizeof(*req));
     req->hdr.dispose = &dispose_protocol_req_latest_block_id_get;
-    const uint32_t* parr = (const uint32_t*)payload;
-    req->request_id = ntohl(parr[0]);
-    req->offset = ntohl(parr[1]);
+
+    /* read the request fields. */
+    vcblockchain_wire_reader reader;
+    vcblockchain_wire_reader_init(&reader, payload, payload_size);
+    req->request_id = vcblockchain_wire_read_u32(&reader);
+    req->offset = vcblockchain_wire_read_u32(&reader);
 
     /* success. */
     return VCBLOCKCHAIN_STATUS_SUCCESS;
@@ -0,0 +1,128 @@
+/**
+ * \file protocol/vcblockchain_protocol_decode_req_rekey.c
+ *
+ * \brief Decode a rekey request into a request structure.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/data.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <string.h>
+
+#include "wire_internal.h"
+
+/* forward decls. */
+static void dispose_protocol_req_rekey(void* disp);
+
+/**
+ * \brief Decode a rekey request.
+ *
+ * \param req                       The request structure to receive the
+ *                                  decoded request.
+ * \param suite                     The crypto suite to use for this request.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p req structure is initialized with the decoded values.
+ * The caller owns this structure and must \ref dispose() it when it is no
+ * longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE if the payload
+ *        has the wrong size.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the payload is not a
+ *        rekey request.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_decode_req_rekey(
+    protocol_req_rekey* req, vccrypt_suite_options_t* suite,
+    const void* payload, size_t payload_size)
+{
+    int retval;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != req);
+    MODEL_ASSERT(NULL != suite);
+    MODEL_ASSERT(NULL != payload);
+
+    /* compute the expected payload size. */
+    size_t expected_payload_size =
+          sizeof(uint32_t) /* request_id */
+        + sizeof(uint32_t) /* offset */
+        + sizeof(uint64_t) /* client_switch_iv */
+        + suite->key_cipher_opts.minimum_nonce_size;
+
+    /* verify the payload size. */
+    if (payload_size != expected_payload_size)
+    {
+        retval = VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE;
+        goto done;
+    }
+
+    /* set up the request buffer. */
+    memset(req, 0, sizeof(protocol_req_rekey));
+    req->hdr.dispose = &dispose_protocol_req_rekey;
+
+    /* allocate client_key_nonce buffer. */
+    retval =
+        vccrypt_suite_buffer_init_for_cipher_key_agreement_nonce(
+            suite, &req->client_key_nonce);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_req;
+    }
+
+    /* read cursor for convenience. */
+    vcblockchain_wire_reader reader;
+    vcblockchain_wire_reader_init(&reader, payload, payload_size);
+
+    /* read the request id. */
+    req->request_id = vcblockchain_wire_read_u32(&reader);
+    if (PROTOCOL_REQ_ID_REKEY != req->request_id)
+    {
+        retval = VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE;
+        goto cleanup_client_key_nonce;
+    }
+
+    /* read the request offset. */
+    req->offset = vcblockchain_wire_read_u32(&reader);
+
+    /* read the client switch IV. */
+    req->client_switch_iv = vcblockchain_wire_read_u64(&reader);
+
+    /* read the client key nonce. */
+    vcblockchain_wire_read_bytes(
+        &reader, req->client_key_nonce.data, req->client_key_nonce.size);
+
+    /* success. */
+    retval = VCBLOCKCHAIN_STATUS_SUCCESS;
+    /* on success, the request struct is owned by the caller. */
+    goto done;
+
+cleanup_client_key_nonce:
+    dispose((disposable_t*)&req->client_key_nonce);
+
+cleanup_req:
+    memset(req, 0, sizeof(protocol_req_rekey));
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Dispose of the decoded request buffer.
+ */
+static void dispose_protocol_req_rekey(void* disp)
+{
+    protocol_req_rekey* req = (protocol_req_rekey*)disp;
+
+    /* clean up the client key nonce. */
+    dispose((disposable_t*)&req->client_key_nonce);
+
+    /* clear the structure. */
+    memset(req, 0, sizeof(protocol_req_rekey));
+}
@@ -6,12 +6,13 @@
  * \copyright 2020 Velo Payments, Inc.  All rights reserved.
  */
 
-#include <arpa/inet.h>
 #include <cbmc/model_assert.h>
 #include <string.h>
 #include <vcblockchain/error_codes.h>
 #include <vcblockchain/protocol/serialization.h>
 
+#include "wire_internal.h"
+
 /* forward decls. */
 static void dispose_protocol_req_transaction_submit(void* disp);
 
@@ -66,17 +67,17 @@ int vcblockchain_protocol_decode_req_transaction_submit(
     }
 
     /* set the request_id and offset. */
-    const uint32_t* u32arr = (const uint32_t*)payload;
-    req->request_id = ntohl(u32arr[0]);
-    req->offset = ntohl(u32arr[1]);
+    vcblockchain_wire_reader reader;
+    vcblockchain_wire_reader_init(&reader, payload, payload_size);
+    req->request_id = vcblockchain_wire_read_u32(&reader);
+    req->offset = vcblockchain_wire_read_u32(&reader);
 
     /* copy the transaction id and artifact id. */
-    const uint8_t* barr = (const uint8_t*)(u32arr + 2);
-    memcpy(&req->txn_id,      barr,      16);
-    memcpy(&req->artifact_id, barr + 16, 16);
+    vcblockchain_wire_read_uuid(&reader, &req->txn_id);
+    vcblockchain_wire_read_uuid(&reader, &req->artifact_id);
 
     /* copy the certificate. */
-    memcpy(req->cert.data, barr + 32, cert_size);
+    vcblockchain_wire_read_bytes(&reader, req->cert.data, cert_size);
 
     /* success. */
     /* req is owned by the caller. */
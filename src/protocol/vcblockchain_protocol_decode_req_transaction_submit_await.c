@@ -0,0 +1,102 @@
+/**
+ * \file protocol/vcblockchain_protocol_decode_req_transaction_submit_await.c
+ *
+ * \brief Decode a transaction submit and await request.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+
+#include "wire_internal.h"
+
+/* forward decls. */
+static void dispose_protocol_req_transaction_submit_await(void* disp);
+
+/**
+ * \brief Decode a transaction submit and await request.
+ *
+ * \param req                       The decoded request buffer.
+ * \param alloc_opts                The allocator options to use.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p req structure is initialized with the decoded values. The
+ * caller owns this structure and must \ref dispose() it when it is no longer
+ * needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_decode_req_transaction_submit_await(
+    protocol_req_transaction_submit_await* req,
+    allocator_options_t* alloc_opts, const void* payload, size_t payload_size)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != req);
+    MODEL_ASSERT(NULL != alloc_opts);
+    MODEL_ASSERT(NULL != payload);
+
+    /* runtime parameter checks. */
+    if (NULL == req || NULL == alloc_opts || NULL == payload)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* verify that the payload is at least large enough to hold the header. */
+    const size_t minimum_payload_size = 3 * sizeof(uint32_t) + 2 * 16;
+    if (payload_size < minimum_payload_size)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* initialize the request buffer. */
+    memset(req, 0, sizeof(*req));
+    req->hdr.dispose = &dispose_protocol_req_transaction_submit_await;
+
+    /* initialize the transaction cert. */
+    size_t cert_size = payload_size - minimum_payload_size;
+    if (VCCRYPT_STATUS_SUCCESS !=
+        vccrypt_buffer_init(&req->cert, alloc_opts, cert_size))
+    {
+        return VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* set the request_id, offset, and timeout. */
+    vcblockchain_wire_reader reader;
+    vcblockchain_wire_reader_init(&reader, payload, payload_size);
+    req->request_id = vcblockchain_wire_read_u32(&reader);
+    req->offset = vcblockchain_wire_read_u32(&reader);
+    req->timeout_ms = vcblockchain_wire_read_u32(&reader);
+
+    /* copy the transaction id and artifact id. */
+    vcblockchain_wire_read_uuid(&reader, &req->txn_id);
+    vcblockchain_wire_read_uuid(&reader, &req->artifact_id);
+
+    /* copy the certificate. */
+    vcblockchain_wire_read_bytes(&reader, req->cert.data, cert_size);
+
+    /* success. */
+    /* req is owned by the caller. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
+
+/**
+ * \brief Dispose of a decoded request structure.
+ *
+ * \param disp      The structure to dispose.
+ */
+static void dispose_protocol_req_transaction_submit_await(void* disp)
+{
+    protocol_req_transaction_submit_await* req =
+        (protocol_req_transaction_submit_await*)disp;
+
+    /* clean up the certificate buffer. */
+    dispose((disposable_t*)&req->cert);
+
+    memset(req, 0, sizeof(protocol_req_transaction_submit_await));
+}
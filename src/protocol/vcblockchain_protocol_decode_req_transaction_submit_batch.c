@@ -0,0 +1,179 @@
+/**
+ * \file protocol/vcblockchain_protocol_decode_req_transaction_submit_batch.c
+ *
+ * \brief Decode a transaction submit batch request into a struct.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/limits.h>
+#include <vcblockchain/protocol/serialization.h>
+
+#include "wire_internal.h"
+
+/* forward decls. */
+static void dispose_protocol_req_transaction_submit_batch(void* disp);
+
+/**
+ * \brief Decode a transaction submit batch request.
+ *
+ * \param req                       The decoded request buffer.
+ * \param alloc_opts                The allocator to use for this request.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p req structure is initialized with the decoded values.
+ * Each item's certificate is owned by \p req. The caller owns this structure
+ * and must \ref dispose() it when it is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the payload is malformed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered.
+ */
+int vcblockchain_protocol_decode_req_transaction_submit_batch(
+    protocol_req_transaction_submit_batch* req,
+    allocator_options_t* alloc_opts, const void* payload, size_t payload_size)
+{
+    int retval;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != req);
+    MODEL_ASSERT(NULL != alloc_opts);
+    MODEL_ASSERT(NULL != payload);
+
+    /* runtime parameter checks. */
+    if (NULL == req || NULL == alloc_opts || NULL == payload)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* verify that the payload holds the header. */
+    const size_t header_size = 3 * sizeof(uint32_t);
+    if (payload_size < header_size)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* initialize the request buffer. */
+    memset(req, 0, sizeof(*req));
+    req->hdr.dispose = &dispose_protocol_req_transaction_submit_batch;
+
+    /* set the request id, offset, and count. */
+    vcblockchain_wire_reader reader;
+    vcblockchain_wire_reader_init(&reader, payload, payload_size);
+    req->request_id = vcblockchain_wire_read_u32(&reader);
+    req->offset = vcblockchain_wire_read_u32(&reader);
+    req->count = vcblockchain_wire_read_u32(&reader);
+    if (0 == req->count || req->count > VCBLOCKCHAIN_LIMIT_MAXIMUM_BATCH_COUNT)
+    {
+        retval = VCBLOCKCHAIN_ERROR_INVALID_ARG;
+        goto cleanup_req;
+    }
+
+    /* verify that every transaction fits in the payload. */
+    const size_t record_header_size =
+          sizeof(uint32_t) /* cert size. */
+        + 2 * 16; /* txn_id and artifact_id. */
+    vcblockchain_wire_reader body_reader = reader;
+    for (uint32_t i = 0; i < req->count; ++i)
+    {
+        if (vcblockchain_wire_reader_remaining(&body_reader)
+                < record_header_size)
+        {
+            retval = VCBLOCKCHAIN_ERROR_INVALID_ARG;
+            goto cleanup_req;
+        }
+
+        uint32_t cert_size = vcblockchain_wire_read_u32(&body_reader);
+        vcblockchain_wire_read_skip(&body_reader, 2 * 16);
+        if (vcblockchain_wire_reader_remaining(&body_reader) < cert_size)
+        {
+            retval = VCBLOCKCHAIN_ERROR_INVALID_ARG;
+            goto cleanup_req;
+        }
+
+        vcblockchain_wire_read_skip(&body_reader, cert_size);
+    }
+
+    /* there must not be any trailing data. */
+    if (0 != vcblockchain_wire_reader_remaining(&body_reader))
+    {
+        retval = VCBLOCKCHAIN_ERROR_INVALID_ARG;
+        goto cleanup_req;
+    }
+
+    /* copy the body of the batch. */
+    const size_t body_size = payload_size - header_size;
+    if (VCCRYPT_STATUS_SUCCESS !=
+        vccrypt_buffer_init(&req->body, alloc_opts, body_size))
+    {
+        retval = VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+        goto cleanup_req;
+    }
+
+    vcblockchain_wire_read_bytes(&reader, req->body.data, body_size);
+
+    /* create the item array. */
+    if (VCCRYPT_STATUS_SUCCESS !=
+        vccrypt_buffer_init(
+            &req->items_buffer, alloc_opts,
+            req->count * sizeof(protocol_transaction_submit_batch_item)))
+    {
+        retval = VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+        goto cleanup_req;
+    }
+
+    req->items =
+        (protocol_transaction_submit_batch_item*)req->items_buffer.data;
+
+    /* decode each item, pointing its certificate into the body. */
+    vcblockchain_wire_reader_init(&body_reader, req->body.data, body_size);
+    for (uint32_t i = 0; i < req->count; ++i)
+    {
+        protocol_transaction_submit_batch_item* item = &req->items[i];
+
+        item->cert_size = vcblockchain_wire_read_u32(&body_reader);
+        vcblockchain_wire_read_uuid(&body_reader, &item->txn_id);
+        vcblockchain_wire_read_uuid(&body_reader, &item->artifact_id);
+        item->cert = vcblockchain_wire_read_skip(&body_reader, item->cert_size);
+    }
+
+    /* success. */
+    /* req is owned by the caller. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+
+cleanup_req:
+    dispose((disposable_t*)req);
+
+    return retval;
+}
+
+/**
+ * \brief Dispose of a decoded request structure.
+ *
+ * \param disp      The structure to dispose.
+ */
+static void dispose_protocol_req_transaction_submit_batch(void* disp)
+{
+    protocol_req_transaction_submit_batch* req =
+        (protocol_req_transaction_submit_batch*)disp;
+
+    /* dispose of the item array, if allocated. */
+    if (NULL != req->items_buffer.data)
+    {
+        dispose((disposable_t*)&req->items_buffer);
+    }
+
+    /* dispose of the body, if allocated. */
+    if (NULL != req->body.data)
+    {
+        dispose((disposable_t*)&req->body);
+    }
+
+    memset(req, 0, sizeof(protocol_req_transaction_submit_batch));
+}
@@ -0,0 +1,105 @@
+/**
+ * \file
+ * protocol/vcblockchain_protocol_decode_resp_artifact_last_txn_id_get_if_changed.c
+ *
+ * \brief Decode a conditional artifact last txn id get response.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+
+#include "wire_internal.h"
+
+/* forward decls. */
+static void dispose_protocol_resp_artifact_last_txn_id_get_if_changed(
+    void* disp);
+
+/**
+ * \brief Decode a conditional artifact last txn id get response.
+ *
+ * \param resp                      The decoded response buffer.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p resp structure is initialized with the decoded values.
+ * The caller owns this structure and must \ref dispose() it when it is no
+ * longer needed. If the status is \ref
+ * VCBLOCKCHAIN_ERROR_PROTOCOL_NOT_MODIFIED, then the response only holds a
+ * header, and the last transaction id is left zeroed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_decode_resp_artifact_last_txn_id_get_if_changed(
+    protocol_resp_artifact_last_txn_id_get_if_changed* resp,
+    const void* payload, size_t payload_size)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != resp);
+    MODEL_ASSERT(NULL != payload);
+
+    /* runtime parameter checks. */
+    if (NULL == resp || NULL == payload)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* the response must at least hold a header. */
+    const size_t header_size = 3 * sizeof(uint32_t);
+    if (payload_size < header_size)
+    {
+        return VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE;
+    }
+
+    /* read the header fields. */
+    vcblockchain_wire_reader reader;
+    vcblockchain_wire_reader_init(&reader, payload, payload_size);
+    uint32_t request_id = vcblockchain_wire_read_u32(&reader);
+    uint32_t status = vcblockchain_wire_read_u32(&reader);
+    uint32_t offset = vcblockchain_wire_read_u32(&reader);
+
+    /* a not modified response omits the last transaction id. */
+    const size_t resp_size =
+          header_size
+        + ((VCBLOCKCHAIN_ERROR_PROTOCOL_NOT_MODIFIED == status) ? 0U : 16U);
+    if (resp_size != payload_size)
+    {
+        return VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE;
+    }
+
+    /* initialize the response structure. */
+    memset(resp, 0, sizeof(*resp));
+    resp->hdr.dispose =
+        &dispose_protocol_resp_artifact_last_txn_id_get_if_changed;
+    resp->request_id = request_id;
+    resp->status = status;
+    resp->offset = offset;
+
+    /* read the last transaction id, if present. */
+    if (vcblockchain_wire_reader_remaining(&reader) > 0U)
+    {
+        vcblockchain_wire_read_uuid(&reader, &resp->last_txn_id);
+    }
+
+    /* success. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
+
+/**
+ * \brief Dispose of a decoded response structure.
+ *
+ * \param disp      The structure to dispose.
+ */
+static void dispose_protocol_resp_artifact_last_txn_id_get_if_changed(
+    void* disp)
+{
+    protocol_resp_artifact_last_txn_id_get_if_changed* resp =
+        (protocol_resp_artifact_last_txn_id_get_if_changed*)disp;
+
+    memset(resp, 0, sizeof(protocol_resp_artifact_last_txn_id_get_if_changed));
+}
@@ -0,0 +1,46 @@
+/**
+ * \file protocol/vcblockchain_protocol_decode_resp_artifact_latest_txn_get.c
+ *
+ * \brief Decode an artifact latest txn get response into a struct.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+
+/**
+ * \brief Decode an artifact latest transaction get response.
+ *
+ * \param resp                      The decoded response buffer.
+ * \param alloc_opts                The allocator to use for this response.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * This response has the same layout as a transaction get response, so it is
+ * decoded into a \ref protocol_resp_txn_get. The request_id field of \p resp
+ * holds \ref PROTOCOL_REQ_ID_ARTIFACT_LATEST_TXN_GET.
+ *
+ * On success, the \p resp structure is initialized with the decoded values.
+ * The caller owns this structure and must \ref dispose() it when it is no
+ * longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_decode_resp_artifact_latest_txn_get(
+    protocol_resp_txn_get* resp, allocator_options_t* alloc_opts,
+    const void* payload, size_t payload_size)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != resp);
+    MODEL_ASSERT(NULL != alloc_opts);
+    MODEL_ASSERT(NULL != payload);
+
+    /* decode this response as a transaction get response. */
+    return
+        vcblockchain_protocol_decode_resp_txn_get(
+            resp, alloc_opts, payload, payload_size);
+}
@@ -0,0 +1,232 @@
+/**
+ * \file protocol/vcblockchain_protocol_decode_resp_artifact_txn_page_get.c
+ *
+ * \brief Decode an artifact transaction page get response into a struct.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+
+#include "wire_internal.h"
+
+/* forward decls. */
+static void dispose_protocol_resp_artifact_txn_page_get(void* disp);
+
+/**
+ * \brief Decode an artifact transaction page get response.
+ *
+ * \param resp                      The decoded response buffer.
+ * \param alloc_opts                The allocator to use for this response.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p resp structure is initialized with the decoded values.
+ * Each record's transaction certificate is owned by \p resp. The caller owns
+ * this structure and must \ref dispose() it when it is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - the status from the response if the request failed.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE if the payload
+ *        has the wrong size.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the payload is not an
+ *        artifact transaction page get response.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered.
+ */
+int vcblockchain_protocol_decode_resp_artifact_txn_page_get(
+    protocol_resp_artifact_txn_page_get* resp, allocator_options_t* alloc_opts,
+    const void* payload, size_t payload_size)
+{
+    int retval;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != resp);
+    MODEL_ASSERT(NULL != alloc_opts);
+    MODEL_ASSERT(NULL != payload);
+
+    /* runtime parameter checks. */
+    if (NULL == resp || NULL == alloc_opts || NULL == payload)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* compute failure payload size. */
+    size_t expected_fail_payload_size =
+          sizeof(uint32_t) /* request_id */
+        + sizeof(uint32_t) /* offset */
+        + sizeof(uint32_t); /* status */
+
+    /* compute the expected header size. */
+    size_t expected_header_size =
+          expected_fail_payload_size
+        + sizeof(uint32_t) /* flags */
+        + sizeof(vpr_uuid) /* next_cursor */
+        + sizeof(uint32_t); /* count */
+
+    /* initialize the response structure. */
+    memset(resp, 0, sizeof(*resp));
+    resp->hdr.dispose = &dispose_protocol_resp_artifact_txn_page_get;
+
+    /* is this at least large enough for the failure case? */
+    if (payload_size < expected_fail_payload_size)
+    {
+        retval = VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE;
+        goto cleanup_resp;
+    }
+
+    /* read the request id. */
+    vcblockchain_wire_reader reader;
+    vcblockchain_wire_reader_init(&reader, payload, payload_size);
+    resp->request_id = vcblockchain_wire_read_u32(&reader);
+    if (PROTOCOL_REQ_ID_ARTIFACT_TXN_PAGE_GET != resp->request_id)
+    {
+        retval = VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE;
+        goto cleanup_resp;
+    }
+
+    /* read the status and offset. */
+    resp->status = vcblockchain_wire_read_u32(&reader);
+    resp->offset = vcblockchain_wire_read_u32(&reader);
+
+    /* exit early if the status is not success. */
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != resp->status)
+    {
+        retval = resp->status;
+        goto cleanup_resp;
+    }
+
+    /* if the status is success, then verify that we have a full header. */
+    if (payload_size < expected_header_size)
+    {
+        retval = VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE;
+        goto cleanup_resp;
+    }
+
+    /* read the rest of the header. */
+    resp->flags = vcblockchain_wire_read_u32(&reader);
+    vcblockchain_wire_read_uuid(&reader, &resp->next_cursor);
+    resp->count = vcblockchain_wire_read_u32(&reader);
+
+    /* verify that every size-prefixed transaction fits in the payload. */
+    const size_t record_header_size =
+          5 * 16 /* txn, prev, next, artifact, and block ids. */
+        + sizeof(uint64_t) /* serialized cert size. */
+        + sizeof(uint32_t); /* transaction state. */
+    vcblockchain_wire_reader body_reader = reader;
+    for (uint32_t i = 0; i < resp->count; ++i)
+    {
+        if (vcblockchain_wire_reader_remaining(&body_reader) < sizeof(uint32_t))
+        {
+            retval = VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE;
+            goto cleanup_resp;
+        }
+
+        uint32_t size = vcblockchain_wire_read_u32(&body_reader);
+        if (size < record_header_size
+         || vcblockchain_wire_reader_remaining(&body_reader) < size)
+        {
+            retval = VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE;
+            goto cleanup_resp;
+        }
+
+        vcblockchain_wire_read_skip(&body_reader, size);
+    }
+
+    /* there must not be any trailing data. */
+    if (0 != vcblockchain_wire_reader_remaining(&body_reader))
+    {
+        retval = VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE;
+        goto cleanup_resp;
+    }
+
+    /* an empty response has nothing more to decode. */
+    if (0 == resp->count)
+    {
+        retval = VCBLOCKCHAIN_STATUS_SUCCESS;
+        goto done;
+    }
+
+    /* copy the body of the response. */
+    const size_t body_size = payload_size - expected_header_size;
+    if (VCCRYPT_STATUS_SUCCESS !=
+        vccrypt_buffer_init(&resp->body, alloc_opts, body_size))
+    {
+        retval = VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+        goto cleanup_resp;
+    }
+
+    vcblockchain_wire_read_bytes(&reader, resp->body.data, body_size);
+
+    /* create the record array. */
+    if (VCCRYPT_STATUS_SUCCESS !=
+        vccrypt_buffer_init(
+            &resp->records_buffer, alloc_opts,
+            resp->count * sizeof(protocol_txn_page_record)))
+    {
+        retval = VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+        goto cleanup_resp;
+    }
+
+    resp->records = (protocol_txn_page_record*)resp->records_buffer.data;
+
+    /* decode each record, pointing its certificate into the body. */
+    vcblockchain_wire_reader_init(&body_reader, resp->body.data, body_size);
+    for (uint32_t i = 0; i < resp->count; ++i)
+    {
+        protocol_txn_page_record* record = &resp->records[i];
+        uint32_t size = vcblockchain_wire_read_u32(&body_reader);
+
+        vcblockchain_wire_read_uuid(&body_reader, &record->txn_id);
+        vcblockchain_wire_read_uuid(&body_reader, &record->prev_txn_id);
+        vcblockchain_wire_read_uuid(&body_reader, &record->next_txn_id);
+        vcblockchain_wire_read_uuid(&body_reader, &record->artifact_id);
+        vcblockchain_wire_read_uuid(&body_reader, &record->block_id);
+        record->txn_size = vcblockchain_wire_read_u64(&body_reader);
+        record->txn_state = vcblockchain_wire_read_u32(&body_reader);
+        record->txn_cert_size = size - record_header_size;
+        record->txn_cert =
+            vcblockchain_wire_read_skip(&body_reader, record->txn_cert_size);
+    }
+
+    /* success. */
+    retval = VCBLOCKCHAIN_STATUS_SUCCESS;
+    /* on success, the response struct is owned by the caller. */
+    goto done;
+
+cleanup_resp:
+    dispose((disposable_t*)resp);
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Dispose of a decoded response structure.
+ *
+ * \param disp      The structure to dispose.
+ */
+static void dispose_protocol_resp_artifact_txn_page_get(void* disp)
+{
+    protocol_resp_artifact_txn_page_get* resp =
+        (protocol_resp_artifact_txn_page_get*)disp;
+
+    /* dispose of the record array, if allocated. */
+    if (NULL != resp->records_buffer.data)
+    {
+        dispose((disposable_t*)&resp->records_buffer);
+    }
+
+    /* dispose of the body, if allocated. */
+    if (NULL != resp->body.data)
+    {
+        dispose((disposable_t*)&resp->body);
+    }
+
+    memset(resp, 0, sizeof(protocol_resp_artifact_txn_page_get));
+}
@@ -7,12 +7,13 @@
  * \copyright 2022 Velo Payments, Inc.  All rights reserved.
  */
 
-#include <arpa/inet.h>
 #include <cbmc/model_assert.h>
 #include <string.h>
 #include <vcblockchain/error_codes.h>
 #include <vcblockchain/protocol/serialization.h>
 
+#include "wire_internal.h"
+
 /* forward decls. */
 static void dispose_protocol_resp_assert_latest_block_id_cancel(void* disp);
 
@@ -55,10 +56,13 @@ int vcblockchain_protocol_decode_resp_assert_latest_block_id_cancel(
     /* initialize the response structure. */
     memset(resp, 0, sizeof(*resp));
     resp->hdr.dispose = &dispose_protocol_resp_assert_latest_block_id_cancel;
-    const uint32_t* parr = (const uint32_t*)payload;
-    resp->request_id = ntohl(parr[0]);
-    resp->status = ntohl(parr[1]);
-    resp->offset = ntohl(parr[2]);
+
+    /* read the response fields. */
+    vcblockchain_wire_reader reader;
+    vcblockchain_wire_reader_init(&reader, payload, payload_size);
+    resp->request_id = vcblockchain_wire_read_u32(&reader);
+    resp->status = vcblockchain_wire_read_u32(&reader);
+    resp->offset = vcblockchain_wire_read_u32(&reader);
 
     /* success. */
     return VCBLOCKCHAIN_STATUS_SUCCESS;
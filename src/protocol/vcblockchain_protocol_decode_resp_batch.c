@@ -0,0 +1,194 @@
+/**
+ * \file protocol/vcblockchain_protocol_decode_resp_batch.c
+ *
+ * \brief Decode a batch response into a struct.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/limits.h>
+#include <vcblockchain/protocol/serialization.h>
+
+#include "wire_internal.h"
+
+/* forward decls. */
+static void dispose_protocol_resp_batch(void* disp);
+
+/**
+ * \brief Decode a batch response.
+ *
+ * \param resp                      The decoded response buffer.
+ * \param alloc_opts                The allocator to use for this response.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p resp structure is initialized with the decoded values.
+ * Each item holds the status of the matching request and points to an encoded
+ * response owned by \p resp, which can be decoded with the matching response
+ * decode function. The caller owns this structure and must \ref dispose() it
+ * when it is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the payload is malformed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered.
+ */
+int vcblockchain_protocol_decode_resp_batch(
+    protocol_resp_batch* resp, allocator_options_t* alloc_opts,
+    const void* payload, size_t payload_size)
+{
+    int retval;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != resp);
+    MODEL_ASSERT(NULL != alloc_opts);
+    MODEL_ASSERT(NULL != payload);
+
+    /* runtime parameter checks. */
+    if (NULL == resp || NULL == alloc_opts || NULL == payload)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* verify that the payload holds the header. */
+    const size_t header_size = 4 * sizeof(uint32_t);
+    if (payload_size < header_size)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* initialize the response structure. */
+    memset(resp, 0, sizeof(*resp));
+    resp->hdr.dispose = &dispose_protocol_resp_batch;
+
+    /* set the header values. */
+    vcblockchain_wire_reader reader;
+    vcblockchain_wire_reader_init(&reader, payload, payload_size);
+    resp->request_id = vcblockchain_wire_read_u32(&reader);
+    resp->status = vcblockchain_wire_read_u32(&reader);
+    resp->offset = vcblockchain_wire_read_u32(&reader);
+    resp->count = vcblockchain_wire_read_u32(&reader);
+    if (resp->count > VCBLOCKCHAIN_LIMIT_MAXIMUM_BATCH_COUNT
+     || vcblockchain_wire_reader_remaining(&reader)
+            < resp->count * sizeof(uint32_t))
+    {
+        retval = VCBLOCKCHAIN_ERROR_INVALID_ARG;
+        goto cleanup_resp;
+    }
+
+    /* an empty batch has nothing more to decode. */
+    if (0 == resp->count)
+    {
+        if (0 != vcblockchain_wire_reader_remaining(&reader))
+        {
+            retval = VCBLOCKCHAIN_ERROR_INVALID_ARG;
+            goto cleanup_resp;
+        }
+
+        return VCBLOCKCHAIN_STATUS_SUCCESS;
+    }
+
+    /* skip the status vector for now. */
+    const uint8_t* status_vector =
+        vcblockchain_wire_read_skip(&reader, resp->count * sizeof(uint32_t));
+
+    /* verify that every size-prefixed response fits in the payload. */
+    vcblockchain_wire_reader body_reader = reader;
+    for (uint32_t i = 0; i < resp->count; ++i)
+    {
+        if (vcblockchain_wire_reader_remaining(&body_reader) < sizeof(uint32_t))
+        {
+            retval = VCBLOCKCHAIN_ERROR_INVALID_ARG;
+            goto cleanup_resp;
+        }
+
+        uint32_t size = vcblockchain_wire_read_u32(&body_reader);
+        if (vcblockchain_wire_reader_remaining(&body_reader) < size)
+        {
+            retval = VCBLOCKCHAIN_ERROR_INVALID_ARG;
+            goto cleanup_resp;
+        }
+
+        vcblockchain_wire_read_skip(&body_reader, size);
+    }
+
+    /* there must not be any trailing data. */
+    if (0 != vcblockchain_wire_reader_remaining(&body_reader))
+    {
+        retval = VCBLOCKCHAIN_ERROR_INVALID_ARG;
+        goto cleanup_resp;
+    }
+
+    /* copy the body of the batch. */
+    const size_t body_size = vcblockchain_wire_reader_remaining(&reader);
+    if (VCCRYPT_STATUS_SUCCESS !=
+        vccrypt_buffer_init(&resp->body, alloc_opts, body_size))
+    {
+        retval = VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+        goto cleanup_resp;
+    }
+
+    vcblockchain_wire_read_bytes(&reader, resp->body.data, body_size);
+
+    /* create the item array. */
+    if (VCCRYPT_STATUS_SUCCESS !=
+        vccrypt_buffer_init(
+            &resp->items_buffer, alloc_opts,
+            resp->count * sizeof(protocol_batch_resp_item)))
+    {
+        retval = VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+        goto cleanup_resp;
+    }
+
+    resp->items = (protocol_batch_resp_item*)resp->items_buffer.data;
+
+    /* set each item's status and point it at its response in the body. */
+    vcblockchain_wire_reader status_reader;
+    vcblockchain_wire_reader_init(
+        &status_reader, status_vector, resp->count * sizeof(uint32_t));
+    vcblockchain_wire_reader_init(&body_reader, resp->body.data, body_size);
+    for (uint32_t i = 0; i < resp->count; ++i)
+    {
+        resp->items[i].status = vcblockchain_wire_read_u32(&status_reader);
+        resp->items[i].size = vcblockchain_wire_read_u32(&body_reader);
+        resp->items[i].data =
+            vcblockchain_wire_read_skip(&body_reader, resp->items[i].size);
+    }
+
+    /* success. */
+    /* On success, the caller owns resp. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+
+cleanup_resp:
+    dispose((disposable_t*)resp);
+
+    return retval;
+}
+
+/**
+ * \brief Dispose of a decoded response structure.
+ *
+ * \param disp      The structure to dispose.
+ */
+static void dispose_protocol_resp_batch(void* disp)
+{
+    protocol_resp_batch* resp = (protocol_resp_batch*)disp;
+
+    /* dispose of the item array, if allocated. */
+    if (NULL != resp->items_buffer.data)
+    {
+        dispose((disposable_t*)&resp->items_buffer);
+    }
+
+    /* dispose of the body, if allocated. */
+    if (NULL != resp->body.data)
+    {
+        dispose((disposable_t*)&resp->body);
+    }
+
+    memset(resp, 0, sizeof(protocol_resp_batch));
+}
@@ -8,10 +8,11 @@
 
 #include <cbmc/model_assert.h>
 #include <string.h>
-#include <vcblockchain/byteswap.h>
 #include <vcblockchain/error_codes.h>
 #include <vcblockchain/protocol/serialization.h>
 
+#include "wire_internal.h"
+
 /* forward decls. */
 static void dispose_protocol_resp_block_get(void* disp);
 
@@ -71,28 +72,24 @@ int vcblockchain_protocol_decode_resp_block_get(
     }
 
     /* set the integer values. */
-    const uint32_t* uarr = (const uint32_t*)payload;
-    resp->request_id = vcntohl(uarr[0]);
-    resp->status = vcntohl(uarr[1]);
-    resp->offset = vcntohl(uarr[2]);
+    vcblockchain_wire_reader reader;
+    vcblockchain_wire_reader_init(&reader, payload, payload_size);
+    resp->request_id = vcblockchain_wire_read_u32(&reader);
+    resp->status = vcblockchain_wire_read_u32(&reader);
+    resp->offset = vcblockchain_wire_read_u32(&reader);
 
     /* set the uuid values. */
-    const uint8_t* barr = (const uint8_t*)(uarr + 3);
-    memcpy(&resp->block_id,         barr,       16);
-    memcpy(&resp->prev_block_id,    barr + 16,  16);
-    memcpy(&resp->next_block_id,    barr + 32,  16);
-    memcpy(&resp->first_txn_id,     barr + 48,  16);
+    vcblockchain_wire_read_uuid(&reader, &resp->block_id);
+    vcblockchain_wire_read_uuid(&reader, &resp->prev_block_id);
+    vcblockchain_wire_read_uuid(&reader, &resp->next_block_id);
+    vcblockchain_wire_read_uuid(&reader, &resp->first_txn_id);
 
     /* set the uint64_t values. */
-    uint64_t net_block_height;
-    memcpy(&net_block_height, barr + 64, 8);
-    resp->block_height = ntohll(net_block_height);
-    uint64_t net_block_size;
-    memcpy(&net_block_size, barr + 72, 8);
-    resp->block_size = ntohll(net_block_size);
+    resp->block_height = vcblockchain_wire_read_u64(&reader);
+    resp->block_size = vcblockchain_wire_read_u64(&reader);
 
     /* copy the block certificate. */
-    memcpy(resp->block_cert.data, barr + 80, cert_size);
+    vcblockchain_wire_read_bytes(&reader, resp->block_cert.data, cert_size);
 
     /* success. */
     /* On success, the caller owns resp. */
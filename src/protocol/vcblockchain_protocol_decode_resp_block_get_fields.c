@@ -0,0 +1,162 @@
+/**
+ * \file protocol/vcblockchain_protocol_decode_resp_block_get_fields.c
+ *
+ * \brief Decode a block get fields response into a struct.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+
+#include "wire_internal.h"
+
+/* forward decls. */
+static void dispose_protocol_resp_block_get_fields(void* disp);
+
+/**
+ * \brief Decode a block get fields response.
+ *
+ * \param resp                      The decoded response buffer.
+ * \param alloc_opts                The allocator to use for this response.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p resp structure is initialized with the decoded values.
+ * Fields not present in the response field mask are zeroed. The caller owns
+ * this structure and must \ref dispose() it when it is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the payload is malformed or the
+ *        field mask has unknown bits.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_decode_resp_block_get_fields(
+    protocol_resp_block_get_fields* resp, allocator_options_t* alloc_opts,
+    const void* payload, size_t payload_size)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != resp);
+    MODEL_ASSERT(NULL != alloc_opts);
+    MODEL_ASSERT(NULL != payload);
+
+    /* runtime parameter checks. */
+    if (NULL == resp || NULL == alloc_opts || NULL == payload)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* compute the header size. */
+    const size_t header_size =
+          4 * sizeof(uint32_t) /* request_id, offset, status, field_mask. */
+        + 16; /* block_id. */
+
+    /* verify that payload_size is at least the header size. */
+    if (payload_size < header_size)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* initialize the response structure. */
+    memset(resp, 0, sizeof(*resp));
+    resp->hdr.dispose = &dispose_protocol_resp_block_get_fields;
+
+    /* set the integer values. */
+    vcblockchain_wire_reader reader;
+    vcblockchain_wire_reader_init(&reader, payload, payload_size);
+    resp->request_id = vcblockchain_wire_read_u32(&reader);
+    resp->status = vcblockchain_wire_read_u32(&reader);
+    resp->offset = vcblockchain_wire_read_u32(&reader);
+    resp->field_mask = vcblockchain_wire_read_u32(&reader);
+
+    /* reject fields we don't know how to decode. */
+    if (0 != (resp->field_mask & ~PROTOCOL_BLOCK_FIELD_ALL))
+    {
+        goto invalid_payload;
+    }
+
+    /* compute the size of the fixed fields in this response. */
+    const uint32_t mask = resp->field_mask;
+    const size_t fixed_size =
+          header_size
+        + ((mask & PROTOCOL_BLOCK_FIELD_PREV_BLOCK_ID) ? 16 : 0)
+        + ((mask & PROTOCOL_BLOCK_FIELD_NEXT_BLOCK_ID) ? 16 : 0)
+        + ((mask & PROTOCOL_BLOCK_FIELD_FIRST_TXN_ID) ? 16 : 0)
+        + ((mask & PROTOCOL_BLOCK_FIELD_BLOCK_HEIGHT) ? sizeof(uint64_t) : 0);
+
+    /* without a certificate, the payload must be exactly the fixed size. */
+    if (payload_size < fixed_size
+     || (!(mask & PROTOCOL_BLOCK_FIELD_BLOCK_CERT)
+            && payload_size != fixed_size))
+    {
+        goto invalid_payload;
+    }
+
+    /* set the uuid values. */
+    vcblockchain_wire_read_uuid(&reader, &resp->block_id);
+    if (mask & PROTOCOL_BLOCK_FIELD_PREV_BLOCK_ID)
+    {
+        vcblockchain_wire_read_uuid(&reader, &resp->prev_block_id);
+    }
+
+    if (mask & PROTOCOL_BLOCK_FIELD_NEXT_BLOCK_ID)
+    {
+        vcblockchain_wire_read_uuid(&reader, &resp->next_block_id);
+    }
+
+    if (mask & PROTOCOL_BLOCK_FIELD_FIRST_TXN_ID)
+    {
+        vcblockchain_wire_read_uuid(&reader, &resp->first_txn_id);
+    }
+
+    /* set the block height. */
+    if (mask & PROTOCOL_BLOCK_FIELD_BLOCK_HEIGHT)
+    {
+        resp->block_height = vcblockchain_wire_read_u64(&reader);
+    }
+
+    /* the block certificate, if requested, fills the rest. */
+    if (mask & PROTOCOL_BLOCK_FIELD_BLOCK_CERT)
+    {
+        const size_t cert_size = payload_size - fixed_size;
+        if (VCCRYPT_STATUS_SUCCESS !=
+            vccrypt_buffer_init(&resp->block_cert, alloc_opts, cert_size))
+        {
+            memset(resp, 0, sizeof(*resp));
+            return VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+        }
+
+        vcblockchain_wire_read_bytes(
+            &reader, resp->block_cert.data, cert_size);
+    }
+
+    /* success. */
+    /* On success, the caller owns resp. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+
+invalid_payload:
+    memset(resp, 0, sizeof(*resp));
+    return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+}
+
+/**
+ * \brief Dispose of a decoded response structure.
+ *
+ * \param disp      The structure to dispose.
+ */
+static void dispose_protocol_resp_block_get_fields(void* disp)
+{
+    protocol_resp_block_get_fields* resp =
+        (protocol_resp_block_get_fields*)disp;
+
+    /* dispose of the block certificate buffer, if it was returned. */
+    if (NULL != resp->block_cert.data)
+    {
+        dispose((disposable_t*)&resp->block_cert);
+    }
+
+    memset(resp, 0, sizeof(protocol_resp_block_get_fields));
+}
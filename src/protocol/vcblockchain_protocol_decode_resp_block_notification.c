@@ -0,0 +1,115 @@
+/**
+ * \file protocol/vcblockchain_protocol_decode_resp_block_notification.c
+ *
+ * \brief Decode a block notification into a struct.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+
+#include "wire_internal.h"
+
+/* forward decls. */
+static void dispose_protocol_resp_block_notification(void* disp);
+
+/**
+ * \brief Decode a block notification.
+ *
+ * \param resp                      The decoded notification buffer.
+ * \param alloc_opts                The allocator to use for this notification.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p resp structure is initialized with the decoded values.
+ * The caller owns this structure and must \ref dispose() it when it is no
+ * longer needed. If the notification does not include a block certificate,
+ * then the block_cert buffer is left empty, with a NULL data pointer.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_decode_resp_block_notification(
+    protocol_resp_block_notification* resp, allocator_options_t* alloc_opts,
+    const void* payload, size_t payload_size)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != resp);
+    MODEL_ASSERT(NULL != alloc_opts);
+    MODEL_ASSERT(NULL != payload);
+
+    /* runtime parameter checks. */
+    if (NULL == resp || NULL == alloc_opts || NULL == payload)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* compute the minimum payload size. */
+    const size_t minimum_payload_size =
+          3 * sizeof(uint32_t) /* request_id, offset, and status. */
+        + 2 * 16 /* block_id and prev_block_id. */
+        + sizeof(uint64_t); /* block height. */
+
+    /* verify that payload_size is at least the minimum. */
+    if (payload_size < minimum_payload_size)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* initialize the response structure. */
+    memset(resp, 0, sizeof(*resp));
+    resp->hdr.dispose = &dispose_protocol_resp_block_notification;
+
+    /* allocate the block cert buffer, if a certificate was included. */
+    const size_t cert_size = payload_size - minimum_payload_size;
+    if (cert_size > 0U
+     && VCCRYPT_STATUS_SUCCESS !=
+            vccrypt_buffer_init(&resp->block_cert, alloc_opts, cert_size))
+    {
+        return VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* set the integer values. */
+    vcblockchain_wire_reader reader;
+    vcblockchain_wire_reader_init(&reader, payload, payload_size);
+    resp->request_id = vcblockchain_wire_read_u32(&reader);
+    resp->status = vcblockchain_wire_read_u32(&reader);
+    resp->offset = vcblockchain_wire_read_u32(&reader);
+
+    /* set the uuid values. */
+    vcblockchain_wire_read_uuid(&reader, &resp->block_id);
+    vcblockchain_wire_read_uuid(&reader, &resp->prev_block_id);
+
+    /* set the block height. */
+    resp->block_height = vcblockchain_wire_read_u64(&reader);
+
+    /* copy the block certificate. */
+    vcblockchain_wire_read_bytes(&reader, resp->block_cert.data, cert_size);
+
+    /* success. */
+    /* On success, the caller owns resp. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
+
+/**
+ * \brief Dispose of a decoded notification structure.
+ *
+ * \param disp      The structure to dispose.
+ */
+static void dispose_protocol_resp_block_notification(void* disp)
+{
+    protocol_resp_block_notification* resp =
+        (protocol_resp_block_notification*)disp;
+
+    /* dispose of the block certificate buffer, if it was allocated. */
+    if (NULL != resp->block_cert.data)
+    {
+        dispose((disposable_t*)&resp->block_cert);
+    }
+
+    memset(resp, 0, sizeof(protocol_resp_block_notification));
+}
@@ -0,0 +1,188 @@
+/**
+ * \file protocol/vcblockchain_protocol_decode_resp_block_range_get.c
+ *
+ * \brief Decode a block range get response into a struct.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+
+#include "wire_internal.h"
+
+/* forward decls. */
+static void dispose_protocol_resp_block_range_get(void* disp);
+
+/**
+ * \brief Decode a block range get response.
+ *
+ * \param resp                      The decoded response buffer.
+ * \param alloc_opts                The allocator to use for this response.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p resp structure is initialized with the decoded values.
+ * Each record's block certificate is owned by \p resp. The caller owns this
+ * structure and must \ref dispose() it when it is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the payload is malformed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered.
+ */
+int vcblockchain_protocol_decode_resp_block_range_get(
+    protocol_resp_block_range_get* resp, allocator_options_t* alloc_opts,
+    const void* payload, size_t payload_size)
+{
+    int retval;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != resp);
+    MODEL_ASSERT(NULL != alloc_opts);
+    MODEL_ASSERT(NULL != payload);
+
+    /* runtime parameter checks. */
+    if (NULL == resp || NULL == alloc_opts || NULL == payload)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* verify that the payload holds the header. */
+    const size_t header_size =
+          4 * sizeof(uint32_t) /* request_id, status, offset, and flags. */
+        + sizeof(uint64_t) /* next height. */
+        + sizeof(uint32_t); /* count. */
+    if (payload_size < header_size)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* initialize the response structure. */
+    memset(resp, 0, sizeof(*resp));
+    resp->hdr.dispose = &dispose_protocol_resp_block_range_get;
+
+    /* set the header values. */
+    vcblockchain_wire_reader reader;
+    vcblockchain_wire_reader_init(&reader, payload, payload_size);
+    resp->request_id = vcblockchain_wire_read_u32(&reader);
+    resp->status = vcblockchain_wire_read_u32(&reader);
+    resp->offset = vcblockchain_wire_read_u32(&reader);
+    resp->flags = vcblockchain_wire_read_u32(&reader);
+    resp->next_height = vcblockchain_wire_read_u64(&reader);
+    resp->count = vcblockchain_wire_read_u32(&reader);
+
+    /* verify that every size-prefixed block fits in the payload. */
+    const size_t record_header_size =
+          4 * 16 /* block_id, prev_block_id, next_block_id, first_txn_id. */
+        + 2 * sizeof(uint64_t); /* block height and serialized cert size. */
+    vcblockchain_wire_reader body_reader = reader;
+    for (uint32_t i = 0; i < resp->count; ++i)
+    {
+        if (vcblockchain_wire_reader_remaining(&body_reader) < sizeof(uint32_t))
+        {
+            retval = VCBLOCKCHAIN_ERROR_INVALID_ARG;
+            goto cleanup_resp;
+        }
+
+        uint32_t size = vcblockchain_wire_read_u32(&body_reader);
+        if (size < record_header_size
+         || vcblockchain_wire_reader_remaining(&body_reader) < size)
+        {
+            retval = VCBLOCKCHAIN_ERROR_INVALID_ARG;
+            goto cleanup_resp;
+        }
+
+        vcblockchain_wire_read_skip(&body_reader, size);
+    }
+
+    /* there must not be any trailing data. */
+    if (0 != vcblockchain_wire_reader_remaining(&body_reader))
+    {
+        retval = VCBLOCKCHAIN_ERROR_INVALID_ARG;
+        goto cleanup_resp;
+    }
+
+    /* an empty response has nothing more to decode. */
+    if (0 == resp->count)
+    {
+        return VCBLOCKCHAIN_STATUS_SUCCESS;
+    }
+
+    /* copy the body of the response. */
+    const size_t body_size = payload_size - header_size;
+    if (VCCRYPT_STATUS_SUCCESS !=
+        vccrypt_buffer_init(&resp->body, alloc_opts, body_size))
+    {
+        retval = VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+        goto cleanup_resp;
+    }
+
+    vcblockchain_wire_read_bytes(&reader, resp->body.data, body_size);
+
+    /* create the record array. */
+    if (VCCRYPT_STATUS_SUCCESS !=
+        vccrypt_buffer_init(
+            &resp->records_buffer, alloc_opts,
+            resp->count * sizeof(protocol_block_range_record)))
+    {
+        retval = VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+        goto cleanup_resp;
+    }
+
+    resp->records = (protocol_block_range_record*)resp->records_buffer.data;
+
+    /* decode each record, pointing its certificate into the body. */
+    vcblockchain_wire_reader_init(&body_reader, resp->body.data, body_size);
+    for (uint32_t i = 0; i < resp->count; ++i)
+    {
+        protocol_block_range_record* record = &resp->records[i];
+        uint32_t size = vcblockchain_wire_read_u32(&body_reader);
+
+        vcblockchain_wire_read_uuid(&body_reader, &record->block_id);
+        vcblockchain_wire_read_uuid(&body_reader, &record->prev_block_id);
+        vcblockchain_wire_read_uuid(&body_reader, &record->next_block_id);
+        vcblockchain_wire_read_uuid(&body_reader, &record->first_txn_id);
+        record->block_height = vcblockchain_wire_read_u64(&body_reader);
+        record->block_size = vcblockchain_wire_read_u64(&body_reader);
+        record->block_cert_size = size - record_header_size;
+        record->block_cert =
+            vcblockchain_wire_read_skip(&body_reader, record->block_cert_size);
+    }
+
+    /* success. */
+    /* On success, the caller owns resp. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+
+cleanup_resp:
+    dispose((disposable_t*)resp);
+
+    return retval;
+}
+
+/**
+ * \brief Dispose of a decoded response structure.
+ *
+ * \param disp      The structure to dispose.
+ */
+static void dispose_protocol_resp_block_range_get(void* disp)
+{
+    protocol_resp_block_range_get* resp = (protocol_resp_block_range_get*)disp;
+
+    /* dispose of the record array, if allocated. */
+    if (NULL != resp->records_buffer.data)
+    {
+        dispose((disposable_t*)&resp->records_buffer);
+    }
+
+    /* dispose of the body, if allocated. */
+    if (NULL != resp->body.data)
+    {
+        dispose((disposable_t*)&resp->body);
+    }
+
+    memset(resp, 0, sizeof(protocol_resp_block_range_get));
+}
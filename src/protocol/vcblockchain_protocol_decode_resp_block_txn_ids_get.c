@@ -0,0 +1,199 @@
+/**
+ * \file protocol/vcblockchain_protocol_decode_resp_block_txn_ids_get.c
+ *
+ * \brief Decode a block transaction ids get response into a struct.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+
+#include "wire_internal.h"
+
+/* forward decls. */
+static void dispose_protocol_resp_block_txn_ids_get(void* disp);
+
+/**
+ * \brief Decode a block transaction ids get response.
+ *
+ * \param resp                      The decoded response buffer.
+ * \param alloc_opts                The allocator to use for this response.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p resp structure is initialized with the decoded values.
+ * The transaction id and state arrays are owned by \p resp. The caller owns
+ * this structure and must \ref dispose() it when it is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - the status from the response if the request failed.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE if the payload
+ *        has the wrong size.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the payload is not a
+ *        block transaction ids get response.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered.
+ */
+int vcblockchain_protocol_decode_resp_block_txn_ids_get(
+    protocol_resp_block_txn_ids_get* resp, allocator_options_t* alloc_opts,
+    const void* payload, size_t payload_size)
+{
+    int retval;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != resp);
+    MODEL_ASSERT(NULL != alloc_opts);
+    MODEL_ASSERT(NULL != payload);
+
+    /* runtime parameter checks. */
+    if (NULL == resp || NULL == alloc_opts || NULL == payload)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* compute failure payload size. */
+    size_t expected_fail_payload_size =
+          sizeof(uint32_t) /* request_id */
+        + sizeof(uint32_t) /* offset */
+        + sizeof(uint32_t); /* status */
+
+    /* compute the expected header size. */
+    size_t expected_header_size =
+          expected_fail_payload_size
+        + sizeof(uint32_t) /* include_states */
+        + sizeof(uint32_t); /* count */
+
+    /* initialize the response structure. */
+    memset(resp, 0, sizeof(*resp));
+    resp->hdr.dispose = &dispose_protocol_resp_block_txn_ids_get;
+
+    /* is this at least large enough for the failure case? */
+    if (payload_size < expected_fail_payload_size)
+    {
+        retval = VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE;
+        goto cleanup_resp;
+    }
+
+    /* read the request id. */
+    vcblockchain_wire_reader reader;
+    vcblockchain_wire_reader_init(&reader, payload, payload_size);
+    resp->request_id = vcblockchain_wire_read_u32(&reader);
+    if (PROTOCOL_REQ_ID_BLOCK_TXN_IDS_GET != resp->request_id)
+    {
+        retval = VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE;
+        goto cleanup_resp;
+    }
+
+    /* read the status and offset. */
+    resp->status = vcblockchain_wire_read_u32(&reader);
+    resp->offset = vcblockchain_wire_read_u32(&reader);
+
+    /* exit early if the status is not success. */
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != resp->status)
+    {
+        retval = resp->status;
+        goto cleanup_resp;
+    }
+
+    /* if the status is success, then verify that we have a full header. */
+    if (payload_size < expected_header_size)
+    {
+        retval = VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE;
+        goto cleanup_resp;
+    }
+
+    /* read the rest of the header. */
+    resp->include_states = 0U != vcblockchain_wire_read_u32(&reader);
+    resp->count = vcblockchain_wire_read_u32(&reader);
+
+    /* the body must hold exactly count packed entries. */
+    const size_t entry_size =
+        sizeof(vpr_uuid) + (resp->include_states ? sizeof(uint32_t) : 0);
+    const size_t body_size = payload_size - expected_header_size;
+    if (0 != body_size % entry_size || body_size / entry_size != resp->count)
+    {
+        retval = VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE;
+        goto cleanup_resp;
+    }
+
+    /* an empty block has nothing more to decode. */
+    if (0 == resp->count)
+    {
+        retval = VCBLOCKCHAIN_STATUS_SUCCESS;
+        goto done;
+    }
+
+    /* copy the packed transaction ids. */
+    if (VCCRYPT_STATUS_SUCCESS !=
+        vccrypt_buffer_init(
+            &resp->txn_ids_buffer, alloc_opts,
+            resp->count * sizeof(vpr_uuid)))
+    {
+        retval = VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+        goto cleanup_resp;
+    }
+
+    resp->txn_ids = (vpr_uuid*)resp->txn_ids_buffer.data;
+    vcblockchain_wire_read_bytes(
+        &reader, resp->txn_ids_buffer.data, resp->txn_ids_buffer.size);
+
+    /* decode the transaction states, if present. */
+    if (resp->include_states)
+    {
+        if (VCCRYPT_STATUS_SUCCESS !=
+            vccrypt_buffer_init(
+                &resp->txn_states_buffer, alloc_opts,
+                resp->count * sizeof(uint32_t)))
+        {
+            retval = VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+            goto cleanup_resp;
+        }
+
+        resp->txn_states = (uint32_t*)resp->txn_states_buffer.data;
+        for (uint32_t i = 0; i < resp->count; ++i)
+        {
+            resp->txn_states[i] = vcblockchain_wire_read_u32(&reader);
+        }
+    }
+
+    /* success. */
+    retval = VCBLOCKCHAIN_STATUS_SUCCESS;
+    /* on success, the response struct is owned by the caller. */
+    goto done;
+
+cleanup_resp:
+    dispose((disposable_t*)resp);
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Dispose of a decoded response structure.
+ *
+ * \param disp      The structure to dispose.
+ */
+static void dispose_protocol_resp_block_txn_ids_get(void* disp)
+{
+    protocol_resp_block_txn_ids_get* resp =
+        (protocol_resp_block_txn_ids_get*)disp;
+
+    /* dispose of the transaction states, if allocated. */
+    if (NULL != resp->txn_states_buffer.data)
+    {
+        dispose((disposable_t*)&resp->txn_states_buffer);
+    }
+
+    /* dispose of the transaction ids, if allocated. */
+    if (NULL != resp->txn_ids_buffer.data)
+    {
+        dispose((disposable_t*)&resp->txn_ids_buffer);
+    }
+
+    memset(resp, 0, sizeof(protocol_resp_block_txn_ids_get));
+}
@@ -7,13 +7,13 @@
  * \copyright 2022 Velo Payments, Inc.  All rights reserved.
  */
 
-#include <arpa/inet.h>
 #include <cbmc/model_assert.h>
 #include <string.h>
-#include <vcblockchain/byteswap.h>
 #include <vcblockchain/error_codes.h>
 #include <vcblockchain/protocol/serialization.h>
 
+#include "wire_internal.h"
+
 /* forward decls. */
 static void dispose_protocol_resp_extended_api_client_request(void* disp);
 
@@ -67,31 +67,20 @@ int vcblockchain_protocol_decode_resp_extended_api_client_request(
     /* initialize the response structure. */
     memset(resp, 0, sizeof(*resp));
     resp->hdr.dispose = &dispose_protocol_resp_extended_api_client_request;
-    const uint8_t* barr = (const uint8_t*)payload;
+    vcblockchain_wire_reader reader;
+    vcblockchain_wire_reader_init(&reader, payload, payload_size);
 
     /* copy the request id. */
-    uint32_t net_request_id;
-    memcpy(&net_request_id, barr, sizeof(net_request_id));
-    barr += sizeof(net_request_id);
-    resp->request_id = ntohl(net_request_id);
+    resp->request_id = vcblockchain_wire_read_u32(&reader);
 
     /* copy the offset. */
-    uint64_t net_offset;
-    memcpy(&net_offset, barr, sizeof(net_offset));
-    barr += sizeof(net_offset);
-    resp->offset = ntohll(net_offset);
+    resp->offset = vcblockchain_wire_read_u64(&reader);
 
     /* copy the client encryption pubkey size. */
-    uint32_t client_enc_pubkey_size;
-    memcpy(&client_enc_pubkey_size, barr, sizeof(client_enc_pubkey_size));
-    barr += sizeof(client_enc_pubkey_size);
-    client_enc_pubkey_size = ntohl(client_enc_pubkey_size);
+    uint32_t client_enc_pubkey_size = vcblockchain_wire_read_u32(&reader);
 
     /* copy the client signing pubkey size. */
-    uint32_t client_sign_pubkey_size;
-    memcpy(&client_sign_pubkey_size, barr, sizeof(client_sign_pubkey_size));
-    barr += sizeof(client_sign_pubkey_size);
-    client_sign_pubkey_size = ntohl(client_sign_pubkey_size);
+    uint32_t client_sign_pubkey_size = vcblockchain_wire_read_u32(&reader);
 
     /* second payload size check. */
     const size_t extended_resp_size =
@@ -103,12 +92,10 @@ int vcblockchain_protocol_decode_resp_extended_api_client_request(
     }
 
     /* copy the client id. */
-    memcpy(&resp->client_id, barr, sizeof(resp->client_id));
-    barr += sizeof(resp->client_id);
+    vcblockchain_wire_read_uuid(&reader, &resp->client_id);
 
     /* copy the verb id. */
-    memcpy(&resp->verb_id, barr, sizeof(resp->verb_id));
-    barr += sizeof(resp->verb_id);
+    vcblockchain_wire_read_uuid(&reader, &resp->verb_id);
 
     /* initialize the client encryption pubkey buffer. */
     if (VCCRYPT_STATUS_SUCCESS
@@ -120,8 +107,8 @@ int vcblockchain_protocol_decode_resp_extended_api_client_request(
     }
 
     /* copy the client encryption pubkey. */
-    memcpy(resp->client_enc_pubkey.data, barr, resp->client_enc_pubkey.size);
-    barr += resp->client_enc_pubkey.size;
+    vcblockchain_wire_read_bytes(
+        &reader, resp->client_enc_pubkey.data, resp->client_enc_pubkey.size);
 
     /* initialize the client signing pubkey buffer. */
     if (VCCRYPT_STATUS_SUCCESS
@@ -133,8 +120,8 @@ int vcblockchain_protocol_decode_resp_extended_api_client_request(
     }
 
     /* copy the client signing pubkey. */
-    memcpy(resp->client_sign_pubkey.data, barr, resp->client_sign_pubkey.size);
-    barr += resp->client_sign_pubkey.size;
+    vcblockchain_wire_read_bytes(
+        &reader, resp->client_sign_pubkey.data, resp->client_sign_pubkey.size);
 
     /* compute the size of the response body. */
     const size_t request_body_size = payload_size - extended_resp_size;
@@ -149,8 +136,8 @@ int vcblockchain_protocol_decode_resp_extended_api_client_request(
     }
 
     /* copy the response body data. */
-    memcpy(resp->request_body.data, barr, resp->request_body.size);
-    barr += resp->request_body.size;
+    vcblockchain_wire_read_bytes(
+        &reader, resp->request_body.data, resp->request_body.size);
 
     /* success. */
     retval = VCBLOCKCHAIN_STATUS_SUCCESS;
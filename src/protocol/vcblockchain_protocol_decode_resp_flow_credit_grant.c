@@ -0,0 +1,137 @@
+/**
+ * \file protocol/vcblockchain_protocol_decode_resp_flow_credit_grant.c
+ *
+ * \brief Decode a flow credit grant response into a struct.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+
+#include "wire_internal.h"
+
+/* forward decls. */
+static void dispose_protocol_resp_flow_credit_grant(void* disp);
+
+/**
+ * \brief Decode a flow credit grant response.
+ *
+ * \param resp                      The decoded response buffer.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p resp structure is initialized with the decoded values. The
+ * caller owns this structure and must \ref dispose() it when it is no longer
+ * needed.
+ *
+ * An agent that does not support flow control answers the first grant with an
+ * error response, which only holds a header. In that case, the status from the
+ * response is returned, and flow control stays off for the connection.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - the status from the response if the agent refused the grant.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE if the payload
+ *        has the wrong size.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the payload is not a
+ *        flow credit grant response.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_decode_resp_flow_credit_grant(
+    protocol_resp_flow_credit_grant* resp, const void* payload,
+    size_t payload_size)
+{
+    int retval;
+
+    /* parameter sanity check. */
+    MODEL_ASSERT(NULL != resp);
+    MODEL_ASSERT(NULL != payload);
+
+    /* runtime parameter checks. */
+    if (NULL == resp || NULL == payload)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* compute failure payload size. */
+    size_t expected_fail_payload_size =
+          sizeof(uint32_t) /* request_id */
+        + sizeof(uint32_t) /* offset */
+        + sizeof(uint32_t); /* status */
+
+    /* compute the expected full payload size. */
+    size_t expected_full_payload_size =
+          expected_fail_payload_size
+        + sizeof(uint32_t) /* request_credits */
+        + sizeof(uint64_t); /* byte_credits */
+
+    /* initialize the response structure. */
+    memset(resp, 0, sizeof(*resp));
+    resp->hdr.dispose = &dispose_protocol_resp_flow_credit_grant;
+
+    /* is this at least large enough for the failure case? */
+    if (payload_size < expected_fail_payload_size)
+    {
+        retval = VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE;
+        goto cleanup_resp;
+    }
+
+    /* read the request id. */
+    vcblockchain_wire_reader reader;
+    vcblockchain_wire_reader_init(&reader, payload, payload_size);
+    resp->request_id = vcblockchain_wire_read_u32(&reader);
+    if (PROTOCOL_REQ_ID_FLOW_CREDIT_GRANT != resp->request_id)
+    {
+        retval = VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE;
+        goto cleanup_resp;
+    }
+
+    /* read the status and offset. */
+    resp->status = vcblockchain_wire_read_u32(&reader);
+    resp->offset = vcblockchain_wire_read_u32(&reader);
+
+    /* exit early if the status is not success. */
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != resp->status)
+    {
+        retval = resp->status;
+        goto cleanup_resp;
+    }
+
+    /* if the status is success, then verify that we have a full payload. */
+    if (payload_size != expected_full_payload_size)
+    {
+        retval = VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE;
+        goto cleanup_resp;
+    }
+
+    /* read the credits. */
+    resp->request_credits = vcblockchain_wire_read_u32(&reader);
+    resp->byte_credits = vcblockchain_wire_read_u64(&reader);
+
+    /* success. */
+    retval = VCBLOCKCHAIN_STATUS_SUCCESS;
+    /* on success, the response struct is owned by the caller. */
+    goto done;
+
+cleanup_resp:
+    dispose((disposable_t*)resp);
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Dispose of a decoded response structure.
+ *
+ * \param disp      The structure to dispose.
+ */
+static void dispose_protocol_resp_flow_credit_grant(void* disp)
+{
+    protocol_resp_flow_credit_grant* resp =
+        (protocol_resp_flow_credit_grant*)disp;
+
+    memset(resp, 0, sizeof(protocol_resp_flow_credit_grant));
+}
@@ -6,13 +6,14 @@
  * \copyright 2020 Velo Payments, Inc.  All rights reserved.
  */
 
-#include <arpa/inet.h>
 #include <cbmc/model_assert.h>
 #include <vcblockchain/error_codes.h>
 #include <vcblockchain/protocol/data.h>
 #include <vcblockchain/protocol/serialization.h>
 #include <string.h>
 
+#include "wire_internal.h"
+
 /* forward decls. */
 static void dispose_protocol_resp_handshake_ack(void* disp);
 
@@ -48,15 +49,16 @@ int vcblockchain_protocol_decode_resp_handshake_ack(
         return VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE;
     }
 
-    /* get a uint32_t pointer to the payload for convenience. */
-    const uint32_t* valarray = (const uint32_t*)payload;
+    /* get a read cursor over the payload for convenience. */
+    vcblockchain_wire_reader reader;
+    vcblockchain_wire_reader_init(&reader, payload, payload_size);
 
     /* initialize the response structure. */
     memset(resp, 0, sizeof(*resp));
     resp->hdr.dispose = &dispose_protocol_resp_handshake_ack;
-    resp->request_id = ntohl(valarray[0]);
-    resp->status = ntohl(valarray[1]);
-    resp->offset = ntohl(valarray[2]);
+    resp->request_id = vcblockchain_wire_read_u32(&reader);
+    resp->status = vcblockchain_wire_read_u32(&reader);
+    resp->offset = vcblockchain_wire_read_u32(&reader);
 
     /* success. */
     return VCBLOCKCHAIN_STATUS_SUCCESS;
@@ -6,13 +6,14 @@
  * \copyright 2020 Velo Payments, Inc.  All rights reserved.
  */
 
-#include <arpa/inet.h>
 #include <cbmc/model_assert.h>
 #include <vcblockchain/error_codes.h>
 #include <vcblockchain/protocol/data.h>
 #include <vcblockchain/protocol/serialization.h>
 #include <string.h>
 
+#include "wire_internal.h"
+
 /* forward decls. */
 static void dispose_protocol_resp_handshake_request(void* disp);
 
@@ -37,8 +38,6 @@ int vcblockchain_protocol_decode_resp_handshake_request(
     const void* payload, size_t payload_size)
 {
     int retval;
-    uint32_t net_request_id, net_offset, net_status, net_protocol_version;
-    uint32_t net_crypto_suite;
 
     /* parameter sanity checks. */
     MODEL_ASSERT(NULL != resp);
@@ -47,17 +46,15 @@ int vcblockchain_protocol_decode_resp_handshake_request(
 
     /* compute failure payload size. */
     size_t expected_fail_payload_size =
-          sizeof(net_request_id)
-        + sizeof(net_offset)
-        + sizeof(net_status);
+          sizeof(uint32_t) /* request_id */
+        + sizeof(uint32_t) /* offset */
+        + sizeof(uint32_t); /* status */
 
     /* compute the expected full payload size. */
     size_t expected_full_payload_size =
-          sizeof(net_request_id)
-        + sizeof(net_offset)
-        + sizeof(net_status)
-        + sizeof(net_protocol_version)
-        + sizeof(net_crypto_suite)
+          expected_fail_payload_size
+        + sizeof(uint32_t) /* protocol_version */
+        + sizeof(uint32_t) /* crypto_suite */
         + sizeof(vpr_uuid)
         + suite->key_cipher_opts.public_key_size
         + suite->key_cipher_opts.minimum_nonce_size
@@ -77,13 +74,12 @@ int vcblockchain_protocol_decode_resp_handshake_request(
         goto cleanup_resp;
     }
 
-    /* byte pointer for convenience. */
-    const uint8_t* buf = (const uint8_t*)payload;
+    /* read cursor for convenience. */
+    vcblockchain_wire_reader reader;
+    vcblockchain_wire_reader_init(&reader, payload, payload_size);
 
     /* read the request_id. */
-    memcpy(&net_request_id, buf, sizeof(net_request_id));
-    resp->request_id = ntohl(net_request_id);
-    buf += sizeof(net_request_id);
+    resp->request_id = vcblockchain_wire_read_u32(&reader);
     if (PROTOCOL_REQ_ID_HANDSHAKE_INITIATE != resp->request_id)
     {
         retval = VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE;
@@ -91,14 +87,10 @@ int vcblockchain_protocol_decode_resp_handshake_request(
     }
 
     /* read the status. */
-    memcpy(&net_status, buf, sizeof(net_status));
-    resp->status = ntohl(net_status);
-    buf += sizeof(net_status);
+    resp->status = vcblockchain_wire_read_u32(&reader);
 
     /* read the request offset. */
-    memcpy(&net_offset, buf, sizeof(net_offset));
-    resp->offset = ntohl(net_offset);
-    buf += sizeof(net_offset);
+    resp->offset = vcblockchain_wire_read_u32(&reader);
 
     /* exit early if the status is not success. */
     if (VCBLOCKCHAIN_STATUS_SUCCESS != resp->status)
@@ -115,9 +107,7 @@ int vcblockchain_protocol_decode_resp_handshake_request(
     }
 
     /* copy the protocol version. */
-    memcpy(&net_protocol_version, buf, sizeof(net_protocol_version));
-    resp->protocol_version = ntohl(net_protocol_version);
-    buf += sizeof(net_protocol_version);
+    resp->protocol_version = vcblockchain_wire_read_u32(&reader);
     if (PROTOCOL_VERSION_0_1_DEMO != resp->protocol_version)
     {
         retval = VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE;
@@ -125,9 +115,7 @@ int vcblockchain_protocol_decode_resp_handshake_request(
     }
 
     /* copy the crypto suite. */
-    memcpy(&net_crypto_suite, buf, sizeof(net_crypto_suite));
-    resp->crypto_suite = ntohl(net_crypto_suite);
-    buf += sizeof(net_crypto_suite);
+    resp->crypto_suite = vcblockchain_wire_read_u32(&reader);
     if (VCCRYPT_SUITE_VELO_V1 != resp->crypto_suite)
     {
         retval = VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE;
@@ -135,8 +123,7 @@ int vcblockchain_protocol_decode_resp_handshake_request(
     }
 
     /* copy the agent id. */
-    memcpy(&resp->agent_id, buf, sizeof(resp->agent_id));
-    buf += sizeof(resp->agent_id);
+    vcblockchain_wire_read_uuid(&reader, &resp->agent_id);
 
     /* allocate the server public key buffer. */
     retval =
@@ -148,8 +135,8 @@ int vcblockchain_protocol_decode_resp_handshake_request(
     }
 
     /* copy the public key. */
-    memcpy(resp->server_public_key.data, buf, resp->server_public_key.size);
-    buf += resp->server_public_key.size;
+    vcblockchain_wire_read_bytes(
+        &reader, resp->server_public_key.data, resp->server_public_key.size);
     resp->server_public_key_set = true;
 
     /* allocate the server key nonce. */
@@ -162,8 +149,8 @@ int vcblockchain_protocol_decode_resp_handshake_request(
     }
 
     /* copy the key nonce. */
-    memcpy(resp->server_key_nonce.data, buf, resp->server_key_nonce.size);
-    buf += resp->server_key_nonce.size;
+    vcblockchain_wire_read_bytes(
+        &reader, resp->server_key_nonce.data, resp->server_key_nonce.size);
     resp->server_key_nonce_set = true;
 
     /* allocate the server challenge nonce. */
@@ -176,10 +163,9 @@ int vcblockchain_protocol_decode_resp_handshake_request(
     }
 
     /* copy the challenge nonce. */
-    memcpy(
-        resp->server_challenge_nonce.data, buf,
+    vcblockchain_wire_read_bytes(
+        &reader, resp->server_challenge_nonce.data,
         resp->server_challenge_nonce.size);
-    buf += resp->server_challenge_nonce.size;
     resp->server_challenge_nonce_set = true;
 
     /* allocate the server cr hmac. */
@@ -192,8 +178,8 @@ int vcblockchain_protocol_decode_resp_handshake_request(
     }
 
     /* copy the cr hmac. */
-    memcpy(resp->server_cr_hmac.data, buf, resp->server_cr_hmac.size);
-    buf += resp->server_cr_hmac.size;
+    vcblockchain_wire_read_bytes(
+        &reader, resp->server_cr_hmac.data, resp->server_cr_hmac.size);
     resp->server_cr_hmac_set = true;
 
     /* success. */
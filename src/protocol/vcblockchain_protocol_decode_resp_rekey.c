@@ -0,0 +1,154 @@
+/**
+ * \file protocol/vcblockchain_protocol_decode_resp_rekey.c
+ *
+ * \brief Decode a rekey response into a response structure.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/data.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <string.h>
+
+#include "wire_internal.h"
+
+/* forward decls. */
+static void dispose_protocol_resp_rekey(void* disp);
+
+/**
+ * \brief Decode a rekey response using the given parameters.
+ *
+ * \param resp                      The decoded response buffer.
+ * \param suite                     The crypto suite to use for this request.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p resp structure is initialized with the decoded values.
+ * The caller owns this structure and must \ref dispose() it when it is no
+ * longer needed.
+ *
+ * If the agent refused the rekey, then the response only holds a header, and
+ * the status from the response is returned.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - the status from the response if the agent refused the rekey.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_decode_resp_rekey(
+    protocol_resp_rekey* resp, vccrypt_suite_options_t* suite,
+    const void* payload, size_t payload_size)
+{
+    int retval;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != resp);
+    MODEL_ASSERT(NULL != suite);
+    MODEL_ASSERT(NULL != payload);
+
+    /* compute failure payload size. */
+    size_t expected_fail_payload_size =
+          sizeof(uint32_t) /* request_id */
+        + sizeof(uint32_t) /* offset */
+        + sizeof(uint32_t); /* status */
+
+    /* compute the expected full payload size. */
+    size_t expected_full_payload_size =
+          expected_fail_payload_size
+        + sizeof(uint64_t) /* server_switch_iv */
+        + suite->key_cipher_opts.minimum_nonce_size;
+
+    /* clear the response structure. */
+    memset(resp, 0, sizeof(*resp));
+
+    /* set the disposer. */
+    resp->hdr.dispose = &dispose_protocol_resp_rekey;
+
+    /* is this at least large enough for the failure case? */
+    if (payload_size < expected_fail_payload_size)
+    {
+        retval = VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE;
+        goto cleanup_resp;
+    }
+
+    /* read cursor for convenience. */
+    vcblockchain_wire_reader reader;
+    vcblockchain_wire_reader_init(&reader, payload, payload_size);
+
+    /* read the request_id. */
+    resp->request_id = vcblockchain_wire_read_u32(&reader);
+    if (PROTOCOL_REQ_ID_REKEY != resp->request_id)
+    {
+        retval = VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE;
+        goto cleanup_resp;
+    }
+
+    /* read the status. */
+    resp->status = vcblockchain_wire_read_u32(&reader);
+
+    /* read the request offset. */
+    resp->offset = vcblockchain_wire_read_u32(&reader);
+
+    /* exit early if the status is not success. */
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != resp->status)
+    {
+        retval = resp->status;
+        goto cleanup_resp;
+    }
+
+    /* if the status is success, then verify that we have a full payload. */
+    if (payload_size != expected_full_payload_size)
+    {
+        retval = VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE;
+        goto cleanup_resp;
+    }
+
+    /* read the server switch IV. */
+    resp->server_switch_iv = vcblockchain_wire_read_u64(&reader);
+
+    /* allocate the server key nonce. */
+    retval =
+        vccrypt_suite_buffer_init_for_cipher_key_agreement_nonce(
+            suite, &resp->server_key_nonce);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_resp;
+    }
+
+    /* copy the key nonce. */
+    vcblockchain_wire_read_bytes(
+        &reader, resp->server_key_nonce.data, resp->server_key_nonce.size);
+    resp->server_key_nonce_set = true;
+
+    /* success. */
+    retval = VCBLOCKCHAIN_STATUS_SUCCESS;
+    /* on success, the response struct is owned by the caller. */
+    goto done;
+
+cleanup_resp:
+    dispose((disposable_t*)resp);
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Dispose of the response structure.
+ *
+ * \param disp          Opaque pointer to the response structure to dispose.
+ */
+static void dispose_protocol_resp_rekey(void* disp)
+{
+    protocol_resp_rekey* resp = (protocol_resp_rekey*)disp;
+
+    /* clean up server key nonce if set. */
+    if (resp->server_key_nonce_set)
+    {
+        dispose((disposable_t*)&resp->server_key_nonce);
+    }
+
+    /* clear the structure. */
+    memset(resp, 0, sizeof(*resp));
+}
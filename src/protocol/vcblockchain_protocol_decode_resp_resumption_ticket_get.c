@@ -0,0 +1,109 @@
+/**
+ * \file protocol/vcblockchain_protocol_decode_resp_resumption_ticket_get.c
+ *
+ * \brief Decode a resumption ticket get response into a struct.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+
+#include "wire_internal.h"
+
+/* forward decls. */
+static void dispose_protocol_resp_resumption_ticket_get(void* disp);
+
+/**
+ * \brief Decode a resumption ticket get response.
+ *
+ * \param resp                      The decoded response buffer.
+ * \param alloc_opts                The allocator options to use for this
+ *                                  operation.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p resp structure is initialized with the decoded values. The
+ * caller owns this structure and must \ref dispose() it when it is no longer
+ * needed. If the agent did not issue a ticket, then the response holds only a
+ * header, and the ticket is left empty.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_decode_resp_resumption_ticket_get(
+    protocol_resp_resumption_ticket_get* resp, allocator_options_t* alloc_opts,
+    const void* payload, size_t payload_size)
+{
+    /* parameter sanity check. */
+    MODEL_ASSERT(NULL != resp);
+    MODEL_ASSERT(NULL != alloc_opts);
+    MODEL_ASSERT(NULL != payload);
+
+    /* runtime parameter checks. */
+    if (NULL == resp || NULL == alloc_opts || NULL == payload)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* payload size check. */
+    const size_t resp_size = 3 * sizeof(uint32_t);
+    if (payload_size < resp_size)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* initialize the response structure. */
+    memset(resp, 0, sizeof(*resp));
+    resp->hdr.dispose = &dispose_protocol_resp_resumption_ticket_get;
+
+    /* read the response fields. */
+    vcblockchain_wire_reader reader;
+    vcblockchain_wire_reader_init(&reader, payload, payload_size);
+    resp->request_id = vcblockchain_wire_read_u32(&reader);
+    resp->status = vcblockchain_wire_read_u32(&reader);
+    resp->offset = vcblockchain_wire_read_u32(&reader);
+
+    /* compute the size of the ticket. */
+    const size_t ticket_size = payload_size - resp_size;
+    if (0U == ticket_size)
+    {
+        return VCBLOCKCHAIN_STATUS_SUCCESS;
+    }
+
+    /* create the ticket buffer. */
+    if (VCCRYPT_STATUS_SUCCESS
+        != vccrypt_buffer_init(&resp->ticket, alloc_opts, ticket_size))
+    {
+        memset(resp, 0, sizeof(*resp));
+        return VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* copy the ticket. */
+    vcblockchain_wire_read_bytes(&reader, resp->ticket.data, ticket_size);
+
+    /* success. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
+
+/**
+ * \brief Dispose of a decoded response structure.
+ *
+ * \param disp      The structure to dispose.
+ */
+static void dispose_protocol_resp_resumption_ticket_get(void* disp)
+{
+    protocol_resp_resumption_ticket_get* resp =
+        (protocol_resp_resumption_ticket_get*)disp;
+
+    /* dispose of the ticket if set. */
+    if (NULL != resp->ticket.data)
+    {
+        dispose((disposable_t*)&resp->ticket);
+    }
+
+    memset(resp, 0, sizeof(protocol_resp_resumption_ticket_get));
+}
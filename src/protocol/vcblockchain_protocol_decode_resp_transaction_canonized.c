@@ -0,0 +1,91 @@
+/**
+ * \file protocol/vcblockchain_protocol_decode_resp_transaction_canonized.c
+ *
+ * \brief Decode a transaction canonized notification into a struct.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+
+#include "wire_internal.h"
+
+/* forward decls. */
+static void dispose_protocol_resp_transaction_canonized(void* disp);
+
+/**
+ * \brief Decode a transaction canonized notification.
+ *
+ * \param resp                      The decoded notification buffer.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p resp structure is initialized with the decoded values.
+ * The caller owns this structure and must \ref dispose() it when it is no
+ * longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_decode_resp_transaction_canonized(
+    protocol_resp_transaction_canonized* resp, const void* payload,
+    size_t payload_size)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != resp);
+    MODEL_ASSERT(NULL != payload);
+
+    /* runtime parameter checks. */
+    if (NULL == resp || NULL == payload)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* payload size check. */
+    const size_t resp_size =
+          3 * sizeof(uint32_t) /* request_id, offset, and status. */
+        + 2 * 16 /* txn_id and block_id. */
+        + sizeof(uint64_t); /* block_height. */
+    if (resp_size != payload_size)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* initialize the response structure. */
+    memset(resp, 0, sizeof(*resp));
+    resp->hdr.dispose = &dispose_protocol_resp_transaction_canonized;
+
+    /* read the header fields. */
+    vcblockchain_wire_reader reader;
+    vcblockchain_wire_reader_init(&reader, payload, payload_size);
+    resp->request_id = vcblockchain_wire_read_u32(&reader);
+    resp->status = vcblockchain_wire_read_u32(&reader);
+    resp->offset = vcblockchain_wire_read_u32(&reader);
+
+    /* read the uuid values. */
+    vcblockchain_wire_read_uuid(&reader, &resp->txn_id);
+    vcblockchain_wire_read_uuid(&reader, &resp->block_id);
+
+    /* read the block height. */
+    resp->block_height = vcblockchain_wire_read_u64(&reader);
+
+    /* success. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
+
+/**
+ * \brief Dispose of a decoded notification structure.
+ *
+ * \param disp      The structure to dispose.
+ */
+static void dispose_protocol_resp_transaction_canonized(void* disp)
+{
+    protocol_resp_transaction_canonized* resp =
+        (protocol_resp_transaction_canonized*)disp;
+
+    memset(resp, 0, sizeof(protocol_resp_transaction_canonized));
+}
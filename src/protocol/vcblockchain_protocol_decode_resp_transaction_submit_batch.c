@@ -0,0 +1,132 @@
+/**
+ * \file protocol/vcblockchain_protocol_decode_resp_transaction_submit_batch.c
+ *
+ * \brief Decode a transaction submit batch response into a struct.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+
+#include "wire_internal.h"
+
+/* forward decls. */
+static void dispose_protocol_resp_transaction_submit_batch(void* disp);
+
+/**
+ * \brief Decode a transaction submit batch response.
+ *
+ * \param resp                      The decoded response buffer.
+ * \param alloc_opts                The allocator to use for this response.
+ * \param payload                   Pointer to the payload to decode.
+ * \param payload_size              Size of the payload.
+ *
+ * On success, the \p resp structure is initialized with the decoded values.
+ * The status array is owned by \p resp. The caller owns this structure and
+ * must \ref dispose() it when it is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the payload is malformed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered.
+ */
+int vcblockchain_protocol_decode_resp_transaction_submit_batch(
+    protocol_resp_transaction_submit_batch* resp,
+    allocator_options_t* alloc_opts, const void* payload, size_t payload_size)
+{
+    int retval;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != resp);
+    MODEL_ASSERT(NULL != alloc_opts);
+    MODEL_ASSERT(NULL != payload);
+
+    /* runtime parameter checks. */
+    if (NULL == resp || NULL == alloc_opts || NULL == payload)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* verify that the payload holds the header. */
+    const size_t header_size =
+          4 * sizeof(uint32_t); /* request_id, status, offset, and count. */
+    if (payload_size < header_size)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* initialize the response structure. */
+    memset(resp, 0, sizeof(*resp));
+    resp->hdr.dispose = &dispose_protocol_resp_transaction_submit_batch;
+
+    /* set the header values. */
+    vcblockchain_wire_reader reader;
+    vcblockchain_wire_reader_init(&reader, payload, payload_size);
+    resp->request_id = vcblockchain_wire_read_u32(&reader);
+    resp->status = vcblockchain_wire_read_u32(&reader);
+    resp->offset = vcblockchain_wire_read_u32(&reader);
+    resp->count = vcblockchain_wire_read_u32(&reader);
+
+    /* the body must hold exactly one status per transaction. */
+    const size_t body_size = payload_size - header_size;
+    if (0 != body_size % sizeof(uint32_t)
+     || body_size / sizeof(uint32_t) != resp->count)
+    {
+        retval = VCBLOCKCHAIN_ERROR_INVALID_ARG;
+        goto cleanup_resp;
+    }
+
+    /* an empty response has nothing more to decode. */
+    if (0 == resp->count)
+    {
+        return VCBLOCKCHAIN_STATUS_SUCCESS;
+    }
+
+    /* create the status array. */
+    if (VCCRYPT_STATUS_SUCCESS !=
+        vccrypt_buffer_init(&resp->statuses_buffer, alloc_opts, body_size))
+    {
+        retval = VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+        goto cleanup_resp;
+    }
+
+    resp->statuses = (uint32_t*)resp->statuses_buffer.data;
+
+    /* decode the status of each transaction. */
+    for (uint32_t i = 0; i < resp->count; ++i)
+    {
+        resp->statuses[i] = vcblockchain_wire_read_u32(&reader);
+    }
+
+    /* success. */
+    /* On success, the caller owns resp. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+
+cleanup_resp:
+    dispose((disposable_t*)resp);
+
+    return retval;
+}
+
+/**
+ * \brief Dispose of a decoded response structure.
+ *
+ * \param disp      The structure to dispose.
+ */
+static void dispose_protocol_resp_transaction_submit_batch(void* disp)
+{
+    protocol_resp_transaction_submit_batch* resp =
+        (protocol_resp_transaction_submit_batch*)disp;
+
+    /* dispose of the status array, if allocated. */
+    if (NULL != resp->statuses_buffer.data)
+    {
+        dispose((disposable_t*)&resp->statuses_buffer);
+    }
+
+    memset(resp, 0, sizeof(protocol_resp_transaction_submit_batch));
+}
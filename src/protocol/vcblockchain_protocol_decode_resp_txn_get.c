@@ -6,13 +6,13 @@
  * \copyright 2021 Velo Payments, Inc.  All rights reserved.
  */
 
-#include <arpa/inet.h>
 #include <cbmc/model_assert.h>
 #include <string.h>
-#include <vcblockchain/byteswap.h>
 #include <vcblockchain/error_codes.h>
 #include <vcblockchain/protocol/serialization.h>
 
+#include "wire_internal.h"
+
 /* forward decls. */
 static void dispose_protocol_resp_txn_get(void* disp);
 
@@ -73,31 +73,27 @@ int vcblockchain_protocol_decode_resp_txn_get(
     }
 
     /* set the integer values. */
-    const uint32_t* uarr = (const uint32_t*)payload;
-    resp->request_id = vcntohl(uarr[0]);
-    resp->status = vcntohl(uarr[1]);
-    resp->offset = vcntohl(uarr[2]);
+    vcblockchain_wire_reader reader;
+    vcblockchain_wire_reader_init(&reader, payload, payload_size);
+    resp->request_id = vcblockchain_wire_read_u32(&reader);
+    resp->status = vcblockchain_wire_read_u32(&reader);
+    resp->offset = vcblockchain_wire_read_u32(&reader);
 
     /* set the uuid values. */
-    const uint8_t* barr = (const uint8_t*)(uarr + 3);
-    memcpy(&resp->txn_id,           barr,       16);
-    memcpy(&resp->prev_txn_id,      barr + 16,  16);
-    memcpy(&resp->next_txn_id,      barr + 32,  16);
-    memcpy(&resp->artifact_id,      barr + 48,  16);
-    memcpy(&resp->block_id,         barr + 64,  16);
+    vcblockchain_wire_read_uuid(&reader, &resp->txn_id);
+    vcblockchain_wire_read_uuid(&reader, &resp->prev_txn_id);
+    vcblockchain_wire_read_uuid(&reader, &resp->next_txn_id);
+    vcblockchain_wire_read_uuid(&reader, &resp->artifact_id);
+    vcblockchain_wire_read_uuid(&reader, &resp->block_id);
 
     /* set the uint64_t values. */
-    uint64_t net_txn_size;
-    memcpy(&net_txn_size, barr + 80, 8);
-    resp->txn_size = ntohll(net_txn_size);
+    resp->txn_size = vcblockchain_wire_read_u64(&reader);
 
     /* set the uint32_t values. */
-    uint32_t net_txn_state;
-    memcpy(&net_txn_state, barr + 88, 4);
-    resp->txn_state = ntohl(net_txn_state);
+    resp->txn_state = vcblockchain_wire_read_u32(&reader);
 
     /* copy the transaction certificate. */
-    memcpy(resp->txn_cert.data, barr + 92, cert_size);
+    vcblockchain_wire_read_bytes(&reader, resp->txn_cert.data, cert_size);
 
     /* success. */
     /* On success, the caller owns resp. */
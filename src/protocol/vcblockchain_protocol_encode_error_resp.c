@@ -6,10 +6,11 @@
  * \copyright 2022 Velo Payments, Inc.  All rights reserved.
  */
 
-#include <arpa/inet.h>
 #include <vcblockchain/error_codes.h>
 #include <vcblockchain/protocol/serialization.h>
 
+#include "wire_internal.h"
+
 /**
  * \brief Encode an error response using the given parameters.
  *
@@ -52,10 +53,11 @@ int vcblockchain_protocol_encode_error_resp(
     }
 
     /* populate the integer values. */
-    uint32_t* uarr = (uint32_t*)buffer->data;
-    uarr[0] = htonl(req_id);
-    uarr[1] = htonl(status);
-    uarr[2] = htonl(offset);
+    vcblockchain_wire_writer writer;
+    vcblockchain_wire_writer_init(&writer, buffer->data, buffer->size);
+    vcblockchain_wire_write_u32(&writer, req_id);
+    vcblockchain_wire_write_u32(&writer, status);
+    vcblockchain_wire_write_u32(&writer, offset);
 
     /* success. */
     /* On success, the caller owns the buffer and must dispose it. */
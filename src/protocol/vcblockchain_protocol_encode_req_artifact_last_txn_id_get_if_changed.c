@@ -0,0 +1,85 @@
+/**
+ * \file
+ * protocol/vcblockchain_protocol_encode_req_artifact_last_txn_id_get_if_changed.c
+ *
+ * \brief Encode a conditional artifact last txn id get request into a buffer.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+
+#include "wire_internal.h"
+
+/**
+ * \brief Encode a conditional artifact last txn id get request.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded request packet.
+ * \param alloc_opts                The allocator to use for this request.
+ * \param offset                    The offset to use for this request.
+ * \param timeout_ms                The maximum time in milliseconds that the
+ *                                  agent may hold this request open waiting
+ *                                  for a new transaction, or 0 to answer at
+ *                                  once.
+ * \param artifact_id               The id of the artifact to get.
+ * \param last_txn_id               The last transaction id for this artifact
+ *                                  known to the client.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * request.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_req_artifact_last_txn_id_get_if_changed(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, uint32_t timeout_ms, const vpr_uuid* artifact_id,
+    const vpr_uuid* last_txn_id)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != buffer);
+    MODEL_ASSERT(NULL != alloc_opts);
+    MODEL_ASSERT(NULL != artifact_id);
+    MODEL_ASSERT(NULL != last_txn_id);
+
+    /* runtime parameter checks. */
+    if (NULL == buffer || NULL == alloc_opts || NULL == artifact_id
+     || NULL == last_txn_id)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* compute the buffer size. */
+    size_t buffer_size =
+          3 * sizeof(uint32_t) /* request_id, offset, and timeout */
+        + sizeof(*artifact_id)
+        + sizeof(*last_txn_id);
+
+    /* initialize the buffer. */
+    if (VCCRYPT_STATUS_SUCCESS !=
+        vccrypt_buffer_init(buffer, alloc_opts, buffer_size))
+    {
+        return VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* write the request id, offset, and timeout. */
+    vcblockchain_wire_writer writer;
+    vcblockchain_wire_writer_init(&writer, buffer->data, buffer->size);
+    vcblockchain_wire_write_u32(
+        &writer, PROTOCOL_REQ_ID_ARTIFACT_LAST_TXN_BY_ID_GET_IF_CHANGED);
+    vcblockchain_wire_write_u32(&writer, offset);
+    vcblockchain_wire_write_u32(&writer, timeout_ms);
+
+    /* copy the ids. */
+    vcblockchain_wire_write_uuid(&writer, artifact_id);
+    vcblockchain_wire_write_uuid(&writer, last_txn_id);
+
+    /* success. */
+    /* buffer is owned by the caller on success. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
@@ -0,0 +1,73 @@
+/**
+ * \file protocol/vcblockchain_protocol_encode_req_artifact_latest_txn_get.c
+ *
+ * \brief Encode an artifact latest txn get request into a buffer.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+
+#include "wire_internal.h"
+
+/**
+ * \brief Encode an artifact latest txn get request.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded request packet.
+ * \param alloc_opts                The allocator to use for this request.
+ * \param offset                    The offset to use for this request.
+ * \param artifact_id               The id of artifact to get.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * request.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_req_artifact_latest_txn_get(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, const vpr_uuid* artifact_id)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_valid_vccrypt_buffer(buffer));
+    MODEL_ASSERT(prop_valid_allocator(alloc_opts));
+    MODEL_ASSERT(NULL != artifact_id);
+
+    /* runtime parameter checks. */
+    if (NULL == buffer || NULL == alloc_opts || NULL == artifact_id)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* compute the buffer size. */
+    size_t buffer_size =
+          2 * sizeof(uint32_t) /* request_id and offset */
+        + sizeof(*artifact_id);
+
+    /* initialize the buffer. */
+    if (VCCRYPT_STATUS_SUCCESS !=
+        vccrypt_buffer_init(buffer, alloc_opts, buffer_size))
+    {
+        return VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* write the request id and offset. */
+    vcblockchain_wire_writer writer;
+    vcblockchain_wire_writer_init(&writer, buffer->data, buffer->size);
+    vcblockchain_wire_write_u32(
+        &writer, PROTOCOL_REQ_ID_ARTIFACT_LATEST_TXN_GET);
+    vcblockchain_wire_write_u32(&writer, offset);
+
+    /* copy the artifact id. */
+    vcblockchain_wire_write_uuid(&writer, artifact_id);
+
+    /* success. */
+    /* buffer is owned by the caller on success. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
@@ -0,0 +1,82 @@
+/**
+ * \file protocol/vcblockchain_protocol_encode_req_artifact_subscribe.c
+ *
+ * \brief Encode an artifact subscription request.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/limits.h>
+#include <vcblockchain/protocol/serialization.h>
+
+#include "wire_internal.h"
+
+/**
+ * \brief Encode an artifact subscription request.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded request packet.
+ * \param alloc_opts                The allocator to use for this request.
+ * \param offset                    The offset to use for this request.
+ * \param artifact_ids              The artifact ids to watch.
+ * \param count                     The number of artifact ids, which must be
+ *                                  between 1 and the maximum artifact
+ *                                  subscription count.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * request.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered.
+ */
+int vcblockchain_protocol_encode_req_artifact_subscribe(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts, uint32_t offset,
+    const vpr_uuid* artifact_ids, size_t count)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != buffer);
+    MODEL_ASSERT(NULL != alloc_opts);
+    MODEL_ASSERT(NULL != artifact_ids);
+
+    /* runtime parameter checks. */
+    if (NULL == buffer || NULL == alloc_opts || NULL == artifact_ids
+     || 0U == count
+     || count > VCBLOCKCHAIN_LIMIT_MAXIMUM_ARTIFACT_SUBSCRIPTION_COUNT)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* compute the buffer size. */
+    size_t buffer_size =
+          3 * sizeof(uint32_t) /* request_id, offset, and count */
+        + count * sizeof(vpr_uuid);
+
+    /* initialize the buffer. */
+    if (VCCRYPT_STATUS_SUCCESS !=
+        vccrypt_buffer_init(buffer, alloc_opts, buffer_size))
+    {
+        return VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* write the request id, offset, and count. */
+    vcblockchain_wire_writer writer;
+    vcblockchain_wire_writer_init(&writer, buffer->data, buffer->size);
+    vcblockchain_wire_write_u32(&writer, PROTOCOL_REQ_ID_ARTIFACT_SUBSCRIBE);
+    vcblockchain_wire_write_u32(&writer, offset);
+    vcblockchain_wire_write_u32(&writer, (uint32_t)count);
+
+    /* copy the packed artifact ids. */
+    vcblockchain_wire_write_bytes(
+        &writer, artifact_ids, count * sizeof(vpr_uuid));
+
+    /* success. */
+    /* buffer is owned by the caller on success. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
@@ -0,0 +1,100 @@
+/**
+ * \file protocol/vcblockchain_protocol_encode_req_artifact_txn_page_get.c
+ *
+ * \brief Encode an artifact transaction page get request into a buffer.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+
+#include "wire_internal.h"
+
+/**
+ * \brief Encode an artifact transaction page get request.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded request packet.
+ * \param alloc_opts                The allocator to use for this request.
+ * \param offset                    The offset to use for this request.
+ * \param artifact_id               The artifact id.
+ * \param cursor_txn_id             The page starts after this transaction. If
+ *                                  this is the zero uuid, then the page starts
+ *                                  at the first transaction in \p direction.
+ * \param direction                 The \ref protocol_txn_page_direction for
+ *                                  this page.
+ * \param page_size                 The maximum number of transactions to
+ *                                  return.
+ * \param include_certs             Set to true to return the transaction
+ *                                  certificates.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * request.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if \p direction is unknown or
+ *        \p page_size is zero.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_req_artifact_txn_page_get(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, const vpr_uuid* artifact_id,
+    const vpr_uuid* cursor_txn_id, uint32_t direction, uint32_t page_size,
+    bool include_certs)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != buffer);
+    MODEL_ASSERT(NULL != alloc_opts);
+    MODEL_ASSERT(NULL != artifact_id);
+    MODEL_ASSERT(NULL != cursor_txn_id);
+
+    /* runtime parameter checks. */
+    if (NULL == buffer || NULL == alloc_opts || NULL == artifact_id
+     || NULL == cursor_txn_id || 0 == page_size
+     || (PROTOCOL_TXN_PAGE_DIRECTION_FORWARD != direction
+      && PROTOCOL_TXN_PAGE_DIRECTION_BACKWARD != direction))
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* compute the buffer size. */
+    size_t buffer_size =
+          2 * sizeof(uint32_t) /* request_id and offset */
+        + sizeof(*artifact_id)
+        + sizeof(*cursor_txn_id)
+        + sizeof(direction)
+        + sizeof(page_size)
+        + sizeof(uint32_t); /* include_certs. */
+
+    /* initialize the buffer. */
+    if (VCCRYPT_STATUS_SUCCESS !=
+        vccrypt_buffer_init(buffer, alloc_opts, buffer_size))
+    {
+        return VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* write the request id and offset. */
+    vcblockchain_wire_writer writer;
+    vcblockchain_wire_writer_init(&writer, buffer->data, buffer->size);
+    vcblockchain_wire_write_u32(
+        &writer, PROTOCOL_REQ_ID_ARTIFACT_TXN_PAGE_GET);
+    vcblockchain_wire_write_u32(&writer, offset);
+
+    /* write the artifact id and cursor. */
+    vcblockchain_wire_write_uuid(&writer, artifact_id);
+    vcblockchain_wire_write_uuid(&writer, cursor_txn_id);
+
+    /* write the page parameters. */
+    vcblockchain_wire_write_u32(&writer, direction);
+    vcblockchain_wire_write_u32(&writer, page_size);
+    vcblockchain_wire_write_u32(&writer, include_certs ? 1U : 0U);
+
+    /* success. */
+    /* buffer is owned by the caller on success. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
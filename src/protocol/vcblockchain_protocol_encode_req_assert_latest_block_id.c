@@ -6,12 +6,13 @@
  * \copyright 2022 Velo Payments, Inc.  All rights reserved.
  */
 
-#include <arpa/inet.h>
 #include <cbmc/model_assert.h>
 #include <string.h>
 #include <vcblockchain/error_codes.h>
 #include <vcblockchain/protocol/serialization.h>
 
+#include "wire_internal.h"
+
 /**
  * \brief Encode a latest block id assertion request.
  *
@@ -56,12 +57,14 @@ int vcblockchain_protocol_encode_req_assert_latest_block_id(
     }
 
     /* write the request id and offset. */
-    uint32_t* u32arr = (uint32_t*)buffer->data;
-    u32arr[0] = htonl(PROTOCOL_REQ_ID_ASSERT_LATEST_BLOCK_ID);
-    u32arr[1] = htonl(offset);
+    vcblockchain_wire_writer writer;
+    vcblockchain_wire_writer_init(&writer, buffer->data, buffer->size);
+    vcblockchain_wire_write_u32(
+        &writer, PROTOCOL_REQ_ID_ASSERT_LATEST_BLOCK_ID);
+    vcblockchain_wire_write_u32(&writer, offset);
 
     /* copy the latest block id. */
-    memcpy(u32arr + 2, latest_block_id, sizeof(*latest_block_id));
+    vcblockchain_wire_write_uuid(&writer, latest_block_id);
 
     /* success. */
     /* buffer is owned by the caller on success. */
@@ -7,12 +7,13 @@
  * \copyright 2022 Velo Payments, Inc.  All rights reserved.
  */
 
-#include <arpa/inet.h>
 #include <cbmc/model_assert.h>
 #include <string.h>
 #include <vcblockchain/error_codes.h>
 #include <vcblockchain/protocol/serialization.h>
 
+#include "wire_internal.h"
+
 /**
  * \brief Encode a latest block id assertion cancel request.
  *
@@ -53,9 +54,11 @@ int vcblockchain_protocol_encode_req_assert_latest_block_id_cancel(
     }
 
     /* write the request id and offset. */
-    uint32_t* u32arr = (uint32_t*)buffer->data;
-    u32arr[0] = htonl(PROTOCOL_REQ_ID_ASSERT_LATEST_BLOCK_ID_CANCEL);
-    u32arr[1] = htonl(offset);
+    vcblockchain_wire_writer writer;
+    vcblockchain_wire_writer_init(&writer, buffer->data, buffer->size);
+    vcblockchain_wire_write_u32(
+        &writer, PROTOCOL_REQ_ID_ASSERT_LATEST_BLOCK_ID_CANCEL);
+    vcblockchain_wire_write_u32(&writer, offset);
 
     /* success. */
     /* buffer is owned by the caller on success. */
@@ -0,0 +1,115 @@
+/**
+ * \file protocol/vcblockchain_protocol_encode_req_batch.c
+ *
+ * \brief Encode a batch of requests into a buffer.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/limits.h>
+#include <vcblockchain/protocol/serialization.h>
+
+#include "wire_internal.h"
+
+/**
+ * \brief Encode a batch request.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded request packet.
+ * \param alloc_opts                The allocator to use for this request.
+ * \param offset                    The offset to use for this request.
+ * \param requests                  Array of encoded requests to send in this
+ *                                  batch, each created by one of the request
+ *                                  encode functions.
+ * \param count                     The number of requests in the batch.
+ *
+ * Each request in the batch keeps its own request id and offset, and the
+ * server answers with a single batch response holding one response per
+ * request, in the same order. Batches cannot be nested.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * request.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the batch is empty, too large, or
+ *        holds a request that is malformed or itself a batch.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_req_batch(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, const vccrypt_buffer_t* requests, size_t count)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != buffer);
+    MODEL_ASSERT(NULL != alloc_opts);
+    MODEL_ASSERT(NULL != requests);
+
+    /* runtime parameter checks. */
+    if (NULL == buffer || NULL == alloc_opts || NULL == requests
+     || 0 == count || count > VCBLOCKCHAIN_LIMIT_MAXIMUM_BATCH_COUNT)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* compute the buffer size, verifying each request. */
+    size_t buffer_size =
+          3 * sizeof(uint32_t); /* request_id, offset, and count. */
+    for (size_t i = 0; i < count; ++i)
+    {
+        /* each request must have a request id and offset. */
+        if (NULL == requests[i].data
+         || requests[i].size < 2 * sizeof(uint32_t)
+         || requests[i].size > VCBLOCKCHAIN_LIMIT_MAXIMUM_ENCRYPTED_PACKET_SIZE)
+        {
+            return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+        }
+
+        /* batches can't be nested. */
+        vcblockchain_wire_reader reader;
+        vcblockchain_wire_reader_init(
+            &reader, requests[i].data, requests[i].size);
+        if (PROTOCOL_REQ_ID_BATCH == vcblockchain_wire_read_u32(&reader))
+        {
+            return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+        }
+
+        buffer_size += sizeof(uint32_t) + requests[i].size;
+    }
+
+    /* the batch must fit in a single packet. */
+    if (buffer_size > VCBLOCKCHAIN_LIMIT_MAXIMUM_ENCRYPTED_PACKET_SIZE)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* initialize the buffer. */
+    if (VCCRYPT_STATUS_SUCCESS !=
+        vccrypt_buffer_init(buffer, alloc_opts, buffer_size))
+    {
+        return VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* write the request id, offset, and count. */
+    vcblockchain_wire_writer writer;
+    vcblockchain_wire_writer_init(&writer, buffer->data, buffer->size);
+    vcblockchain_wire_write_u32(&writer, PROTOCOL_REQ_ID_BATCH);
+    vcblockchain_wire_write_u32(&writer, offset);
+    vcblockchain_wire_write_u32(&writer, (uint32_t)count);
+
+    /* write each size-prefixed request. */
+    for (size_t i = 0; i < count; ++i)
+    {
+        vcblockchain_wire_write_u32(&writer, (uint32_t)requests[i].size);
+        vcblockchain_wire_write_bytes(
+            &writer, requests[i].data, requests[i].size);
+    }
+
+    /* success. */
+    /* buffer is owned by the caller on success. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
@@ -6,12 +6,13 @@
  * \copyright 2020 Velo Payments, Inc.  All rights reserved.
  */
 
-#include <arpa/inet.h>
 #include <cbmc/model_assert.h>
 #include <string.h>
 #include <vcblockchain/error_codes.h>
 #include <vcblockchain/protocol/serialization.h>
 
+#include "wire_internal.h"
+
 /**
  * \brief Encode a block get request.
  *
@@ -57,13 +58,13 @@ int vcblockchain_protocol_encode_req_block_get(
     }
 
     /* write the request id and offset. */
-    uint32_t* u32arr = (uint32_t*)buffer->data;
-    u32arr[0] = htonl(PROTOCOL_REQ_ID_BLOCK_BY_ID_GET);
-    u32arr[1] = htonl(offset);
+    vcblockchain_wire_writer writer;
+    vcblockchain_wire_writer_init(&writer, buffer->data, buffer->size);
+    vcblockchain_wire_write_u32(&writer, PROTOCOL_REQ_ID_BLOCK_BY_ID_GET);
+    vcblockchain_wire_write_u32(&writer, offset);
 
     /* copy the block id. */
-    uint8_t* barr = (uint8_t*)(u32arr + 2);
-    memcpy(barr, block_id, sizeof(*block_id));
+    vcblockchain_wire_write_uuid(&writer, block_id);
 
     /* success. */
     /* buffer is owned by the caller on success. */
@@ -6,13 +6,13 @@
  * \copyright 2021 Velo Payments, Inc.  All rights reserved.
  */
 
-#include <arpa/inet.h>
 #include <cbmc/model_assert.h>
 #include <string.h>
-#include <vcblockchain/byteswap.h>
 #include <vcblockchain/error_codes.h>
 #include <vcblockchain/protocol/serialization.h>
 
+#include "wire_internal.h"
+
 /**
  * \brief Encode a block id by height get request.
  *
@@ -57,13 +57,14 @@ int vcblockchain_protocol_encode_req_block_id_by_height_get(
     }
 
     /* write the request id and offset. */
-    uint32_t* u32arr = (uint32_t*)buffer->data;
-    u32arr[0] = htonl(PROTOCOL_REQ_ID_BLOCK_ID_BY_HEIGHT_GET);
-    u32arr[1] = htonl(offset);
+    vcblockchain_wire_writer writer;
+    vcblockchain_wire_writer_init(&writer, buffer->data, buffer->size);
+    vcblockchain_wire_write_u32(
+        &writer, PROTOCOL_REQ_ID_BLOCK_ID_BY_HEIGHT_GET);
+    vcblockchain_wire_write_u32(&writer, offset);
 
     /* copy the block id. */
-    uint64_t* b64 = (uint64_t*)(u32arr + 2);
-    *b64 = htonll(height);
+    vcblockchain_wire_write_u64(&writer, height);
 
     /* success. */
     /* buffer is owned by the caller on success. */
@@ -0,0 +1,81 @@
+/**
+ * \file protocol/vcblockchain_protocol_encode_req_block_range_get.c
+ *
+ * \brief Encode a block range get request into a buffer.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+
+#include "wire_internal.h"
+
+/**
+ * \brief Encode a block range get request.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded request packet.
+ * \param alloc_opts                The allocator to use for this request.
+ * \param offset                    The offset to use for this request.
+ * \param start_height              The height of the first block to get.
+ * \param count                     The maximum number of blocks to get.
+ * \param max_bytes                 The maximum number of bytes of block data
+ *                                  to return, or 0 to leave this up to the
+ *                                  server.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * request.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if \p count is zero.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_req_block_range_get(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, uint64_t start_height, uint32_t count,
+    uint32_t max_bytes)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != buffer);
+    MODEL_ASSERT(NULL != alloc_opts);
+
+    /* runtime parameter checks. */
+    if (NULL == buffer || NULL == alloc_opts || 0 == count)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* compute the buffer size. */
+    size_t buffer_size =
+          2 * sizeof(uint32_t) /* request_id and offset */
+        + sizeof(start_height)
+        + sizeof(count)
+        + sizeof(max_bytes);
+
+    /* initialize the buffer. */
+    if (VCCRYPT_STATUS_SUCCESS !=
+        vccrypt_buffer_init(buffer, alloc_opts, buffer_size))
+    {
+        return VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* write the request id and offset. */
+    vcblockchain_wire_writer writer;
+    vcblockchain_wire_writer_init(&writer, buffer->data, buffer->size);
+    vcblockchain_wire_write_u32(&writer, PROTOCOL_REQ_ID_BLOCK_RANGE_GET);
+    vcblockchain_wire_write_u32(&writer, offset);
+
+    /* write the range. */
+    vcblockchain_wire_write_u64(&writer, start_height);
+    vcblockchain_wire_write_u32(&writer, count);
+    vcblockchain_wire_write_u32(&writer, max_bytes);
+
+    /* success. */
+    /* buffer is owned by the caller on success. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
@@ -7,12 +7,13 @@
  * \copyright 2022 Velo Payments, Inc.  All rights reserved.
  */
 
-#include <arpa/inet.h>
 #include <cbmc/model_assert.h>
 #include <string.h>
 #include <vcblockchain/error_codes.h>
 #include <vcblockchain/protocol/serialization.h>
 
+#include "wire_internal.h"
+
 /**
  * \brief Encode an extended API request.
  *
@@ -63,15 +64,16 @@ int vcblockchain_protocol_encode_req_extended_api(
     }
 
     /* write the request id and offset. */
-    uint32_t* u32arr = (uint32_t*)buffer->data;
-    u32arr[0] = htonl(PROTOCOL_REQ_ID_EXTENDED_API_SENDRECV);
-    u32arr[1] = htonl(offset);
+    vcblockchain_wire_writer writer;
+    vcblockchain_wire_writer_init(&writer, buffer->data, buffer->size);
+    vcblockchain_wire_write_u32(&writer, PROTOCOL_REQ_ID_EXTENDED_API_SENDRECV);
+    vcblockchain_wire_write_u32(&writer, offset);
 
     /* write remaining values. */
-    uint8_t* u8arr = (uint8_t*)(u32arr + 2);
-    memcpy(u8arr, entity_id, sizeof(*entity_id)); u8arr += sizeof(*entity_id);
-    memcpy(u8arr, verb_id, sizeof(*verb_id)); u8arr += sizeof(*verb_id);
-    memcpy(u8arr, request_body->data, request_body->size);
+    vcblockchain_wire_write_uuid(&writer, entity_id);
+    vcblockchain_wire_write_uuid(&writer, verb_id);
+    vcblockchain_wire_write_bytes(
+        &writer, request_body->data, request_body->size);
 
     /* success. */
     /* buffer is owned by the caller on success. */
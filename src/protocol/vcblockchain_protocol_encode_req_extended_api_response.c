@@ -7,13 +7,13 @@
  * \copyright 2022 Velo Payments, Inc.  All rights reserved.
  */
 
-#include <arpa/inet.h>
 #include <cbmc/model_assert.h>
 #include <string.h>
-#include <vcblockchain/byteswap.h>
 #include <vcblockchain/error_codes.h>
 #include <vcblockchain/protocol/serialization.h>
 
+#include "wire_internal.h"
+
 /**
  * \brief Encode an extended API request to send a response to a client.
  *
@@ -63,28 +63,24 @@ int vcblockchain_protocol_encode_req_extended_api_response(
     }
 
     /* make working with this buffer more convenient. */
-    uint8_t* barr = (uint8_t*)buffer->data;
+    vcblockchain_wire_writer writer;
+    vcblockchain_wire_writer_init(&writer, buffer->data, buffer->size);
 
     /* write the request id. */
-    uint32_t net_request_id = htonl(PROTOCOL_REQ_ID_EXTENDED_API_SENDRESP);
-    memcpy(barr, &net_request_id, sizeof(net_request_id));
-    barr += sizeof(net_request_id);
+    vcblockchain_wire_write_u32(
+        &writer, PROTOCOL_REQ_ID_EXTENDED_API_SENDRESP);
 
     /* write the offset. */
-    uint64_t net_offset = htonll(offset);
-    memcpy(barr, &net_offset, sizeof(net_offset));
-    barr += sizeof(net_offset);
+    vcblockchain_wire_write_u64(&writer, offset);
 
     /* write the status. */
-    uint32_t net_status = htonl(status);
-    memcpy(barr, &net_status, sizeof(net_status));
-    barr += sizeof(net_status);
+    vcblockchain_wire_write_u32(&writer, status);
 
     /* write the response buffer. */
     if (NULL != response_body->data && response_body->size > 0)
     {
-        memcpy(barr, response_body->data, response_body->size);
-        barr += response_body->size;
+        vcblockchain_wire_write_bytes(
+            &writer, response_body->data, response_body->size);
     }
 
     /* success. */
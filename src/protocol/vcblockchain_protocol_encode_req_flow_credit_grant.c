@@ -0,0 +1,91 @@
+/**
+ * \file protocol/vcblockchain_protocol_encode_req_flow_credit_grant.c
+ *
+ * \brief Encode a flow credit grant request into a buffer.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+
+#include "wire_internal.h"
+
+/**
+ * \brief Encode a flow credit grant request.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded request packet.
+ * \param alloc_opts                The allocator to use for this request.
+ * \param offset                    The offset to use for this request.
+ * \param request_credits           The number of requests granted. The client
+ *                                  does not limit the number of responses, so
+ *                                  this should be zero.
+ * \param byte_credits              The number of response bytes granted.
+ *
+ * The first grant sent on a connection negotiates flow control. It carries the
+ * whole of the client's receive window, and the agent answers it with a grant
+ * response that carries the whole of its own. Later grants return credits as
+ * the client frees capacity, and are not answered.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * request.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_req_flow_credit_grant(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, uint32_t request_credits, uint64_t byte_credits)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != buffer);
+    MODEL_ASSERT(NULL != alloc_opts);
+
+    /* runtime parameter checks. */
+    if (NULL == buffer || NULL == alloc_opts)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* | Flow credit grant request packet.                                  | */
+    /* | --------------------------------------------------- | ------------ | */
+    /* | DATA                                                | SIZE         | */
+    /* | --------------------------------------------------- | ------------ | */
+    /* | PROTOCOL_REQ_ID_FLOW_CREDIT_GRANT                   |   4 bytes    | */
+    /* | offset                                              |   4 bytes    | */
+    /* | record:                                             |  12 bytes    | */
+    /* |    request_credits                                  |   4 bytes    | */
+    /* |    byte_credits                                     |   8 bytes    | */
+    /* | --------------------------------------------------- | ------------ | */
+
+    /* compute the buffer size. */
+    size_t buffer_size =
+          sizeof(uint32_t) /* request_id */
+        + sizeof(uint32_t) /* offset */
+        + sizeof(uint32_t) /* request_credits */
+        + sizeof(uint64_t); /* byte_credits */
+
+    /* initialize the buffer. */
+    if (VCCRYPT_STATUS_SUCCESS !=
+        vccrypt_buffer_init(buffer, alloc_opts, buffer_size))
+    {
+        return VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* write the request fields. */
+    vcblockchain_wire_writer writer;
+    vcblockchain_wire_writer_init(&writer, buffer->data, buffer->size);
+    vcblockchain_wire_write_u32(&writer, PROTOCOL_REQ_ID_FLOW_CREDIT_GRANT);
+    vcblockchain_wire_write_u32(&writer, offset);
+    vcblockchain_wire_write_u32(&writer, request_credits);
+    vcblockchain_wire_write_u64(&writer, byte_credits);
+
+    /* success. */
+    /* buffer is owned by the caller on success. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
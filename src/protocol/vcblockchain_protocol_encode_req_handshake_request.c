@@ -6,13 +6,14 @@
  * \copyright 2020 Velo Payments, Inc.  All rights reserved.
  */
 
-#include <arpa/inet.h>
 #include <cbmc/model_assert.h>
 #include <vcblockchain/error_codes.h>
 #include <vcblockchain/protocol/data.h>
 #include <vcblockchain/protocol/serialization.h>
 #include <string.h>
 
+#include "wire_internal.h"
+
 /**
  * \brief Encode a handshake request using the given parameters.
  *
@@ -45,10 +46,6 @@ int vcblockchain_protocol_encode_req_handshake_request(
     MODEL_ASSERT(NULL != client_key_nonce);
     MODEL_ASSERT(NULL != client_challenge_nonce);
 
-    const uint32_t net_request_id = htonl(PROTOCOL_REQ_ID_HANDSHAKE_INITIATE);
-    const uint32_t net_offset = htonl(offset);
-    const uint32_t net_protocol_version = htonl(PROTOCOL_VERSION_0_1_DEMO);
-    const uint32_t net_crypto_suite = htonl(suite->suite_id);
     int retval;
 
     /* verify the nonce sizes. */
@@ -75,10 +72,10 @@ int vcblockchain_protocol_encode_req_handshake_request(
 
     /* compute the size of the request packet. */
     size_t payload_size =
-          sizeof(net_request_id)
-        + sizeof(net_offset)
-        + sizeof(net_protocol_version)
-        + sizeof(net_crypto_suite)
+          sizeof(uint32_t) /* request_id */
+        + sizeof(uint32_t) /* offset */
+        + sizeof(uint32_t) /* protocol_version */
+        + sizeof(uint32_t) /* crypto_suite */
         + sizeof(*client_id)
         + client_key_nonce->size
         + client_challenge_nonce->size;
@@ -91,33 +88,29 @@ int vcblockchain_protocol_encode_req_handshake_request(
     }
 
     /* write the request to the buffer. */
-    uint8_t* buf = (uint8_t*)buffer->data;
-    memcpy(buf, &net_request_id, sizeof(net_request_id));
-    buf += sizeof(net_request_id);
+    vcblockchain_wire_writer writer;
+    vcblockchain_wire_writer_init(&writer, buffer->data, buffer->size);
+    vcblockchain_wire_write_u32(&writer, PROTOCOL_REQ_ID_HANDSHAKE_INITIATE);
 
     /* write the offset to the buffer. */
-    memcpy(buf, &net_offset, sizeof(net_offset));
-    buf += sizeof(net_offset);
+    vcblockchain_wire_write_u32(&writer, offset);
 
     /* write the protocol version to the buffer. */
-    memcpy(buf, &net_protocol_version, sizeof(net_protocol_version));
-    buf += sizeof(net_protocol_version);
+    vcblockchain_wire_write_u32(&writer, PROTOCOL_VERSION_0_1_DEMO);
 
     /* write the crypto suite id to the buffer. */
-    memcpy(buf, &net_crypto_suite, sizeof(net_crypto_suite));
-    buf += sizeof(net_crypto_suite);
+    vcblockchain_wire_write_u32(&writer, suite->suite_id);
 
     /* write the entity id to the buffer. */
-    memcpy(buf, client_id, sizeof(*client_id));
-    buf += sizeof(*client_id);
+    vcblockchain_wire_write_uuid(&writer, client_id);
 
     /* write the client key nonce to the buffer. */
-    memcpy(buf, client_key_nonce->data, client_key_nonce->size);
-    buf += client_key_nonce->size;
+    vcblockchain_wire_write_bytes(
+        &writer, client_key_nonce->data, client_key_nonce->size);
 
     /* write the client challenge nonce to the buffer. */
-    memcpy(buf, client_challenge_nonce->data, client_challenge_nonce->size);
-    buf += client_challenge_nonce->size;
+    vcblockchain_wire_write_bytes(
+        &writer, client_challenge_nonce->data, client_challenge_nonce->size);
 
     /* success. */
     retval = VCBLOCKCHAIN_STATUS_SUCCESS;
@@ -0,0 +1,122 @@
+/**
+ * \file protocol/vcblockchain_protocol_encode_req_handshake_resume.c
+ *
+ * \brief Encode a handshake resume request into a buffer.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/data.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <string.h>
+
+#include "wire_internal.h"
+
+/**
+ * \brief Encode a handshake resume request using the given parameters.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded handshake packet.
+ * \param suite                     The crypto suite to use for this request.
+ * \param offset                    The offset for this request.
+ * \param client_id                 The client uuid for this request.
+ * \param client_key_nonce          The client key nonce for this request.
+ * \param ticket                    The resumption ticket issued by the agent
+ *                                  during a previous session.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * request.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the nonce has the wrong size or the
+ *        ticket is empty.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_req_handshake_resume(
+    vccrypt_buffer_t* buffer, vccrypt_suite_options_t* suite,
+    uint32_t offset, const vpr_uuid* client_id,
+    const vccrypt_buffer_t* client_key_nonce, const vccrypt_buffer_t* ticket)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != buffer);
+    MODEL_ASSERT(NULL != suite);
+    MODEL_ASSERT(NULL != client_id);
+    MODEL_ASSERT(NULL != client_key_nonce);
+    MODEL_ASSERT(NULL != ticket);
+
+    int retval;
+
+    /* verify the nonce and ticket sizes. */
+    if (client_key_nonce->size != suite->key_cipher_opts.minimum_nonce_size
+     || 0U == ticket->size)
+    {
+        retval = VCBLOCKCHAIN_ERROR_INVALID_ARG;
+        goto done;
+    }
+
+    /* | Handshake resume request packet.                                   | */
+    /* | --------------------------------------------------- | ------------ | */
+    /* | DATA                                                | SIZE         | */
+    /* | --------------------------------------------------- | ------------ | */
+    /* | PROTOCOL_REQ_ID_HANDSHAKE_RESUME                    |  4 bytes     | */
+    /* | offset                                              |  4 bytes     | */
+    /* | record:                                             | 56 bytes     | */
+    /* |    protocol_version                                 |  4 bytes     | */
+    /* |    crypto_suite                                     |  4 bytes     | */
+    /* |    client_id                                        | 16 bytes     | */
+    /* |    client key nonce                                 | 32 bytes     | */
+    /* | ticket                                              | n bytes      | */
+    /* | --------------------------------------------------- | ------------ | */
+
+    /* compute the size of the request packet. */
+    size_t payload_size =
+          sizeof(uint32_t) /* request_id */
+        + sizeof(uint32_t) /* offset */
+        + sizeof(uint32_t) /* protocol_version */
+        + sizeof(uint32_t) /* crypto_suite */
+        + sizeof(*client_id)
+        + client_key_nonce->size
+        + ticket->size;
+
+    /* create output buffer. */
+    retval = vccrypt_buffer_init(buffer, suite->alloc_opts, payload_size);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* write the request id to the buffer. */
+    vcblockchain_wire_writer writer;
+    vcblockchain_wire_writer_init(&writer, buffer->data, buffer->size);
+    vcblockchain_wire_write_u32(&writer, PROTOCOL_REQ_ID_HANDSHAKE_RESUME);
+
+    /* write the offset to the buffer. */
+    vcblockchain_wire_write_u32(&writer, offset);
+
+    /* write the protocol version to the buffer. */
+    vcblockchain_wire_write_u32(&writer, PROTOCOL_VERSION_0_3_RESUMPTION);
+
+    /* write the crypto suite id to the buffer. */
+    vcblockchain_wire_write_u32(&writer, suite->suite_id);
+
+    /* write the entity id to the buffer. */
+    vcblockchain_wire_write_uuid(&writer, client_id);
+
+    /* write the client key nonce to the buffer. */
+    vcblockchain_wire_write_bytes(
+        &writer, client_key_nonce->data, client_key_nonce->size);
+
+    /* write the ticket to the buffer. */
+    vcblockchain_wire_write_bytes(&writer, ticket->data, ticket->size);
+
+    /* success. */
+    retval = VCBLOCKCHAIN_STATUS_SUCCESS;
+    goto done;
+
+done:
+    return retval;
+}
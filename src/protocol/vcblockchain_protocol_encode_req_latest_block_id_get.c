@@ -6,11 +6,12 @@
  * \copyright 2020 Velo Payments, Inc.  All rights reserved.
  */
 
-#include <arpa/inet.h>
 #include <cbmc/model_assert.h>
 #include <vcblockchain/error_codes.h>
 #include <vcblockchain/protocol/serialization.h>
 
+#include "wire_internal.h"
+
 /**
  * \brief Encode a latest block id get request.
  *
@@ -50,9 +51,10 @@ int vcblockchain_protocol_encode_req_latest_block_id_get(
     }
 
     /* populate the request. */
-    uint32_t* barr = (uint32_t*)buffer->data;
-    barr[0] = htonl(PROTOCOL_REQ_ID_LATEST_BLOCK_ID_GET);
-    barr[1] = htonl(offset);
+    vcblockchain_wire_writer writer;
+    vcblockchain_wire_writer_init(&writer, buffer->data, buffer->size);
+    vcblockchain_wire_write_u32(&writer, PROTOCOL_REQ_ID_LATEST_BLOCK_ID_GET);
+    vcblockchain_wire_write_u32(&writer, offset);
 
     /* success; the caller owns buffer on success. */
     return VCBLOCKCHAIN_STATUS_SUCCESS;
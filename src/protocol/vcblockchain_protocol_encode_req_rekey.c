@@ -0,0 +1,102 @@
+/**
+ * \file protocol/vcblockchain_protocol_encode_req_rekey.c
+ *
+ * \brief Encode a rekey request into a buffer.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/data.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <string.h>
+
+#include "wire_internal.h"
+
+/**
+ * \brief Encode a rekey request using the given parameters.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded request packet.
+ * \param suite                     The crypto suite to use for this request.
+ * \param offset                    The offset for this request.
+ * \param client_switch_iv          The first client IV that uses the new
+ *                                  shared secret.
+ * \param client_key_nonce          The client key nonce for this request.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * request.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the nonce has the wrong size.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_req_rekey(
+    vccrypt_buffer_t* buffer, vccrypt_suite_options_t* suite,
+    uint32_t offset, uint64_t client_switch_iv,
+    const vccrypt_buffer_t* client_key_nonce)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != buffer);
+    MODEL_ASSERT(NULL != suite);
+    MODEL_ASSERT(NULL != client_key_nonce);
+
+    int retval;
+
+    /* verify the nonce size. */
+    if (client_key_nonce->size != suite->key_cipher_opts.minimum_nonce_size)
+    {
+        retval = VCBLOCKCHAIN_ERROR_INVALID_ARG;
+        goto done;
+    }
+
+    /* | Rekey request packet.                                              | */
+    /* | --------------------------------------------------- | ------------ | */
+    /* | DATA                                                | SIZE         | */
+    /* | --------------------------------------------------- | ------------ | */
+    /* | PROTOCOL_REQ_ID_REKEY                               |  4 bytes     | */
+    /* | offset                                              |  4 bytes     | */
+    /* | record:                                             | 40 bytes     | */
+    /* |    client_switch_iv                                 |  8 bytes     | */
+    /* |    client key nonce                                 | 32 bytes     | */
+    /* | --------------------------------------------------- | ------------ | */
+
+    /* compute the size of the request packet. */
+    size_t payload_size =
+          sizeof(uint32_t) /* request_id */
+        + sizeof(uint32_t) /* offset */
+        + sizeof(uint64_t) /* client_switch_iv */
+        + client_key_nonce->size;
+
+    /* create output buffer. */
+    retval = vccrypt_buffer_init(buffer, suite->alloc_opts, payload_size);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* write the request id to the buffer. */
+    vcblockchain_wire_writer writer;
+    vcblockchain_wire_writer_init(&writer, buffer->data, buffer->size);
+    vcblockchain_wire_write_u32(&writer, PROTOCOL_REQ_ID_REKEY);
+
+    /* write the offset to the buffer. */
+    vcblockchain_wire_write_u32(&writer, offset);
+
+    /* write the client switch IV to the buffer. */
+    vcblockchain_wire_write_u64(&writer, client_switch_iv);
+
+    /* write the client key nonce to the buffer. */
+    vcblockchain_wire_write_bytes(
+        &writer, client_key_nonce->data, client_key_nonce->size);
+
+    /* success. */
+    retval = VCBLOCKCHAIN_STATUS_SUCCESS;
+    goto done;
+
+done:
+    return retval;
+}
@@ -6,12 +6,13 @@
  * \copyright 2020 Velo Payments, Inc.  All rights reserved.
  */
 
-#include <arpa/inet.h>
 #include <cbmc/model_assert.h>
 #include <string.h>
 #include <vcblockchain/error_codes.h>
 #include <vcblockchain/protocol/serialization.h>
 
+#include "wire_internal.h"
+
 /**
  * \brief Encode a transaction submit request.
  *
@@ -67,17 +68,17 @@ int vcblockchain_protocol_encode_req_transaction_submit(
     }
 
     /* write the request id and offset. */
-    uint32_t* u32arr = (uint32_t*)buffer->data;
-    u32arr[0] = htonl(PROTOCOL_REQ_ID_TRANSACTION_SUBMIT);
-    u32arr[1] = htonl(offset);
+    vcblockchain_wire_writer writer;
+    vcblockchain_wire_writer_init(&writer, buffer->data, buffer->size);
+    vcblockchain_wire_write_u32(&writer, PROTOCOL_REQ_ID_TRANSACTION_SUBMIT);
+    vcblockchain_wire_write_u32(&writer, offset);
 
     /* copy the ids. */
-    uint8_t* barr = (uint8_t*)(u32arr + 2);
-    memcpy(barr, txn_id, sizeof(*txn_id));
-    memcpy(barr + 16, artifact_id, sizeof(*artifact_id));
+    vcblockchain_wire_write_uuid(&writer, txn_id);
+    vcblockchain_wire_write_uuid(&writer, artifact_id);
 
     /* copy the certificate. */
-    memcpy(barr + 32, cert, cert_size);
+    vcblockchain_wire_write_bytes(&writer, cert, cert_size);
 
     /* success. */
     /* buffer is owned by the caller on success. */
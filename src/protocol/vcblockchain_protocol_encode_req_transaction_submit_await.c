@@ -0,0 +1,91 @@
+/**
+ * \file protocol/vcblockchain_protocol_encode_req_transaction_submit_await.c
+ *
+ * \brief Encode a transaction submit and await request.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+
+#include "wire_internal.h"
+
+/**
+ * \brief Encode a transaction submit and await request.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded request packet.
+ * \param alloc_opts                The allocator to use for this request.
+ * \param offset                    The offset to use for this request.
+ * \param timeout_ms                The maximum time in milliseconds to wait for
+ *                                  this transaction to be canonized, or 0 to
+ *                                  use the agent's default deadline.
+ * \param txn_id                    The id of this transaction.
+ * \param artifact_id               The artifact id of this transaction.
+ * \param cert                      Pointer to the certificate data for this
+ *                                  transaction.
+ * \param cert_size                 The size of this certificate in bytes.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * request.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_req_transaction_submit_await(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, uint32_t timeout_ms, const vpr_uuid* txn_id,
+    const vpr_uuid* artifact_id, const void* cert, size_t cert_size)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != buffer);
+    MODEL_ASSERT(NULL != alloc_opts);
+    MODEL_ASSERT(NULL != txn_id);
+    MODEL_ASSERT(NULL != artifact_id);
+    MODEL_ASSERT(NULL != cert);
+
+    /* runtime parameter checks. */
+    if (NULL == buffer || NULL == alloc_opts || NULL == txn_id
+     || NULL == artifact_id || NULL == cert)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* compute the buffer size. */
+    size_t buffer_size =
+          3 * sizeof(uint32_t) /* request_id, offset, and timeout */
+        + sizeof(*txn_id)
+        + sizeof(*artifact_id)
+        + cert_size;
+
+    /* initialize the buffer. */
+    if (VCCRYPT_STATUS_SUCCESS !=
+        vccrypt_buffer_init(buffer, alloc_opts, buffer_size))
+    {
+        return VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* write the request id, offset, and timeout. */
+    vcblockchain_wire_writer writer;
+    vcblockchain_wire_writer_init(&writer, buffer->data, buffer->size);
+    vcblockchain_wire_write_u32(
+        &writer, PROTOCOL_REQ_ID_TRANSACTION_SUBMIT_AWAIT);
+    vcblockchain_wire_write_u32(&writer, offset);
+    vcblockchain_wire_write_u32(&writer, timeout_ms);
+
+    /* copy the ids. */
+    vcblockchain_wire_write_uuid(&writer, txn_id);
+    vcblockchain_wire_write_uuid(&writer, artifact_id);
+
+    /* copy the certificate. */
+    vcblockchain_wire_write_bytes(&writer, cert, cert_size);
+
+    /* success. */
+    /* buffer is owned by the caller on success. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
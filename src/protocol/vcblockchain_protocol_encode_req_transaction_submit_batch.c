@@ -0,0 +1,111 @@
+/**
+ * \file protocol/vcblockchain_protocol_encode_req_transaction_submit_batch.c
+ *
+ * \brief Encode a transaction submit batch request into a buffer.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/limits.h>
+#include <vcblockchain/protocol/serialization.h>
+
+#include "wire_internal.h"
+
+/**
+ * \brief Encode a transaction submit batch request.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded request packet.
+ * \param alloc_opts                The allocator to use for this request.
+ * \param offset                    The offset to use for this request.
+ * \param txns                      Array of transactions to submit.
+ * \param count                     The number of transactions to submit.
+ *
+ * Each transaction is written as a size-prefixed record holding its
+ * transaction id, artifact id, and certificate. The server answers with a
+ * single response holding the submit status of each transaction, in the same
+ * order.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * request.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the batch is empty, too large, or
+ *        holds a transaction without a certificate.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_req_transaction_submit_batch(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, const protocol_transaction_submit_batch_item* txns,
+    size_t count)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != buffer);
+    MODEL_ASSERT(NULL != alloc_opts);
+    MODEL_ASSERT(NULL != txns);
+
+    /* runtime parameter checks. */
+    if (NULL == buffer || NULL == alloc_opts || NULL == txns
+     || 0 == count || count > VCBLOCKCHAIN_LIMIT_MAXIMUM_BATCH_COUNT)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* compute the buffer size, verifying each transaction. */
+    const size_t record_header_size =
+          sizeof(uint32_t) /* cert size. */
+        + 2 * 16; /* txn_id and artifact_id. */
+    size_t buffer_size =
+          3 * sizeof(uint32_t); /* request_id, offset, and count. */
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (NULL == txns[i].cert
+         || txns[i].cert_size
+                > VCBLOCKCHAIN_LIMIT_MAXIMUM_ENCRYPTED_PACKET_SIZE)
+        {
+            return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+        }
+
+        buffer_size += record_header_size + txns[i].cert_size;
+    }
+
+    /* the batch must fit in a single packet. */
+    if (buffer_size > VCBLOCKCHAIN_LIMIT_MAXIMUM_ENCRYPTED_PACKET_SIZE)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* initialize the buffer. */
+    if (VCCRYPT_STATUS_SUCCESS !=
+        vccrypt_buffer_init(buffer, alloc_opts, buffer_size))
+    {
+        return VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* write the request id, offset, and count. */
+    vcblockchain_wire_writer writer;
+    vcblockchain_wire_writer_init(&writer, buffer->data, buffer->size);
+    vcblockchain_wire_write_u32(
+        &writer, PROTOCOL_REQ_ID_TRANSACTION_SUBMIT_BATCH);
+    vcblockchain_wire_write_u32(&writer, offset);
+    vcblockchain_wire_write_u32(&writer, (uint32_t)count);
+
+    /* write each transaction. */
+    for (size_t i = 0; i < count; ++i)
+    {
+        vcblockchain_wire_write_u32(&writer, (uint32_t)txns[i].cert_size);
+        vcblockchain_wire_write_uuid(&writer, &txns[i].txn_id);
+        vcblockchain_wire_write_uuid(&writer, &txns[i].artifact_id);
+        vcblockchain_wire_write_bytes(
+            &writer, txns[i].cert, txns[i].cert_size);
+    }
+
+    /* success. */
+    /* buffer is owned by the caller on success. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
@@ -0,0 +1,146 @@
+/**
+ * \file
+ * protocol/vcblockchain_protocol_encode_req_transaction_submit_batch_vec.c
+ *
+ * \brief Encode a transaction submit batch request into a segment vector.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/limits.h>
+#include <vcblockchain/protocol/serialization.h>
+
+#include "wire_internal.h"
+
+/**
+ * \brief Encode a transaction submit batch request as a vector of segments
+ * that reference the caller's certificates.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the segment vector and the encoded
+ *                                  record headers.
+ * \param alloc_opts                The allocator to use for this request.
+ * \param offset                    The offset to use for this request.
+ * \param txns                      Array of transactions to submit.
+ * \param count                     The number of transactions to submit.
+ * \param vec                       Pointer to receive the segment vector.
+ * \param vec_count                 Pointer to receive the number of segments.
+ *
+ * This encodes the same request as
+ * \ref vcblockchain_protocol_encode_req_transaction_submit_batch, but without
+ * copying the certificates. Only the request header and the record header for
+ * each transaction are written to \p buffer; the segment vector interleaves
+ * these headers with the certificates in \p txns. The concatenation of every
+ * segment is the encoded request, which can be written with
+ * \ref psock_write_authed_datav.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the segment
+ * vector and the encoded headers, and \p vec points into this buffer. The
+ * caller owns this buffer and must \ref dispose() it when it is no longer
+ * needed. The certificates in \p txns must remain valid for as long as the
+ * segment vector is in use.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the batch is empty, too large, or
+ *        holds a transaction without a certificate.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_req_transaction_submit_batch_vec(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, const protocol_transaction_submit_batch_item* txns,
+    size_t count, const vcblockchain_psock_iovec** vec, size_t* vec_count)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != buffer);
+    MODEL_ASSERT(NULL != alloc_opts);
+    MODEL_ASSERT(NULL != txns);
+    MODEL_ASSERT(NULL != vec);
+    MODEL_ASSERT(NULL != vec_count);
+
+    /* runtime parameter checks. */
+    if (NULL == buffer || NULL == alloc_opts || NULL == txns || NULL == vec
+     || NULL == vec_count || 0 == count
+     || count > VCBLOCKCHAIN_LIMIT_MAXIMUM_BATCH_COUNT)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* compute the encoded size, verifying each transaction. */
+    const size_t request_header_size =
+          3 * sizeof(uint32_t); /* request_id, offset, and count. */
+    const size_t record_header_size =
+          sizeof(uint32_t) /* cert size. */
+        + 2 * 16; /* txn_id and artifact_id. */
+    size_t encoded_size = request_header_size;
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (NULL == txns[i].cert
+         || txns[i].cert_size
+                > VCBLOCKCHAIN_LIMIT_MAXIMUM_ENCRYPTED_PACKET_SIZE)
+        {
+            return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+        }
+
+        encoded_size += record_header_size + txns[i].cert_size;
+    }
+
+    /* the batch must fit in a single packet. */
+    if (encoded_size > VCBLOCKCHAIN_LIMIT_MAXIMUM_ENCRYPTED_PACKET_SIZE)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* each transaction has a header segment and a certificate segment. The
+     * segment vector is followed by the headers in the same buffer. */
+    const size_t segment_count = 2 * count;
+    const size_t vec_size = segment_count * sizeof(vcblockchain_psock_iovec);
+    const size_t headers_size =
+        request_header_size + count * record_header_size;
+
+    /* initialize the buffer. */
+    if (VCCRYPT_STATUS_SUCCESS !=
+        vccrypt_buffer_init(buffer, alloc_opts, vec_size + headers_size))
+    {
+        return VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+    }
+
+    vcblockchain_psock_iovec* segments =
+        (vcblockchain_psock_iovec*)buffer->data;
+    uint8_t* headers = (uint8_t*)buffer->data + vec_size;
+
+    /* write the request id, offset, and count. */
+    vcblockchain_wire_writer writer;
+    vcblockchain_wire_writer_init(&writer, headers, headers_size);
+    vcblockchain_wire_write_u32(
+        &writer, PROTOCOL_REQ_ID_TRANSACTION_SUBMIT_BATCH);
+    vcblockchain_wire_write_u32(&writer, offset);
+    vcblockchain_wire_write_u32(&writer, (uint32_t)count);
+
+    /* write each record header, pointing the next segment at the cert. The
+     * first header segment also holds the request header. */
+    const uint8_t* segment_start = headers;
+    for (size_t i = 0; i < count; ++i)
+    {
+        vcblockchain_wire_write_u32(&writer, (uint32_t)txns[i].cert_size);
+        vcblockchain_wire_write_uuid(&writer, &txns[i].txn_id);
+        vcblockchain_wire_write_uuid(&writer, &txns[i].artifact_id);
+
+        segments[2 * i].data = segment_start;
+        segments[2 * i].size = (size_t)(writer.ptr - segment_start);
+        segments[2 * i + 1].data = txns[i].cert;
+        segments[2 * i + 1].size = txns[i].cert_size;
+
+        segment_start = writer.ptr;
+    }
+
+    /* success. */
+    *vec = segments;
+    *vec_count = segment_count;
+
+    /* buffer is owned by the caller on success. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
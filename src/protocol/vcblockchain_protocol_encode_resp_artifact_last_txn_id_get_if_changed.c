@@ -0,0 +1,85 @@
+/**
+ * \file
+ * protocol/vcblockchain_protocol_encode_resp_artifact_last_txn_id_get_if_changed.c
+ *
+ * \brief Encode a conditional artifact last txn id get response into a buffer.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+
+#include "wire_internal.h"
+
+/**
+ * \brief Encode a conditional artifact last txn id get response using the given
+ * parameters.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded response.
+ * \param alloc_opts                The allocator options to use to allocate the
+ *                                  buffer.
+ * \param offset                    The offset for this response.
+ * \param status                    The status for this response.
+ * \param last_txn_id               The last transaction id, which may be NULL
+ *                                  if it was not modified.
+ *
+ * If the status is \ref VCBLOCKCHAIN_ERROR_PROTOCOL_NOT_MODIFIED, then the
+ * last transaction id is the one sent by the client, so only the response
+ * header is encoded.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * response.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_resp_artifact_last_txn_id_get_if_changed(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, uint32_t status, const vpr_uuid* last_txn_id)
+{
+    bool not_modified = (VCBLOCKCHAIN_ERROR_PROTOCOL_NOT_MODIFIED == status);
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != buffer);
+    MODEL_ASSERT(NULL != alloc_opts);
+    MODEL_ASSERT(NULL != last_txn_id || not_modified);
+
+    /* runtime parameter checks. */
+    if (NULL == buffer || NULL == alloc_opts
+     || (NULL == last_txn_id && !not_modified))
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* create the buffer. */
+    size_t resp_size =
+        3 * sizeof(uint32_t) + (not_modified ? 0U : sizeof(vpr_uuid));
+    if (VCCRYPT_STATUS_SUCCESS !=
+        vccrypt_buffer_init(buffer, alloc_opts, resp_size))
+    {
+        return VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* populate the integer values. */
+    vcblockchain_wire_writer writer;
+    vcblockchain_wire_writer_init(&writer, buffer->data, buffer->size);
+    vcblockchain_wire_write_u32(
+        &writer, PROTOCOL_REQ_ID_ARTIFACT_LAST_TXN_BY_ID_GET_IF_CHANGED);
+    vcblockchain_wire_write_u32(&writer, status);
+    vcblockchain_wire_write_u32(&writer, offset);
+
+    /* populate the last transaction id if it changed. */
+    if (!not_modified)
+    {
+        vcblockchain_wire_write_uuid(&writer, last_txn_id);
+    }
+
+    /* success. */
+    /* On success, the caller owns the buffer and must dispose it. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
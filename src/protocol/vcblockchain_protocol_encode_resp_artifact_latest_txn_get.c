@@ -0,0 +1,81 @@
+/**
+ * \file protocol/vcblockchain_protocol_encode_resp_artifact_latest_txn_get.c
+ *
+ * \brief Encode an artifact latest txn get response into a buffer.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+
+#include "wire_internal.h"
+
+/**
+ * \brief Encode an artifact latest transaction get response using the given
+ * parameters.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded response.
+ * \param alloc_opts                The allocator options to use to allocate the
+ *                                  buffer.
+ * \param offset                    The offset for this response.
+ * \param status                    The status for this response.
+ * \param txn_id                    The latest transaction id.
+ * \param prev_txn_id               The previous transaction id.
+ * \param next_txn_id               The next transaction id.
+ * \param artifact_id               The artifact id for this transaction.
+ * \param block_id                  The block id for this transaction.
+ * \param ser_txn_cert_size         The serialized transaction cert size.
+ * \param txn_cert                  Pointer to the start of the transaction
+ *                                  certificate.
+ * \param txn_cert_size             The transaction cert size.
+ * \param txn_state                 The transaction state.
+ *
+ * This response has the same layout as a transaction get response, apart from
+ * its request id.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * response.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_resp_artifact_latest_txn_get(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, uint32_t status, const vpr_uuid* txn_id,
+    const vpr_uuid* prev_txn_id, const vpr_uuid* next_txn_id,
+    const vpr_uuid* artifact_id, const vpr_uuid* block_id,
+    uint64_t ser_txn_cert_size, const void* txn_cert, size_t txn_cert_size,
+    uint32_t txn_state)
+{
+    int retval;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != buffer);
+
+    /* encode this response as a transaction get response. */
+    retval =
+        vcblockchain_protocol_encode_resp_txn_get(
+            buffer, alloc_opts, offset, status, txn_id, prev_txn_id,
+            next_txn_id, artifact_id, block_id, ser_txn_cert_size, txn_cert,
+            txn_cert_size, txn_state);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* overwrite the request id. */
+    vcblockchain_wire_writer writer;
+    vcblockchain_wire_writer_init(&writer, buffer->data, buffer->size);
+    vcblockchain_wire_write_u32(
+        &writer, PROTOCOL_REQ_ID_ARTIFACT_LATEST_TXN_GET);
+
+    /* success. */
+    /* On success, the caller owns the buffer and must dispose it. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
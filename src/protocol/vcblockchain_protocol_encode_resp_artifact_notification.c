@@ -0,0 +1,91 @@
+/**
+ * \file protocol/vcblockchain_protocol_encode_resp_artifact_notification.c
+ *
+ * \brief Encode an artifact notification.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+
+#include "wire_internal.h"
+
+/**
+ * \brief Encode an artifact notification for an artifact subscription.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded notification.
+ * \param alloc_opts                The allocator options to use to allocate the
+ *                                  buffer.
+ * \param offset                    The offset of the artifact subscription
+ *                                  request.
+ * \param artifact_id               The artifact id.
+ * \param txn_id                    The canonized transaction id.
+ * \param block_id                  The block id for the block in which this
+ *                                  transaction was canonized.
+ * \param txn_state                 The transaction state.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * notification.  The caller owns this buffer and must \ref dispose() it when it
+ * is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_resp_artifact_notification(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, const vpr_uuid* artifact_id, const vpr_uuid* txn_id,
+    const vpr_uuid* block_id, uint32_t txn_state)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != buffer);
+    MODEL_ASSERT(NULL != alloc_opts);
+    MODEL_ASSERT(NULL != artifact_id);
+    MODEL_ASSERT(NULL != txn_id);
+    MODEL_ASSERT(NULL != block_id);
+
+    /* runtime parameter checks. */
+    if (NULL == buffer || NULL == alloc_opts || NULL == artifact_id
+     || NULL == txn_id || NULL == block_id)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* compute the buffer size. */
+    size_t resp_size =
+          3 * sizeof(uint32_t) /* request_id, offset, and status. */
+        + sizeof(*artifact_id)
+        + sizeof(*txn_id)
+        + sizeof(*block_id)
+        + sizeof(txn_state);
+
+    /* create the buffer. */
+    if (VCCRYPT_STATUS_SUCCESS !=
+        vccrypt_buffer_init(buffer, alloc_opts, resp_size))
+    {
+        return VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* populate the integer values. */
+    vcblockchain_wire_writer writer;
+    vcblockchain_wire_writer_init(&writer, buffer->data, buffer->size);
+    vcblockchain_wire_write_u32(&writer, PROTOCOL_REQ_ID_ARTIFACT_NOTIFICATION);
+    vcblockchain_wire_write_u32(&writer, VCBLOCKCHAIN_STATUS_SUCCESS);
+    vcblockchain_wire_write_u32(&writer, offset);
+
+    /* populate the uuid values. */
+    vcblockchain_wire_write_uuid(&writer, artifact_id);
+    vcblockchain_wire_write_uuid(&writer, txn_id);
+    vcblockchain_wire_write_uuid(&writer, block_id);
+
+    /* populate the transaction state. */
+    vcblockchain_wire_write_u32(&writer, txn_state);
+
+    /* success. */
+    /* On success, the caller owns the buffer and must dispose it. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
@@ -0,0 +1,130 @@
+/**
+ * \file protocol/vcblockchain_protocol_encode_resp_artifact_txn_page_get.c
+ *
+ * \brief Encode an artifact transaction page get response into a buffer.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/limits.h>
+#include <vcblockchain/protocol/serialization.h>
+
+#include "wire_internal.h"
+
+/**
+ * \brief Encode an artifact transaction page get response using the given
+ * parameters.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded response.
+ * \param alloc_opts                The allocator options to use to allocate the
+ *                                  buffer.
+ * \param offset                    The offset for this response.
+ * \param status                    The status for this response.
+ * \param flags                     The \ref protocol_txn_page_flag values for
+ *                                  this response.
+ * \param next_cursor               The cursor to use to request the next page,
+ *                                  which is the id of the last transaction in
+ *                                  this page.
+ * \param records                   Array of transactions in this page.
+ * \param count                     The number of transactions in this page.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * response.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the page doesn't fit in a single
+ *        packet.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_resp_artifact_txn_page_get(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, uint32_t status, uint32_t flags,
+    const vpr_uuid* next_cursor,
+    const protocol_txn_page_record* records, size_t count)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != buffer);
+    MODEL_ASSERT(NULL != alloc_opts);
+    MODEL_ASSERT(NULL != next_cursor);
+    MODEL_ASSERT(0 == count || NULL != records);
+
+    /* runtime parameter checks. */
+    if (NULL == buffer || NULL == alloc_opts || NULL == next_cursor
+     || (count > 0 && NULL == records) || count > UINT32_MAX)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* compute the buffer size. */
+    const size_t record_header_size =
+          5 * 16 /* txn, prev, next, artifact, and block ids. */
+        + sizeof(uint64_t) /* serialized cert size. */
+        + sizeof(uint32_t); /* transaction state. */
+    size_t resp_size =
+          4 * sizeof(uint32_t) /* request_id, status, offset, and flags. */
+        + sizeof(*next_cursor)
+        + sizeof(uint32_t); /* count. */
+    for (size_t i = 0; i < count; ++i)
+    {
+        if ((NULL == records[i].txn_cert && 0 != records[i].txn_cert_size)
+         || records[i].txn_cert_size
+                > VCBLOCKCHAIN_LIMIT_MAXIMUM_ENCRYPTED_PACKET_SIZE)
+        {
+            return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+        }
+
+        resp_size +=
+            sizeof(uint32_t) + record_header_size + records[i].txn_cert_size;
+    }
+
+    /* the page must fit in a single packet. */
+    if (resp_size > VCBLOCKCHAIN_LIMIT_MAXIMUM_ENCRYPTED_PACKET_SIZE)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* create the buffer. */
+    if (VCCRYPT_STATUS_SUCCESS !=
+        vccrypt_buffer_init(buffer, alloc_opts, resp_size))
+    {
+        return VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* populate the header. */
+    vcblockchain_wire_writer writer;
+    vcblockchain_wire_writer_init(&writer, buffer->data, buffer->size);
+    vcblockchain_wire_write_u32(
+        &writer, PROTOCOL_REQ_ID_ARTIFACT_TXN_PAGE_GET);
+    vcblockchain_wire_write_u32(&writer, status);
+    vcblockchain_wire_write_u32(&writer, offset);
+    vcblockchain_wire_write_u32(&writer, flags);
+    vcblockchain_wire_write_uuid(&writer, next_cursor);
+    vcblockchain_wire_write_u32(&writer, (uint32_t)count);
+
+    /* populate each size-prefixed transaction. */
+    for (size_t i = 0; i < count; ++i)
+    {
+        vcblockchain_wire_write_u32(
+            &writer,
+            (uint32_t)(record_header_size + records[i].txn_cert_size));
+        vcblockchain_wire_write_uuid(&writer, &records[i].txn_id);
+        vcblockchain_wire_write_uuid(&writer, &records[i].prev_txn_id);
+        vcblockchain_wire_write_uuid(&writer, &records[i].next_txn_id);
+        vcblockchain_wire_write_uuid(&writer, &records[i].artifact_id);
+        vcblockchain_wire_write_uuid(&writer, &records[i].block_id);
+        vcblockchain_wire_write_u64(&writer, records[i].txn_size);
+        vcblockchain_wire_write_u32(&writer, records[i].txn_state);
+        vcblockchain_wire_write_bytes(
+            &writer, records[i].txn_cert, records[i].txn_cert_size);
+    }
+
+    /* success. */
+    /* On success, the caller owns the buffer and must dispose it. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
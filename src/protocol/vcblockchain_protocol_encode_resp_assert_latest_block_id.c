@@ -6,12 +6,13 @@
  * \copyright 2022 Velo Payments, Inc.  All rights reserved.
  */
 
-#include <arpa/inet.h>
 #include <cbmc/model_assert.h>
 #include <string.h>
 #include <vcblockchain/error_codes.h>
 #include <vcblockchain/protocol/serialization.h>
 
+#include "wire_internal.h"
+
 /**
  * \brief Encode a latest block id assertion response.
  *
@@ -53,10 +54,12 @@ int vcblockchain_protocol_encode_resp_assert_latest_block_id(
     }
 
     /* populate the integer values. */
-    uint32_t* uarr = (uint32_t*)buffer->data;
-    uarr[0] = htonl(PROTOCOL_REQ_ID_ASSERT_LATEST_BLOCK_ID);
-    uarr[1] = htonl(status);
-    uarr[2] = htonl(offset);
+    vcblockchain_wire_writer writer;
+    vcblockchain_wire_writer_init(&writer, buffer->data, buffer->size);
+    vcblockchain_wire_write_u32(
+        &writer, PROTOCOL_REQ_ID_ASSERT_LATEST_BLOCK_ID);
+    vcblockchain_wire_write_u32(&writer, status);
+    vcblockchain_wire_write_u32(&writer, offset);
 
     /* success. */
     /* On success, the caller owns the buffer and must dispose it. */
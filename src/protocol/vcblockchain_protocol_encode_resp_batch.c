@@ -0,0 +1,114 @@
+/**
+ * \file protocol/vcblockchain_protocol_encode_resp_batch.c
+ *
+ * \brief Encode a batch response into a buffer.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/limits.h>
+#include <vcblockchain/protocol/serialization.h>
+
+#include "wire_internal.h"
+
+/**
+ * \brief Encode a batch response using the given parameters.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded response.
+ * \param alloc_opts                The allocator options to use to allocate the
+ *                                  buffer.
+ * \param offset                    The offset of the batch request.
+ * \param status                    The status of the batch as a whole.
+ * \param statuses                  Array of statuses, one per request in the
+ *                                  batch.
+ * \param responses                 Array of encoded responses, one per request
+ *                                  in the batch. A response may be empty.
+ * \param count                     The number of responses in the batch.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * response.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the batch is too large.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_resp_batch(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, uint32_t status, const uint32_t* statuses,
+    const vccrypt_buffer_t* responses, size_t count)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != buffer);
+    MODEL_ASSERT(NULL != alloc_opts);
+    MODEL_ASSERT(0 == count || NULL != statuses);
+    MODEL_ASSERT(0 == count || NULL != responses);
+
+    /* runtime parameter checks. */
+    if (NULL == buffer || NULL == alloc_opts
+     || (count > 0 && (NULL == statuses || NULL == responses))
+     || count > VCBLOCKCHAIN_LIMIT_MAXIMUM_BATCH_COUNT)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* compute the buffer size. */
+    size_t resp_size =
+          4 * sizeof(uint32_t) /* request_id, status, offset, and count. */
+        + count * sizeof(uint32_t); /* status vector. */
+    for (size_t i = 0; i < count; ++i)
+    {
+        if ((NULL == responses[i].data && 0 != responses[i].size)
+         || responses[i].size
+                > VCBLOCKCHAIN_LIMIT_MAXIMUM_ENCRYPTED_PACKET_SIZE)
+        {
+            return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+        }
+
+        resp_size += sizeof(uint32_t) + responses[i].size;
+    }
+
+    /* the batch must fit in a single packet. */
+    if (resp_size > VCBLOCKCHAIN_LIMIT_MAXIMUM_ENCRYPTED_PACKET_SIZE)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* create the buffer. */
+    if (VCCRYPT_STATUS_SUCCESS !=
+        vccrypt_buffer_init(buffer, alloc_opts, resp_size))
+    {
+        return VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* populate the header. */
+    vcblockchain_wire_writer writer;
+    vcblockchain_wire_writer_init(&writer, buffer->data, buffer->size);
+    vcblockchain_wire_write_u32(&writer, PROTOCOL_REQ_ID_BATCH);
+    vcblockchain_wire_write_u32(&writer, status);
+    vcblockchain_wire_write_u32(&writer, offset);
+    vcblockchain_wire_write_u32(&writer, (uint32_t)count);
+
+    /* populate the status vector. */
+    for (size_t i = 0; i < count; ++i)
+    {
+        vcblockchain_wire_write_u32(&writer, statuses[i]);
+    }
+
+    /* populate each size-prefixed response. */
+    for (size_t i = 0; i < count; ++i)
+    {
+        vcblockchain_wire_write_u32(&writer, (uint32_t)responses[i].size);
+        vcblockchain_wire_write_bytes(
+            &writer, responses[i].data, responses[i].size);
+    }
+
+    /* success. */
+    /* On success, the caller owns the buffer and must dispose it. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
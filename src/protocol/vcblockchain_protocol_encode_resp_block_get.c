@@ -6,13 +6,13 @@
  * \copyright 2020 Velo Payments, Inc.  All rights reserved.
  */
 
-#include <arpa/inet.h>
 #include <cbmc/model_assert.h>
 #include <string.h>
-#include <vcblockchain/byteswap.h>
 #include <vcblockchain/error_codes.h>
 #include <vcblockchain/protocol/serialization.h>
 
+#include "wire_internal.h"
+
 /**
  * \brief Encode a block get response using the given parameters.
  *
@@ -84,28 +84,26 @@ int vcblockchain_protocol_encode_resp_block_get(
     }
 
     /* populate the integer values. */
-    uint32_t* uarr = (uint32_t*)buffer->data;
-    uarr[0] = htonl(PROTOCOL_REQ_ID_BLOCK_BY_ID_GET);
-    uarr[1] = htonl(status);
-    uarr[2] = htonl(offset);
+    vcblockchain_wire_writer writer;
+    vcblockchain_wire_writer_init(&writer, buffer->data, buffer->size);
+    vcblockchain_wire_write_u32(&writer, PROTOCOL_REQ_ID_BLOCK_BY_ID_GET);
+    vcblockchain_wire_write_u32(&writer, status);
+    vcblockchain_wire_write_u32(&writer, offset);
 
     /* populate the uuid values. */
-    uint8_t* barr = (uint8_t*)(uarr + 3);
-    memcpy(barr,        block_id, 16);
-    memcpy(barr + 16,   prev_block_id, 16);
-    memcpy(barr + 32,   next_block_id, 16);
-    memcpy(barr + 48,   first_txn_id, 16);
+    vcblockchain_wire_write_uuid(&writer, block_id);
+    vcblockchain_wire_write_uuid(&writer, prev_block_id);
+    vcblockchain_wire_write_uuid(&writer, next_block_id);
+    vcblockchain_wire_write_uuid(&writer, first_txn_id);
 
     /* populate the block height. */
-    uint64_t net_block_height = htonll(block_height);
-    memcpy(barr + 64,   &net_block_height, 8);
+    vcblockchain_wire_write_u64(&writer, block_height);
 
     /* populate the serialized block cert size. */
-    uint64_t net_ser_block_size = htonll(ser_block_cert_size);
-    memcpy(barr + 72,   &net_ser_block_size, 8);
+    vcblockchain_wire_write_u64(&writer, ser_block_cert_size);
 
     /* populate the block certificate. */
-    memcpy(barr + 80, block_cert, block_cert_size);
+    vcblockchain_wire_write_bytes(&writer, block_cert, block_cert_size);
 
     /* success. */
     /* On success, the caller owns the buffer and must dispose it. */
@@ -0,0 +1,142 @@
+/**
+ * \file protocol/vcblockchain_protocol_encode_resp_block_get_fields.c
+ *
+ * \brief Encode a block get fields response into a buffer.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+
+#include "wire_internal.h"
+
+/**
+ * \brief Encode a block get fields response using the given parameters.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded response.
+ * \param alloc_opts                The allocator options to use to allocate the
+ *                                  buffer.
+ * \param offset                    The offset for this response.
+ * \param status                    The status for this response.
+ * \param field_mask                The \ref protocol_block_field values to
+ *                                  encode.
+ * \param block_id                  The block id.
+ * \param prev_block_id             The previous block id.
+ * \param next_block_id             The next block id.
+ * \param first_txn_id              The first transaction id in this block.
+ * \param block_height              The block height.
+ * \param block_cert                Pointer to the start of the block
+ *                                  certificate.
+ * \param block_cert_size           The block cert size.
+ *
+ * Only the fields in \p field_mask are encoded; the pointers for the remaining
+ * fields may be NULL.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * response.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the field mask has unknown bits or
+ *        a requested field is NULL.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_resp_block_get_fields(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, uint32_t status, uint32_t field_mask,
+    const vpr_uuid* block_id, const vpr_uuid* prev_block_id,
+    const vpr_uuid* next_block_id, const vpr_uuid* first_txn_id,
+    uint64_t block_height, const void* block_cert, size_t block_cert_size)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != buffer);
+    MODEL_ASSERT(NULL != alloc_opts);
+    MODEL_ASSERT(NULL != block_id);
+
+    /* runtime parameter checks. */
+    if (NULL == buffer || NULL == alloc_opts || NULL == block_id
+     || 0 != (field_mask & ~PROTOCOL_BLOCK_FIELD_ALL))
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* every requested field must be provided. */
+    if (((field_mask & PROTOCOL_BLOCK_FIELD_PREV_BLOCK_ID)
+            && NULL == prev_block_id)
+     || ((field_mask & PROTOCOL_BLOCK_FIELD_NEXT_BLOCK_ID)
+            && NULL == next_block_id)
+     || ((field_mask & PROTOCOL_BLOCK_FIELD_FIRST_TXN_ID)
+            && NULL == first_txn_id)
+     || ((field_mask & PROTOCOL_BLOCK_FIELD_BLOCK_CERT) && NULL == block_cert))
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* compute the buffer size. */
+    size_t resp_size =
+          3 * sizeof(uint32_t) /* request_id, offset, and status. */
+        + sizeof(field_mask)
+        + sizeof(*block_id)
+        + ((field_mask & PROTOCOL_BLOCK_FIELD_PREV_BLOCK_ID) ? 16 : 0)
+        + ((field_mask & PROTOCOL_BLOCK_FIELD_NEXT_BLOCK_ID) ? 16 : 0)
+        + ((field_mask & PROTOCOL_BLOCK_FIELD_FIRST_TXN_ID) ? 16 : 0)
+        + ((field_mask & PROTOCOL_BLOCK_FIELD_BLOCK_HEIGHT)
+                ? sizeof(block_height) : 0)
+        + ((field_mask & PROTOCOL_BLOCK_FIELD_BLOCK_CERT)
+                ? block_cert_size : 0);
+
+    /* create the buffer. */
+    if (VCCRYPT_STATUS_SUCCESS !=
+        vccrypt_buffer_init(buffer, alloc_opts, resp_size))
+    {
+        return VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* populate the header and field mask. */
+    vcblockchain_wire_writer writer;
+    vcblockchain_wire_writer_init(&writer, buffer->data, buffer->size);
+    vcblockchain_wire_write_u32(
+        &writer, PROTOCOL_REQ_ID_BLOCK_BY_ID_GET_FIELDS);
+    vcblockchain_wire_write_u32(&writer, status);
+    vcblockchain_wire_write_u32(&writer, offset);
+    vcblockchain_wire_write_u32(&writer, field_mask);
+
+    /* populate the block id. */
+    vcblockchain_wire_write_uuid(&writer, block_id);
+
+    /* populate the requested fields in mask order. */
+    if (field_mask & PROTOCOL_BLOCK_FIELD_PREV_BLOCK_ID)
+    {
+        vcblockchain_wire_write_uuid(&writer, prev_block_id);
+    }
+
+    if (field_mask & PROTOCOL_BLOCK_FIELD_NEXT_BLOCK_ID)
+    {
+        vcblockchain_wire_write_uuid(&writer, next_block_id);
+    }
+
+    if (field_mask & PROTOCOL_BLOCK_FIELD_FIRST_TXN_ID)
+    {
+        vcblockchain_wire_write_uuid(&writer, first_txn_id);
+    }
+
+    if (field_mask & PROTOCOL_BLOCK_FIELD_BLOCK_HEIGHT)
+    {
+        vcblockchain_wire_write_u64(&writer, block_height);
+    }
+
+    /* the block certificate, if requested, fills the rest. */
+    if (field_mask & PROTOCOL_BLOCK_FIELD_BLOCK_CERT)
+    {
+        vcblockchain_wire_write_bytes(&writer, block_cert, block_cert_size);
+    }
+
+    /* success. */
+    /* On success, the caller owns the buffer and must dispose it. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
@@ -6,12 +6,13 @@
  * \copyright 2021 Velo Payments, Inc.  All rights reserved.
  */
 
-#include <arpa/inet.h>
 #include <cbmc/model_assert.h>
 #include <string.h>
 #include <vcblockchain/error_codes.h>
 #include <vcblockchain/protocol/serialization.h>
 
+#include "wire_internal.h"
+
 /**
  * \brief Encode a block id by height get response using the given parameters.
  *
@@ -55,11 +56,13 @@ int vcblockchain_protocol_encode_resp_block_id_by_height_get(
     }
 
     /* populate the integer values. */
-    uint32_t* uarr = (uint32_t*)buffer->data;
-    uarr[0] = htonl(PROTOCOL_REQ_ID_BLOCK_ID_BY_HEIGHT_GET);
-    uarr[1] = htonl(status);
-    uarr[2] = htonl(offset);
-    memcpy(&(uarr[3]), block_id, sizeof(vpr_uuid));
+    vcblockchain_wire_writer writer;
+    vcblockchain_wire_writer_init(&writer, buffer->data, buffer->size);
+    vcblockchain_wire_write_u32(
+        &writer, PROTOCOL_REQ_ID_BLOCK_ID_BY_HEIGHT_GET);
+    vcblockchain_wire_write_u32(&writer, status);
+    vcblockchain_wire_write_u32(&writer, offset);
+    vcblockchain_wire_write_uuid(&writer, block_id);
 
     /* success. */
     /* On success, the caller owns the buffer and must dispose it. */
@@ -0,0 +1,95 @@
+/**
+ * \file protocol/vcblockchain_protocol_encode_resp_block_notification.c
+ *
+ * \brief Encode a block notification.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+
+#include "wire_internal.h"
+
+/**
+ * \brief Encode a block notification for a block subscription.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded notification.
+ * \param alloc_opts                The allocator options to use to allocate the
+ *                                  buffer.
+ * \param offset                    The offset of the block subscription
+ *                                  request.
+ * \param block_id                  The block id.
+ * \param prev_block_id             The previous block id.
+ * \param block_height              The block height.
+ * \param block_cert                Pointer to the start of the block
+ *                                  certificate, or NULL if the subscriber did
+ *                                  not request certificates.
+ * \param block_cert_size           The block cert size.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * notification.  The caller owns this buffer and must \ref dispose() it when it
+ * is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_resp_block_notification(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, const vpr_uuid* block_id, const vpr_uuid* prev_block_id,
+    uint64_t block_height, const void* block_cert, size_t block_cert_size)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != buffer);
+    MODEL_ASSERT(NULL != alloc_opts);
+    MODEL_ASSERT(NULL != block_id);
+    MODEL_ASSERT(NULL != prev_block_id);
+    MODEL_ASSERT(NULL != block_cert || 0U == block_cert_size);
+
+    /* runtime parameter checks. */
+    if (NULL == buffer || NULL == alloc_opts || NULL == block_id
+     || NULL == prev_block_id || (NULL == block_cert && 0U != block_cert_size))
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* compute the buffer size. */
+    size_t resp_size =
+          3 * sizeof(uint32_t) /* request_id, offset, and status. */
+        + sizeof(*block_id)
+        + sizeof(*prev_block_id)
+        + sizeof(block_height)
+        + block_cert_size;
+
+    /* create the buffer. */
+    if (VCCRYPT_STATUS_SUCCESS !=
+        vccrypt_buffer_init(buffer, alloc_opts, resp_size))
+    {
+        return VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* populate the integer values. */
+    vcblockchain_wire_writer writer;
+    vcblockchain_wire_writer_init(&writer, buffer->data, buffer->size);
+    vcblockchain_wire_write_u32(&writer, PROTOCOL_REQ_ID_BLOCK_NOTIFICATION);
+    vcblockchain_wire_write_u32(&writer, VCBLOCKCHAIN_STATUS_SUCCESS);
+    vcblockchain_wire_write_u32(&writer, offset);
+
+    /* populate the uuid values. */
+    vcblockchain_wire_write_uuid(&writer, block_id);
+    vcblockchain_wire_write_uuid(&writer, prev_block_id);
+
+    /* populate the block height. */
+    vcblockchain_wire_write_u64(&writer, block_height);
+
+    /* populate the block certificate. */
+    vcblockchain_wire_write_bytes(&writer, block_cert, block_cert_size);
+
+    /* success. */
+    /* On success, the caller owns the buffer and must dispose it. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
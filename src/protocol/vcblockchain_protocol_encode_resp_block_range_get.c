@@ -0,0 +1,123 @@
+/**
+ * \file protocol/vcblockchain_protocol_encode_resp_block_range_get.c
+ *
+ * \brief Encode a block range get response into a buffer.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/limits.h>
+#include <vcblockchain/protocol/serialization.h>
+
+#include "wire_internal.h"
+
+/**
+ * \brief Encode a block range get response using the given parameters.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded response.
+ * \param alloc_opts                The allocator options to use to allocate the
+ *                                  buffer.
+ * \param offset                    The offset for this response.
+ * \param status                    The status for this response.
+ * \param flags                     The \ref protocol_block_range_flag values
+ *                                  for this response.
+ * \param next_height               The height of the block following the last
+ *                                  block in this response.
+ * \param records                   Array of consecutive blocks to return.
+ * \param count                     The number of blocks to return.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * response.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the blocks don't fit in a single
+ *        packet.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_resp_block_range_get(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, uint32_t status, uint32_t flags, uint64_t next_height,
+    const protocol_block_range_record* records, size_t count)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != buffer);
+    MODEL_ASSERT(NULL != alloc_opts);
+    MODEL_ASSERT(0 == count || NULL != records);
+
+    /* runtime parameter checks. */
+    if (NULL == buffer || NULL == alloc_opts
+     || (count > 0 && NULL == records) || count > UINT32_MAX)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* compute the buffer size. */
+    const size_t record_header_size =
+          4 * 16 /* block_id, prev_block_id, next_block_id, first_txn_id. */
+        + 2 * sizeof(uint64_t); /* block height and serialized cert size. */
+    size_t resp_size =
+          4 * sizeof(uint32_t) /* request_id, status, offset, and flags. */
+        + sizeof(next_height)
+        + sizeof(uint32_t); /* count. */
+    for (size_t i = 0; i < count; ++i)
+    {
+        if ((NULL == records[i].block_cert && 0 != records[i].block_cert_size)
+         || records[i].block_cert_size
+                > VCBLOCKCHAIN_LIMIT_MAXIMUM_ENCRYPTED_PACKET_SIZE)
+        {
+            return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+        }
+
+        resp_size +=
+            sizeof(uint32_t) + record_header_size + records[i].block_cert_size;
+    }
+
+    /* the blocks must fit in a single packet. */
+    if (resp_size > VCBLOCKCHAIN_LIMIT_MAXIMUM_ENCRYPTED_PACKET_SIZE)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* create the buffer. */
+    if (VCCRYPT_STATUS_SUCCESS !=
+        vccrypt_buffer_init(buffer, alloc_opts, resp_size))
+    {
+        return VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* populate the header. */
+    vcblockchain_wire_writer writer;
+    vcblockchain_wire_writer_init(&writer, buffer->data, buffer->size);
+    vcblockchain_wire_write_u32(&writer, PROTOCOL_REQ_ID_BLOCK_RANGE_GET);
+    vcblockchain_wire_write_u32(&writer, status);
+    vcblockchain_wire_write_u32(&writer, offset);
+    vcblockchain_wire_write_u32(&writer, flags);
+    vcblockchain_wire_write_u64(&writer, next_height);
+    vcblockchain_wire_write_u32(&writer, (uint32_t)count);
+
+    /* populate each size-prefixed block. */
+    for (size_t i = 0; i < count; ++i)
+    {
+        vcblockchain_wire_write_u32(
+            &writer,
+            (uint32_t)(record_header_size + records[i].block_cert_size));
+        vcblockchain_wire_write_uuid(&writer, &records[i].block_id);
+        vcblockchain_wire_write_uuid(&writer, &records[i].prev_block_id);
+        vcblockchain_wire_write_uuid(&writer, &records[i].next_block_id);
+        vcblockchain_wire_write_uuid(&writer, &records[i].first_txn_id);
+        vcblockchain_wire_write_u64(&writer, records[i].block_height);
+        vcblockchain_wire_write_u64(&writer, records[i].block_size);
+        vcblockchain_wire_write_bytes(
+            &writer, records[i].block_cert, records[i].block_cert_size);
+    }
+
+    /* success. */
+    /* On success, the caller owns the buffer and must dispose it. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
@@ -0,0 +1,109 @@
+/**
+ * \file protocol/vcblockchain_protocol_encode_resp_block_txn_ids_get.c
+ *
+ * \brief Encode a block transaction ids get response into a buffer.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/limits.h>
+#include <vcblockchain/protocol/serialization.h>
+
+#include "wire_internal.h"
+
+/**
+ * \brief Encode a block transaction ids get response using the given
+ * parameters.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded response.
+ * \param alloc_opts                The allocator options to use to allocate the
+ *                                  buffer.
+ * \param offset                    The offset for this response.
+ * \param status                    The status for this response.
+ * \param txn_ids                   Array of transaction ids, in block order.
+ * \param txn_states                Array of transaction states, in block order,
+ *                                  or NULL to omit transaction states.
+ * \param count                     The number of transactions in the block.
+ *
+ * The transaction ids are packed back to back, followed by the transaction
+ * states if \p txn_states is not NULL.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * response.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the transaction ids don't fit in a
+ *        single packet.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_resp_block_txn_ids_get(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, uint32_t status, const vpr_uuid* txn_ids,
+    const uint32_t* txn_states, size_t count)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != buffer);
+    MODEL_ASSERT(NULL != alloc_opts);
+    MODEL_ASSERT(0 == count || NULL != txn_ids);
+
+    /* runtime parameter checks. */
+    if (NULL == buffer || NULL == alloc_opts
+     || (count > 0 && NULL == txn_ids))
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* compute the buffer size. */
+    const size_t header_size =
+          5 * sizeof(uint32_t); /* id, status, offset, include_states, count */
+    const size_t entry_size =
+        sizeof(vpr_uuid) + (NULL != txn_states ? sizeof(uint32_t) : 0);
+
+    /* the transaction ids must fit in a single packet. */
+    if (count >
+            (VCBLOCKCHAIN_LIMIT_MAXIMUM_ENCRYPTED_PACKET_SIZE - header_size)
+                / entry_size)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    size_t resp_size = header_size + count * entry_size;
+
+    /* create the buffer. */
+    if (VCCRYPT_STATUS_SUCCESS !=
+        vccrypt_buffer_init(buffer, alloc_opts, resp_size))
+    {
+        return VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* populate the header. */
+    vcblockchain_wire_writer writer;
+    vcblockchain_wire_writer_init(&writer, buffer->data, buffer->size);
+    vcblockchain_wire_write_u32(&writer, PROTOCOL_REQ_ID_BLOCK_TXN_IDS_GET);
+    vcblockchain_wire_write_u32(&writer, status);
+    vcblockchain_wire_write_u32(&writer, offset);
+    vcblockchain_wire_write_u32(&writer, NULL != txn_states ? 1U : 0U);
+    vcblockchain_wire_write_u32(&writer, (uint32_t)count);
+
+    /* populate the packed transaction ids. */
+    vcblockchain_wire_write_bytes(&writer, txn_ids, count * sizeof(vpr_uuid));
+
+    /* populate the transaction states, if requested. */
+    if (NULL != txn_states)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            vcblockchain_wire_write_u32(&writer, txn_states[i]);
+        }
+    }
+
+    /* success. */
+    /* On success, the caller owns the buffer and must dispose it. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
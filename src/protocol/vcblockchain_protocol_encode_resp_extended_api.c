@@ -7,12 +7,13 @@
  * \copyright 2022 Velo Payments, Inc.  All rights reserved.
  */
 
-#include <arpa/inet.h>
 #include <cbmc/model_assert.h>
 #include <string.h>
 #include <vcblockchain/error_codes.h>
 #include <vcblockchain/protocol/serialization.h>
 
+#include "wire_internal.h"
+
 /**
  * \brief Encode an extended API response.
  *
@@ -56,13 +57,15 @@ int vcblockchain_protocol_encode_resp_extended_api(
     }
 
     /* populate the integer values. */
-    uint32_t* uarr = (uint32_t*)buffer->data;
-    uarr[0] = htonl(PROTOCOL_REQ_ID_EXTENDED_API_SENDRECV);
-    uarr[1] = htonl(status);
-    uarr[2] = htonl(offset);
+    vcblockchain_wire_writer writer;
+    vcblockchain_wire_writer_init(&writer, buffer->data, buffer->size);
+    vcblockchain_wire_write_u32(&writer, PROTOCOL_REQ_ID_EXTENDED_API_SENDRECV);
+    vcblockchain_wire_write_u32(&writer, status);
+    vcblockchain_wire_write_u32(&writer, offset);
 
     /* copy the response body. */
-    memcpy(uarr + 3, response_body->data, response_body->size);
+    vcblockchain_wire_write_bytes(
+        &writer, response_body->data, response_body->size);
 
     /* success. */
     /* On success, the caller owns the buffer and must dispose it. */
@@ -7,13 +7,13 @@
  * \copyright 2022 Velo Payments, Inc.  All rights reserved.
  */
 
-#include <arpa/inet.h>
 #include <cbmc/model_assert.h>
 #include <string.h>
-#include <vcblockchain/byteswap.h>
 #include <vcblockchain/error_codes.h>
 #include <vcblockchain/protocol/serialization.h>
 
+#include "wire_internal.h"
+
 /**
  * \brief Encode an extended API client request response.
  *
@@ -76,48 +76,40 @@ int vcblockchain_protocol_encode_resp_extended_api_client_request(
         return VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
     }
 
-    /* work with a byte array for convenience. */
-    uint8_t* barr = (uint8_t*)buffer->data;
+    /* work with a write cursor for convenience. */
+    vcblockchain_wire_writer writer;
+    vcblockchain_wire_writer_init(&writer, buffer->data, buffer->size);
 
     /* populate the request id. */
-    uint32_t net_method_id = htonl(PROTOCOL_REQ_ID_EXTENDED_API_CLIENTREQ);
-    memcpy(barr, &net_method_id, sizeof(net_method_id));
-    barr += sizeof(net_method_id);
+    vcblockchain_wire_write_u32(
+        &writer, PROTOCOL_REQ_ID_EXTENDED_API_CLIENTREQ);
 
     /* populate the offset. */
-    uint64_t net_offset = htonll(offset);
-    memcpy(barr, &net_offset, sizeof(net_offset));
-    barr += sizeof(net_offset);
+    vcblockchain_wire_write_u64(&writer, offset);
 
     /* populate the client encryption pubkey size. */
-    uint32_t net_enc_key_size = htonl(client_enc_pubkey->size);
-    memcpy(barr, &net_enc_key_size, sizeof(net_enc_key_size));
-    barr += sizeof(net_enc_key_size);
+    vcblockchain_wire_write_u32(&writer, client_enc_pubkey->size);
 
     /* populate the client signing pubkey size. */
-    uint32_t net_sign_key_size = htonl(client_sign_pubkey->size);
-    memcpy(barr, &net_sign_key_size, sizeof(net_sign_key_size));
-    barr += sizeof(net_sign_key_size);
+    vcblockchain_wire_write_u32(&writer, client_sign_pubkey->size);
 
     /* populate the client id. */
-    memcpy(barr, client_id, sizeof(*client_id));
-    barr += sizeof(*client_id);
+    vcblockchain_wire_write_uuid(&writer, client_id);
 
     /* populate the verb id. */
-    memcpy(barr, verb_id, sizeof(*verb_id));
-    barr += sizeof(*verb_id);
+    vcblockchain_wire_write_uuid(&writer, verb_id);
 
     /* populate the encryption pubkey. */
-    memcpy(barr, client_enc_pubkey->data, client_enc_pubkey->size);
-    barr += client_enc_pubkey->size;
+    vcblockchain_wire_write_bytes(
+        &writer, client_enc_pubkey->data, client_enc_pubkey->size);
 
     /* populate the signing pubkey. */
-    memcpy(barr, client_sign_pubkey->data, client_sign_pubkey->size);
-    barr += client_sign_pubkey->size;
+    vcblockchain_wire_write_bytes(
+        &writer, client_sign_pubkey->data, client_sign_pubkey->size);
 
     /* copy the response body. */
-    memcpy(barr, request_body->data, request_body->size);
-    barr += request_body->size;
+    vcblockchain_wire_write_bytes(
+        &writer, request_body->data, request_body->size);
 
     /* success. */
     /* On success, the caller owns the buffer and must dispose it. */
@@ -0,0 +1,95 @@
+/**
+ * \file protocol/vcblockchain_protocol_encode_resp_flow_credit_grant.c
+ *
+ * \brief Encode a flow credit grant response into a buffer.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+
+#include "wire_internal.h"
+
+/**
+ * \brief Encode a flow credit grant response using the given parameters.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded response.
+ * \param alloc_opts                The allocator options to use to allocate the
+ *                                  buffer.
+ * \param offset                    The offset for this response.
+ * \param status                    The status for this response.
+ * \param request_credits           The number of requests granted.
+ * \param byte_credits              The number of request bytes granted.
+ *
+ * The agent answers the first grant on a connection with the whole of its
+ * receive window. After that, it sends a grant with an offset of zero whenever
+ * it frees enough capacity. The client recognizes these grants by their
+ * request id, so they never complete a request in flight.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * response.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_resp_flow_credit_grant(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, uint32_t status, uint32_t request_credits,
+    uint64_t byte_credits)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != buffer);
+    MODEL_ASSERT(NULL != alloc_opts);
+
+    /* runtime parameter checks. */
+    if (NULL == buffer || NULL == alloc_opts)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* | Flow credit grant response packet.                                 | */
+    /* | --------------------------------------------------- | ------------ | */
+    /* | DATA                                                | SIZE         | */
+    /* | --------------------------------------------------- | ------------ | */
+    /* | PROTOCOL_REQ_ID_FLOW_CREDIT_GRANT                   |   4 bytes    | */
+    /* | status                                              |   4 bytes    | */
+    /* | offset                                              |   4 bytes    | */
+    /* | record:                                             |  12 bytes    | */
+    /* |    request_credits                                  |   4 bytes    | */
+    /* |    byte_credits                                     |   8 bytes    | */
+    /* | --------------------------------------------------- | ------------ | */
+
+    /* compute the buffer size. */
+    size_t buffer_size =
+          sizeof(uint32_t) /* request_id */
+        + sizeof(uint32_t) /* status */
+        + sizeof(uint32_t) /* offset */
+        + sizeof(uint32_t) /* request_credits */
+        + sizeof(uint64_t); /* byte_credits */
+
+    /* initialize the buffer. */
+    if (VCCRYPT_STATUS_SUCCESS !=
+        vccrypt_buffer_init(buffer, alloc_opts, buffer_size))
+    {
+        return VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* write the response fields. */
+    vcblockchain_wire_writer writer;
+    vcblockchain_wire_writer_init(&writer, buffer->data, buffer->size);
+    vcblockchain_wire_write_u32(&writer, PROTOCOL_REQ_ID_FLOW_CREDIT_GRANT);
+    vcblockchain_wire_write_u32(&writer, status);
+    vcblockchain_wire_write_u32(&writer, offset);
+    vcblockchain_wire_write_u32(&writer, request_credits);
+    vcblockchain_wire_write_u64(&writer, byte_credits);
+
+    /* success. */
+    /* buffer is owned by the caller on success. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
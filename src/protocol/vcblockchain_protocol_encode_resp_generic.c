@@ -7,11 +7,12 @@
  * \copyright 2022 Velo Payments, Inc.  All rights reserved.
  */
 
-#include <arpa/inet.h>
 #include <string.h>
 #include <vcblockchain/protocol/serialization.h>
 #include <vcblockchain/error_codes.h>
 
+#include "wire_internal.h"
+
 /**
  * \brief Encode a generic response for the protocol.
  *
@@ -62,15 +63,16 @@ int vcblockchain_protocol_encode_resp_generic(
     }
 
     /* populate the header values. */
-    uint32_t* uarr = (uint32_t*)buffer->data;
-    uarr[0] = htonl(request_id);
-    uarr[1] = htonl(status_code);
-    uarr[2] = htonl(offset);
+    vcblockchain_wire_writer writer;
+    vcblockchain_wire_writer_init(&writer, buffer->data, buffer->size);
+    vcblockchain_wire_write_u32(&writer, request_id);
+    vcblockchain_wire_write_u32(&writer, status_code);
+    vcblockchain_wire_write_u32(&writer, offset);
 
     /* maybe populate the payload. */
     if (NULL != payload)
     {
-        memcpy(uarr + 3, payload, payload_size);
+        vcblockchain_wire_write_bytes(&writer, payload, payload_size);
     }
 
     /* success. */
@@ -6,13 +6,14 @@
  * \copyright 2020 Velo Payments, Inc.  All rights reserved.
  */
 
-#include <arpa/inet.h>
 #include <cbmc/model_assert.h>
 #include <vcblockchain/error_codes.h>
 #include <vcblockchain/protocol/data.h>
 #include <vcblockchain/protocol/serialization.h>
 #include <string.h>
 
+#include "wire_internal.h"
+
 /**
  * \brief Encode a handshake ack response using the given parameters.
  *
@@ -40,11 +41,6 @@ int vcblockchain_protocol_encode_resp_handshake_ack(
     MODEL_ASSERT(NULL != buffer);
     MODEL_ASSERT(NULL != alloc_opts);
 
-    const uint32_t net_request_id =
-        htonl(PROTOCOL_REQ_ID_HANDSHAKE_ACKNOWLEDGE);
-    const uint32_t net_offset = htonl(offset);
-    const uint32_t net_status = htonl(status);
-
     /* | Handshake response response packet.                                | */
     /* | --------------------------------------------------- | ------------ | */
     /* | DATA                                                | SIZE         | */
@@ -56,9 +52,9 @@ int vcblockchain_protocol_encode_resp_handshake_ack(
 
     /* compute the size of the response packet. */
     size_t payload_size =
-          sizeof(net_request_id)
-        + sizeof(net_offset)
-        + sizeof(net_status);
+          sizeof(uint32_t) /* request_id */
+        + sizeof(uint32_t) /* offset */
+        + sizeof(uint32_t); /* status */
 
     /* create the output buffer. */
     if (VCCRYPT_STATUS_SUCCESS !=
@@ -68,10 +64,11 @@ int vcblockchain_protocol_encode_resp_handshake_ack(
     }
 
     /* write the values to the buffer. */
-    uint32_t* buf = (uint32_t*)buffer->data;
-    buf[0] = net_request_id;
-    buf[1] = net_status;
-    buf[2] = net_offset;
+    vcblockchain_wire_writer writer;
+    vcblockchain_wire_writer_init(&writer, buffer->data, buffer->size);
+    vcblockchain_wire_write_u32(&writer, PROTOCOL_REQ_ID_HANDSHAKE_ACKNOWLEDGE);
+    vcblockchain_wire_write_u32(&writer, status);
+    vcblockchain_wire_write_u32(&writer, offset);
 
     /* success. */
     /* caller owns buffer on success and must dispose it. */
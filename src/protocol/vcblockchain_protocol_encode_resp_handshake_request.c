@@ -6,13 +6,14 @@
  * \copyright 2020 Velo Payments, Inc.  All rights reserved.
  */
 
-#include <arpa/inet.h>
 #include <cbmc/model_assert.h>
 #include <vcblockchain/error_codes.h>
 #include <vcblockchain/protocol/data.h>
 #include <vcblockchain/protocol/serialization.h>
 #include <string.h>
 
+#include "wire_internal.h"
+
 /**
  * \brief Encode a handshake request response using the given parameters.
  *
@@ -53,11 +54,6 @@ int vcblockchain_protocol_encode_resp_handshake_request(
     MODEL_ASSERT(NULL != server_challenge_nonce);
     MODEL_ASSERT(NULL != server_cr_hmac);
 
-    const uint32_t net_request_id = htonl(PROTOCOL_REQ_ID_HANDSHAKE_INITIATE);
-    const uint32_t net_offset = htonl(offset);
-    const uint32_t net_status = htonl(status);
-    const uint32_t net_protocol_version = htonl(PROTOCOL_VERSION_0_1_DEMO);
-    const uint32_t net_crypto_suite = htonl(suite->suite_id);
     int retval;
 
     /* verify buffer sizes. */
@@ -89,11 +85,11 @@ int vcblockchain_protocol_encode_resp_handshake_request(
 
     /* compute the size of the response packet. */
     size_t payload_size =
-          sizeof(net_request_id)
-        + sizeof(net_offset)
-        + sizeof(net_status)
-        + sizeof(net_protocol_version)
-        + sizeof(net_crypto_suite)
+          sizeof(uint32_t) /* request_id */
+        + sizeof(uint32_t) /* offset */
+        + sizeof(uint32_t) /* status */
+        + sizeof(uint32_t) /* protocol_version */
+        + sizeof(uint32_t) /* crypto_suite */
         + sizeof(*agent_id)
         + server_public_key->size
         + server_key_nonce->size
@@ -108,45 +104,40 @@ int vcblockchain_protocol_encode_resp_handshake_request(
     }
 
     /* write the request to the buffer. */
-    uint8_t* buf = (uint8_t*)buffer->data;
-    memcpy(buf, &net_request_id, sizeof(net_request_id));
-    buf += sizeof(net_request_id);
+    vcblockchain_wire_writer writer;
+    vcblockchain_wire_writer_init(&writer, buffer->data, buffer->size);
+    vcblockchain_wire_write_u32(&writer, PROTOCOL_REQ_ID_HANDSHAKE_INITIATE);
 
     /* write the status to the buffer. */
-    memcpy(buf, &net_status, sizeof(net_status));
-    buf += sizeof(net_status);
+    vcblockchain_wire_write_u32(&writer, status);
 
     /* write the offset to the buffer. */
-    memcpy(buf, &net_offset, sizeof(net_offset));
-    buf += sizeof(net_offset);
+    vcblockchain_wire_write_u32(&writer, offset);
 
     /* write the protocol version to the buffer. */
-    memcpy(buf, &net_protocol_version, sizeof(net_protocol_version));
-    buf += sizeof(net_protocol_version);
+    vcblockchain_wire_write_u32(&writer, PROTOCOL_VERSION_0_1_DEMO);
 
     /* write the crypto suite to the buffer. */
-    memcpy(buf, &net_crypto_suite, sizeof(net_crypto_suite));
-    buf += sizeof(net_crypto_suite);
+    vcblockchain_wire_write_u32(&writer, suite->suite_id);
 
     /* write the agent id to the buffer. */
-    memcpy(buf, agent_id, sizeof(*agent_id));
-    buf += sizeof(*agent_id);
+    vcblockchain_wire_write_uuid(&writer, agent_id);
 
     /* write the server public key to the buffer. */
-    memcpy(buf, server_public_key->data, server_public_key->size);
-    buf += server_public_key->size;
+    vcblockchain_wire_write_bytes(
+        &writer, server_public_key->data, server_public_key->size);
 
     /* write the server key nonce to the buffer. */
-    memcpy(buf, server_key_nonce->data, server_key_nonce->size);
-    buf += server_key_nonce->size;
+    vcblockchain_wire_write_bytes(
+        &writer, server_key_nonce->data, server_key_nonce->size);
 
     /* write the server challenge nonce to the buffer. */
-    memcpy(buf, server_challenge_nonce->data, server_challenge_nonce->size);
-    buf += server_challenge_nonce->size;
+    vcblockchain_wire_write_bytes(
+        &writer, server_challenge_nonce->data, server_challenge_nonce->size);
 
     /* write the server cr hmac to the buffer. */
-    memcpy(buf, server_cr_hmac->data, server_cr_hmac->size);
-    buf += server_cr_hmac->size;
+    vcblockchain_wire_write_bytes(
+        &writer, server_cr_hmac->data, server_cr_hmac->size);
 
     /* success. */
     retval = VCBLOCKCHAIN_STATUS_SUCCESS;
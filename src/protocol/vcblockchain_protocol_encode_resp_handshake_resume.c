@@ -0,0 +1,116 @@
+/**
+ * \file protocol/vcblockchain_protocol_encode_resp_handshake_resume.c
+ *
+ * \brief Encode a handshake resume response into a buffer.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/data.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <string.h>
+
+#include "wire_internal.h"
+
+/**
+ * \brief Encode a handshake resume response using the given parameters.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded handshake response
+ *                                  packet.
+ * \param suite                     The crypto suite to use for this response.
+ * \param offset                    The offset for this response.
+ * \param status                    The status for this response.
+ * \param server_key_nonce          The agent key nonce.
+ * \param server_cr_hmac            The agent proof that it opened the ticket.
+ *
+ * A rejected resumption, such as for an expired ticket, is encoded with
+ * \ref vcblockchain_protocol_encode_error_resp instead, using
+ * \ref VCBLOCKCHAIN_ERROR_PROTOCOL_TICKET_REJECTED as its status, which tells
+ * the client to fall back to a full handshake.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * response.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_resp_handshake_resume(
+    vccrypt_buffer_t* buffer, vccrypt_suite_options_t* suite,
+    uint32_t offset, uint32_t status,
+    const vccrypt_buffer_t* server_key_nonce,
+    const vccrypt_buffer_t* server_cr_hmac)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != buffer);
+    MODEL_ASSERT(NULL != suite);
+    MODEL_ASSERT(NULL != server_key_nonce);
+    MODEL_ASSERT(NULL != server_cr_hmac);
+
+    int retval;
+
+    /* verify buffer sizes. */
+    if (server_key_nonce->size != suite->key_cipher_opts.minimum_nonce_size
+     || server_cr_hmac->size != suite->mac_short_opts.mac_size)
+    {
+        retval = VCBLOCKCHAIN_ERROR_INVALID_ARG;
+        goto done;
+    }
+
+    /* | Handshake resume response packet.                                  | */
+    /* | --------------------------------------------------- | ------------ | */
+    /* | DATA                                                | SIZE         | */
+    /* | --------------------------------------------------- | ------------ | */
+    /* | PROTOCOL_REQ_ID_HANDSHAKE_RESUME                    |   4 bytes    | */
+    /* | status                                              |   4 bytes    | */
+    /* | offset                                              |   4 bytes    | */
+    /* | record:                                             |  64 bytes    | */
+    /* |    server key nonce                                 |  32 bytes    | */
+    /* |    server_cr_hmac                                   |  32 bytes    | */
+    /* | --------------------------------------------------- | ------------ | */
+
+    /* compute the size of the response packet. */
+    size_t payload_size =
+          sizeof(uint32_t) /* request_id */
+        + sizeof(uint32_t) /* offset */
+        + sizeof(uint32_t) /* status */
+        + server_key_nonce->size
+        + server_cr_hmac->size;
+
+    /* create output buffer. */
+    retval = vccrypt_buffer_init(buffer, suite->alloc_opts, payload_size);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* write the request id to the buffer. */
+    vcblockchain_wire_writer writer;
+    vcblockchain_wire_writer_init(&writer, buffer->data, buffer->size);
+    vcblockchain_wire_write_u32(&writer, PROTOCOL_REQ_ID_HANDSHAKE_RESUME);
+
+    /* write the status to the buffer. */
+    vcblockchain_wire_write_u32(&writer, status);
+
+    /* write the offset to the buffer. */
+    vcblockchain_wire_write_u32(&writer, offset);
+
+    /* write the server key nonce to the buffer. */
+    vcblockchain_wire_write_bytes(
+        &writer, server_key_nonce->data, server_key_nonce->size);
+
+    /* write the server cr hmac to the buffer. */
+    vcblockchain_wire_write_bytes(
+        &writer, server_cr_hmac->data, server_cr_hmac->size);
+
+    /* success. */
+    retval = VCBLOCKCHAIN_STATUS_SUCCESS;
+    goto done;
+
+done:
+    return retval;
+}
@@ -0,0 +1,111 @@
+/**
+ * \file protocol/vcblockchain_protocol_encode_resp_rekey.c
+ *
+ * \brief Encode a rekey response into a buffer.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/data.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <string.h>
+
+#include "wire_internal.h"
+
+/**
+ * \brief Encode a rekey response using the given parameters.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded response packet.
+ * \param suite                     The crypto suite to use for this response.
+ * \param offset                    The offset for this response.
+ * \param status                    The status for this response.
+ * \param server_switch_iv          The first server IV that uses the new
+ *                                  shared secret.
+ * \param server_key_nonce          The agent key nonce.
+ *
+ * A refused rekey is encoded with \ref vcblockchain_protocol_encode_error_resp
+ * instead, in which case both sides keep the current shared secret.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * response.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the nonce has the wrong size.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_resp_rekey(
+    vccrypt_buffer_t* buffer, vccrypt_suite_options_t* suite,
+    uint32_t offset, uint32_t status, uint64_t server_switch_iv,
+    const vccrypt_buffer_t* server_key_nonce)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != buffer);
+    MODEL_ASSERT(NULL != suite);
+    MODEL_ASSERT(NULL != server_key_nonce);
+
+    int retval;
+
+    /* verify the nonce size. */
+    if (server_key_nonce->size != suite->key_cipher_opts.minimum_nonce_size)
+    {
+        retval = VCBLOCKCHAIN_ERROR_INVALID_ARG;
+        goto done;
+    }
+
+    /* | Rekey response packet.                                             | */
+    /* | --------------------------------------------------- | ------------ | */
+    /* | DATA                                                | SIZE         | */
+    /* | --------------------------------------------------- | ------------ | */
+    /* | PROTOCOL_REQ_ID_REKEY                               |   4 bytes    | */
+    /* | status                                              |   4 bytes    | */
+    /* | offset                                              |   4 bytes    | */
+    /* | record:                                             |  40 bytes    | */
+    /* |    server_switch_iv                                 |   8 bytes    | */
+    /* |    server key nonce                                 |  32 bytes    | */
+    /* | --------------------------------------------------- | ------------ | */
+
+    /* compute the size of the response packet. */
+    size_t payload_size =
+          sizeof(uint32_t) /* request_id */
+        + sizeof(uint32_t) /* offset */
+        + sizeof(uint32_t) /* status */
+        + sizeof(uint64_t) /* server_switch_iv */
+        + server_key_nonce->size;
+
+    /* create output buffer. */
+    retval = vccrypt_buffer_init(buffer, suite->alloc_opts, payload_size);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* write the request id to the buffer. */
+    vcblockchain_wire_writer writer;
+    vcblockchain_wire_writer_init(&writer, buffer->data, buffer->size);
+    vcblockchain_wire_write_u32(&writer, PROTOCOL_REQ_ID_REKEY);
+
+    /* write the status to the buffer. */
+    vcblockchain_wire_write_u32(&writer, status);
+
+    /* write the offset to the buffer. */
+    vcblockchain_wire_write_u32(&writer, offset);
+
+    /* write the server switch IV to the buffer. */
+    vcblockchain_wire_write_u64(&writer, server_switch_iv);
+
+    /* write the server key nonce to the buffer. */
+    vcblockchain_wire_write_bytes(
+        &writer, server_key_nonce->data, server_key_nonce->size);
+
+    /* success. */
+    retval = VCBLOCKCHAIN_STATUS_SUCCESS;
+    goto done;
+
+done:
+    return retval;
+}
@@ -0,0 +1,94 @@
+/**
+ * \file protocol/vcblockchain_protocol_encode_resp_transaction_canonized.c
+ *
+ * \brief Encode a transaction canonized notification.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+
+#include "wire_internal.h"
+
+/**
+ * \brief Encode a transaction canonized notification for a transaction submit
+ * and await request.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded notification.
+ * \param alloc_opts                The allocator options to use to allocate the
+ *                                  buffer.
+ * \param offset                    The offset of the transaction submit and
+ *                                  await request.
+ * \param txn_id                    The canonized transaction id.
+ * \param block_id                  The block id for the block in which this
+ *                                  transaction was canonized.
+ * \param block_height              The height of this block.
+ *
+ * If the deadline for the request expires before the transaction is canonized,
+ * then the agent should instead use \ref
+ * vcblockchain_protocol_encode_error_resp to send an error response with the
+ * \ref PROTOCOL_REQ_ID_TRANSACTION_CANONIZED request id and a status of
+ * \ref VCBLOCKCHAIN_ERROR_PROTOCOL_CANONIZATION_EXPIRED.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * notification.  The caller owns this buffer and must \ref dispose() it when it
+ * is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_resp_transaction_canonized(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, const vpr_uuid* txn_id, const vpr_uuid* block_id,
+    uint64_t block_height)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != buffer);
+    MODEL_ASSERT(NULL != alloc_opts);
+    MODEL_ASSERT(NULL != txn_id);
+    MODEL_ASSERT(NULL != block_id);
+
+    /* runtime parameter checks. */
+    if (NULL == buffer || NULL == alloc_opts || NULL == txn_id
+     || NULL == block_id)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* compute the buffer size. */
+    size_t resp_size =
+          3 * sizeof(uint32_t) /* request_id, offset, and status. */
+        + sizeof(*txn_id)
+        + sizeof(*block_id)
+        + sizeof(block_height);
+
+    /* create the buffer. */
+    if (VCCRYPT_STATUS_SUCCESS !=
+        vccrypt_buffer_init(buffer, alloc_opts, resp_size))
+    {
+        return VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* populate the integer values. */
+    vcblockchain_wire_writer writer;
+    vcblockchain_wire_writer_init(&writer, buffer->data, buffer->size);
+    vcblockchain_wire_write_u32(&writer, PROTOCOL_REQ_ID_TRANSACTION_CANONIZED);
+    vcblockchain_wire_write_u32(&writer, VCBLOCKCHAIN_STATUS_SUCCESS);
+    vcblockchain_wire_write_u32(&writer, offset);
+
+    /* populate the uuid values. */
+    vcblockchain_wire_write_uuid(&writer, txn_id);
+    vcblockchain_wire_write_uuid(&writer, block_id);
+
+    /* populate the block height. */
+    vcblockchain_wire_write_u64(&writer, block_height);
+
+    /* success. */
+    /* On success, the caller owns the buffer and must dispose it. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
@@ -6,13 +6,13 @@
  * \copyright 2021 Velo Payments, Inc.  All rights reserved.
  */
 
-#include <arpa/inet.h>
 #include <cbmc/model_assert.h>
 #include <string.h>
-#include <vcblockchain/byteswap.h>
 #include <vcblockchain/error_codes.h>
 #include <vcblockchain/protocol/serialization.h>
 
+#include "wire_internal.h"
+
 /**
  * \brief Encode a transaction get response using the given parameters.
  *
@@ -87,29 +87,27 @@ int vcblockchain_protocol_encode_resp_txn_get(
     }
 
     /* populate the integer values. */
-    uint32_t* uarr = (uint32_t*)buffer->data;
-    uarr[0] = htonl(PROTOCOL_REQ_ID_TRANSACTION_BY_ID_GET);
-    uarr[1] = htonl(status);
-    uarr[2] = htonl(offset);
+    vcblockchain_wire_writer writer;
+    vcblockchain_wire_writer_init(&writer, buffer->data, buffer->size);
+    vcblockchain_wire_write_u32(&writer, PROTOCOL_REQ_ID_TRANSACTION_BY_ID_GET);
+    vcblockchain_wire_write_u32(&writer, status);
+    vcblockchain_wire_write_u32(&writer, offset);
 
     /* populate the uuid values. */
-    uint8_t* barr = (uint8_t*)(uarr + 3);
-    memcpy(barr,        txn_id, 16);
-    memcpy(barr + 16,   prev_txn_id, 16);
-    memcpy(barr + 32,   next_txn_id, 16);
-    memcpy(barr + 48,   artifact_id, 16);
-    memcpy(barr + 64,   block_id, 16);
+    vcblockchain_wire_write_uuid(&writer, txn_id);
+    vcblockchain_wire_write_uuid(&writer, prev_txn_id);
+    vcblockchain_wire_write_uuid(&writer, next_txn_id);
+    vcblockchain_wire_write_uuid(&writer, artifact_id);
+    vcblockchain_wire_write_uuid(&writer, block_id);
 
     /* populate the serialized txn cert size. */
-    uint64_t net_ser_txn_cert_size = htonll(ser_txn_cert_size);
-    memcpy(barr + 80,   &net_ser_txn_cert_size, 8);
+    vcblockchain_wire_write_u64(&writer, ser_txn_cert_size);
 
     /* populate the transaction state. */
-    uint32_t net_txn_state = htonl(txn_state);
-    memcpy(barr + 88,   &net_txn_state, 4);
+    vcblockchain_wire_write_u32(&writer, txn_state);
 
     /* populate the transaction certificate. */
-    memcpy(barr + 92, txn_cert, txn_cert_size);
+    vcblockchain_wire_write_bytes(&writer, txn_cert, txn_cert_size);
 
     /* success. */
     /* On success, the caller owns the buffer and must dispose it. */
@@ -0,0 +1,146 @@
+/**
+ * \file protocol/vcblockchain_protocol_encode_resp_txn_get_fields.c
+ *
+ * \brief Encode a txn get fields response into a buffer.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+
+#include "wire_internal.h"
+
+/**
+ * \brief Encode a transaction get fields response using the given parameters.
+ *
+ * \param buffer                    Pointer to an uninitialized buffer to
+ *                                  receive the encoded response.
+ * \param alloc_opts                The allocator options to use to allocate the
+ *                                  buffer.
+ * \param offset                    The offset for this response.
+ * \param status                    The status for this response.
+ * \param field_mask                The \ref protocol_txn_field values to
+ *                                  encode.
+ * \param txn_id                    The transaction id.
+ * \param prev_txn_id               The previous transaction id.
+ * \param next_txn_id               The next transaction id.
+ * \param artifact_id               The artifact id for this transaction.
+ * \param block_id                  The block id for this transaction.
+ * \param txn_state                 The transaction state.
+ * \param txn_cert                  Pointer to the start of the transaction
+ *                                  certificate.
+ * \param txn_cert_size             The transaction cert size.
+ *
+ * Only the fields in \p field_mask are encoded; the pointers for the remaining
+ * fields may be NULL.
+ *
+ * On success, the \p buffer is initialized with a buffer holding the encoded
+ * response.  The caller owns this buffer and must \ref dispose() it when it is
+ * no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the field mask has unknown bits or
+ *        a requested field is NULL.
+ *      - a non-zero error code on failure.
+ */
+int vcblockchain_protocol_encode_resp_txn_get_fields(
+    vccrypt_buffer_t* buffer, allocator_options_t* alloc_opts,
+    uint32_t offset, uint32_t status, uint32_t field_mask,
+    const vpr_uuid* txn_id, const vpr_uuid* prev_txn_id,
+    const vpr_uuid* next_txn_id, const vpr_uuid* artifact_id,
+    const vpr_uuid* block_id, uint32_t txn_state, const void* txn_cert,
+    size_t txn_cert_size)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != buffer);
+    MODEL_ASSERT(NULL != alloc_opts);
+    MODEL_ASSERT(NULL != txn_id);
+
+    /* runtime parameter checks. */
+    if (NULL == buffer || NULL == alloc_opts || NULL == txn_id
+     || 0 != (field_mask & ~PROTOCOL_TXN_FIELD_ALL))
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* every requested field must be provided. */
+    if (((field_mask & PROTOCOL_TXN_FIELD_PREV_TXN_ID) && NULL == prev_txn_id)
+     || ((field_mask & PROTOCOL_TXN_FIELD_NEXT_TXN_ID) && NULL == next_txn_id)
+     || ((field_mask & PROTOCOL_TXN_FIELD_ARTIFACT_ID) && NULL == artifact_id)
+     || ((field_mask & PROTOCOL_TXN_FIELD_BLOCK_ID) && NULL == block_id)
+     || ((field_mask & PROTOCOL_TXN_FIELD_TXN_CERT) && NULL == txn_cert))
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* compute the buffer size. */
+    size_t resp_size =
+          3 * sizeof(uint32_t) /* request_id, offset, and status. */
+        + sizeof(field_mask)
+        + sizeof(*txn_id)
+        + ((field_mask & PROTOCOL_TXN_FIELD_PREV_TXN_ID) ? 16 : 0)
+        + ((field_mask & PROTOCOL_TXN_FIELD_NEXT_TXN_ID) ? 16 : 0)
+        + ((field_mask & PROTOCOL_TXN_FIELD_ARTIFACT_ID) ? 16 : 0)
+        + ((field_mask & PROTOCOL_TXN_FIELD_BLOCK_ID) ? 16 : 0)
+        + ((field_mask & PROTOCOL_TXN_FIELD_TXN_STATE) ? sizeof(txn_state) : 0)
+        + ((field_mask & PROTOCOL_TXN_FIELD_TXN_CERT) ? txn_cert_size : 0);
+
+    /* create the buffer. */
+    if (VCCRYPT_STATUS_SUCCESS !=
+        vccrypt_buffer_init(buffer, alloc_opts, resp_size))
+    {
+        return VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* populate the header and field mask. */
+    vcblockchain_wire_writer writer;
+    vcblockchain_wire_writer_init(&writer, buffer->data, buffer->size);
+    vcblockchain_wire_write_u32(
+        &writer, PROTOCOL_REQ_ID_TRANSACTION_BY_ID_GET_FIELDS);
+    vcblockchain_wire_write_u32(&writer, status);
+    vcblockchain_wire_write_u32(&writer, offset);
+    vcblockchain_wire_write_u32(&writer, field_mask);
+
+    /* populate the transaction id. */
+    vcblockchain_wire_write_uuid(&writer, txn_id);
+
+    /* populate the requested fields in mask order. */
+    if (field_mask & PROTOCOL_TXN_FIELD_PREV_TXN_ID)
+    {
+        vcblockchain_wire_write_uuid(&writer, prev_txn_id);
+    }
+
+    if (field_mask & PROTOCOL_TXN_FIELD_NEXT_TXN_ID)
+    {
+        vcblockchain_wire_write_uuid(&writer, next_txn_id);
+    }
+
+    if (field_mask & PROTOCOL_TXN_FIELD_ARTIFACT_ID)
+    {
+        vcblockchain_wire_write_uuid(&writer, artifact_id);
+    }
+
+    if (field_mask & PROTOCOL_TXN_FIELD_BLOCK_ID)
+    {
+        vcblockchain_wire_write_uuid(&writer, block_id);
+    }
+
+    if (field_mask & PROTOCOL_TXN_FIELD_TXN_STATE)
+    {
+        vcblockchain_wire_write_u32(&writer, txn_state);
+    }
+
+    /* the transaction certificate, if requested, fills the rest. */
+    if (field_mask & PROTOCOL_TXN_FIELD_TXN_CERT)
+    {
+        vcblockchain_wire_write_bytes(&writer, txn_cert, txn_cert_size);
+    }
+
+    /* success. */
+    /* On success, the caller owns the buffer and must dispose it. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
@@ -10,7 +10,6 @@
 #include <string.h>
 #include <vcblockchain/error_codes.h>
 #include <vcblockchain/protocol.h>
-#include <vcblockchain/psock.h>
 
 /**
  * \brief Receive a response from the API.
@@ -36,6 +35,10 @@
  * caller can decode this response into a structure by calling \ref
  * vcblockchain_protocol_response_decode.
  *
+ * This copies the decrypted payload into \p response. Callers that decode the
+ * response immediately should prefer \ref vcblockchain_protocol_recvresp_raw
+ * or one of the typed receive functions, which avoid this copy.
+ *
  * \returns a status code indicating success or failure.
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
  *      - VCBLOCKCHAIN_ERROR_SSOCK_READ if writing to the socket failed.
@@ -48,7 +51,7 @@ status vcblockchain_protocol_recvresp(
     vccrypt_suite_options_t* suite, uint64_t* server_iv,
     const vccrypt_buffer_t* shared_secret, vccrypt_buffer_t* response)
 {
-    int retval;
+    int retval, release_retval;
 
     /* parameter sanity checks. */
     MODEL_ASSERT(NULL != sock);
@@ -70,9 +73,8 @@ status vcblockchain_protocol_recvresp(
     void* val = NULL;
     uint32_t size = 0U;
     retval =
-        psock_read_authed_data(
-            sock, a, *server_iv, &val, &size, suite,
-            shared_secret);
+        vcblockchain_protocol_recvresp_raw(
+            sock, a, suite, server_iv, shared_secret, &val, &size);
     if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
     {
         goto done;
@@ -82,6 +84,7 @@ status vcblockchain_protocol_recvresp(
     retval = vccrypt_buffer_init(response, suite->alloc_opts, size);
     if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
     {
+        retval = VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
         goto cleanup_val;
     }
 
@@ -89,16 +92,18 @@ status vcblockchain_protocol_recvresp(
     MODEL_ASSERT(size == response->size);
     memcpy(response->data, val, response->size);
 
-    /* increment the server iv. */
-    ++(*server_iv);
-
     /* success. */
     retval = VCBLOCKCHAIN_STATUS_SUCCESS;
     /* the response buffer is owned by the caller on success. */
 
 cleanup_val:
-    memset(val, 0, size);
-    release(suite->alloc_opts, val);
+    release_retval = vcblockchain_protocol_recvresp_raw_release(a, val, size);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != release_retval
+     && VCBLOCKCHAIN_STATUS_SUCCESS == retval)
+    {
+        dispose((disposable_t*)response);
+        retval = release_retval;
+    }
 
 done:
     return retval;
@@ -0,0 +1,112 @@
+/**
+ * \file protocol/vcblockchain_protocol_recvresp_artifact_txn_page_get.c
+ *
+ * \brief Receive and decode an artifact transaction page get response from the
+ * server.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol.h>
+#include <vcblockchain/protocol/serialization.h>
+
+#include "recvresp_internal.h"
+
+/**
+ * \brief Receive an artifact transaction page get response from the API and
+ * decode it.
+ *
+ * \param sock                      The socket from which this response is read.
+ * \param a                         The allocator to use for this operation.
+ * \param suite                     The crypto suite to use for this read.
+ * \param server_iv                 Pointer to the server_iv to use, updated as
+ *                                  a consequence of this call.
+ * \param shared_secret             The shared secret key for this request.
+ * \param alloc_opts                The allocator to use for the decoded
+ *                                  response.
+ * \param resp                      The response structure to initialize.
+ *
+ * \note - this function requires that the handshake request send / receive, and
+ * the handshake ack send have each been performed before it can be used.
+ *
+ * This call reads the response to a request sent by \ref
+ * vcblockchain_protocol_sendreq_artifact_txn_page_get, decoding it directly
+ * from the decrypted payload. On success, the server_iv is incremented, and
+ * \p resp is initialized and owned by the caller, who must \ref dispose() it
+ * when it is no longer needed. The server_iv is also incremented if the server
+ * returned an error status, in which case \p resp is not initialized.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_READ if reading from the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the response was not a
+ *        artifact transaction page get response.
+ *      - the status returned by the server if the request failed.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_protocol_recvresp_artifact_txn_page_get(
+    RCPR_SYM(psock)* sock, RCPR_SYM(allocator)* a,
+    vccrypt_suite_options_t* suite, uint64_t* server_iv,
+    const vccrypt_buffer_t* shared_secret, allocator_options_t* alloc_opts,
+    protocol_resp_artifact_txn_page_get* resp)
+{
+    int retval, release_retval;
+    void* payload = NULL;
+    uint32_t payload_size = 0U;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != alloc_opts);
+    MODEL_ASSERT(NULL != resp);
+
+    /* runtime parameter checks. */
+    if (NULL == alloc_opts || NULL == resp)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* read the response without copying it. */
+    retval =
+        vcblockchain_protocol_recvresp_raw(
+            sock, a, suite, server_iv, shared_secret, &payload,
+            &payload_size);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* verify that this is a successful artifact txn page get response. */
+    retval =
+        vcblockchain_protocol_recvresp_check_header(
+            payload, payload_size, PROTOCOL_REQ_ID_ARTIFACT_TXN_PAGE_GET);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_payload;
+    }
+
+    /* decode the response directly from the payload. */
+    retval =
+        vcblockchain_protocol_decode_resp_artifact_txn_page_get(
+            resp, alloc_opts, payload, payload_size);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_payload;
+    }
+
+    /* success. */
+    /* the decoded response is owned by the caller on success. */
+
+cleanup_payload:
+    release_retval =
+        vcblockchain_protocol_recvresp_raw_release(a, payload, payload_size);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != release_retval
+     && VCBLOCKCHAIN_STATUS_SUCCESS == retval)
+    {
+        dispose((disposable_t*)resp);
+        retval = release_retval;
+    }
+
+    return retval;
+}
@@ -0,0 +1,201 @@
+/**
+ * \file protocol/vcblockchain_protocol_recvresp_handshake_resume.c
+ *
+ * \brief Receive a handshake resume response from the server.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol.h>
+#include <vcblockchain/protocol/data.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vccrypt/compare.h>
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_psock;
+
+/**
+ * \brief Receive a handshake resume response from the API.
+ *
+ * \param sock                      The socket from which this response is read.
+ * \param a                         The allocator to use for this operation.
+ * \param suite                     The crypto suite to use to verify this
+ *                                  response.
+ * \param resumption_secret         The resumption secret bound to the ticket
+ *                                  presented in the request.
+ * \param client_key_nonce          The client key nonce for this handshake.
+ * \param shared_secret             The buffer to receive the shared secret for
+ *                                  this session. Must not have been previously
+ *                                  initialized. On success, it is initialized
+ *                                  and populated with the shared secret. This
+ *                                  is owned by the caller and must be disposed
+ *                                  when no longer needed.
+ * \param client_iv                 Pointer to receive the client IV.
+ * \param server_iv                 Pointer to receive the server IV.
+ * \param offset                    The offset for this response.
+ * \param status                    The status for this response.
+ *
+ * The shared secret for the resumed session is derived from the resumption
+ * secret and both key nonces, and the response is verified with it. A valid
+ * response proves that the server opened the ticket. The client proves the
+ * same by sending its first authenticated request, so no acknowledgement is
+ * sent, and the IVs are set as if one had been.
+ *
+ * If the server rejected the ticket, then its status is returned. The caller
+ * should discard the ticket and fall back to a full handshake.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_READ if a read on the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the response could
+ *        not be verified.
+ *      - the status returned by the server if it rejected the ticket.
+ *      - a non-zero error code on failure.
+ */
+status vcblockchain_protocol_recvresp_handshake_resume(
+    RCPR_SYM(psock)* sock, RCPR_SYM(allocator)* a,
+    vccrypt_suite_options_t* suite, const vccrypt_buffer_t* resumption_secret,
+    const vccrypt_buffer_t* client_key_nonce, vccrypt_buffer_t* shared_secret,
+    uint64_t* client_iv, uint64_t* server_iv, uint32_t* offset,
+    uint32_t* status)
+{
+    int retval = 0, release_retval = 0;
+
+    /* parameter sanity check. */
+    MODEL_ASSERT(NULL != sock);
+    MODEL_ASSERT(NULL != a);
+    MODEL_ASSERT(NULL != suite);
+    MODEL_ASSERT(NULL != resumption_secret);
+    MODEL_ASSERT(NULL != client_key_nonce);
+    MODEL_ASSERT(NULL != shared_secret);
+    MODEL_ASSERT(NULL != client_iv);
+    MODEL_ASSERT(NULL != server_iv);
+    MODEL_ASSERT(NULL != offset);
+    MODEL_ASSERT(NULL != status);
+
+    /* read a data packet from the socket. */
+    void* val = NULL;
+    size_t size = 0;
+    retval = psock_read_boxed_data(sock, a, &val, &size);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* decode the packet. */
+    protocol_resp_handshake_resume resp;
+    retval =
+        vcblockchain_protocol_decode_resp_handshake_resume(
+            &resp, suite, val, size);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_val;
+    }
+
+    /* derive the shared secret for the resumed session. */
+    vccrypt_buffer_t local_shared_secret;
+    retval =
+        vcblockchain_protocol_resumed_shared_secret_create(
+            &local_shared_secret, suite, resumption_secret, client_key_nonce,
+            &resp.server_key_nonce);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_resp;
+    }
+
+    /* create the mac instance. */
+    vccrypt_mac_context_t mac;
+    retval = vccrypt_suite_mac_short_init(suite, &mac, &local_shared_secret);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_shared_secret;
+    }
+
+    /* create hmac buffer. */
+    vccrypt_buffer_t local_hmac_buffer;
+    retval =
+        vccrypt_suite_buffer_init_for_mac_authentication_code(
+            suite, &local_hmac_buffer, true);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_mac;
+    }
+
+    /* digest the payload, minus the mac. */
+    retval =
+        vccrypt_mac_digest(
+            &mac, (const uint8_t*)val, size - local_hmac_buffer.size);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_local_hmac_buffer;
+    }
+
+    /* add the client key nonce to the digest. */
+    retval =
+        vccrypt_mac_digest(
+            &mac, (const uint8_t*)client_key_nonce->data,
+            client_key_nonce->size);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_local_hmac_buffer;
+    }
+
+    /* finalize the mac. */
+    retval = vccrypt_mac_finalize(&mac, &local_hmac_buffer);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_local_hmac_buffer;
+    }
+
+    /* verify that the hmac matches. */
+    if (0 !=
+            crypto_memcmp(
+                local_hmac_buffer.data, resp.server_cr_hmac.data,
+                local_hmac_buffer.size))
+    {
+        retval = VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE;
+        goto cleanup_local_hmac_buffer;
+    }
+
+    /* success. */
+    retval = VCBLOCKCHAIN_STATUS_SUCCESS;
+
+    /* move the shared secret. */
+    vccrypt_buffer_move(shared_secret, &local_shared_secret);
+
+    /* set the client and server IVs, as the handshake ack would. */
+    *client_iv = 0x0000000000000001;
+    *server_iv = 0x8000000000000001;
+
+    /* copy offset and status. */
+    *offset = resp.offset;
+    *status = resp.status;
+
+cleanup_local_hmac_buffer:
+    dispose((disposable_t*)&local_hmac_buffer);
+
+cleanup_mac:
+    dispose((disposable_t*)&mac);
+
+cleanup_shared_secret:
+    dispose((disposable_t*)&local_shared_secret);
+
+cleanup_resp:
+    dispose((disposable_t*)&resp);
+
+cleanup_val:
+    memset(val, 0, size);
+    release_retval = rcpr_allocator_reclaim(a, val);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
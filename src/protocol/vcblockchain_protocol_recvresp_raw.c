@@ -0,0 +1,86 @@
+/**
+ * \file protocol/vcblockchain_protocol_recvresp_raw.c
+ *
+ * \brief Receive a request response from the server without copying it.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol.h>
+#include <vcblockchain/psock.h>
+
+/**
+ * \brief Receive a response from the API, adopting the decrypted payload.
+ *
+ * \param sock                      The socket from which this response is read.
+ * \param a                         The allocator to use for this operation.
+ * \param suite                     The crypto suite to use for this read.
+ * \param server_iv                 Pointer to the server_iv to use, updated as
+ *                                  a consequence of this call.
+ * \param shared_secret             The shared secret key for this request.
+ * \param payload                   Pointer to receive the decrypted payload on
+ *                                  success.
+ * \param payload_size              Pointer to receive the size of the payload
+ *                                  on success.
+ *
+ * \note - this function requires that the handshake request send / receive, and
+ * the handshake ack send have each been performed before it can be used.
+ *
+ * This call reads a response from the protocol. On success, the server_iv is
+ * incremented, and \p payload is set to the plaintext exactly as it was
+ * decrypted by the socket layer. Unlike \ref vcblockchain_protocol_recvresp,
+ * the payload is not copied into a crypto buffer. It is allocated by \p a, is
+ * owned by the caller, and must be released by calling
+ * \ref vcblockchain_protocol_recvresp_raw_release when no longer needed. The
+ * caller can decode it in place by passing it to the matching response decode
+ * function.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_READ if reading from the socket failed.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_protocol_recvresp_raw(
+    RCPR_SYM(psock)* sock, RCPR_SYM(allocator)* a,
+    vccrypt_suite_options_t* suite, uint64_t* server_iv,
+    const vccrypt_buffer_t* shared_secret, void** payload,
+    uint32_t* payload_size)
+{
+    int retval;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != sock);
+    MODEL_ASSERT(NULL != a);
+    MODEL_ASSERT(NULL != suite);
+    MODEL_ASSERT(NULL != server_iv);
+    MODEL_ASSERT(NULL != shared_secret);
+    MODEL_ASSERT(NULL != payload);
+    MODEL_ASSERT(NULL != payload_size);
+
+    /* runtime parameter checks. */
+    if (NULL == sock || NULL == a || NULL == suite || NULL == server_iv
+     || NULL == shared_secret || NULL == payload || NULL == payload_size)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* read an authed data packet from the server. */
+    retval =
+        psock_read_authed_data(
+            sock, a, *server_iv, payload, payload_size, suite,
+            shared_secret);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* increment the server iv. */
+    ++(*server_iv);
+
+    /* success. */
+    /* the payload is owned by the caller on success. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
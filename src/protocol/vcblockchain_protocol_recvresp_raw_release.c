@@ -0,0 +1,49 @@
+/**
+ * \file protocol/vcblockchain_protocol_recvresp_raw_release.c
+ *
+ * \brief Release a payload received by vcblockchain_protocol_recvresp_raw.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol.h>
+
+RCPR_IMPORT_allocator_as(rcpr);
+
+/**
+ * \brief Release a payload received by \ref vcblockchain_protocol_recvresp_raw.
+ *
+ * \param a                         The allocator used to receive this payload.
+ * \param payload                   The payload to release.
+ * \param payload_size              The size of the payload.
+ *
+ * The payload is plaintext from an authenticated channel, so it is wiped before
+ * it is returned to the allocator.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - a non-zero error response if reclaiming the payload failed.
+ */
+status vcblockchain_protocol_recvresp_raw_release(
+    RCPR_SYM(allocator)* a, void* payload, uint32_t payload_size)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != a);
+    MODEL_ASSERT(NULL != payload);
+
+    /* runtime parameter checks. */
+    if (NULL == a || NULL == payload)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* wipe the plaintext. */
+    memset(payload, 0, payload_size);
+
+    /* return it to the allocator that created it. */
+    return rcpr_allocator_reclaim(a, payload);
+}
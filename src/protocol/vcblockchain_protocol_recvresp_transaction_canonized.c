@@ -0,0 +1,140 @@
+/**
+ * \file protocol/vcblockchain_protocol_recvresp_transaction_canonized.c
+ *
+ * \brief Wait for a transaction canonized notification from the server.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol.h>
+#include <vcblockchain/protocol/serialization.h>
+
+#include "recvresp_internal.h"
+
+/**
+ * \brief Wait for a transaction canonized notification from the API and decode
+ * it.
+ *
+ * \param sock                      The socket from which this response is read.
+ * \param a                         The allocator to use for this operation.
+ * \param suite                     The crypto suite to use for this read.
+ * \param server_iv                 Pointer to the server_iv to use, updated as
+ *                                  a consequence of this call.
+ * \param shared_secret             The shared secret key for this request.
+ * \param resp                      The notification structure to initialize.
+ *
+ * \note - this function requires that the handshake request send / receive, and
+ * the handshake ack send have each been performed before it can be used.
+ *
+ * This call waits for the outcome of a request sent by \ref
+ * vcblockchain_protocol_sendreq_transaction_submit_await. If the next response
+ * is the acknowledgement for this submission, then it is consumed, and this
+ * call continues to wait for the notification that follows it. The
+ * notification is decoded directly from the decrypted payload. The server_iv
+ * is incremented once for each response read. On success, \p resp is
+ * initialized and owned by the caller, who must \ref dispose() it when it is
+ * no longer needed. If the submission failed or its deadline expired, then the
+ * status returned by the server is returned, and \p resp is not initialized.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_READ if reading from the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the response was not
+ *        a transaction canonized notification.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_CANONIZATION_EXPIRED if the transaction
+ *        was not canonized before the deadline.
+ *      - the status returned by the server if the request failed.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_protocol_recvresp_transaction_canonized(
+    RCPR_SYM(psock)* sock, RCPR_SYM(allocator)* a,
+    vccrypt_suite_options_t* suite, uint64_t* server_iv,
+    const vccrypt_buffer_t* shared_secret,
+    protocol_resp_transaction_canonized* resp)
+{
+    int retval, release_retval;
+    void* payload = NULL;
+    uint32_t payload_size = 0U;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != resp);
+
+    /* runtime parameter checks. */
+    if (NULL == resp)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    for (;;)
+    {
+        /* read the next response without copying it. */
+        retval =
+            vcblockchain_protocol_recvresp_raw(
+                sock, a, suite, server_iv, shared_secret, &payload,
+                &payload_size);
+        if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        /* anything other than the acknowledgement should be the outcome. */
+        retval =
+            vcblockchain_protocol_recvresp_check_header(
+                payload, payload_size,
+                PROTOCOL_REQ_ID_TRANSACTION_SUBMIT_AWAIT);
+        if (VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE == retval)
+        {
+            break;
+        }
+        else if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+        {
+            /* the submission was rejected. */
+            goto cleanup_payload;
+        }
+
+        /* the submission was accepted, so skip the acknowledgement. */
+        retval =
+            vcblockchain_protocol_recvresp_raw_release(
+                a, payload, payload_size);
+        if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    /* verify that this is a transaction canonized notification. */
+    retval =
+        vcblockchain_protocol_recvresp_check_header(
+            payload, payload_size, PROTOCOL_REQ_ID_TRANSACTION_CANONIZED);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_payload;
+    }
+
+    /* decode the notification directly from the payload. */
+    retval =
+        vcblockchain_protocol_decode_resp_transaction_canonized(
+            resp, payload, payload_size);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_payload;
+    }
+
+    /* success. */
+    /* the decoded notification is owned by the caller on success. */
+
+cleanup_payload:
+    release_retval =
+        vcblockchain_protocol_recvresp_raw_release(a, payload, payload_size);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != release_retval
+     && VCBLOCKCHAIN_STATUS_SUCCESS == retval)
+    {
+        dispose((disposable_t*)resp);
+        retval = release_retval;
+    }
+
+    return retval;
+}
@@ -0,0 +1,123 @@
+/**
+ * \file protocol/vcblockchain_protocol_rekeyed_shared_secret_create.c
+ *
+ * \brief Derive the next shared secret for a session being rekeyed.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol.h>
+
+/* the label that separates rekeyed secrets from other derived secrets. */
+static const char REKEY_LABEL[] = "vcblockchain rekey";
+
+/**
+ * \brief Derive the next shared secret for a session being rekeyed.
+ *
+ * \param shared_secret             The buffer to receive the shared secret.
+ *                                  Must not have been previously initialized.
+ *                                  On success, it is initialized and owned by
+ *                                  the caller, and must be disposed when no
+ *                                  longer needed.
+ * \param suite                     The crypto suite to use for this operation.
+ * \param current_secret            The shared secret currently in use.
+ * \param client_key_nonce          The client key nonce for this rekey.
+ * \param server_key_nonce          The server key nonce for this rekey.
+ *
+ * The new shared secret is the short MAC of a fixed label, the client key
+ * nonce, and the server key nonce, keyed by the current shared secret. The
+ * label keeps it distinct from the other secrets derived from the current
+ * shared secret, such as a resumption secret. Since the MAC is one-way, a
+ * later secret does not reveal the secrets before it.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered.
+ *      - a non-zero error code on failure.
+ */
+status vcblockchain_protocol_rekeyed_shared_secret_create(
+    vccrypt_buffer_t* shared_secret, vccrypt_suite_options_t* suite,
+    const vccrypt_buffer_t* current_secret,
+    const vccrypt_buffer_t* client_key_nonce,
+    const vccrypt_buffer_t* server_key_nonce)
+{
+    int retval;
+    vccrypt_buffer_t local_secret;
+    vccrypt_mac_context_t mac;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != shared_secret);
+    MODEL_ASSERT(NULL != suite);
+    MODEL_ASSERT(NULL != current_secret);
+    MODEL_ASSERT(NULL != client_key_nonce);
+    MODEL_ASSERT(NULL != server_key_nonce);
+
+    /* create a buffer for the shared secret. */
+    retval =
+        vccrypt_suite_buffer_init_for_mac_authentication_code(
+            suite, &local_secret, true);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        retval = VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+        goto done;
+    }
+
+    /* create a mac instance keyed by the current secret. */
+    retval =
+        vccrypt_suite_mac_short_init(
+            suite, &mac, (vccrypt_buffer_t*)current_secret);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_local_secret;
+    }
+
+    /* digest the label. */
+    retval =
+        vccrypt_mac_digest(
+            &mac, (const uint8_t*)REKEY_LABEL, sizeof(REKEY_LABEL) - 1);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_mac;
+    }
+
+    /* digest the client key nonce. */
+    retval =
+        vccrypt_mac_digest(
+            &mac, client_key_nonce->data, client_key_nonce->size);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_mac;
+    }
+
+    /* digest the server key nonce. */
+    retval =
+        vccrypt_mac_digest(
+            &mac, server_key_nonce->data, server_key_nonce->size);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_mac;
+    }
+
+    /* finalize the mac. */
+    retval = vccrypt_mac_finalize(&mac, &local_secret);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_mac;
+    }
+
+    /* success. move the secret to the caller. */
+    vccrypt_buffer_move(shared_secret, &local_secret);
+    retval = VCBLOCKCHAIN_STATUS_SUCCESS;
+
+cleanup_mac:
+    dispose((disposable_t*)&mac);
+
+cleanup_local_secret:
+    dispose((disposable_t*)&local_secret);
+
+done:
+    return retval;
+}
@@ -6,11 +6,12 @@
  * \copyright 2020 Velo Payments, Inc.  All rights reserved.
  */
 
-#include <arpa/inet.h>
 #include <cbmc/model_assert.h>
 #include <vcblockchain/error_codes.h>
 #include <vcblockchain/protocol.h>
 
+#include "wire_internal.h"
+
 /**
  * \brief Decode the header values of a response.
  *
@@ -57,10 +58,11 @@ int vcblockchain_protocol_response_decode_header(
     }
 
     /* copy the header data. */
-    const uint32_t* u32buf = (const uint32_t*)response->data;
-    *request_id = ntohl(u32buf[0]);
-    *status = ntohl(u32buf[1]);
-    *offset = ntohl(u32buf[2]);
+    vcblockchain_wire_reader reader;
+    vcblockchain_wire_reader_init(&reader, response->data, response->size);
+    *request_id = vcblockchain_wire_read_u32(&reader);
+    *status = vcblockchain_wire_read_u32(&reader);
+    *offset = vcblockchain_wire_read_u32(&reader);
 
     /* success. */
     return VCBLOCKCHAIN_STATUS_SUCCESS;
@@ -0,0 +1,96 @@
+/**
+ * \file protocol/vcblockchain_protocol_resumption_secret_create.c
+ *
+ * \brief Derive the resumption secret bound to a resumption ticket.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol.h>
+
+/**
+ * \brief Derive the resumption secret bound to a resumption ticket.
+ *
+ * \param resumption_secret         The buffer to receive the resumption
+ *                                  secret. Must not have been previously
+ *                                  initialized. On success, it is initialized
+ *                                  and owned by the caller, and must be
+ *                                  disposed when no longer needed.
+ * \param suite                     The crypto suite to use for this operation.
+ * \param shared_secret             The shared secret of the session for which
+ *                                  the ticket was issued.
+ * \param ticket                    The resumption ticket.
+ *
+ * The resumption secret is the short MAC of the ticket, keyed by the shared
+ * secret of the session that was issued the ticket. The client keeps it with
+ * the ticket in place of that shared secret. The agent recovers the shared
+ * secret by opening the ticket, and derives the same resumption secret.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if an out-of-memory condition was
+ *        encountered.
+ *      - a non-zero error code on failure.
+ */
+status vcblockchain_protocol_resumption_secret_create(
+    vccrypt_buffer_t* resumption_secret, vccrypt_suite_options_t* suite,
+    const vccrypt_buffer_t* shared_secret, const vccrypt_buffer_t* ticket)
+{
+    int retval;
+    vccrypt_buffer_t local_secret;
+    vccrypt_mac_context_t mac;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != resumption_secret);
+    MODEL_ASSERT(NULL != suite);
+    MODEL_ASSERT(NULL != shared_secret);
+    MODEL_ASSERT(NULL != ticket);
+
+    /* create a buffer for the resumption secret. */
+    retval =
+        vccrypt_suite_buffer_init_for_mac_authentication_code(
+            suite, &local_secret, true);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        retval = VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+        goto done;
+    }
+
+    /* create a mac instance keyed by the shared secret. */
+    retval =
+        vccrypt_suite_mac_short_init(
+            suite, &mac, (vccrypt_buffer_t*)shared_secret);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_local_secret;
+    }
+
+    /* digest the ticket. */
+    retval = vccrypt_mac_digest(&mac, ticket->data, ticket->size);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_mac;
+    }
+
+    /* finalize the mac. */
+    retval = vccrypt_mac_finalize(&mac, &local_secret);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_mac;
+    }
+
+    /* success. move the secret to the caller. */
+    vccrypt_buffer_move(resumption_secret, &local_secret);
+    retval = VCBLOCKCHAIN_STATUS_SUCCESS;
+
+cleanup_mac:
+    dispose((disposable_t*)&mac);
+
+cleanup_local_secret:
+    dispose((disposable_t*)&local_secret);
+
+done:
+    return retval;
+}
@@ -0,0 +1,98 @@
+/**
+ * \file
+ * protocol/vcblockchain_protocol_sendreq_artifact_last_txn_id_get_if_changed.c
+ *
+ * \brief Send a conditional artifact last txn id get request to the server.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vcblockchain/psock.h>
+
+/**
+ * \brief Send an artifact get last transaction id request to the API that only
+ * returns the transaction id if it differs from the one known to the client.
+ *
+ * \param sock                      The socket to which this request is written.
+ * \param suite                     The crypto suite to use for this handshake.
+ * \param client_iv                 Pointer to the client IV, updated by this
+ *                                  call.
+ * \param shared_secret             The shared secret key for this request.
+ * \param offset                    The offset to use for this request. It
+ *                                  should be unique per any outbound request
+ *                                  for which a response has not yet been
+ *                                  received.
+ * \param timeout_ms                The maximum time in milliseconds that the
+ *                                  server may hold this request open waiting
+ *                                  for a new transaction, or 0 to answer at
+ *                                  once.
+ * \param artifact_id               The artifact UUID to get.
+ * \param last_txn_id               The last transaction id for this artifact
+ *                                  known to the client.
+ *
+ * This function sends the conditional artifact get last transaction request to
+ * the server. If the last transaction id for this artifact differs from \p
+ * last_txn_id, then the server responds at once with the new transaction id.
+ * Otherwise, the server waits up to \p timeout_ms for a new transaction, and
+ * responds with a header-only response with a status of \ref
+ * VCBLOCKCHAIN_ERROR_PROTOCOL_NOT_MODIFIED if none arrives.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_protocol_sendreq_artifact_last_txn_id_get_if_changed(
+    RCPR_SYM(psock)* sock, vccrypt_suite_options_t* suite, uint64_t* client_iv,
+    const vccrypt_buffer_t* shared_secret, uint32_t offset,
+    uint32_t timeout_ms, const vpr_uuid* artifact_id,
+    const vpr_uuid* last_txn_id)
+{
+    int retval;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != sock);
+    MODEL_ASSERT(NULL != suite);
+    MODEL_ASSERT(NULL != client_iv);
+    MODEL_ASSERT(NULL != shared_secret);
+    MODEL_ASSERT(NULL != artifact_id);
+    MODEL_ASSERT(NULL != last_txn_id);
+
+    /* encode the request. */
+    vccrypt_buffer_t buffer;
+    retval =
+        vcblockchain_protocol_encode_req_artifact_last_txn_id_get_if_changed(
+            &buffer, suite->alloc_opts, offset, timeout_ms, artifact_id,
+            last_txn_id);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* write the IPC authed data packet to the server. */
+    retval =
+        psock_write_authed_data(
+            sock, *client_iv, buffer.data, buffer.size, suite, shared_secret);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_buffer;
+    }
+
+    /* increment client IV. */
+    *client_iv += 1;
+
+    /* success. */
+    retval = VCBLOCKCHAIN_STATUS_SUCCESS;
+
+cleanup_buffer:
+    dispose((disposable_t*)&buffer);
+
+done:
+    return retval;
+}
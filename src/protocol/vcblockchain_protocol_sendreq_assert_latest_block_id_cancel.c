@@ -25,7 +25,8 @@
  *                                  for which a response has not yet been
  *                                  received.
  *
- * This function sends a connection close request to the server.
+ * This function cancels a pending latest block id assertion or block
+ * subscription.
  *
  * \returns a status code indicating success or failure.
  *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
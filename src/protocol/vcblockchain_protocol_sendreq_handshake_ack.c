@@ -11,6 +11,8 @@
 #include <vcblockchain/protocol.h>
 #include <vcblockchain/psock.h>
 
+#include "handshake_internal.h"
+
 /**
  * \brief Send a handshake acknowledge to the API.
  *
@@ -46,40 +48,14 @@ status vcblockchain_protocol_sendreq_handshake_ack(
     MODEL_ASSERT(NULL != shared_secret);
     MODEL_ASSERT(NULL != server_challenge_nonce);
 
-    /* create a buffer for holding the digest. */
+    /* compute the response to the server challenge. */
     vccrypt_buffer_t digest;
-    if (VCCRYPT_STATUS_SUCCESS !=
-        vccrypt_suite_buffer_init_for_mac_authentication_code(
-            suite, &digest, true))
-    {
-        retval = VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
-        goto done;
-    }
-
-    /* create a mac instance for building the response to the challenge. */
-    vccrypt_mac_context_t mac;
     retval =
-        vccrypt_suite_mac_short_init(
-            suite, &mac, (vccrypt_buffer_t*)shared_secret);
-    if (VCCRYPT_STATUS_SUCCESS != retval)
-    {
-        goto cleanup_digest;
-    }
-
-    /* digest the server challenge nonce. */
-    retval =
-        vccrypt_mac_digest(
-            &mac, server_challenge_nonce->data, server_challenge_nonce->size);
-    if (VCCRYPT_STATUS_SUCCESS != retval)
-    {
-        goto cleanup_mac;
-    }
-
-    /* finalize the digest. */
-    retval = vccrypt_mac_finalize(&mac, &digest);
-    if (VCCRYPT_STATUS_SUCCESS != retval)
+        protocol_handshake_ack_digest_create(
+            &digest, suite, shared_secret, server_challenge_nonce);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
     {
-        goto cleanup_mac;
+        goto done;
     }
 
     /* set the client and server IVs. */
@@ -92,7 +68,7 @@ status vcblockchain_protocol_sendreq_handshake_ack(
             sock, *client_iv, digest.data, digest.size, suite, shared_secret);
     if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
     {
-        goto cleanup_mac;
+        goto cleanup_digest;
     }
 
     /* increment client IV. */
@@ -101,9 +77,6 @@ status vcblockchain_protocol_sendreq_handshake_ack(
     /* success. */
     retval = VCBLOCKCHAIN_STATUS_SUCCESS;
 
-cleanup_mac:
-    dispose((disposable_t*)&mac);
-
 cleanup_digest:
     dispose((disposable_t*)&digest);
 
@@ -0,0 +1,144 @@
+/**
+ * \file protocol/vcblockchain_protocol_sendreq_handshake_ack_with_request.c
+ *
+ * \brief Send a handshake ack request to the server, along with the first
+ * request of the session.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol.h>
+#include <vcblockchain/psock.h>
+
+#include "handshake_internal.h"
+
+RCPR_IMPORT_psock;
+
+/**
+ * \brief Send a handshake acknowledge to the API, along with the first request
+ * of the session.
+ *
+ * \param sock                      The socket to which this request is written.
+ * \param suite                     The crypto suite to use for this handshake.
+ * \param client_iv                 Pointer to receive the updated client IV.
+ * \param server_iv                 Pointer to receive the updated server IV.
+ * \param shared_secret             The shared secret key for this request.
+ * \param server_challenge_nonce    The server challenge nonce for this request.
+ * \param request                   The encoded first request, such as one built
+ *                                  by a request encode function.
+ * \param request_size              The size of the encoded first request.
+ *
+ * This function seals the handshake acknowledgement and the first request as
+ * consecutive authorized packets, then writes both to the server in a single
+ * write, so they leave in the same segment. The server reads them in order, so
+ * it answers with the handshake acknowledgement response and then the response
+ * to the first request, without waiting for another round trip. The caller
+ * reads both responses in that order.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_protocol_sendreq_handshake_ack_with_request(
+    RCPR_SYM(psock)* sock, vccrypt_suite_options_t* suite, uint64_t* client_iv,
+    uint64_t* server_iv, const vccrypt_buffer_t* shared_secret,
+    const vccrypt_buffer_t* server_challenge_nonce, const void* request,
+    uint32_t request_size)
+{
+    int retval;
+    vccrypt_buffer_t digest, ack_packet, request_packet, packets;
+    vcblockchain_psock_iovec vec;
+    const uint64_t ack_iv = 0x0000000000000001;
+
+    /* parameter sanity checking. */
+    MODEL_ASSERT(NULL != sock);
+    MODEL_ASSERT(NULL != suite);
+    MODEL_ASSERT(NULL != client_iv);
+    MODEL_ASSERT(NULL != server_iv);
+    MODEL_ASSERT(NULL != shared_secret);
+    MODEL_ASSERT(NULL != server_challenge_nonce);
+    MODEL_ASSERT(NULL != request);
+
+    /* compute the response to the server challenge. */
+    retval =
+        protocol_handshake_ack_digest_create(
+            &digest, suite, shared_secret, server_challenge_nonce);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* seal the handshake acknowledgement. */
+    vec.data = digest.data;
+    vec.size = digest.size;
+    retval =
+        psock_seal_authed_datav(
+            &ack_packet, ack_iv, &vec, 1, suite, shared_secret);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_digest;
+    }
+
+    /* seal the first request, using the IV that follows the ack. */
+    vec.data = request;
+    vec.size = request_size;
+    retval =
+        psock_seal_authed_datav(
+            &request_packet, ack_iv + 1, &vec, 1, suite, shared_secret);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_ack_packet;
+    }
+
+    /* join the packets, so they are written together. */
+    retval =
+        vccrypt_buffer_init(
+            &packets, suite->alloc_opts,
+            ack_packet.size + request_packet.size);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        retval = VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+        goto cleanup_request_packet;
+    }
+
+    memcpy(packets.data, ack_packet.data, ack_packet.size);
+    memcpy(
+        (uint8_t*)packets.data + ack_packet.size, request_packet.data,
+        request_packet.size);
+
+    /* write both packets to the server. */
+    retval = psock_write_raw_data(sock, packets.data, packets.size);
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = VCBLOCKCHAIN_ERROR_SSOCK_WRITE;
+        goto cleanup_packets;
+    }
+
+    /* set the client and server IVs, accounting for both packets. */
+    *client_iv = ack_iv + 2;
+    *server_iv = 0x8000000000000001;
+
+    /* success. */
+    retval = VCBLOCKCHAIN_STATUS_SUCCESS;
+
+cleanup_packets:
+    dispose((disposable_t*)&packets);
+
+cleanup_request_packet:
+    dispose((disposable_t*)&request_packet);
+
+cleanup_ack_packet:
+    dispose((disposable_t*)&ack_packet);
+
+cleanup_digest:
+    dispose((disposable_t*)&digest);
+
+done:
+    return retval;
+}
@@ -0,0 +1,114 @@
+/**
+ * \file protocol/vcblockchain_protocol_sendreq_handshake_resume.c
+ *
+ * \brief Send a handshake resume request to the server.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol.h>
+#include <vcblockchain/protocol/data.h>
+#include <vcblockchain/protocol/serialization.h>
+
+RCPR_IMPORT_psock;
+
+/**
+ * \brief Send a handshake resume request to the API.
+ *
+ * \param sock              The socket to which this request is written.
+ * \param suite             The crypto suite to use for this handshake.
+ * \param client_id         The entity UUID for the client.
+ * \param ticket            The resumption ticket issued by the agent during a
+ *                          previous session.
+ * \param key_nonce         Buffer to receive the client key nonce for this
+ *                          request. This buffer must not have been previously
+ *                          initialized. On success, this is initialized and
+ *                          owned by the caller; it must be disposed by the
+ *                          caller when no longer needed.
+ *
+ * This function generates entropy data for the key nonce based on the suite,
+ * and sends it to the server with the ticket. No challenge nonce is needed,
+ * since the server can only answer with a valid MAC if it can open the ticket.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if a write to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if an out-of-memory issue was
+ *        encountered.
+ *      - a non-zero error code on failure.
+ */
+status vcblockchain_protocol_sendreq_handshake_resume(
+    RCPR_SYM(psock)* sock, vccrypt_suite_options_t* suite,
+    const vpr_uuid* client_id, const vccrypt_buffer_t* ticket,
+    vccrypt_buffer_t* key_nonce)
+{
+    int retval = 0;
+
+    /* parameter sanity check. */
+    MODEL_ASSERT(NULL != sock);
+    MODEL_ASSERT(NULL != suite);
+    MODEL_ASSERT(NULL != client_id);
+    MODEL_ASSERT(NULL != ticket);
+    MODEL_ASSERT(NULL != key_nonce);
+
+    /* create prng. */
+    vccrypt_prng_context_t prng;
+    retval = vccrypt_suite_prng_init(suite, &prng);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* initialize key nonce buffer. */
+    retval =
+        vccrypt_suite_buffer_init_for_cipher_key_agreement_nonce(
+            suite, key_nonce);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_prng;
+    }
+
+    /* read key nonce from prng. */
+    retval = vccrypt_prng_read(&prng, key_nonce, key_nonce->size);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_key_nonce;
+    }
+
+    /* create handshake resume payload buffer. */
+    vccrypt_buffer_t payload;
+    retval =
+        vcblockchain_protocol_encode_req_handshake_resume(
+            &payload, suite, 0U, client_id, key_nonce, ticket);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_key_nonce;
+    }
+
+    /* write data packet with request payload to socket. */
+    retval = psock_write_boxed_data(sock, payload.data, payload.size);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_payload;
+    }
+
+    /* success. */
+    retval = VCBLOCKCHAIN_STATUS_SUCCESS;
+
+cleanup_payload:
+    dispose((disposable_t*)&payload);
+
+cleanup_key_nonce:
+    if (retval != VCBLOCKCHAIN_STATUS_SUCCESS)
+    {
+        dispose((disposable_t*)key_nonce);
+    }
+
+cleanup_prng:
+    dispose((disposable_t*)&prng);
+
+done:
+    return retval;
+}
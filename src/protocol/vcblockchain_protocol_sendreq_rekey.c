@@ -0,0 +1,126 @@
+/**
+ * \file protocol/vcblockchain_protocol_sendreq_rekey.c
+ *
+ * \brief Send a rekey request to the server.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vcblockchain/psock.h>
+
+/**
+ * \brief Send a rekey request to the API.
+ *
+ * \param sock                      The socket to which this request is written.
+ * \param suite                     The crypto suite to use for this request.
+ * \param client_iv                 Pointer to the client IV, updated by this
+ *                                  call.
+ * \param shared_secret             The shared secret key for this request.
+ * \param offset                    The offset to use for this request. It
+ *                                  should be unique per any outbound request
+ *                                  for which a response has not yet been
+ *                                  received.
+ * \param key_nonce                 Buffer to receive the client key nonce for
+ *                                  this request. This buffer must not have
+ *                                  been previously initialized. On success,
+ *                                  this is initialized and owned by the
+ *                                  caller; it must be disposed by the caller
+ *                                  when no longer needed.
+ *
+ * This function generates a fresh key nonce, and asks the server to switch to
+ * a new shared secret, derived by \ref
+ * vcblockchain_protocol_rekeyed_shared_secret_create, starting with the client
+ * packet that follows this request. On success, \p client_iv is that boundary.
+ * The caller must not send another packet until it has received the rekey
+ * response, since the new secret depends on the server key nonce. Responses to
+ * requests sent before this one keep arriving in the meantime.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if writing to the socket failed.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if this operation encountered an
+ *        out-of-memory error.
+ *      - a non-zero error response if something else has failed.
+ */
+status vcblockchain_protocol_sendreq_rekey(
+    RCPR_SYM(psock)* sock, vccrypt_suite_options_t* suite, uint64_t* client_iv,
+    const vccrypt_buffer_t* shared_secret, uint32_t offset,
+    vccrypt_buffer_t* key_nonce)
+{
+    int retval;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != sock);
+    MODEL_ASSERT(NULL != suite);
+    MODEL_ASSERT(NULL != client_iv);
+    MODEL_ASSERT(NULL != shared_secret);
+    MODEL_ASSERT(NULL != key_nonce);
+
+    /* create prng. */
+    vccrypt_prng_context_t prng;
+    retval = vccrypt_suite_prng_init(suite, &prng);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* initialize key nonce buffer. */
+    retval =
+        vccrypt_suite_buffer_init_for_cipher_key_agreement_nonce(
+            suite, key_nonce);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_prng;
+    }
+
+    /* read key nonce from prng. */
+    retval = vccrypt_prng_read(&prng, key_nonce, key_nonce->size);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_key_nonce;
+    }
+
+    /* encode the request, which switches keys after its own packet. */
+    vccrypt_buffer_t buffer;
+    retval =
+        vcblockchain_protocol_encode_req_rekey(
+            &buffer, suite, offset, *client_iv + 1, key_nonce);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_key_nonce;
+    }
+
+    /* write the IPC authed data packet to the server. */
+    retval =
+        psock_write_authed_data(
+            sock, *client_iv, buffer.data, buffer.size, suite, shared_secret);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_buffer;
+    }
+
+    /* increment client IV. */
+    *client_iv += 1;
+
+    /* success. */
+    retval = VCBLOCKCHAIN_STATUS_SUCCESS;
+
+cleanup_buffer:
+    dispose((disposable_t*)&buffer);
+
+cleanup_key_nonce:
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        dispose((disposable_t*)key_nonce);
+    }
+
+cleanup_prng:
+    dispose((disposable_t*)&prng);
+
+done:
+    return retval;
+}
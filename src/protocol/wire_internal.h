@@ -0,0 +1,301 @@
+/**
+ * \file protocol/wire_internal.h
+ *
+ * \brief Inline cursors for reading and writing protocol messages.
+ *
+ * Codecs check the size of a message once, either by allocating an encode
+ * buffer of exactly the right size or by checking the payload size against the
+ * minimum message size before decoding. After that, the cursors below read or
+ * write each field in order without further runtime bounds checks; the model
+ * checker verifies that no field crosses the end of the message.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VCBLOCKCHAIN_PROTOCOL_WIRE_INTERNAL_HEADER_GUARD
+#define VCBLOCKCHAIN_PROTOCOL_WIRE_INTERNAL_HEADER_GUARD
+
+#include <cbmc/model_assert.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <vcblockchain/byteswap.h>
+#include <vpr/uuid.h>
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif /*__cplusplus*/
+
+/**
+ * \brief A read cursor over a received protocol message.
+ */
+typedef struct vcblockchain_wire_reader
+{
+    const uint8_t* ptr;
+    const uint8_t* end;
+} vcblockchain_wire_reader;
+
+/**
+ * \brief A write cursor over a protocol message being encoded.
+ */
+typedef struct vcblockchain_wire_writer
+{
+    uint8_t* ptr;
+    uint8_t* end;
+} vcblockchain_wire_writer;
+
+/**
+ * \brief Convert a 32-bit value between host and network byte order.
+ *
+ * \param val       The value to convert.
+ *
+ * \returns the converted value.
+ */
+static inline uint32_t vcblockchain_wire_swap_32(uint32_t val)
+{
+#ifdef VCBLOCKCHAIN_LITTLE_ENDIAN
+    return __builtin_bswap32(val);
+#else
+    return val;
+#endif
+}
+
+/**
+ * \brief Convert a 64-bit value between host and network byte order.
+ *
+ * \param val       The value to convert.
+ *
+ * \returns the converted value.
+ */
+static inline uint64_t vcblockchain_wire_swap_64(uint64_t val)
+{
+#ifdef VCBLOCKCHAIN_LITTLE_ENDIAN
+    return __builtin_bswap64(val);
+#else
+    return val;
+#endif
+}
+
+/**
+ * \brief Initialize a read cursor over a payload.
+ *
+ * \param reader        The reader to initialize.
+ * \param payload       The payload to read.
+ * \param payload_size  The size of the payload.
+ */
+static inline void vcblockchain_wire_reader_init(
+    vcblockchain_wire_reader* reader, const void* payload, size_t payload_size)
+{
+    reader->ptr = (const uint8_t*)payload;
+    reader->end = reader->ptr + payload_size;
+}
+
+/**
+ * \brief Get the number of bytes remaining in a read cursor.
+ *
+ * \param reader        The reader.
+ *
+ * \returns the number of unread bytes.
+ */
+static inline size_t vcblockchain_wire_reader_remaining(
+    const vcblockchain_wire_reader* reader)
+{
+    return (size_t)(reader->end - reader->ptr);
+}
+
+/**
+ * \brief Read a network order 32-bit value.
+ *
+ * \param reader        The reader.
+ *
+ * \returns the value in host order.
+ */
+static inline uint32_t vcblockchain_wire_read_u32(
+    vcblockchain_wire_reader* reader)
+{
+    uint32_t val;
+
+    MODEL_ASSERT(vcblockchain_wire_reader_remaining(reader) >= sizeof(val));
+
+    memcpy(&val, reader->ptr, sizeof(val));
+    reader->ptr += sizeof(val);
+
+    return vcblockchain_wire_swap_32(val);
+}
+
+/**
+ * \brief Read a network order 64-bit value.
+ *
+ * \param reader        The reader.
+ *
+ * \returns the value in host order.
+ */
+static inline uint64_t vcblockchain_wire_read_u64(
+    vcblockchain_wire_reader* reader)
+{
+    uint64_t val;
+
+    MODEL_ASSERT(vcblockchain_wire_reader_remaining(reader) >= sizeof(val));
+
+    memcpy(&val, reader->ptr, sizeof(val));
+    reader->ptr += sizeof(val);
+
+    return vcblockchain_wire_swap_64(val);
+}
+
+/**
+ * \brief Read a uuid.
+ *
+ * \param reader        The reader.
+ * \param id            The uuid to receive the value.
+ */
+static inline void vcblockchain_wire_read_uuid(
+    vcblockchain_wire_reader* reader, vpr_uuid* id)
+{
+    MODEL_ASSERT(vcblockchain_wire_reader_remaining(reader) >= sizeof(*id));
+
+    memcpy(id, reader->ptr, sizeof(*id));
+    reader->ptr += sizeof(*id);
+}
+
+/**
+ * \brief Read raw bytes.
+ *
+ * \param reader        The reader.
+ * \param data          The destination for these bytes.
+ * \param size          The number of bytes to read.
+ */
+static inline void vcblockchain_wire_read_bytes(
+    vcblockchain_wire_reader* reader, void* data, size_t size)
+{
+    MODEL_ASSERT(vcblockchain_wire_reader_remaining(reader) >= size);
+
+    if (size > 0)
+    {
+        memcpy(data, reader->ptr, size);
+        reader->ptr += size;
+    }
+}
+
+/**
+ * \brief Skip over bytes, returning a pointer to them.
+ *
+ * \param reader        The reader.
+ * \param size          The number of bytes to skip.
+ *
+ * \returns a pointer to the skipped bytes, which remain owned by the payload.
+ */
+static inline const uint8_t* vcblockchain_wire_read_skip(
+    vcblockchain_wire_reader* reader, size_t size)
+{
+    const uint8_t* data = reader->ptr;
+
+    MODEL_ASSERT(vcblockchain_wire_reader_remaining(reader) >= size);
+
+    reader->ptr += size;
+
+    return data;
+}
+
+/**
+ * \brief Initialize a write cursor over a buffer.
+ *
+ * \param writer        The writer to initialize.
+ * \param data          The buffer to write.
+ * \param size          The size of the buffer.
+ */
+static inline void vcblockchain_wire_writer_init(
+    vcblockchain_wire_writer* writer, void* data, size_t size)
+{
+    writer->ptr = (uint8_t*)data;
+    writer->end = writer->ptr + size;
+}
+
+/**
+ * \brief Get the number of bytes remaining in a write cursor.
+ *
+ * \param writer        The writer.
+ *
+ * \returns the number of unwritten bytes.
+ */
+static inline size_t vcblockchain_wire_writer_remaining(
+    const vcblockchain_wire_writer* writer)
+{
+    return (size_t)(writer->end - writer->ptr);
+}
+
+/**
+ * \brief Write a 32-bit value in network order.
+ *
+ * \param writer        The writer.
+ * \param val           The value to write, in host order.
+ */
+static inline void vcblockchain_wire_write_u32(
+    vcblockchain_wire_writer* writer, uint32_t val)
+{
+    uint32_t net_val = vcblockchain_wire_swap_32(val);
+
+    MODEL_ASSERT(vcblockchain_wire_writer_remaining(writer) >= sizeof(net_val));
+
+    memcpy(writer->ptr, &net_val, sizeof(net_val));
+    writer->ptr += sizeof(net_val);
+}
+
+/**
+ * \brief Write a 64-bit value in network order.
+ *
+ * \param writer        The writer.
+ * \param val           The value to write, in host order.
+ */
+static inline void vcblockchain_wire_write_u64(
+    vcblockchain_wire_writer* writer, uint64_t val)
+{
+    uint64_t net_val = vcblockchain_wire_swap_64(val);
+
+    MODEL_ASSERT(vcblockchain_wire_writer_remaining(writer) >= sizeof(net_val));
+
+    memcpy(writer->ptr, &net_val, sizeof(net_val));
+    writer->ptr += sizeof(net_val);
+}
+
+/**
+ * \brief Write a uuid.
+ *
+ * \param writer        The writer.
+ * \param id            The uuid to write.
+ */
+static inline void vcblockchain_wire_write_uuid(
+    vcblockchain_wire_writer* writer, const vpr_uuid* id)
+{
+    MODEL_ASSERT(vcblockchain_wire_writer_remaining(writer) >= sizeof(*id));
+
+    memcpy(writer->ptr, id, sizeof(*id));
+    writer->ptr += sizeof(*id);
+}
+
+/**
+ * \brief Write raw bytes.
+ *
+ * \param writer        The writer.
+ * \param data          The bytes to write.
+ * \param size          The number of bytes to write.
+ */
+static inline void vcblockchain_wire_write_bytes(
+    vcblockchain_wire_writer* writer, const void* data, size_t size)
+{
+    MODEL_ASSERT(vcblockchain_wire_writer_remaining(writer) >= size);
+
+    if (size > 0)
+    {
+        memcpy(writer->ptr, data, size);
+        writer->ptr += size;
+    }
+}
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif /*__cplusplus*/
+
+#endif /*VCBLOCKCHAIN_PROTOCOL_WIRE_INTERNAL_HEADER_GUARD*/
@@ -0,0 +1,229 @@
+/**
+ * \file psock/psock_open_authed_data.c
+ *
+ * \brief Authenticate and decrypt a packet held in a buffer.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <arpa/inet.h>
+#include <string.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/limits.h>
+#include <vcblockchain/psock.h>
+#include <vccrypt/compare.h>
+
+/**
+ * \brief Authenticate and decrypt an authenticated data packet held in a
+ * buffer.
+ *
+ * This is the counterpart of \ref psock_seal_authed_datav, for callers that
+ * read from the socket themselves, such as a client driven by an event loop.
+ * The buffer may hold a partial packet, or more than one packet. If it does
+ * not yet hold the whole of the first packet, then this function fails with
+ * \ref VCBLOCKCHAIN_ERROR_SSOCK_PACKET_INCOMPLETE, and the caller should try
+ * again once more data has arrived.
+ *
+ * \param payload       The buffer to receive the decrypted payload. This
+ *                      buffer must not have been previously initialized. On
+ *                      success, it is initialized and owned by the caller, and
+ *                      must be disposed when no longer needed.
+ * \param packet_size   Pointer to receive the size of the packet at the start
+ *                      of \p data. On success, the caller should discard this
+ *                      many bytes. If the packet is incomplete, this is set to
+ *                      the number of bytes needed to make progress.
+ * \param data          The data read from the socket.
+ * \param data_size     The size of the data read from the socket.
+ * \param iv            The 64-bit IV to expect for this packet.
+ * \param suite         The crypto suite to use for authenticating this packet.
+ * \param secret        The shared secret between the peer and host.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_PACKET_INCOMPLETE if \p data does not yet
+ *        hold a complete packet.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_UNAUTHORIZED_PACKET if the packet could not
+ *        be authenticated.
+ *      - a non-zero error code on failure.
+ */
+int psock_open_authed_data(
+    vccrypt_buffer_t* payload, size_t* packet_size, const void* data,
+    size_t data_size, uint64_t iv, vccrypt_suite_options_t* suite,
+    const vccrypt_buffer_t* secret)
+{
+    status retval = 0;
+    uint32_t type = 0U;
+    uint32_t nsize = 0U;
+    uint32_t size = 0U;
+    uint8_t dheader[sizeof(type) + sizeof(nsize)];
+    const uint8_t* bdata = (const uint8_t*)data;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != payload);
+    MODEL_ASSERT(NULL != packet_size);
+    MODEL_ASSERT(NULL != data || 0 == data_size);
+    MODEL_ASSERT(prop_vccrypt_suite_options_valid(suite));
+    MODEL_ASSERT(prop_vccrypt_buffer_valid(secret));
+
+    /* the header must be complete before anything can be decrypted. */
+    const size_t header_size =
+        sizeof(dheader) + suite->mac_short_opts.mac_size;
+    if (data_size < header_size)
+    {
+        *packet_size = header_size;
+        retval = VCBLOCKCHAIN_ERROR_SSOCK_PACKET_INCOMPLETE;
+        goto done;
+    }
+
+    /* set up the stream cipher. */
+    vccrypt_stream_context_t stream;
+    retval = vccrypt_suite_stream_init(suite, &stream, secret);
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = VCBLOCKCHAIN_ERROR_SSOCK_CRYPTO;
+        goto done;
+    }
+
+    /* start decryption of the stream. */
+    retval = vccrypt_stream_continue_decryption(&stream, &iv, sizeof(iv), 0);
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = VCBLOCKCHAIN_ERROR_SSOCK_CRYPTO;
+        goto cleanup_stream;
+    }
+
+    /* decrypt enough of the header to determine the type and size. */
+    size_t offset = 0;
+    retval =
+        vccrypt_stream_decrypt(
+            &stream, bdata, sizeof(dheader), dheader, &offset);
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = VCBLOCKCHAIN_ERROR_SSOCK_CRYPTO;
+        goto cleanup_stream;
+    }
+
+    /* verify that the type is VCBLOCKCHAIN_PSOCK_BOXED_TYPE_AUTHED_PACKET. */
+    memcpy(&type, dheader, sizeof(type));
+    if (VCBLOCKCHAIN_PSOCK_BOXED_TYPE_AUTHED_PACKET != ntohl(type))
+    {
+        retval = VCBLOCKCHAIN_ERROR_SSOCK_UNAUTHORIZED_PACKET;
+        goto cleanup_stream;
+    }
+
+    /* verify that the size makes sense. */
+    memcpy(&nsize, dheader + sizeof(type), sizeof(nsize));
+    size = ntohl(nsize);
+    if (size > VCBLOCKCHAIN_LIMIT_MAXIMUM_ENCRYPTED_PACKET_SIZE)
+    {
+        retval = VCBLOCKCHAIN_ERROR_SSOCK_UNAUTHORIZED_PACKET;
+        goto cleanup_stream;
+    }
+
+    /* the payload must be complete before it can be authenticated. */
+    *packet_size = header_size + size;
+    if (data_size < *packet_size)
+    {
+        retval = VCBLOCKCHAIN_ERROR_SSOCK_PACKET_INCOMPLETE;
+        goto cleanup_stream;
+    }
+
+    /* set up the MAC. */
+    vccrypt_mac_context_t mac;
+    retval = vccrypt_suite_mac_short_init(suite, &mac, secret);
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = VCBLOCKCHAIN_ERROR_SSOCK_CRYPTO;
+        goto cleanup_stream;
+    }
+
+    /* digest the packet header. */
+    retval = vccrypt_mac_digest(&mac, bdata, sizeof(dheader));
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = VCBLOCKCHAIN_ERROR_SSOCK_CRYPTO;
+        goto cleanup_mac;
+    }
+
+    /* digest the packet payload. */
+    retval = vccrypt_mac_digest(&mac, bdata + header_size, size);
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = VCBLOCKCHAIN_ERROR_SSOCK_CRYPTO;
+        goto cleanup_mac;
+    }
+
+    /* create a buffer to hold the digest. */
+    vccrypt_buffer_t digest;
+    retval =
+        vccrypt_suite_buffer_init_for_mac_authentication_code(
+            suite, &digest, true);
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+        goto cleanup_mac;
+    }
+
+    /* finalize the mac. */
+    retval = vccrypt_mac_finalize(&mac, &digest);
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = VCBLOCKCHAIN_ERROR_SSOCK_CRYPTO;
+        goto cleanup_digest;
+    }
+
+    /* compare the digest against the mac in the packet. */
+    if (0 != crypto_memcmp(digest.data, bdata + sizeof(dheader), digest.size))
+    {
+        retval = VCBLOCKCHAIN_ERROR_SSOCK_UNAUTHORIZED_PACKET;
+        goto cleanup_digest;
+    }
+
+    /* the payload has been authenticated.  create output buffer. */
+    retval = vccrypt_buffer_init(payload, suite->alloc_opts, size);
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+        goto cleanup_digest;
+    }
+
+    /* continue decryption in the payload. */
+    retval =
+        vccrypt_stream_continue_decryption(
+            &stream, &iv, sizeof(iv), offset);
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = VCBLOCKCHAIN_ERROR_SSOCK_CRYPTO;
+        goto cleanup_payload;
+    }
+
+    /* decrypt the payload. */
+    offset = 0;
+    retval =
+        vccrypt_stream_decrypt(
+            &stream, bdata + header_size, size, payload->data, &offset);
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = VCBLOCKCHAIN_ERROR_SSOCK_CRYPTO;
+        goto cleanup_payload;
+    }
+
+    /* success. */
+    retval = VCBLOCKCHAIN_STATUS_SUCCESS;
+    goto cleanup_digest;
+
+cleanup_payload:
+    dispose((disposable_t*)payload);
+
+cleanup_digest:
+    dispose((disposable_t*)&digest);
+
+cleanup_mac:
+    dispose((disposable_t*)&mac);
+
+cleanup_stream:
+    dispose((disposable_t*)&stream);
+
+done:
+    return retval;
+}
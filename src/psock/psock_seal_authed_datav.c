@@ -0,0 +1,208 @@
+/**
+ * \file psock/psock_seal_authed_datav.c
+ *
+ * \brief Encrypt and authenticate a packet from a vector of payload segments.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <arpa/inet.h>
+#include <string.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/psock.h>
+
+/**
+ * \brief Seal an authenticated data packet whose payload is gathered from a
+ * vector of segments, without writing it.
+ *
+ * On success, \p packet holds the encrypted and authenticated packet, exactly
+ * as \ref psock_write_authed_datav would write it to the socket. Sealing does
+ * not touch the socket, so packets for the same connection may be sealed in
+ * parallel, as long as each uses a distinct IV and they are written to the
+ * socket in IV order.
+ *
+ * \param packet        The buffer to receive the sealed packet. This buffer
+ *                      must not have been previously initialized. On success,
+ *                      it is initialized and owned by the caller, and must be
+ *                      disposed when no longer needed.
+ * \param iv            The 64-bit IV to use for this packet.
+ * \param vec           The payload segments to seal.
+ * \param vec_count     The number of payload segments.
+ * \param suite         The crypto suite to use for authenticating this packet.
+ * \param secret        The shared secret between the peer and host.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the payload is too large for a
+ *        single packet.
+ *      - a non-zero error code on failure.
+ */
+int psock_seal_authed_datav(
+    vccrypt_buffer_t* packet, uint64_t iv, const vcblockchain_psock_iovec* vec,
+    size_t vec_count, vccrypt_suite_options_t* suite,
+    const vccrypt_buffer_t* secret)
+{
+    status retval = 0;
+    uint32_t type = htonl(VCBLOCKCHAIN_PSOCK_BOXED_TYPE_AUTHED_PACKET);
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != packet);
+    MODEL_ASSERT(0 == vec_count || NULL != vec);
+    MODEL_ASSERT(prop_vccrypt_suite_options_valid(suite));
+    MODEL_ASSERT(prop_vccrypt_buffer_valid(secret));
+
+    /* compute the payload size, which must fit in the packet size field. */
+    size_t size = 0;
+    for (size_t i = 0; i < vec_count; ++i)
+    {
+        if (vec[i].size > UINT32_MAX - size)
+        {
+            retval = VCBLOCKCHAIN_ERROR_INVALID_ARG;
+            goto done;
+        }
+
+        size += vec[i].size;
+    }
+
+    uint32_t nsize = htonl((uint32_t)size);
+
+    /* create a buffer for holding the digest. */
+    vccrypt_buffer_t digest;
+    retval =
+        vccrypt_suite_buffer_init_for_mac_authentication_code(
+            suite, &digest, true);
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+        goto done;
+    }
+
+    /* create a packet buffer large enough for this authed packet. */
+    size_t packet_size =
+        sizeof(type) + sizeof(nsize) + digest.size + size;
+    retval = vccrypt_buffer_init(packet, suite->alloc_opts, packet_size);
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+        goto cleanup_digest;
+    }
+
+    /* create a stream cipher for encrypting this packet. */
+    vccrypt_stream_context_t stream;
+    retval = vccrypt_suite_stream_init(suite, &stream, secret);
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = VCBLOCKCHAIN_ERROR_SSOCK_CRYPTO;
+        goto cleanup_packet;
+    }
+
+    /* create a mac instance for building the packet authentication code. */
+    vccrypt_mac_context_t mac;
+    retval = vccrypt_suite_mac_short_init(suite, &mac, secret);
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = VCBLOCKCHAIN_ERROR_SSOCK_CRYPTO;
+        goto cleanup_stream;
+    }
+
+    /* start the stream cipher. */
+    retval = vccrypt_stream_continue_encryption(&stream, &iv, sizeof(iv), 0);
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = VCBLOCKCHAIN_ERROR_SSOCK_CRYPTO;
+        goto cleanup_mac;
+    }
+
+    /* treat the packet as a byte array for convenience. */
+    uint8_t* bpacket = (uint8_t*)packet->data;
+    size_t offset = 0;
+
+    /* encrypt the type. */
+    retval =
+        vccrypt_stream_encrypt(&stream, &type, sizeof(type), bpacket, &offset);
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = VCBLOCKCHAIN_ERROR_SSOCK_CRYPTO;
+        goto cleanup_mac;
+    }
+
+    /* encrypt the size. */
+    retval =
+        vccrypt_stream_encrypt(
+            &stream, &nsize, sizeof(nsize), bpacket, &offset);
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = VCBLOCKCHAIN_ERROR_SSOCK_CRYPTO;
+        goto cleanup_mac;
+    }
+
+    /* encrypt each payload segment in turn. */
+    for (size_t i = 0; i < vec_count; ++i)
+    {
+        if (0 == vec[i].size)
+        {
+            continue;
+        }
+
+        retval =
+            vccrypt_stream_encrypt(
+                &stream, vec[i].data, vec[i].size, bpacket + digest.size,
+                &offset);
+        if (STATUS_SUCCESS != retval)
+        {
+            retval = VCBLOCKCHAIN_ERROR_SSOCK_CRYPTO;
+            goto cleanup_mac;
+        }
+    }
+
+    /* digest the packet header. */
+    retval = vccrypt_mac_digest(&mac, bpacket, sizeof(type) + sizeof(nsize));
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = VCBLOCKCHAIN_ERROR_SSOCK_CRYPTO;
+        goto cleanup_mac;
+    }
+
+    /* digest the packet payload. */
+    retval =
+        vccrypt_mac_digest(
+            &mac, bpacket + sizeof(type) + sizeof(nsize) + digest.size, size);
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = VCBLOCKCHAIN_ERROR_SSOCK_CRYPTO;
+        goto cleanup_mac;
+    }
+
+    /* finalize the digest. */
+    retval = vccrypt_mac_finalize(&mac, &digest);
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = VCBLOCKCHAIN_ERROR_SSOCK_CRYPTO;
+        goto cleanup_mac;
+    }
+
+    /* copy the digest to the packet. */
+    memcpy(bpacket + sizeof(type) + sizeof(nsize), digest.data, digest.size);
+
+
+    /* success. */
+    retval = VCBLOCKCHAIN_STATUS_SUCCESS;
+
+cleanup_mac:
+    dispose((disposable_t*)&mac);
+
+cleanup_stream:
+    dispose((disposable_t*)&stream);
+
+cleanup_packet:
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        dispose((disposable_t*)packet);
+    }
+
+cleanup_digest:
+    dispose((disposable_t*)&digest);
+
+done:
+    return retval;
+}
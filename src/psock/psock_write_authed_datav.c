@@ -0,0 +1,76 @@
+/**
+ * \file psock/psock_write_authed_datav.c
+ *
+ * \brief Write an encrypted and authenticated packet to the psock stream from
+ * a vector of payload segments.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/psock.h>
+
+RCPR_IMPORT_psock;
+
+/**
+ * \brief Write an authenticated data packet whose payload is gathered from a
+ * vector of segments.
+ *
+ * On success, the authenticated data packet value will be written, along with
+ * type information and size. The payload of this packet is the concatenation
+ * of each segment in \p vec. Each segment is encrypted directly into the
+ * packet, so the caller does not need to first copy the segments into a
+ * contiguous buffer.
+ *
+ * \param sock          The psock instance to which this packet is written.
+ * \param iv            The 64-bit IV to use for this packet.
+ * \param vec           The payload segments to write.
+ * \param vec_count     The number of payload segments.
+ * \param suite         The crypto suite to use for authenticating this packet.
+ * \param secret        The shared secret between the peer and host.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if the payload is too large for a
+ *        single packet.
+ *      - a non-zero error code on failure.
+ */
+int psock_write_authed_datav(
+    RCPR_SYM(psock)* sock, uint64_t iv, const vcblockchain_psock_iovec* vec,
+    size_t vec_count, vccrypt_suite_options_t* suite,
+    const vccrypt_buffer_t* secret)
+{
+    status retval;
+    vccrypt_buffer_t packet;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_psock_valid(sock));
+    MODEL_ASSERT(0 == vec_count || NULL != vec);
+    MODEL_ASSERT(prop_vccrypt_suite_options_valid(suite));
+    MODEL_ASSERT(prop_vccrypt_buffer_valid(secret));
+
+    /* encrypt and authenticate the packet. */
+    retval =
+        psock_seal_authed_datav(&packet, iv, vec, vec_count, suite, secret);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* write the packet to the socket. */
+    retval = psock_write_raw_data(sock, packet.data, packet.size);
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = VCBLOCKCHAIN_ERROR_SSOCK_WRITE;
+        goto cleanup_packet;
+    }
+
+    /* success. */
+    retval = VCBLOCKCHAIN_STATUS_SUCCESS;
+
+cleanup_packet:
+    dispose((disposable_t*)&packet);
+
+done:
+    return retval;
+}
@@ -0,0 +1,79 @@
+/**
+ * \file send_queue/send_queue_internal.h
+ *
+ * \brief Internal methods and definitions for send_queue.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VCBLOCKCHAIN_SEND_QUEUE_INTERNAL_HEADER_GUARD
+#define VCBLOCKCHAIN_SEND_QUEUE_INTERNAL_HEADER_GUARD
+
+#include <cbmc/model_assert.h>
+#include <rcpr/resource/protected.h>
+#include <stdatomic.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/psock.h>
+#include <vcblockchain/send_queue.h>
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif /*__cplusplus*/
+
+/**
+ * \brief The state of a slot in a send queue.
+ */
+enum send_queue_slot_state
+{
+    /** \brief the slot does not hold a packet. */
+    SEND_QUEUE_SLOT_EMPTY = 0,
+    /** \brief the slot holds a sealed packet that is ready to be written. */
+    SEND_QUEUE_SLOT_READY = 1,
+    /** \brief the packet for this slot could not be sealed. */
+    SEND_QUEUE_SLOT_FAILED = 2,
+};
+
+/**
+ * \brief A slot in a send queue.
+ *
+ * The packet and error are written by the submitting thread before the state
+ * is published, and are only read by the writing thread after it has observed
+ * the published state.
+ */
+typedef struct send_queue_slot
+{
+    _Atomic uint32_t state;
+    int error;
+    vccrypt_buffer_t packet;
+} send_queue_slot;
+
+/**
+ * \brief A send queue.
+ *
+ * The packet for IV n is held in slot n modulo depth. The writing flag elects
+ * a single writer, which is the only thread that advances write_iv.
+ */
+struct vcblockchain_send_queue
+{
+    RCPR_SYM(resource) hdr;
+    allocator_options_t* alloc_opts;
+    RCPR_SYM(psock)* sock;
+    vccrypt_suite_options_t* suite;
+    const vccrypt_buffer_t* shared_secret;
+    send_queue_slot* slots;
+    uint32_t depth;
+    _Atomic uint64_t next_iv;
+    _Atomic uint64_t write_iv;
+    _Atomic bool writing;
+    _Atomic int error;
+
+    RCPR_MODEL_STRUCT_TAG(vcblockchain_send_queue);
+};
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif /*__cplusplus*/
+
+#endif /*VCBLOCKCHAIN_SEND_QUEUE_INTERNAL_HEADER_GUARD*/
@@ -0,0 +1,27 @@
+/**
+ * \file send_queue/vcblockchain_send_queue_client_iv.c
+ *
+ * \brief Get the next client IV that has not been reserved.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "send_queue_internal.h"
+
+/**
+ * \brief Get the next client IV that has not been reserved.
+ *
+ * \param queue                     The send queue.
+ *
+ * Once every reserved IV has been submitted and written, this is the client IV
+ * to use if the connection goes back to the lower level sendreq functions.
+ *
+ * \returns the next unreserved client IV.
+ */
+uint64_t vcblockchain_send_queue_client_iv(
+    const vcblockchain_send_queue* queue)
+{
+    MODEL_ASSERT(prop_vcblockchain_send_queue_valid(queue));
+
+    return atomic_load(&queue->next_iv);
+}
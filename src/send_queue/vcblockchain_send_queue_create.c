@@ -0,0 +1,151 @@
+/**
+ * \file send_queue/vcblockchain_send_queue_create.c
+ *
+ * \brief Create a send queue for a connection.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <string.h>
+
+#include "send_queue_internal.h"
+
+RCPR_IMPORT_resource;
+
+/* forward decls. */
+static status send_queue_resource_release(resource* r);
+
+/**
+ * \brief Create a send queue for a connection.
+ *
+ * \param queue                     Pointer to the pointer to receive the send
+ *                                  queue on success.
+ * \param alloc_opts                The allocator used to allocate the queue.
+ *                                  It must outlive the queue.
+ * \param sock                      The socket to which packets are written.
+ *                                  The queue borrows this socket, which must
+ *                                  outlive the queue.
+ * \param suite                     The crypto suite used to seal packets. Its
+ *                                  allocator must be thread safe.
+ * \param shared_secret             The shared secret for this connection,
+ *                                  which must outlive the queue.
+ * \param client_iv                 The next client IV for this connection.
+ * \param depth                     The number of sealed packets that can wait
+ *                                  to be written. If zero, then
+ *                                  \ref VCBLOCKCHAIN_SEND_QUEUE_DEFAULT_DEPTH
+ *                                  is used.
+ *
+ * Once a send queue has been created, every packet sent to the server on this
+ * connection must go through the queue, or the IVs will fall out of step.
+ *
+ * On success, \p queue is set to a send queue instance. This instance is a
+ * \ref resource that is owned by the caller and must be released by calling
+ * \ref resource_release on its resource handle when it is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if the queue could not be allocated.
+ */
+int vcblockchain_send_queue_create(
+    vcblockchain_send_queue** queue, allocator_options_t* alloc_opts,
+    RCPR_SYM(psock)* sock, vccrypt_suite_options_t* suite,
+    const vccrypt_buffer_t* shared_secret, uint64_t client_iv,
+    uint32_t depth)
+{
+    vcblockchain_send_queue* tmp;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != queue);
+    MODEL_ASSERT(NULL != alloc_opts);
+    MODEL_ASSERT(NULL != sock);
+    MODEL_ASSERT(NULL != suite);
+    MODEL_ASSERT(NULL != shared_secret);
+
+    /* runtime parameter checks. */
+    if (
+        NULL == queue || NULL == alloc_opts || NULL == sock || NULL == suite
+     || NULL == shared_secret)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* use the default depth if none was given. */
+    if (0U == depth)
+    {
+        depth = VCBLOCKCHAIN_SEND_QUEUE_DEFAULT_DEPTH;
+    }
+
+    /* allocate memory for the queue. */
+    tmp = (vcblockchain_send_queue*)
+        allocate(alloc_opts, sizeof(vcblockchain_send_queue));
+    if (NULL == tmp)
+    {
+        return VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* allocate the slots. */
+    size_t slots_size = (size_t)depth * sizeof(send_queue_slot);
+    send_queue_slot* slots = (send_queue_slot*)allocate(alloc_opts, slots_size);
+    if (NULL == slots)
+    {
+        release(alloc_opts, tmp);
+        return VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* every slot starts out empty. */
+    memset(slots, 0, slots_size);
+    for (uint32_t i = 0; i < depth; ++i)
+    {
+        atomic_init(&slots[i].state, SEND_QUEUE_SLOT_EMPTY);
+    }
+
+    /* initialize the queue. */
+    memset(tmp, 0, sizeof(vcblockchain_send_queue));
+    resource_init(&tmp->hdr, &send_queue_resource_release);
+    tmp->alloc_opts = alloc_opts;
+    tmp->sock = sock;
+    tmp->suite = suite;
+    tmp->shared_secret = shared_secret;
+    tmp->slots = slots;
+    tmp->depth = depth;
+    atomic_init(&tmp->next_iv, client_iv);
+    atomic_init(&tmp->write_iv, client_iv);
+    atomic_init(&tmp->writing, false);
+    atomic_init(&tmp->error, VCBLOCKCHAIN_STATUS_SUCCESS);
+
+    /* success. */
+    *queue = tmp;
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
+
+/**
+ * \brief Release the send queue resource.
+ */
+static status send_queue_resource_release(resource* r)
+{
+    vcblockchain_send_queue* queue = (vcblockchain_send_queue*)r;
+
+    /* cache the allocator. */
+    allocator_options_t* alloc_opts = queue->alloc_opts;
+
+    /* dispose any packets that were never written. */
+    for (uint32_t i = 0; i < queue->depth; ++i)
+    {
+        if (SEND_QUEUE_SLOT_READY == atomic_load(&queue->slots[i].state))
+        {
+            dispose((disposable_t*)&queue->slots[i].packet);
+        }
+    }
+
+    /* release the slots. */
+    memset(queue->slots, 0, queue->depth * sizeof(send_queue_slot));
+    release(alloc_opts, queue->slots);
+
+    /* clear and release the structure. */
+    memset(queue, 0, sizeof(vcblockchain_send_queue));
+    release(alloc_opts, queue);
+
+    /* success. */
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,45 @@
+/**
+ * \file send_queue/vcblockchain_send_queue_reserve.c
+ *
+ * \brief Reserve the next client IV.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "send_queue_internal.h"
+
+/**
+ * \brief Reserve the next client IV.
+ *
+ * \param queue                     The send queue.
+ * \param iv                        Pointer to receive the reserved IV.
+ *
+ * This function is lock free and may be called from any thread. Every
+ * reserved IV must be passed to \ref vcblockchain_send_queue_submit exactly
+ * once, even if the packet for it could not be encoded, since no later packet
+ * can be written until it has been. A thread must not hold more reserved IVs
+ * than the depth of the queue.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ */
+int vcblockchain_send_queue_reserve(
+    vcblockchain_send_queue* queue, uint64_t* iv)
+{
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_vcblockchain_send_queue_valid(queue));
+    MODEL_ASSERT(NULL != iv);
+
+    /* runtime parameter checks. */
+    if (NULL == queue || NULL == iv)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* the IV only needs to be unique, so no ordering is required here. */
+    *iv = atomic_fetch_add_explicit(&queue->next_iv, 1, memory_order_relaxed);
+
+    /* success. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
@@ -0,0 +1,24 @@
+/**
+ * \file send_queue/vcblockchain_send_queue_resource_handle.c
+ *
+ * \brief Get the resource handle for the given send queue.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "send_queue_internal.h"
+
+/**
+ * \brief Get the resource handle for the given send queue.
+ *
+ * \param queue     The send queue instance to access.
+ *
+ * \returns the resource handle for this send queue instance.
+ */
+RCPR_SYM(resource)* vcblockchain_send_queue_resource_handle(
+    vcblockchain_send_queue* queue)
+{
+    MODEL_ASSERT(prop_vcblockchain_send_queue_valid(queue));
+
+    return &queue->hdr;
+}
@@ -0,0 +1,56 @@
+/**
+ * \file send_queue/vcblockchain_send_queue_send.c
+ *
+ * \brief Reserve an IV for a payload, then seal and queue it.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "send_queue_internal.h"
+
+/**
+ * \brief Reserve an IV for a payload, then seal and queue it.
+ *
+ * \param queue                     The send queue.
+ * \param payload                   The payload to send, such as an encoded
+ *                                  request.
+ * \param payload_size              The size of the payload.
+ *
+ * This is equivalent to calling \ref vcblockchain_send_queue_reserve followed
+ * by \ref vcblockchain_send_queue_submit.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if this or an earlier packet could not
+ *        be written.
+ *      - a non-zero error code if this or an earlier packet could not be
+ *        sealed.
+ */
+int vcblockchain_send_queue_send(
+    vcblockchain_send_queue* queue, const void* payload,
+    uint32_t payload_size)
+{
+    int retval;
+    uint64_t iv;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_vcblockchain_send_queue_valid(queue));
+    MODEL_ASSERT(NULL != payload);
+
+    /* runtime parameter checks, made before an IV is reserved. */
+    if (NULL == queue || NULL == payload)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* reserve the next IV. */
+    retval = vcblockchain_send_queue_reserve(queue, &iv);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* seal and queue the payload. */
+    return vcblockchain_send_queue_submit(queue, iv, payload, payload_size);
+}
@@ -0,0 +1,191 @@
+/**
+ * \file send_queue/vcblockchain_send_queue_submit.c
+ *
+ * \brief Seal a payload with a reserved IV and queue it to be written.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <sched.h>
+
+#include "send_queue_internal.h"
+
+RCPR_IMPORT_psock;
+
+/* forward decls. */
+static void send_queue_drain(vcblockchain_send_queue* queue);
+
+/**
+ * \brief Seal a payload with a reserved IV and queue it to be written.
+ *
+ * \param queue                     The send queue.
+ * \param iv                        The IV reserved for this payload.
+ * \param payload                   The payload to seal, such as an encoded
+ *                                  request. If NULL, then the reservation is
+ *                                  abandoned, which fails the queue.
+ * \param payload_size              The size of the payload.
+ *
+ * The payload is sealed on the calling thread, without holding any lock. The
+ * sealed packet is then queued. If every packet before it has been written,
+ * then the calling thread writes it, along with any packets queued after it
+ * that are ready. Otherwise, this function returns without waiting, and the
+ * packet is written by the thread that submits the packet it follows.
+ *
+ * If the ring is full, then this function spins on \c sched_yield until the
+ * slot for \p iv has been written. That slot is only freed once every earlier
+ * IV has been submitted, so if a reserved IV is never submitted, this function
+ * blocks without bound.
+ *
+ * Because a packet may be written by another thread, a failure to write it is
+ * reported by the next call made to the queue. Once a packet could not be
+ * sealed or written, no further packets are written, since the server would
+ * reject every packet after the gap.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_SSOCK_WRITE if this or an earlier packet could not
+ *        be written.
+ *      - a non-zero error code if this or an earlier packet could not be
+ *        sealed.
+ */
+int vcblockchain_send_queue_submit(
+    vcblockchain_send_queue* queue, uint64_t iv, const void* payload,
+    uint32_t payload_size)
+{
+    int retval;
+    vccrypt_buffer_t packet;
+    vcblockchain_psock_iovec vec;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_vcblockchain_send_queue_valid(queue));
+
+    /* runtime parameter checks. */
+    if (NULL == queue)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* seal the packet on this thread, in parallel with other senders. */
+    if (NULL != payload)
+    {
+        vec.data = payload;
+        vec.size = payload_size;
+
+        retval =
+            psock_seal_authed_datav(
+                &packet, iv, &vec, 1, queue->suite, queue->shared_secret);
+    }
+    else
+    {
+        retval = VCBLOCKCHAIN_ERROR_SSOCK_WRITE;
+    }
+
+    /* wait until the packet that last used this slot has been written. */
+    send_queue_slot* slot = &queue->slots[iv % queue->depth];
+    while (iv - atomic_load(&queue->write_iv) >= queue->depth)
+    {
+        sched_yield();
+    }
+
+    /* publish the sealed packet, or the reason it could not be sealed. */
+    if (VCBLOCKCHAIN_STATUS_SUCCESS == retval)
+    {
+        slot->packet = packet;
+        atomic_store(&slot->state, SEND_QUEUE_SLOT_READY);
+    }
+    else
+    {
+        slot->error = retval;
+        atomic_store(&slot->state, SEND_QUEUE_SLOT_FAILED);
+    }
+
+    /* write every packet that is ready, unless another thread is. */
+    send_queue_drain(queue);
+
+    /* report a failure to seal this packet, or the first queue failure. */
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    return atomic_load(&queue->error);
+}
+
+/**
+ * \brief Write every ready packet at the head of the queue, in IV order.
+ *
+ * \param queue                     The send queue.
+ *
+ * Only one thread may write at a time. A thread that loses the election
+ * returns at once, since the thread that won will see its packet. The winner
+ * checks the head again after stepping down, in case a packet was published
+ * after its last check but before it stepped down.
+ */
+static void send_queue_drain(vcblockchain_send_queue* queue)
+{
+    for (;;)
+    {
+        /* try to become the writer. */
+        bool expected = false;
+        if (!atomic_compare_exchange_strong(&queue->writing, &expected, true))
+        {
+            return;
+        }
+
+        /* write packets until the head of the queue is not ready. */
+        for (;;)
+        {
+            uint64_t iv = atomic_load(&queue->write_iv);
+            send_queue_slot* slot = &queue->slots[iv % queue->depth];
+            uint32_t state = atomic_load(&slot->state);
+
+            if (SEND_QUEUE_SLOT_EMPTY == state)
+            {
+                break;
+            }
+
+            if (SEND_QUEUE_SLOT_READY == state)
+            {
+                /* once the queue has failed, packets are dropped. */
+                if (VCBLOCKCHAIN_STATUS_SUCCESS == atomic_load(&queue->error))
+                {
+                    int retval =
+                        psock_write_raw_data(
+                            queue->sock, slot->packet.data,
+                            slot->packet.size);
+                    if (STATUS_SUCCESS != retval)
+                    {
+                        atomic_store(
+                            &queue->error, VCBLOCKCHAIN_ERROR_SSOCK_WRITE);
+                    }
+                }
+
+                dispose((disposable_t*)&slot->packet);
+            }
+            else
+            {
+                /* the server can't accept any packet after this gap. */
+                int expected_error = VCBLOCKCHAIN_STATUS_SUCCESS;
+                atomic_compare_exchange_strong(
+                    &queue->error, &expected_error, slot->error);
+            }
+
+            /* free the slot, then advance to the next IV. */
+            atomic_store(&slot->state, SEND_QUEUE_SLOT_EMPTY);
+            atomic_store(&queue->write_iv, iv + 1);
+        }
+
+        /* step down as the writer. */
+        atomic_store(&queue->writing, false);
+
+        /* stop unless a packet was published while stepping down. */
+        uint64_t iv = atomic_load(&queue->write_iv);
+        if (
+            SEND_QUEUE_SLOT_EMPTY
+                == atomic_load(&queue->slots[iv % queue->depth].state))
+        {
+            return;
+        }
+    }
+}
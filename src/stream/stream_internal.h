@@ -0,0 +1,90 @@
+/**
+ * \file stream/stream_internal.h
+ *
+ * \brief Internal methods and definitions for stream.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VCBLOCKCHAIN_STREAM_INTERNAL_HEADER_GUARD
+#define VCBLOCKCHAIN_STREAM_INTERNAL_HEADER_GUARD
+
+#include <cbmc/model_assert.h>
+#include <rcpr/resource/protected.h>
+#include <string.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/stream.h>
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif /*__cplusplus*/
+
+/**
+ * \brief A stream being framed by a stream writer.
+ *
+ * While a stream is open, its payload is owned by the writer. The sent count
+ * is the number of payload bytes already handed out in frames. The turn is
+ * taken from the writer each time the stream is opened or framed, so the
+ * stream with the lowest turn has waited longest for its next frame.
+ */
+typedef struct stream_writer_entry
+{
+    bool open;
+    uint32_t stream_id;
+    uint32_t priority;
+    uint64_t turn;
+    vccrypt_buffer_t payload;
+    size_t sent;
+} stream_writer_entry;
+
+/**
+ * \brief A stream writer.
+ */
+struct vcblockchain_stream_writer
+{
+    RCPR_SYM(resource) hdr;
+    allocator_options_t* alloc_opts;
+    stream_writer_entry* entries;
+    uint32_t max_streams;
+    uint32_t chunk_size;
+    uint64_t turn;
+    uint8_t* frame;
+
+    RCPR_MODEL_STRUCT_TAG(vcblockchain_stream_writer);
+};
+
+/**
+ * \brief A stream being reassembled by a stream reader.
+ *
+ * The payload is allocated at its full size when the stream is opened. The
+ * received count is the number of payload bytes filled in so far.
+ */
+typedef struct stream_reader_entry
+{
+    bool open;
+    uint32_t stream_id;
+    vccrypt_buffer_t payload;
+    size_t received;
+} stream_reader_entry;
+
+/**
+ * \brief A stream reader.
+ */
+struct vcblockchain_stream_reader
+{
+    RCPR_SYM(resource) hdr;
+    allocator_options_t* alloc_opts;
+    stream_reader_entry* entries;
+    uint32_t max_streams;
+    uint64_t max_payload_size;
+
+    RCPR_MODEL_STRUCT_TAG(vcblockchain_stream_reader);
+};
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif /*__cplusplus*/
+
+#endif /*VCBLOCKCHAIN_STREAM_INTERNAL_HEADER_GUARD*/
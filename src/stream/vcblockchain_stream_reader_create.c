@@ -0,0 +1,137 @@
+/**
+ * \file stream/vcblockchain_stream_reader_create.c
+ *
+ * \brief Create a stream reader.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <vcblockchain/limits.h>
+
+#include "stream_internal.h"
+
+RCPR_IMPORT_resource;
+
+/* forward decls. */
+static status stream_reader_resource_release(resource* r);
+
+/**
+ * \brief Create a stream reader.
+ *
+ * \param reader                    Pointer to the pointer to receive the
+ *                                  stream reader on success.
+ * \param alloc_opts                The allocator used to allocate the reader
+ *                                  and the payloads it reassembles. It must
+ *                                  outlive the reader.
+ * \param max_streams               The number of streams that can be open at
+ *                                  once. If zero, then
+ *                                  \ref VCBLOCKCHAIN_STREAM_DEFAULT_MAX_STREAMS
+ *                                  is used.
+ * \param max_payload_size          The largest payload that a stream may
+ *                                  carry. If zero, then the maximum encrypted
+ *                                  packet size from \ref limits.h is used.
+ *
+ * Together, \p max_streams and \p max_payload_size bound the memory that a
+ * peer can make the reader hold.
+ *
+ * On success, \p reader is set to a stream reader instance. This instance is a
+ * \ref resource that is owned by the caller and must be released by calling
+ * \ref resource_release on its resource handle when it is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if the reader could not be
+ *        allocated.
+ */
+int vcblockchain_stream_reader_create(
+    vcblockchain_stream_reader** reader, allocator_options_t* alloc_opts,
+    uint32_t max_streams, uint64_t max_payload_size)
+{
+    vcblockchain_stream_reader* tmp;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != reader);
+    MODEL_ASSERT(NULL != alloc_opts);
+
+    /* runtime parameter checks. */
+    if (NULL == reader || NULL == alloc_opts)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* use the defaults for any limit not given. */
+    if (0U == max_streams)
+    {
+        max_streams = VCBLOCKCHAIN_STREAM_DEFAULT_MAX_STREAMS;
+    }
+    if (0U == max_payload_size)
+    {
+        max_payload_size = VCBLOCKCHAIN_LIMIT_MAXIMUM_ENCRYPTED_PACKET_SIZE;
+    }
+
+    /* allocate memory for the reader. */
+    tmp = (vcblockchain_stream_reader*)
+        allocate(alloc_opts, sizeof(vcblockchain_stream_reader));
+    if (NULL == tmp)
+    {
+        return VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* allocate the entries. */
+    size_t entries_size = (size_t)max_streams * sizeof(stream_reader_entry);
+    stream_reader_entry* entries =
+        (stream_reader_entry*)allocate(alloc_opts, entries_size);
+    if (NULL == entries)
+    {
+        release(alloc_opts, tmp);
+        return VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+    }
+
+    /* every stream starts out closed. */
+    memset(entries, 0, entries_size);
+
+    /* initialize the reader. */
+    memset(tmp, 0, sizeof(vcblockchain_stream_reader));
+    resource_init(&tmp->hdr, &stream_reader_resource_release);
+    tmp->alloc_opts = alloc_opts;
+    tmp->entries = entries;
+    tmp->max_streams = max_streams;
+    tmp->max_payload_size = max_payload_size;
+
+    /* success. */
+    *reader = tmp;
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
+
+/**
+ * \brief Release the stream reader resource.
+ */
+static status stream_reader_resource_release(resource* r)
+{
+    vcblockchain_stream_reader* reader = (vcblockchain_stream_reader*)r;
+
+    /* cache the allocator. */
+    allocator_options_t* alloc_opts = reader->alloc_opts;
+
+    /* dispose the payloads of any streams that were never finished. */
+    for (uint32_t i = 0; i < reader->max_streams; ++i)
+    {
+        if (reader->entries[i].open)
+        {
+            dispose((disposable_t*)&reader->entries[i].payload);
+        }
+    }
+
+    /* release the entries. */
+    memset(
+        reader->entries, 0, reader->max_streams * sizeof(stream_reader_entry));
+    release(alloc_opts, reader->entries);
+
+    /* clear and release the structure. */
+    memset(reader, 0, sizeof(vcblockchain_stream_reader));
+    release(alloc_opts, reader);
+
+    /* success. */
+    return STATUS_SUCCESS;
+}
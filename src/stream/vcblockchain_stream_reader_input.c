@@ -0,0 +1,202 @@
+/**
+ * \file stream/vcblockchain_stream_reader_input.c
+ *
+ * \brief Accept a frame, and hand back the payload of its stream if the frame
+ * completes it.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <vcblockchain/protocol/data.h>
+
+#include "../protocol/wire_internal.h"
+#include "stream_internal.h"
+
+/**
+ * \brief Accept a frame, and hand back the payload of its stream if the frame
+ * completes it.
+ *
+ * \param reader                    The stream reader.
+ * \param frame                     The frame, as read from the connection.
+ * \param frame_size                The size of the frame.
+ * \param stream_id                 Pointer to receive the id of the stream to
+ *                                  which the frame belongs.
+ * \param payload                   Pointer to the buffer to receive the
+ *                                  payload if the frame completes its stream.
+ *                                  On completion, this buffer is owned by the
+ *                                  caller and must be disposed.
+ * \param complete                  Pointer to receive true if the frame
+ *                                  completed its stream, and false otherwise.
+ *
+ * Any error returned by this function means that the peer has broken the
+ * framing, and the connection should be closed. If the frame belongs to an
+ * open stream, or opens one, then that stream is closed and its partial
+ * payload is released before the error is returned.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if a payload could not be
+ *        allocated.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE if the frame is
+ *        truncated, or if a stream is larger than its declared size or than
+ *        the reader allows.
+ *      - VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE if the frame is not a
+ *        stream frame, or if its flags don't match the state of its stream.
+ *      - VCBLOCKCHAIN_ERROR_STREAM_TABLE_FULL if the frame opens a stream
+ *        while as many streams are open as the reader allows.
+ */
+int vcblockchain_stream_reader_input(
+    vcblockchain_stream_reader* reader, const void* frame, size_t frame_size,
+    uint32_t* stream_id, vccrypt_buffer_t* payload, bool* complete)
+{
+    int retval;
+    vcblockchain_wire_reader frame_reader;
+    stream_reader_entry* entry = NULL;
+    stream_reader_entry* free_entry = NULL;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_vcblockchain_stream_reader_valid(reader));
+    MODEL_ASSERT(NULL != frame);
+    MODEL_ASSERT(NULL != stream_id);
+    MODEL_ASSERT(NULL != payload);
+    MODEL_ASSERT(NULL != complete);
+
+    /* runtime parameter checks. */
+    if (
+        NULL == reader || NULL == frame || NULL == stream_id || NULL == payload
+     || NULL == complete)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* the frame must hold at least the header. */
+    if (frame_size < VCBLOCKCHAIN_STREAM_FRAME_HEADER_SIZE)
+    {
+        return VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE;
+    }
+
+    /* read the header. */
+    vcblockchain_wire_reader_init(&frame_reader, frame, frame_size);
+    uint32_t request_id = vcblockchain_wire_read_u32(&frame_reader);
+    *stream_id = vcblockchain_wire_read_u32(&frame_reader);
+    uint32_t flags = vcblockchain_wire_read_u32(&frame_reader);
+
+    /* verify that this is a stream frame with known flags. */
+    if (
+        PROTOCOL_REQ_ID_STREAM_FRAME != request_id
+     || 0U != (flags & ~(VCBLOCKCHAIN_STREAM_FRAME_FLAG_START
+                       | VCBLOCKCHAIN_STREAM_FRAME_FLAG_FIN)))
+    {
+        return VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE;
+    }
+
+    /* look up the stream, and a free entry in case this frame opens it. */
+    for (uint32_t i = 0; i < reader->max_streams; ++i)
+    {
+        stream_reader_entry* e = &reader->entries[i];
+
+        if (!e->open)
+        {
+            if (NULL == free_entry)
+            {
+                free_entry = e;
+            }
+        }
+        else if (*stream_id == e->stream_id)
+        {
+            entry = e;
+            break;
+        }
+    }
+
+    /* the first frame of a stream opens it. */
+    if (flags & VCBLOCKCHAIN_STREAM_FRAME_FLAG_START)
+    {
+        /* a stream can't be opened twice. */
+        if (NULL != entry)
+        {
+            return VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE;
+        }
+
+        /* read the size of the payload. */
+        if (frame_size < VCBLOCKCHAIN_STREAM_FRAME_START_HEADER_SIZE)
+        {
+            return VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE;
+        }
+        uint64_t payload_size = vcblockchain_wire_read_u64(&frame_reader);
+
+        /* bound the memory this stream can hold. */
+        if (0U == payload_size || payload_size > reader->max_payload_size)
+        {
+            return VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE;
+        }
+
+        if (NULL == free_entry)
+        {
+            return VCBLOCKCHAIN_ERROR_STREAM_TABLE_FULL;
+        }
+
+        /* allocate the whole payload up front. */
+        retval =
+            vccrypt_buffer_init(
+                &free_entry->payload, reader->alloc_opts,
+                (size_t)payload_size);
+        if (VCCRYPT_STATUS_SUCCESS != retval)
+        {
+            return VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+        }
+
+        entry = free_entry;
+        entry->open = true;
+        entry->stream_id = *stream_id;
+        entry->received = 0U;
+    }
+    else if (NULL == entry)
+    {
+        /* every other frame must belong to an open stream. */
+        return VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE;
+    }
+
+    /* the chunk must fit in what is left of the payload. */
+    size_t chunk_size = vcblockchain_wire_reader_remaining(&frame_reader);
+    if (chunk_size > entry->payload.size - entry->received)
+    {
+        retval = VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE;
+        goto close_stream;
+    }
+
+    /* copy the chunk into place. */
+    vcblockchain_wire_read_bytes(
+        &frame_reader, (uint8_t*)entry->payload.data + entry->received,
+        chunk_size);
+    entry->received += chunk_size;
+
+    /* the last frame must be flagged as such, and only the last frame. */
+    bool filled = (entry->received == entry->payload.size);
+    bool fin = (0U != (flags & VCBLOCKCHAIN_STREAM_FRAME_FLAG_FIN));
+    if (filled != fin)
+    {
+        retval = VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE;
+        goto close_stream;
+    }
+
+    /* hand the payload back once the stream is complete. */
+    *complete = filled;
+    if (filled)
+    {
+        vccrypt_buffer_move(payload, &entry->payload);
+        entry->open = false;
+    }
+
+    /* success. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+
+close_stream:
+    /* the stream can't be completed, so release what it has received. */
+    dispose((disposable_t*)&entry->payload);
+    entry->open = false;
+    entry->received = 0U;
+
+    return retval;
+}
@@ -0,0 +1,24 @@
+/**
+ * \file stream/vcblockchain_stream_reader_resource_handle.c
+ *
+ * \brief Get the resource handle for the given stream reader.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "stream_internal.h"
+
+/**
+ * \brief Get the resource handle for the given stream reader.
+ *
+ * \param reader    The stream reader instance to access.
+ *
+ * \returns the resource handle for this stream reader instance.
+ */
+RCPR_SYM(resource)* vcblockchain_stream_reader_resource_handle(
+    vcblockchain_stream_reader* reader)
+{
+    MODEL_ASSERT(prop_vcblockchain_stream_reader_valid(reader));
+
+    return &reader->hdr;
+}
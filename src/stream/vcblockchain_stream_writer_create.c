@@ -0,0 +1,160 @@
+/**
+ * \file stream/vcblockchain_stream_writer_create.c
+ *
+ * \brief Create a stream writer.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "stream_internal.h"
+
+RCPR_IMPORT_resource;
+
+/* forward decls. */
+static status stream_writer_resource_release(resource* r);
+
+/**
+ * \brief Create a stream writer.
+ *
+ * \param writer                    Pointer to the pointer to receive the
+ *                                  stream writer on success.
+ * \param alloc_opts                The allocator used to allocate the writer.
+ *                                  It must outlive the writer.
+ * \param max_streams               The number of streams that can be open at
+ *                                  once. If zero, then
+ *                                  \ref VCBLOCKCHAIN_STREAM_DEFAULT_MAX_STREAMS
+ *                                  is used.
+ * \param chunk_size                The maximum number of payload bytes in each
+ *                                  frame. If zero, then
+ *                                  \ref VCBLOCKCHAIN_STREAM_DEFAULT_CHUNK_SIZE
+ *                                  is used.
+ *
+ * On success, \p writer is set to a stream writer instance. This instance is a
+ * \ref resource that is owned by the caller and must be released by calling
+ * \ref resource_release on its resource handle when it is no longer needed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ *      - VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY if the writer could not be
+ *        allocated.
+ */
+int vcblockchain_stream_writer_create(
+    vcblockchain_stream_writer** writer, allocator_options_t* alloc_opts,
+    uint32_t max_streams, uint32_t chunk_size)
+{
+    int retval;
+    vcblockchain_stream_writer* tmp;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(NULL != writer);
+    MODEL_ASSERT(NULL != alloc_opts);
+
+    /* runtime parameter checks. */
+    if (NULL == writer || NULL == alloc_opts)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* use the defaults for any limit not given. */
+    if (0U == max_streams)
+    {
+        max_streams = VCBLOCKCHAIN_STREAM_DEFAULT_MAX_STREAMS;
+    }
+    if (0U == chunk_size)
+    {
+        chunk_size = VCBLOCKCHAIN_STREAM_DEFAULT_CHUNK_SIZE;
+    }
+
+    /* allocate memory for the writer. */
+    tmp = (vcblockchain_stream_writer*)
+        allocate(alloc_opts, sizeof(vcblockchain_stream_writer));
+    if (NULL == tmp)
+    {
+        retval = VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+        goto done;
+    }
+
+    /* initialize the writer. */
+    memset(tmp, 0, sizeof(vcblockchain_stream_writer));
+    resource_init(&tmp->hdr, &stream_writer_resource_release);
+    tmp->alloc_opts = alloc_opts;
+    tmp->max_streams = max_streams;
+    tmp->chunk_size = chunk_size;
+
+    /* allocate the entries. */
+    size_t entries_size = (size_t)max_streams * sizeof(stream_writer_entry);
+    tmp->entries = (stream_writer_entry*)allocate(alloc_opts, entries_size);
+    if (NULL == tmp->entries)
+    {
+        retval = VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+        goto cleanup_writer;
+    }
+
+    /* every stream starts out closed. */
+    memset(tmp->entries, 0, entries_size);
+
+    /* allocate the frame, which is reused for every frame handed out. */
+    tmp->frame = (uint8_t*)
+        allocate(
+            alloc_opts,
+            VCBLOCKCHAIN_STREAM_FRAME_START_HEADER_SIZE + (size_t)chunk_size);
+    if (NULL == tmp->frame)
+    {
+        retval = VCBLOCKCHAIN_ERROR_OUT_OF_MEMORY;
+        goto cleanup_entries;
+    }
+
+    /* success. */
+    *writer = tmp;
+    retval = VCBLOCKCHAIN_STATUS_SUCCESS;
+    goto done;
+
+cleanup_entries:
+    release(alloc_opts, tmp->entries);
+
+cleanup_writer:
+    memset(tmp, 0, sizeof(vcblockchain_stream_writer));
+    release(alloc_opts, tmp);
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Release the stream writer resource.
+ */
+static status stream_writer_resource_release(resource* r)
+{
+    vcblockchain_stream_writer* writer = (vcblockchain_stream_writer*)r;
+
+    /* cache the allocator. */
+    allocator_options_t* alloc_opts = writer->alloc_opts;
+
+    /* dispose the payloads of any streams that were never finished. */
+    for (uint32_t i = 0; i < writer->max_streams; ++i)
+    {
+        if (writer->entries[i].open)
+        {
+            dispose((disposable_t*)&writer->entries[i].payload);
+        }
+    }
+
+    /* release the entries. */
+    memset(
+        writer->entries, 0, writer->max_streams * sizeof(stream_writer_entry));
+    release(alloc_opts, writer->entries);
+
+    /* release the frame. */
+    memset(
+        writer->frame, 0,
+        VCBLOCKCHAIN_STREAM_FRAME_START_HEADER_SIZE + writer->chunk_size);
+    release(alloc_opts, writer->frame);
+
+    /* clear and release the structure. */
+    memset(writer, 0, sizeof(vcblockchain_stream_writer));
+    release(alloc_opts, writer);
+
+    /* success. */
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,124 @@
+/**
+ * \file stream/vcblockchain_stream_writer_next_frame.c
+ *
+ * \brief Get the next frame to send.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <vcblockchain/protocol/data.h>
+
+#include "../protocol/wire_internal.h"
+#include "stream_internal.h"
+
+/**
+ * \brief Get the next frame to send.
+ *
+ * \param writer                    The stream writer.
+ * \param frame                     Pointer to receive the frame. It remains
+ *                                  valid until the writer is next called.
+ * \param frame_size                Pointer to receive the size of the frame,
+ *                                  which is zero if no stream is open.
+ *
+ * The frame is taken from the open stream with the most urgent priority.
+ * Streams with the same priority take turns. Once the last frame of a stream
+ * has been handed out, the stream is closed and its payload is released.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided.
+ */
+int vcblockchain_stream_writer_next_frame(
+    vcblockchain_stream_writer* writer, const void** frame,
+    size_t* frame_size)
+{
+    stream_writer_entry* entry = NULL;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_vcblockchain_stream_writer_valid(writer));
+    MODEL_ASSERT(NULL != frame);
+    MODEL_ASSERT(NULL != frame_size);
+
+    /* runtime parameter checks. */
+    if (NULL == writer || NULL == frame || NULL == frame_size)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* find the open stream with the most urgent priority that has waited
+     * longest for its turn. */
+    for (uint32_t i = 0; i < writer->max_streams; ++i)
+    {
+        stream_writer_entry* e = &writer->entries[i];
+
+        if (
+            e->open
+         && (NULL == entry || e->priority < entry->priority
+          || (e->priority == entry->priority && e->turn < entry->turn)))
+        {
+            entry = e;
+        }
+    }
+
+    /* if no stream is open, then there is nothing to send. */
+    if (NULL == entry)
+    {
+        *frame = writer->frame;
+        *frame_size = 0U;
+        return VCBLOCKCHAIN_STATUS_SUCCESS;
+    }
+
+    /* size the next chunk of the payload. */
+    size_t remaining = entry->payload.size - entry->sent;
+    size_t chunk_size =
+        remaining < writer->chunk_size ? remaining : writer->chunk_size;
+
+    /* flag the first and the last frame of the stream. */
+    uint32_t flags = 0U;
+    if (0U == entry->sent)
+    {
+        flags |= VCBLOCKCHAIN_STREAM_FRAME_FLAG_START;
+    }
+    if (chunk_size == remaining)
+    {
+        flags |= VCBLOCKCHAIN_STREAM_FRAME_FLAG_FIN;
+    }
+
+    /* write the frame header. */
+    vcblockchain_wire_writer frame_writer;
+    vcblockchain_wire_writer_init(
+        &frame_writer, writer->frame,
+        VCBLOCKCHAIN_STREAM_FRAME_START_HEADER_SIZE + writer->chunk_size);
+    vcblockchain_wire_write_u32(&frame_writer, PROTOCOL_REQ_ID_STREAM_FRAME);
+    vcblockchain_wire_write_u32(&frame_writer, entry->stream_id);
+    vcblockchain_wire_write_u32(&frame_writer, flags);
+
+    /* the first frame also carries the size of the whole payload. */
+    if (flags & VCBLOCKCHAIN_STREAM_FRAME_FLAG_START)
+    {
+        vcblockchain_wire_write_u64(&frame_writer, entry->payload.size);
+    }
+
+    /* write the chunk. */
+    vcblockchain_wire_write_bytes(
+        &frame_writer, (const uint8_t*)entry->payload.data + entry->sent,
+        chunk_size);
+    entry->sent += chunk_size;
+
+    /* close the stream once its last frame has been handed out. */
+    if (flags & VCBLOCKCHAIN_STREAM_FRAME_FLAG_FIN)
+    {
+        dispose((disposable_t*)&entry->payload);
+        entry->open = false;
+    }
+    else
+    {
+        /* go to the back of the line, so that its peers get a turn. */
+        entry->turn = ++writer->turn;
+    }
+
+    /* success. */
+    *frame = writer->frame;
+    *frame_size = (size_t)(frame_writer.ptr - writer->frame);
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
@@ -0,0 +1,24 @@
+/**
+ * \file stream/vcblockchain_stream_writer_resource_handle.c
+ *
+ * \brief Get the resource handle for the given stream writer.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "stream_internal.h"
+
+/**
+ * \brief Get the resource handle for the given stream writer.
+ *
+ * \param writer    The stream writer instance to access.
+ *
+ * \returns the resource handle for this stream writer instance.
+ */
+RCPR_SYM(resource)* vcblockchain_stream_writer_resource_handle(
+    vcblockchain_stream_writer* writer)
+{
+    MODEL_ASSERT(prop_vcblockchain_stream_writer_valid(writer));
+
+    return &writer->hdr;
+}
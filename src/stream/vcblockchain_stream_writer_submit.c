@@ -0,0 +1,87 @@
+/**
+ * \file stream/vcblockchain_stream_writer_submit.c
+ *
+ * \brief Open a stream to send the given payload.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "stream_internal.h"
+
+/**
+ * \brief Open a stream to send the given payload.
+ *
+ * \param writer                    The stream writer.
+ * \param stream_id                 The id of the stream, which must not be
+ *                                  open.
+ * \param priority                  The priority of the stream. Lower values
+ *                                  are more urgent.
+ * \param payload                   The payload to send, such as an encoded
+ *                                  response. It must not be empty. On success,
+ *                                  the payload is moved into the writer, and
+ *                                  this buffer is left empty.
+ *
+ * Frames are handed out in priority order, so a stream is not framed while a
+ * stream with a more urgent priority has frames left. Bulk streams should use
+ * a less urgent priority than interactive ones, and interactive payloads
+ * should be small, or they will starve the bulk streams.
+ *
+ * \returns a status code indicating success or failure.
+ *      - VCBLOCKCHAIN_STATUS_SUCCESS on success.
+ *      - VCBLOCKCHAIN_ERROR_INVALID_ARG if an invalid argument was provided,
+ *        or if the stream is already open.
+ *      - VCBLOCKCHAIN_ERROR_STREAM_TABLE_FULL if as many streams are open as
+ *        the writer allows.
+ */
+int vcblockchain_stream_writer_submit(
+    vcblockchain_stream_writer* writer, uint32_t stream_id, uint32_t priority,
+    vccrypt_buffer_t* payload)
+{
+    stream_writer_entry* free_entry = NULL;
+
+    /* parameter sanity checks. */
+    MODEL_ASSERT(prop_vcblockchain_stream_writer_valid(writer));
+    MODEL_ASSERT(NULL != payload);
+
+    /* runtime parameter checks. */
+    if (
+        NULL == writer || NULL == payload || NULL == payload->data
+     || 0U == payload->size)
+    {
+        return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+    }
+
+    /* find a free entry, making sure that the stream is not already open. */
+    for (uint32_t i = 0; i < writer->max_streams; ++i)
+    {
+        stream_writer_entry* entry = &writer->entries[i];
+
+        if (!entry->open)
+        {
+            if (NULL == free_entry)
+            {
+                free_entry = entry;
+            }
+        }
+        else if (stream_id == entry->stream_id)
+        {
+            return VCBLOCKCHAIN_ERROR_INVALID_ARG;
+        }
+    }
+
+    if (NULL == free_entry)
+    {
+        return VCBLOCKCHAIN_ERROR_STREAM_TABLE_FULL;
+    }
+
+    /* open the stream, taking ownership of the payload. */
+    free_entry->open = true;
+    free_entry->stream_id = stream_id;
+    free_entry->priority = priority;
+    free_entry->turn = ++writer->turn;
+    free_entry->sent = 0U;
+    vccrypt_buffer_move(&free_entry->payload, payload);
+
+    /* success. */
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
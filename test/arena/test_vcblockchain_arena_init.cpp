@@ -0,0 +1,175 @@
+/**
+ * \file test/arena/test_vcblockchain_arena_init.cpp
+ *
+ * Unit tests for initializing and allocating from a bump arena.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/arena.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_arena_init);
+
+/**
+ * This method should perform null checks on its pointer parameters.
+ */
+TEST(parameters)
+{
+    allocator_options_t alloc_opts;
+    vcblockchain_arena arena;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_arena_init(nullptr, &alloc_opts, 0U));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_arena_init(&arena, nullptr, 0U));
+
+    /* clean up. */
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * Allocations from an arena are aligned and do not overlap.
+ */
+TEST(aligned_allocations)
+{
+    allocator_options_t alloc_opts;
+    vcblockchain_arena arena;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* initialize the arena. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_arena_init(&arena, &alloc_opts, 1024U));
+
+    /* allocate a few odd sized regions. */
+    uint8_t* first = (uint8_t*)allocate(&arena.alloc_opts, 3);
+    uint8_t* second = (uint8_t*)allocate(&arena.alloc_opts, 17);
+    uint8_t* third = (uint8_t*)allocate(&arena.alloc_opts, 1);
+    TEST_ASSERT(nullptr != first);
+    TEST_ASSERT(nullptr != second);
+    TEST_ASSERT(nullptr != third);
+
+    /* each allocation is aligned. */
+    TEST_EXPECT(0U == ((uintptr_t)first) % VCBLOCKCHAIN_ARENA_ALIGNMENT);
+    TEST_EXPECT(0U == ((uintptr_t)second) % VCBLOCKCHAIN_ARENA_ALIGNMENT);
+    TEST_EXPECT(0U == ((uintptr_t)third) % VCBLOCKCHAIN_ARENA_ALIGNMENT);
+
+    /* allocations are bumped forward without overlapping. */
+    TEST_EXPECT(second >= first + 3);
+    TEST_EXPECT(third >= second + 17);
+
+    /* releasing memory is a no-op. */
+    release(&arena.alloc_opts, second);
+
+    /* clean up. */
+    dispose((disposable_t*)&arena);
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * An allocation larger than the chunk size gets its own chunk.
+ */
+TEST(oversized_allocation)
+{
+    allocator_options_t alloc_opts;
+    vcblockchain_arena arena;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* initialize the arena with a tiny chunk size. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_arena_init(&arena, &alloc_opts, 64U));
+
+    /* allocate something much larger than a chunk. */
+    uint8_t* big = (uint8_t*)allocate(&arena.alloc_opts, 4096);
+    TEST_ASSERT(nullptr != big);
+
+    /* the whole region is usable. */
+    memset(big, 0xA5, 4096);
+
+    /* small allocations still work afterward. */
+    uint8_t* small = (uint8_t*)allocate(&arena.alloc_opts, 8);
+    TEST_ASSERT(nullptr != small);
+    TEST_EXPECT(small < big || small >= big + 4096);
+
+    /* clean up. */
+    dispose((disposable_t*)&arena);
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * A response can be decoded into an arena, and disposing the decoded response
+ * is harmless.
+ */
+TEST(decode_into_arena)
+{
+    const uint32_t EXPECTED_OFFSET = 52;
+    const uint32_t EXPECTED_STATUS = 0;
+    const vpr_uuid EXPECTED_TXN_ID = { .data = {
+        0x26, 0x49, 0xc3, 0xf4, 0xc6, 0x11, 0x4f, 0x0e,
+        0x95, 0xe6, 0x24, 0xd4, 0x12, 0xfc, 0x7c, 0x83 } };
+    const vpr_uuid EXPECTED_ZERO_ID = { .data = {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } };
+    const uint8_t EXPECTED_TXN_CERT[4] = { 0x01, 0x02, 0x03, 0x04 };
+    allocator_options_t alloc_opts;
+    vcblockchain_arena arena;
+    protocol_resp_txn_get resp;
+    vccrypt_buffer_t out;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* initialize the arena. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_arena_init(&arena, &alloc_opts, 0U));
+
+    /* we can encode this message into the arena. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_resp_txn_get(
+                    &out, &arena.alloc_opts, EXPECTED_OFFSET, EXPECTED_STATUS,
+                    &EXPECTED_TXN_ID, &EXPECTED_ZERO_ID, &EXPECTED_ZERO_ID,
+                    &EXPECTED_ZERO_ID, &EXPECTED_ZERO_ID,
+                    sizeof(EXPECTED_TXN_CERT), EXPECTED_TXN_CERT,
+                    sizeof(EXPECTED_TXN_CERT), 0));
+
+    /* we can decode this message into the arena. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_decode_resp_txn_get(
+                    &resp, &arena.alloc_opts, out.data, out.size));
+
+    /* the decoded values are correct. */
+    TEST_EXPECT(EXPECTED_OFFSET == resp.offset);
+    TEST_EXPECT(0 == memcmp(&resp.txn_id, &EXPECTED_TXN_ID, 16));
+    TEST_ASSERT(sizeof(EXPECTED_TXN_CERT) == resp.txn_cert.size);
+    TEST_EXPECT(
+        0
+            == memcmp(
+                    resp.txn_cert.data, EXPECTED_TXN_CERT,
+                    sizeof(EXPECTED_TXN_CERT)));
+
+    /* clean up. */
+    dispose((disposable_t*)&out);
+    dispose((disposable_t*)&resp);
+    dispose((disposable_t*)&arena);
+    dispose((disposable_t*)&alloc_opts);
+}
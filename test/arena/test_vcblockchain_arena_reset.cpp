@@ -0,0 +1,78 @@
+/**
+ * \file test/arena/test_vcblockchain_arena_reset.cpp
+ *
+ * Unit tests for resetting a bump arena.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/arena.h>
+#include <vcblockchain/error_codes.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_arena_reset);
+
+/**
+ * Resetting an empty arena is harmless.
+ */
+TEST(empty_reset)
+{
+    allocator_options_t alloc_opts;
+    vcblockchain_arena arena;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* initialize the arena. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_arena_init(&arena, &alloc_opts, 0U));
+
+    /* reset the empty arena. */
+    vcblockchain_arena_reset(&arena);
+
+    /* we can still allocate from it. */
+    TEST_EXPECT(nullptr != allocate(&arena.alloc_opts, 32));
+
+    /* clean up. */
+    dispose((disposable_t*)&arena);
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * After a reset, the arena reuses the memory it has already allocated.
+ */
+TEST(reset_reuses_chunks)
+{
+    allocator_options_t alloc_opts;
+    vcblockchain_arena arena;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* initialize the arena with a small chunk size. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_arena_init(&arena, &alloc_opts, 128U));
+
+    /* fill more than one chunk. */
+    void* first = allocate(&arena.alloc_opts, 100);
+    void* second = allocate(&arena.alloc_opts, 100);
+    TEST_ASSERT(nullptr != first);
+    TEST_ASSERT(nullptr != second);
+
+    /* reset the arena. */
+    vcblockchain_arena_reset(&arena);
+
+    /* the same memory is handed out again, in the same order. */
+    TEST_EXPECT(first == allocate(&arena.alloc_opts, 100));
+    TEST_EXPECT(second == allocate(&arena.alloc_opts, 100));
+
+    /* clean up. */
+    dispose((disposable_t*)&arena);
+    dispose((disposable_t*)&alloc_opts);
+}
@@ -0,0 +1,340 @@
+/**
+ * \file test/async_client/test_vcblockchain_async_client_input.cpp
+ *
+ * Unit tests for driving an async client from an event loop.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/async_client.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vcblockchain/psock.h>
+#include <vector>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+RCPR_IMPORT_resource;
+
+TEST_SUITE(test_vcblockchain_async_client_input);
+
+/**
+ * \brief A response seen by a completion function.
+ */
+struct completion_record
+{
+    int waiter;
+    uint32_t request_id;
+    uint32_t offset;
+    uint32_t status;
+};
+
+/**
+ * \brief The context for a test waiter.
+ */
+struct test_waiter
+{
+    int id;
+    vector<completion_record>* log;
+};
+
+/**
+ * \brief Record a response in the log of its waiter.
+ */
+static bool record_completion(
+    void* context, uint32_t request_id, uint32_t offset, uint32_t status,
+    const void*, size_t)
+{
+    test_waiter* waiter = (test_waiter*)context;
+
+    waiter->log->push_back({ waiter->id, request_id, offset, status });
+
+    return false;
+}
+
+/**
+ * \brief Seal an error response as the server would send it, and append it to
+ * the stream.
+ */
+static int seal_response(
+    vector<uint8_t>& stream, allocator_options_t* alloc_opts,
+    vccrypt_suite_options_t* suite, const vccrypt_buffer_t* shared_secret,
+    uint64_t server_iv, uint32_t offset, uint32_t status)
+{
+    int retval;
+    vccrypt_buffer_t response, packet;
+    vcblockchain_psock_iovec vec;
+
+    retval =
+        vcblockchain_protocol_encode_error_resp(
+            &response, alloc_opts, PROTOCOL_REQ_ID_LATEST_BLOCK_ID_GET, offset,
+            status);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    vec.data = response.data;
+    vec.size = response.size;
+    retval =
+        psock_seal_authed_datav(
+            &packet, server_iv, &vec, 1, suite, shared_secret);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS == retval)
+    {
+        const uint8_t* bpacket = (const uint8_t*)packet.data;
+        stream.insert(stream.end(), bpacket, bpacket + packet.size);
+        dispose((disposable_t*)&packet);
+    }
+
+    dispose((disposable_t*)&response);
+
+    return retval;
+}
+
+/**
+ * Requests are sealed into the output, and responses that arrive a byte at a
+ * time, out of order, are routed to the right waiters.
+ */
+TEST(round_trip)
+{
+    vcblockchain_async_client* client;
+    vector<completion_record> log;
+    test_waiter waiters[2] = { { 0, &log }, { 1, &log } };
+    uint32_t offsets[2];
+    vector<uint8_t> stream;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t suite;
+    vccrypt_buffer_t shared_secret;
+    const void* output;
+    size_t output_size, packet_size;
+
+    /* register the suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create the crypto suite. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_options_init(
+                    &suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1));
+
+    /* create a null shared secret. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_buffer_init_for_cipher_key_agreement_shared_secret(
+                    &suite, &shared_secret));
+    memset(shared_secret.data, 0, shared_secret.size);
+
+    /* create the async client. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_async_client_create(
+                    &client, &alloc_opts, &suite, &shared_secret, 5U, 9U, 4U));
+
+    /* nothing is waiting to be written. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_async_client_output(
+                    client, &output, &output_size));
+    TEST_EXPECT(0U == output_size);
+
+    /* submit two requests. */
+    for (int i = 0; i < 2; ++i)
+    {
+        vccrypt_buffer_t request;
+
+        TEST_ASSERT(
+            VCBLOCKCHAIN_STATUS_SUCCESS
+                == vcblockchain_async_client_acquire(
+                        client, &record_completion, &waiters[i], 0U,
+                        &offsets[i]));
+        TEST_ASSERT(
+            VCBLOCKCHAIN_STATUS_SUCCESS
+                == vcblockchain_protocol_encode_req_latest_block_id_get(
+                        &request, &alloc_opts, offsets[i]));
+        TEST_ASSERT(
+            VCBLOCKCHAIN_STATUS_SUCCESS
+                == vcblockchain_async_client_submit(
+                        client, request.data, request.size));
+        dispose((disposable_t*)&request);
+    }
+
+    /* the output holds both requests, sealed with consecutive client IVs. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_async_client_output(
+                    client, &output, &output_size));
+    for (int i = 0; i < 2; ++i)
+    {
+        vccrypt_buffer_t payload;
+
+        TEST_ASSERT(
+            VCBLOCKCHAIN_STATUS_SUCCESS
+                == psock_open_authed_data(
+                        &payload, &packet_size, output, output_size, 5U + i,
+                        &suite, &shared_secret));
+        dispose((disposable_t*)&payload);
+
+        /* the event loop writes one packet at a time. */
+        TEST_ASSERT(
+            VCBLOCKCHAIN_STATUS_SUCCESS
+                == vcblockchain_async_client_output_consume(
+                        client, packet_size));
+        TEST_ASSERT(
+            VCBLOCKCHAIN_STATUS_SUCCESS
+                == vcblockchain_async_client_output(
+                        client, &output, &output_size));
+    }
+    TEST_EXPECT(0U == output_size);
+
+    /* the server answers the requests in reverse order. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == seal_response(
+                    stream, &alloc_opts, &suite, &shared_secret, 9U,
+                    offsets[1], 101U));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == seal_response(
+                    stream, &alloc_opts, &suite, &shared_secret, 10U,
+                    offsets[0], 100U));
+
+    /* the responses trickle in a byte at a time. */
+    for (size_t i = 0; i < stream.size(); ++i)
+    {
+        TEST_ASSERT(
+            VCBLOCKCHAIN_STATUS_SUCCESS
+                == vcblockchain_async_client_input(client, &stream[i], 1U));
+    }
+
+    /* each response reached its own waiter, in arrival order. */
+    TEST_ASSERT(2U == log.size());
+    for (int i = 0; i < 2; ++i)
+    {
+        TEST_EXPECT(1 - i == log[i].waiter);
+        TEST_EXPECT(PROTOCOL_REQ_ID_LATEST_BLOCK_ID_GET == log[i].request_id);
+        TEST_EXPECT(offsets[1 - i] == log[i].offset);
+        TEST_EXPECT(100U + (1 - i) == log[i].status);
+    }
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(
+                    vcblockchain_async_client_resource_handle(client)));
+    dispose((disposable_t*)&shared_secret);
+    dispose((disposable_t*)&suite);
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * A request that misses its deadline times out, and its late response is
+ * discarded.
+ */
+TEST(deadline)
+{
+    vcblockchain_async_client* client;
+    vector<completion_record> log;
+    test_waiter waiter = { 0, &log };
+    test_waiter next_waiter = { 1, &log };
+    uint32_t offset, next_offset;
+    vector<uint8_t> stream;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t suite;
+    vccrypt_buffer_t shared_secret;
+
+    /* register the suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create the crypto suite. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_options_init(
+                    &suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1));
+
+    /* create a null shared secret. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_buffer_init_for_cipher_key_agreement_shared_secret(
+                    &suite, &shared_secret));
+    memset(shared_secret.data, 0, shared_secret.size);
+
+    /* create the async client. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_async_client_create(
+                    &client, &alloc_opts, &suite, &shared_secret, 0U, 0U, 0U));
+
+    /* no request has a deadline yet. */
+    TEST_EXPECT(0U == vcblockchain_async_client_next_deadline(client));
+
+    /* acquire an offset with a deadline. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_async_client_acquire(
+                    client, &record_completion, &waiter, 100U, &offset));
+    TEST_EXPECT(100U == vcblockchain_async_client_next_deadline(client));
+
+    /* the request does not expire early. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_async_client_expire(client, 99U));
+    TEST_EXPECT(log.empty());
+
+    /* the request expires at its deadline. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_async_client_expire(client, 100U));
+    TEST_ASSERT(1U == log.size());
+    TEST_EXPECT(offset == log[0].offset);
+    TEST_EXPECT(VCBLOCKCHAIN_ERROR_REQUEST_TIMED_OUT == log[0].status);
+    TEST_EXPECT(0U == vcblockchain_async_client_next_deadline(client));
+
+    /* the offset was freed when the request expired. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_async_client_release(client, offset));
+
+    /* its slot is reused by the next request, under a new offset. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_async_client_acquire(
+                    client, &record_completion, &next_waiter, 0U,
+                    &next_offset));
+    TEST_EXPECT(offset != next_offset);
+
+    /* a late response is discarded, and does not reach the next request. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == seal_response(
+                    stream, &alloc_opts, &suite, &shared_secret, 0U, offset,
+                    0U));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_async_client_input(
+                    client, stream.data(), stream.size()));
+    TEST_EXPECT(1U == log.size());
+
+    /* the next request is still waiting. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_async_client_release(client, next_offset));
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(
+                    vcblockchain_async_client_resource_handle(client)));
+    dispose((disposable_t*)&shared_secret);
+    dispose((disposable_t*)&suite);
+    dispose((disposable_t*)&alloc_opts);
+}
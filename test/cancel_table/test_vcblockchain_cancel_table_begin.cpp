@@ -0,0 +1,120 @@
+/**
+ * \file test/cancel_table/test_vcblockchain_cancel_table_begin.cpp
+ *
+ * Unit tests for registering a request with a cancel table.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <vcblockchain/cancel_table.h>
+#include <vcblockchain/error_codes.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_cancel_table_begin);
+
+/**
+ * Each request in flight gets its own slot.
+ */
+TEST(happy_path)
+{
+    allocator_options_t alloc_opts;
+    vcblockchain_cancel_table table;
+    size_t token1, token2;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* initialize the table. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_cancel_table_init(&table, &alloc_opts, 4U));
+
+    /* register two requests. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_cancel_table_begin(&table, 17U, &token1));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_cancel_table_begin(&table, 18U, &token2));
+
+    /* they occupy different slots and are not cancelled. */
+    TEST_EXPECT(token1 != token2);
+    TEST_EXPECT(2U == table.count);
+    TEST_EXPECT(!vcblockchain_cancel_table_is_cancelled(&table, token1));
+    TEST_EXPECT(!vcblockchain_cancel_table_is_cancelled(&table, token2));
+
+    /* clean up. */
+    dispose((disposable_t*)&table);
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * An offset that is already in flight is rejected.
+ */
+TEST(duplicate_offset)
+{
+    allocator_options_t alloc_opts;
+    vcblockchain_cancel_table table;
+    size_t token;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* initialize the table. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_cancel_table_init(&table, &alloc_opts, 4U));
+
+    /* register a request. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_cancel_table_begin(&table, 17U, &token));
+
+    /* registering the same offset again fails. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_cancel_table_begin(&table, 17U, &token));
+    TEST_EXPECT(1U == table.count);
+
+    /* clean up. */
+    dispose((disposable_t*)&table);
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * A full table rejects further requests.
+ */
+TEST(table_full)
+{
+    allocator_options_t alloc_opts;
+    vcblockchain_cancel_table table;
+    size_t token;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* initialize the table. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_cancel_table_init(&table, &alloc_opts, 2U));
+
+    /* fill the table. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_cancel_table_begin(&table, 1U, &token));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_cancel_table_begin(&table, 2U, &token));
+
+    /* there is no room for a third request. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_CANCEL_TABLE_FULL
+            == vcblockchain_cancel_table_begin(&table, 3U, &token));
+
+    /* clean up. */
+    dispose((disposable_t*)&table);
+    dispose((disposable_t*)&alloc_opts);
+}
@@ -0,0 +1,105 @@
+/**
+ * \file test/cancel_table/test_vcblockchain_cancel_table_cancel.cpp
+ *
+ * Unit tests for cancelling a request in flight.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <vcblockchain/cancel_table.h>
+#include <vcblockchain/error_codes.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_cancel_table_cancel);
+
+/**
+ * This method should reject invalid parameters.
+ */
+TEST(parameters)
+{
+    /* a null table is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_cancel_table_cancel(nullptr, 18U));
+}
+
+/**
+ * Cancelling a request only marks that request.
+ */
+TEST(happy_path)
+{
+    allocator_options_t alloc_opts;
+    vcblockchain_cancel_table table;
+    size_t token1, token2;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* initialize the table and register two requests. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_cancel_table_init(&table, &alloc_opts, 4U));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_cancel_table_begin(&table, 17U, &token1));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_cancel_table_begin(&table, 18U, &token2));
+
+    /* cancel the second request. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_cancel_table_cancel(&table, 18U));
+
+    /* only the second request is cancelled. */
+    TEST_EXPECT(!vcblockchain_cancel_table_is_cancelled(&table, token1));
+    TEST_EXPECT(vcblockchain_cancel_table_is_cancelled(&table, token2));
+
+    /* cancelling it again still succeeds. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_cancel_table_cancel(&table, 18U));
+
+    /* clean up. */
+    dispose((disposable_t*)&table);
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * Cancelling an offset that is not in flight fails.
+ */
+TEST(not_found)
+{
+    allocator_options_t alloc_opts;
+    vcblockchain_cancel_table table;
+    size_t token;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* initialize the table. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_cancel_table_init(&table, &alloc_opts, 4U));
+
+    /* nothing is in flight yet. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_PROTOCOL_REQUEST_NOT_FOUND
+            == vcblockchain_cancel_table_cancel(&table, 17U));
+
+    /* a completed request can no longer be cancelled. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_cancel_table_begin(&table, 17U, &token));
+    vcblockchain_cancel_table_end(&table, token);
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_PROTOCOL_REQUEST_NOT_FOUND
+            == vcblockchain_cancel_table_cancel(&table, 17U));
+
+    /* clean up. */
+    dispose((disposable_t*)&table);
+    dispose((disposable_t*)&alloc_opts);
+}
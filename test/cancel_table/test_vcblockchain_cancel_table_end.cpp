@@ -0,0 +1,57 @@
+/**
+ * \file test/cancel_table/test_vcblockchain_cancel_table_end.cpp
+ *
+ * Unit tests for removing a completed request from a cancel table.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <vcblockchain/cancel_table.h>
+#include <vcblockchain/error_codes.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_cancel_table_end);
+
+/**
+ * Ending a request frees its slot for reuse with a clean state.
+ */
+TEST(slot_reuse)
+{
+    allocator_options_t alloc_opts;
+    vcblockchain_cancel_table table;
+    size_t token1, token2;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* initialize a table with a single slot. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_cancel_table_init(&table, &alloc_opts, 1U));
+
+    /* register and cancel a request. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_cancel_table_begin(&table, 17U, &token1));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_cancel_table_cancel(&table, 17U));
+
+    /* end the request. */
+    vcblockchain_cancel_table_end(&table, token1);
+    TEST_EXPECT(0U == table.count);
+
+    /* the slot can be reused, and the new request is not cancelled. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_cancel_table_begin(&table, 17U, &token2));
+    TEST_EXPECT(token1 == token2);
+    TEST_EXPECT(!vcblockchain_cancel_table_is_cancelled(&table, token2));
+
+    /* clean up. */
+    dispose((disposable_t*)&table);
+    dispose((disposable_t*)&alloc_opts);
+}
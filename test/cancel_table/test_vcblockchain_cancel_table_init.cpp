@@ -0,0 +1,72 @@
+/**
+ * \file test/cancel_table/test_vcblockchain_cancel_table_init.cpp
+ *
+ * Unit tests for initializing a cancel table.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <vcblockchain/cancel_table.h>
+#include <vcblockchain/error_codes.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_cancel_table_init);
+
+/**
+ * This method should reject invalid parameters.
+ */
+TEST(parameters)
+{
+    allocator_options_t alloc_opts;
+    vcblockchain_cancel_table table;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* null pointers and an empty table are rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_cancel_table_init(nullptr, &alloc_opts, 8U));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_cancel_table_init(&table, nullptr, 8U));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_cancel_table_init(&table, &alloc_opts, 0U));
+
+    /* clean up. */
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * A freshly initialized table has no requests in flight.
+ */
+TEST(happy_path)
+{
+    allocator_options_t alloc_opts;
+    vcblockchain_cancel_table table;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* initialize the table. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_cancel_table_init(&table, &alloc_opts, 8U));
+
+    /* the table is empty. */
+    TEST_EXPECT(8U == table.capacity);
+    TEST_EXPECT(0U == table.count);
+    TEST_ASSERT(nullptr != table.entries);
+    for (size_t i = 0; i < table.capacity; ++i)
+    {
+        TEST_EXPECT(!table.entries[i].in_flight);
+    }
+
+    /* clean up. */
+    dispose((disposable_t*)&table);
+    dispose((disposable_t*)&alloc_opts);
+}
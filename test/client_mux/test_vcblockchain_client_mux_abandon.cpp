@@ -0,0 +1,119 @@
+/**
+ * \file test/client_mux/test_vcblockchain_client_mux_abandon.cpp
+ *
+ * Unit tests for abandoning an offset acquired from a client multiplexer.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <vcblockchain/client_mux.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_client_mux_abandon);
+
+/**
+ * \brief A completion function that counts its responses.
+ */
+static bool count_completion(
+    void* context, uint32_t, uint32_t, uint32_t, const void*, size_t)
+{
+    int* count = (int*)context;
+
+    ++*count;
+
+    return false;
+}
+
+/**
+ * Abandoning an offset frees its slot at once, and a late response for it is
+ * discarded instead of reaching the request that reuses the slot.
+ */
+TEST(late_response)
+{
+    allocator_options_t alloc_opts;
+    vcblockchain_client_mux mux;
+    vccrypt_buffer_t response;
+    uint32_t first, second;
+    int first_count = 0, second_count = 0;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* initialize the multiplexer with a depth of one. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_mux_init(&mux, &alloc_opts, 1U));
+
+    /* acquire and abandon an offset. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_mux_acquire(
+                    &mux, &count_completion, &first_count, &first));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_mux_abandon(&mux, first));
+    TEST_EXPECT(0U == mux.in_flight);
+
+    /* it can't be abandoned twice. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_client_mux_abandon(&mux, first));
+
+    /* the slot is reused under a different offset. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_mux_acquire(
+                    &mux, &count_completion, &second_count, &second));
+    TEST_EXPECT(first != second);
+
+    /* the late response for the abandoned offset is discarded. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_error_resp(
+                    &response, &alloc_opts,
+                    PROTOCOL_REQ_ID_LATEST_BLOCK_ID_GET, first, 0U));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_mux_complete(
+                    &mux, response.data, response.size));
+    TEST_EXPECT(0 == first_count);
+    TEST_EXPECT(0 == second_count);
+    TEST_EXPECT(1U == mux.in_flight);
+    dispose((disposable_t*)&response);
+
+    /* a response for an offset that was never used is still an error. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_error_resp(
+                    &response, &alloc_opts,
+                    PROTOCOL_REQ_ID_LATEST_BLOCK_ID_GET, second + 1U, 0U));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE
+            == vcblockchain_client_mux_complete(
+                    &mux, response.data, response.size));
+    dispose((disposable_t*)&response);
+
+    /* the response for the new offset completes its request. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_error_resp(
+                    &response, &alloc_opts,
+                    PROTOCOL_REQ_ID_LATEST_BLOCK_ID_GET, second, 0U));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_mux_complete(
+                    &mux, response.data, response.size));
+    TEST_EXPECT(0 == first_count);
+    TEST_EXPECT(1 == second_count);
+    TEST_EXPECT(0U == mux.in_flight);
+    dispose((disposable_t*)&response);
+
+    /* clean up. */
+    dispose((disposable_t*)&mux);
+    dispose((disposable_t*)&alloc_opts);
+}
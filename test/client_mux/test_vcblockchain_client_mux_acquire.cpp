@@ -0,0 +1,103 @@
+/**
+ * \file test/client_mux/test_vcblockchain_client_mux_acquire.cpp
+ *
+ * Unit tests for acquiring an offset from a client multiplexer.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <vcblockchain/client_mux.h>
+#include <vcblockchain/error_codes.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_client_mux_acquire);
+
+/**
+ * \brief A completion function that ignores its response.
+ */
+static bool ignore_completion(
+    void*, uint32_t, uint32_t, uint32_t, const void*, size_t)
+{
+    return false;
+}
+
+/**
+ * This method should perform null checks on its pointer parameters.
+ */
+TEST(parameters)
+{
+    allocator_options_t alloc_opts;
+    vcblockchain_client_mux mux;
+    uint32_t offset;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* initialize the multiplexer. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_mux_init(&mux, &alloc_opts, 4U));
+
+    /* null pointers are rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_client_mux_acquire(
+                    nullptr, &ignore_completion, nullptr, &offset));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_client_mux_acquire(
+                    &mux, nullptr, nullptr, &offset));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_client_mux_acquire(
+                    &mux, &ignore_completion, nullptr, nullptr));
+
+    /* clean up. */
+    dispose((disposable_t*)&mux);
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * Each request in flight gets a distinct offset until the pipeline is full.
+ */
+TEST(pipeline_full)
+{
+    allocator_options_t alloc_opts;
+    vcblockchain_client_mux mux;
+    uint32_t offsets[3];
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* initialize the multiplexer with a depth of two. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_mux_init(&mux, &alloc_opts, 2U));
+
+    /* acquire two offsets. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_mux_acquire(
+                    &mux, &ignore_completion, nullptr, &offsets[0]));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_mux_acquire(
+                    &mux, &ignore_completion, nullptr, &offsets[1]));
+
+    /* the offsets are distinct, and both are in flight. */
+    TEST_EXPECT(offsets[0] != offsets[1]);
+    TEST_EXPECT(2U == mux.in_flight);
+
+    /* the pipeline is now full. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_PIPELINE_FULL
+            == vcblockchain_client_mux_acquire(
+                    &mux, &ignore_completion, nullptr, &offsets[2]));
+
+    /* clean up. */
+    dispose((disposable_t*)&mux);
+    dispose((disposable_t*)&alloc_opts);
+}
@@ -0,0 +1,378 @@
+/**
+ * \file test/client_mux/test_vcblockchain_client_mux_dispatch.cpp
+ *
+ * Unit tests for routing responses through a client multiplexer.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cstring>
+#include <minunit/minunit.h>
+#include <queue>
+#include <vcblockchain/client_mux.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vcblockchain/psock.h>
+#include <vector>
+#include <vpr/allocator/malloc_allocator.h>
+
+#include "../dummy_psock.h"
+
+using namespace std;
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_psock;
+RCPR_IMPORT_resource;
+
+TEST_SUITE(test_vcblockchain_client_mux_dispatch);
+
+/**
+ * \brief A response seen by a completion function.
+ */
+struct completion_record
+{
+    int waiter;
+    uint32_t request_id;
+    uint32_t offset;
+    uint32_t status;
+};
+
+/**
+ * \brief The context for a test waiter.
+ */
+struct test_waiter
+{
+    int id;
+    bool keep_waiting;
+    vector<completion_record>* log;
+};
+
+/**
+ * \brief Record a response in the log of its waiter.
+ */
+static bool record_completion(
+    void* context, uint32_t request_id, uint32_t offset, uint32_t status,
+    const void*, size_t)
+{
+    test_waiter* waiter = (test_waiter*)context;
+
+    waiter->log->push_back({ waiter->id, request_id, offset, status });
+
+    return waiter->keep_waiting;
+}
+
+/**
+ * Responses that arrive out of order are routed to the right waiters.
+ */
+TEST(out_of_order)
+{
+    const uint8_t SHARED_SECRET[32] = {
+        0x5a, 0x0c, 0x61, 0x93, 0x2e, 0x84, 0x4f, 0x17,
+        0xa6, 0x3d, 0xc2, 0x70, 0x19, 0xbe, 0x45, 0xe8,
+        0x07, 0xd1, 0x6f, 0x2a, 0x93, 0x58, 0x4c, 0xb4,
+        0xe1, 0x3f, 0x86, 0x0d, 0x72, 0xa9, 0x14, 0xcb };
+    vcblockchain_client_mux mux;
+    vector<completion_record> log;
+    test_waiter waiters[3] = {
+        { 0, false, &log }, { 1, false, &log }, { 2, false, &log } };
+    uint32_t offsets[3];
+    vccrypt_buffer_t response;
+
+    psock* sock;
+    rcpr_allocator* alloc;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t suite;
+    vccrypt_buffer_t shared_secret;
+    uint64_t server_iv = 0U;
+    queue<uint8_t> stream_bytes;
+
+    /* register the suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create an RCPR allocator instance. */
+    TEST_ASSERT(STATUS_SUCCESS == rcpr_malloc_allocator_create(&alloc));
+
+    /* create the crypto suite. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_options_init(
+                    &suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1));
+
+    /* create a buffer for holding the shared secret. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_buffer_init_for_cipher_key_agreement_shared_secret(
+                    &suite, &shared_secret));
+    TEST_ASSERT(sizeof(SHARED_SECRET) == shared_secret.size);
+    memcpy(shared_secret.data, SHARED_SECRET, shared_secret.size);
+
+    /* initialize the multiplexer. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_mux_init(&mux, &alloc_opts, 4U));
+
+    /* acquire an offset for each waiter. */
+    for (int i = 0; i < 3; ++i)
+    {
+        TEST_ASSERT(
+            VCBLOCKCHAIN_STATUS_SUCCESS
+                == vcblockchain_client_mux_acquire(
+                        &mux, &record_completion, &waiters[i], &offsets[i]));
+    }
+
+    /* create the dummy socket for writing the responses. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == dummy_psock_create(
+                    &sock, alloc,
+                    [&](psock*, void*, size_t*) -> int {
+                        return VCBLOCKCHAIN_ERROR_SSOCK_READ;
+                    },
+                    [&](psock*, const void* vbuf, size_t* s) -> int {
+                        const uint8_t* buf = (const uint8_t*)vbuf;
+
+                        for (size_t i = 0; i < *s; ++i)
+                        {
+                            stream_bytes.push(buf[i]);
+                        }
+
+                        return VCBLOCKCHAIN_STATUS_SUCCESS;
+                    }));
+
+    /* the server answers the requests in reverse order. */
+    for (int i = 2; i >= 0; --i)
+    {
+        TEST_ASSERT(
+            VCBLOCKCHAIN_STATUS_SUCCESS
+                == vcblockchain_protocol_encode_error_resp(
+                        &response, &alloc_opts,
+                        PROTOCOL_REQ_ID_LATEST_BLOCK_ID_GET, offsets[i],
+                        100U + i));
+        TEST_ASSERT(
+            VCBLOCKCHAIN_STATUS_SUCCESS
+                == psock_write_authed_data(
+                        sock, 2U - i, response.data, response.size, &suite,
+                        &shared_secret));
+        dispose((disposable_t*)&response);
+    }
+
+    /* reset the dummy socket. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(psock_resource_handle(sock)));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == dummy_psock_create(
+                    &sock, alloc,
+                    [&](psock*, void* vbuf, size_t* s) -> int {
+                        uint8_t* buf = (uint8_t*)vbuf;
+
+                        if (stream_bytes.size() < *s)
+                            return VCBLOCKCHAIN_ERROR_SSOCK_READ;
+
+                        for (size_t i = 0; i < *s; ++i)
+                        {
+                            buf[i] = stream_bytes.front();
+                            stream_bytes.pop();
+                        }
+
+                        return VCBLOCKCHAIN_STATUS_SUCCESS;
+                    },
+                    [&](psock*, const void*, size_t*) -> int {
+                        return VCBLOCKCHAIN_ERROR_SSOCK_WRITE;
+                    }));
+
+    /* dispatch all three responses. */
+    for (int i = 0; i < 3; ++i)
+    {
+        TEST_ASSERT(
+            VCBLOCKCHAIN_STATUS_SUCCESS
+                == vcblockchain_client_mux_dispatch(
+                        &mux, sock, alloc, &suite, &server_iv,
+                        &shared_secret));
+    }
+
+    /* each response reached its own waiter, in arrival order. */
+    TEST_ASSERT(3U == log.size());
+    for (int i = 0; i < 3; ++i)
+    {
+        TEST_EXPECT(2 - i == log[i].waiter);
+        TEST_EXPECT(PROTOCOL_REQ_ID_LATEST_BLOCK_ID_GET == log[i].request_id);
+        TEST_EXPECT(offsets[2 - i] == log[i].offset);
+        TEST_EXPECT(100U + (2 - i) == log[i].status);
+    }
+
+    /* every offset has been freed. */
+    TEST_EXPECT(0U == mux.in_flight);
+    TEST_EXPECT(3U == server_iv);
+
+    /* cleanup. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(psock_resource_handle(sock)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(rcpr_allocator_resource_handle(alloc)));
+    dispose((disposable_t*)&mux);
+    dispose((disposable_t*)&shared_secret);
+    dispose((disposable_t*)&suite);
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * A waiter that keeps waiting receives every response for its offset, and a
+ * response for an unknown offset is rejected.
+ */
+TEST(keep_waiting)
+{
+    const uint8_t SHARED_SECRET[32] = {
+        0x5a, 0x0c, 0x61, 0x93, 0x2e, 0x84, 0x4f, 0x17,
+        0xa6, 0x3d, 0xc2, 0x70, 0x19, 0xbe, 0x45, 0xe8,
+        0x07, 0xd1, 0x6f, 0x2a, 0x93, 0x58, 0x4c, 0xb4,
+        0xe1, 0x3f, 0x86, 0x0d, 0x72, 0xa9, 0x14, 0xcb };
+    vcblockchain_client_mux mux;
+    vector<completion_record> log;
+    test_waiter waiter = { 0, true, &log };
+    uint32_t offset;
+    vccrypt_buffer_t response;
+
+    psock* sock;
+    rcpr_allocator* alloc;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t suite;
+    vccrypt_buffer_t shared_secret;
+    uint64_t server_iv = 0U;
+    queue<uint8_t> stream_bytes;
+
+    /* register the suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create an RCPR allocator instance. */
+    TEST_ASSERT(STATUS_SUCCESS == rcpr_malloc_allocator_create(&alloc));
+
+    /* create the crypto suite. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_options_init(
+                    &suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1));
+
+    /* create a buffer for holding the shared secret. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_buffer_init_for_cipher_key_agreement_shared_secret(
+                    &suite, &shared_secret));
+    TEST_ASSERT(sizeof(SHARED_SECRET) == shared_secret.size);
+    memcpy(shared_secret.data, SHARED_SECRET, shared_secret.size);
+
+    /* initialize the multiplexer and acquire an offset. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_mux_init(&mux, &alloc_opts, 4U));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_mux_acquire(
+                    &mux, &record_completion, &waiter, &offset));
+
+    /* create the dummy socket for writing the responses. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == dummy_psock_create(
+                    &sock, alloc,
+                    [&](psock*, void*, size_t*) -> int {
+                        return VCBLOCKCHAIN_ERROR_SSOCK_READ;
+                    },
+                    [&](psock*, const void* vbuf, size_t* s) -> int {
+                        const uint8_t* buf = (const uint8_t*)vbuf;
+
+                        for (size_t i = 0; i < *s; ++i)
+                        {
+                            stream_bytes.push(buf[i]);
+                        }
+
+                        return VCBLOCKCHAIN_STATUS_SUCCESS;
+                    }));
+
+    /* two responses for the offset, then one for an unknown offset. */
+    const uint32_t response_offsets[3] = { offset, offset, offset + 1U };
+    for (uint64_t i = 0; i < 3; ++i)
+    {
+        TEST_ASSERT(
+            VCBLOCKCHAIN_STATUS_SUCCESS
+                == vcblockchain_protocol_encode_error_resp(
+                        &response, &alloc_opts,
+                        PROTOCOL_REQ_ID_BLOCK_NOTIFICATION,
+                        response_offsets[i], VCBLOCKCHAIN_STATUS_SUCCESS));
+        TEST_ASSERT(
+            VCBLOCKCHAIN_STATUS_SUCCESS
+                == psock_write_authed_data(
+                        sock, i, response.data, response.size, &suite,
+                        &shared_secret));
+        dispose((disposable_t*)&response);
+    }
+
+    /* reset the dummy socket. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(psock_resource_handle(sock)));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == dummy_psock_create(
+                    &sock, alloc,
+                    [&](psock*, void* vbuf, size_t* s) -> int {
+                        uint8_t* buf = (uint8_t*)vbuf;
+
+                        if (stream_bytes.size() < *s)
+                            return VCBLOCKCHAIN_ERROR_SSOCK_READ;
+
+                        for (size_t i = 0; i < *s; ++i)
+                        {
+                            buf[i] = stream_bytes.front();
+                            stream_bytes.pop();
+                        }
+
+                        return VCBLOCKCHAIN_STATUS_SUCCESS;
+                    },
+                    [&](psock*, const void*, size_t*) -> int {
+                        return VCBLOCKCHAIN_ERROR_SSOCK_WRITE;
+                    }));
+
+    /* both responses for the offset reach the waiter. */
+    for (int i = 0; i < 2; ++i)
+    {
+        TEST_ASSERT(
+            VCBLOCKCHAIN_STATUS_SUCCESS
+                == vcblockchain_client_mux_dispatch(
+                        &mux, sock, alloc, &suite, &server_iv,
+                        &shared_secret));
+    }
+    TEST_EXPECT(2U == log.size());
+    TEST_EXPECT(1U == mux.in_flight);
+
+    /* the response for the unknown offset is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE
+            == vcblockchain_client_mux_dispatch(
+                    &mux, sock, alloc, &suite, &server_iv, &shared_secret));
+    TEST_EXPECT(2U == log.size());
+
+    /* the waiter stops waiting by releasing its offset. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_mux_release(&mux, offset));
+    TEST_EXPECT(0U == mux.in_flight);
+
+    /* cleanup. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(psock_resource_handle(sock)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(rcpr_allocator_resource_handle(alloc)));
+    dispose((disposable_t*)&mux);
+    dispose((disposable_t*)&shared_secret);
+    dispose((disposable_t*)&suite);
+    dispose((disposable_t*)&alloc_opts);
+}
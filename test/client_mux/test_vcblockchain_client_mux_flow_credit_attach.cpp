@@ -0,0 +1,190 @@
+/**
+ * \file test/client_mux/test_vcblockchain_client_mux_flow_credit_attach.cpp
+ *
+ * Unit tests for attaching flow credits to a client multiplexer.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <vcblockchain/client_mux.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vector>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_client_mux_flow_credit_attach);
+
+/**
+ * \brief Record the offset of each response seen by a waiter.
+ */
+static bool record_completion(
+    void* context, uint32_t, uint32_t offset, uint32_t, const void*, size_t)
+{
+    vector<uint32_t>* log = (vector<uint32_t>*)context;
+
+    log->push_back(offset);
+
+    return false;
+}
+
+/**
+ * This method should perform null checks on its pointer parameters.
+ */
+TEST(parameters)
+{
+    vcblockchain_flow_credit credit;
+
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_flow_credit_init(&credit, 1U, 0U));
+
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_client_mux_flow_credit_attach(nullptr, &credit));
+}
+
+/**
+ * Once credits are attached, a grant from the agent returns credits, and never
+ * reaches the waiter whose offset it carries.
+ */
+TEST(grant_routing)
+{
+    allocator_options_t alloc_opts;
+    vcblockchain_client_mux mux;
+    vcblockchain_flow_credit credit;
+    vector<uint32_t> log;
+    vccrypt_buffer_t grant;
+    uint32_t offset;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* a window of two requests and 100 bytes, with both requests used. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_flow_credit_init(&credit, 2U, 100U));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_flow_credit_consume(&credit, 1U, 40U));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_flow_credit_consume(&credit, 1U, 40U));
+
+    /* initialize the multiplexer, attach the credits, and wait on an
+     * offset. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_mux_init(&mux, &alloc_opts, 4U));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_mux_flow_credit_attach(&mux, &credit));
+    TEST_EXPECT(&credit == mux.flow_credit);
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_mux_acquire(
+                    &mux, &record_completion, &log, &offset));
+
+    /* the agent grants one request and 40 bytes, at the waiter's offset. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_resp_flow_credit_grant(
+                    &grant, &alloc_opts, offset, VCBLOCKCHAIN_STATUS_SUCCESS,
+                    1U, 40U));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_mux_complete(&mux, grant.data, grant.size));
+    dispose((disposable_t*)&grant);
+
+    /* the credits were returned, and the waiter is still waiting. */
+    TEST_EXPECT(1U == credit.request_credits);
+    TEST_EXPECT(60U == credit.byte_credits);
+    TEST_EXPECT(0U == log.size());
+    TEST_EXPECT(1U == mux.in_flight);
+
+    /* a grant of more than was consumed is rejected, and changes nothing. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_resp_flow_credit_grant(
+                    &grant, &alloc_opts, 0U, VCBLOCKCHAIN_STATUS_SUCCESS, 2U,
+                    0U));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE
+            == vcblockchain_client_mux_complete(&mux, grant.data, grant.size));
+    dispose((disposable_t*)&grant);
+    TEST_EXPECT(1U == credit.request_credits);
+    TEST_EXPECT(60U == credit.byte_credits);
+    TEST_EXPECT(0U == log.size());
+
+    /* cleanup. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_mux_release(&mux, offset));
+    dispose((disposable_t*)&mux);
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * Once the credits are detached, a grant is routed by its offset like any
+ * other response.
+ */
+TEST(detach)
+{
+    allocator_options_t alloc_opts;
+    vcblockchain_client_mux mux;
+    vcblockchain_flow_credit credit;
+    vector<uint32_t> log;
+    vccrypt_buffer_t grant;
+    uint32_t offset;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* a window of one request, which has been used. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_flow_credit_init(&credit, 1U, 0U));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_flow_credit_consume(&credit, 1U, 0U));
+
+    /* attach the credits, then detach them. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_mux_init(&mux, &alloc_opts, 4U));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_mux_flow_credit_attach(&mux, &credit));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_mux_flow_credit_attach(&mux, nullptr));
+    TEST_EXPECT(nullptr == mux.flow_credit);
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_mux_acquire(
+                    &mux, &record_completion, &log, &offset));
+
+    /* a grant at the waiter's offset now completes the waiter. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_resp_flow_credit_grant(
+                    &grant, &alloc_opts, offset, VCBLOCKCHAIN_STATUS_SUCCESS,
+                    1U, 0U));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_mux_complete(&mux, grant.data, grant.size));
+    dispose((disposable_t*)&grant);
+
+    /* the waiter saw it, and the credits were left alone. */
+    TEST_ASSERT(1U == log.size());
+    TEST_EXPECT(offset == log[0]);
+    TEST_EXPECT(0U == mux.in_flight);
+    TEST_EXPECT(0U == credit.request_credits);
+
+    /* cleanup. */
+    dispose((disposable_t*)&mux);
+    dispose((disposable_t*)&alloc_opts);
+}
@@ -0,0 +1,424 @@
+/**
+ * \file test/client_mux/test_vcblockchain_client_mux_flow_credit_consume.cpp
+ *
+ * Unit tests for consuming flow credits through a client multiplexer.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cstring>
+#include <minunit/minunit.h>
+#include <queue>
+#include <vcblockchain/client_mux.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vcblockchain/psock.h>
+#include <vector>
+#include <vpr/allocator/malloc_allocator.h>
+
+#include "../dummy_psock.h"
+
+using namespace std;
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_psock;
+RCPR_IMPORT_resource;
+
+TEST_SUITE(test_vcblockchain_client_mux_flow_credit_consume);
+
+/**
+ * \brief Record the offset of each response seen by a waiter.
+ */
+static bool record_completion(
+    void* context, uint32_t, uint32_t offset, uint32_t, const void*, size_t)
+{
+    vector<uint32_t>* log = (vector<uint32_t>*)context;
+
+    log->push_back(offset);
+
+    return false;
+}
+
+/**
+ * \brief Seal a response, and queue it to be read by the client.
+ */
+static int queue_response(
+    queue<uint8_t>* stream_bytes, vccrypt_suite_options_t* suite,
+    const vccrypt_buffer_t* shared_secret, uint64_t iv,
+    const vccrypt_buffer_t* response)
+{
+    int retval;
+    vccrypt_buffer_t packet;
+    vcblockchain_psock_iovec vec = { response->data, response->size };
+
+    retval = psock_seal_authed_datav(&packet, iv, &vec, 1, suite, shared_secret);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    const uint8_t* data = (const uint8_t*)packet.data;
+    for (size_t i = 0; i < packet.size; ++i)
+    {
+        stream_bytes->push(data[i]);
+    }
+
+    dispose((disposable_t*)&packet);
+
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
+
+/**
+ * Without flow credits, every request may be sent without reading a response.
+ */
+TEST(no_flow_control)
+{
+    const uint8_t SHARED_SECRET[32] = {
+        0x5a, 0x0c, 0x61, 0x93, 0x2e, 0x84, 0x4f, 0x17,
+        0xa6, 0x3d, 0xc2, 0x70, 0x19, 0xbe, 0x45, 0xe8,
+        0x07, 0xd1, 0x6f, 0x2a, 0x93, 0x58, 0x4c, 0xb4,
+        0xe1, 0x3f, 0x86, 0x0d, 0x72, 0xa9, 0x14, 0xcb };
+    vcblockchain_client_mux mux;
+    psock* sock;
+    rcpr_allocator* alloc;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t suite;
+    vccrypt_buffer_t shared_secret;
+    uint64_t server_iv = 0U;
+    int read_count = 0;
+
+    /* register the suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create an RCPR allocator instance. */
+    TEST_ASSERT(STATUS_SUCCESS == rcpr_malloc_allocator_create(&alloc));
+
+    /* create the crypto suite. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_options_init(
+                    &suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1));
+
+    /* create a buffer for holding the shared secret. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_buffer_init_for_cipher_key_agreement_shared_secret(
+                    &suite, &shared_secret));
+    TEST_ASSERT(sizeof(SHARED_SECRET) == shared_secret.size);
+    memcpy(shared_secret.data, SHARED_SECRET, shared_secret.size);
+
+    /* create a dummy socket that counts reads. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == dummy_psock_create(
+                    &sock, alloc,
+                    [&](psock*, void*, size_t*) -> int {
+                        ++read_count;
+
+                        return VCBLOCKCHAIN_ERROR_SSOCK_READ;
+                    },
+                    [&](psock*, const void*, size_t*) -> int {
+                        return VCBLOCKCHAIN_ERROR_SSOCK_WRITE;
+                    }));
+
+    /* initialize the multiplexer. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_mux_init(&mux, &alloc_opts, 4U));
+
+    /* this method performs null checks on its pointer parameters. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_client_mux_flow_credit_consume(
+                    nullptr, sock, alloc, &suite, &server_iv, &shared_secret,
+                    100U));
+
+    /* any number of requests may be sent. */
+    for (int i = 0; i < 10; ++i)
+    {
+        TEST_EXPECT(
+            VCBLOCKCHAIN_STATUS_SUCCESS
+                == vcblockchain_client_mux_flow_credit_consume(
+                        &mux, sock, alloc, &suite, &server_iv, &shared_secret,
+                        100U));
+    }
+
+    /* nothing was read. */
+    TEST_EXPECT(0 == read_count);
+    TEST_EXPECT(0U == server_iv);
+
+    /* cleanup. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(psock_resource_handle(sock)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(rcpr_allocator_resource_handle(alloc)));
+    dispose((disposable_t*)&mux);
+    dispose((disposable_t*)&shared_secret);
+    dispose((disposable_t*)&suite);
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * Once the credits run out, responses are dispatched until a grant arrives.
+ */
+TEST(dispatch_until_grant)
+{
+    const uint8_t SHARED_SECRET[32] = {
+        0x5a, 0x0c, 0x61, 0x93, 0x2e, 0x84, 0x4f, 0x17,
+        0xa6, 0x3d, 0xc2, 0x70, 0x19, 0xbe, 0x45, 0xe8,
+        0x07, 0xd1, 0x6f, 0x2a, 0x93, 0x58, 0x4c, 0xb4,
+        0xe1, 0x3f, 0x86, 0x0d, 0x72, 0xa9, 0x14, 0xcb };
+    vcblockchain_client_mux mux;
+    vcblockchain_flow_credit credit;
+    vector<uint32_t> log;
+    uint32_t offset;
+    vccrypt_buffer_t response;
+    psock* sock;
+    rcpr_allocator* alloc;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t suite;
+    vccrypt_buffer_t shared_secret;
+    uint64_t server_iv = 0U;
+    queue<uint8_t> stream_bytes;
+
+    /* register the suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create an RCPR allocator instance. */
+    TEST_ASSERT(STATUS_SUCCESS == rcpr_malloc_allocator_create(&alloc));
+
+    /* create the crypto suite. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_options_init(
+                    &suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1));
+
+    /* create a buffer for holding the shared secret. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_buffer_init_for_cipher_key_agreement_shared_secret(
+                    &suite, &shared_secret));
+    TEST_ASSERT(sizeof(SHARED_SECRET) == shared_secret.size);
+    memcpy(shared_secret.data, SHARED_SECRET, shared_secret.size);
+
+    /* create a dummy socket that reads the queued responses. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == dummy_psock_create(
+                    &sock, alloc,
+                    [&](psock*, void* vbuf, size_t* s) -> int {
+                        uint8_t* buf = (uint8_t*)vbuf;
+
+                        if (stream_bytes.size() < *s)
+                            return VCBLOCKCHAIN_ERROR_SSOCK_READ;
+
+                        for (size_t i = 0; i < *s; ++i)
+                        {
+                            buf[i] = stream_bytes.front();
+                            stream_bytes.pop();
+                        }
+
+                        return VCBLOCKCHAIN_STATUS_SUCCESS;
+                    },
+                    [&](psock*, const void*, size_t*) -> int {
+                        return VCBLOCKCHAIN_ERROR_SSOCK_WRITE;
+                    }));
+
+    /* a window of one request and 100 bytes. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_flow_credit_init(&credit, 1U, 100U));
+
+    /* initialize the multiplexer, and attach the credits. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_mux_init(&mux, &alloc_opts, 4U));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_mux_flow_credit_attach(&mux, &credit));
+
+    /* the first request fits in the window without reading anything. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_mux_flow_credit_consume(
+                    &mux, sock, alloc, &suite, &server_iv, &shared_secret,
+                    40U));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_mux_acquire(
+                    &mux, &record_completion, &log, &offset));
+    TEST_EXPECT(0U == server_iv);
+
+    /* the agent answers the first request, and then grants its credits. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_error_resp(
+                    &response, &alloc_opts,
+                    PROTOCOL_REQ_ID_LATEST_BLOCK_ID_GET, offset,
+                    VCBLOCKCHAIN_STATUS_SUCCESS));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == queue_response(
+                    &stream_bytes, &suite, &shared_secret, 0U, &response));
+    dispose((disposable_t*)&response);
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_resp_flow_credit_grant(
+                    &response, &alloc_opts, 0U, VCBLOCKCHAIN_STATUS_SUCCESS,
+                    1U, 40U));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == queue_response(
+                    &stream_bytes, &suite, &shared_secret, 1U, &response));
+    dispose((disposable_t*)&response);
+
+    /* the second request waits for both responses. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_mux_flow_credit_consume(
+                    &mux, sock, alloc, &suite, &server_iv, &shared_secret,
+                    40U));
+    TEST_EXPECT(2U == server_iv);
+    TEST_EXPECT(stream_bytes.empty());
+
+    /* the answer reached its waiter, and the grant was consumed again. */
+    TEST_ASSERT(1U == log.size());
+    TEST_EXPECT(offset == log[0]);
+    TEST_EXPECT(0U == mux.in_flight);
+    TEST_EXPECT(0U == credit.request_credits);
+    TEST_EXPECT(60U == credit.byte_credits);
+
+    /* cleanup. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(psock_resource_handle(sock)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(rcpr_allocator_resource_handle(alloc)));
+    dispose((disposable_t*)&mux);
+    dispose((disposable_t*)&shared_secret);
+    dispose((disposable_t*)&suite);
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * A grant of more credits than were consumed stops the wait with an error.
+ */
+TEST(over_grant)
+{
+    const uint8_t SHARED_SECRET[32] = {
+        0x5a, 0x0c, 0x61, 0x93, 0x2e, 0x84, 0x4f, 0x17,
+        0xa6, 0x3d, 0xc2, 0x70, 0x19, 0xbe, 0x45, 0xe8,
+        0x07, 0xd1, 0x6f, 0x2a, 0x93, 0x58, 0x4c, 0xb4,
+        0xe1, 0x3f, 0x86, 0x0d, 0x72, 0xa9, 0x14, 0xcb };
+    vcblockchain_client_mux mux;
+    vcblockchain_flow_credit credit;
+    vccrypt_buffer_t response;
+    psock* sock;
+    rcpr_allocator* alloc;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t suite;
+    vccrypt_buffer_t shared_secret;
+    uint64_t server_iv = 0U;
+    queue<uint8_t> stream_bytes;
+
+    /* register the suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create an RCPR allocator instance. */
+    TEST_ASSERT(STATUS_SUCCESS == rcpr_malloc_allocator_create(&alloc));
+
+    /* create the crypto suite. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_options_init(
+                    &suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1));
+
+    /* create a buffer for holding the shared secret. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_buffer_init_for_cipher_key_agreement_shared_secret(
+                    &suite, &shared_secret));
+    TEST_ASSERT(sizeof(SHARED_SECRET) == shared_secret.size);
+    memcpy(shared_secret.data, SHARED_SECRET, shared_secret.size);
+
+    /* create a dummy socket that reads the queued responses. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == dummy_psock_create(
+                    &sock, alloc,
+                    [&](psock*, void* vbuf, size_t* s) -> int {
+                        uint8_t* buf = (uint8_t*)vbuf;
+
+                        if (stream_bytes.size() < *s)
+                            return VCBLOCKCHAIN_ERROR_SSOCK_READ;
+
+                        for (size_t i = 0; i < *s; ++i)
+                        {
+                            buf[i] = stream_bytes.front();
+                            stream_bytes.pop();
+                        }
+
+                        return VCBLOCKCHAIN_STATUS_SUCCESS;
+                    },
+                    [&](psock*, const void*, size_t*) -> int {
+                        return VCBLOCKCHAIN_ERROR_SSOCK_WRITE;
+                    }));
+
+    /* a window of one request, which has been used. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_flow_credit_init(&credit, 1U, 0U));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_flow_credit_consume(&credit, 1U, 0U));
+
+    /* initialize the multiplexer, and attach the credits. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_mux_init(&mux, &alloc_opts, 4U));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_mux_flow_credit_attach(&mux, &credit));
+
+    /* the agent grants two requests. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_resp_flow_credit_grant(
+                    &response, &alloc_opts, 0U, VCBLOCKCHAIN_STATUS_SUCCESS,
+                    2U, 0U));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == queue_response(
+                    &stream_bytes, &suite, &shared_secret, 0U, &response));
+    dispose((disposable_t*)&response);
+
+    /* the over-grant is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE
+            == vcblockchain_client_mux_flow_credit_consume(
+                    &mux, sock, alloc, &suite, &server_iv, &shared_secret,
+                    10U));
+    TEST_EXPECT(0U == credit.request_credits);
+
+    /* cleanup. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(psock_resource_handle(sock)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(rcpr_allocator_resource_handle(alloc)));
+    dispose((disposable_t*)&mux);
+    dispose((disposable_t*)&shared_secret);
+    dispose((disposable_t*)&suite);
+    dispose((disposable_t*)&alloc_opts);
+}
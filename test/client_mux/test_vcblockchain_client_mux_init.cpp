@@ -0,0 +1,65 @@
+/**
+ * \file test/client_mux/test_vcblockchain_client_mux_init.cpp
+ *
+ * Unit tests for initializing a client multiplexer.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <vcblockchain/client_mux.h>
+#include <vcblockchain/error_codes.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_client_mux_init);
+
+/**
+ * This method should perform null checks on its pointer parameters.
+ */
+TEST(parameters)
+{
+    allocator_options_t alloc_opts;
+    vcblockchain_client_mux mux;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* null pointers are rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_client_mux_init(nullptr, &alloc_opts, 4U));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_client_mux_init(&mux, nullptr, 4U));
+
+    /* clean up. */
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * A depth of zero selects the default pipeline depth.
+ */
+TEST(default_depth)
+{
+    allocator_options_t alloc_opts;
+    vcblockchain_client_mux mux;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* initialize the multiplexer. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_mux_init(&mux, &alloc_opts, 0U));
+
+    /* the default depth is used, and nothing is in flight. */
+    TEST_EXPECT(VCBLOCKCHAIN_CLIENT_MUX_DEFAULT_DEPTH == mux.depth);
+    TEST_EXPECT(0U == mux.in_flight);
+    TEST_EXPECT(0U == mux.free_head);
+
+    /* clean up. */
+    dispose((disposable_t*)&mux);
+    dispose((disposable_t*)&alloc_opts);
+}
@@ -0,0 +1,95 @@
+/**
+ * \file test/client_mux/test_vcblockchain_client_mux_release.cpp
+ *
+ * Unit tests for releasing an offset acquired from a client multiplexer.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <vcblockchain/client_mux.h>
+#include <vcblockchain/error_codes.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_client_mux_release);
+
+/**
+ * \brief A completion function that ignores its response.
+ */
+static bool ignore_completion(
+    void*, uint32_t, uint32_t, uint32_t, const void*, size_t)
+{
+    return false;
+}
+
+/**
+ * Releasing an offset frees its slot, and the reused slot gets a new offset.
+ */
+TEST(happy_path)
+{
+    allocator_options_t alloc_opts;
+    vcblockchain_client_mux mux;
+    uint32_t first, second;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* initialize the multiplexer with a depth of one. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_mux_init(&mux, &alloc_opts, 1U));
+
+    /* acquire and release an offset. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_mux_acquire(
+                    &mux, &ignore_completion, nullptr, &first));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_mux_release(&mux, first));
+    TEST_EXPECT(0U == mux.in_flight);
+
+    /* the slot can be acquired again, under a different offset. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_mux_acquire(
+                    &mux, &ignore_completion, nullptr, &second));
+    TEST_EXPECT(first != second);
+
+    /* the stale offset can no longer be released. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_client_mux_release(&mux, first));
+
+    /* clean up. */
+    dispose((disposable_t*)&mux);
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * Releasing an offset that is not in flight fails.
+ */
+TEST(not_in_flight)
+{
+    allocator_options_t alloc_opts;
+    vcblockchain_client_mux mux;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* initialize the multiplexer. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_mux_init(&mux, &alloc_opts, 4U));
+
+    /* nothing has been acquired. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_client_mux_release(&mux, 5U));
+
+    /* clean up. */
+    dispose((disposable_t*)&mux);
+    dispose((disposable_t*)&alloc_opts);
+}
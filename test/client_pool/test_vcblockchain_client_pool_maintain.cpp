@@ -0,0 +1,592 @@
+/**
+ * \file test/client_pool/test_vcblockchain_client_pool_maintain.cpp
+ *
+ * Unit tests for maintaining a client pool.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <vcblockchain/client_pool.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vector>
+#include <vpr/allocator/malloc_allocator.h>
+
+#include "../dummy_agent.h"
+
+using namespace std;
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_psock;
+RCPR_IMPORT_resource;
+
+TEST_SUITE(test_vcblockchain_client_pool_maintain);
+
+/**
+ * \brief Refuse every connection, counting the attempts.
+ */
+static status refuse_connect(void* context, psock**)
+{
+    int* attempts = (int*)context;
+
+    ++*attempts;
+
+    return VCBLOCKCHAIN_ERROR_CONNECTION_REFUSED;
+}
+
+/**
+ * \brief Context for opening connections to a dummy agent.
+ */
+struct agent_connector
+{
+    dummy_agent* agent;
+    rcpr_allocator* alloc;
+};
+
+/**
+ * \brief Open a new connection to a dummy agent.
+ */
+static status agent_connect(void* context, psock** sock)
+{
+    agent_connector* connector = (agent_connector*)context;
+
+    return connector->agent->connect(sock, connector->alloc);
+}
+
+/**
+ * \brief Answer a status get request with the given status.
+ */
+static int answer_status_get(
+    dummy_agent_connection* conn, const vector<uint8_t>& request,
+    uint32_t status)
+{
+    int retval;
+    protocol_req_status_get req;
+    vccrypt_buffer_t response;
+
+    retval =
+        vcblockchain_protocol_decode_req_status_get(
+            &req, request.data(), request.size());
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        vcblockchain_protocol_encode_resp_status_get(
+            &response, conn->agent->suite->alloc_opts, req.offset, status);
+    dispose((disposable_t*)&req);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = conn->respond(response.data, response.size);
+    dispose((disposable_t*)&response);
+
+    return retval;
+}
+
+/**
+ * If the agent can't be reached, then every empty entry is retried, and the
+ * pool reports the failure instead of handing out a session.
+ */
+TEST(connect_failure)
+{
+    vcblockchain_client_pool* pool;
+    vcblockchain_client_session* session = nullptr;
+    rcpr_allocator* alloc;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t suite;
+    vccrypt_buffer_t client_privkey;
+    vccrypt_buffer_t server_pubkey;
+    int attempts = 0;
+    const vpr_uuid client_id = { .data = {
+        0x3c, 0x8b, 0x51, 0xe2, 0x7f, 0x04, 0x4a, 0x96,
+        0xb1, 0x2d, 0x68, 0xc5, 0x0e, 0x93, 0x47, 0xfa } };
+    const vpr_uuid server_id = { .data = {
+        0x91, 0x2e, 0xd4, 0x07, 0x6b, 0xa3, 0x4c, 0x58,
+        0x8f, 0x10, 0xe7, 0x3a, 0xc6, 0x59, 0x02, 0xbd } };
+
+    /* register the suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create an RCPR allocator instance. */
+    TEST_ASSERT(STATUS_SUCCESS == rcpr_malloc_allocator_create(&alloc));
+
+    /* create the crypto suite. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_options_init(
+                    &suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1));
+
+    /* create the client private key buffer. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_buffer_init_for_cipher_key_agreement_private_key(
+                    &suite, &client_privkey));
+
+    /* create the server public key buffer. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_buffer_init_for_cipher_key_agreement_public_key(
+                    &suite, &server_pubkey));
+
+    /* create the pool. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_pool_create(
+                    &pool, &alloc_opts, alloc, &suite, &refuse_connect,
+                    &attempts, &client_id, &client_privkey, &server_id,
+                    &server_pubkey, 3U));
+
+    /* maintaining the pool tries to open every session. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_CONNECTION_REFUSED
+            == vcblockchain_client_pool_maintain(pool));
+    TEST_EXPECT(3 == attempts);
+
+    /* with no idle session, acquiring one tries to connect on the spot. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_CONNECTION_REFUSED
+            == vcblockchain_client_pool_acquire(pool, &session));
+    TEST_EXPECT(4 == attempts);
+    TEST_EXPECT(nullptr == session);
+
+    /* the next maintenance retries every entry. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_CONNECTION_REFUSED
+            == vcblockchain_client_pool_maintain(pool));
+    TEST_EXPECT(7 == attempts);
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(
+                    vcblockchain_client_pool_resource_handle(pool)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(rcpr_allocator_resource_handle(alloc)));
+    dispose((disposable_t*)&server_pubkey);
+    dispose((disposable_t*)&client_privkey);
+    dispose((disposable_t*)&suite);
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * Idle sessions are handed out in last in, first out order.
+ */
+TEST(lifo)
+{
+    vcblockchain_client_pool* pool;
+    vcblockchain_client_session* first;
+    vcblockchain_client_session* second;
+    vcblockchain_client_session* session;
+    rcpr_allocator* alloc;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t suite;
+    const vpr_uuid client_id = { .data = {
+        0x3c, 0x8b, 0x51, 0xe2, 0x7f, 0x04, 0x4a, 0x96,
+        0xb1, 0x2d, 0x68, 0xc5, 0x0e, 0x93, 0x47, 0xfa } };
+    const vpr_uuid agent_id = { .data = {
+        0x91, 0x2e, 0xd4, 0x07, 0x6b, 0xa3, 0x4c, 0x58,
+        0x8f, 0x10, 0xe7, 0x3a, 0xc6, 0x59, 0x02, 0xbd } };
+
+    /* register the suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create an RCPR allocator instance. */
+    TEST_ASSERT(STATUS_SUCCESS == rcpr_malloc_allocator_create(&alloc));
+
+    /* create the crypto suite. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_options_init(
+                    &suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1));
+
+    /* create the agent. */
+    dummy_agent* agent = new dummy_agent(&suite, &agent_id);
+    TEST_ASSERT(VCBLOCKCHAIN_STATUS_SUCCESS == agent->status);
+    agent_connector connector = { agent, alloc };
+
+    /* create the pool, and open its sessions. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_pool_create(
+                    &pool, &alloc_opts, alloc, &suite, &agent_connect,
+                    &connector, &client_id, &agent->client_privkey,
+                    &agent_id, &agent->agent_pubkey, 3U));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS == vcblockchain_client_pool_maintain(pool));
+    TEST_EXPECT(3U == agent->connections.size());
+
+    /* acquire two sessions. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_pool_acquire(pool, &first));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_pool_acquire(pool, &second));
+    TEST_EXPECT(first != second);
+
+    /* return them, the second one last. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_pool_release(pool, first, true));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_pool_release(pool, second, true));
+
+    /* the most recently returned session is handed out first. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_pool_acquire(pool, &session));
+    TEST_EXPECT(second == session);
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_pool_acquire(pool, &session));
+    TEST_EXPECT(first == session);
+
+    /* no new connection was opened. */
+    TEST_EXPECT(3U == agent->connections.size());
+
+    /* clean up. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_pool_release(pool, first, true));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_pool_release(pool, second, true));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(
+                    vcblockchain_client_pool_resource_handle(pool)));
+    delete agent;
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(rcpr_allocator_resource_handle(alloc)));
+    dispose((disposable_t*)&suite);
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * A session returned as unhealthy is closed, and its entry is reconnected.
+ */
+TEST(release_unhealthy)
+{
+    vcblockchain_client_pool* pool;
+    vcblockchain_client_session* session;
+    rcpr_allocator* alloc;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t suite;
+    const vpr_uuid client_id = { .data = {
+        0x3c, 0x8b, 0x51, 0xe2, 0x7f, 0x04, 0x4a, 0x96,
+        0xb1, 0x2d, 0x68, 0xc5, 0x0e, 0x93, 0x47, 0xfa } };
+    const vpr_uuid agent_id = { .data = {
+        0x91, 0x2e, 0xd4, 0x07, 0x6b, 0xa3, 0x4c, 0x58,
+        0x8f, 0x10, 0xe7, 0x3a, 0xc6, 0x59, 0x02, 0xbd } };
+
+    /* register the suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create an RCPR allocator instance. */
+    TEST_ASSERT(STATUS_SUCCESS == rcpr_malloc_allocator_create(&alloc));
+
+    /* create the crypto suite. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_options_init(
+                    &suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1));
+
+    /* create an agent that answers status probes. */
+    dummy_agent* agent = new dummy_agent(&suite, &agent_id);
+    TEST_ASSERT(VCBLOCKCHAIN_STATUS_SUCCESS == agent->status);
+    agent->onrequest =
+        [](dummy_agent_connection* conn, const vector<uint8_t>& request) {
+            return
+                answer_status_get(conn, request, VCBLOCKCHAIN_STATUS_SUCCESS);
+        };
+    agent_connector connector = { agent, alloc };
+
+    /* create a pool of one session, and open it. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_pool_create(
+                    &pool, &alloc_opts, alloc, &suite, &agent_connect,
+                    &connector, &client_id, &agent->client_privkey,
+                    &agent_id, &agent->agent_pubkey, 1U));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS == vcblockchain_client_pool_maintain(pool));
+    TEST_EXPECT(1U == agent->connections.size());
+
+    /* acquire the session, and return it as unhealthy. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_pool_acquire(pool, &session));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_pool_release(pool, session, false));
+
+    /* the session was closed, so it is no longer leased from the pool. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_client_pool_release(pool, session, true));
+
+    /* maintenance opens a new connection in its place. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS == vcblockchain_client_pool_maintain(pool));
+    TEST_EXPECT(2U == agent->connections.size());
+
+    /* the closed session was never probed. */
+    TEST_EXPECT(agent->connections[0]->requests.empty());
+
+    /* the new session is idle, so acquiring it opens no connection. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_pool_acquire(pool, &session));
+    TEST_EXPECT(2U == agent->connections.size());
+
+    /* clean up. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_pool_release(pool, session, true));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(
+                    vcblockchain_client_pool_resource_handle(pool)));
+    delete agent;
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(rcpr_allocator_resource_handle(alloc)));
+    dispose((disposable_t*)&suite);
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * A session whose probe fails is closed and reconnected, and the new session
+ * goes to the bottom of the idle stack.
+ */
+TEST(probe_failure)
+{
+    vcblockchain_client_pool* pool;
+    vcblockchain_client_session* first;
+    vcblockchain_client_session* second;
+    vcblockchain_client_session* session;
+    rcpr_allocator* alloc;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t suite;
+    dummy_agent_connection* failing = nullptr;
+    const vpr_uuid client_id = { .data = {
+        0x3c, 0x8b, 0x51, 0xe2, 0x7f, 0x04, 0x4a, 0x96,
+        0xb1, 0x2d, 0x68, 0xc5, 0x0e, 0x93, 0x47, 0xfa } };
+    const vpr_uuid agent_id = { .data = {
+        0x91, 0x2e, 0xd4, 0x07, 0x6b, 0xa3, 0x4c, 0x58,
+        0x8f, 0x10, 0xe7, 0x3a, 0xc6, 0x59, 0x02, 0xbd } };
+
+    /* register the suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create an RCPR allocator instance. */
+    TEST_ASSERT(STATUS_SUCCESS == rcpr_malloc_allocator_create(&alloc));
+
+    /* create the crypto suite. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_options_init(
+                    &suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1));
+
+    /* create an agent that fails the status probe on one connection. */
+    dummy_agent* agent = new dummy_agent(&suite, &agent_id);
+    TEST_ASSERT(VCBLOCKCHAIN_STATUS_SUCCESS == agent->status);
+    agent->onrequest =
+        [&](dummy_agent_connection* conn, const vector<uint8_t>& request) {
+            return
+                answer_status_get(
+                    conn, request,
+                    conn == failing
+                        ? VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE
+                        : VCBLOCKCHAIN_STATUS_SUCCESS);
+        };
+    agent_connector connector = { agent, alloc };
+
+    /* create a pool of two sessions, and open them. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_pool_create(
+                    &pool, &alloc_opts, alloc, &suite, &agent_connect,
+                    &connector, &client_id, &agent->client_privkey,
+                    &agent_id, &agent->agent_pubkey, 2U));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS == vcblockchain_client_pool_maintain(pool));
+    TEST_ASSERT(2U == agent->connections.size());
+
+    /* the first session handed out uses the first connection. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_pool_acquire(pool, &first));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_pool_acquire(pool, &second));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_pool_release(pool, second, true));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_pool_release(pool, first, true));
+
+    /* the first connection fails its next probe. */
+    failing = agent->connections[0].get();
+
+    /* maintenance closes the failed session, and opens a new one. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS == vcblockchain_client_pool_maintain(pool));
+    TEST_ASSERT(3U == agent->connections.size());
+    TEST_EXPECT(1U == agent->connections[0]->requests.size());
+    TEST_EXPECT(1U == agent->connections[1]->requests.size());
+    TEST_EXPECT(agent->connections[2]->requests.empty());
+
+    /* the surviving session is still handed out first. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_pool_acquire(pool, &session));
+    TEST_EXPECT(second == session);
+
+    /* the new session comes from the bottom of the stack, without a new
+     * connection. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_pool_acquire(pool, &first));
+    TEST_EXPECT(second != first);
+    TEST_EXPECT(3U == agent->connections.size());
+
+    /* every session is in use. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_POOL_EXHAUSTED
+            == vcblockchain_client_pool_acquire(pool, &session));
+
+    /* clean up. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_pool_release(pool, first, true));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_pool_release(pool, second, true));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(
+                    vcblockchain_client_pool_resource_handle(pool)));
+    delete agent;
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(rcpr_allocator_resource_handle(alloc)));
+    dispose((disposable_t*)&suite);
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * An agent that presents a different identity or public key than the pool
+ * expects is rejected.
+ */
+TEST(wrong_identity)
+{
+    vcblockchain_client_pool* pool;
+    vcblockchain_client_session* session = nullptr;
+    rcpr_allocator* alloc;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t suite;
+    const vpr_uuid client_id = { .data = {
+        0x3c, 0x8b, 0x51, 0xe2, 0x7f, 0x04, 0x4a, 0x96,
+        0xb1, 0x2d, 0x68, 0xc5, 0x0e, 0x93, 0x47, 0xfa } };
+    const vpr_uuid agent_id = { .data = {
+        0x91, 0x2e, 0xd4, 0x07, 0x6b, 0xa3, 0x4c, 0x58,
+        0x8f, 0x10, 0xe7, 0x3a, 0xc6, 0x59, 0x02, 0xbd } };
+    const vpr_uuid other_id = { .data = {
+        0x27, 0xf5, 0x0a, 0x9c, 0x43, 0xd8, 0x41, 0x6e,
+        0xb2, 0x85, 0x1f, 0x6c, 0xe0, 0x3d, 0x94, 0x7a } };
+
+    /* register the suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create an RCPR allocator instance. */
+    TEST_ASSERT(STATUS_SUCCESS == rcpr_malloc_allocator_create(&alloc));
+
+    /* create the crypto suite. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_options_init(
+                    &suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1));
+
+    /* create the agent. */
+    dummy_agent* agent = new dummy_agent(&suite, &agent_id);
+    TEST_ASSERT(VCBLOCKCHAIN_STATUS_SUCCESS == agent->status);
+    agent_connector connector = { agent, alloc };
+
+    /* create a pool that expects a different agent id. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_pool_create(
+                    &pool, &alloc_opts, alloc, &suite, &agent_connect,
+                    &connector, &client_id, &agent->client_privkey,
+                    &other_id, &agent->agent_pubkey, 1U));
+
+    /* the agent completes the handshake, but is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE
+            == vcblockchain_client_pool_maintain(pool));
+    TEST_EXPECT(1U == agent->connections.size());
+    TEST_EXPECT(agent->connections[0]->handshake_complete);
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE
+            == vcblockchain_client_pool_acquire(pool, &session));
+    TEST_EXPECT(nullptr == session);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(
+                    vcblockchain_client_pool_resource_handle(pool)));
+
+    /* create a pool that expects a different public key. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_pool_create(
+                    &pool, &alloc_opts, alloc, &suite, &agent_connect,
+                    &connector, &client_id, &agent->client_privkey,
+                    &agent_id, &agent->client_pubkey, 1U));
+
+    /* the agent is rejected again. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE
+            == vcblockchain_client_pool_maintain(pool));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE
+            == vcblockchain_client_pool_acquire(pool, &session));
+    TEST_EXPECT(nullptr == session);
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(
+                    vcblockchain_client_pool_resource_handle(pool)));
+    delete agent;
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(rcpr_allocator_resource_handle(alloc)));
+    dispose((disposable_t*)&suite);
+    dispose((disposable_t*)&alloc_opts);
+}
@@ -0,0 +1,288 @@
+/**
+ * \file test/client_session/test_vcblockchain_client_session_create.cpp
+ *
+ * Unit tests for creating a client session.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/client_session.h>
+#include <vcblockchain/error_codes.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+#include "../../src/client_session/client_session_internal.h"
+#include "../dummy_agent.h"
+#include "../dummy_psock.h"
+
+using namespace std;
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_psock;
+RCPR_IMPORT_resource;
+
+TEST_SUITE(test_vcblockchain_client_session_create);
+
+/**
+ * This method should perform null checks on its pointer parameters.
+ */
+TEST(parameters)
+{
+    vcblockchain_client_session* session = nullptr;
+    psock* sock;
+    rcpr_allocator* alloc;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t suite;
+    vccrypt_buffer_t client_privkey;
+    vccrypt_buffer_t server_pubkey;
+    vpr_uuid server_id;
+    const vpr_uuid client_id = { .data = {
+        0x3c, 0x8b, 0x51, 0xe2, 0x7f, 0x04, 0x4a, 0x96,
+        0xb1, 0x2d, 0x68, 0xc5, 0x0e, 0x93, 0x47, 0xfa } };
+
+    /* register the suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create an RCPR allocator instance. */
+    TEST_ASSERT(STATUS_SUCCESS == rcpr_malloc_allocator_create(&alloc));
+
+    /* create the crypto suite. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_options_init(
+                    &suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1));
+
+    /* create the client private key buffer. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_buffer_init_for_cipher_key_agreement_private_key(
+                    &suite, &client_privkey));
+
+    /* create a dummy socket that is never used. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == dummy_psock_create(
+                    &sock, alloc,
+                    [&](psock*, void*, size_t*) -> int {
+                        return VCBLOCKCHAIN_ERROR_SSOCK_READ;
+                    },
+                    [&](psock*, const void*, size_t*) -> int {
+                        return VCBLOCKCHAIN_ERROR_SSOCK_WRITE;
+                    }));
+
+    /* this method performs null checks on pointer parameters. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_client_session_create(
+                    nullptr, sock, alloc, &suite, &client_id, &client_privkey,
+                    &server_id, &server_pubkey));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_client_session_create(
+                    &session, nullptr, alloc, &suite, &client_id,
+                    &client_privkey, &server_id, &server_pubkey));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_client_session_create(
+                    &session, sock, nullptr, &suite, &client_id,
+                    &client_privkey, &server_id, &server_pubkey));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_client_session_create(
+                    &session, sock, alloc, nullptr, &client_id,
+                    &client_privkey, &server_id, &server_pubkey));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_client_session_create(
+                    &session, sock, alloc, &suite, nullptr, &client_privkey,
+                    &server_id, &server_pubkey));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_client_session_create(
+                    &session, sock, alloc, &suite, &client_id, nullptr,
+                    &server_id, &server_pubkey));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_client_session_create(
+                    &session, sock, alloc, &suite, &client_id,
+                    &client_privkey, nullptr, &server_pubkey));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_client_session_create(
+                    &session, sock, alloc, &suite, &client_id,
+                    &client_privkey, &server_id, nullptr));
+
+    /* no session was created. */
+    TEST_EXPECT(nullptr == session);
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(psock_resource_handle(sock)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(rcpr_allocator_resource_handle(alloc)));
+    dispose((disposable_t*)&client_privkey);
+    dispose((disposable_t*)&suite);
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * If the handshake fails, then no session is created.
+ */
+TEST(handshake_failure)
+{
+    vcblockchain_client_session* session = nullptr;
+    psock* sock;
+    rcpr_allocator* alloc;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t suite;
+    vccrypt_buffer_t client_privkey;
+    vccrypt_buffer_t server_pubkey;
+    vpr_uuid server_id;
+    size_t write_count = 0U;
+    const vpr_uuid client_id = { .data = {
+        0x3c, 0x8b, 0x51, 0xe2, 0x7f, 0x04, 0x4a, 0x96,
+        0xb1, 0x2d, 0x68, 0xc5, 0x0e, 0x93, 0x47, 0xfa } };
+
+    /* register the suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create an RCPR allocator instance. */
+    TEST_ASSERT(STATUS_SUCCESS == rcpr_malloc_allocator_create(&alloc));
+
+    /* create the crypto suite. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_options_init(
+                    &suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1));
+
+    /* create the client private key buffer. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_buffer_init_for_cipher_key_agreement_private_key(
+                    &suite, &client_privkey));
+
+    /* create a dummy socket that accepts the request but never answers. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == dummy_psock_create(
+                    &sock, alloc,
+                    [&](psock*, void*, size_t*) -> int {
+                        return VCBLOCKCHAIN_ERROR_SSOCK_READ;
+                    },
+                    [&](psock*, const void*, size_t*) -> int {
+                        ++write_count;
+
+                        return VCBLOCKCHAIN_STATUS_SUCCESS;
+                    }));
+
+    /* the handshake fails when the response can't be read. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            != vcblockchain_client_session_create(
+                    &session, sock, alloc, &suite, &client_id,
+                    &client_privkey, &server_id, &server_pubkey));
+
+    /* the handshake request was sent, but no session was created. */
+    TEST_EXPECT(write_count > 0U);
+    TEST_EXPECT(nullptr == session);
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(psock_resource_handle(sock)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(rcpr_allocator_resource_handle(alloc)));
+    dispose((disposable_t*)&client_privkey);
+    dispose((disposable_t*)&suite);
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * After a successful handshake, the session holds the IVs that follow the
+ * handshake acknowledgement.
+ */
+TEST(success)
+{
+    vcblockchain_client_session* session = nullptr;
+    psock* sock;
+    rcpr_allocator* alloc;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t suite;
+    vccrypt_buffer_t server_pubkey;
+    vpr_uuid server_id;
+    const vpr_uuid client_id = { .data = {
+        0x3c, 0x8b, 0x51, 0xe2, 0x7f, 0x04, 0x4a, 0x96,
+        0xb1, 0x2d, 0x68, 0xc5, 0x0e, 0x93, 0x47, 0xfa } };
+    const vpr_uuid agent_id = { .data = {
+        0x9d, 0x02, 0x6b, 0x38, 0xc4, 0x71, 0x4e, 0x1f,
+        0x85, 0xa0, 0x3b, 0xd6, 0x27, 0xe9, 0x50, 0x8c } };
+
+    /* register the suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create an RCPR allocator instance. */
+    TEST_ASSERT(STATUS_SUCCESS == rcpr_malloc_allocator_create(&alloc));
+
+    /* create the crypto suite. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_options_init(
+                    &suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1));
+
+    /* create an agent and connect to it. */
+    dummy_agent* agent = new dummy_agent(&suite, &agent_id);
+    TEST_ASSERT(VCBLOCKCHAIN_STATUS_SUCCESS == agent->status);
+    TEST_ASSERT(VCBLOCKCHAIN_STATUS_SUCCESS == agent->connect(&sock, alloc));
+
+    /* create the session. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_session_create(
+                    &session, sock, alloc, &suite, &client_id,
+                    &agent->client_privkey, &server_id, &server_pubkey));
+    TEST_ASSERT(nullptr != session);
+
+    /* the server identity was received. */
+    TEST_EXPECT(0 == memcmp(&agent_id, &server_id, sizeof(server_id)));
+    TEST_ASSERT(agent->agent_pubkey.size == server_pubkey.size);
+    TEST_EXPECT(
+        0 == memcmp(
+                agent->agent_pubkey.data, server_pubkey.data,
+                server_pubkey.size));
+
+    /* the acknowledgement was sent at IV 1, and its response was read. */
+    TEST_EXPECT(agent->connections[0]->handshake_complete);
+    TEST_EXPECT(2U == agent->connections[0]->client_iv);
+    TEST_EXPECT(0U == agent->connections[0]->output.size());
+    TEST_EXPECT(2U == session->client_iv);
+    TEST_EXPECT(0x8000000000000002 == session->server_iv);
+    TEST_EXPECT(0U == session->next_offset);
+    TEST_EXPECT(!session->rekey_pending);
+    TEST_EXPECT(!session->failed);
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(
+                    vcblockchain_client_session_resource_handle(session)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(psock_resource_handle(sock)));
+    delete agent;
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(rcpr_allocator_resource_handle(alloc)));
+    dispose((disposable_t*)&server_pubkey);
+    dispose((disposable_t*)&suite);
+    dispose((disposable_t*)&alloc_opts);
+}
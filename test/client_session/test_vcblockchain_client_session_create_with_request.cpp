@@ -0,0 +1,270 @@
+/**
+ * \file
+ * test/client_session/test_vcblockchain_client_session_create_with_request.cpp
+ *
+ * Unit tests for creating a client session with a piggybacked first
+ * request.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/client_session.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vcblockchain/psock.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+#include "../../src/client_session/client_session_internal.h"
+#include "../dummy_agent.h"
+#include "../dummy_psock.h"
+
+using namespace std;
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_psock;
+RCPR_IMPORT_resource;
+
+TEST_SUITE(test_vcblockchain_client_session_create_with_request);
+
+/**
+ * This method should perform null checks on its pointer parameters.
+ */
+TEST(parameters)
+{
+    vcblockchain_client_session* session = nullptr;
+    psock* sock;
+    rcpr_allocator* alloc;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t suite;
+    vccrypt_buffer_t client_privkey;
+    vccrypt_buffer_t server_pubkey;
+    vpr_uuid server_id;
+    const uint8_t REQUEST[4] = { 0x00, 0x00, 0x00, 0x1a };
+    const vpr_uuid client_id = { .data = {
+        0x3c, 0x8b, 0x51, 0xe2, 0x7f, 0x04, 0x4a, 0x96,
+        0xb1, 0x2d, 0x68, 0xc5, 0x0e, 0x93, 0x47, 0xfa } };
+
+    /* register the suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create an RCPR allocator instance. */
+    TEST_ASSERT(STATUS_SUCCESS == rcpr_malloc_allocator_create(&alloc));
+
+    /* create the crypto suite. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_options_init(
+                    &suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1));
+
+    /* create the client private key buffer. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_buffer_init_for_cipher_key_agreement_private_key(
+                    &suite, &client_privkey));
+
+    /* create a dummy socket that is never used. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == dummy_psock_create(
+                    &sock, alloc,
+                    [&](psock*, void*, size_t*) -> int {
+                        return VCBLOCKCHAIN_ERROR_SSOCK_READ;
+                    },
+                    [&](psock*, const void*, size_t*) -> int {
+                        return VCBLOCKCHAIN_ERROR_SSOCK_WRITE;
+                    }));
+
+    /* this method performs null checks on pointer parameters. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_client_session_create_with_request(
+                    nullptr, sock, alloc, &suite, &client_id, &client_privkey,
+                    &server_id, &server_pubkey, REQUEST, sizeof(REQUEST)));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_client_session_create_with_request(
+                    &session, nullptr, alloc, &suite, &client_id,
+                    &client_privkey, &server_id, &server_pubkey, REQUEST,
+                    sizeof(REQUEST)));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_client_session_create_with_request(
+                    &session, sock, nullptr, &suite, &client_id,
+                    &client_privkey, &server_id, &server_pubkey, REQUEST,
+                    sizeof(REQUEST)));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_client_session_create_with_request(
+                    &session, sock, alloc, nullptr, &client_id,
+                    &client_privkey, &server_id, &server_pubkey, REQUEST,
+                    sizeof(REQUEST)));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_client_session_create_with_request(
+                    &session, sock, alloc, &suite, nullptr, &client_privkey,
+                    &server_id, &server_pubkey, REQUEST, sizeof(REQUEST)));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_client_session_create_with_request(
+                    &session, sock, alloc, &suite, &client_id, nullptr,
+                    &server_id, &server_pubkey, REQUEST, sizeof(REQUEST)));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_client_session_create_with_request(
+                    &session, sock, alloc, &suite, &client_id,
+                    &client_privkey, nullptr, &server_pubkey, REQUEST,
+                    sizeof(REQUEST)));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_client_session_create_with_request(
+                    &session, sock, alloc, &suite, &client_id,
+                    &client_privkey, &server_id, nullptr, REQUEST,
+                    sizeof(REQUEST)));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_client_session_create_with_request(
+                    &session, sock, alloc, &suite, &client_id,
+                    &client_privkey, &server_id, &server_pubkey, nullptr, 0U));
+
+    /* no session was created. */
+    TEST_EXPECT(nullptr == session);
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(psock_resource_handle(sock)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(rcpr_allocator_resource_handle(alloc)));
+    dispose((disposable_t*)&client_privkey);
+    dispose((disposable_t*)&suite);
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * The handshake acknowledgement and the first request are written together,
+ * at IVs 1 and 2.
+ */
+TEST(success)
+{
+    vcblockchain_client_session* session = nullptr;
+    psock* sock;
+    rcpr_allocator* alloc;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t suite;
+    vccrypt_buffer_t server_pubkey;
+    vccrypt_buffer_t request;
+    vccrypt_buffer_t ack_payload;
+    vccrypt_buffer_t request_payload;
+    vpr_uuid server_id;
+    size_t ack_size, request_size;
+    protocol_req_txn_get req;
+    const vpr_uuid client_id = { .data = {
+        0x3c, 0x8b, 0x51, 0xe2, 0x7f, 0x04, 0x4a, 0x96,
+        0xb1, 0x2d, 0x68, 0xc5, 0x0e, 0x93, 0x47, 0xfa } };
+    const vpr_uuid agent_id = { .data = {
+        0x9d, 0x02, 0x6b, 0x38, 0xc4, 0x71, 0x4e, 0x1f,
+        0x85, 0xa0, 0x3b, 0xd6, 0x27, 0xe9, 0x50, 0x8c } };
+    const vpr_uuid txn_id = { .data = {
+        0xca, 0x14, 0x0d, 0x1e, 0x5b, 0xcf, 0x47, 0xa9,
+        0xab, 0xf7, 0xbc, 0xd8, 0xfa, 0xdb, 0x48, 0x27 } };
+
+    /* register the suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create an RCPR allocator instance. */
+    TEST_ASSERT(STATUS_SUCCESS == rcpr_malloc_allocator_create(&alloc));
+
+    /* create the crypto suite. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_options_init(
+                    &suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1));
+
+    /* encode the first request. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_req_txn_get(
+                    &request, &alloc_opts, 0U, &txn_id));
+
+    /* create an agent and connect to it. */
+    dummy_agent* agent = new dummy_agent(&suite, &agent_id);
+    TEST_ASSERT(VCBLOCKCHAIN_STATUS_SUCCESS == agent->status);
+    TEST_ASSERT(VCBLOCKCHAIN_STATUS_SUCCESS == agent->connect(&sock, alloc));
+    dummy_agent_connection* conn = agent->connections[0].get();
+
+    /* create the session with the first request. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_session_create_with_request(
+                    &session, sock, alloc, &suite, &client_id,
+                    &agent->client_privkey, &server_id, &server_pubkey,
+                    request.data, request.size));
+    TEST_ASSERT(nullptr != session);
+
+    /* the handshake request was written first, then both packets in one
+     * write. */
+    TEST_ASSERT(2U == conn->writes.size());
+    const vector<uint8_t>& packets = conn->writes[1];
+
+    /* the acknowledgement was sealed at IV 1. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == psock_open_authed_data(
+                    &ack_payload, &ack_size, packets.data(), packets.size(),
+                    1U, &suite, &conn->shared_secret));
+    TEST_ASSERT(ack_size < packets.size());
+
+    /* the request was sealed at IV 2, and fills the rest of the write. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == psock_open_authed_data(
+                    &request_payload, &request_size,
+                    packets.data() + ack_size, packets.size() - ack_size, 2U,
+                    &suite, &conn->shared_secret));
+    TEST_EXPECT(ack_size + request_size == packets.size());
+    TEST_ASSERT(request.size == request_payload.size);
+    TEST_EXPECT(
+        0 == memcmp(request.data, request_payload.data, request.size));
+
+    /* the agent saw the request. */
+    TEST_ASSERT(1U == conn->requests.size());
+    TEST_EXPECT(2U == conn->request_ivs[0]);
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_decode_req_txn_get(
+                    &req, conn->requests[0].data(), conn->requests[0].size()));
+    TEST_EXPECT(0U == req.offset);
+    TEST_EXPECT(0 == memcmp(&txn_id, &req.txn_id, sizeof(txn_id)));
+
+    /* the session continues after the first request. */
+    TEST_EXPECT(3U == session->client_iv);
+    TEST_EXPECT(0x8000000000000002 == session->server_iv);
+    TEST_EXPECT(1U == session->next_offset);
+
+    /* clean up. */
+    dispose((disposable_t*)&req);
+    dispose((disposable_t*)&request_payload);
+    dispose((disposable_t*)&ack_payload);
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(
+                    vcblockchain_client_session_resource_handle(session)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(psock_resource_handle(sock)));
+    delete agent;
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(rcpr_allocator_resource_handle(alloc)));
+    dispose((disposable_t*)&server_pubkey);
+    dispose((disposable_t*)&request);
+    dispose((disposable_t*)&suite);
+    dispose((disposable_t*)&alloc_opts);
+}
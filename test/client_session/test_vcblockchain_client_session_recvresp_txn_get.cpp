@@ -0,0 +1,183 @@
+/**
+ * \file test/client_session/test_vcblockchain_client_session_recvresp_txn_get.cpp
+ *
+ * Unit tests for receiving a transaction get response through a client
+ * session.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/client_session.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vector>
+#include <vpr/allocator/malloc_allocator.h>
+
+#include "../../src/arena/arena_internal.h"
+#include "../../src/client_session/client_session_internal.h"
+#include "../dummy_agent.h"
+
+using namespace std;
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_psock;
+RCPR_IMPORT_resource;
+
+TEST_SUITE(test_vcblockchain_client_session_recvresp_txn_get);
+
+/**
+ * \brief Answer a transaction get request with a transaction that has the
+ * requested id.
+ */
+static int answer_txn_get(
+    dummy_agent_connection* conn, const vector<uint8_t>& request)
+{
+    int retval;
+    protocol_req_txn_get req;
+    vccrypt_buffer_t response;
+    const uint8_t CERT[4] = { 0x01, 0x02, 0x03, 0x04 };
+    const vpr_uuid zero_id = { .data = {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } };
+
+    retval =
+        vcblockchain_protocol_decode_req_txn_get(
+            &req, request.data(), request.size());
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        vcblockchain_protocol_encode_resp_txn_get(
+            &response, conn->agent->suite->alloc_opts, req.offset,
+            VCBLOCKCHAIN_STATUS_SUCCESS, &req.txn_id, &zero_id, &zero_id,
+            &zero_id, &zero_id, sizeof(CERT), CERT, sizeof(CERT), 0U);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_req;
+    }
+
+    retval = conn->respond(response.data, response.size);
+
+    dispose((disposable_t*)&response);
+
+cleanup_req:
+    dispose((disposable_t*)&req);
+
+    return retval;
+}
+
+/**
+ * \brief Check that a session arena was used and then reset.
+ */
+static bool arena_was_reset(const vcblockchain_arena* arena)
+{
+    return
+        nullptr != arena->head
+     && arena->head == arena->current
+     && 0U == arena->head->used;
+}
+
+/**
+ * Each request and response passes through the session in turn, with
+ * increasing offsets, and the session arena is reset after every call.
+ */
+TEST(round_trip)
+{
+    vcblockchain_client_session* session = nullptr;
+    psock* sock;
+    rcpr_allocator* alloc;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t suite;
+    vccrypt_buffer_t server_pubkey;
+    vpr_uuid server_id;
+    uint32_t offset;
+    protocol_resp_txn_get resp;
+    const vpr_uuid client_id = { .data = {
+        0x3c, 0x8b, 0x51, 0xe2, 0x7f, 0x04, 0x4a, 0x96,
+        0xb1, 0x2d, 0x68, 0xc5, 0x0e, 0x93, 0x47, 0xfa } };
+    const vpr_uuid agent_id = { .data = {
+        0x9d, 0x02, 0x6b, 0x38, 0xc4, 0x71, 0x4e, 0x1f,
+        0x85, 0xa0, 0x3b, 0xd6, 0x27, 0xe9, 0x50, 0x8c } };
+    const vpr_uuid txn_id = { .data = {
+        0xca, 0x14, 0x0d, 0x1e, 0x5b, 0xcf, 0x47, 0xa9,
+        0xab, 0xf7, 0xbc, 0xd8, 0xfa, 0xdb, 0x48, 0x27 } };
+
+    /* register the suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create an RCPR allocator instance. */
+    TEST_ASSERT(STATUS_SUCCESS == rcpr_malloc_allocator_create(&alloc));
+
+    /* create the crypto suite. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_options_init(
+                    &suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1));
+
+    /* create an agent that answers transaction get requests. */
+    dummy_agent* agent = new dummy_agent(&suite, &agent_id);
+    TEST_ASSERT(VCBLOCKCHAIN_STATUS_SUCCESS == agent->status);
+    agent->onrequest = &answer_txn_get;
+    TEST_ASSERT(VCBLOCKCHAIN_STATUS_SUCCESS == agent->connect(&sock, alloc));
+
+    /* create the session. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_session_create(
+                    &session, sock, alloc, &suite, &client_id,
+                    &agent->client_privkey, &server_id, &server_pubkey));
+    TEST_ASSERT(nullptr != session);
+
+    for (uint32_t i = 0U; i < 2U; ++i)
+    {
+        /* send the request. */
+        TEST_ASSERT(
+            VCBLOCKCHAIN_STATUS_SUCCESS
+                == vcblockchain_client_session_sendreq_txn_get(
+                        session, &offset, &txn_id));
+        TEST_EXPECT(i == offset);
+        TEST_EXPECT(arena_was_reset(&session->arena));
+
+        /* receive the response. */
+        TEST_ASSERT(
+            VCBLOCKCHAIN_STATUS_SUCCESS
+                == vcblockchain_client_session_recvresp_txn_get(
+                        session, &alloc_opts, &resp));
+        TEST_EXPECT(arena_was_reset(&session->arena));
+
+        /* the response matches the request. */
+        TEST_EXPECT(PROTOCOL_REQ_ID_TRANSACTION_BY_ID_GET == resp.request_id);
+        TEST_EXPECT(offset == resp.offset);
+        TEST_EXPECT(VCBLOCKCHAIN_STATUS_SUCCESS == resp.status);
+        TEST_EXPECT(0 == memcmp(&txn_id, &resp.txn_id, sizeof(txn_id)));
+        TEST_EXPECT(4U == resp.txn_cert.size);
+
+        dispose((disposable_t*)&resp);
+    }
+
+    /* the IVs moved past both round trips. */
+    TEST_EXPECT(4U == session->client_iv);
+    TEST_EXPECT(0x8000000000000004 == session->server_iv);
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(
+                    vcblockchain_client_session_resource_handle(session)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(psock_resource_handle(sock)));
+    delete agent;
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(rcpr_allocator_resource_handle(alloc)));
+    dispose((disposable_t*)&server_pubkey);
+    dispose((disposable_t*)&suite);
+    dispose((disposable_t*)&alloc_opts);
+}
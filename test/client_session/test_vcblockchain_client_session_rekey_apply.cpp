@@ -0,0 +1,323 @@
+/**
+ * \file test/client_session/test_vcblockchain_client_session_rekey_apply.cpp
+ *
+ * Unit tests for applying a rekey response to a client session.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/client_session.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vector>
+#include <vpr/allocator/malloc_allocator.h>
+
+#include "../dummy_agent.h"
+
+using namespace std;
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_psock;
+RCPR_IMPORT_resource;
+
+TEST_SUITE(test_vcblockchain_client_session_rekey_apply);
+
+/**
+ * \brief Answer a rekey request, switching the server at the given distance
+ * past the packet after the response.
+ *
+ * The connection keeps using its current secret for the response, and uses
+ * the new secret for every later packet in both directions.
+ */
+static int answer_rekey(
+    dummy_agent_connection* conn, const vector<uint8_t>& request,
+    uint64_t switch_skew)
+{
+    int retval;
+    protocol_req_rekey req;
+    vccrypt_buffer_t server_key_nonce, response, new_secret;
+    vccrypt_suite_options_t* suite = conn->agent->suite;
+
+    retval =
+        vcblockchain_protocol_decode_req_rekey(
+            &req, suite, request.data(), request.size());
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        /* this is some other request, which is not answered. */
+        return VCBLOCKCHAIN_STATUS_SUCCESS;
+    }
+
+    retval =
+        vccrypt_suite_buffer_init_for_cipher_key_agreement_nonce(
+            suite, &server_key_nonce);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_req;
+    }
+
+    memset(server_key_nonce.data, 0x6A, server_key_nonce.size);
+
+    /* the response is sealed at the current server IV. */
+    retval =
+        vcblockchain_protocol_encode_resp_rekey(
+            &response, suite, req.offset, VCBLOCKCHAIN_STATUS_SUCCESS,
+            conn->server_iv + 1 + switch_skew, &server_key_nonce);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_server_key_nonce;
+    }
+
+    retval = conn->respond(response.data, response.size);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_response;
+    }
+
+    /* switch to the new secret. */
+    retval =
+        vcblockchain_protocol_rekeyed_shared_secret_create(
+            &new_secret, suite, &conn->shared_secret, &req.client_key_nonce,
+            &server_key_nonce);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_response;
+    }
+
+    retval = conn->replace_shared_secret(&new_secret);
+
+    dispose((disposable_t*)&new_secret);
+
+cleanup_response:
+    dispose((disposable_t*)&response);
+
+cleanup_server_key_nonce:
+    dispose((disposable_t*)&server_key_nonce);
+
+cleanup_req:
+    dispose((disposable_t*)&req);
+
+    return retval;
+}
+
+/**
+ * After a successful rekey, the next request is sealed with the new secret.
+ */
+TEST(new_secret)
+{
+    vcblockchain_client_session* session = nullptr;
+    psock* sock;
+    rcpr_allocator* alloc;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t suite;
+    vccrypt_buffer_t server_pubkey;
+    vpr_uuid server_id;
+    void* payload;
+    uint32_t payload_size;
+    uint32_t offset;
+    protocol_req_txn_get req;
+    const vpr_uuid client_id = { .data = {
+        0x3c, 0x8b, 0x51, 0xe2, 0x7f, 0x04, 0x4a, 0x96,
+        0xb1, 0x2d, 0x68, 0xc5, 0x0e, 0x93, 0x47, 0xfa } };
+    const vpr_uuid agent_id = { .data = {
+        0x9d, 0x02, 0x6b, 0x38, 0xc4, 0x71, 0x4e, 0x1f,
+        0x85, 0xa0, 0x3b, 0xd6, 0x27, 0xe9, 0x50, 0x8c } };
+    const vpr_uuid txn_id = { .data = {
+        0xca, 0x14, 0x0d, 0x1e, 0x5b, 0xcf, 0x47, 0xa9,
+        0xab, 0xf7, 0xbc, 0xd8, 0xfa, 0xdb, 0x48, 0x27 } };
+
+    /* register the suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create an RCPR allocator instance. */
+    TEST_ASSERT(STATUS_SUCCESS == rcpr_malloc_allocator_create(&alloc));
+
+    /* create the crypto suite. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_options_init(
+                    &suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1));
+
+    /* create an agent that answers a rekey request. */
+    dummy_agent* agent = new dummy_agent(&suite, &agent_id);
+    TEST_ASSERT(VCBLOCKCHAIN_STATUS_SUCCESS == agent->status);
+    agent->onrequest =
+        [&](dummy_agent_connection* conn, const vector<uint8_t>& request) {
+            return answer_rekey(conn, request, 0U);
+        };
+    TEST_ASSERT(VCBLOCKCHAIN_STATUS_SUCCESS == agent->connect(&sock, alloc));
+
+    /* create the session. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_session_create(
+                    &session, sock, alloc, &suite, &client_id,
+                    &agent->client_privkey, &server_id, &server_pubkey));
+    TEST_ASSERT(nullptr != session);
+
+    /* request a rekey and apply the response. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_session_sendreq_rekey(session, &offset));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_session_recvresp_raw(
+                    session, &payload, &payload_size));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_session_rekey_apply(
+                    session, payload, payload_size));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_session_recvresp_raw_release(
+                    session, payload, payload_size));
+
+    /* the next request can be sent. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_session_sendreq_txn_get(
+                    session, &offset, &txn_id));
+
+    /* the agent opened it with the new secret, at the IV after the rekey. */
+    TEST_ASSERT(2U == agent->connections[0]->requests.size());
+    TEST_EXPECT(2U == agent->connections[0]->request_ivs[0]);
+    TEST_EXPECT(3U == agent->connections[0]->request_ivs[1]);
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_decode_req_txn_get(
+                    &req, agent->connections[0]->requests[1].data(),
+                    agent->connections[0]->requests[1].size()));
+    TEST_EXPECT(offset == req.offset);
+    TEST_EXPECT(0 == memcmp(&txn_id, &req.txn_id, sizeof(txn_id)));
+    TEST_EXPECT(agent->connections[0]->unread_input.empty());
+
+    /* clean up. */
+    dispose((disposable_t*)&req);
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(
+                    vcblockchain_client_session_resource_handle(session)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(psock_resource_handle(sock)));
+    delete agent;
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(rcpr_allocator_resource_handle(alloc)));
+    dispose((disposable_t*)&server_pubkey);
+    dispose((disposable_t*)&suite);
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * A response that switches the server at the wrong IV leaves the session
+ * unusable.
+ */
+TEST(iv_mismatch)
+{
+    vcblockchain_client_session* session = nullptr;
+    psock* sock;
+    rcpr_allocator* alloc;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t suite;
+    vccrypt_buffer_t server_pubkey;
+    vpr_uuid server_id;
+    void* payload;
+    uint32_t payload_size;
+    uint32_t offset;
+    size_t write_count;
+    const vpr_uuid client_id = { .data = {
+        0x3c, 0x8b, 0x51, 0xe2, 0x7f, 0x04, 0x4a, 0x96,
+        0xb1, 0x2d, 0x68, 0xc5, 0x0e, 0x93, 0x47, 0xfa } };
+    const vpr_uuid agent_id = { .data = {
+        0x9d, 0x02, 0x6b, 0x38, 0xc4, 0x71, 0x4e, 0x1f,
+        0x85, 0xa0, 0x3b, 0xd6, 0x27, 0xe9, 0x50, 0x8c } };
+    const vpr_uuid txn_id = { .data = {
+        0xca, 0x14, 0x0d, 0x1e, 0x5b, 0xcf, 0x47, 0xa9,
+        0xab, 0xf7, 0xbc, 0xd8, 0xfa, 0xdb, 0x48, 0x27 } };
+
+    /* register the suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create an RCPR allocator instance. */
+    TEST_ASSERT(STATUS_SUCCESS == rcpr_malloc_allocator_create(&alloc));
+
+    /* create the crypto suite. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_options_init(
+                    &suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1));
+
+    /* create an agent that switches one packet too late. */
+    dummy_agent* agent = new dummy_agent(&suite, &agent_id);
+    TEST_ASSERT(VCBLOCKCHAIN_STATUS_SUCCESS == agent->status);
+    agent->onrequest =
+        [&](dummy_agent_connection* conn, const vector<uint8_t>& request) {
+            return answer_rekey(conn, request, 1U);
+        };
+    TEST_ASSERT(VCBLOCKCHAIN_STATUS_SUCCESS == agent->connect(&sock, alloc));
+
+    /* create the session. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_session_create(
+                    &session, sock, alloc, &suite, &client_id,
+                    &agent->client_privkey, &server_id, &server_pubkey));
+    TEST_ASSERT(nullptr != session);
+
+    /* request a rekey; the response has the wrong switch IV. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_session_sendreq_rekey(session, &offset));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_session_recvresp_raw(
+                    session, &payload, &payload_size));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE
+            == vcblockchain_client_session_rekey_apply(
+                    session, payload, payload_size));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_session_recvresp_raw_release(
+                    session, payload, payload_size));
+    write_count = agent->connections[0]->writes.size();
+
+    /* the session refuses every later request and response. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_SESSION_FAILED
+            == vcblockchain_client_session_sendreq_txn_get(
+                    session, &offset, &txn_id));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_SESSION_FAILED
+            == vcblockchain_client_session_sendreq_rekey(session, &offset));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_SESSION_FAILED
+            == vcblockchain_client_session_recvresp_raw(
+                    session, &payload, &payload_size));
+
+    /* nothing more was written to the socket. */
+    TEST_EXPECT(write_count == agent->connections[0]->writes.size());
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(
+                    vcblockchain_client_session_resource_handle(session)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(psock_resource_handle(sock)));
+    delete agent;
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(rcpr_allocator_resource_handle(alloc)));
+    dispose((disposable_t*)&server_pubkey);
+    dispose((disposable_t*)&suite);
+    dispose((disposable_t*)&alloc_opts);
+}
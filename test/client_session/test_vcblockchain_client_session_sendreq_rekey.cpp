@@ -0,0 +1,307 @@
+/**
+ * \file test/client_session/test_vcblockchain_client_session_sendreq_rekey.cpp
+ *
+ * Unit tests for sending a rekey request through a client session.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <arpa/inet.h>
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/client_session.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vector>
+#include <vpr/allocator/malloc_allocator.h>
+
+#include "../dummy_psock.h"
+
+using namespace std;
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_psock;
+RCPR_IMPORT_resource;
+
+TEST_SUITE(test_vcblockchain_client_session_sendreq_rekey);
+
+/**
+ * \brief Build the response the server sends to resume a session.
+ *
+ * The server derives the new shared secret from the resumption secret and
+ * both nonces, and proves it by MACing the response and the client key nonce
+ * with the new shared secret.
+ */
+static int build_resume_response(
+    vccrypt_buffer_t* out, vccrypt_suite_options_t* suite,
+    const vccrypt_buffer_t* resumption_secret,
+    const vccrypt_buffer_t* client_key_nonce,
+    const vccrypt_buffer_t* server_key_nonce)
+{
+    int retval;
+    vccrypt_buffer_t shared_secret, hmac;
+    vccrypt_mac_context_t mac;
+
+    retval =
+        vcblockchain_protocol_resumed_shared_secret_create(
+            &shared_secret, suite, resumption_secret, client_key_nonce,
+            server_key_nonce);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        vccrypt_suite_buffer_init_for_mac_authentication_code(
+            suite, &hmac, true);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_shared_secret;
+    }
+
+    /* encode with a blank hmac, then MAC everything before it. */
+    memset(hmac.data, 0, hmac.size);
+    retval =
+        vcblockchain_protocol_encode_resp_handshake_resume(
+            out, suite, 0U, VCBLOCKCHAIN_STATUS_SUCCESS, server_key_nonce,
+            &hmac);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_hmac;
+    }
+
+    retval = vccrypt_suite_mac_short_init(suite, &mac, &shared_secret);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_out;
+    }
+
+    retval =
+        vccrypt_mac_digest(
+            &mac, (const uint8_t*)out->data, out->size - hmac.size);
+    if (VCCRYPT_STATUS_SUCCESS == retval)
+    {
+        retval =
+            vccrypt_mac_digest(
+                &mac, (const uint8_t*)client_key_nonce->data,
+                client_key_nonce->size);
+    }
+    if (VCCRYPT_STATUS_SUCCESS == retval)
+    {
+        retval = vccrypt_mac_finalize(&mac, &hmac);
+    }
+    if (VCCRYPT_STATUS_SUCCESS == retval)
+    {
+        memcpy(
+            ((uint8_t*)out->data) + out->size - hmac.size, hmac.data,
+            hmac.size);
+    }
+
+    dispose((disposable_t*)&mac);
+
+cleanup_out:
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        dispose((disposable_t*)out);
+    }
+
+cleanup_hmac:
+    dispose((disposable_t*)&hmac);
+
+cleanup_shared_secret:
+    dispose((disposable_t*)&shared_secret);
+
+    return retval;
+}
+
+/**
+ * While a rekey is pending, no other request can be sent through the session.
+ */
+TEST(rekey_pending)
+{
+    vcblockchain_client_session* session = nullptr;
+    psock* sock;
+    rcpr_allocator* alloc;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t suite;
+    vccrypt_buffer_t original_secret;
+    vccrypt_buffer_t ticket;
+    vccrypt_buffer_t resumption_secret;
+    vccrypt_buffer_t server_key_nonce;
+    vccrypt_buffer_t response;
+    vector<uint8_t> written;
+    size_t written_size;
+    int state = 0;
+    uint32_t offset;
+    const vpr_uuid client_id = { .data = {
+        0x3c, 0x8b, 0x51, 0xe2, 0x7f, 0x04, 0x4a, 0x96,
+        0xb1, 0x2d, 0x68, 0xc5, 0x0e, 0x93, 0x47, 0xfa } };
+    const vpr_uuid txn_id = { .data = {
+        0xca, 0x14, 0x0d, 0x1e, 0x5b, 0xcf, 0x47, 0xa9,
+        0xab, 0xf7, 0xbc, 0xd8, 0xfa, 0xdb, 0x48, 0x27 } };
+
+    /* register the suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create an RCPR allocator instance. */
+    TEST_ASSERT(STATUS_SUCCESS == rcpr_malloc_allocator_create(&alloc));
+
+    /* create the crypto suite. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_options_init(
+                    &suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1));
+
+    /* the shared secret of the session that was issued the ticket. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_buffer_init_for_cipher_key_agreement_shared_secret(
+                    &suite, &original_secret));
+    memset(original_secret.data, 0x31, original_secret.size);
+
+    /* the ticket, which is opaque to the client. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_buffer_init(&ticket, &alloc_opts, 64));
+    memset(ticket.data, 0x7C, ticket.size);
+
+    /* the resumption secret that both sides derive from the ticket. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_resumption_secret_create(
+                    &resumption_secret, &suite, &original_secret, &ticket));
+
+    /* the server key nonce. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_buffer_init_for_cipher_key_agreement_nonce(
+                    &suite, &server_key_nonce));
+    memset(server_key_nonce.data, 0x5E, server_key_nonce.size);
+
+    /* create a dummy socket that answers the resume request, and accepts
+     * every write after it. */
+    response.data = nullptr;
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == dummy_psock_create(
+                    &sock, alloc,
+                    [&](psock*, void* buffer, size_t* size) -> int {
+                        uint32_t type = htonl(PSOCK_BOXED_TYPE_DATA);
+                        protocol_req_handshake_resume req;
+                        int retval;
+
+                        switch (state)
+                        {
+                            /* answer the resume request that was written,
+                             * starting with the type. */
+                            case 0:
+                                if (written.size() < 2 * sizeof(uint32_t))
+                                    return VCBLOCKCHAIN_ERROR_SSOCK_READ;
+                                retval =
+                                    vcblockchain_protocol_decode_req_handshake_resume(
+                                        &req, &suite,
+                                        written.data() + 2 * sizeof(uint32_t),
+                                        written.size()
+                                            - 2 * sizeof(uint32_t));
+                                if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+                                    return retval;
+                                retval =
+                                    build_resume_response(
+                                        &response, &suite, &resumption_secret,
+                                        &req.client_key_nonce,
+                                        &server_key_nonce);
+                                dispose((disposable_t*)&req);
+                                if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+                                    return retval;
+                                if (*size != sizeof(uint32_t))
+                                    return VCBLOCKCHAIN_ERROR_SSOCK_READ;
+                                memcpy(buffer, &type, sizeof(type));
+                                ++state;
+                                return VCBLOCKCHAIN_STATUS_SUCCESS;
+
+                            /* read the size. */
+                            case 1:
+                                if (*size != sizeof(uint32_t))
+                                    return VCBLOCKCHAIN_ERROR_SSOCK_READ;
+                                *((uint32_t*)buffer) = htonl(response.size);
+                                ++state;
+                                return VCBLOCKCHAIN_STATUS_SUCCESS;
+
+                            /* read the payload. */
+                            case 2:
+                                if (*size != response.size)
+                                    return VCBLOCKCHAIN_ERROR_SSOCK_READ;
+                                memcpy(buffer, response.data, response.size);
+                                ++state;
+                                return VCBLOCKCHAIN_STATUS_SUCCESS;
+
+                            default:
+                                return VCBLOCKCHAIN_ERROR_SSOCK_READ;
+                        }
+                    },
+                    [&](psock*, const void* vbuf, size_t* size) -> int {
+                        const uint8_t* buf = (const uint8_t*)vbuf;
+
+                        written.insert(written.end(), buf, buf + *size);
+
+                        return VCBLOCKCHAIN_STATUS_SUCCESS;
+                    }));
+
+    /* resume the session. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_session_resume(
+                    &session, sock, alloc, &suite, &client_id, &ticket,
+                    &resumption_secret));
+    TEST_ASSERT(nullptr != session);
+
+    /* a request can be sent through the session. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_session_sendreq_txn_get(
+                    session, &offset, &txn_id));
+
+    /* request a rekey. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_client_session_sendreq_rekey(session, &offset));
+    written_size = written.size();
+
+    /* no other request can be sent until the rekey is applied. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_REKEY_PENDING
+            == vcblockchain_client_session_sendreq_txn_get(
+                    session, &offset, &txn_id));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_REKEY_PENDING
+            == vcblockchain_client_session_sendreq_latest_block_id_get(
+                    session, &offset));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_REKEY_PENDING
+            == vcblockchain_client_session_sendreq_rekey(session, &offset));
+
+    /* nothing was written to the socket. */
+    TEST_EXPECT(written_size == written.size());
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(
+                    vcblockchain_client_session_resource_handle(session)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(psock_resource_handle(sock)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(rcpr_allocator_resource_handle(alloc)));
+    dispose((disposable_t*)&response);
+    dispose((disposable_t*)&server_key_nonce);
+    dispose((disposable_t*)&resumption_secret);
+    dispose((disposable_t*)&ticket);
+    dispose((disposable_t*)&original_secret);
+    dispose((disposable_t*)&suite);
+    dispose((disposable_t*)&alloc_opts);
+}
@@ -0,0 +1,493 @@
+/**
+ * \file test/dummy_agent.cpp
+ *
+ * Dummy agent that answers a client over dummy psock instances, used for
+ * testing.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <arpa/inet.h>
+#include <cstring>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/data.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vcblockchain/psock.h>
+
+#include "dummy_agent.h"
+#include "dummy_psock.h"
+
+using namespace std;
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_psock;
+
+/* forward decls. */
+static int answer_handshake_request(
+    dummy_agent_connection* conn, bool* answered);
+static void dispose_if_set(vccrypt_buffer_t* buffer);
+
+/**
+ * \brief Constructor for \ref dummy_agent.
+ */
+dummy_agent::dummy_agent(vccrypt_suite_options_t* s, const vpr_uuid* id)
+    : suite(s), agent_id(*id), status(VCBLOCKCHAIN_STATUS_SUCCESS)
+{
+    vccrypt_key_agreement_context_t agreement;
+
+    memset(&agent_privkey, 0, sizeof(agent_privkey));
+    memset(&agent_pubkey, 0, sizeof(agent_pubkey));
+    memset(&client_privkey, 0, sizeof(client_privkey));
+    memset(&client_pubkey, 0, sizeof(client_pubkey));
+
+    status = vccrypt_suite_cipher_key_agreement_init(suite, &agreement);
+    if (VCCRYPT_STATUS_SUCCESS != status)
+    {
+        return;
+    }
+
+    /* create the agent and client keypairs. */
+    status =
+        vccrypt_suite_buffer_init_for_cipher_key_agreement_private_key(
+            suite, &agent_privkey);
+    if (VCCRYPT_STATUS_SUCCESS == status)
+    {
+        status =
+            vccrypt_suite_buffer_init_for_cipher_key_agreement_public_key(
+                suite, &agent_pubkey);
+    }
+    if (VCCRYPT_STATUS_SUCCESS == status)
+    {
+        status =
+            vccrypt_key_agreement_keypair_create(
+                &agreement, &agent_privkey, &agent_pubkey);
+    }
+    if (VCCRYPT_STATUS_SUCCESS == status)
+    {
+        status =
+            vccrypt_suite_buffer_init_for_cipher_key_agreement_private_key(
+                suite, &client_privkey);
+    }
+    if (VCCRYPT_STATUS_SUCCESS == status)
+    {
+        status =
+            vccrypt_suite_buffer_init_for_cipher_key_agreement_public_key(
+                suite, &client_pubkey);
+    }
+    if (VCCRYPT_STATUS_SUCCESS == status)
+    {
+        status =
+            vccrypt_key_agreement_keypair_create(
+                &agreement, &client_privkey, &client_pubkey);
+    }
+
+    dispose((disposable_t*)&agreement);
+}
+
+/**
+ * \brief Destructor for \ref dummy_agent.
+ */
+dummy_agent::~dummy_agent()
+{
+    connections.clear();
+    dispose_if_set(&agent_privkey);
+    dispose_if_set(&agent_pubkey);
+    dispose_if_set(&client_privkey);
+    dispose_if_set(&client_pubkey);
+}
+
+/**
+ * \brief Create a socket connected to a new connection of this agent.
+ */
+int dummy_agent::connect(psock** sock, RCPR_SYM(allocator)* a)
+{
+    dummy_agent_connection* conn = new dummy_agent_connection(this);
+    connections.emplace_back(conn);
+
+    return
+        dummy_psock_create(
+            sock, a,
+            [=](psock*, void* vbuf, size_t* size) -> int {
+                uint8_t* buf = (uint8_t*)vbuf;
+
+                if (conn->output.size() < *size)
+                    return VCBLOCKCHAIN_ERROR_SSOCK_READ;
+
+                for (size_t i = 0; i < *size; ++i)
+                {
+                    buf[i] = conn->output.front();
+                    conn->output.pop_front();
+                }
+
+                return VCBLOCKCHAIN_STATUS_SUCCESS;
+            },
+            [=](psock*, const void* vbuf, size_t* size) -> int {
+                return conn->input(vbuf, *size);
+            });
+}
+
+/**
+ * \brief Constructor for \ref dummy_agent_connection.
+ */
+dummy_agent_connection::dummy_agent_connection(dummy_agent* a)
+    : agent(a), handshake_complete(false), shared_secret_set(false),
+      client_iv(0U), server_iv(0U)
+{
+    memset(&shared_secret, 0, sizeof(shared_secret));
+}
+
+/**
+ * \brief Destructor for \ref dummy_agent_connection.
+ */
+dummy_agent_connection::~dummy_agent_connection()
+{
+    dispose_if_set(&shared_secret);
+}
+
+/**
+ * \brief Seal a response with the next server IV, and queue it to be read by
+ * the client.
+ */
+int dummy_agent_connection::respond(const void* payload, size_t size)
+{
+    int retval;
+    vccrypt_buffer_t packet;
+    vcblockchain_psock_iovec vec = { payload, size };
+
+    retval =
+        psock_seal_authed_datav(
+            &packet, server_iv, &vec, 1, agent->suite, &shared_secret);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    const uint8_t* data = (const uint8_t*)packet.data;
+    output.insert(output.end(), data, data + packet.size);
+    ++server_iv;
+
+    dispose((disposable_t*)&packet);
+
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
+
+/**
+ * \brief Replace the shared secret used for every later packet.
+ */
+int dummy_agent_connection::replace_shared_secret(
+    const vccrypt_buffer_t* secret)
+{
+    int retval;
+    vccrypt_buffer_t tmp;
+
+    retval = vccrypt_buffer_init(&tmp, agent->suite->alloc_opts, secret->size);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    memcpy(tmp.data, secret->data, secret->size);
+    dispose_if_set(&shared_secret);
+    vccrypt_buffer_move(&shared_secret, &tmp);
+
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
+
+/**
+ * \brief Accept bytes written by the client.
+ *
+ * Every complete packet in the unread input is handled in turn. A packet that
+ * has not fully arrived is left for the next write.
+ */
+int dummy_agent_connection::input(const void* data, size_t size)
+{
+    int retval;
+    const uint8_t* in = (const uint8_t*)data;
+
+    writes.emplace_back(in, in + size);
+    unread_input.insert(unread_input.end(), in, in + size);
+
+    /* the first packet is the unauthenticated handshake request. */
+    if (!shared_secret_set)
+    {
+        bool answered;
+
+        retval = answer_handshake_request(this, &answered);
+        if (VCBLOCKCHAIN_STATUS_SUCCESS != retval || !answered)
+        {
+            return retval;
+        }
+    }
+
+    /* every later packet is authenticated. */
+    while (!unread_input.empty())
+    {
+        vccrypt_buffer_t payload;
+        size_t packet_size;
+
+        retval =
+            psock_open_authed_data(
+                &payload, &packet_size, unread_input.data(),
+                unread_input.size(), client_iv, agent->suite, &shared_secret);
+        if (VCBLOCKCHAIN_ERROR_SSOCK_PACKET_INCOMPLETE == retval)
+        {
+            return VCBLOCKCHAIN_STATUS_SUCCESS;
+        }
+        else if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        unread_input.erase(
+            unread_input.begin(), unread_input.begin() + packet_size);
+        const uint8_t* p = (const uint8_t*)payload.data;
+        vector<uint8_t> request(p, p + payload.size);
+        uint64_t iv = client_iv++;
+        dispose((disposable_t*)&payload);
+
+        /* the first authed packet is the handshake acknowledgement. */
+        if (!handshake_complete)
+        {
+            vccrypt_buffer_t ack;
+
+            server_iv = 0x8000000000000001;
+            retval =
+                vcblockchain_protocol_encode_resp_handshake_ack(
+                    &ack, agent->suite->alloc_opts, 0U,
+                    VCBLOCKCHAIN_STATUS_SUCCESS);
+            if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+
+            retval = respond(ack.data, ack.size);
+            dispose((disposable_t*)&ack);
+            if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+
+            handshake_complete = true;
+            continue;
+        }
+
+        /* record the request, then let the test answer it. */
+        requests.push_back(request);
+        request_ivs.push_back(iv);
+        if (agent->onrequest)
+        {
+            retval = agent->onrequest(this, request);
+            if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+        }
+    }
+
+    return VCBLOCKCHAIN_STATUS_SUCCESS;
+}
+
+/**
+ * \brief Answer the handshake request at the start of the unread input.
+ *
+ * \param conn          The connection.
+ * \param answered      Set to true if the request was answered, or false if it
+ *                      has not fully arrived.
+ *
+ * \returns a status code indicating success or failure.
+ */
+static int answer_handshake_request(
+    dummy_agent_connection* conn, bool* answered)
+{
+    int retval;
+    dummy_agent* agent = conn->agent;
+    vccrypt_suite_options_t* suite = agent->suite;
+    uint32_t net_type, net_size;
+    protocol_req_handshake_request req;
+    vccrypt_key_agreement_context_t agreement;
+    vccrypt_mac_context_t mac;
+    vccrypt_buffer_t server_key_nonce, server_challenge_nonce, hmac, out;
+
+    *answered = false;
+
+    /* wait for the boxed header. */
+    if (conn->unread_input.size() < 2 * sizeof(uint32_t))
+    {
+        return VCBLOCKCHAIN_STATUS_SUCCESS;
+    }
+
+    memcpy(&net_type, conn->unread_input.data(), sizeof(net_type));
+    memcpy(
+        &net_size, conn->unread_input.data() + sizeof(net_type),
+        sizeof(net_size));
+    if (PSOCK_BOXED_TYPE_DATA != ntohl(net_type))
+    {
+        return VCBLOCKCHAIN_ERROR_SSOCK_READ_UNEXPECTED_DATA_TYPE;
+    }
+
+    /* wait for the rest of the request. */
+    size_t boxed_size = 2 * sizeof(uint32_t) + ntohl(net_size);
+    if (conn->unread_input.size() < boxed_size)
+    {
+        return VCBLOCKCHAIN_STATUS_SUCCESS;
+    }
+
+    retval =
+        vcblockchain_protocol_decode_req_handshake_request(
+            &req, suite, conn->unread_input.data() + 2 * sizeof(uint32_t),
+            ntohl(net_size));
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    conn->unread_input.erase(
+        conn->unread_input.begin(), conn->unread_input.begin() + boxed_size);
+
+    /* create the server nonces. */
+    retval =
+        vccrypt_suite_buffer_init_for_cipher_key_agreement_nonce(
+            suite, &server_key_nonce);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_req;
+    }
+
+    memset(server_key_nonce.data, 0x5E, server_key_nonce.size);
+
+    retval =
+        vccrypt_suite_buffer_init_for_cipher_key_agreement_nonce(
+            suite, &server_challenge_nonce);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_server_key_nonce;
+    }
+
+    memset(server_challenge_nonce.data, 0xC3, server_challenge_nonce.size);
+
+    /* derive the shared secret. */
+    retval = vccrypt_suite_cipher_key_agreement_init(suite, &agreement);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_server_challenge_nonce;
+    }
+
+    retval =
+        vccrypt_suite_buffer_init_for_cipher_key_agreement_shared_secret(
+            suite, &conn->shared_secret);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_agreement;
+    }
+
+    conn->shared_secret_set = true;
+    retval =
+        vccrypt_key_agreement_short_term_secret_create(
+            &agreement, &agent->agent_privkey, &agent->client_pubkey,
+            &server_key_nonce, &req.client_key_nonce, &conn->shared_secret);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_agreement;
+    }
+
+    /* encode the response with a blank hmac, then MAC everything before it
+     * and the client challenge nonce. */
+    retval =
+        vccrypt_suite_buffer_init_for_mac_authentication_code(
+            suite, &hmac, true);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_agreement;
+    }
+
+    memset(hmac.data, 0, hmac.size);
+    retval =
+        vcblockchain_protocol_encode_resp_handshake_request(
+            &out, suite, req.offset, VCBLOCKCHAIN_STATUS_SUCCESS,
+            &agent->agent_id, &agent->agent_pubkey, &server_key_nonce,
+            &server_challenge_nonce, &hmac);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_hmac;
+    }
+
+    retval = vccrypt_suite_mac_short_init(suite, &mac, &conn->shared_secret);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_out;
+    }
+
+    retval =
+        vccrypt_mac_digest(
+            &mac, (const uint8_t*)out.data, out.size - hmac.size);
+    if (VCCRYPT_STATUS_SUCCESS == retval)
+    {
+        retval =
+            vccrypt_mac_digest(
+                &mac, (const uint8_t*)req.client_challenge_nonce.data,
+                req.client_challenge_nonce.size);
+    }
+    if (VCCRYPT_STATUS_SUCCESS == retval)
+    {
+        retval = vccrypt_mac_finalize(&mac, &hmac);
+    }
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_mac;
+    }
+
+    memcpy(
+        ((uint8_t*)out.data) + out.size - hmac.size, hmac.data, hmac.size);
+
+    /* queue the boxed response. */
+    net_type = htonl(PSOCK_BOXED_TYPE_DATA);
+    net_size = htonl(out.size);
+    conn->output.insert(
+        conn->output.end(), (const uint8_t*)&net_type,
+        (const uint8_t*)&net_type + sizeof(net_type));
+    conn->output.insert(
+        conn->output.end(), (const uint8_t*)&net_size,
+        (const uint8_t*)&net_size + sizeof(net_size));
+    conn->output.insert(
+        conn->output.end(), (const uint8_t*)out.data,
+        (const uint8_t*)out.data + out.size);
+
+    /* the client acknowledges with its first authed packet. */
+    conn->client_iv = 0x0000000000000001;
+    *answered = true;
+    retval = VCBLOCKCHAIN_STATUS_SUCCESS;
+
+cleanup_mac:
+    dispose((disposable_t*)&mac);
+
+cleanup_out:
+    dispose((disposable_t*)&out);
+
+cleanup_hmac:
+    dispose((disposable_t*)&hmac);
+
+cleanup_agreement:
+    dispose((disposable_t*)&agreement);
+
+cleanup_server_challenge_nonce:
+    dispose((disposable_t*)&server_challenge_nonce);
+
+cleanup_server_key_nonce:
+    dispose((disposable_t*)&server_key_nonce);
+
+cleanup_req:
+    dispose((disposable_t*)&req);
+
+    return retval;
+}
+
+/**
+ * \brief Dispose a buffer if it was initialized.
+ */
+static void dispose_if_set(vccrypt_buffer_t* buffer)
+{
+    if (nullptr != buffer->data)
+    {
+        dispose((disposable_t*)buffer);
+    }
+}
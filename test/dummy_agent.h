@@ -0,0 +1,129 @@
+/**
+ * \file test/dummy_agent.h
+ *
+ * Dummy agent that answers a client over dummy psock instances, used for
+ * testing.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#pragma once
+
+#ifndef __cplusplus
+#error This is a C++ only header.
+#endif /*__cplusplus*/
+
+#include <deque>
+#include <functional>
+#include <memory>
+#include <rcpr/allocator.h>
+#include <rcpr/psock.h>
+#include <vccrypt/suite.h>
+#include <vector>
+#include <vpr/uuid.h>
+
+struct dummy_agent;
+
+/**
+ * \brief A single connection to a dummy agent.
+ *
+ * The connection answers the handshake request and the handshake
+ * acknowledgement on its own. After that, each authed packet written by the
+ * client is opened with the current shared secret, recorded, and handed to the
+ * agent's request callback, which may answer it with \ref respond.
+ */
+struct dummy_agent_connection
+{
+    /**
+     * \brief Constructor for \ref dummy_agent_connection.
+     */
+    dummy_agent_connection(dummy_agent* a);
+
+    /**
+     * \brief Destructor for \ref dummy_agent_connection.
+     */
+    ~dummy_agent_connection();
+
+    /**
+     * \brief Seal a response with the next server IV, and queue it to be read
+     * by the client.
+     *
+     * \param payload   The response payload.
+     * \param size      The size of the response payload.
+     *
+     * \returns a status code indicating success or failure.
+     */
+    int respond(const void* payload, size_t size);
+
+    /**
+     * \brief Replace the shared secret used for every later packet.
+     *
+     * \param secret    The new shared secret.
+     *
+     * \returns a status code indicating success or failure.
+     */
+    int replace_shared_secret(const vccrypt_buffer_t* secret);
+
+    /**
+     * \brief Accept bytes written by the client.
+     */
+    int input(const void* data, size_t size);
+
+    dummy_agent* agent;
+    bool handshake_complete;
+    bool shared_secret_set;
+    vccrypt_buffer_t shared_secret;
+    uint64_t client_iv;
+    uint64_t server_iv;
+    std::vector<uint8_t> unread_input;
+    std::deque<uint8_t> output;
+    std::vector<std::vector<uint8_t>> writes;
+    std::vector<std::vector<uint8_t>> requests;
+    std::vector<uint64_t> request_ivs;
+};
+
+/**
+ * \brief A dummy agent.
+ *
+ * The agent holds its own identity and keypair, and the keypair of the one
+ * client it accepts. Each socket created by \ref connect is a new connection
+ * to the agent.
+ */
+struct dummy_agent
+{
+    /**
+     * \brief Constructor for \ref dummy_agent.
+     *
+     * \param s         The crypto suite to use. It must outlive the agent.
+     * \param id        The agent id presented in the handshake.
+     *
+     * On failure, \ref status is set to a non-zero error code.
+     */
+    dummy_agent(vccrypt_suite_options_t* s, const vpr_uuid* id);
+
+    /**
+     * \brief Destructor for \ref dummy_agent.
+     */
+    ~dummy_agent();
+
+    /**
+     * \brief Create a socket connected to a new connection of this agent.
+     *
+     * \param sock      Pointer to the pointer to receive the socket instance.
+     * \param a         Allocator to use for this operation.
+     *
+     * \returns a status code indicating success or failure.
+     */
+    int connect(RCPR_SYM(psock)** sock, RCPR_SYM(allocator)* a);
+
+    vccrypt_suite_options_t* suite;
+    vpr_uuid agent_id;
+    vccrypt_buffer_t agent_privkey;
+    vccrypt_buffer_t agent_pubkey;
+    vccrypt_buffer_t client_privkey;
+    vccrypt_buffer_t client_pubkey;
+    int status;
+    std::vector<std::unique_ptr<dummy_agent_connection>> connections;
+    std::function<int(dummy_agent_connection*, const std::vector<uint8_t>&)>
+        onrequest;
+};
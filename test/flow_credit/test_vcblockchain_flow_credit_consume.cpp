@@ -0,0 +1,97 @@
+/**
+ * \file test/flow_credit/test_vcblockchain_flow_credit_consume.cpp
+ *
+ * Unit tests for consuming and granting flow credits.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/flow_credit.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_flow_credit_consume);
+
+/**
+ * A sender can consume its window, and then must wait for a grant.
+ */
+TEST(window)
+{
+    vcblockchain_flow_credit credit;
+
+    /* a window of two requests and 100 bytes. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_flow_credit_init(&credit, 2U, 100U));
+
+    /* a message larger than the window could never be sent. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_flow_credit_consume(&credit, 1U, 101U));
+
+    /* two messages fit in the window. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_flow_credit_consume(&credit, 1U, 40U));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_flow_credit_consume(&credit, 1U, 40U));
+
+    /* a third message is out of request credits. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_FLOW_CREDIT_EXHAUSTED
+            == vcblockchain_flow_credit_consume(&credit, 1U, 10U));
+
+    /* a failed consume takes no credits. */
+    TEST_EXPECT(0U == credit.request_credits);
+    TEST_EXPECT(20U == credit.byte_credits);
+
+    /* the receiver can't grant more than was consumed. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE
+            == vcblockchain_flow_credit_grant(&credit, 3U, 0U));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE
+            == vcblockchain_flow_credit_grant(&credit, 0U, 81U));
+
+    /* a grant of one request is still short of bytes for a large message. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_flow_credit_grant(&credit, 1U, 0U));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_FLOW_CREDIT_EXHAUSTED
+            == vcblockchain_flow_credit_consume(&credit, 1U, 30U));
+
+    /* once the bytes are granted, the message can be sent. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_flow_credit_grant(&credit, 0U, 40U));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_flow_credit_consume(&credit, 1U, 30U));
+}
+
+/**
+ * A window of zero is unlimited.
+ */
+TEST(unlimited)
+{
+    vcblockchain_flow_credit credit;
+
+    /* a window of one request and unlimited bytes. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_flow_credit_init(&credit, 1U, 0U));
+
+    /* a message of any size can be sent. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_flow_credit_consume(&credit, 1U, 1U << 30));
+
+    /* but the requests are still limited. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_FLOW_CREDIT_EXHAUSTED
+            == vcblockchain_flow_credit_consume(&credit, 1U, 1U));
+}
@@ -0,0 +1,95 @@
+/**
+ * \file test/flow_credit/test_vcblockchain_flow_credit_grant.cpp
+ *
+ * Unit tests for applying a flow credit grant.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/flow_credit.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_flow_credit_grant);
+
+/**
+ * This method should perform null checks on its pointer parameters.
+ */
+TEST(parameters)
+{
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_flow_credit_grant(nullptr, 1U, 1U));
+}
+
+/**
+ * A grant of more credits than were consumed is rejected, and changes
+ * nothing.
+ */
+TEST(over_grant)
+{
+    vcblockchain_flow_credit credit;
+
+    /* a window of two requests and 100 bytes, with one message consumed. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_flow_credit_init(&credit, 2U, 100U));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_flow_credit_consume(&credit, 1U, 30U));
+
+    /* too many requests. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE
+            == vcblockchain_flow_credit_grant(&credit, 2U, 30U));
+
+    /* too many bytes. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE
+            == vcblockchain_flow_credit_grant(&credit, 1U, 31U));
+
+    /* neither grant was applied. */
+    TEST_EXPECT(1U == credit.request_credits);
+    TEST_EXPECT(70U == credit.byte_credits);
+
+    /* the consumed credits can be returned exactly once. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_flow_credit_grant(&credit, 1U, 30U));
+    TEST_EXPECT(2U == credit.request_credits);
+    TEST_EXPECT(100U == credit.byte_credits);
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE
+            == vcblockchain_flow_credit_grant(&credit, 1U, 0U));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE
+            == vcblockchain_flow_credit_grant(&credit, 0U, 1U));
+}
+
+/**
+ * A grant of an unlimited kind of credit is ignored.
+ */
+TEST(unlimited)
+{
+    vcblockchain_flow_credit credit;
+
+    /* unlimited requests and a window of 100 bytes. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_flow_credit_init(&credit, 0U, 100U));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_flow_credit_consume(&credit, 1U, 50U));
+
+    /* any number of requests may be granted, but bytes are still checked. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_flow_credit_grant(&credit, 1000U, 50U));
+    TEST_EXPECT(0U == credit.request_credits);
+    TEST_EXPECT(100U == credit.byte_credits);
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE
+            == vcblockchain_flow_credit_grant(&credit, 0U, 1U));
+}
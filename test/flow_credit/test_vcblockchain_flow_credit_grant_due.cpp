@@ -0,0 +1,110 @@
+/**
+ * \file test/flow_credit/test_vcblockchain_flow_credit_grant_due.cpp
+ *
+ * Unit tests for deciding when a receiver grants flow credits.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/flow_credit.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_flow_credit_grant_due);
+
+/**
+ * A grant is due once half of a window has been freed.
+ */
+TEST(half_window)
+{
+    vcblockchain_flow_credit credit;
+    uint32_t requests;
+    uint64_t bytes;
+
+    /* a window of four requests and 1000 bytes. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_flow_credit_init(&credit, 4U, 1000U));
+
+    /* the receiver takes in four small messages. */
+    for (int i = 0; i < 4; ++i)
+    {
+        TEST_ASSERT(
+            VCBLOCKCHAIN_STATUS_SUCCESS
+                == vcblockchain_flow_credit_consume(&credit, 1U, 10U));
+    }
+
+    /* a fifth overruns the window. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_FLOW_CREDIT_EXHAUSTED
+            == vcblockchain_flow_credit_consume(&credit, 1U, 10U));
+
+    /* it can't free more than it took in. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_flow_credit_release(&credit, 5U, 0U));
+
+    /* after freeing one message, no grant is due. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_flow_credit_release(&credit, 1U, 10U));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_flow_credit_grant_due(&credit, &requests, &bytes));
+    TEST_EXPECT(0U == requests);
+    TEST_EXPECT(0U == bytes);
+
+    /* after freeing a second, half of the request window is free. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_flow_credit_release(&credit, 1U, 10U));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_flow_credit_grant_due(&credit, &requests, &bytes));
+    TEST_EXPECT(2U == requests);
+    TEST_EXPECT(20U == bytes);
+
+    /* the granted credits are available to the sender again. */
+    TEST_EXPECT(2U == credit.request_credits);
+    TEST_EXPECT(0U == credit.requests_freed);
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_flow_credit_grant_due(&credit, &requests, &bytes));
+    TEST_EXPECT(0U == requests);
+    TEST_EXPECT(0U == bytes);
+}
+
+/**
+ * A grant is due once everything consumed has been freed, so that a waiting
+ * sender is never stranded.
+ */
+TEST(all_freed)
+{
+    vcblockchain_flow_credit credit;
+    uint32_t requests;
+    uint64_t bytes;
+
+    /* a window of four requests and 1000 bytes. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_flow_credit_init(&credit, 4U, 1000U));
+
+    /* the receiver takes in one small message and frees it. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_flow_credit_consume(&credit, 1U, 10U));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_flow_credit_release(&credit, 1U, 10U));
+
+    /* less than half a window was freed, but nothing is outstanding. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_flow_credit_grant_due(&credit, &requests, &bytes));
+    TEST_EXPECT(1U == requests);
+    TEST_EXPECT(10U == bytes);
+    TEST_EXPECT(4U == credit.request_credits);
+    TEST_EXPECT(1000U == credit.byte_credits);
+}
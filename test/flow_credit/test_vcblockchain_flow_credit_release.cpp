@@ -0,0 +1,106 @@
+/**
+ * \file test/flow_credit/test_vcblockchain_flow_credit_release.cpp
+ *
+ * Unit tests for freeing the capacity held by received messages.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/flow_credit.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_flow_credit_release);
+
+/**
+ * This method should perform null checks on its pointer parameters.
+ */
+TEST(parameters)
+{
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_flow_credit_release(nullptr, 1U, 1U));
+}
+
+/**
+ * Freeing more than was consumed is rejected, and changes nothing.
+ */
+TEST(over_release)
+{
+    vcblockchain_flow_credit credit;
+
+    /* a window of four requests and 100 bytes, with two messages taken in. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_flow_credit_init(&credit, 4U, 100U));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_flow_credit_consume(&credit, 1U, 20U));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_flow_credit_consume(&credit, 1U, 30U));
+
+    /* too many requests. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_flow_credit_release(&credit, 3U, 10U));
+
+    /* too many bytes. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_flow_credit_release(&credit, 1U, 51U));
+
+    /* nothing was freed. */
+    TEST_EXPECT(0U == credit.requests_freed);
+    TEST_EXPECT(0U == credit.bytes_freed);
+
+    /* the first message can be freed. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_flow_credit_release(&credit, 1U, 20U));
+    TEST_EXPECT(1U == credit.requests_freed);
+    TEST_EXPECT(20U == credit.bytes_freed);
+
+    /* credits that were already freed can't be freed again. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_flow_credit_release(&credit, 2U, 30U));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_flow_credit_release(&credit, 1U, 31U));
+
+    /* the second message can be freed. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_flow_credit_release(&credit, 1U, 30U));
+    TEST_EXPECT(2U == credit.requests_freed);
+    TEST_EXPECT(50U == credit.bytes_freed);
+}
+
+/**
+ * Freeing an unlimited kind of credit is ignored.
+ */
+TEST(unlimited)
+{
+    vcblockchain_flow_credit credit;
+
+    /* a window of two requests and unlimited bytes. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_flow_credit_init(&credit, 2U, 0U));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_flow_credit_consume(&credit, 1U, 1000U));
+
+    /* any number of bytes may be freed, but requests are still checked. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_flow_credit_release(&credit, 1U, 5000U));
+    TEST_EXPECT(1U == credit.requests_freed);
+    TEST_EXPECT(0U == credit.bytes_freed);
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_flow_credit_release(&credit, 1U, 0U));
+}
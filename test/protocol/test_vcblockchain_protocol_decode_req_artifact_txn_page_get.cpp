@@ -0,0 +1,113 @@
+/**
+ * \file
+ * test/protocol/test_vcblockchain_protocol_decode_req_artifact_txn_page_get.cpp
+ *
+ * Unit tests for decoding the artifact transaction page get request.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_protocol_decode_req_artifact_txn_page_get);
+
+/**
+ * This method should perform null checks on its pointer parameters.
+ */
+TEST(parameters)
+{
+    uint8_t payload[52];
+    protocol_req_artifact_txn_page_get req;
+
+    /* a forward page of one transaction. */
+    memset(payload, 0, sizeof(payload));
+    payload[3] = 0x22;
+    payload[47] = 0x01;
+
+    /* This method performs null checks on pointer parameters. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_req_artifact_txn_page_get(
+                    nullptr, payload, sizeof(payload)));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_req_artifact_txn_page_get(
+                    &req, nullptr, sizeof(payload)));
+
+    /* the payload size must be exact. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_req_artifact_txn_page_get(
+                    &req, payload, sizeof(payload) - 1));
+
+    /* an unknown direction is rejected. */
+    payload[43] = 0x02;
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_req_artifact_txn_page_get(
+                    &req, payload, sizeof(payload)));
+
+    /* an empty page is rejected. */
+    payload[43] = 0x00;
+    payload[47] = 0x00;
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_req_artifact_txn_page_get(
+                    &req, payload, sizeof(payload)));
+}
+
+/**
+ * This method can decode an encoded request.
+ */
+TEST(happy_path)
+{
+    const uint32_t EXPECTED_OFFSET = 97;
+    const uint32_t EXPECTED_DIRECTION = PROTOCOL_TXN_PAGE_DIRECTION_BACKWARD;
+    const uint32_t EXPECTED_PAGE_SIZE = 100;
+    const vpr_uuid EXPECTED_ARTIFACT_ID = { .data = {
+        0xca, 0x14, 0x0d, 0x1e, 0x5b, 0xcf, 0x47, 0xa9,
+        0xab, 0xf7, 0xbc, 0xd8, 0xfa, 0xdb, 0x48, 0x27 }};
+    const vpr_uuid EXPECTED_CURSOR = { .data = {
+        0x4b, 0x8e, 0x1f, 0x02, 0x66, 0x3d, 0x4a, 0x91,
+        0x80, 0x5c, 0x2e, 0xd7, 0x19, 0xa4, 0x63, 0xf0 }};
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+    protocol_req_artifact_txn_page_get req;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* encode the request. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_req_artifact_txn_page_get(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET,
+                    &EXPECTED_ARTIFACT_ID, &EXPECTED_CURSOR,
+                    EXPECTED_DIRECTION, EXPECTED_PAGE_SIZE, true));
+
+    /* decode the request. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_decode_req_artifact_txn_page_get(
+                    &req, buffer.data, buffer.size));
+
+    /* the values should match. */
+    TEST_EXPECT(PROTOCOL_REQ_ID_ARTIFACT_TXN_PAGE_GET == req.request_id);
+    TEST_EXPECT(EXPECTED_OFFSET == req.offset);
+    TEST_EXPECT(0 == memcmp(&req.artifact_id, &EXPECTED_ARTIFACT_ID, 16));
+    TEST_EXPECT(0 == memcmp(&req.cursor_txn_id, &EXPECTED_CURSOR, 16));
+    TEST_EXPECT(EXPECTED_DIRECTION == req.direction);
+    TEST_EXPECT(EXPECTED_PAGE_SIZE == req.page_size);
+    TEST_EXPECT(req.include_certs);
+
+    /* clean up. */
+    dispose((disposable_t*)&req);
+    dispose((disposable_t*)&buffer);
+    dispose((disposable_t*)&alloc_opts);
+}
@@ -0,0 +1,149 @@
+/**
+ * \file
+ * test/protocol/test_vcblockchain_protocol_decode_req_artifact_unsubscribe.cpp
+ *
+ * Unit tests for decoding the artifact unsubscription request.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_protocol_decode_req_artifact_unsubscribe);
+
+/**
+ * This method should perform null checks on its pointer parameters.
+ */
+TEST(parameters)
+{
+    const uint8_t EXPECTED_PAYLOAD[4] = { 0x00, 0x01, 0x02, 0x03 };
+    size_t EXPECTED_PAYLOAD_SIZE = sizeof(EXPECTED_PAYLOAD);
+    allocator_options_t alloc_opts;
+    protocol_req_artifact_unsubscribe req;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* This method performs null checks on pointer parameters. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_req_artifact_unsubscribe(
+                    nullptr, &alloc_opts, EXPECTED_PAYLOAD,
+                    EXPECTED_PAYLOAD_SIZE));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_req_artifact_unsubscribe(
+                    &req, nullptr, EXPECTED_PAYLOAD, EXPECTED_PAYLOAD_SIZE));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_req_artifact_unsubscribe(
+                    &req, &alloc_opts, nullptr, EXPECTED_PAYLOAD_SIZE));
+
+    /* clean up. */
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * This method should verify the count against the payload size.
+ */
+TEST(payload_size)
+{
+    const uint8_t PAYLOAD[28] = {
+        0x00, 0x00, 0x00, 0x35, /* request id. */
+        0x00, 0x00, 0x00, 0x01, /* offset. */
+        0x00, 0x00, 0x00, 0x01, /* count. */
+        0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+        0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11 /* artifact id. */ };
+    const uint8_t EMPTY_PAYLOAD[12] = {
+        0x00, 0x00, 0x00, 0x35, /* request id. */
+        0x00, 0x00, 0x00, 0x01, /* offset. */
+        0x00, 0x00, 0x00, 0x00 /* count. */ };
+    allocator_options_t alloc_opts;
+    protocol_req_artifact_unsubscribe req;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* a truncated header is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_req_artifact_unsubscribe(
+                    &req, &alloc_opts, PAYLOAD, 8));
+
+    /* a truncated artifact id is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_req_artifact_unsubscribe(
+                    &req, &alloc_opts, PAYLOAD, sizeof(PAYLOAD) - 1));
+
+    /* an empty unsubscription removes every artifact. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_decode_req_artifact_unsubscribe(
+                    &req, &alloc_opts, EMPTY_PAYLOAD, sizeof(EMPTY_PAYLOAD)));
+    TEST_EXPECT(0U == req.count);
+    TEST_EXPECT(nullptr == req.artifact_ids);
+    dispose((disposable_t*)&req);
+
+    /* the complete payload is decoded. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_decode_req_artifact_unsubscribe(
+                    &req, &alloc_opts, PAYLOAD, sizeof(PAYLOAD)));
+    TEST_EXPECT(1U == req.count);
+    dispose((disposable_t*)&req);
+
+    /* clean up. */
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * This method can decode an encoded request.
+ */
+TEST(happy_path)
+{
+    const uint32_t EXPECTED_OFFSET = 97;
+    const vpr_uuid ARTIFACT_IDS[2] = {
+        { .data = {
+            0x5d, 0x1a, 0x93, 0x0e, 0x7c, 0x24, 0x4b, 0x8f,
+            0xa6, 0x31, 0x0d, 0xe2, 0x58, 0x4f, 0x96, 0x1c } },
+        { .data = {
+            0x0b, 0xe4, 0x27, 0x6a, 0x19, 0xd3, 0x45, 0x70,
+            0x8c, 0x5e, 0xf2, 0x03, 0x6d, 0xa1, 0x3b, 0x94 } } };
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+    protocol_req_artifact_unsubscribe req;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* encode the request. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_req_artifact_unsubscribe(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, ARTIFACT_IDS, 2));
+
+    /* decode the request. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_decode_req_artifact_unsubscribe(
+                    &req, &alloc_opts, buffer.data, buffer.size));
+
+    /* the values should match. */
+    TEST_EXPECT(PROTOCOL_REQ_ID_ARTIFACT_UNSUBSCRIBE == req.request_id);
+    TEST_EXPECT(EXPECTED_OFFSET == req.offset);
+    TEST_ASSERT(2U == req.count);
+    TEST_EXPECT(
+        0 == memcmp(req.artifact_ids, ARTIFACT_IDS, sizeof(ARTIFACT_IDS)));
+
+    /* clean up. */
+    dispose((disposable_t*)&req);
+    dispose((disposable_t*)&buffer);
+    dispose((disposable_t*)&alloc_opts);
+}
@@ -0,0 +1,218 @@
+/**
+ * \file test/protocol/test_vcblockchain_protocol_decode_req_batch.cpp
+ *
+ * Unit tests for decoding the batch request.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_protocol_decode_req_batch);
+
+/**
+ * This method should perform null checks on its pointer parameters.
+ */
+TEST(parameters)
+{
+    const uint8_t EXPECTED_PAYLOAD[4] = { 0x00, 0x01, 0x02, 0x03 };
+    size_t EXPECTED_PAYLOAD_SIZE = sizeof(EXPECTED_PAYLOAD);
+    allocator_options_t alloc_opts;
+    protocol_req_batch req;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* This method performs null checks on pointer parameters. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_req_batch(
+                    nullptr, &alloc_opts, EXPECTED_PAYLOAD,
+                    EXPECTED_PAYLOAD_SIZE));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_req_batch(
+                    &req, nullptr, EXPECTED_PAYLOAD, EXPECTED_PAYLOAD_SIZE));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_req_batch(
+                    &req, &alloc_opts, nullptr, EXPECTED_PAYLOAD_SIZE));
+
+    /* clean up. */
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * This method should verify each size prefix against the payload.
+ */
+TEST(payload_size)
+{
+    const uint8_t PAYLOAD[24] = {
+        0x00, 0x00, 0x00, 0x40, /* request id. */
+        0x00, 0x00, 0x00, 0x01, /* offset. */
+        0x00, 0x00, 0x00, 0x01, /* count. */
+        0x00, 0x00, 0x00, 0x08, /* size. */
+        0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05 };
+    uint8_t TRAILING_PAYLOAD[sizeof(PAYLOAD) + 1];
+    uint8_t EMPTY_PAYLOAD[12];
+    allocator_options_t alloc_opts;
+    protocol_req_batch req;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* a truncated header is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_req_batch(
+                    &req, &alloc_opts, PAYLOAD, 8));
+
+    /* a truncated request is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_req_batch(
+                    &req, &alloc_opts, PAYLOAD, sizeof(PAYLOAD) - 1));
+
+    /* trailing data is rejected. */
+    memcpy(TRAILING_PAYLOAD, PAYLOAD, sizeof(PAYLOAD));
+    TRAILING_PAYLOAD[sizeof(PAYLOAD)] = 0x00;
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_req_batch(
+                    &req, &alloc_opts, TRAILING_PAYLOAD,
+                    sizeof(TRAILING_PAYLOAD)));
+
+    /* an empty batch is rejected. */
+    memcpy(EMPTY_PAYLOAD, PAYLOAD, sizeof(EMPTY_PAYLOAD));
+    EMPTY_PAYLOAD[11] = 0x00;
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_req_batch(
+                    &req, &alloc_opts, EMPTY_PAYLOAD, sizeof(EMPTY_PAYLOAD)));
+
+    /* clean up. */
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * This method should reject a batch nested in a batch.
+ */
+TEST(nested_batch)
+{
+    const uint8_t PAYLOAD[24] = {
+        0x00, 0x00, 0x00, 0x40, /* request id. */
+        0x00, 0x00, 0x00, 0x01, /* offset. */
+        0x00, 0x00, 0x00, 0x01, /* count. */
+        0x00, 0x00, 0x00, 0x08, /* size. */
+        0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02 };
+    uint8_t SHORT_PAYLOAD[20];
+    allocator_options_t alloc_opts;
+    protocol_req_batch req;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* a batch holding a batch request is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_req_batch(
+                    &req, &alloc_opts, PAYLOAD, sizeof(PAYLOAD)));
+
+    /* a request too small to hold a request id and offset is rejected. */
+    memcpy(SHORT_PAYLOAD, PAYLOAD, sizeof(SHORT_PAYLOAD));
+    SHORT_PAYLOAD[15] = 0x04;
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_req_batch(
+                    &req, &alloc_opts, SHORT_PAYLOAD, sizeof(SHORT_PAYLOAD)));
+
+    /* clean up. */
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * This method can decode an encoded batch and each request in it.
+ */
+TEST(happy_path)
+{
+    const uint32_t EXPECTED_OFFSET = 97;
+    const uint32_t EXPECTED_TXN_OFFSET = 98;
+    const uint32_t EXPECTED_HEIGHT_OFFSET = 99;
+    const uint64_t EXPECTED_HEIGHT = 1234;
+    const vpr_uuid EXPECTED_TXN_ID = { .data = {
+        0xca, 0x14, 0x0d, 0x1e, 0x5b, 0xcf, 0x47, 0xa9,
+        0xab, 0xf7, 0xbc, 0xd8, 0xfa, 0xdb, 0x48, 0x27 }};
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+    vccrypt_buffer_t requests[2];
+    protocol_req_batch req;
+    protocol_req_txn_get txn_req;
+    protocol_req_block_id_by_height_get height_req;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* encode the batch. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_req_txn_get(
+                    &requests[0], &alloc_opts, EXPECTED_TXN_OFFSET,
+                    &EXPECTED_TXN_ID));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_req_block_id_by_height_get(
+                    &requests[1], &alloc_opts, EXPECTED_HEIGHT_OFFSET,
+                    EXPECTED_HEIGHT));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_req_batch(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, requests, 2));
+
+    /* decode the batch. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_decode_req_batch(
+                    &req, &alloc_opts, buffer.data, buffer.size));
+
+    /* verify the header. */
+    TEST_EXPECT(PROTOCOL_REQ_ID_BATCH == req.request_id);
+    TEST_EXPECT(EXPECTED_OFFSET == req.offset);
+    TEST_ASSERT(2U == req.count);
+
+    /* each item holds the original request. */
+    TEST_ASSERT(requests[0].size == req.items[0].size);
+    TEST_EXPECT(
+        0 == memcmp(req.items[0].data, requests[0].data, requests[0].size));
+    TEST_ASSERT(requests[1].size == req.items[1].size);
+    TEST_EXPECT(
+        0 == memcmp(req.items[1].data, requests[1].data, requests[1].size));
+
+    /* each item can be decoded. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_decode_req_txn_get(
+                    &txn_req, req.items[0].data, req.items[0].size));
+    TEST_EXPECT(EXPECTED_TXN_OFFSET == txn_req.offset);
+    TEST_EXPECT(0 == memcmp(&txn_req.txn_id, &EXPECTED_TXN_ID, 16));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_decode_req_block_id_by_height_get(
+                    &height_req, req.items[1].data, req.items[1].size));
+    TEST_EXPECT(EXPECTED_HEIGHT_OFFSET == height_req.offset);
+    TEST_EXPECT(EXPECTED_HEIGHT == height_req.height);
+
+    /* clean up. */
+    dispose((disposable_t*)&txn_req);
+    dispose((disposable_t*)&height_req);
+    dispose((disposable_t*)&req);
+    dispose((disposable_t*)&buffer);
+    dispose((disposable_t*)&requests[0]);
+    dispose((disposable_t*)&requests[1]);
+    dispose((disposable_t*)&alloc_opts);
+}
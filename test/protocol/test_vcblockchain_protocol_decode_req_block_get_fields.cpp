@@ -0,0 +1,104 @@
+/**
+ * \file
+ * test/protocol/test_vcblockchain_protocol_decode_req_block_get_fields.cpp
+ *
+ * Unit tests for decoding the block get fields request.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_protocol_decode_req_block_get_fields);
+
+/**
+ * This method should perform null checks on its pointer parameters.
+ */
+TEST(parameter_checks)
+{
+    const uint8_t EXPECTED_PAYLOAD[4] = { 0x00, 0x01, 0x02, 0x03 };
+    protocol_req_block_get_fields req;
+
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_req_block_get_fields(
+                    nullptr, EXPECTED_PAYLOAD, sizeof(EXPECTED_PAYLOAD)));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_req_block_get_fields(
+                    &req, nullptr, sizeof(EXPECTED_PAYLOAD)));
+}
+
+/**
+ * This method should verify the payload size and field mask.
+ */
+TEST(payload_checks)
+{
+    const uint8_t SHORT_PAYLOAD[4] = { 0x00, 0x01, 0x02, 0x03 };
+    const uint8_t UNKNOWN_FIELD_PAYLOAD[28] = {
+        0x00, 0x00, 0x00, 0x08, /* request id. */
+        0x00, 0x00, 0x00, 0x01, /* offset. */
+        0xca, 0x14, 0x0d, 0x1e, 0x5b, 0xcf, 0x47, 0xa9,
+        0xab, 0xf7, 0xbc, 0xd8, 0xfa, 0xdb, 0x48, 0x27,
+        0x00, 0x00, 0x00, 0x20  /* unknown field. */ };
+    protocol_req_block_get_fields req;
+
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_req_block_get_fields(
+                    &req, SHORT_PAYLOAD, sizeof(SHORT_PAYLOAD)));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_req_block_get_fields(
+                    &req, UNKNOWN_FIELD_PAYLOAD,
+                    sizeof(UNKNOWN_FIELD_PAYLOAD)));
+}
+
+/**
+ * This method can decode a properly encoded request message.
+ */
+TEST(happy_path)
+{
+    const uint32_t EXPECTED_OFFSET = 97;
+    const uint32_t EXPECTED_MASK =
+        PROTOCOL_BLOCK_FIELD_PREV_BLOCK_ID | PROTOCOL_BLOCK_FIELD_FIRST_TXN_ID;
+    const vpr_uuid EXPECTED_BLOCK_ID = { .data = {
+        0xca, 0x14, 0x0d, 0x1e, 0x5b, 0xcf, 0x47, 0xa9,
+        0xab, 0xf7, 0xbc, 0xd8, 0xfa, 0xdb, 0x48, 0x27 }};
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+    protocol_req_block_get_fields req;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* we can encode this message. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_req_block_get_fields(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, &EXPECTED_BLOCK_ID,
+                    EXPECTED_MASK));
+
+    /* we can decode this message. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_decode_req_block_get_fields(
+                    &req, buffer.data, buffer.size));
+
+    /* the values are decoded correctly. */
+    TEST_EXPECT(PROTOCOL_REQ_ID_BLOCK_BY_ID_GET_FIELDS == req.request_id);
+    TEST_EXPECT(EXPECTED_OFFSET == req.offset);
+    TEST_EXPECT(0 == memcmp(&req.block_id, &EXPECTED_BLOCK_ID, 16));
+    TEST_EXPECT(EXPECTED_MASK == req.field_mask);
+
+    /* clean up. */
+    dispose((disposable_t*)&req);
+    dispose((disposable_t*)&buffer);
+    dispose((disposable_t*)&alloc_opts);
+}
@@ -0,0 +1,89 @@
+/**
+ * \file
+ * test/protocol/test_vcblockchain_protocol_decode_req_block_range_get.cpp
+ *
+ * Unit tests for decoding the block range get request.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_protocol_decode_req_block_range_get);
+
+/**
+ * This method should perform null checks on its pointer parameters.
+ */
+TEST(parameters)
+{
+    const uint8_t EXPECTED_PAYLOAD[24] = {
+        0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe8,
+        0x00, 0x00, 0x00, 0x32, 0x00, 0x01, 0x00, 0x00 };
+    protocol_req_block_range_get req;
+
+    /* This method performs null checks on pointer parameters. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_req_block_range_get(
+                    nullptr, EXPECTED_PAYLOAD, sizeof(EXPECTED_PAYLOAD)));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_req_block_range_get(
+                    &req, nullptr, sizeof(EXPECTED_PAYLOAD)));
+
+    /* the payload size must be exact. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_req_block_range_get(
+                    &req, EXPECTED_PAYLOAD, sizeof(EXPECTED_PAYLOAD) - 1));
+}
+
+/**
+ * This method can decode an encoded request.
+ */
+TEST(happy_path)
+{
+    const uint32_t EXPECTED_OFFSET = 97;
+    const uint64_t EXPECTED_START_HEIGHT = 1000;
+    const uint32_t EXPECTED_COUNT = 50;
+    const uint32_t EXPECTED_MAX_BYTES = 65536;
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+    protocol_req_block_range_get req;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* encode the request. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_req_block_range_get(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET,
+                    EXPECTED_START_HEIGHT, EXPECTED_COUNT,
+                    EXPECTED_MAX_BYTES));
+
+    /* decode the request. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_decode_req_block_range_get(
+                    &req, buffer.data, buffer.size));
+
+    /* the values should match. */
+    TEST_EXPECT(PROTOCOL_REQ_ID_BLOCK_RANGE_GET == req.request_id);
+    TEST_EXPECT(EXPECTED_OFFSET == req.offset);
+    TEST_EXPECT(EXPECTED_START_HEIGHT == req.start_height);
+    TEST_EXPECT(EXPECTED_COUNT == req.count);
+    TEST_EXPECT(EXPECTED_MAX_BYTES == req.max_bytes);
+
+    /* clean up. */
+    dispose((disposable_t*)&req);
+    dispose((disposable_t*)&buffer);
+    dispose((disposable_t*)&alloc_opts);
+}
@@ -0,0 +1,90 @@
+/**
+ * \file
+ * test/protocol/test_vcblockchain_protocol_decode_req_block_txn_ids_get.cpp
+ *
+ * Unit tests for decoding the block transaction ids get request.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_protocol_decode_req_block_txn_ids_get);
+
+/**
+ * This method should perform null checks on its pointer parameters.
+ */
+TEST(parameters)
+{
+    const uint8_t EXPECTED_PAYLOAD[28] = {
+        0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x01,
+        0x4c, 0x0e, 0x6b, 0x2f, 0x91, 0x3a, 0x4d, 0x57,
+        0xa8, 0x10, 0x3d, 0x62, 0xc5, 0x7e, 0x19, 0xb4,
+        0x00, 0x00, 0x00, 0x01 };
+    protocol_req_block_txn_ids_get req;
+
+    /* This method performs null checks on pointer parameters. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_req_block_txn_ids_get(
+                    nullptr, EXPECTED_PAYLOAD, sizeof(EXPECTED_PAYLOAD)));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_req_block_txn_ids_get(
+                    &req, nullptr, sizeof(EXPECTED_PAYLOAD)));
+
+    /* the payload size must be exact. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_req_block_txn_ids_get(
+                    &req, EXPECTED_PAYLOAD, sizeof(EXPECTED_PAYLOAD) - 1));
+}
+
+/**
+ * This method can decode an encoded request.
+ */
+TEST(happy_path)
+{
+    const uint32_t EXPECTED_OFFSET = 97;
+    const vpr_uuid EXPECTED_BLOCK_ID = { .data = {
+        0x4c, 0x0e, 0x6b, 0x2f, 0x91, 0x3a, 0x4d, 0x57,
+        0xa8, 0x10, 0x3d, 0x62, 0xc5, 0x7e, 0x19, 0xb4 } };
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+    protocol_req_block_txn_ids_get req;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* encode the request. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_req_block_txn_ids_get(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, &EXPECTED_BLOCK_ID,
+                    false));
+
+    /* decode the request. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_decode_req_block_txn_ids_get(
+                    &req, buffer.data, buffer.size));
+
+    /* the values should match. */
+    TEST_EXPECT(PROTOCOL_REQ_ID_BLOCK_TXN_IDS_GET == req.request_id);
+    TEST_EXPECT(EXPECTED_OFFSET == req.offset);
+    TEST_EXPECT(
+        0 == memcmp(
+                &req.block_id, &EXPECTED_BLOCK_ID, sizeof(EXPECTED_BLOCK_ID)));
+    TEST_EXPECT(!req.include_states);
+
+    /* clean up. */
+    dispose((disposable_t*)&req);
+    dispose((disposable_t*)&buffer);
+    dispose((disposable_t*)&alloc_opts);
+}
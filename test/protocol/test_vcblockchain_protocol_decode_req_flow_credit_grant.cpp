@@ -0,0 +1,63 @@
+/**
+ * \file test/protocol/test_vcblockchain_protocol_decode_req_flow_credit_grant.cpp
+ *
+ * Unit tests for decoding the flow credit grant request.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/data.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_protocol_decode_req_flow_credit_grant);
+
+/**
+ * An encoded request decodes to the same values.
+ */
+TEST(basics)
+{
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t out;
+    protocol_req_flow_credit_grant req;
+    const uint32_t EXPECTED_OFFSET = 23;
+    const uint32_t EXPECTED_REQUEST_CREDITS = 32;
+    const uint64_t EXPECTED_BYTE_CREDITS = 0x0000000100000002;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* encode the request. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_req_flow_credit_grant(
+                    &out, &alloc_opts, EXPECTED_OFFSET,
+                    EXPECTED_REQUEST_CREDITS, EXPECTED_BYTE_CREDITS));
+
+    /* a truncated request is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE
+            == vcblockchain_protocol_decode_req_flow_credit_grant(
+                    &req, out.data, out.size - 1));
+
+    /* decoding the request should succeed. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_decode_req_flow_credit_grant(
+                    &req, out.data, out.size));
+
+    /* the values should match. */
+    TEST_EXPECT(PROTOCOL_REQ_ID_FLOW_CREDIT_GRANT == req.request_id);
+    TEST_EXPECT(EXPECTED_OFFSET == req.offset);
+    TEST_EXPECT(EXPECTED_REQUEST_CREDITS == req.request_credits);
+    TEST_EXPECT(EXPECTED_BYTE_CREDITS == req.byte_credits);
+
+    /* clean up. */
+    dispose((disposable_t*)&req);
+    dispose((disposable_t*)&out);
+    dispose((disposable_t*)&alloc_opts);
+}
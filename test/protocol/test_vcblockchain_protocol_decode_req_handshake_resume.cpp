@@ -0,0 +1,103 @@
+/**
+ * \file
+ * test/protocol/test_vcblockchain_protocol_decode_req_handshake_resume.cpp
+ *
+ * Unit tests for decoding the handshake resume request.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/data.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_protocol_decode_req_handshake_resume);
+
+/**
+ * Test the basics of the decoding.
+ */
+TEST(basics)
+{
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t suite;
+    vpr_uuid client_id = { .data = {
+        0x0d, 0x7e, 0x42, 0x9c, 0x51, 0xa8, 0x4f, 0x3b,
+        0x86, 0x2e, 0xc9, 0x14, 0x70, 0xdb, 0x35, 0x6a } };
+    vccrypt_buffer_t client_key_nonce;
+    vccrypt_buffer_t ticket;
+    vccrypt_buffer_t out;
+    const uint32_t EXPECTED_OFFSET = 17;
+    protocol_req_handshake_resume req;
+
+    /* register the suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create the crypto suite. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_options_init(
+                    &suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1));
+
+    /* create a buffer for holding the key nonce. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_buffer_init_for_cipher_key_agreement_nonce(
+                    &suite, &client_key_nonce));
+    memset(client_key_nonce.data, 0xFE, client_key_nonce.size);
+
+    /* create the ticket. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_buffer_init(&ticket, &alloc_opts, 80));
+    memset(ticket.data, 0x7C, ticket.size);
+
+    /* encode the request. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_req_handshake_resume(
+                    &out, &suite, EXPECTED_OFFSET, &client_id,
+                    &client_key_nonce, &ticket));
+
+    /* a request truncated before the ticket can't be decoded. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE
+            == vcblockchain_protocol_decode_req_handshake_resume(
+                    &req, &suite, out.data, out.size - ticket.size));
+
+    /* decoding the request should succeed. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_decode_req_handshake_resume(
+                    &req, &suite, out.data, out.size));
+
+    /* the fields should match. */
+    TEST_EXPECT(PROTOCOL_REQ_ID_HANDSHAKE_RESUME == req.request_id);
+    TEST_EXPECT(EXPECTED_OFFSET == req.offset);
+    TEST_EXPECT(PROTOCOL_VERSION_0_3_RESUMPTION == req.protocol_version);
+    TEST_EXPECT(VCCRYPT_SUITE_VELO_V1 == req.crypto_suite);
+    TEST_EXPECT(0 == memcmp(&client_id, &req.client_id, sizeof(client_id)));
+    TEST_ASSERT(client_key_nonce.size == req.client_key_nonce.size);
+    TEST_EXPECT(
+        0
+            == memcmp(
+                    client_key_nonce.data, req.client_key_nonce.data,
+                    client_key_nonce.size));
+    TEST_ASSERT(ticket.size == req.ticket.size);
+    TEST_EXPECT(0 == memcmp(ticket.data, req.ticket.data, ticket.size));
+
+    /* clean up. */
+    dispose((disposable_t*)&req);
+    dispose((disposable_t*)&out);
+    dispose((disposable_t*)&ticket);
+    dispose((disposable_t*)&client_key_nonce);
+    dispose((disposable_t*)&suite);
+    dispose((disposable_t*)&alloc_opts);
+}
@@ -0,0 +1,97 @@
+/**
+ * \file
+ * test/protocol/test_vcblockchain_protocol_decode_req_latest_block_id_get_if_changed.cpp
+ *
+ * Unit tests for decoding the conditional latest block id get request.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_protocol_decode_req_latest_block_id_get_if_changed);
+
+/**
+ * This method should perform null checks on its pointer parameters.
+ */
+TEST(parameter_check)
+{
+    const uint8_t EXPECTED_PAYLOAD[4] = { 0x00, 0x01, 0x02, 0x03 };
+    size_t EXPECTED_PAYLOAD_SIZE = sizeof(EXPECTED_PAYLOAD);
+    protocol_req_latest_block_id_get_if_changed req;
+
+    /* This method performs null checks on pointer parameters. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_req_latest_block_id_get_if_changed(
+                    nullptr, EXPECTED_PAYLOAD, EXPECTED_PAYLOAD_SIZE));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_req_latest_block_id_get_if_changed(
+                    &req, nullptr, EXPECTED_PAYLOAD_SIZE));
+}
+
+/**
+ * This method checks the payload size.
+ */
+TEST(payload_size)
+{
+    const uint8_t EXPECTED_PAYLOAD[4] = { 0x00, 0x01, 0x02, 0x03 };
+    size_t EXPECTED_PAYLOAD_SIZE = sizeof(EXPECTED_PAYLOAD);
+    protocol_req_latest_block_id_get_if_changed req;
+
+    /* a truncated request is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_req_latest_block_id_get_if_changed(
+                    &req, EXPECTED_PAYLOAD, EXPECTED_PAYLOAD_SIZE));
+}
+
+/**
+ * This method can decode a properly encoded request message.
+ */
+TEST(happy_path)
+{
+    const uint32_t EXPECTED_OFFSET = 23;
+    const uint32_t EXPECTED_TIMEOUT = 2500;
+    const vpr_uuid EXPECTED_BLOCK_ID = { .data = {
+        0x8d, 0x79, 0x40, 0xfb, 0xe9, 0x4c, 0x45, 0xf0,
+        0x93, 0x28, 0x95, 0x09, 0x8c, 0xae, 0xa7, 0xf6 } };
+    allocator_options_t alloc_opts;
+    protocol_req_latest_block_id_get_if_changed req;
+    vccrypt_buffer_t buffer;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* we can encode a message. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_req_latest_block_id_get_if_changed(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, EXPECTED_TIMEOUT,
+                    &EXPECTED_BLOCK_ID));
+
+    /* we can decode this message. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_decode_req_latest_block_id_get_if_changed(
+                    &req, buffer.data, buffer.size));
+
+    /* the values are set correctly. */
+    TEST_EXPECT(
+        PROTOCOL_REQ_ID_LATEST_BLOCK_ID_GET_IF_CHANGED == req.request_id);
+    TEST_EXPECT(EXPECTED_OFFSET == req.offset);
+    TEST_EXPECT(EXPECTED_TIMEOUT == req.timeout_ms);
+    TEST_EXPECT(0 == memcmp(&req.block_id, &EXPECTED_BLOCK_ID, 16));
+
+    /* clean up. */
+    dispose((disposable_t*)&req);
+    dispose((disposable_t*)&buffer);
+    dispose((disposable_t*)&alloc_opts);
+}
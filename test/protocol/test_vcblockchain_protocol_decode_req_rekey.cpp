@@ -0,0 +1,89 @@
+/**
+ * \file test/protocol/test_vcblockchain_protocol_decode_req_rekey.cpp
+ *
+ * Unit tests for decoding the rekey request.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/data.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_protocol_decode_req_rekey);
+
+/**
+ * An encoded request decodes to the same values, and a truncated request is
+ * rejected.
+ */
+TEST(basics)
+{
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t suite;
+    vccrypt_buffer_t client_key_nonce;
+    vccrypt_buffer_t out;
+    protocol_req_rekey req;
+    const uint32_t EXPECTED_OFFSET = 23;
+    const uint64_t EXPECTED_CLIENT_SWITCH_IV = 0x0000000100000002;
+
+    /* register the suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create the crypto suite. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_options_init(
+                    &suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1));
+
+    /* create a buffer for holding the key nonce. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_buffer_init_for_cipher_key_agreement_nonce(
+                    &suite, &client_key_nonce));
+    memset(client_key_nonce.data, 0xC3, client_key_nonce.size);
+
+    /* encode the request. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_req_rekey(
+                    &out, &suite, EXPECTED_OFFSET, EXPECTED_CLIENT_SWITCH_IV,
+                    &client_key_nonce));
+
+    /* a truncated request is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE
+            == vcblockchain_protocol_decode_req_rekey(
+                    &req, &suite, out.data, out.size - 1));
+
+    /* decoding the request should succeed. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_decode_req_rekey(
+                    &req, &suite, out.data, out.size));
+
+    /* the values should match. */
+    TEST_EXPECT(PROTOCOL_REQ_ID_REKEY == req.request_id);
+    TEST_EXPECT(EXPECTED_OFFSET == req.offset);
+    TEST_EXPECT(EXPECTED_CLIENT_SWITCH_IV == req.client_switch_iv);
+    TEST_ASSERT(client_key_nonce.size == req.client_key_nonce.size);
+    TEST_EXPECT(
+        0
+            == memcmp(
+                    client_key_nonce.data, req.client_key_nonce.data,
+                    client_key_nonce.size));
+
+    /* clean up. */
+    dispose((disposable_t*)&req);
+    dispose((disposable_t*)&out);
+    dispose((disposable_t*)&client_key_nonce);
+    dispose((disposable_t*)&suite);
+    dispose((disposable_t*)&alloc_opts);
+}
@@ -0,0 +1,185 @@
+/**
+ * \file
+ * test/protocol/test_vcblockchain_protocol_decode_req_transaction_submit_batch.cpp
+ *
+ * Unit tests for decoding the transaction submit batch request.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_protocol_decode_req_transaction_submit_batch);
+
+/**
+ * This method should perform null checks on its pointer parameters.
+ */
+TEST(parameters)
+{
+    const uint8_t EXPECTED_PAYLOAD[4] = { 0x00, 0x01, 0x02, 0x03 };
+    size_t EXPECTED_PAYLOAD_SIZE = sizeof(EXPECTED_PAYLOAD);
+    allocator_options_t alloc_opts;
+    protocol_req_transaction_submit_batch req;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* This method performs null checks on pointer parameters. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_req_transaction_submit_batch(
+                    nullptr, &alloc_opts, EXPECTED_PAYLOAD,
+                    EXPECTED_PAYLOAD_SIZE));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_req_transaction_submit_batch(
+                    &req, nullptr, EXPECTED_PAYLOAD, EXPECTED_PAYLOAD_SIZE));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_req_transaction_submit_batch(
+                    &req, &alloc_opts, nullptr, EXPECTED_PAYLOAD_SIZE));
+
+    /* a truncated header is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_req_transaction_submit_batch(
+                    &req, &alloc_opts, EXPECTED_PAYLOAD,
+                    EXPECTED_PAYLOAD_SIZE));
+
+    /* clean up. */
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * This method should verify each transaction against the payload.
+ */
+TEST(payload_size)
+{
+    const uint8_t PAYLOAD[50] = {
+        0x00, 0x00, 0x00, 0x18, /* request id. */
+        0x00, 0x00, 0x00, 0x01, /* offset. */
+        0x00, 0x00, 0x00, 0x01, /* count. */
+        0x00, 0x00, 0x00, 0x02, /* cert size. */
+        0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+        0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, /* txn id. */
+        0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+        0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, /* artifact id. */
+        0x01, 0x02 /* cert. */ };
+    const uint8_t EMPTY_PAYLOAD[12] = {
+        0x00, 0x00, 0x00, 0x18, /* request id. */
+        0x00, 0x00, 0x00, 0x01, /* offset. */
+        0x00, 0x00, 0x00, 0x00 /* count. */ };
+    allocator_options_t alloc_opts;
+    protocol_req_transaction_submit_batch req;
+    uint8_t trailing[sizeof(PAYLOAD) + 1];
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* an empty batch is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_req_transaction_submit_batch(
+                    &req, &alloc_opts, EMPTY_PAYLOAD, sizeof(EMPTY_PAYLOAD)));
+
+    /* a truncated certificate is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_req_transaction_submit_batch(
+                    &req, &alloc_opts, PAYLOAD, sizeof(PAYLOAD) - 1));
+
+    /* a truncated record header is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_req_transaction_submit_batch(
+                    &req, &alloc_opts, PAYLOAD, 20));
+
+    /* trailing data is rejected. */
+    memcpy(trailing, PAYLOAD, sizeof(PAYLOAD));
+    trailing[sizeof(PAYLOAD)] = 0x00;
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_req_transaction_submit_batch(
+                    &req, &alloc_opts, trailing, sizeof(trailing)));
+
+    /* the complete payload is decoded. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_decode_req_transaction_submit_batch(
+                    &req, &alloc_opts, PAYLOAD, sizeof(PAYLOAD)));
+    TEST_ASSERT(1U == req.count);
+    TEST_ASSERT(2U == req.items[0].cert_size);
+    TEST_EXPECT(0 == memcmp(req.items[0].cert, PAYLOAD + 48, 2));
+    dispose((disposable_t*)&req);
+
+    /* clean up. */
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * This method can decode an encoded request.
+ */
+TEST(happy_path)
+{
+    const uint32_t EXPECTED_OFFSET = 97;
+    const uint8_t CERT1[3] = { 0x01, 0x02, 0x03 };
+    const uint8_t CERT2[2] = { 0x04, 0x05 };
+    protocol_transaction_submit_batch_item txns[2];
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+    protocol_req_transaction_submit_batch req;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* set up the transactions. */
+    memset(txns, 0, sizeof(txns));
+    memset(&txns[0].txn_id, 0x11, sizeof(txns[0].txn_id));
+    memset(&txns[0].artifact_id, 0x12, sizeof(txns[0].artifact_id));
+    txns[0].cert = CERT1;
+    txns[0].cert_size = sizeof(CERT1);
+    memset(&txns[1].txn_id, 0x21, sizeof(txns[1].txn_id));
+    memset(&txns[1].artifact_id, 0x22, sizeof(txns[1].artifact_id));
+    txns[1].cert = CERT2;
+    txns[1].cert_size = sizeof(CERT2);
+
+    /* encode the request. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_req_transaction_submit_batch(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, txns, 2));
+
+    /* decode the request. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_decode_req_transaction_submit_batch(
+                    &req, &alloc_opts, buffer.data, buffer.size));
+
+    /* the header values should match. */
+    TEST_EXPECT(PROTOCOL_REQ_ID_TRANSACTION_SUBMIT_BATCH == req.request_id);
+    TEST_EXPECT(EXPECTED_OFFSET == req.offset);
+    TEST_ASSERT(2U == req.count);
+
+    /* each transaction should match. */
+    for (int i = 0; i < 2; ++i)
+    {
+        TEST_EXPECT(
+            0 == memcmp(&req.items[i].txn_id, &txns[i].txn_id, 16));
+        TEST_EXPECT(
+            0 == memcmp(&req.items[i].artifact_id, &txns[i].artifact_id, 16));
+        TEST_ASSERT(txns[i].cert_size == req.items[i].cert_size);
+        TEST_EXPECT(
+            0 == memcmp(req.items[i].cert, txns[i].cert, txns[i].cert_size));
+    }
+
+    /* clean up. */
+    dispose((disposable_t*)&req);
+    dispose((disposable_t*)&buffer);
+    dispose((disposable_t*)&alloc_opts);
+}
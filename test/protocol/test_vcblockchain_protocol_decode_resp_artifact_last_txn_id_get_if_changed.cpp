@@ -0,0 +1,167 @@
+/**
+ * \file
+ * test/protocol/test_vcblockchain_protocol_decode_resp_artifact_last_txn_id_get_if_changed.cpp
+ *
+ * Unit tests for decoding the conditional artifact last txn id get response.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_protocol_decode_resp_artifact_last_txn_id_get_if_changed);
+
+/**
+ * This method should perform null checks on its pointer parameters.
+ */
+TEST(parameters)
+{
+    const uint8_t EXPECTED_PAYLOAD[4] = { 0x00, 0x01, 0x02, 0x03 };
+    size_t EXPECTED_PAYLOAD_SIZE = sizeof(EXPECTED_PAYLOAD);
+    protocol_resp_artifact_last_txn_id_get_if_changed resp;
+
+    /* This method performs null checks on pointer parameters. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_resp_artifact_last_txn_id_get_if_changed(
+                    nullptr, EXPECTED_PAYLOAD, EXPECTED_PAYLOAD_SIZE));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_resp_artifact_last_txn_id_get_if_changed(
+                    &resp, nullptr, EXPECTED_PAYLOAD_SIZE));
+}
+
+/**
+ * This method should check the payload size against the status.
+ */
+TEST(payload_size)
+{
+    const uint8_t EXPECTED_PAYLOAD[4] = { 0x00, 0x01, 0x02, 0x03 };
+    size_t EXPECTED_PAYLOAD_SIZE = sizeof(EXPECTED_PAYLOAD);
+    const uint32_t EXPECTED_OFFSET = 12;
+    allocator_options_t alloc_opts;
+    protocol_resp_artifact_last_txn_id_get_if_changed resp;
+    vccrypt_buffer_t buffer;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* a truncated header is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE
+            == vcblockchain_protocol_decode_resp_artifact_last_txn_id_get_if_changed(
+                    &resp, EXPECTED_PAYLOAD, EXPECTED_PAYLOAD_SIZE));
+
+    /* encode a not modified response. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_resp_artifact_last_txn_id_get_if_changed(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET,
+                    VCBLOCKCHAIN_ERROR_PROTOCOL_NOT_MODIFIED, nullptr));
+
+    /* a not modified response with a trailing last txn id is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE
+            == vcblockchain_protocol_decode_resp_artifact_last_txn_id_get_if_changed(
+                    &resp, buffer.data, buffer.size + 16));
+
+    /* clean up. */
+    dispose((disposable_t*)&buffer);
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * This method can decode a changed last txn id.
+ */
+TEST(happy_path)
+{
+    const uint32_t EXPECTED_OFFSET = 12;
+    const vpr_uuid EXPECTED_LAST_TXN_ID = { .data = {
+        0x79, 0x40, 0xfb, 0x8d, 0xe9, 0x4c, 0x45, 0xf0,
+        0x93, 0x28, 0x95, 0x09, 0x8c, 0xae, 0xa7, 0xf6 } };
+    allocator_options_t alloc_opts;
+    protocol_resp_artifact_last_txn_id_get_if_changed resp;
+    vccrypt_buffer_t buffer;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* we can encode a message. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_resp_artifact_last_txn_id_get_if_changed(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET,
+                    VCBLOCKCHAIN_STATUS_SUCCESS, &EXPECTED_LAST_TXN_ID));
+
+    /* a changed response without its last txn id is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE
+            == vcblockchain_protocol_decode_resp_artifact_last_txn_id_get_if_changed(
+                    &resp, buffer.data, buffer.size - 16));
+
+    /* we can decode this message. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_decode_resp_artifact_last_txn_id_get_if_changed(
+                    &resp, buffer.data, buffer.size));
+
+    /* the values are set correctly. */
+    TEST_EXPECT(
+        PROTOCOL_REQ_ID_ARTIFACT_LAST_TXN_BY_ID_GET_IF_CHANGED
+            == resp.request_id);
+    TEST_EXPECT(EXPECTED_OFFSET == resp.offset);
+    TEST_EXPECT(VCBLOCKCHAIN_STATUS_SUCCESS == resp.status);
+    TEST_EXPECT(0 == memcmp(&resp.last_txn_id, &EXPECTED_LAST_TXN_ID, 16));
+
+    /* clean up. */
+    dispose((disposable_t*)&buffer);
+    dispose((disposable_t*)&resp);
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * This method can decode a not modified response.
+ */
+TEST(not_modified)
+{
+    const uint32_t EXPECTED_OFFSET = 12;
+    const vpr_uuid ZERO_ID = { .data = { 0 } };
+    allocator_options_t alloc_opts;
+    protocol_resp_artifact_last_txn_id_get_if_changed resp;
+    vccrypt_buffer_t buffer;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* we can encode a message. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_resp_artifact_last_txn_id_get_if_changed(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET,
+                    VCBLOCKCHAIN_ERROR_PROTOCOL_NOT_MODIFIED, nullptr));
+
+    /* we can decode this message. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_decode_resp_artifact_last_txn_id_get_if_changed(
+                    &resp, buffer.data, buffer.size));
+
+    /* the values are set correctly. */
+    TEST_EXPECT(
+        PROTOCOL_REQ_ID_ARTIFACT_LAST_TXN_BY_ID_GET_IF_CHANGED
+            == resp.request_id);
+    TEST_EXPECT(EXPECTED_OFFSET == resp.offset);
+    TEST_EXPECT(VCBLOCKCHAIN_ERROR_PROTOCOL_NOT_MODIFIED == resp.status);
+    TEST_EXPECT(0 == memcmp(&resp.last_txn_id, &ZERO_ID, 16));
+
+    /* clean up. */
+    dispose((disposable_t*)&buffer);
+    dispose((disposable_t*)&resp);
+    dispose((disposable_t*)&alloc_opts);
+}
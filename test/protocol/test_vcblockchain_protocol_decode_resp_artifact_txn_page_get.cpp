@@ -0,0 +1,256 @@
+/**
+ * \file
+ * test/protocol/test_vcblockchain_protocol_decode_resp_artifact_txn_page_get.cpp
+ *
+ * Unit tests for decoding the artifact transaction page get response.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_protocol_decode_resp_artifact_txn_page_get);
+
+/**
+ * This method should perform null checks on its pointer parameters.
+ */
+TEST(parameters)
+{
+    const uint8_t EXPECTED_PAYLOAD[4] = { 0x00, 0x01, 0x02, 0x03 };
+    size_t EXPECTED_PAYLOAD_SIZE = sizeof(EXPECTED_PAYLOAD);
+    allocator_options_t alloc_opts;
+    protocol_resp_artifact_txn_page_get resp;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* This method performs null checks on pointer parameters. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_resp_artifact_txn_page_get(
+                    nullptr, &alloc_opts, EXPECTED_PAYLOAD,
+                    EXPECTED_PAYLOAD_SIZE));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_resp_artifact_txn_page_get(
+                    &resp, nullptr, EXPECTED_PAYLOAD, EXPECTED_PAYLOAD_SIZE));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_resp_artifact_txn_page_get(
+                    &resp, &alloc_opts, nullptr, EXPECTED_PAYLOAD_SIZE));
+
+    /* a truncated header is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE
+            == vcblockchain_protocol_decode_resp_artifact_txn_page_get(
+                    &resp, &alloc_opts, EXPECTED_PAYLOAD,
+                    EXPECTED_PAYLOAD_SIZE));
+
+    /* clean up. */
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * This method should verify each record size against the payload.
+ */
+TEST(payload_size)
+{
+    uint8_t payload[44];
+    allocator_options_t alloc_opts;
+    protocol_resp_artifact_txn_page_get resp;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* a page holding one record, which is too small. */
+    memset(payload, 0, sizeof(payload));
+    payload[3] = 0x22; /* request id. */
+    payload[35] = 0x01; /* count. */
+    payload[39] = 0x04; /* record size. */
+
+    /* a record that is too small is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE
+            == vcblockchain_protocol_decode_resp_artifact_txn_page_get(
+                    &resp, &alloc_opts, payload, sizeof(payload)));
+
+    /* a record that runs past the payload is rejected. */
+    payload[39] = 0x5c;
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE
+            == vcblockchain_protocol_decode_resp_artifact_txn_page_get(
+                    &resp, &alloc_opts, payload, sizeof(payload)));
+
+    /* an empty page with trailing data is rejected. */
+    payload[35] = 0x00;
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE
+            == vcblockchain_protocol_decode_resp_artifact_txn_page_get(
+                    &resp, &alloc_opts, payload, sizeof(payload)));
+
+    /* without the trailing data, the empty page is decoded. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_decode_resp_artifact_txn_page_get(
+                    &resp, &alloc_opts, payload, 36));
+    TEST_EXPECT(0U == resp.count);
+    TEST_EXPECT(nullptr == resp.records);
+    dispose((disposable_t*)&resp);
+
+    /* clean up. */
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * This method rejects a response to a different request.
+ */
+TEST(request_id)
+{
+    uint8_t payload[36];
+    allocator_options_t alloc_opts;
+    protocol_resp_artifact_txn_page_get resp;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* an empty page for the wrong request id. */
+    memset(payload, 0, sizeof(payload));
+    payload[3] = 0x23; /* request id. */
+
+    /* the wrong request id is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE
+            == vcblockchain_protocol_decode_resp_artifact_txn_page_get(
+                    &resp, &alloc_opts, payload, sizeof(payload)));
+
+    /* clean up. */
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * This method returns the status of an error response, which only holds a
+ * header.
+ */
+TEST(error_status)
+{
+    const uint32_t EXPECTED_OFFSET = 97;
+    const uint32_t EXPECTED_STATUS = 77;
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+    protocol_resp_artifact_txn_page_get resp;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* encode an error response. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_error_resp(
+                    &buffer, &alloc_opts,
+                    PROTOCOL_REQ_ID_ARTIFACT_TXN_PAGE_GET, EXPECTED_OFFSET,
+                    EXPECTED_STATUS));
+
+    /* the status from the response is returned. */
+    TEST_EXPECT(
+        (int)EXPECTED_STATUS
+            == vcblockchain_protocol_decode_resp_artifact_txn_page_get(
+                    &resp, &alloc_opts, buffer.data, buffer.size));
+
+    /* clean up. */
+    dispose((disposable_t*)&buffer);
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * This method can decode an encoded page with several transactions.
+ */
+TEST(happy_path)
+{
+    const uint32_t EXPECTED_OFFSET = 97;
+    const uint32_t EXPECTED_STATUS = VCBLOCKCHAIN_STATUS_SUCCESS;
+    const uint32_t EXPECTED_FLAGS = PROTOCOL_TXN_PAGE_FLAG_MORE;
+    const uint8_t TXN_CERT[5] = { 0x01, 0x02, 0x03, 0x04, 0x05 };
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+    protocol_txn_page_record records[2];
+    protocol_resp_artifact_txn_page_get resp;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* set up the records. */
+    memset(records, 0, sizeof(records));
+    for (int i = 0; i < 2; ++i)
+    {
+        memset(&records[i].txn_id, 0x11 + i, 16);
+        memset(&records[i].prev_txn_id, 0x21 + i, 16);
+        memset(&records[i].next_txn_id, 0x31 + i, 16);
+        memset(&records[i].artifact_id, 0x41, 16);
+        memset(&records[i].block_id, 0x51 + i, 16);
+        records[i].txn_state = 0x09 + i;
+    }
+    records[0].txn_size = sizeof(TXN_CERT);
+    records[0].txn_cert = TXN_CERT;
+    records[0].txn_cert_size = sizeof(TXN_CERT);
+
+    /* encode the response. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_resp_artifact_txn_page_get(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, EXPECTED_STATUS,
+                    EXPECTED_FLAGS, &records[1].txn_id, records, 2));
+
+    /* decode the response. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_decode_resp_artifact_txn_page_get(
+                    &resp, &alloc_opts, buffer.data, buffer.size));
+
+    /* verify the header. */
+    TEST_EXPECT(PROTOCOL_REQ_ID_ARTIFACT_TXN_PAGE_GET == resp.request_id);
+    TEST_EXPECT(EXPECTED_STATUS == resp.status);
+    TEST_EXPECT(EXPECTED_OFFSET == resp.offset);
+    TEST_EXPECT(EXPECTED_FLAGS == resp.flags);
+    TEST_EXPECT(0 == memcmp(&resp.next_cursor, &records[1].txn_id, 16));
+    TEST_ASSERT(2U == resp.count);
+
+    /* verify each record. */
+    for (int i = 0; i < 2; ++i)
+    {
+        TEST_EXPECT(
+            0 == memcmp(&resp.records[i].txn_id, &records[i].txn_id, 16));
+        TEST_EXPECT(
+            0 == memcmp(
+                    &resp.records[i].prev_txn_id, &records[i].prev_txn_id,
+                    16));
+        TEST_EXPECT(
+            0 == memcmp(
+                    &resp.records[i].next_txn_id, &records[i].next_txn_id,
+                    16));
+        TEST_EXPECT(
+            0 == memcmp(
+                    &resp.records[i].artifact_id, &records[i].artifact_id,
+                    16));
+        TEST_EXPECT(
+            0 == memcmp(&resp.records[i].block_id, &records[i].block_id, 16));
+        TEST_EXPECT(records[i].txn_state == resp.records[i].txn_state);
+        TEST_EXPECT(records[i].txn_size == resp.records[i].txn_size);
+    }
+
+    /* the first transaction has a certificate, and the second does not. */
+    TEST_ASSERT(sizeof(TXN_CERT) == resp.records[0].txn_cert_size);
+    TEST_EXPECT(
+        0 == memcmp(resp.records[0].txn_cert, TXN_CERT, sizeof(TXN_CERT)));
+    TEST_EXPECT(0U == resp.records[1].txn_cert_size);
+
+    /* clean up. */
+    dispose((disposable_t*)&resp);
+    dispose((disposable_t*)&buffer);
+    dispose((disposable_t*)&alloc_opts);
+}
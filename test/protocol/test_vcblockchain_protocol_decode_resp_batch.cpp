@@ -0,0 +1,206 @@
+/**
+ * \file test/protocol/test_vcblockchain_protocol_decode_resp_batch.cpp
+ *
+ * Unit tests for decoding the batch response.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_protocol_decode_resp_batch);
+
+/**
+ * This method should perform null checks on its pointer parameters.
+ */
+TEST(parameters)
+{
+    const uint8_t EXPECTED_PAYLOAD[4] = { 0x00, 0x01, 0x02, 0x03 };
+    size_t EXPECTED_PAYLOAD_SIZE = sizeof(EXPECTED_PAYLOAD);
+    allocator_options_t alloc_opts;
+    protocol_resp_batch resp;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* This method performs null checks on pointer parameters. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_resp_batch(
+                    nullptr, &alloc_opts, EXPECTED_PAYLOAD,
+                    EXPECTED_PAYLOAD_SIZE));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_resp_batch(
+                    &resp, nullptr, EXPECTED_PAYLOAD, EXPECTED_PAYLOAD_SIZE));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_resp_batch(
+                    &resp, &alloc_opts, nullptr, EXPECTED_PAYLOAD_SIZE));
+
+    /* clean up. */
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * This method should verify the status vector and each size prefix against
+ * the payload.
+ */
+TEST(payload_size)
+{
+    const uint8_t PAYLOAD[28] = {
+        0x00, 0x00, 0x00, 0x40, /* request id. */
+        0x00, 0x00, 0x00, 0x00, /* status. */
+        0x00, 0x00, 0x00, 0x01, /* offset. */
+        0x00, 0x00, 0x00, 0x01, /* count. */
+        0x00, 0x00, 0x00, 0x00, /* item status. */
+        0x00, 0x00, 0x00, 0x04, /* size. */
+        0x00, 0x00, 0x00, 0x02 };
+    uint8_t TRAILING_PAYLOAD[sizeof(PAYLOAD) + 1];
+    allocator_options_t alloc_opts;
+    protocol_resp_batch resp;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* a truncated header is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_resp_batch(
+                    &resp, &alloc_opts, PAYLOAD, 12));
+
+    /* a truncated status vector is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_resp_batch(
+                    &resp, &alloc_opts, PAYLOAD, 18));
+
+    /* a truncated response is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_resp_batch(
+                    &resp, &alloc_opts, PAYLOAD, sizeof(PAYLOAD) - 1));
+
+    /* trailing data is rejected. */
+    memcpy(TRAILING_PAYLOAD, PAYLOAD, sizeof(PAYLOAD));
+    TRAILING_PAYLOAD[sizeof(PAYLOAD)] = 0x00;
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_resp_batch(
+                    &resp, &alloc_opts, TRAILING_PAYLOAD,
+                    sizeof(TRAILING_PAYLOAD)));
+
+    /* clean up. */
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * A failed batch can be returned without any responses.
+ */
+TEST(empty_batch)
+{
+    const uint8_t PAYLOAD[16] = {
+        0x00, 0x00, 0x00, 0x40, /* request id. */
+        0x00, 0x00, 0x00, 0x02, /* status. */
+        0x00, 0x00, 0x00, 0x01, /* offset. */
+        0x00, 0x00, 0x00, 0x00 /* count. */ };
+    allocator_options_t alloc_opts;
+    protocol_resp_batch resp;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* decoding the empty batch succeeds. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_decode_resp_batch(
+                    &resp, &alloc_opts, PAYLOAD, sizeof(PAYLOAD)));
+
+    /* verify the header. */
+    TEST_EXPECT(PROTOCOL_REQ_ID_BATCH == resp.request_id);
+    TEST_EXPECT(2U == resp.status);
+    TEST_EXPECT(1U == resp.offset);
+    TEST_EXPECT(0U == resp.count);
+    TEST_EXPECT(nullptr == resp.items);
+
+    /* clean up. */
+    dispose((disposable_t*)&resp);
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * This method can decode an encoded batch and each response in it.
+ */
+TEST(happy_path)
+{
+    const uint32_t EXPECTED_OFFSET = 97;
+    const uint32_t EXPECTED_STATUS = VCBLOCKCHAIN_STATUS_SUCCESS;
+    const uint32_t EXPECTED_HEIGHT_OFFSET = 99;
+    const uint32_t EXPECTED_ITEM_STATUS = 0x8001;
+    const uint32_t STATUSES[2] = {
+        EXPECTED_ITEM_STATUS, VCBLOCKCHAIN_STATUS_SUCCESS };
+    const vpr_uuid EXPECTED_BLOCK_ID = { .data = {
+        0xca, 0x14, 0x0d, 0x1e, 0x5b, 0xcf, 0x47, 0xa9,
+        0xab, 0xf7, 0xbc, 0xd8, 0xfa, 0xdb, 0x48, 0x27 }};
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+    vccrypt_buffer_t responses[2];
+    protocol_resp_batch resp;
+    protocol_resp_block_id_by_height_get height_resp;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* encode the batch. */
+    responses[0].data = nullptr;
+    responses[0].size = 0;
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_resp_block_id_by_height_get(
+                    &responses[1], &alloc_opts, EXPECTED_HEIGHT_OFFSET,
+                    VCBLOCKCHAIN_STATUS_SUCCESS, &EXPECTED_BLOCK_ID));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_resp_batch(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, EXPECTED_STATUS,
+                    STATUSES, responses, 2));
+
+    /* decode the batch. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_decode_resp_batch(
+                    &resp, &alloc_opts, buffer.data, buffer.size));
+
+    /* verify the header. */
+    TEST_EXPECT(PROTOCOL_REQ_ID_BATCH == resp.request_id);
+    TEST_EXPECT(EXPECTED_STATUS == resp.status);
+    TEST_EXPECT(EXPECTED_OFFSET == resp.offset);
+    TEST_ASSERT(2U == resp.count);
+
+    /* the first request failed with an empty response. */
+    TEST_EXPECT(EXPECTED_ITEM_STATUS == resp.items[0].status);
+    TEST_EXPECT(0U == resp.items[0].size);
+
+    /* the second response can be decoded. */
+    TEST_EXPECT(VCBLOCKCHAIN_STATUS_SUCCESS == resp.items[1].status);
+    TEST_ASSERT(responses[1].size == resp.items[1].size);
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_decode_resp_block_id_by_height_get(
+                    &height_resp, resp.items[1].data, resp.items[1].size));
+    TEST_EXPECT(EXPECTED_HEIGHT_OFFSET == height_resp.offset);
+    TEST_EXPECT(0 == memcmp(&height_resp.block_id, &EXPECTED_BLOCK_ID, 16));
+
+    /* clean up. */
+    dispose((disposable_t*)&height_resp);
+    dispose((disposable_t*)&resp);
+    dispose((disposable_t*)&buffer);
+    dispose((disposable_t*)&responses[1]);
+    dispose((disposable_t*)&alloc_opts);
+}
@@ -0,0 +1,185 @@
+/**
+ * \file
+ * test/protocol/test_vcblockchain_protocol_decode_resp_block_get_fields.cpp
+ *
+ * Unit tests for decoding the block get fields response.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_protocol_decode_resp_block_get_fields);
+
+/**
+ * This method should perform null checks on its pointer parameters.
+ */
+TEST(parameters)
+{
+    const uint8_t EXPECTED_PAYLOAD[4] = { 0x00, 0x01, 0x02, 0x03 };
+    size_t EXPECTED_PAYLOAD_SIZE = sizeof(EXPECTED_PAYLOAD);
+    allocator_options_t alloc_opts;
+    protocol_resp_block_get_fields resp;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* This method performs null checks on pointer parameters. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_resp_block_get_fields(
+                    nullptr, &alloc_opts, EXPECTED_PAYLOAD,
+                    EXPECTED_PAYLOAD_SIZE));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_resp_block_get_fields(
+                    &resp, nullptr, EXPECTED_PAYLOAD, EXPECTED_PAYLOAD_SIZE));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_resp_block_get_fields(
+                    &resp, &alloc_opts, nullptr, EXPECTED_PAYLOAD_SIZE));
+
+    /* a truncated header is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_resp_block_get_fields(
+                    &resp, &alloc_opts, EXPECTED_PAYLOAD,
+                    EXPECTED_PAYLOAD_SIZE));
+
+    /* clean up. */
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * This method can decode a response with every field.
+ */
+TEST(happy_path)
+{
+    const uint32_t EXPECTED_OFFSET = 52;
+    const uint32_t EXPECTED_STATUS = 98;
+    const vpr_uuid EXPECTED_BLOCK_ID = { .data = {
+        0x26, 0x49, 0xc3, 0xf4, 0xc6, 0x11, 0x4f, 0x0e,
+        0x95, 0xe6, 0x24, 0xd4, 0x12, 0xfc, 0x7c, 0x83 } };
+    const vpr_uuid EXPECTED_PREV_BLOCK_ID = { .data = {
+        0xb6, 0xdf, 0x4b, 0xca, 0x3f, 0x9d, 0x43, 0x7c,
+        0x92, 0xe6, 0x9f, 0x1e, 0x61, 0xc2, 0xda, 0xe9 } };
+    const vpr_uuid EXPECTED_NEXT_BLOCK_ID = { .data = {
+        0x61, 0x77, 0x07, 0xc2, 0x10, 0x7c, 0x4b, 0xb6,
+        0x9d, 0x35, 0xa0, 0xf0, 0xde, 0xab, 0x71, 0x05 } };
+    const vpr_uuid EXPECTED_FIRST_TXN_ID = { .data = {
+        0x8f, 0x06, 0xc1, 0xce, 0xea, 0x0c, 0x4f, 0x77,
+        0x92, 0xf1, 0x28, 0x86, 0x61, 0xa9, 0x41, 0x78 } };
+    const uint64_t EXPECTED_HEIGHT = 76;
+    const uint8_t EXPECTED_BLOCK_CERT[4] = { 0x01, 0x02, 0x03, 0x04 };
+    allocator_options_t alloc_opts;
+    protocol_resp_block_get_fields resp;
+    vccrypt_buffer_t out;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* we can encode this message. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_resp_block_get_fields(
+                    &out, &alloc_opts, EXPECTED_OFFSET, EXPECTED_STATUS,
+                    PROTOCOL_BLOCK_FIELD_ALL, &EXPECTED_BLOCK_ID,
+                    &EXPECTED_PREV_BLOCK_ID, &EXPECTED_NEXT_BLOCK_ID,
+                    &EXPECTED_FIRST_TXN_ID, EXPECTED_HEIGHT,
+                    EXPECTED_BLOCK_CERT, sizeof(EXPECTED_BLOCK_CERT)));
+
+    /* we can decode this message. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_decode_resp_block_get_fields(
+                    &resp, &alloc_opts, out.data, out.size));
+
+    /* the values are decoded correctly. */
+    TEST_EXPECT(PROTOCOL_REQ_ID_BLOCK_BY_ID_GET_FIELDS == resp.request_id);
+    TEST_EXPECT(EXPECTED_OFFSET == resp.offset);
+    TEST_EXPECT(EXPECTED_STATUS == resp.status);
+    TEST_EXPECT(PROTOCOL_BLOCK_FIELD_ALL == resp.field_mask);
+    TEST_EXPECT(0 == memcmp(&resp.block_id, &EXPECTED_BLOCK_ID, 16));
+    TEST_EXPECT(
+        0 == memcmp(&resp.prev_block_id, &EXPECTED_PREV_BLOCK_ID, 16));
+    TEST_EXPECT(
+        0 == memcmp(&resp.next_block_id, &EXPECTED_NEXT_BLOCK_ID, 16));
+    TEST_EXPECT(0 == memcmp(&resp.first_txn_id, &EXPECTED_FIRST_TXN_ID, 16));
+    TEST_EXPECT(EXPECTED_HEIGHT == resp.block_height);
+    TEST_ASSERT(sizeof(EXPECTED_BLOCK_CERT) == resp.block_cert.size);
+    TEST_EXPECT(
+        0
+            == memcmp(
+                    resp.block_cert.data, EXPECTED_BLOCK_CERT,
+                    sizeof(EXPECTED_BLOCK_CERT)));
+
+    /* clean up. */
+    dispose((disposable_t*)&out);
+    dispose((disposable_t*)&resp);
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * Fields that were not requested are zeroed, and a response missing a
+ * requested field is rejected.
+ */
+TEST(metadata_only)
+{
+    const vpr_uuid ZERO_UUID = { .data = {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } };
+    const vpr_uuid EXPECTED_BLOCK_ID = { .data = {
+        0x26, 0x49, 0xc3, 0xf4, 0xc6, 0x11, 0x4f, 0x0e,
+        0x95, 0xe6, 0x24, 0xd4, 0x12, 0xfc, 0x7c, 0x83 } };
+    const vpr_uuid EXPECTED_NEXT_BLOCK_ID = { .data = {
+        0x61, 0x77, 0x07, 0xc2, 0x10, 0x7c, 0x4b, 0xb6,
+        0x9d, 0x35, 0xa0, 0xf0, 0xde, 0xab, 0x71, 0x05 } };
+    allocator_options_t alloc_opts;
+    protocol_resp_block_get_fields resp;
+    vccrypt_buffer_t out;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* encode a response with only the next block id. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_resp_block_get_fields(
+                    &out, &alloc_opts, 1, 0,
+                    PROTOCOL_BLOCK_FIELD_NEXT_BLOCK_ID, &EXPECTED_BLOCK_ID,
+                    nullptr, &EXPECTED_NEXT_BLOCK_ID, nullptr, 0, nullptr,
+                    0));
+
+    /* a truncated response is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_resp_block_get_fields(
+                    &resp, &alloc_opts, out.data, out.size - 1));
+
+    /* we can decode this message. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_decode_resp_block_get_fields(
+                    &resp, &alloc_opts, out.data, out.size));
+
+    /* only the next block id is set. */
+    TEST_EXPECT(PROTOCOL_BLOCK_FIELD_NEXT_BLOCK_ID == resp.field_mask);
+    TEST_EXPECT(0 == memcmp(&resp.block_id, &EXPECTED_BLOCK_ID, 16));
+    TEST_EXPECT(
+        0 == memcmp(&resp.next_block_id, &EXPECTED_NEXT_BLOCK_ID, 16));
+    TEST_EXPECT(0 == memcmp(&resp.prev_block_id, &ZERO_UUID, 16));
+    TEST_EXPECT(0 == memcmp(&resp.first_txn_id, &ZERO_UUID, 16));
+    TEST_EXPECT(0U == resp.block_height);
+    TEST_EXPECT(nullptr == resp.block_cert.data);
+
+    /* clean up. */
+    dispose((disposable_t*)&out);
+    dispose((disposable_t*)&resp);
+    dispose((disposable_t*)&alloc_opts);
+}
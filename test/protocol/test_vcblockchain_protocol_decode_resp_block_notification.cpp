@@ -0,0 +1,172 @@
+/**
+ * \file
+ * test/protocol/test_vcblockchain_protocol_decode_resp_block_notification.cpp
+ *
+ * Unit tests for decoding the block notification.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_protocol_decode_resp_block_notification);
+
+/**
+ * This method should perform null checks on its pointer parameters.
+ */
+TEST(parameters)
+{
+    const uint8_t EXPECTED_PAYLOAD[4] = { 0x00, 0x01, 0x02, 0x03 };
+    size_t EXPECTED_PAYLOAD_SIZE = sizeof(EXPECTED_PAYLOAD);
+    allocator_options_t alloc_opts;
+    protocol_resp_block_notification resp;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* This method performs null checks on pointer parameters. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_resp_block_notification(
+                    nullptr, &alloc_opts, EXPECTED_PAYLOAD,
+                    EXPECTED_PAYLOAD_SIZE));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_resp_block_notification(
+                    &resp, nullptr, EXPECTED_PAYLOAD, EXPECTED_PAYLOAD_SIZE));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_resp_block_notification(
+                    &resp, &alloc_opts, nullptr, EXPECTED_PAYLOAD_SIZE));
+
+    /* clean up. */
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * This method should verify the payload size.
+ */
+TEST(payload_size)
+{
+    const uint8_t EXPECTED_PAYLOAD[4] = { 0x00, 0x01, 0x02, 0x03 };
+    size_t EXPECTED_PAYLOAD_SIZE = sizeof(EXPECTED_PAYLOAD);
+    allocator_options_t alloc_opts;
+    protocol_resp_block_notification resp;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* a truncated notification is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_resp_block_notification(
+                    &resp, &alloc_opts, EXPECTED_PAYLOAD,
+                    EXPECTED_PAYLOAD_SIZE));
+
+    /* clean up. */
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * This method can decode a properly encoded notification.
+ */
+TEST(happy_path)
+{
+    const uint32_t EXPECTED_OFFSET = 52;
+    const vpr_uuid EXPECTED_BLOCK_ID = { .data = {
+        0x26, 0x49, 0xc3, 0xf4, 0xc6, 0x11, 0x4f, 0x0e,
+        0x95, 0xe6, 0x24, 0xd4, 0x12, 0xfc, 0x7c, 0x83 } };
+    const vpr_uuid EXPECTED_PREV_BLOCK_ID = { .data = {
+        0xb6, 0xdf, 0x4b, 0xca, 0x3f, 0x9d, 0x43, 0x7c,
+        0x92, 0xe6, 0x9f, 0x1e, 0x61, 0xc2, 0xda, 0xe9 } };
+    const uint64_t EXPECTED_BLOCK_HEIGHT = 11;
+    const uint8_t EXPECTED_BLOCK_CERT[4] = { 0x01, 0x02, 0x03, 0x04 };
+    allocator_options_t alloc_opts;
+    protocol_resp_block_notification resp;
+    vccrypt_buffer_t out;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* we can encode this message. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_resp_block_notification(
+                    &out, &alloc_opts, EXPECTED_OFFSET, &EXPECTED_BLOCK_ID,
+                    &EXPECTED_PREV_BLOCK_ID, EXPECTED_BLOCK_HEIGHT,
+                    EXPECTED_BLOCK_CERT, sizeof(EXPECTED_BLOCK_CERT)));
+
+    /* we can decode this message. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_decode_resp_block_notification(
+                    &resp, &alloc_opts, out.data, out.size));
+
+    /* the header is set correctly. */
+    TEST_EXPECT(PROTOCOL_REQ_ID_BLOCK_NOTIFICATION == resp.request_id);
+    TEST_EXPECT(EXPECTED_OFFSET == resp.offset);
+    TEST_EXPECT(VCBLOCKCHAIN_STATUS_SUCCESS == resp.status);
+    /* the block ids are set correctly. */
+    TEST_EXPECT(0 == memcmp(&resp.block_id, &EXPECTED_BLOCK_ID, 16));
+    TEST_EXPECT(0 == memcmp(&resp.prev_block_id, &EXPECTED_PREV_BLOCK_ID, 16));
+    /* the block height is set correctly. */
+    TEST_EXPECT(EXPECTED_BLOCK_HEIGHT == resp.block_height);
+    /* the block cert is set correctly. */
+    TEST_ASSERT(sizeof(EXPECTED_BLOCK_CERT) == resp.block_cert.size);
+    TEST_EXPECT(
+        0
+            == memcmp(
+                    resp.block_cert.data, EXPECTED_BLOCK_CERT,
+                    sizeof(EXPECTED_BLOCK_CERT)));
+
+    /* clean up. */
+    dispose((disposable_t*)&out);
+    dispose((disposable_t*)&resp);
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * A notification without a block certificate leaves the certificate empty.
+ */
+TEST(no_cert)
+{
+    const vpr_uuid BLOCK_ID = { .data = {
+        0x26, 0x49, 0xc3, 0xf4, 0xc6, 0x11, 0x4f, 0x0e,
+        0x95, 0xe6, 0x24, 0xd4, 0x12, 0xfc, 0x7c, 0x83 } };
+    const uint64_t EXPECTED_BLOCK_HEIGHT = 12;
+    allocator_options_t alloc_opts;
+    protocol_resp_block_notification resp;
+    vccrypt_buffer_t out;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* we can encode this message. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_resp_block_notification(
+                    &out, &alloc_opts, 52, &BLOCK_ID, &BLOCK_ID,
+                    EXPECTED_BLOCK_HEIGHT, nullptr, 0));
+
+    /* we can decode this message. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_decode_resp_block_notification(
+                    &resp, &alloc_opts, out.data, out.size));
+
+    /* the block height is set, and the certificate is empty. */
+    TEST_EXPECT(EXPECTED_BLOCK_HEIGHT == resp.block_height);
+    TEST_EXPECT(nullptr == resp.block_cert.data);
+    TEST_EXPECT(0U == resp.block_cert.size);
+
+    /* clean up. */
+    dispose((disposable_t*)&out);
+    dispose((disposable_t*)&resp);
+    dispose((disposable_t*)&alloc_opts);
+}
@@ -0,0 +1,207 @@
+/**
+ * \file
+ * test/protocol/test_vcblockchain_protocol_decode_resp_block_range_get.cpp
+ *
+ * Unit tests for decoding the block range get response.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_protocol_decode_resp_block_range_get);
+
+/**
+ * This method should perform null checks on its pointer parameters.
+ */
+TEST(parameters)
+{
+    const uint8_t EXPECTED_PAYLOAD[4] = { 0x00, 0x01, 0x02, 0x03 };
+    size_t EXPECTED_PAYLOAD_SIZE = sizeof(EXPECTED_PAYLOAD);
+    allocator_options_t alloc_opts;
+    protocol_resp_block_range_get resp;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* This method performs null checks on pointer parameters. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_resp_block_range_get(
+                    nullptr, &alloc_opts, EXPECTED_PAYLOAD,
+                    EXPECTED_PAYLOAD_SIZE));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_resp_block_range_get(
+                    &resp, nullptr, EXPECTED_PAYLOAD, EXPECTED_PAYLOAD_SIZE));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_resp_block_range_get(
+                    &resp, &alloc_opts, nullptr, EXPECTED_PAYLOAD_SIZE));
+
+    /* a truncated header is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_resp_block_range_get(
+                    &resp, &alloc_opts, EXPECTED_PAYLOAD,
+                    EXPECTED_PAYLOAD_SIZE));
+
+    /* clean up. */
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * This method should verify each record size against the payload.
+ */
+TEST(payload_size)
+{
+    const uint8_t SHORT_RECORD_PAYLOAD[40] = {
+        0x00, 0x00, 0x00, 0x09, /* request id. */
+        0x00, 0x00, 0x00, 0x00, /* status. */
+        0x00, 0x00, 0x00, 0x01, /* offset. */
+        0x00, 0x00, 0x00, 0x00, /* flags. */
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, /* next height. */
+        0x00, 0x00, 0x00, 0x01, /* count. */
+        0x00, 0x00, 0x00, 0x08, /* record size is below the minimum. */
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+    const uint8_t TRAILING_PAYLOAD[29] = {
+        0x00, 0x00, 0x00, 0x09, /* request id. */
+        0x00, 0x00, 0x00, 0x00, /* status. */
+        0x00, 0x00, 0x00, 0x01, /* offset. */
+        0x00, 0x00, 0x00, 0x00, /* flags. */
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, /* next height. */
+        0x00, 0x00, 0x00, 0x00, /* count. */
+        0x00 /* trailing data. */ };
+    allocator_options_t alloc_opts;
+    protocol_resp_block_range_get resp;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* a record that is too small is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_resp_block_range_get(
+                    &resp, &alloc_opts, SHORT_RECORD_PAYLOAD,
+                    sizeof(SHORT_RECORD_PAYLOAD)));
+
+    /* a record that runs past the payload is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_resp_block_range_get(
+                    &resp, &alloc_opts, SHORT_RECORD_PAYLOAD, 34));
+
+    /* trailing data is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_resp_block_range_get(
+                    &resp, &alloc_opts, TRAILING_PAYLOAD,
+                    sizeof(TRAILING_PAYLOAD)));
+
+    /* without the trailing data, the empty response is decoded. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_decode_resp_block_range_get(
+                    &resp, &alloc_opts, TRAILING_PAYLOAD,
+                    sizeof(TRAILING_PAYLOAD) - 1));
+    TEST_EXPECT(0U == resp.count);
+    TEST_EXPECT(1U == resp.next_height);
+    TEST_EXPECT(nullptr == resp.records);
+    dispose((disposable_t*)&resp);
+
+    /* clean up. */
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * This method can decode an encoded response with several blocks.
+ */
+TEST(happy_path)
+{
+    const uint32_t EXPECTED_OFFSET = 97;
+    const uint32_t EXPECTED_STATUS = VCBLOCKCHAIN_STATUS_SUCCESS;
+    const uint32_t EXPECTED_FLAGS = PROTOCOL_BLOCK_RANGE_FLAG_MORE;
+    const uint64_t EXPECTED_NEXT_HEIGHT = 1002;
+    const uint8_t BLOCK_CERT[5] = { 0x01, 0x02, 0x03, 0x04, 0x05 };
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+    protocol_block_range_record records[2];
+    protocol_resp_block_range_get resp;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* set up the records. */
+    memset(records, 0, sizeof(records));
+    for (int i = 0; i < 2; ++i)
+    {
+        memset(&records[i].block_id, 0x11 + i, 16);
+        memset(&records[i].prev_block_id, 0x21 + i, 16);
+        memset(&records[i].next_block_id, 0x31 + i, 16);
+        memset(&records[i].first_txn_id, 0x41 + i, 16);
+        records[i].block_height = 1000 + i;
+    }
+    records[0].block_size = sizeof(BLOCK_CERT);
+    records[0].block_cert = BLOCK_CERT;
+    records[0].block_cert_size = sizeof(BLOCK_CERT);
+
+    /* encode the response. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_resp_block_range_get(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, EXPECTED_STATUS,
+                    EXPECTED_FLAGS, EXPECTED_NEXT_HEIGHT, records, 2));
+
+    /* decode the response. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_decode_resp_block_range_get(
+                    &resp, &alloc_opts, buffer.data, buffer.size));
+
+    /* verify the header. */
+    TEST_EXPECT(PROTOCOL_REQ_ID_BLOCK_RANGE_GET == resp.request_id);
+    TEST_EXPECT(EXPECTED_STATUS == resp.status);
+    TEST_EXPECT(EXPECTED_OFFSET == resp.offset);
+    TEST_EXPECT(EXPECTED_FLAGS == resp.flags);
+    TEST_EXPECT(EXPECTED_NEXT_HEIGHT == resp.next_height);
+    TEST_ASSERT(2U == resp.count);
+
+    /* verify each record. */
+    for (int i = 0; i < 2; ++i)
+    {
+        TEST_EXPECT(
+            0 == memcmp(&resp.records[i].block_id, &records[i].block_id, 16));
+        TEST_EXPECT(
+            0 == memcmp(
+                    &resp.records[i].prev_block_id, &records[i].prev_block_id,
+                    16));
+        TEST_EXPECT(
+            0 == memcmp(
+                    &resp.records[i].next_block_id, &records[i].next_block_id,
+                    16));
+        TEST_EXPECT(
+            0 == memcmp(
+                    &resp.records[i].first_txn_id, &records[i].first_txn_id,
+                    16));
+        TEST_EXPECT(records[i].block_height == resp.records[i].block_height);
+        TEST_EXPECT(records[i].block_size == resp.records[i].block_size);
+    }
+
+    /* the first block has a certificate, and the second does not. */
+    TEST_ASSERT(sizeof(BLOCK_CERT) == resp.records[0].block_cert_size);
+    TEST_EXPECT(
+        0 == memcmp(resp.records[0].block_cert, BLOCK_CERT,
+                    sizeof(BLOCK_CERT)));
+    TEST_EXPECT(0U == resp.records[1].block_cert_size);
+
+    /* clean up. */
+    dispose((disposable_t*)&resp);
+    dispose((disposable_t*)&buffer);
+    dispose((disposable_t*)&alloc_opts);
+}
@@ -0,0 +1,240 @@
+/**
+ * \file
+ * test/protocol/test_vcblockchain_protocol_decode_resp_block_txn_ids_get.cpp
+ *
+ * Unit tests for decoding the block transaction ids get response.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_protocol_decode_resp_block_txn_ids_get);
+
+/**
+ * This method should perform null checks on its pointer parameters.
+ */
+TEST(parameters)
+{
+    const uint8_t EXPECTED_PAYLOAD[4] = { 0x00, 0x01, 0x02, 0x03 };
+    size_t EXPECTED_PAYLOAD_SIZE = sizeof(EXPECTED_PAYLOAD);
+    allocator_options_t alloc_opts;
+    protocol_resp_block_txn_ids_get resp;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* This method performs null checks on pointer parameters. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_resp_block_txn_ids_get(
+                    nullptr, &alloc_opts, EXPECTED_PAYLOAD,
+                    EXPECTED_PAYLOAD_SIZE));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_resp_block_txn_ids_get(
+                    &resp, nullptr, EXPECTED_PAYLOAD, EXPECTED_PAYLOAD_SIZE));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_resp_block_txn_ids_get(
+                    &resp, &alloc_opts, nullptr, EXPECTED_PAYLOAD_SIZE));
+
+    /* a truncated header is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE
+            == vcblockchain_protocol_decode_resp_block_txn_ids_get(
+                    &resp, &alloc_opts, EXPECTED_PAYLOAD,
+                    EXPECTED_PAYLOAD_SIZE));
+
+    /* clean up. */
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * This method should verify the count against the payload size.
+ */
+TEST(payload_size)
+{
+    const uint8_t PAYLOAD[40] = {
+        0x00, 0x00, 0x00, 0x0a, /* request id. */
+        0x00, 0x00, 0x00, 0x00, /* status. */
+        0x00, 0x00, 0x00, 0x01, /* offset. */
+        0x00, 0x00, 0x00, 0x01, /* include states. */
+        0x00, 0x00, 0x00, 0x01, /* count. */
+        0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+        0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, /* txn id. */
+        0x00, 0x00, 0x00, 0x02 /* txn state. */ };
+    allocator_options_t alloc_opts;
+    protocol_resp_block_txn_ids_get resp;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* a missing transaction state is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE
+            == vcblockchain_protocol_decode_resp_block_txn_ids_get(
+                    &resp, &alloc_opts, PAYLOAD, sizeof(PAYLOAD) - 4));
+
+    /* a truncated transaction id is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE
+            == vcblockchain_protocol_decode_resp_block_txn_ids_get(
+                    &resp, &alloc_opts, PAYLOAD, sizeof(PAYLOAD) - 8));
+
+    /* the complete payload is decoded. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_decode_resp_block_txn_ids_get(
+                    &resp, &alloc_opts, PAYLOAD, sizeof(PAYLOAD)));
+    TEST_ASSERT(1U == resp.count);
+    TEST_EXPECT(0 == memcmp(&resp.txn_ids[0], PAYLOAD + 20, 16));
+    TEST_ASSERT(nullptr != resp.txn_states);
+    TEST_EXPECT(2U == resp.txn_states[0]);
+    dispose((disposable_t*)&resp);
+
+    /* clean up. */
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * This method rejects a response to a different request.
+ */
+TEST(request_id)
+{
+    const uint8_t PAYLOAD[20] = {
+        0x00, 0x00, 0x00, 0x0b, /* request id. */
+        0x00, 0x00, 0x00, 0x00, /* status. */
+        0x00, 0x00, 0x00, 0x01, /* offset. */
+        0x00, 0x00, 0x00, 0x00, /* include states. */
+        0x00, 0x00, 0x00, 0x00 /* count. */ };
+    allocator_options_t alloc_opts;
+    protocol_resp_block_txn_ids_get resp;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* the wrong request id is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE
+            == vcblockchain_protocol_decode_resp_block_txn_ids_get(
+                    &resp, &alloc_opts, PAYLOAD, sizeof(PAYLOAD)));
+
+    /* clean up. */
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * This method returns the status of an error response, which only holds a
+ * header.
+ */
+TEST(error_status)
+{
+    const uint32_t EXPECTED_OFFSET = 97;
+    const uint32_t EXPECTED_STATUS = 77;
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+    protocol_resp_block_txn_ids_get resp;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* encode an error response. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_error_resp(
+                    &buffer, &alloc_opts, PROTOCOL_REQ_ID_BLOCK_TXN_IDS_GET,
+                    EXPECTED_OFFSET, EXPECTED_STATUS));
+
+    /* the status from the response is returned. */
+    TEST_EXPECT(
+        (int)EXPECTED_STATUS
+            == vcblockchain_protocol_decode_resp_block_txn_ids_get(
+                    &resp, &alloc_opts, buffer.data, buffer.size));
+
+    /* clean up. */
+    dispose((disposable_t*)&buffer);
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * This method can decode an encoded response with and without states.
+ */
+TEST(happy_path)
+{
+    const uint32_t EXPECTED_OFFSET = 97;
+    const uint32_t EXPECTED_STATUS = VCBLOCKCHAIN_STATUS_SUCCESS;
+    const uint32_t TXN_STATES[3] = { 0x01, 0x02, 0x03 };
+    vpr_uuid txn_ids[3];
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+    protocol_resp_block_txn_ids_get resp;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* set up the transaction ids. */
+    for (int i = 0; i < 3; ++i)
+    {
+        memset(&txn_ids[i], 0x11 * (i + 1), sizeof(txn_ids[i]));
+    }
+
+    /* encode the response with states. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_resp_block_txn_ids_get(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, EXPECTED_STATUS,
+                    txn_ids, TXN_STATES, 3));
+
+    /* decode the response. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_decode_resp_block_txn_ids_get(
+                    &resp, &alloc_opts, buffer.data, buffer.size));
+
+    /* verify the response. */
+    TEST_EXPECT(PROTOCOL_REQ_ID_BLOCK_TXN_IDS_GET == resp.request_id);
+    TEST_EXPECT(EXPECTED_STATUS == resp.status);
+    TEST_EXPECT(EXPECTED_OFFSET == resp.offset);
+    TEST_EXPECT(resp.include_states);
+    TEST_ASSERT(3U == resp.count);
+    TEST_EXPECT(0 == memcmp(resp.txn_ids, txn_ids, sizeof(txn_ids)));
+    TEST_ASSERT(nullptr != resp.txn_states);
+    for (int i = 0; i < 3; ++i)
+    {
+        TEST_EXPECT(TXN_STATES[i] == resp.txn_states[i]);
+    }
+
+    dispose((disposable_t*)&resp);
+    dispose((disposable_t*)&buffer);
+
+    /* encode the response without states. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_resp_block_txn_ids_get(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, EXPECTED_STATUS,
+                    txn_ids, nullptr, 3));
+
+    /* decode the response. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_decode_resp_block_txn_ids_get(
+                    &resp, &alloc_opts, buffer.data, buffer.size));
+
+    /* only the transaction ids are returned. */
+    TEST_EXPECT(!resp.include_states);
+    TEST_ASSERT(3U == resp.count);
+    TEST_EXPECT(0 == memcmp(resp.txn_ids, txn_ids, sizeof(txn_ids)));
+    TEST_EXPECT(nullptr == resp.txn_states);
+
+    /* clean up. */
+    dispose((disposable_t*)&resp);
+    dispose((disposable_t*)&buffer);
+    dispose((disposable_t*)&alloc_opts);
+}
@@ -0,0 +1,97 @@
+/**
+ * \file test/protocol/test_vcblockchain_protocol_decode_resp_flow_credit_grant.cpp
+ *
+ * Unit tests for decoding the flow credit grant response.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/data.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_protocol_decode_resp_flow_credit_grant);
+
+/**
+ * An encoded response decodes to the same values.
+ */
+TEST(basics)
+{
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t out;
+    protocol_resp_flow_credit_grant resp;
+    const uint32_t EXPECTED_OFFSET = 23;
+    const uint32_t EXPECTED_REQUEST_CREDITS = 32;
+    const uint64_t EXPECTED_BYTE_CREDITS = 0x8000000100000002;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* encode the response. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_resp_flow_credit_grant(
+                    &out, &alloc_opts, EXPECTED_OFFSET,
+                    VCBLOCKCHAIN_STATUS_SUCCESS, EXPECTED_REQUEST_CREDITS,
+                    EXPECTED_BYTE_CREDITS));
+
+    /* a truncated response is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE
+            == vcblockchain_protocol_decode_resp_flow_credit_grant(
+                    &resp, out.data, out.size - 1));
+
+    /* decoding the response should succeed. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_decode_resp_flow_credit_grant(
+                    &resp, out.data, out.size));
+
+    /* the values should match. */
+    TEST_EXPECT(PROTOCOL_REQ_ID_FLOW_CREDIT_GRANT == resp.request_id);
+    TEST_EXPECT(EXPECTED_OFFSET == resp.offset);
+    TEST_EXPECT(VCBLOCKCHAIN_STATUS_SUCCESS == resp.status);
+    TEST_EXPECT(EXPECTED_REQUEST_CREDITS == resp.request_credits);
+    TEST_EXPECT(EXPECTED_BYTE_CREDITS == resp.byte_credits);
+
+    /* clean up. */
+    dispose((disposable_t*)&resp);
+    dispose((disposable_t*)&out);
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * An agent without flow control answers with an error, which is returned.
+ */
+TEST(refused)
+{
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t out;
+    protocol_resp_flow_credit_grant resp;
+    const uint32_t EXPECTED_OFFSET = 23;
+    const uint32_t EXPECTED_STATUS = 77;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* the agent refuses flow control with an error response. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_error_resp(
+                    &out, &alloc_opts, PROTOCOL_REQ_ID_FLOW_CREDIT_GRANT,
+                    EXPECTED_OFFSET, EXPECTED_STATUS));
+
+    /* decoding returns the status. */
+    TEST_EXPECT(
+        (int)EXPECTED_STATUS
+            == vcblockchain_protocol_decode_resp_flow_credit_grant(
+                    &resp, out.data, out.size));
+
+    /* clean up. */
+    dispose((disposable_t*)&out);
+    dispose((disposable_t*)&alloc_opts);
+}
@@ -0,0 +1,149 @@
+/**
+ * \file
+ * test/protocol/test_vcblockchain_protocol_decode_resp_handshake_resume.cpp
+ *
+ * Unit tests for decoding the handshake resume response.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/data.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_protocol_decode_resp_handshake_resume);
+
+/**
+ * Test the basics of the decoding.
+ */
+TEST(basics)
+{
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t suite;
+    vccrypt_buffer_t server_key_nonce;
+    vccrypt_buffer_t server_cr_hmac;
+    vccrypt_buffer_t out;
+    const uint32_t EXPECTED_OFFSET = 17;
+    const uint32_t EXPECTED_STATUS = 0;
+    protocol_resp_handshake_resume resp;
+
+    /* register the suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create the crypto suite. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_options_init(
+                    &suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1));
+
+    /* create a buffer for holding the key nonce. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_buffer_init_for_cipher_key_agreement_nonce(
+                    &suite, &server_key_nonce));
+    memset(server_key_nonce.data, 0xFE, server_key_nonce.size);
+
+    /* create a buffer for holding the cr hmac. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_buffer_init_for_mac_authentication_code(
+                    &suite, &server_cr_hmac, true));
+    memset(server_cr_hmac.data, 0xE1, server_cr_hmac.size);
+
+    /* encode the response. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_resp_handshake_resume(
+                    &out, &suite, EXPECTED_OFFSET, EXPECTED_STATUS,
+                    &server_key_nonce, &server_cr_hmac));
+
+    /* a truncated response can't be decoded. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE
+            == vcblockchain_protocol_decode_resp_handshake_resume(
+                    &resp, &suite, out.data, out.size - 1));
+
+    /* decoding the response should succeed. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_decode_resp_handshake_resume(
+                    &resp, &suite, out.data, out.size));
+
+    /* the fields should match. */
+    TEST_EXPECT(PROTOCOL_REQ_ID_HANDSHAKE_RESUME == resp.request_id);
+    TEST_EXPECT(EXPECTED_OFFSET == resp.offset);
+    TEST_EXPECT(EXPECTED_STATUS == resp.status);
+    TEST_ASSERT(resp.server_key_nonce_set);
+    TEST_ASSERT(server_key_nonce.size == resp.server_key_nonce.size);
+    TEST_EXPECT(
+        0
+            == memcmp(
+                    server_key_nonce.data, resp.server_key_nonce.data,
+                    server_key_nonce.size));
+    TEST_ASSERT(resp.server_cr_hmac_set);
+    TEST_ASSERT(server_cr_hmac.size == resp.server_cr_hmac.size);
+    TEST_EXPECT(
+        0
+            == memcmp(
+                    server_cr_hmac.data, resp.server_cr_hmac.data,
+                    server_cr_hmac.size));
+
+    /* clean up. */
+    dispose((disposable_t*)&resp);
+    dispose((disposable_t*)&out);
+    dispose((disposable_t*)&server_key_nonce);
+    dispose((disposable_t*)&server_cr_hmac);
+    dispose((disposable_t*)&suite);
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * A rejected ticket is reported with the status from the response.
+ */
+TEST(rejected)
+{
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t suite;
+    vccrypt_buffer_t out;
+    const uint32_t EXPECTED_STATUS =
+        VCBLOCKCHAIN_ERROR_PROTOCOL_TICKET_REJECTED;
+    protocol_resp_handshake_resume resp;
+
+    /* register the suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create the crypto suite. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_options_init(
+                    &suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1));
+
+    /* the agent rejects the ticket with an error response. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_error_resp(
+                    &out, &alloc_opts, PROTOCOL_REQ_ID_HANDSHAKE_RESUME, 0U,
+                    EXPECTED_STATUS));
+
+    /* decoding returns the status. */
+    TEST_EXPECT(
+        (int)EXPECTED_STATUS
+            == vcblockchain_protocol_decode_resp_handshake_resume(
+                    &resp, &suite, out.data, out.size));
+
+    /* clean up. */
+    dispose((disposable_t*)&out);
+    dispose((disposable_t*)&suite);
+    dispose((disposable_t*)&alloc_opts);
+}
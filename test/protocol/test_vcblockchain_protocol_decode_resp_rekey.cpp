@@ -0,0 +1,133 @@
+/**
+ * \file test/protocol/test_vcblockchain_protocol_decode_resp_rekey.cpp
+ *
+ * Unit tests for decoding the rekey response.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/data.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_protocol_decode_resp_rekey);
+
+/**
+ * An encoded response decodes to the same values.
+ */
+TEST(basics)
+{
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t suite;
+    vccrypt_buffer_t server_key_nonce;
+    vccrypt_buffer_t out;
+    protocol_resp_rekey resp;
+    const uint32_t EXPECTED_OFFSET = 23;
+    const uint64_t EXPECTED_SERVER_SWITCH_IV = 0x8000000100000002;
+
+    /* register the suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create the crypto suite. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_options_init(
+                    &suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1));
+
+    /* create a buffer for holding the key nonce. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_buffer_init_for_cipher_key_agreement_nonce(
+                    &suite, &server_key_nonce));
+    memset(server_key_nonce.data, 0x5E, server_key_nonce.size);
+
+    /* encode the response. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_resp_rekey(
+                    &out, &suite, EXPECTED_OFFSET, VCBLOCKCHAIN_STATUS_SUCCESS,
+                    EXPECTED_SERVER_SWITCH_IV, &server_key_nonce));
+
+    /* a truncated response is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE
+            == vcblockchain_protocol_decode_resp_rekey(
+                    &resp, &suite, out.data, out.size - 1));
+
+    /* decoding the response should succeed. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_decode_resp_rekey(
+                    &resp, &suite, out.data, out.size));
+
+    /* the values should match. */
+    TEST_EXPECT(PROTOCOL_REQ_ID_REKEY == resp.request_id);
+    TEST_EXPECT(EXPECTED_OFFSET == resp.offset);
+    TEST_EXPECT(VCBLOCKCHAIN_STATUS_SUCCESS == resp.status);
+    TEST_EXPECT(EXPECTED_SERVER_SWITCH_IV == resp.server_switch_iv);
+    TEST_ASSERT(resp.server_key_nonce_set);
+    TEST_ASSERT(server_key_nonce.size == resp.server_key_nonce.size);
+    TEST_EXPECT(
+        0
+            == memcmp(
+                    server_key_nonce.data, resp.server_key_nonce.data,
+                    server_key_nonce.size));
+
+    /* clean up. */
+    dispose((disposable_t*)&resp);
+    dispose((disposable_t*)&out);
+    dispose((disposable_t*)&server_key_nonce);
+    dispose((disposable_t*)&suite);
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * A refused rekey returns the status from the response.
+ */
+TEST(refused)
+{
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t suite;
+    vccrypt_buffer_t out;
+    protocol_resp_rekey resp;
+    const uint32_t EXPECTED_OFFSET = 23;
+    const uint32_t EXPECTED_STATUS = 77;
+
+    /* register the suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create the crypto suite. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_options_init(
+                    &suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1));
+
+    /* the agent refuses the rekey with an error response. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_error_resp(
+                    &out, &alloc_opts, PROTOCOL_REQ_ID_REKEY, EXPECTED_OFFSET,
+                    EXPECTED_STATUS));
+
+    /* decoding returns the status. */
+    TEST_EXPECT(
+        (int)EXPECTED_STATUS
+            == vcblockchain_protocol_decode_resp_rekey(
+                    &resp, &suite, out.data, out.size));
+
+    /* clean up. */
+    dispose((disposable_t*)&out);
+    dispose((disposable_t*)&suite);
+    dispose((disposable_t*)&alloc_opts);
+}
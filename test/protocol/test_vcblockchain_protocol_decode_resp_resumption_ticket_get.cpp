@@ -0,0 +1,148 @@
+/**
+ * \file
+ * test/protocol/test_vcblockchain_protocol_decode_resp_resumption_ticket_get.cpp
+ *
+ * Unit tests for decoding the resumption ticket get response.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_protocol_decode_resp_resumption_ticket_get);
+
+/**
+ * This method should perform null checks on its pointer parameters.
+ */
+TEST(parameters)
+{
+    const uint8_t EXPECTED_PAYLOAD[4] = { 0x00, 0x01, 0x02, 0x03 };
+    size_t EXPECTED_PAYLOAD_SIZE = sizeof(EXPECTED_PAYLOAD);
+    allocator_options_t alloc_opts;
+    protocol_resp_resumption_ticket_get resp;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* This method performs null checks on pointer parameters. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_resp_resumption_ticket_get(
+                    nullptr, &alloc_opts, EXPECTED_PAYLOAD,
+                    EXPECTED_PAYLOAD_SIZE));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_resp_resumption_ticket_get(
+                    &resp, nullptr, EXPECTED_PAYLOAD, EXPECTED_PAYLOAD_SIZE));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_resp_resumption_ticket_get(
+                    &resp, &alloc_opts, nullptr, EXPECTED_PAYLOAD_SIZE));
+
+    /* This method performs a payload size check. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_resp_resumption_ticket_get(
+                    &resp, &alloc_opts, EXPECTED_PAYLOAD,
+                    EXPECTED_PAYLOAD_SIZE));
+
+    /* clean up. */
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * This method can decode a properly encoded response message.
+ */
+TEST(happy_path)
+{
+    const uint32_t EXPECTED_OFFSET = 12;
+    const uint32_t EXPECTED_STATUS = 0;
+    allocator_options_t alloc_opts;
+    protocol_resp_resumption_ticket_get resp;
+    vccrypt_buffer_t buffer;
+    vccrypt_buffer_t ticket;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create the ticket. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_buffer_init(&ticket, &alloc_opts, 48));
+    memset(ticket.data, 0xA5, ticket.size);
+
+    /* we can encode a message. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_resp_resumption_ticket_get(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, EXPECTED_STATUS,
+                    &ticket));
+
+    /* we can decode this message. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_decode_resp_resumption_ticket_get(
+                    &resp, &alloc_opts, buffer.data, buffer.size));
+
+    /* the header is set correctly. */
+    TEST_EXPECT(PROTOCOL_REQ_ID_RESUMPTION_TICKET_GET == resp.request_id);
+    TEST_EXPECT(EXPECTED_OFFSET == resp.offset);
+    TEST_EXPECT(EXPECTED_STATUS == resp.status);
+
+    /* the ticket is set correctly. */
+    TEST_ASSERT(ticket.size == resp.ticket.size);
+    TEST_EXPECT(0 == memcmp(ticket.data, resp.ticket.data, ticket.size));
+
+    /* clean up. */
+    dispose((disposable_t*)&resp);
+    dispose((disposable_t*)&buffer);
+    dispose((disposable_t*)&ticket);
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * An error response holds no ticket.
+ */
+TEST(error_response)
+{
+    const uint32_t EXPECTED_OFFSET = 12;
+    const uint32_t EXPECTED_STATUS = 77;
+    allocator_options_t alloc_opts;
+    protocol_resp_resumption_ticket_get resp;
+    vccrypt_buffer_t buffer;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* encode an error response. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_error_resp(
+                    &buffer, &alloc_opts,
+                    PROTOCOL_REQ_ID_RESUMPTION_TICKET_GET, EXPECTED_OFFSET,
+                    EXPECTED_STATUS));
+
+    /* we can decode this message. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_decode_resp_resumption_ticket_get(
+                    &resp, &alloc_opts, buffer.data, buffer.size));
+
+    /* the header is set correctly, and there is no ticket. */
+    TEST_EXPECT(PROTOCOL_REQ_ID_RESUMPTION_TICKET_GET == resp.request_id);
+    TEST_EXPECT(EXPECTED_OFFSET == resp.offset);
+    TEST_EXPECT(EXPECTED_STATUS == resp.status);
+    TEST_EXPECT(nullptr == resp.ticket.data);
+    TEST_EXPECT(0U == resp.ticket.size);
+
+    /* clean up. */
+    dispose((disposable_t*)&resp);
+    dispose((disposable_t*)&buffer);
+    dispose((disposable_t*)&alloc_opts);
+}
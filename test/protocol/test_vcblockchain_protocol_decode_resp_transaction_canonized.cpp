@@ -0,0 +1,107 @@
+/**
+ * \file
+ * test/protocol/test_vcblockchain_protocol_decode_resp_transaction_canonized.cpp
+ *
+ * Unit tests for decoding the transaction canonized notification.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_protocol_decode_resp_transaction_canonized);
+
+/**
+ * This method should perform null checks on its pointer parameters.
+ */
+TEST(parameters)
+{
+    const uint8_t EXPECTED_PAYLOAD[4] = { 0x00, 0x01, 0x02, 0x03 };
+    size_t EXPECTED_PAYLOAD_SIZE = sizeof(EXPECTED_PAYLOAD);
+    protocol_resp_transaction_canonized resp;
+
+    /* This method performs null checks on pointer parameters. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_resp_transaction_canonized(
+                    nullptr, EXPECTED_PAYLOAD, EXPECTED_PAYLOAD_SIZE));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_resp_transaction_canonized(
+                    &resp, nullptr, EXPECTED_PAYLOAD_SIZE));
+}
+
+/**
+ * This method should verify the payload size.
+ */
+TEST(payload_size)
+{
+    const uint8_t EXPECTED_PAYLOAD[4] = { 0x00, 0x01, 0x02, 0x03 };
+    size_t EXPECTED_PAYLOAD_SIZE = sizeof(EXPECTED_PAYLOAD);
+    protocol_resp_transaction_canonized resp;
+
+    /* a truncated notification is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_resp_transaction_canonized(
+                    &resp, EXPECTED_PAYLOAD, EXPECTED_PAYLOAD_SIZE));
+}
+
+/**
+ * This method can decode a properly encoded notification.
+ */
+TEST(happy_path)
+{
+    const uint32_t EXPECTED_OFFSET = 52;
+    const vpr_uuid EXPECTED_TXN_ID = { .data = {
+        0x0b, 0xe4, 0x27, 0x6a, 0x19, 0xd3, 0x45, 0x70,
+        0x8c, 0x5e, 0xf2, 0x03, 0x6d, 0xa1, 0x3b, 0x94 } };
+    const vpr_uuid EXPECTED_BLOCK_ID = { .data = {
+        0x26, 0x49, 0xc3, 0xf4, 0xc6, 0x11, 0x4f, 0x0e,
+        0x95, 0xe6, 0x24, 0xd4, 0x12, 0xfc, 0x7c, 0x83 } };
+    const uint64_t EXPECTED_BLOCK_HEIGHT = 1024;
+    allocator_options_t alloc_opts;
+    protocol_resp_transaction_canonized resp;
+    vccrypt_buffer_t out;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* we can encode this message. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_resp_transaction_canonized(
+                    &out, &alloc_opts, EXPECTED_OFFSET, &EXPECTED_TXN_ID,
+                    &EXPECTED_BLOCK_ID, EXPECTED_BLOCK_HEIGHT));
+
+    /* a notification with trailing data is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_resp_transaction_canonized(
+                    &resp, out.data, out.size + 1));
+
+    /* we can decode this message. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_decode_resp_transaction_canonized(
+                    &resp, out.data, out.size));
+
+    /* the values are set correctly. */
+    TEST_EXPECT(PROTOCOL_REQ_ID_TRANSACTION_CANONIZED == resp.request_id);
+    TEST_EXPECT(EXPECTED_OFFSET == resp.offset);
+    TEST_EXPECT(VCBLOCKCHAIN_STATUS_SUCCESS == resp.status);
+    TEST_EXPECT(0 == memcmp(&resp.txn_id, &EXPECTED_TXN_ID, 16));
+    TEST_EXPECT(0 == memcmp(&resp.block_id, &EXPECTED_BLOCK_ID, 16));
+    TEST_EXPECT(EXPECTED_BLOCK_HEIGHT == resp.block_height);
+
+    /* clean up. */
+    dispose((disposable_t*)&out);
+    dispose((disposable_t*)&resp);
+    dispose((disposable_t*)&alloc_opts);
+}
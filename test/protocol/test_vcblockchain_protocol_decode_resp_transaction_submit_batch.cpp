@@ -0,0 +1,147 @@
+/**
+ * \file
+ * test/protocol/test_vcblockchain_protocol_decode_resp_transaction_submit_batch.cpp
+ *
+ * Unit tests for decoding the transaction submit batch response.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_protocol_decode_resp_transaction_submit_batch);
+
+/**
+ * This method should perform null checks on its pointer parameters.
+ */
+TEST(parameters)
+{
+    const uint8_t EXPECTED_PAYLOAD[4] = { 0x00, 0x01, 0x02, 0x03 };
+    size_t EXPECTED_PAYLOAD_SIZE = sizeof(EXPECTED_PAYLOAD);
+    allocator_options_t alloc_opts;
+    protocol_resp_transaction_submit_batch resp;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* This method performs null checks on pointer parameters. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_resp_transaction_submit_batch(
+                    nullptr, &alloc_opts, EXPECTED_PAYLOAD,
+                    EXPECTED_PAYLOAD_SIZE));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_resp_transaction_submit_batch(
+                    &resp, nullptr, EXPECTED_PAYLOAD, EXPECTED_PAYLOAD_SIZE));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_resp_transaction_submit_batch(
+                    &resp, &alloc_opts, nullptr, EXPECTED_PAYLOAD_SIZE));
+
+    /* a truncated header is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_resp_transaction_submit_batch(
+                    &resp, &alloc_opts, EXPECTED_PAYLOAD,
+                    EXPECTED_PAYLOAD_SIZE));
+
+    /* clean up. */
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * This method should verify the count against the payload size.
+ */
+TEST(payload_size)
+{
+    const uint8_t PAYLOAD[24] = {
+        0x00, 0x00, 0x00, 0x18, /* request id. */
+        0x00, 0x00, 0x00, 0x00, /* status. */
+        0x00, 0x00, 0x00, 0x01, /* offset. */
+        0x00, 0x00, 0x00, 0x02, /* count. */
+        0x00, 0x00, 0x00, 0x00, /* first status. */
+        0x00, 0x00, 0x51, 0x01 /* second status. */ };
+    allocator_options_t alloc_opts;
+    protocol_resp_transaction_submit_batch resp;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* a missing status is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_resp_transaction_submit_batch(
+                    &resp, &alloc_opts, PAYLOAD, sizeof(PAYLOAD) - 4));
+
+    /* a truncated status is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_decode_resp_transaction_submit_batch(
+                    &resp, &alloc_opts, PAYLOAD, sizeof(PAYLOAD) - 1));
+
+    /* the complete payload is decoded. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_decode_resp_transaction_submit_batch(
+                    &resp, &alloc_opts, PAYLOAD, sizeof(PAYLOAD)));
+    TEST_ASSERT(2U == resp.count);
+    TEST_EXPECT(0U == resp.statuses[0]);
+    TEST_EXPECT(0x5101U == resp.statuses[1]);
+    dispose((disposable_t*)&resp);
+
+    /* clean up. */
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * This method can decode an encoded response.
+ */
+TEST(happy_path)
+{
+    const uint32_t EXPECTED_OFFSET = 97;
+    const uint32_t EXPECTED_STATUS = VCBLOCKCHAIN_STATUS_SUCCESS;
+    const uint32_t STATUSES[3] = {
+        VCBLOCKCHAIN_STATUS_SUCCESS, VCBLOCKCHAIN_ERROR_INVALID_ARG,
+        VCBLOCKCHAIN_STATUS_SUCCESS };
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+    protocol_resp_transaction_submit_batch resp;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* encode the response. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_resp_transaction_submit_batch(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, EXPECTED_STATUS,
+                    STATUSES, 3));
+
+    /* decode the response. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_decode_resp_transaction_submit_batch(
+                    &resp, &alloc_opts, buffer.data, buffer.size));
+
+    /* verify the response. */
+    TEST_EXPECT(PROTOCOL_REQ_ID_TRANSACTION_SUBMIT_BATCH == resp.request_id);
+    TEST_EXPECT(EXPECTED_STATUS == resp.status);
+    TEST_EXPECT(EXPECTED_OFFSET == resp.offset);
+    TEST_ASSERT(3U == resp.count);
+    for (int i = 0; i < 3; ++i)
+    {
+        TEST_EXPECT(STATUSES[i] == resp.statuses[i]);
+    }
+
+    /* clean up. */
+    dispose((disposable_t*)&resp);
+    dispose((disposable_t*)&buffer);
+    dispose((disposable_t*)&alloc_opts);
+}
@@ -0,0 +1,143 @@
+/**
+ * \file
+ * test/protocol/test_vcblockchain_protocol_encode_req_artifact_txn_page_get.cpp
+ *
+ * Unit tests for encoding the artifact transaction page get request.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <arpa/inet.h>
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_protocol_encode_req_artifact_txn_page_get);
+
+/**
+ * This method should perform null checks on its pointer parameters.
+ */
+TEST(parameter_check)
+{
+    const uint32_t EXPECTED_OFFSET = 97;
+    const uint32_t EXPECTED_DIRECTION = PROTOCOL_TXN_PAGE_DIRECTION_FORWARD;
+    const uint32_t EXPECTED_PAGE_SIZE = 100;
+    const vpr_uuid EXPECTED_ARTIFACT_ID = { .data = {
+        0xca, 0x14, 0x0d, 0x1e, 0x5b, 0xcf, 0x47, 0xa9,
+        0xab, 0xf7, 0xbc, 0xd8, 0xfa, 0xdb, 0x48, 0x27 }};
+    const vpr_uuid EXPECTED_CURSOR = { .data = {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }};
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* This method performs null checks on pointer parameters. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_req_artifact_txn_page_get(
+                    nullptr, &alloc_opts, EXPECTED_OFFSET,
+                    &EXPECTED_ARTIFACT_ID, &EXPECTED_CURSOR,
+                    EXPECTED_DIRECTION, EXPECTED_PAGE_SIZE, false));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_req_artifact_txn_page_get(
+                    &buffer, nullptr, EXPECTED_OFFSET,
+                    &EXPECTED_ARTIFACT_ID, &EXPECTED_CURSOR,
+                    EXPECTED_DIRECTION, EXPECTED_PAGE_SIZE, false));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_req_artifact_txn_page_get(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, nullptr,
+                    &EXPECTED_CURSOR, EXPECTED_DIRECTION, EXPECTED_PAGE_SIZE,
+                    false));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_req_artifact_txn_page_get(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET,
+                    &EXPECTED_ARTIFACT_ID, nullptr, EXPECTED_DIRECTION,
+                    EXPECTED_PAGE_SIZE, false));
+
+    /* an unknown direction is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_req_artifact_txn_page_get(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET,
+                    &EXPECTED_ARTIFACT_ID, &EXPECTED_CURSOR, 2,
+                    EXPECTED_PAGE_SIZE, false));
+
+    /* an empty page is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_req_artifact_txn_page_get(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET,
+                    &EXPECTED_ARTIFACT_ID, &EXPECTED_CURSOR,
+                    EXPECTED_DIRECTION, 0, false));
+
+    /* clean up. */
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * If valid parameters are provided, this method encodes a request message.
+ */
+TEST(happy_path)
+{
+    const uint32_t EXPECTED_OFFSET = 97;
+    const uint32_t EXPECTED_DIRECTION = PROTOCOL_TXN_PAGE_DIRECTION_BACKWARD;
+    const uint32_t EXPECTED_PAGE_SIZE = 100;
+    const vpr_uuid EXPECTED_ARTIFACT_ID = { .data = {
+        0xca, 0x14, 0x0d, 0x1e, 0x5b, 0xcf, 0x47, 0xa9,
+        0xab, 0xf7, 0xbc, 0xd8, 0xfa, 0xdb, 0x48, 0x27 }};
+    const vpr_uuid EXPECTED_CURSOR = { .data = {
+        0x4b, 0x8e, 0x1f, 0x02, 0x66, 0x3d, 0x4a, 0x91,
+        0x80, 0x5c, 0x2e, 0xd7, 0x19, 0xa4, 0x63, 0xf0 }};
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* precondition: set the buffer to null / 0. */
+    buffer.data = nullptr; buffer.size = 0;
+
+    /* This method populates the message buffer on success. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_req_artifact_txn_page_get(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET,
+                    &EXPECTED_ARTIFACT_ID, &EXPECTED_CURSOR,
+                    EXPECTED_DIRECTION, EXPECTED_PAGE_SIZE, true));
+
+    /* compute the message size. */
+    size_t message_size = 5 * sizeof(uint32_t) + 2 * 16;
+
+    /* the buffer has been initialized. */
+    TEST_ASSERT(nullptr != buffer.data);
+    TEST_ASSERT(message_size == buffer.size);
+
+    /* verify that the request id and offset is set correctly. */
+    const uint32_t* u32arr = (const uint32_t*)buffer.data;
+    TEST_EXPECT(htonl(PROTOCOL_REQ_ID_ARTIFACT_TXN_PAGE_GET) == u32arr[0]);
+    TEST_EXPECT(htonl(EXPECTED_OFFSET) == u32arr[1]);
+
+    /* verify that the artifact id and cursor are set correctly. */
+    const uint8_t* barr = (const uint8_t*)(u32arr + 2);
+    TEST_EXPECT(0 == memcmp(barr, &EXPECTED_ARTIFACT_ID, 16));
+    TEST_EXPECT(0 == memcmp(barr + 16, &EXPECTED_CURSOR, 16));
+
+    /* verify that the page parameters are set correctly. */
+    TEST_EXPECT(htonl(EXPECTED_DIRECTION) == u32arr[10]);
+    TEST_EXPECT(htonl(EXPECTED_PAGE_SIZE) == u32arr[11]);
+    TEST_EXPECT(htonl(1) == u32arr[12]);
+
+    /* clean up. */
+    dispose((disposable_t*)&buffer);
+    dispose((disposable_t*)&alloc_opts);
+}
@@ -0,0 +1,138 @@
+/**
+ * \file
+ * test/protocol/test_vcblockchain_protocol_encode_req_artifact_unsubscribe.cpp
+ *
+ * Unit tests for encoding the artifact unsubscription request.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <arpa/inet.h>
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/limits.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_protocol_encode_req_artifact_unsubscribe);
+
+/**
+ * This method should perform null checks on its pointer parameters.
+ */
+TEST(parameter_check)
+{
+    const uint32_t EXPECTED_OFFSET = 97;
+    const size_t MAX_COUNT =
+        VCBLOCKCHAIN_LIMIT_MAXIMUM_ARTIFACT_SUBSCRIPTION_COUNT;
+    const vpr_uuid ARTIFACT_IDS[1] = { { .data = {
+        0x5d, 0x1a, 0x93, 0x0e, 0x7c, 0x24, 0x4b, 0x8f,
+        0xa6, 0x31, 0x0d, 0xe2, 0x58, 0x4f, 0x96, 0x1c } } };
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* This method performs null checks on pointer parameters. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_req_artifact_unsubscribe(
+                    nullptr, &alloc_opts, EXPECTED_OFFSET, ARTIFACT_IDS, 1));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_req_artifact_unsubscribe(
+                    &buffer, nullptr, EXPECTED_OFFSET, ARTIFACT_IDS, 1));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_req_artifact_unsubscribe(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, nullptr, 1));
+
+    /* an oversized unsubscription is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_req_artifact_unsubscribe(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, ARTIFACT_IDS,
+                    MAX_COUNT + 1));
+
+    /* clean up. */
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * If valid parameters are provided, this method encodes a request message.
+ */
+TEST(happy_path)
+{
+    const uint32_t EXPECTED_OFFSET = 97;
+    const vpr_uuid ARTIFACT_IDS[2] = {
+        { .data = {
+            0x5d, 0x1a, 0x93, 0x0e, 0x7c, 0x24, 0x4b, 0x8f,
+            0xa6, 0x31, 0x0d, 0xe2, 0x58, 0x4f, 0x96, 0x1c } },
+        { .data = {
+            0x0b, 0xe4, 0x27, 0x6a, 0x19, 0xd3, 0x45, 0x70,
+            0x8c, 0x5e, 0xf2, 0x03, 0x6d, 0xa1, 0x3b, 0x94 } } };
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* precondition: set the buffer to null / 0. */
+    buffer.data = nullptr; buffer.size = 0;
+
+    /* This method encodes the request. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_req_artifact_unsubscribe(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, ARTIFACT_IDS, 2));
+
+    /* the buffer has been initialized. */
+    TEST_ASSERT(nullptr != buffer.data);
+    TEST_ASSERT(3 * sizeof(uint32_t) + sizeof(ARTIFACT_IDS) == buffer.size);
+
+    /* verify that the request id, offset, and count are set correctly. */
+    const uint32_t* u32arr = (const uint32_t*)buffer.data;
+    TEST_EXPECT(htonl(PROTOCOL_REQ_ID_ARTIFACT_UNSUBSCRIBE) == u32arr[0]);
+    TEST_EXPECT(htonl(EXPECTED_OFFSET) == u32arr[1]);
+    TEST_EXPECT(htonl(2) == u32arr[2]);
+
+    /* verify that the artifact ids have been encoded. */
+    TEST_EXPECT(0 == memcmp(ARTIFACT_IDS, u32arr + 3, sizeof(ARTIFACT_IDS)));
+
+    /* clean up. */
+    dispose((disposable_t*)&buffer);
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * An empty unsubscription, which removes every artifact, can be encoded.
+ */
+TEST(remove_all)
+{
+    const uint32_t EXPECTED_OFFSET = 97;
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* This method encodes the request. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_req_artifact_unsubscribe(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, nullptr, 0));
+
+    /* the request holds only the header. */
+    TEST_ASSERT(3 * sizeof(uint32_t) == buffer.size);
+    const uint32_t* u32arr = (const uint32_t*)buffer.data;
+    TEST_EXPECT(htonl(PROTOCOL_REQ_ID_ARTIFACT_UNSUBSCRIBE) == u32arr[0]);
+    TEST_EXPECT(htonl(EXPECTED_OFFSET) == u32arr[1]);
+    TEST_EXPECT(htonl(0) == u32arr[2]);
+
+    /* clean up. */
+    dispose((disposable_t*)&buffer);
+    dispose((disposable_t*)&alloc_opts);
+}
@@ -0,0 +1,181 @@
+/**
+ * \file test/protocol/test_vcblockchain_protocol_encode_req_batch.cpp
+ *
+ * Unit tests for encoding the batch request.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <arpa/inet.h>
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/limits.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_protocol_encode_req_batch);
+
+/**
+ * This method should perform null checks on its pointer parameters.
+ */
+TEST(parameter_check)
+{
+    const uint32_t EXPECTED_OFFSET = 97;
+    const uint8_t REQUEST[8] = {
+        0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01 };
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+    vccrypt_buffer_t requests[1];
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* set up the request. */
+    requests[0].data = (void*)REQUEST;
+    requests[0].size = sizeof(REQUEST);
+
+    /* This method performs null checks on pointer parameters. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_req_batch(
+                    nullptr, &alloc_opts, EXPECTED_OFFSET, requests, 1));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_req_batch(
+                    &buffer, nullptr, EXPECTED_OFFSET, requests, 1));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_req_batch(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, nullptr, 1));
+
+    /* empty or oversized batches are rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_req_batch(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, requests, 0));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_req_batch(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, requests,
+                    VCBLOCKCHAIN_LIMIT_MAXIMUM_BATCH_COUNT + 1));
+
+    /* a request without a request id and offset is rejected. */
+    requests[0].size = 4;
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_req_batch(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, requests, 1));
+
+    /* clean up. */
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * A batch can't hold another batch.
+ */
+TEST(nested_batch)
+{
+    const uint32_t EXPECTED_OFFSET = 97;
+    const uint8_t NESTED_REQUEST[20] = {
+        0x00, 0x00, 0x00, 0x40, /* batch. */
+        0x00, 0x00, 0x00, 0x01, /* offset. */
+        0x00, 0x00, 0x00, 0x01, /* count. */
+        0x00, 0x00, 0x00, 0x04, /* size. */
+        0x00, 0x00, 0x00, 0x02 };
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+    vccrypt_buffer_t requests[1];
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* set up the request. */
+    requests[0].data = (void*)NESTED_REQUEST;
+    requests[0].size = sizeof(NESTED_REQUEST);
+
+    /* the nested batch is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_req_batch(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, requests, 1));
+
+    /* clean up. */
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * If valid parameters are provided, this method encodes a request message.
+ */
+TEST(happy_path)
+{
+    const uint32_t EXPECTED_OFFSET = 97;
+    const uint32_t EXPECTED_TXN_OFFSET = 98;
+    const uint32_t EXPECTED_HEIGHT_OFFSET = 99;
+    const uint64_t EXPECTED_HEIGHT = 1234;
+    const vpr_uuid EXPECTED_TXN_ID = { .data = {
+        0xca, 0x14, 0x0d, 0x1e, 0x5b, 0xcf, 0x47, 0xa9,
+        0xab, 0xf7, 0xbc, 0xd8, 0xfa, 0xdb, 0x48, 0x27 }};
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+    vccrypt_buffer_t requests[2];
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* encode the requests in this batch. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_req_txn_get(
+                    &requests[0], &alloc_opts, EXPECTED_TXN_OFFSET,
+                    &EXPECTED_TXN_ID));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_req_block_id_by_height_get(
+                    &requests[1], &alloc_opts, EXPECTED_HEIGHT_OFFSET,
+                    EXPECTED_HEIGHT));
+
+    /* precondition: set the buffer to null / 0. */
+    buffer.data = nullptr; buffer.size = 0;
+
+    /* This method populates the message buffer on success. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_req_batch(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, requests, 2));
+
+    /* compute the message size. */
+    size_t message_size =
+        3 * sizeof(uint32_t)
+      + sizeof(uint32_t) + requests[0].size
+      + sizeof(uint32_t) + requests[1].size;
+
+    /* the buffer has been initialized. */
+    TEST_ASSERT(nullptr != buffer.data);
+    TEST_ASSERT(message_size == buffer.size);
+
+    /* verify that the request id, offset, and count are set correctly. */
+    const uint32_t* u32arr = (const uint32_t*)buffer.data;
+    TEST_EXPECT(htonl(PROTOCOL_REQ_ID_BATCH) == u32arr[0]);
+    TEST_EXPECT(htonl(EXPECTED_OFFSET) == u32arr[1]);
+    TEST_EXPECT(htonl(2) == u32arr[2]);
+
+    /* verify that each request is size prefixed and copied. */
+    const uint8_t* barr = (const uint8_t*)(u32arr + 3);
+    uint32_t net_size;
+    memcpy(&net_size, barr, sizeof(net_size));
+    TEST_EXPECT(htonl(requests[0].size) == net_size);
+    TEST_EXPECT(0 == memcmp(barr + 4, requests[0].data, requests[0].size));
+    barr += 4 + requests[0].size;
+    memcpy(&net_size, barr, sizeof(net_size));
+    TEST_EXPECT(htonl(requests[1].size) == net_size);
+    TEST_EXPECT(0 == memcmp(barr + 4, requests[1].data, requests[1].size));
+
+    /* clean up. */
+    dispose((disposable_t*)&requests[0]);
+    dispose((disposable_t*)&requests[1]);
+    dispose((disposable_t*)&buffer);
+    dispose((disposable_t*)&alloc_opts);
+}
@@ -0,0 +1,111 @@
+/**
+ * \file
+ * test/protocol/test_vcblockchain_protocol_encode_req_block_range_get.cpp
+ *
+ * Unit tests for encoding the block range get request.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <arpa/inet.h>
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/byteswap.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_protocol_encode_req_block_range_get);
+
+/**
+ * This method should perform null checks on its pointer parameters.
+ */
+TEST(parameter_check)
+{
+    const uint32_t EXPECTED_OFFSET = 97;
+    const uint64_t EXPECTED_START_HEIGHT = 1000;
+    const uint32_t EXPECTED_COUNT = 50;
+    const uint32_t EXPECTED_MAX_BYTES = 65536;
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* This method performs null checks on pointer parameters. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_req_block_range_get(
+                    nullptr, &alloc_opts, EXPECTED_OFFSET,
+                    EXPECTED_START_HEIGHT, EXPECTED_COUNT,
+                    EXPECTED_MAX_BYTES));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_req_block_range_get(
+                    &buffer, nullptr, EXPECTED_OFFSET, EXPECTED_START_HEIGHT,
+                    EXPECTED_COUNT, EXPECTED_MAX_BYTES));
+
+    /* an empty range is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_req_block_range_get(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET,
+                    EXPECTED_START_HEIGHT, 0, EXPECTED_MAX_BYTES));
+
+    /* clean up. */
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * If valid parameters are provided, this method encodes a request message.
+ */
+TEST(happy_path)
+{
+    const uint32_t EXPECTED_OFFSET = 97;
+    const uint64_t EXPECTED_START_HEIGHT = 1000;
+    const uint32_t EXPECTED_COUNT = 50;
+    const uint32_t EXPECTED_MAX_BYTES = 65536;
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* precondition: set the buffer to null / 0. */
+    buffer.data = nullptr; buffer.size = 0;
+
+    /* This method populates the message buffer on success. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_req_block_range_get(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET,
+                    EXPECTED_START_HEIGHT, EXPECTED_COUNT,
+                    EXPECTED_MAX_BYTES));
+
+    /* compute the message size. */
+    size_t message_size = 4 * sizeof(uint32_t) + sizeof(uint64_t);
+
+    /* the buffer has been initialized. */
+    TEST_ASSERT(nullptr != buffer.data);
+    TEST_ASSERT(message_size == buffer.size);
+
+    /* verify that the request id and offset is set correctly. */
+    const uint32_t* u32arr = (const uint32_t*)buffer.data;
+    TEST_EXPECT(htonl(PROTOCOL_REQ_ID_BLOCK_RANGE_GET) == u32arr[0]);
+    TEST_EXPECT(htonl(EXPECTED_OFFSET) == u32arr[1]);
+
+    /* verify that the start height is set correctly. */
+    uint64_t net_start_height;
+    memcpy(&net_start_height, u32arr + 2, sizeof(net_start_height));
+    TEST_EXPECT(htonll(net_start_height) == EXPECTED_START_HEIGHT);
+
+    /* verify that the count and byte limit are set correctly. */
+    TEST_EXPECT(htonl(EXPECTED_COUNT) == u32arr[4]);
+    TEST_EXPECT(htonl(EXPECTED_MAX_BYTES) == u32arr[5]);
+
+    /* clean up. */
+    dispose((disposable_t*)&buffer);
+    dispose((disposable_t*)&alloc_opts);
+}
@@ -0,0 +1,104 @@
+/**
+ * \file
+ * test/protocol/test_vcblockchain_protocol_encode_req_block_txn_ids_get.cpp
+ *
+ * Unit tests for encoding the block transaction ids get request.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <arpa/inet.h>
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_protocol_encode_req_block_txn_ids_get);
+
+/**
+ * This method should perform null checks on its pointer parameters.
+ */
+TEST(parameter_check)
+{
+    const uint32_t EXPECTED_OFFSET = 97;
+    const vpr_uuid EXPECTED_BLOCK_ID = { .data = {
+        0x4c, 0x0e, 0x6b, 0x2f, 0x91, 0x3a, 0x4d, 0x57,
+        0xa8, 0x10, 0x3d, 0x62, 0xc5, 0x7e, 0x19, 0xb4 } };
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* This method performs null checks on pointer parameters. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_req_block_txn_ids_get(
+                    nullptr, &alloc_opts, EXPECTED_OFFSET, &EXPECTED_BLOCK_ID,
+                    true));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_req_block_txn_ids_get(
+                    &buffer, nullptr, EXPECTED_OFFSET, &EXPECTED_BLOCK_ID,
+                    true));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_req_block_txn_ids_get(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, nullptr, true));
+
+    /* clean up. */
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * If valid parameters are provided, this method encodes a request message.
+ */
+TEST(happy_path)
+{
+    const uint32_t EXPECTED_OFFSET = 97;
+    const vpr_uuid EXPECTED_BLOCK_ID = { .data = {
+        0x4c, 0x0e, 0x6b, 0x2f, 0x91, 0x3a, 0x4d, 0x57,
+        0xa8, 0x10, 0x3d, 0x62, 0xc5, 0x7e, 0x19, 0xb4 } };
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* precondition: set the buffer to null / 0. */
+    buffer.data = nullptr; buffer.size = 0;
+
+    /* This method populates the message buffer on success. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_req_block_txn_ids_get(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, &EXPECTED_BLOCK_ID,
+                    true));
+
+    /* compute the message size. */
+    size_t message_size = 3 * sizeof(uint32_t) + sizeof(EXPECTED_BLOCK_ID);
+
+    /* the buffer has been initialized. */
+    TEST_ASSERT(nullptr != buffer.data);
+    TEST_ASSERT(message_size == buffer.size);
+
+    /* verify that the request id and offset is set correctly. */
+    const uint32_t* u32arr = (const uint32_t*)buffer.data;
+    TEST_EXPECT(htonl(PROTOCOL_REQ_ID_BLOCK_TXN_IDS_GET) == u32arr[0]);
+    TEST_EXPECT(htonl(EXPECTED_OFFSET) == u32arr[1]);
+
+    /* verify that the block id is set correctly. */
+    TEST_EXPECT(
+        0 == memcmp(
+                u32arr + 2, &EXPECTED_BLOCK_ID, sizeof(EXPECTED_BLOCK_ID)));
+
+    /* verify that the include states flag is set. */
+    TEST_EXPECT(htonl(1) == u32arr[6]);
+
+    /* clean up. */
+    dispose((disposable_t*)&buffer);
+    dispose((disposable_t*)&alloc_opts);
+}
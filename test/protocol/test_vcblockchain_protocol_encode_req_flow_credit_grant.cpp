@@ -0,0 +1,66 @@
+/**
+ * \file test/protocol/test_vcblockchain_protocol_encode_req_flow_credit_grant.cpp
+ *
+ * Unit tests for encoding the flow credit grant request.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <arpa/inet.h>
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/byteswap.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/data.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_protocol_encode_req_flow_credit_grant);
+
+/**
+ * Test the basics of the encoding.
+ */
+TEST(basics)
+{
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t out;
+    const uint32_t EXPECTED_OFFSET = 23;
+    const uint32_t EXPECTED_REQUEST_CREDITS = 32;
+    const uint64_t EXPECTED_BYTE_CREDITS = 0x0000000100000002;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* encoding the flow credit grant request should succeed. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_req_flow_credit_grant(
+                    &out, &alloc_opts, EXPECTED_OFFSET,
+                    EXPECTED_REQUEST_CREDITS, EXPECTED_BYTE_CREDITS));
+
+    /* get a byte pointer to the output buffer. */
+    TEST_ASSERT(nullptr != out.data);
+    const uint8_t* buf = (const uint8_t*)out.data;
+    size_t size = out.size;
+
+    /* the header comes first, followed by the request credits. */
+    uint32_t net_values[3];
+    TEST_ASSERT(size >= sizeof(net_values));
+    memcpy(net_values, buf, sizeof(net_values));
+    TEST_EXPECT(PROTOCOL_REQ_ID_FLOW_CREDIT_GRANT == ntohl(net_values[0]));
+    TEST_EXPECT(EXPECTED_OFFSET == ntohl(net_values[1]));
+    TEST_EXPECT(EXPECTED_REQUEST_CREDITS == ntohl(net_values[2]));
+    buf += sizeof(net_values); size -= sizeof(net_values);
+
+    /* finally, the byte credits. */
+    uint64_t net_byte_credits;
+    TEST_ASSERT(sizeof(net_byte_credits) == size);
+    memcpy(&net_byte_credits, buf, sizeof(net_byte_credits));
+    TEST_EXPECT(EXPECTED_BYTE_CREDITS == ntohll(net_byte_credits));
+
+    /* clean up. */
+    dispose((disposable_t*)&out);
+    dispose((disposable_t*)&alloc_opts);
+}
@@ -0,0 +1,149 @@
+/**
+ * \file
+ * test/protocol/test_vcblockchain_protocol_encode_req_handshake_resume.cpp
+ *
+ * Unit tests for encoding the handshake resume request.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <arpa/inet.h>
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/data.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_protocol_encode_req_handshake_resume);
+
+/**
+ * Test the basics of the encoding.
+ */
+TEST(basics)
+{
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t suite;
+    vpr_uuid client_id = { .data = {
+        0x0d, 0x7e, 0x42, 0x9c, 0x51, 0xa8, 0x4f, 0x3b,
+        0x86, 0x2e, 0xc9, 0x14, 0x70, 0xdb, 0x35, 0x6a } };
+    vccrypt_buffer_t client_key_nonce;
+    vccrypt_buffer_t ticket;
+    vccrypt_buffer_t out;
+    const uint32_t EXPECTED_OFFSET = 17;
+
+    /* register the suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create the crypto suite. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_options_init(
+                    &suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1));
+
+    /* create a buffer for holding the key nonce. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_buffer_init_for_cipher_key_agreement_nonce(
+                    &suite, &client_key_nonce));
+    memset(client_key_nonce.data, 0xFE, client_key_nonce.size);
+
+    /* create the ticket. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_buffer_init(&ticket, &alloc_opts, 80));
+    memset(ticket.data, 0x7C, ticket.size);
+
+    /* encoding the handshake resume request should succeed. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_req_handshake_resume(
+                    &out, &suite, EXPECTED_OFFSET, &client_id,
+                    &client_key_nonce, &ticket));
+
+    /* get a byte pointer to the output buffer. */
+    TEST_ASSERT(nullptr != out.data);
+    const uint8_t* buf = (const uint8_t*)out.data;
+    size_t size = out.size;
+
+    /* the header and record come first. */
+    uint32_t net_values[4];
+    TEST_ASSERT(size >= sizeof(net_values));
+    memcpy(net_values, buf, sizeof(net_values));
+    TEST_EXPECT(PROTOCOL_REQ_ID_HANDSHAKE_RESUME == ntohl(net_values[0]));
+    TEST_EXPECT(EXPECTED_OFFSET == ntohl(net_values[1]));
+    TEST_EXPECT(PROTOCOL_VERSION_0_3_RESUMPTION == ntohl(net_values[2]));
+    TEST_EXPECT(VCCRYPT_SUITE_VELO_V1 == ntohl(net_values[3]));
+    buf += sizeof(net_values); size -= sizeof(net_values);
+
+    /* then the client id. */
+    TEST_ASSERT(size >= sizeof(client_id));
+    TEST_EXPECT(0 == memcmp(buf, &client_id, sizeof(client_id)));
+    buf += sizeof(client_id); size -= sizeof(client_id);
+
+    /* then the key nonce. */
+    TEST_ASSERT(size >= client_key_nonce.size);
+    TEST_EXPECT(0 == memcmp(buf, client_key_nonce.data, client_key_nonce.size));
+    buf += client_key_nonce.size; size -= client_key_nonce.size;
+
+    /* finally, the ticket. */
+    TEST_ASSERT(ticket.size == size);
+    TEST_EXPECT(0 == memcmp(buf, ticket.data, ticket.size));
+
+    /* clean up. */
+    dispose((disposable_t*)&out);
+    dispose((disposable_t*)&ticket);
+    dispose((disposable_t*)&client_key_nonce);
+    dispose((disposable_t*)&suite);
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * An empty ticket is rejected.
+ */
+TEST(empty_ticket)
+{
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t suite;
+    vpr_uuid client_id;
+    vccrypt_buffer_t client_key_nonce;
+    vccrypt_buffer_t ticket = { };
+    vccrypt_buffer_t out;
+
+    /* register the suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create the crypto suite. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_options_init(
+                    &suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1));
+
+    /* create a buffer for holding the key nonce. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_buffer_init_for_cipher_key_agreement_nonce(
+                    &suite, &client_key_nonce));
+    memset(client_key_nonce.data, 0xFE, client_key_nonce.size);
+    memset(&client_id, 0, sizeof(client_id));
+
+    /* encoding fails. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_req_handshake_resume(
+                    &out, &suite, 0U, &client_id, &client_key_nonce,
+                    &ticket));
+
+    /* clean up. */
+    dispose((disposable_t*)&client_key_nonce);
+    dispose((disposable_t*)&suite);
+    dispose((disposable_t*)&alloc_opts);
+}
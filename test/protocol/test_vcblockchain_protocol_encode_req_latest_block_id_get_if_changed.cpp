@@ -0,0 +1,101 @@
+/**
+ * \file
+ * test/protocol/test_vcblockchain_protocol_encode_req_latest_block_id_get_if_changed.cpp
+ *
+ * Unit tests for encoding the conditional latest block id get request.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <arpa/inet.h>
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_protocol_encode_req_latest_block_id_get_if_changed);
+
+/**
+ * This method should perform null checks on its pointer parameters.
+ */
+TEST(parameter_check)
+{
+    const uint32_t EXPECTED_OFFSET = 17;
+    const uint32_t EXPECTED_TIMEOUT = 5000;
+    const vpr_uuid EXPECTED_BLOCK_ID = { .data = {
+        0x4f, 0x0e, 0x26, 0x49, 0xc3, 0xf4, 0xc6, 0x11,
+        0x95, 0xe6, 0x24, 0xd4, 0x12, 0xfc, 0x7c, 0x83 } };
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* This method performs null checks on pointer parameters. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_req_latest_block_id_get_if_changed(
+                    nullptr, &alloc_opts, EXPECTED_OFFSET, EXPECTED_TIMEOUT,
+                    &EXPECTED_BLOCK_ID));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_req_latest_block_id_get_if_changed(
+                    &buffer, nullptr, EXPECTED_OFFSET, EXPECTED_TIMEOUT,
+                    &EXPECTED_BLOCK_ID));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_req_latest_block_id_get_if_changed(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, EXPECTED_TIMEOUT,
+                    nullptr));
+
+    /* clean up. */
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * If valid parameters are provided, this method encodes a request message.
+ */
+TEST(happy_path)
+{
+    const uint32_t EXPECTED_OFFSET = 17;
+    const uint32_t EXPECTED_TIMEOUT = 5000;
+    const vpr_uuid EXPECTED_BLOCK_ID = { .data = {
+        0x4f, 0x0e, 0x26, 0x49, 0xc3, 0xf4, 0xc6, 0x11,
+        0x95, 0xe6, 0x24, 0xd4, 0x12, 0xfc, 0x7c, 0x83 } };
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* precondition: set the buffer to null / 0. */
+    buffer.data = nullptr; buffer.size = 0;
+
+    /* This method populates the message buffer on success. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_req_latest_block_id_get_if_changed(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, EXPECTED_TIMEOUT,
+                    &EXPECTED_BLOCK_ID));
+
+    /* the buffer has been initialized. */
+    TEST_ASSERT(nullptr != buffer.data);
+    TEST_ASSERT(3 * sizeof(uint32_t) + 16 == buffer.size);
+
+    /* verify that the request id, offset, and timeout are set correctly. */
+    const uint32_t* u32arr = (const uint32_t*)buffer.data;
+    TEST_EXPECT(
+        htonl(PROTOCOL_REQ_ID_LATEST_BLOCK_ID_GET_IF_CHANGED) == u32arr[0]);
+    TEST_EXPECT(htonl(EXPECTED_OFFSET) == u32arr[1]);
+    TEST_EXPECT(htonl(EXPECTED_TIMEOUT) == u32arr[2]);
+
+    /* verify that the block id is set correctly. */
+    TEST_EXPECT(0 == memcmp(u32arr + 3, &EXPECTED_BLOCK_ID, 16));
+
+    /* clean up. */
+    dispose((disposable_t*)&buffer);
+    dispose((disposable_t*)&alloc_opts);
+}
@@ -0,0 +1,104 @@
+/**
+ * \file test/protocol/test_vcblockchain_protocol_encode_req_rekey.cpp
+ *
+ * Unit tests for encoding the rekey request.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <arpa/inet.h>
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/byteswap.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/data.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_protocol_encode_req_rekey);
+
+/**
+ * Test the basics of the encoding.
+ */
+TEST(basics)
+{
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t suite;
+    vccrypt_buffer_t client_key_nonce;
+    vccrypt_buffer_t short_nonce;
+    vccrypt_buffer_t out;
+    const uint32_t EXPECTED_OFFSET = 23;
+    const uint64_t EXPECTED_CLIENT_SWITCH_IV = 0x0000000100000002;
+
+    /* register the suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create the crypto suite. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_options_init(
+                    &suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1));
+
+    /* create a buffer for holding the key nonce. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_buffer_init_for_cipher_key_agreement_nonce(
+                    &suite, &client_key_nonce));
+    memset(client_key_nonce.data, 0xC3, client_key_nonce.size);
+
+    /* create a nonce of the wrong size. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_buffer_init(
+                    &short_nonce, &alloc_opts, client_key_nonce.size - 1));
+
+    /* a nonce of the wrong size is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_req_rekey(
+                    &out, &suite, EXPECTED_OFFSET, EXPECTED_CLIENT_SWITCH_IV,
+                    &short_nonce));
+
+    /* encoding the rekey request should succeed. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_req_rekey(
+                    &out, &suite, EXPECTED_OFFSET, EXPECTED_CLIENT_SWITCH_IV,
+                    &client_key_nonce));
+
+    /* get a byte pointer to the output buffer. */
+    TEST_ASSERT(nullptr != out.data);
+    const uint8_t* buf = (const uint8_t*)out.data;
+    size_t size = out.size;
+
+    /* the header comes first. */
+    uint32_t net_values[2];
+    TEST_ASSERT(size >= sizeof(net_values));
+    memcpy(net_values, buf, sizeof(net_values));
+    TEST_EXPECT(PROTOCOL_REQ_ID_REKEY == ntohl(net_values[0]));
+    TEST_EXPECT(EXPECTED_OFFSET == ntohl(net_values[1]));
+    buf += sizeof(net_values); size -= sizeof(net_values);
+
+    /* then the client switch IV. */
+    uint64_t net_switch_iv;
+    TEST_ASSERT(size >= sizeof(net_switch_iv));
+    memcpy(&net_switch_iv, buf, sizeof(net_switch_iv));
+    TEST_EXPECT(EXPECTED_CLIENT_SWITCH_IV == ntohll(net_switch_iv));
+    buf += sizeof(net_switch_iv); size -= sizeof(net_switch_iv);
+
+    /* finally, the key nonce. */
+    TEST_ASSERT(client_key_nonce.size == size);
+    TEST_EXPECT(0 == memcmp(buf, client_key_nonce.data, client_key_nonce.size));
+
+    /* clean up. */
+    dispose((disposable_t*)&out);
+    dispose((disposable_t*)&short_nonce);
+    dispose((disposable_t*)&client_key_nonce);
+    dispose((disposable_t*)&suite);
+    dispose((disposable_t*)&alloc_opts);
+}
@@ -0,0 +1,148 @@
+/**
+ * \file
+ * test/protocol/test_vcblockchain_protocol_encode_req_transaction_submit_batch.cpp
+ *
+ * Unit tests for encoding the transaction submit batch request.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <arpa/inet.h>
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/limits.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_protocol_encode_req_transaction_submit_batch);
+
+/**
+ * This method should perform null checks on its pointer parameters.
+ */
+TEST(parameter_check)
+{
+    const uint32_t EXPECTED_OFFSET = 97;
+    const uint8_t CERT[3] = { 0x01, 0x02, 0x03 };
+    protocol_transaction_submit_batch_item txn;
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* set up the transaction. */
+    memset(&txn, 0, sizeof(txn));
+    txn.cert = CERT;
+    txn.cert_size = sizeof(CERT);
+
+    /* This method performs null checks on pointer parameters. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_req_transaction_submit_batch(
+                    nullptr, &alloc_opts, EXPECTED_OFFSET, &txn, 1));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_req_transaction_submit_batch(
+                    &buffer, nullptr, EXPECTED_OFFSET, &txn, 1));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_req_transaction_submit_batch(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, nullptr, 1));
+
+    /* an empty or oversized batch is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_req_transaction_submit_batch(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, &txn, 0));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_req_transaction_submit_batch(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, &txn,
+                    VCBLOCKCHAIN_LIMIT_MAXIMUM_BATCH_COUNT + 1));
+
+    /* a transaction without a certificate is rejected. */
+    txn.cert = nullptr;
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_req_transaction_submit_batch(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, &txn, 1));
+
+    /* clean up. */
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * If valid parameters are provided, this method encodes a request message.
+ */
+TEST(happy_path)
+{
+    const uint32_t EXPECTED_OFFSET = 97;
+    const uint8_t CERT1[3] = { 0x01, 0x02, 0x03 };
+    const uint8_t CERT2[2] = { 0x04, 0x05 };
+    protocol_transaction_submit_batch_item txns[2];
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* set up the transactions. */
+    memset(txns, 0, sizeof(txns));
+    memset(&txns[0].txn_id, 0x11, sizeof(txns[0].txn_id));
+    memset(&txns[0].artifact_id, 0x12, sizeof(txns[0].artifact_id));
+    txns[0].cert = CERT1;
+    txns[0].cert_size = sizeof(CERT1);
+    memset(&txns[1].txn_id, 0x21, sizeof(txns[1].txn_id));
+    memset(&txns[1].artifact_id, 0x22, sizeof(txns[1].artifact_id));
+    txns[1].cert = CERT2;
+    txns[1].cert_size = sizeof(CERT2);
+
+    /* precondition: set the buffer to null / 0. */
+    buffer.data = nullptr; buffer.size = 0;
+
+    /* This method populates the message buffer on success. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_req_transaction_submit_batch(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, txns, 2));
+
+    /* compute the message size. */
+    size_t message_size =
+        3 * sizeof(uint32_t)
+      + 2 * (sizeof(uint32_t) + 2 * 16)
+      + sizeof(CERT1) + sizeof(CERT2);
+
+    /* the buffer has been initialized. */
+    TEST_ASSERT(nullptr != buffer.data);
+    TEST_ASSERT(message_size == buffer.size);
+
+    /* verify the request id, offset, and count. */
+    const uint32_t* u32arr = (const uint32_t*)buffer.data;
+    TEST_EXPECT(htonl(PROTOCOL_REQ_ID_TRANSACTION_SUBMIT_BATCH) == u32arr[0]);
+    TEST_EXPECT(htonl(EXPECTED_OFFSET) == u32arr[1]);
+    TEST_EXPECT(htonl(2) == u32arr[2]);
+
+    /* verify the first transaction. */
+    const uint8_t* barr = (const uint8_t*)(u32arr + 3);
+    uint32_t net_size;
+    memcpy(&net_size, barr, sizeof(net_size));
+    TEST_EXPECT(htonl(sizeof(CERT1)) == net_size);
+    TEST_EXPECT(0 == memcmp(barr + 4, &txns[0].txn_id, 16));
+    TEST_EXPECT(0 == memcmp(barr + 20, &txns[0].artifact_id, 16));
+    TEST_EXPECT(0 == memcmp(barr + 36, CERT1, sizeof(CERT1)));
+
+    /* verify the second transaction. */
+    barr += 36 + sizeof(CERT1);
+    memcpy(&net_size, barr, sizeof(net_size));
+    TEST_EXPECT(htonl(sizeof(CERT2)) == net_size);
+    TEST_EXPECT(0 == memcmp(barr + 4, &txns[1].txn_id, 16));
+    TEST_EXPECT(0 == memcmp(barr + 20, &txns[1].artifact_id, 16));
+    TEST_EXPECT(0 == memcmp(barr + 36, CERT2, sizeof(CERT2)));
+
+    /* clean up. */
+    dispose((disposable_t*)&buffer);
+    dispose((disposable_t*)&alloc_opts);
+}
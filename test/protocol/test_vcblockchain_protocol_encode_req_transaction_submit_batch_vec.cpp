@@ -0,0 +1,146 @@
+/**
+ * \file
+ * test/protocol/test_vcblockchain_protocol_encode_req_transaction_submit_batch_vec.cpp
+ *
+ * Unit tests for encoding the transaction submit batch request as a segment
+ * vector.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vector>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_protocol_encode_req_transaction_submit_batch_vec);
+
+/**
+ * This method should perform null checks on its pointer parameters.
+ */
+TEST(parameter_check)
+{
+    const uint32_t EXPECTED_OFFSET = 97;
+    const uint8_t CERT[3] = { 0x01, 0x02, 0x03 };
+    protocol_transaction_submit_batch_item txn;
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+    const vcblockchain_psock_iovec* vec;
+    size_t vec_count;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* set up the transaction. */
+    memset(&txn, 0, sizeof(txn));
+    txn.cert = CERT;
+    txn.cert_size = sizeof(CERT);
+
+    /* This method performs null checks on pointer parameters. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_req_transaction_submit_batch_vec(
+                    nullptr, &alloc_opts, EXPECTED_OFFSET, &txn, 1, &vec,
+                    &vec_count));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_req_transaction_submit_batch_vec(
+                    &buffer, nullptr, EXPECTED_OFFSET, &txn, 1, &vec,
+                    &vec_count));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_req_transaction_submit_batch_vec(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, nullptr, 1, &vec,
+                    &vec_count));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_req_transaction_submit_batch_vec(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, &txn, 1, nullptr,
+                    &vec_count));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_req_transaction_submit_batch_vec(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, &txn, 1, &vec,
+                    nullptr));
+
+    /* an empty batch is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_req_transaction_submit_batch_vec(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, &txn, 0, &vec,
+                    &vec_count));
+
+    /* clean up. */
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * The gathered segments match the contiguous encoding, and the certificate
+ * segments reference the caller's certificates.
+ */
+TEST(matches_contiguous_encoding)
+{
+    const uint32_t EXPECTED_OFFSET = 97;
+    const uint8_t CERT1[3] = { 0x01, 0x02, 0x03 };
+    const uint8_t CERT2[2] = { 0x04, 0x05 };
+    protocol_transaction_submit_batch_item txns[2];
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+    vccrypt_buffer_t vec_buffer;
+    const vcblockchain_psock_iovec* vec;
+    size_t vec_count;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* set up the transactions. */
+    memset(txns, 0, sizeof(txns));
+    memset(&txns[0].txn_id, 0x11, sizeof(txns[0].txn_id));
+    memset(&txns[0].artifact_id, 0x12, sizeof(txns[0].artifact_id));
+    txns[0].cert = CERT1;
+    txns[0].cert_size = sizeof(CERT1);
+    memset(&txns[1].txn_id, 0x21, sizeof(txns[1].txn_id));
+    memset(&txns[1].artifact_id, 0x22, sizeof(txns[1].artifact_id));
+    txns[1].cert = CERT2;
+    txns[1].cert_size = sizeof(CERT2);
+
+    /* encode the request contiguously. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_req_transaction_submit_batch(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, txns, 2));
+
+    /* encode the request as a segment vector. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_req_transaction_submit_batch_vec(
+                    &vec_buffer, &alloc_opts, EXPECTED_OFFSET, txns, 2, &vec,
+                    &vec_count));
+
+    /* there is a header segment and a certificate segment per transaction. */
+    TEST_ASSERT(4U == vec_count);
+    TEST_EXPECT(CERT1 == vec[1].data);
+    TEST_EXPECT(sizeof(CERT1) == vec[1].size);
+    TEST_EXPECT(CERT2 == vec[3].data);
+    TEST_EXPECT(sizeof(CERT2) == vec[3].size);
+
+    /* the gathered segments match the contiguous encoding. */
+    vector<uint8_t> gathered;
+    for (size_t i = 0; i < vec_count; ++i)
+    {
+        const uint8_t* data = (const uint8_t*)vec[i].data;
+        gathered.insert(gathered.end(), data, data + vec[i].size);
+    }
+
+    TEST_ASSERT(buffer.size == gathered.size());
+    TEST_EXPECT(0 == memcmp(buffer.data, gathered.data(), buffer.size));
+
+    /* clean up. */
+    dispose((disposable_t*)&vec_buffer);
+    dispose((disposable_t*)&buffer);
+    dispose((disposable_t*)&alloc_opts);
+}
@@ -0,0 +1,122 @@
+/**
+ * \file
+ * test/protocol/test_vcblockchain_protocol_encode_resp_artifact_notification.cpp
+ *
+ * Unit tests for encoding the artifact notification.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <arpa/inet.h>
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_protocol_encode_resp_artifact_notification);
+
+/**
+ * This method should perform null checks on its pointer parameters.
+ */
+TEST(parameter_check)
+{
+    const uint32_t EXPECTED_OFFSET = 97;
+    const vpr_uuid ID = { .data = {
+        0x5d, 0x1a, 0x93, 0x0e, 0x7c, 0x24, 0x4b, 0x8f,
+        0xa6, 0x31, 0x0d, 0xe2, 0x58, 0x4f, 0x96, 0x1c } };
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* This method performs null checks on pointer parameters. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_resp_artifact_notification(
+                    nullptr, &alloc_opts, EXPECTED_OFFSET, &ID, &ID, &ID, 1));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_resp_artifact_notification(
+                    &buffer, nullptr, EXPECTED_OFFSET, &ID, &ID, &ID, 1));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_resp_artifact_notification(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, nullptr, &ID, &ID,
+                    1));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_resp_artifact_notification(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, &ID, nullptr, &ID,
+                    1));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_resp_artifact_notification(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, &ID, &ID, nullptr,
+                    1));
+
+    /* clean up. */
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * If valid parameters are provided, this method encodes a notification.
+ */
+TEST(happy_path)
+{
+    const uint32_t EXPECTED_OFFSET = 97;
+    const vpr_uuid EXPECTED_ARTIFACT_ID = { .data = {
+        0x5d, 0x1a, 0x93, 0x0e, 0x7c, 0x24, 0x4b, 0x8f,
+        0xa6, 0x31, 0x0d, 0xe2, 0x58, 0x4f, 0x96, 0x1c } };
+    const vpr_uuid EXPECTED_TXN_ID = { .data = {
+        0x0b, 0xe4, 0x27, 0x6a, 0x19, 0xd3, 0x45, 0x70,
+        0x8c, 0x5e, 0xf2, 0x03, 0x6d, 0xa1, 0x3b, 0x94 } };
+    const vpr_uuid EXPECTED_BLOCK_ID = { .data = {
+        0x26, 0x49, 0xc3, 0xf4, 0xc6, 0x11, 0x4f, 0x0e,
+        0x95, 0xe6, 0x24, 0xd4, 0x12, 0xfc, 0x7c, 0x83 } };
+    const uint32_t EXPECTED_TXN_STATE = 0x02;
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* precondition: set the buffer to null / 0. */
+    buffer.data = nullptr; buffer.size = 0;
+
+    /* This method encodes the notification. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_resp_artifact_notification(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET,
+                    &EXPECTED_ARTIFACT_ID, &EXPECTED_TXN_ID,
+                    &EXPECTED_BLOCK_ID, EXPECTED_TXN_STATE));
+
+    /* the buffer has been initialized. */
+    TEST_ASSERT(nullptr != buffer.data);
+    TEST_ASSERT(4 * sizeof(uint32_t) + 3 * 16 == buffer.size);
+
+    /* verify the header. */
+    const uint32_t* u32arr = (const uint32_t*)buffer.data;
+    TEST_EXPECT(htonl(PROTOCOL_REQ_ID_ARTIFACT_NOTIFICATION) == u32arr[0]);
+    TEST_EXPECT(htonl(VCBLOCKCHAIN_STATUS_SUCCESS) == u32arr[1]);
+    TEST_EXPECT(htonl(EXPECTED_OFFSET) == u32arr[2]);
+
+    /* verify the ids. */
+    const uint8_t* barr = (const uint8_t*)(u32arr + 3);
+    TEST_EXPECT(0 == memcmp(barr, &EXPECTED_ARTIFACT_ID, 16));
+    TEST_EXPECT(0 == memcmp(barr + 16, &EXPECTED_TXN_ID, 16));
+    TEST_EXPECT(0 == memcmp(barr + 32, &EXPECTED_BLOCK_ID, 16));
+
+    /* verify the transaction state. */
+    uint32_t net_state;
+    memcpy(&net_state, barr + 48, sizeof(net_state));
+    TEST_EXPECT(htonl(EXPECTED_TXN_STATE) == net_state);
+
+    /* clean up. */
+    dispose((disposable_t*)&buffer);
+    dispose((disposable_t*)&alloc_opts);
+}
@@ -0,0 +1,145 @@
+/**
+ * \file
+ * test/protocol/test_vcblockchain_protocol_encode_resp_artifact_txn_page_get.cpp
+ *
+ * Unit tests for encoding the artifact transaction page get response.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <arpa/inet.h>
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_protocol_encode_resp_artifact_txn_page_get);
+
+/**
+ * This method should perform null checks on its pointer parameters.
+ */
+TEST(parameter_check)
+{
+    const uint32_t EXPECTED_OFFSET = 97;
+    const uint32_t EXPECTED_STATUS = VCBLOCKCHAIN_STATUS_SUCCESS;
+    const vpr_uuid EXPECTED_CURSOR = { .data = {
+        0x4b, 0x8e, 0x1f, 0x02, 0x66, 0x3d, 0x4a, 0x91,
+        0x80, 0x5c, 0x2e, 0xd7, 0x19, 0xa4, 0x63, 0xf0 }};
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+    protocol_txn_page_record record;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* set up a record without a certificate. */
+    memset(&record, 0, sizeof(record));
+
+    /* This method performs null checks on pointer parameters. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_resp_artifact_txn_page_get(
+                    nullptr, &alloc_opts, EXPECTED_OFFSET, EXPECTED_STATUS, 0,
+                    &EXPECTED_CURSOR, &record, 1));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_resp_artifact_txn_page_get(
+                    &buffer, nullptr, EXPECTED_OFFSET, EXPECTED_STATUS, 0,
+                    &EXPECTED_CURSOR, &record, 1));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_resp_artifact_txn_page_get(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, EXPECTED_STATUS, 0,
+                    nullptr, &record, 1));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_resp_artifact_txn_page_get(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, EXPECTED_STATUS, 0,
+                    &EXPECTED_CURSOR, nullptr, 1));
+
+    /* a sized certificate without data is rejected. */
+    record.txn_cert_size = 5;
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_resp_artifact_txn_page_get(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, EXPECTED_STATUS, 0,
+                    &EXPECTED_CURSOR, &record, 1));
+
+    /* clean up. */
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * If valid parameters are provided, this method encodes a response message.
+ */
+TEST(happy_path)
+{
+    const uint32_t EXPECTED_OFFSET = 97;
+    const uint32_t EXPECTED_STATUS = VCBLOCKCHAIN_STATUS_SUCCESS;
+    const uint32_t EXPECTED_FLAGS = PROTOCOL_TXN_PAGE_FLAG_MORE;
+    const uint8_t TXN_CERT[5] = { 0x01, 0x02, 0x03, 0x04, 0x05 };
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+    protocol_txn_page_record record;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* set up the record. */
+    memset(&record, 0, sizeof(record));
+    memset(&record.txn_id, 0x11, sizeof(record.txn_id));
+    memset(&record.prev_txn_id, 0x22, sizeof(record.prev_txn_id));
+    memset(&record.next_txn_id, 0x33, sizeof(record.next_txn_id));
+    memset(&record.artifact_id, 0x44, sizeof(record.artifact_id));
+    memset(&record.block_id, 0x55, sizeof(record.block_id));
+    record.txn_state = 0x09;
+    record.txn_size = sizeof(TXN_CERT);
+    record.txn_cert = TXN_CERT;
+    record.txn_cert_size = sizeof(TXN_CERT);
+
+    /* precondition: set the buffer to null / 0. */
+    buffer.data = nullptr; buffer.size = 0;
+
+    /* This method populates the message buffer on success. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_resp_artifact_txn_page_get(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, EXPECTED_STATUS,
+                    EXPECTED_FLAGS, &record.txn_id, &record, 1));
+
+    /* compute the message size. */
+    size_t record_size =
+        5 * 16 + sizeof(uint64_t) + sizeof(uint32_t) + sizeof(TXN_CERT);
+    size_t message_size =
+        5 * sizeof(uint32_t) + 16 + sizeof(uint32_t) + record_size;
+
+    /* the buffer has been initialized. */
+    TEST_ASSERT(nullptr != buffer.data);
+    TEST_ASSERT(message_size == buffer.size);
+
+    /* verify the header. */
+    const uint32_t* u32arr = (const uint32_t*)buffer.data;
+    TEST_EXPECT(htonl(PROTOCOL_REQ_ID_ARTIFACT_TXN_PAGE_GET) == u32arr[0]);
+    TEST_EXPECT(htonl(EXPECTED_STATUS) == u32arr[1]);
+    TEST_EXPECT(htonl(EXPECTED_OFFSET) == u32arr[2]);
+    TEST_EXPECT(htonl(EXPECTED_FLAGS) == u32arr[3]);
+    TEST_EXPECT(0 == memcmp(u32arr + 4, &record.txn_id, 16));
+    TEST_EXPECT(htonl(1) == u32arr[8]);
+
+    /* verify the record. */
+    TEST_EXPECT(htonl(record_size) == u32arr[9]);
+    const uint8_t* barr = (const uint8_t*)(u32arr + 10);
+    TEST_EXPECT(0 == memcmp(barr, &record.txn_id, 16));
+    TEST_EXPECT(0 == memcmp(barr + 16, &record.prev_txn_id, 16));
+    TEST_EXPECT(0 == memcmp(barr + 32, &record.next_txn_id, 16));
+    TEST_EXPECT(0 == memcmp(barr + 48, &record.artifact_id, 16));
+    TEST_EXPECT(0 == memcmp(barr + 64, &record.block_id, 16));
+    TEST_EXPECT(0 == memcmp(barr + 92, TXN_CERT, sizeof(TXN_CERT)));
+
+    /* clean up. */
+    dispose((disposable_t*)&buffer);
+    dispose((disposable_t*)&alloc_opts);
+}
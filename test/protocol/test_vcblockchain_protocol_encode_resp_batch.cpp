@@ -0,0 +1,157 @@
+/**
+ * \file test/protocol/test_vcblockchain_protocol_encode_resp_batch.cpp
+ *
+ * Unit tests for encoding the batch response.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <arpa/inet.h>
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/limits.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_protocol_encode_resp_batch);
+
+/**
+ * This method should perform null checks on its pointer parameters.
+ */
+TEST(parameter_check)
+{
+    const uint32_t EXPECTED_OFFSET = 97;
+    const uint32_t EXPECTED_STATUS = VCBLOCKCHAIN_STATUS_SUCCESS;
+    const uint32_t EXPECTED_ITEM_STATUS = 0x8001;
+    const uint32_t STATUSES[1] = { EXPECTED_ITEM_STATUS };
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+    vccrypt_buffer_t responses[1];
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* set up an empty response. */
+    responses[0].data = nullptr;
+    responses[0].size = 0;
+
+    /* This method performs null checks on pointer parameters. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_resp_batch(
+                    nullptr, &alloc_opts, EXPECTED_OFFSET, EXPECTED_STATUS,
+                    STATUSES, responses, 1));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_resp_batch(
+                    &buffer, nullptr, EXPECTED_OFFSET, EXPECTED_STATUS,
+                    STATUSES, responses, 1));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_resp_batch(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, EXPECTED_STATUS,
+                    nullptr, responses, 1));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_resp_batch(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, EXPECTED_STATUS,
+                    STATUSES, nullptr, 1));
+
+    /* oversized batches are rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_resp_batch(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, EXPECTED_STATUS,
+                    STATUSES, responses,
+                    VCBLOCKCHAIN_LIMIT_MAXIMUM_BATCH_COUNT + 1));
+
+    /* a sized response without data is rejected. */
+    responses[0].size = 4;
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_resp_batch(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, EXPECTED_STATUS,
+                    STATUSES, responses, 1));
+
+    /* clean up. */
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * If valid parameters are provided, this method encodes a response message.
+ */
+TEST(happy_path)
+{
+    const uint32_t EXPECTED_OFFSET = 97;
+    const uint32_t EXPECTED_STATUS = VCBLOCKCHAIN_STATUS_SUCCESS;
+    const uint32_t EXPECTED_HEIGHT_OFFSET = 99;
+    const uint32_t EXPECTED_ITEM_STATUS = 0x8001;
+    const uint32_t STATUSES[2] = {
+        EXPECTED_ITEM_STATUS, VCBLOCKCHAIN_STATUS_SUCCESS };
+    const vpr_uuid EXPECTED_BLOCK_ID = { .data = {
+        0xca, 0x14, 0x0d, 0x1e, 0x5b, 0xcf, 0x47, 0xa9,
+        0xab, 0xf7, 0xbc, 0xd8, 0xfa, 0xdb, 0x48, 0x27 }};
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+    vccrypt_buffer_t responses[2];
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* the first request failed and has an empty response. */
+    responses[0].data = nullptr;
+    responses[0].size = 0;
+
+    /* the second request succeeded. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_resp_block_id_by_height_get(
+                    &responses[1], &alloc_opts, EXPECTED_HEIGHT_OFFSET,
+                    VCBLOCKCHAIN_STATUS_SUCCESS, &EXPECTED_BLOCK_ID));
+
+    /* precondition: set the buffer to null / 0. */
+    buffer.data = nullptr; buffer.size = 0;
+
+    /* This method populates the message buffer on success. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_resp_batch(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, EXPECTED_STATUS,
+                    STATUSES, responses, 2));
+
+    /* compute the message size. */
+    size_t message_size =
+        4 * sizeof(uint32_t)
+      + 2 * sizeof(uint32_t)
+      + sizeof(uint32_t)
+      + sizeof(uint32_t) + responses[1].size;
+
+    /* the buffer has been initialized. */
+    TEST_ASSERT(nullptr != buffer.data);
+    TEST_ASSERT(message_size == buffer.size);
+
+    /* verify the header and status vector. */
+    const uint32_t* u32arr = (const uint32_t*)buffer.data;
+    TEST_EXPECT(htonl(PROTOCOL_REQ_ID_BATCH) == u32arr[0]);
+    TEST_EXPECT(htonl(EXPECTED_STATUS) == u32arr[1]);
+    TEST_EXPECT(htonl(EXPECTED_OFFSET) == u32arr[2]);
+    TEST_EXPECT(htonl(2) == u32arr[3]);
+    TEST_EXPECT(htonl(EXPECTED_ITEM_STATUS) == u32arr[4]);
+    TEST_EXPECT(htonl(VCBLOCKCHAIN_STATUS_SUCCESS) == u32arr[5]);
+
+    /* the empty response has a zero size. */
+    TEST_EXPECT(0U == u32arr[6]);
+
+    /* the second response is size prefixed and copied. */
+    TEST_EXPECT(htonl(responses[1].size) == u32arr[7]);
+    TEST_EXPECT(
+        0 == memcmp(u32arr + 8, responses[1].data, responses[1].size));
+
+    /* clean up. */
+    dispose((disposable_t*)&responses[1]);
+    dispose((disposable_t*)&buffer);
+    dispose((disposable_t*)&alloc_opts);
+}
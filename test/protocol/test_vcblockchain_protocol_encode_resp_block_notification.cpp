@@ -0,0 +1,165 @@
+/**
+ * \file
+ * test/protocol/test_vcblockchain_protocol_encode_resp_block_notification.cpp
+ *
+ * Unit tests for encoding the block notification.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <arpa/inet.h>
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/byteswap.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_protocol_encode_resp_block_notification);
+
+/**
+ * This method should perform null checks on its pointer parameters.
+ */
+TEST(parameter_check)
+{
+    const uint32_t EXPECTED_OFFSET = 97;
+    const vpr_uuid BLOCK_ID = { .data = {
+        0x26, 0x49, 0xc3, 0xf4, 0xc6, 0x11, 0x4f, 0x0e,
+        0x95, 0xe6, 0x24, 0xd4, 0x12, 0xfc, 0x7c, 0x83 } };
+    const uint8_t BLOCK_CERT[4] = { 0x01, 0x02, 0x03, 0x04 };
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* This method performs null checks on pointer parameters. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_resp_block_notification(
+                    nullptr, &alloc_opts, EXPECTED_OFFSET, &BLOCK_ID,
+                    &BLOCK_ID, 1, BLOCK_CERT, sizeof(BLOCK_CERT)));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_resp_block_notification(
+                    &buffer, nullptr, EXPECTED_OFFSET, &BLOCK_ID,
+                    &BLOCK_ID, 1, BLOCK_CERT, sizeof(BLOCK_CERT)));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_resp_block_notification(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, nullptr,
+                    &BLOCK_ID, 1, BLOCK_CERT, sizeof(BLOCK_CERT)));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_resp_block_notification(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, &BLOCK_ID,
+                    nullptr, 1, BLOCK_CERT, sizeof(BLOCK_CERT)));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_resp_block_notification(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, &BLOCK_ID,
+                    &BLOCK_ID, 1, nullptr, sizeof(BLOCK_CERT)));
+
+    /* clean up. */
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * If valid parameters are provided, this method encodes a notification.
+ */
+TEST(happy_path)
+{
+    const uint32_t EXPECTED_OFFSET = 97;
+    const vpr_uuid EXPECTED_BLOCK_ID = { .data = {
+        0x26, 0x49, 0xc3, 0xf4, 0xc6, 0x11, 0x4f, 0x0e,
+        0x95, 0xe6, 0x24, 0xd4, 0x12, 0xfc, 0x7c, 0x83 } };
+    const vpr_uuid EXPECTED_PREV_BLOCK_ID = { .data = {
+        0xb6, 0xdf, 0x4b, 0xca, 0x3f, 0x9d, 0x43, 0x7c,
+        0x92, 0xe6, 0x9f, 0x1e, 0x61, 0xc2, 0xda, 0xe9 } };
+    const uint64_t EXPECTED_BLOCK_HEIGHT = 11;
+    const uint8_t EXPECTED_BLOCK_CERT[4] = { 0x01, 0x02, 0x03, 0x04 };
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* precondition: set the buffer to null / 0. */
+    buffer.data = nullptr; buffer.size = 0;
+
+    /* This method encodes the notification. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_resp_block_notification(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, &EXPECTED_BLOCK_ID,
+                    &EXPECTED_PREV_BLOCK_ID, EXPECTED_BLOCK_HEIGHT,
+                    EXPECTED_BLOCK_CERT, sizeof(EXPECTED_BLOCK_CERT)));
+
+    /* compute the message size. */
+    size_t message_size =
+        3 * sizeof(uint32_t) + 2 * 16 + sizeof(uint64_t)
+      + sizeof(EXPECTED_BLOCK_CERT);
+
+    /* the buffer has been initialized. */
+    TEST_ASSERT(nullptr != buffer.data);
+    TEST_ASSERT(message_size == buffer.size);
+
+    /* verify the header. */
+    const uint32_t* u32arr = (const uint32_t*)buffer.data;
+    TEST_EXPECT(htonl(PROTOCOL_REQ_ID_BLOCK_NOTIFICATION) == u32arr[0]);
+    TEST_EXPECT(htonl(VCBLOCKCHAIN_STATUS_SUCCESS) == u32arr[1]);
+    TEST_EXPECT(htonl(EXPECTED_OFFSET) == u32arr[2]);
+
+    /* verify the block ids. */
+    const uint8_t* barr = (const uint8_t*)(u32arr + 3);
+    TEST_EXPECT(0 == memcmp(barr, &EXPECTED_BLOCK_ID, 16));
+    TEST_EXPECT(0 == memcmp(barr + 16, &EXPECTED_PREV_BLOCK_ID, 16));
+
+    /* verify the block height. */
+    uint64_t net_height;
+    memcpy(&net_height, barr + 32, sizeof(net_height));
+    TEST_EXPECT(htonll(net_height) == EXPECTED_BLOCK_HEIGHT);
+
+    /* verify the block certificate. */
+    TEST_EXPECT(
+        0
+            == memcmp(
+                    barr + 40, EXPECTED_BLOCK_CERT,
+                    sizeof(EXPECTED_BLOCK_CERT)));
+
+    /* clean up. */
+    dispose((disposable_t*)&buffer);
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * The block certificate can be omitted.
+ */
+TEST(no_cert)
+{
+    const vpr_uuid BLOCK_ID = { .data = {
+        0x26, 0x49, 0xc3, 0xf4, 0xc6, 0x11, 0x4f, 0x0e,
+        0x95, 0xe6, 0x24, 0xd4, 0x12, 0xfc, 0x7c, 0x83 } };
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* This method encodes the notification without a certificate. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_resp_block_notification(
+                    &buffer, &alloc_opts, 97, &BLOCK_ID, &BLOCK_ID, 1,
+                    nullptr, 0));
+
+    /* the buffer holds only the header. */
+    TEST_EXPECT(3 * sizeof(uint32_t) + 2 * 16 + sizeof(uint64_t)
+        == buffer.size);
+
+    /* clean up. */
+    dispose((disposable_t*)&buffer);
+    dispose((disposable_t*)&alloc_opts);
+}
@@ -0,0 +1,141 @@
+/**
+ * \file
+ * test/protocol/test_vcblockchain_protocol_encode_resp_block_range_get.cpp
+ *
+ * Unit tests for encoding the block range get response.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <arpa/inet.h>
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/byteswap.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_protocol_encode_resp_block_range_get);
+
+/**
+ * This method should perform null checks on its pointer parameters.
+ */
+TEST(parameter_check)
+{
+    const uint32_t EXPECTED_OFFSET = 97;
+    const uint32_t EXPECTED_STATUS = VCBLOCKCHAIN_STATUS_SUCCESS;
+    const uint64_t EXPECTED_NEXT_HEIGHT = 1001;
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+    protocol_block_range_record record;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* set up a record without a certificate. */
+    memset(&record, 0, sizeof(record));
+
+    /* This method performs null checks on pointer parameters. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_resp_block_range_get(
+                    nullptr, &alloc_opts, EXPECTED_OFFSET, EXPECTED_STATUS, 0,
+                    EXPECTED_NEXT_HEIGHT, &record, 1));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_resp_block_range_get(
+                    &buffer, nullptr, EXPECTED_OFFSET, EXPECTED_STATUS, 0,
+                    EXPECTED_NEXT_HEIGHT, &record, 1));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_resp_block_range_get(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, EXPECTED_STATUS, 0,
+                    EXPECTED_NEXT_HEIGHT, nullptr, 1));
+
+    /* a sized certificate without data is rejected. */
+    record.block_cert_size = 5;
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_resp_block_range_get(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, EXPECTED_STATUS, 0,
+                    EXPECTED_NEXT_HEIGHT, &record, 1));
+
+    /* clean up. */
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * If valid parameters are provided, this method encodes a response message.
+ */
+TEST(happy_path)
+{
+    const uint32_t EXPECTED_OFFSET = 97;
+    const uint32_t EXPECTED_STATUS = VCBLOCKCHAIN_STATUS_SUCCESS;
+    const uint32_t EXPECTED_FLAGS = PROTOCOL_BLOCK_RANGE_FLAG_TRUNCATED;
+    const uint64_t EXPECTED_NEXT_HEIGHT = 1001;
+    const uint8_t BLOCK_CERT[5] = { 0x01, 0x02, 0x03, 0x04, 0x05 };
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+    protocol_block_range_record record;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* set up the record. */
+    memset(&record, 0, sizeof(record));
+    memset(&record.block_id, 0x11, sizeof(record.block_id));
+    memset(&record.prev_block_id, 0x22, sizeof(record.prev_block_id));
+    memset(&record.next_block_id, 0x33, sizeof(record.next_block_id));
+    memset(&record.first_txn_id, 0x44, sizeof(record.first_txn_id));
+    record.block_height = 1000;
+    record.block_size = sizeof(BLOCK_CERT);
+    record.block_cert = BLOCK_CERT;
+    record.block_cert_size = sizeof(BLOCK_CERT);
+
+    /* precondition: set the buffer to null / 0. */
+    buffer.data = nullptr; buffer.size = 0;
+
+    /* This method populates the message buffer on success. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_resp_block_range_get(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, EXPECTED_STATUS,
+                    EXPECTED_FLAGS, EXPECTED_NEXT_HEIGHT, &record, 1));
+
+    /* compute the message size. */
+    size_t record_size = 4 * 16 + 2 * sizeof(uint64_t) + sizeof(BLOCK_CERT);
+    size_t message_size =
+        5 * sizeof(uint32_t) + sizeof(uint64_t)
+      + sizeof(uint32_t) + record_size;
+
+    /* the buffer has been initialized. */
+    TEST_ASSERT(nullptr != buffer.data);
+    TEST_ASSERT(message_size == buffer.size);
+
+    /* verify the header. */
+    const uint32_t* u32arr = (const uint32_t*)buffer.data;
+    TEST_EXPECT(htonl(PROTOCOL_REQ_ID_BLOCK_RANGE_GET) == u32arr[0]);
+    TEST_EXPECT(htonl(EXPECTED_STATUS) == u32arr[1]);
+    TEST_EXPECT(htonl(EXPECTED_OFFSET) == u32arr[2]);
+    TEST_EXPECT(htonl(EXPECTED_FLAGS) == u32arr[3]);
+    uint64_t net_next_height;
+    memcpy(&net_next_height, u32arr + 4, sizeof(net_next_height));
+    TEST_EXPECT(htonll(net_next_height) == EXPECTED_NEXT_HEIGHT);
+    TEST_EXPECT(htonl(1) == u32arr[6]);
+
+    /* verify the record. */
+    TEST_EXPECT(htonl(record_size) == u32arr[7]);
+    const uint8_t* barr = (const uint8_t*)(u32arr + 8);
+    TEST_EXPECT(0 == memcmp(barr, &record.block_id, 16));
+    TEST_EXPECT(0 == memcmp(barr + 16, &record.prev_block_id, 16));
+    TEST_EXPECT(0 == memcmp(barr + 32, &record.next_block_id, 16));
+    TEST_EXPECT(0 == memcmp(barr + 48, &record.first_txn_id, 16));
+    TEST_EXPECT(
+        0 == memcmp(barr + 80, BLOCK_CERT, sizeof(BLOCK_CERT)));
+
+    /* clean up. */
+    dispose((disposable_t*)&buffer);
+    dispose((disposable_t*)&alloc_opts);
+}
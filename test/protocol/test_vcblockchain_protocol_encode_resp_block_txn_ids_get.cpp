@@ -0,0 +1,121 @@
+/**
+ * \file
+ * test/protocol/test_vcblockchain_protocol_encode_resp_block_txn_ids_get.cpp
+ *
+ * Unit tests for encoding the block transaction ids get response.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <arpa/inet.h>
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/limits.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_protocol_encode_resp_block_txn_ids_get);
+
+/**
+ * This method should perform null checks on its pointer parameters.
+ */
+TEST(parameter_check)
+{
+    const uint32_t EXPECTED_OFFSET = 97;
+    const uint32_t EXPECTED_STATUS = VCBLOCKCHAIN_STATUS_SUCCESS;
+    vpr_uuid txn_ids[2];
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* set up the transaction ids. */
+    memset(txn_ids, 0x11, sizeof(txn_ids));
+
+    /* This method performs null checks on pointer parameters. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_resp_block_txn_ids_get(
+                    nullptr, &alloc_opts, EXPECTED_OFFSET, EXPECTED_STATUS,
+                    txn_ids, nullptr, 2));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_resp_block_txn_ids_get(
+                    &buffer, nullptr, EXPECTED_OFFSET, EXPECTED_STATUS,
+                    txn_ids, nullptr, 2));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_resp_block_txn_ids_get(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, EXPECTED_STATUS,
+                    nullptr, nullptr, 2));
+
+    /* more transaction ids than fit in a packet are rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_resp_block_txn_ids_get(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, EXPECTED_STATUS,
+                    txn_ids, nullptr,
+                    VCBLOCKCHAIN_LIMIT_MAXIMUM_ENCRYPTED_PACKET_SIZE));
+
+    /* clean up. */
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * If valid parameters are provided, this method encodes a packed response.
+ */
+TEST(happy_path)
+{
+    const uint32_t EXPECTED_OFFSET = 97;
+    const uint32_t EXPECTED_STATUS = VCBLOCKCHAIN_STATUS_SUCCESS;
+    const uint32_t TXN_STATES[2] = { 0x01, 0x02 };
+    vpr_uuid txn_ids[2];
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* set up the transaction ids. */
+    memset(&txn_ids[0], 0x11, sizeof(txn_ids[0]));
+    memset(&txn_ids[1], 0x22, sizeof(txn_ids[1]));
+
+    /* precondition: set the buffer to null / 0. */
+    buffer.data = nullptr; buffer.size = 0;
+
+    /* This method populates the message buffer on success. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_resp_block_txn_ids_get(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, EXPECTED_STATUS,
+                    txn_ids, TXN_STATES, 2));
+
+    /* compute the message size. */
+    size_t message_size =
+        5 * sizeof(uint32_t) + sizeof(txn_ids) + sizeof(TXN_STATES);
+
+    /* the buffer has been initialized. */
+    TEST_ASSERT(nullptr != buffer.data);
+    TEST_ASSERT(message_size == buffer.size);
+
+    /* verify the header. */
+    const uint32_t* u32arr = (const uint32_t*)buffer.data;
+    TEST_EXPECT(htonl(PROTOCOL_REQ_ID_BLOCK_TXN_IDS_GET) == u32arr[0]);
+    TEST_EXPECT(htonl(EXPECTED_STATUS) == u32arr[1]);
+    TEST_EXPECT(htonl(EXPECTED_OFFSET) == u32arr[2]);
+    TEST_EXPECT(htonl(1) == u32arr[3]);
+    TEST_EXPECT(htonl(2) == u32arr[4]);
+
+    /* the transaction ids are packed, followed by the states. */
+    TEST_EXPECT(0 == memcmp(u32arr + 5, txn_ids, sizeof(txn_ids)));
+    TEST_EXPECT(htonl(TXN_STATES[0]) == u32arr[13]);
+    TEST_EXPECT(htonl(TXN_STATES[1]) == u32arr[14]);
+
+    /* clean up. */
+    dispose((disposable_t*)&buffer);
+    dispose((disposable_t*)&alloc_opts);
+}
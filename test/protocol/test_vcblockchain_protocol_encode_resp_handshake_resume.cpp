@@ -0,0 +1,104 @@
+/**
+ * \file
+ * test/protocol/test_vcblockchain_protocol_encode_resp_handshake_resume.cpp
+ *
+ * Unit tests for encoding the handshake resume response.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <arpa/inet.h>
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/data.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_protocol_encode_resp_handshake_resume);
+
+/**
+ * Test the basics of the encoding.
+ */
+TEST(basics)
+{
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t suite;
+    vccrypt_buffer_t server_key_nonce;
+    vccrypt_buffer_t server_cr_hmac;
+    vccrypt_buffer_t out;
+    const uint32_t EXPECTED_OFFSET = 17;
+    const uint32_t EXPECTED_STATUS = 0;
+
+    /* register the suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create the crypto suite. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_options_init(
+                    &suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1));
+
+    /* create a buffer for holding the key nonce. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_buffer_init_for_cipher_key_agreement_nonce(
+                    &suite, &server_key_nonce));
+    memset(server_key_nonce.data, 0xFE, server_key_nonce.size);
+
+    /* create a buffer for holding the cr hmac. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_buffer_init_for_mac_authentication_code(
+                    &suite, &server_cr_hmac, true));
+    memset(server_cr_hmac.data, 0xE1, server_cr_hmac.size);
+
+    /* a cr hmac of the wrong size is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_resp_handshake_resume(
+                    &out, &suite, EXPECTED_OFFSET, EXPECTED_STATUS,
+                    &server_key_nonce, &server_key_nonce));
+
+    /* encoding the handshake resume response should succeed. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_resp_handshake_resume(
+                    &out, &suite, EXPECTED_OFFSET, EXPECTED_STATUS,
+                    &server_key_nonce, &server_cr_hmac));
+
+    /* get a byte pointer to the output buffer. */
+    TEST_ASSERT(nullptr != out.data);
+    const uint8_t* buf = (const uint8_t*)out.data;
+    size_t size = out.size;
+
+    /* the header comes first, with the status before the offset. */
+    uint32_t net_values[3];
+    TEST_ASSERT(size >= sizeof(net_values));
+    memcpy(net_values, buf, sizeof(net_values));
+    TEST_EXPECT(PROTOCOL_REQ_ID_HANDSHAKE_RESUME == ntohl(net_values[0]));
+    TEST_EXPECT(EXPECTED_STATUS == ntohl(net_values[1]));
+    TEST_EXPECT(EXPECTED_OFFSET == ntohl(net_values[2]));
+    buf += sizeof(net_values); size -= sizeof(net_values);
+
+    /* then the key nonce. */
+    TEST_ASSERT(size >= server_key_nonce.size);
+    TEST_EXPECT(0 == memcmp(buf, server_key_nonce.data, server_key_nonce.size));
+    buf += server_key_nonce.size; size -= server_key_nonce.size;
+
+    /* finally, the cr hmac. */
+    TEST_ASSERT(server_cr_hmac.size == size);
+    TEST_EXPECT(0 == memcmp(buf, server_cr_hmac.data, server_cr_hmac.size));
+
+    /* clean up. */
+    dispose((disposable_t*)&out);
+    dispose((disposable_t*)&server_key_nonce);
+    dispose((disposable_t*)&server_cr_hmac);
+    dispose((disposable_t*)&suite);
+    dispose((disposable_t*)&alloc_opts);
+}
@@ -0,0 +1,133 @@
+/**
+ * \file
+ * test/protocol/test_vcblockchain_protocol_encode_resp_latest_block_id_get_if_changed.cpp
+ *
+ * Unit tests for encoding the conditional latest block id get response.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <arpa/inet.h>
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_protocol_encode_resp_latest_block_id_get_if_changed);
+
+/**
+ * This method should perform null checks on its pointer parameters.
+ */
+TEST(parameters)
+{
+    const uint32_t EXPECTED_OFFSET = 26;
+    const vpr_uuid EXPECTED_BLOCK_ID = { .data = {
+        0xef, 0xc9, 0x5b, 0x49, 0x25, 0x97, 0x4d, 0x0f,
+        0x9b, 0x55, 0x09, 0x97, 0xf3, 0xea, 0x85, 0x37 } };
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* this method performs null checks on pointer parameters. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_resp_latest_block_id_get_if_changed(
+                    nullptr, &alloc_opts, EXPECTED_OFFSET,
+                    VCBLOCKCHAIN_STATUS_SUCCESS, &EXPECTED_BLOCK_ID));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_resp_latest_block_id_get_if_changed(
+                    &buffer, nullptr, EXPECTED_OFFSET,
+                    VCBLOCKCHAIN_STATUS_SUCCESS, &EXPECTED_BLOCK_ID));
+
+    /* the block id is required unless it was not modified. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_resp_latest_block_id_get_if_changed(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET,
+                    VCBLOCKCHAIN_STATUS_SUCCESS, nullptr));
+
+    /* clean up. */
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * This method should encode a changed block id.
+ */
+TEST(happy_path)
+{
+    const uint32_t EXPECTED_OFFSET = 26;
+    const vpr_uuid EXPECTED_BLOCK_ID = { .data = {
+        0xef, 0xc9, 0x5b, 0x49, 0x25, 0x97, 0x4d, 0x0f,
+        0x9b, 0x55, 0x09, 0x97, 0xf3, 0xea, 0x85, 0x37 } };
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* this method should succeed. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_resp_latest_block_id_get_if_changed(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET,
+                    VCBLOCKCHAIN_STATUS_SUCCESS, &EXPECTED_BLOCK_ID));
+
+    /* the buffer should hold the header and the block id. */
+    TEST_ASSERT(nullptr != buffer.data);
+    TEST_ASSERT(3 * sizeof(uint32_t) + 16 == buffer.size);
+
+    /* check the integer values. */
+    const uint32_t* uarr = (const uint32_t*)buffer.data;
+    TEST_EXPECT(
+        htonl(PROTOCOL_REQ_ID_LATEST_BLOCK_ID_GET_IF_CHANGED) == uarr[0]);
+    TEST_EXPECT(htonl(VCBLOCKCHAIN_STATUS_SUCCESS) == uarr[1]);
+    TEST_EXPECT(htonl(EXPECTED_OFFSET) == uarr[2]);
+
+    /* check the uuid. */
+    TEST_EXPECT(0 == memcmp(uarr + 3, &EXPECTED_BLOCK_ID, 16));
+
+    /* clean up. */
+    dispose((disposable_t*)&buffer);
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * A not modified response only holds a header.
+ */
+TEST(not_modified)
+{
+    const uint32_t EXPECTED_OFFSET = 26;
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* the block id may be omitted. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_resp_latest_block_id_get_if_changed(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET,
+                    VCBLOCKCHAIN_ERROR_PROTOCOL_NOT_MODIFIED, nullptr));
+
+    /* the buffer should only hold the header. */
+    TEST_ASSERT(nullptr != buffer.data);
+    TEST_ASSERT(3 * sizeof(uint32_t) == buffer.size);
+
+    /* check the integer values. */
+    const uint32_t* uarr = (const uint32_t*)buffer.data;
+    TEST_EXPECT(
+        htonl(PROTOCOL_REQ_ID_LATEST_BLOCK_ID_GET_IF_CHANGED) == uarr[0]);
+    TEST_EXPECT(htonl(VCBLOCKCHAIN_ERROR_PROTOCOL_NOT_MODIFIED) == uarr[1]);
+    TEST_EXPECT(htonl(EXPECTED_OFFSET) == uarr[2]);
+
+    /* clean up. */
+    dispose((disposable_t*)&buffer);
+    dispose((disposable_t*)&alloc_opts);
+}
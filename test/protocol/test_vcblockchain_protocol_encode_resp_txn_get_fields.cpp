@@ -0,0 +1,127 @@
+/**
+ * \file
+ * test/protocol/test_vcblockchain_protocol_encode_resp_txn_get_fields.cpp
+ *
+ * Unit tests for encoding the txn get fields response.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <arpa/inet.h>
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_protocol_encode_resp_txn_get_fields);
+
+/**
+ * This method should check its parameters.
+ */
+TEST(parameter_checks)
+{
+    const vpr_uuid EXPECTED_TXN_ID = { .data = {
+        0x26, 0x49, 0xc3, 0xf4, 0xc6, 0x11, 0x4f, 0x0e,
+        0x95, 0xe6, 0x24, 0xd4, 0x12, 0xfc, 0x7c, 0x83 } };
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* This method performs null checks on required parameters. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_resp_txn_get_fields(
+                    nullptr, &alloc_opts, 1, 0, 0, &EXPECTED_TXN_ID, nullptr,
+                    nullptr, nullptr, nullptr, 0, nullptr, 0));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_resp_txn_get_fields(
+                    &buffer, nullptr, 1, 0, 0, &EXPECTED_TXN_ID, nullptr,
+                    nullptr, nullptr, nullptr, 0, nullptr, 0));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_resp_txn_get_fields(
+                    &buffer, &alloc_opts, 1, 0, 0, nullptr, nullptr,
+                    nullptr, nullptr, nullptr, 0, nullptr, 0));
+
+    /* a requested field must be provided. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_resp_txn_get_fields(
+                    &buffer, &alloc_opts, 1, 0,
+                    PROTOCOL_TXN_FIELD_NEXT_TXN_ID, &EXPECTED_TXN_ID,
+                    nullptr, nullptr, nullptr, nullptr, 0, nullptr, 0));
+
+    /* unknown fields are rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_protocol_encode_resp_txn_get_fields(
+                    &buffer, &alloc_opts, 1, 0, PROTOCOL_TXN_FIELD_ALL + 1,
+                    &EXPECTED_TXN_ID, nullptr, nullptr, nullptr, nullptr, 0,
+                    nullptr, 0));
+
+    /* clean up. */
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * Only the requested fields are encoded.
+ */
+TEST(metadata_only)
+{
+    const uint32_t EXPECTED_OFFSET = 52;
+    const uint32_t EXPECTED_STATUS = 0;
+    const uint32_t EXPECTED_MASK =
+        PROTOCOL_TXN_FIELD_NEXT_TXN_ID | PROTOCOL_TXN_FIELD_TXN_STATE;
+    const uint32_t EXPECTED_TXN_STATE = 139;
+    const vpr_uuid EXPECTED_TXN_ID = { .data = {
+        0x26, 0x49, 0xc3, 0xf4, 0xc6, 0x11, 0x4f, 0x0e,
+        0x95, 0xe6, 0x24, 0xd4, 0x12, 0xfc, 0x7c, 0x83 } };
+    const vpr_uuid EXPECTED_NEXT_TXN_ID = { .data = {
+        0x61, 0x77, 0x07, 0xc2, 0x10, 0x7c, 0x4b, 0xb6,
+        0x9d, 0x35, 0xa0, 0xf0, 0xde, 0xab, 0x71, 0x05 } };
+    const uint8_t TXN_CERT[4] = { 0x01, 0x02, 0x03, 0x04 };
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t buffer;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* the certificate is ignored because it was not requested. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_resp_txn_get_fields(
+                    &buffer, &alloc_opts, EXPECTED_OFFSET, EXPECTED_STATUS,
+                    EXPECTED_MASK, &EXPECTED_TXN_ID, nullptr,
+                    &EXPECTED_NEXT_TXN_ID, nullptr, nullptr,
+                    EXPECTED_TXN_STATE, TXN_CERT, sizeof(TXN_CERT)));
+
+    /* the buffer only holds the header, txn id, next txn id, and state. */
+    TEST_ASSERT(
+        4 * sizeof(uint32_t) + 2 * 16 + sizeof(uint32_t) == buffer.size);
+
+    /* verify the header. */
+    const uint32_t* u32arr = (const uint32_t*)buffer.data;
+    TEST_EXPECT(
+        htonl(PROTOCOL_REQ_ID_TRANSACTION_BY_ID_GET_FIELDS) == u32arr[0]);
+    TEST_EXPECT(htonl(EXPECTED_STATUS) == u32arr[1]);
+    TEST_EXPECT(htonl(EXPECTED_OFFSET) == u32arr[2]);
+    TEST_EXPECT(htonl(EXPECTED_MASK) == u32arr[3]);
+
+    /* verify the fields. */
+    const uint8_t* barr = (const uint8_t*)(u32arr + 4);
+    TEST_EXPECT(0 == memcmp(barr, &EXPECTED_TXN_ID, 16));
+    TEST_EXPECT(0 == memcmp(barr + 16, &EXPECTED_NEXT_TXN_ID, 16));
+    uint32_t net_state;
+    memcpy(&net_state, barr + 32, sizeof(net_state));
+    TEST_EXPECT(htonl(EXPECTED_TXN_STATE) == net_state);
+
+    /* clean up. */
+    dispose((disposable_t*)&buffer);
+    dispose((disposable_t*)&alloc_opts);
+}
@@ -0,0 +1,172 @@
+/**
+ * \file
+ * test/protocol/test_vcblockchain_protocol_recvresp_artifact_notification.cpp
+ *
+ * Unit tests for receiving and decoding an artifact notification.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cstring>
+#include <minunit/minunit.h>
+#include <queue>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vcblockchain/psock.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+#include "../dummy_psock.h"
+
+using namespace std;
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_psock;
+RCPR_IMPORT_resource;
+
+TEST_SUITE(test_vcblockchain_protocol_recvresp_artifact_notification);
+
+/**
+ * Happy path: an artifact notification is decoded from the socket.
+ */
+TEST(happy_path)
+{
+    const uint8_t SHARED_SECRET[32] = {
+        0x2c, 0x4c, 0x67, 0xd9, 0xd7, 0xd6, 0x4f, 0x5e,
+        0xb0, 0xf1, 0x30, 0xf5, 0xf3, 0x44, 0xbc, 0x69,
+        0xdc, 0x4b, 0xff, 0xa0, 0x2e, 0xd8, 0x4c, 0xff,
+        0x8a, 0x07, 0x42, 0xfa, 0x9b, 0x0e, 0xa2, 0xd7 };
+    const vpr_uuid ARTIFACT_ID = { .data = {
+        0x3a, 0x1c, 0x8e, 0x4f, 0x52, 0x7b, 0x4d, 0x0a,
+        0x9e, 0x61, 0x2f, 0x07, 0xc4, 0xd8, 0x13, 0x6b } };
+    const vpr_uuid TXN_ID = { .data = {
+        0xd4, 0x2e, 0x90, 0x17, 0x6b, 0x85, 0x4c, 0x31,
+        0x8f, 0x72, 0x05, 0xa9, 0x3c, 0x1e, 0xb6, 0x08 } };
+    const vpr_uuid BLOCK_ID = { .data = {
+        0x26, 0x49, 0xc3, 0xf4, 0xc6, 0x11, 0x4f, 0x0e,
+        0x95, 0xe6, 0x24, 0xd4, 0x12, 0xfc, 0x7c, 0x83 } };
+    const uint32_t TXN_STATE = 0x02;
+    const uint32_t EXPECTED_OFFSET = 17U;
+    vccrypt_buffer_t response;
+    protocol_resp_artifact_notification resp;
+
+    psock* sock;
+    rcpr_allocator* alloc;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t suite;
+    vccrypt_buffer_t shared_secret;
+    uint64_t server_iv = 0U;
+    queue<uint8_t> stream_bytes;
+
+    /* register the suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create an RCPR allocator instance. */
+    TEST_ASSERT(STATUS_SUCCESS == rcpr_malloc_allocator_create(&alloc));
+
+    /* create the crypto suite. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_options_init(
+                    &suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1));
+
+    /* create a buffer for holding the shared secret. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_buffer_init_for_cipher_key_agreement_shared_secret(
+                    &suite, &shared_secret));
+    TEST_ASSERT(sizeof(SHARED_SECRET) == shared_secret.size);
+    /* copy the shared secret to this buffer. */
+    memcpy(shared_secret.data, SHARED_SECRET, shared_secret.size);
+
+    /* create the dummy socket for writing the response. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == dummy_psock_create(
+                    &sock, alloc,
+                    [&](psock*, void*, size_t*) -> int {
+                        return VCBLOCKCHAIN_ERROR_SSOCK_READ;
+                    },
+                    [&](psock*, const void* vbuf, size_t* s) -> int {
+                        const uint8_t* buf = (const uint8_t*)vbuf;
+
+                        for (size_t i = 0; i < *s; ++i)
+                        {
+                            stream_bytes.push(buf[i]);
+                        }
+
+                        return VCBLOCKCHAIN_STATUS_SUCCESS;
+                    }));
+
+    /* encode the notification. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_resp_artifact_notification(
+                    &response, &alloc_opts, EXPECTED_OFFSET, &ARTIFACT_ID,
+                    &TXN_ID, &BLOCK_ID, TXN_STATE));
+
+    /* write the notification to the dummy socket. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == psock_write_authed_data(
+                    sock, server_iv, response.data, response.size, &suite,
+                    &shared_secret));
+    dispose((disposable_t*)&response);
+
+    /* reset the dummy socket. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(psock_resource_handle(sock)));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == dummy_psock_create(
+                    &sock, alloc,
+                    [&](psock*, void* vbuf, size_t* s) -> int {
+                        uint8_t* buf = (uint8_t*)vbuf;
+
+                        if (stream_bytes.size() < *s)
+                            return VCBLOCKCHAIN_ERROR_SSOCK_READ;
+
+                        for (size_t i = 0; i < *s; ++i)
+                        {
+                            buf[i] = stream_bytes.front();
+                            stream_bytes.pop();
+                        }
+
+                        return VCBLOCKCHAIN_STATUS_SUCCESS;
+                    },
+                    [&](psock*, const void*, size_t*) -> int {
+                        return VCBLOCKCHAIN_ERROR_SSOCK_WRITE;
+                    }));
+
+    /* receiving the notification should succeed. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_recvresp_artifact_notification(
+                    sock, alloc, &suite, &server_iv, &shared_secret, &resp));
+
+    /* the notification is decoded. */
+    TEST_EXPECT(PROTOCOL_REQ_ID_ARTIFACT_NOTIFICATION == resp.request_id);
+    TEST_EXPECT(EXPECTED_OFFSET == resp.offset);
+    TEST_EXPECT(0 == memcmp(&resp.artifact_id, &ARTIFACT_ID, 16));
+    TEST_EXPECT(0 == memcmp(&resp.txn_id, &TXN_ID, 16));
+    TEST_EXPECT(0 == memcmp(&resp.block_id, &BLOCK_ID, 16));
+    TEST_EXPECT(TXN_STATE == resp.txn_state);
+
+    /* the server IV should be incremented. */
+    TEST_EXPECT(1U == server_iv);
+
+    dispose((disposable_t*)&resp);
+
+    /* cleanup. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(psock_resource_handle(sock)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(rcpr_allocator_resource_handle(alloc)));
+    dispose((disposable_t*)&shared_secret);
+    dispose((disposable_t*)&suite);
+    dispose((disposable_t*)&alloc_opts);
+}
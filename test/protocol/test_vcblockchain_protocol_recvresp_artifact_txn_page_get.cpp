@@ -0,0 +1,201 @@
+/**
+ * \file
+ * test/protocol/test_vcblockchain_protocol_recvresp_artifact_txn_page_get.cpp
+ *
+ * Unit tests for receiving and decoding an artifact transaction page get
+ * response.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cstring>
+#include <minunit/minunit.h>
+#include <queue>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vcblockchain/psock.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+#include "../dummy_psock.h"
+
+using namespace std;
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_psock;
+RCPR_IMPORT_resource;
+
+TEST_SUITE(test_vcblockchain_protocol_recvresp_artifact_txn_page_get);
+
+/**
+ * Happy path: an artifact transaction page get response is decoded from the
+ * socket.
+ */
+TEST(happy_path)
+{
+    const uint8_t SHARED_SECRET[32] = {
+        0x2c, 0x4c, 0x67, 0xd9, 0xd7, 0xd6, 0x4f, 0x5e,
+        0xb0, 0xf1, 0x30, 0xf5, 0xf3, 0x44, 0xbc, 0x69,
+        0xdc, 0x4b, 0xff, 0xa0, 0x2e, 0xd8, 0x4c, 0xff,
+        0x8a, 0x07, 0x42, 0xfa, 0x9b, 0x0e, 0xa2, 0xd7 };
+    const vpr_uuid TXN_ID = { .data = {
+        0x3a, 0x1c, 0x8e, 0x4f, 0x52, 0x7b, 0x4d, 0x0a,
+        0x9e, 0x61, 0x2f, 0x07, 0xc4, 0xd8, 0x13, 0x6b } };
+    const vpr_uuid PREV_TXN_ID = { .data = {
+        0x71, 0x05, 0xcb, 0x92, 0x3e, 0x4a, 0x4f, 0x88,
+        0xa3, 0x1d, 0x6c, 0x50, 0x0b, 0xe7, 0x29, 0x44 } };
+    const vpr_uuid NEXT_TXN_ID = { .data = {
+        0xd4, 0x2e, 0x90, 0x17, 0x6b, 0x85, 0x4c, 0x31,
+        0x8f, 0x72, 0x05, 0xa9, 0x3c, 0x1e, 0xb6, 0x08 } };
+    const vpr_uuid ARTIFACT_ID = { .data = {
+        0x0f, 0x93, 0x27, 0xe1, 0x58, 0xac, 0x47, 0x6d,
+        0xb2, 0x44, 0x19, 0x8d, 0x60, 0xf5, 0x3a, 0xc7 } };
+    const vpr_uuid BLOCK_ID = { .data = {
+        0x86, 0xfb, 0x40, 0x2d, 0x1a, 0x67, 0x43, 0xe9,
+        0x95, 0x0c, 0x7e, 0x31, 0xd2, 0x48, 0x5f, 0x1b } };
+    const uint8_t TXN_CERT[5] = { 0x01, 0x02, 0x03, 0x04, 0x05 };
+    const uint32_t EXPECTED_OFFSET = 17U;
+    const uint32_t EXPECTED_STATE = 2U;
+    const uint32_t EXPECTED_FLAGS = PROTOCOL_TXN_PAGE_FLAG_MORE;
+    protocol_txn_page_record record;
+    vccrypt_buffer_t response;
+    protocol_resp_artifact_txn_page_get resp;
+
+    psock* sock;
+    rcpr_allocator* alloc;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t suite;
+    vccrypt_buffer_t shared_secret;
+    uint64_t server_iv = 0U;
+    queue<uint8_t> stream_bytes;
+
+    /* register the suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create an RCPR allocator instance. */
+    TEST_ASSERT(STATUS_SUCCESS == rcpr_malloc_allocator_create(&alloc));
+
+    /* create the crypto suite. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_options_init(
+                    &suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1));
+
+    /* create a buffer for holding the shared secret. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_buffer_init_for_cipher_key_agreement_shared_secret(
+                    &suite, &shared_secret));
+    TEST_ASSERT(sizeof(SHARED_SECRET) == shared_secret.size);
+    /* copy the shared secret to this buffer. */
+    memcpy(shared_secret.data, SHARED_SECRET, shared_secret.size);
+
+    /* create the dummy socket for writing the response. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == dummy_psock_create(
+                    &sock, alloc,
+                    [&](psock*, void*, size_t*) -> int {
+                        return VCBLOCKCHAIN_ERROR_SSOCK_READ;
+                    },
+                    [&](psock*, const void* vbuf, size_t* s) -> int {
+                        const uint8_t* buf = (const uint8_t*)vbuf;
+
+                        for (size_t i = 0; i < *s; ++i)
+                        {
+                            stream_bytes.push(buf[i]);
+                        }
+
+                        return VCBLOCKCHAIN_STATUS_SUCCESS;
+                    }));
+
+    /* encode the response. */
+    memcpy(&record.txn_id, &TXN_ID, sizeof(TXN_ID));
+    memcpy(&record.prev_txn_id, &PREV_TXN_ID, sizeof(PREV_TXN_ID));
+    memcpy(&record.next_txn_id, &NEXT_TXN_ID, sizeof(NEXT_TXN_ID));
+    memcpy(&record.artifact_id, &ARTIFACT_ID, sizeof(ARTIFACT_ID));
+    memcpy(&record.block_id, &BLOCK_ID, sizeof(BLOCK_ID));
+    record.txn_state = EXPECTED_STATE;
+    record.txn_size = sizeof(TXN_CERT);
+    record.txn_cert = TXN_CERT;
+    record.txn_cert_size = sizeof(TXN_CERT);
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_encode_resp_artifact_txn_page_get(
+                    &response, &alloc_opts, EXPECTED_OFFSET,
+                    VCBLOCKCHAIN_STATUS_SUCCESS, EXPECTED_FLAGS, &TXN_ID,
+                    &record, 1));
+
+    /* write the response to the dummy socket. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == psock_write_authed_data(
+                    sock, server_iv, response.data, response.size, &suite,
+                    &shared_secret));
+    dispose((disposable_t*)&response);
+
+    /* reset the dummy socket. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(psock_resource_handle(sock)));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == dummy_psock_create(
+                    &sock, alloc,
+                    [&](psock*, void* vbuf, size_t* s) -> int {
+                        uint8_t* buf = (uint8_t*)vbuf;
+
+                        if (stream_bytes.size() < *s)
+                            return VCBLOCKCHAIN_ERROR_SSOCK_READ;
+
+                        for (size_t i = 0; i < *s; ++i)
+                        {
+                            buf[i] = stream_bytes.front();
+                            stream_bytes.pop();
+                        }
+
+                        return VCBLOCKCHAIN_STATUS_SUCCESS;
+                    },
+                    [&](psock*, const void*, size_t*) -> int {
+                        return VCBLOCKCHAIN_ERROR_SSOCK_WRITE;
+                    }));
+
+    /* receiving the response should succeed. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_recvresp_artifact_txn_page_get(
+                    sock, alloc, &suite, &server_iv, &shared_secret,
+                    &alloc_opts, &resp));
+
+    /* the response is decoded. */
+    TEST_EXPECT(PROTOCOL_REQ_ID_ARTIFACT_TXN_PAGE_GET == resp.request_id);
+    TEST_EXPECT(EXPECTED_OFFSET == resp.offset);
+    TEST_EXPECT(EXPECTED_FLAGS == resp.flags);
+    TEST_EXPECT(0 == memcmp(&resp.next_cursor, &TXN_ID, sizeof(TXN_ID)));
+    TEST_ASSERT(1U == resp.count);
+    TEST_EXPECT(
+        0 == memcmp(&resp.records[0].txn_id, &TXN_ID, sizeof(TXN_ID)));
+    TEST_EXPECT(
+        0 == memcmp(&resp.records[0].block_id, &BLOCK_ID, sizeof(BLOCK_ID)));
+    TEST_EXPECT(EXPECTED_STATE == resp.records[0].txn_state);
+    TEST_ASSERT(sizeof(TXN_CERT) == resp.records[0].txn_cert_size);
+    TEST_EXPECT(
+        0 == memcmp(resp.records[0].txn_cert, TXN_CERT, sizeof(TXN_CERT)));
+
+    /* the server IV should be incremented. */
+    TEST_EXPECT(1U == server_iv);
+
+    dispose((disposable_t*)&resp);
+
+    /* cleanup. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(psock_resource_handle(sock)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(rcpr_allocator_resource_handle(alloc)));
+    dispose((disposable_t*)&shared_secret);
+    dispose((disposable_t*)&suite);
+    dispose((disposable_t*)&alloc_opts);
+}
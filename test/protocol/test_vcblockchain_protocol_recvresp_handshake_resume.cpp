@@ -0,0 +1,419 @@
+/**
+ * \file
+ * test/protocol/test_vcblockchain_protocol_recvresp_handshake_resume.cpp
+ *
+ * Unit tests for receiving the handshake resume response from a server
+ * socket.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <arpa/inet.h>
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+#include "../dummy_psock.h"
+
+using namespace std;
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_psock;
+RCPR_IMPORT_resource;
+
+TEST_SUITE(test_vcblockchain_protocol_recvresp_handshake_resume);
+
+/**
+ * \brief Build the response the server sends to resume a session.
+ *
+ * The server recovers the original shared secret from the ticket, derives the
+ * resumption secret and the new shared secret from it, and proves it by
+ * signing the response and the client key nonce with the new shared secret.
+ */
+static int build_response(
+    vccrypt_buffer_t* out, vccrypt_suite_options_t* suite,
+    const vccrypt_buffer_t* original_secret, const vccrypt_buffer_t* ticket,
+    const vccrypt_buffer_t* client_key_nonce,
+    const vccrypt_buffer_t* server_key_nonce, uint32_t offset)
+{
+    int retval;
+    vccrypt_buffer_t resumption_secret, shared_secret, hmac;
+    vccrypt_mac_context_t mac;
+
+    retval =
+        vcblockchain_protocol_resumption_secret_create(
+            &resumption_secret, suite, original_secret, ticket);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        vcblockchain_protocol_resumed_shared_secret_create(
+            &shared_secret, suite, &resumption_secret, client_key_nonce,
+            server_key_nonce);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_resumption_secret;
+    }
+
+    retval =
+        vccrypt_suite_buffer_init_for_mac_authentication_code(
+            suite, &hmac, true);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_shared_secret;
+    }
+
+    /* encode with a blank hmac, then sign everything before it. */
+    memset(hmac.data, 0, hmac.size);
+    retval =
+        vcblockchain_protocol_encode_resp_handshake_resume(
+            out, suite, offset, VCBLOCKCHAIN_STATUS_SUCCESS, server_key_nonce,
+            &hmac);
+    if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_hmac;
+    }
+
+    retval = vccrypt_suite_mac_short_init(suite, &mac, &shared_secret);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_out;
+    }
+
+    retval =
+        vccrypt_mac_digest(
+            &mac, (const uint8_t*)out->data, out->size - hmac.size);
+    if (VCCRYPT_STATUS_SUCCESS == retval)
+    {
+        retval =
+            vccrypt_mac_digest(
+                &mac, (const uint8_t*)client_key_nonce->data,
+                client_key_nonce->size);
+    }
+    if (VCCRYPT_STATUS_SUCCESS == retval)
+    {
+        retval = vccrypt_mac_finalize(&mac, &hmac);
+    }
+    if (VCCRYPT_STATUS_SUCCESS == retval)
+    {
+        memcpy(
+            ((uint8_t*)out->data) + out->size - hmac.size, hmac.data,
+            hmac.size);
+    }
+
+    dispose((disposable_t*)&mac);
+
+cleanup_out:
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        dispose((disposable_t*)out);
+    }
+
+cleanup_hmac:
+    dispose((disposable_t*)&hmac);
+
+cleanup_shared_secret:
+    dispose((disposable_t*)&shared_secret);
+
+cleanup_resumption_secret:
+    dispose((disposable_t*)&resumption_secret);
+
+    return retval;
+}
+
+/**
+ * \brief Create a dummy socket that reads the given boxed response.
+ */
+static int boxed_response_psock_create(
+    psock** sock, rcpr_allocator* alloc, const vccrypt_buffer_t* out,
+    int* state)
+{
+    return
+        dummy_psock_create(
+            sock, alloc,
+            [=](psock*, void* buffer, size_t* size) -> int {
+                uint32_t type = htonl(PSOCK_BOXED_TYPE_DATA);
+                switch (*state)
+                {
+                    /* read the type. */
+                    case 0:
+                        if (*size != sizeof(uint32_t))
+                            return VCBLOCKCHAIN_ERROR_SSOCK_READ;
+                        memcpy(buffer, &type, sizeof(type));
+                        ++*state;
+                        return VCBLOCKCHAIN_STATUS_SUCCESS;
+
+                    /* read the size. */
+                    case 1:
+                        if (*size != sizeof(uint32_t))
+                            return VCBLOCKCHAIN_ERROR_SSOCK_READ;
+                        *((uint32_t*)buffer) = htonl(out->size);
+                        ++*state;
+                        return VCBLOCKCHAIN_STATUS_SUCCESS;
+
+                    /* read the payload. */
+                    case 2:
+                        if (*size != out->size)
+                            return VCBLOCKCHAIN_ERROR_SSOCK_READ;
+                        memcpy(buffer, out->data, out->size);
+                        ++*state;
+                        return VCBLOCKCHAIN_STATUS_SUCCESS;
+
+                    default:
+                        return VCBLOCKCHAIN_ERROR_SSOCK_READ;
+                }
+            },
+            [&](psock*, const void*, size_t*) -> int {
+                return VCBLOCKCHAIN_ERROR_SSOCK_WRITE;
+            });
+}
+
+/**
+ * A valid response yields the same shared secret that the server derived, and
+ * sets the IVs as the handshake ack would.
+ */
+TEST(happy_path)
+{
+    psock* sock;
+    rcpr_allocator* alloc;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t suite;
+    vccrypt_buffer_t original_secret;
+    vccrypt_buffer_t ticket;
+    vccrypt_buffer_t resumption_secret;
+    vccrypt_buffer_t client_key_nonce;
+    vccrypt_buffer_t server_key_nonce;
+    vccrypt_buffer_t expected_secret;
+    vccrypt_buffer_t shared_secret;
+    vccrypt_buffer_t out;
+    const uint32_t EXPECTED_OFFSET = 17U;
+    uint64_t client_iv = 0U, server_iv = 0U;
+    uint32_t offset, status;
+    int state = 0;
+
+    /* register the suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create an RCPR allocator instance. */
+    TEST_ASSERT(STATUS_SUCCESS == rcpr_malloc_allocator_create(&alloc));
+
+    /* create the crypto suite. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_options_init(
+                    &suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1));
+
+    /* the shared secret of the session that was issued the ticket. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_buffer_init_for_cipher_key_agreement_shared_secret(
+                    &suite, &original_secret));
+    memset(original_secret.data, 0x31, original_secret.size);
+
+    /* the ticket, which is opaque to the client. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_buffer_init(&ticket, &alloc_opts, 64));
+    memset(ticket.data, 0x7C, ticket.size);
+
+    /* the nonces for the resumed session. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_buffer_init_for_cipher_key_agreement_nonce(
+                    &suite, &client_key_nonce));
+    memset(client_key_nonce.data, 0xC1, client_key_nonce.size);
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_buffer_init_for_cipher_key_agreement_nonce(
+                    &suite, &server_key_nonce));
+    memset(server_key_nonce.data, 0x5E, server_key_nonce.size);
+
+    /* the client stored the resumption secret with the ticket. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_resumption_secret_create(
+                    &resumption_secret, &suite, &original_secret, &ticket));
+
+    /* the server derives the new shared secret. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_resumed_shared_secret_create(
+                    &expected_secret, &suite, &resumption_secret,
+                    &client_key_nonce, &server_key_nonce));
+
+    /* the new secret differs from the original secret. */
+    TEST_ASSERT(original_secret.size == expected_secret.size);
+    TEST_EXPECT(
+        0
+            != memcmp(
+                    original_secret.data, expected_secret.data,
+                    original_secret.size));
+
+    /* build the response. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == build_response(
+                    &out, &suite, &original_secret, &ticket, &client_key_nonce,
+                    &server_key_nonce, EXPECTED_OFFSET));
+
+    /* create the socket. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == boxed_response_psock_create(&sock, alloc, &out, &state));
+
+    /* read the response. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_recvresp_handshake_resume(
+                    sock, alloc, &suite, &resumption_secret,
+                    &client_key_nonce, &shared_secret, &client_iv, &server_iv,
+                    &offset, &status));
+
+    /* verify the response. */
+    TEST_EXPECT(EXPECTED_OFFSET == offset);
+    TEST_EXPECT(VCBLOCKCHAIN_STATUS_SUCCESS == status);
+    TEST_EXPECT(0x0000000000000001 == client_iv);
+    TEST_EXPECT(0x8000000000000001 == server_iv);
+
+    /* the client derived the same secret as the server. */
+    TEST_ASSERT(expected_secret.size == shared_secret.size);
+    TEST_EXPECT(
+        0
+            == memcmp(
+                    expected_secret.data, shared_secret.data,
+                    expected_secret.size));
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(psock_resource_handle(sock)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(rcpr_allocator_resource_handle(alloc)));
+    dispose((disposable_t*)&shared_secret);
+    dispose((disposable_t*)&out);
+    dispose((disposable_t*)&expected_secret);
+    dispose((disposable_t*)&resumption_secret);
+    dispose((disposable_t*)&server_key_nonce);
+    dispose((disposable_t*)&client_key_nonce);
+    dispose((disposable_t*)&ticket);
+    dispose((disposable_t*)&original_secret);
+    dispose((disposable_t*)&suite);
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * A server that can't open the ticket can't produce a valid response.
+ */
+TEST(wrong_secret)
+{
+    psock* sock;
+    rcpr_allocator* alloc;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t suite;
+    vccrypt_buffer_t original_secret;
+    vccrypt_buffer_t forged_secret;
+    vccrypt_buffer_t ticket;
+    vccrypt_buffer_t resumption_secret;
+    vccrypt_buffer_t client_key_nonce;
+    vccrypt_buffer_t server_key_nonce;
+    vccrypt_buffer_t shared_secret;
+    vccrypt_buffer_t out;
+    uint64_t client_iv = 0U, server_iv = 0U;
+    uint32_t offset, status;
+    int state = 0;
+
+    /* register the suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create an RCPR allocator instance. */
+    TEST_ASSERT(STATUS_SUCCESS == rcpr_malloc_allocator_create(&alloc));
+
+    /* create the crypto suite. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_options_init(
+                    &suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1));
+
+    /* the real shared secret, and the one guessed by an impostor. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_buffer_init_for_cipher_key_agreement_shared_secret(
+                    &suite, &original_secret));
+    memset(original_secret.data, 0x31, original_secret.size);
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_buffer_init_for_cipher_key_agreement_shared_secret(
+                    &suite, &forged_secret));
+    memset(forged_secret.data, 0x32, forged_secret.size);
+
+    /* the ticket and nonces. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_buffer_init(&ticket, &alloc_opts, 64));
+    memset(ticket.data, 0x7C, ticket.size);
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_buffer_init_for_cipher_key_agreement_nonce(
+                    &suite, &client_key_nonce));
+    memset(client_key_nonce.data, 0xC1, client_key_nonce.size);
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_buffer_init_for_cipher_key_agreement_nonce(
+                    &suite, &server_key_nonce));
+    memset(server_key_nonce.data, 0x5E, server_key_nonce.size);
+
+    /* the client stored the real resumption secret. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_resumption_secret_create(
+                    &resumption_secret, &suite, &original_secret, &ticket));
+
+    /* the impostor signs with the wrong secret. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == build_response(
+                    &out, &suite, &forged_secret, &ticket, &client_key_nonce,
+                    &server_key_nonce, 0U));
+
+    /* create the socket. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == boxed_response_psock_create(&sock, alloc, &out, &state));
+
+    /* the response is rejected. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE
+            == vcblockchain_protocol_recvresp_handshake_resume(
+                    sock, alloc, &suite, &resumption_secret,
+                    &client_key_nonce, &shared_secret, &client_iv, &server_iv,
+                    &offset, &status));
+    TEST_EXPECT(0U == client_iv);
+    TEST_EXPECT(0U == server_iv);
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(psock_resource_handle(sock)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(rcpr_allocator_resource_handle(alloc)));
+    dispose((disposable_t*)&out);
+    dispose((disposable_t*)&resumption_secret);
+    dispose((disposable_t*)&server_key_nonce);
+    dispose((disposable_t*)&client_key_nonce);
+    dispose((disposable_t*)&ticket);
+    dispose((disposable_t*)&forged_secret);
+    dispose((disposable_t*)&original_secret);
+    dispose((disposable_t*)&suite);
+    dispose((disposable_t*)&alloc_opts);
+}
@@ -0,0 +1,190 @@
+/**
+ * \file test/protocol/test_vcblockchain_protocol_sendreq_rekey.cpp
+ *
+ * Unit tests for writing the rekey request to a server socket.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cstring>
+#include <minunit/minunit.h>
+#include <queue>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol.h>
+#include <vcblockchain/protocol/serialization.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+#include "../dummy_psock.h"
+
+using namespace std;
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_psock;
+RCPR_IMPORT_resource;
+
+TEST_SUITE(test_vcblockchain_protocol_sendreq_rekey);
+
+/**
+ * The request switches keys after its own packet, and both sides derive the
+ * same new secret from it.
+ */
+TEST(happy_path)
+{
+    psock* sock;
+    rcpr_allocator* alloc;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t suite;
+    vccrypt_buffer_t shared_secret;
+    vccrypt_buffer_t client_key_nonce;
+    vccrypt_buffer_t server_key_nonce;
+    vccrypt_buffer_t client_secret;
+    vccrypt_buffer_t server_secret;
+    vccrypt_buffer_t out;
+    protocol_req_rekey req;
+    const uint32_t EXPECTED_OFFSET = 31U;
+    uint64_t client_iv = 5U, server_iv = 5U;
+    queue<uint8_t> stream;
+
+    /* register the suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create an RCPR allocator instance. */
+    TEST_ASSERT(STATUS_SUCCESS == rcpr_malloc_allocator_create(&alloc));
+
+    /* create the crypto suite. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_options_init(
+                    &suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1));
+
+    /* create the current shared secret. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_buffer_init_for_cipher_key_agreement_shared_secret(
+                    &suite, &shared_secret));
+    memset(shared_secret.data, 0x44, shared_secret.size);
+
+    /* create the dummy socket. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == dummy_psock_create(
+                    &sock, alloc,
+                    [&](psock*, void*, size_t*) -> int {
+                        return VCBLOCKCHAIN_ERROR_SSOCK_READ;
+                    },
+                    [&](psock*, const void* val, size_t* size) -> int {
+                        const uint8_t* bval = (const uint8_t*)val;
+
+                        for (size_t i = 0; i < *size; ++i)
+                            stream.push(bval[i]);
+
+                        return VCBLOCKCHAIN_STATUS_SUCCESS;
+                    }));
+
+    /* send the rekey request. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_sendreq_rekey(
+                    sock, &suite, &client_iv, &shared_secret, EXPECTED_OFFSET,
+                    &client_key_nonce));
+    TEST_EXPECT(6U == client_iv);
+
+    /* release the old socket. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(psock_resource_handle(sock)));
+
+    /* initialize the socket for reading. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == dummy_psock_create(
+                    &sock, alloc,
+                    [&](psock*, void* val, size_t* size) -> int {
+                        uint8_t* bval = (uint8_t*)val;
+
+                        if (stream.size() < *size)
+                            return VCBLOCKCHAIN_ERROR_SSOCK_READ;
+
+                        for (size_t i = 0; i < *size; ++i)
+                        {
+                            bval[i] = stream.front();
+                            stream.pop();
+                        }
+
+                        return VCBLOCKCHAIN_STATUS_SUCCESS;
+                    },
+                    [&](psock*, const void*, size_t*) -> int {
+                        return VCBLOCKCHAIN_ERROR_SSOCK_WRITE;
+                    }));
+
+    /* the server reads the request with the current secret. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_recvresp(
+                    sock, alloc, &suite, &server_iv, &shared_secret, &out));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_decode_req_rekey(
+                    &req, &suite, out.data, out.size));
+
+    /* the new secret applies to the packet after the request. */
+    TEST_EXPECT(EXPECTED_OFFSET == req.offset);
+    TEST_EXPECT(client_iv == req.client_switch_iv);
+    TEST_ASSERT(client_key_nonce.size == req.client_key_nonce.size);
+    TEST_EXPECT(
+        0
+            == memcmp(
+                    client_key_nonce.data, req.client_key_nonce.data,
+                    client_key_nonce.size));
+
+    /* the server picks its own nonce. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_buffer_init_for_cipher_key_agreement_nonce(
+                    &suite, &server_key_nonce));
+    memset(server_key_nonce.data, 0x5E, server_key_nonce.size);
+
+    /* both sides derive the same new secret. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_rekeyed_shared_secret_create(
+                    &client_secret, &suite, &shared_secret, &client_key_nonce,
+                    &server_key_nonce));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_protocol_rekeyed_shared_secret_create(
+                    &server_secret, &suite, &shared_secret,
+                    &req.client_key_nonce, &server_key_nonce));
+    TEST_ASSERT(client_secret.size == server_secret.size);
+    TEST_EXPECT(
+        0
+            == memcmp(
+                    client_secret.data, server_secret.data,
+                    client_secret.size));
+
+    /* the new secret differs from the current secret. */
+    TEST_ASSERT(shared_secret.size == client_secret.size);
+    TEST_EXPECT(
+        0
+            != memcmp(
+                    shared_secret.data, client_secret.data,
+                    shared_secret.size));
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(psock_resource_handle(sock)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(rcpr_allocator_resource_handle(alloc)));
+    dispose((disposable_t*)&server_secret);
+    dispose((disposable_t*)&client_secret);
+    dispose((disposable_t*)&server_key_nonce);
+    dispose((disposable_t*)&req);
+    dispose((disposable_t*)&out);
+    dispose((disposable_t*)&client_key_nonce);
+    dispose((disposable_t*)&shared_secret);
+    dispose((disposable_t*)&suite);
+    dispose((disposable_t*)&alloc_opts);
+}
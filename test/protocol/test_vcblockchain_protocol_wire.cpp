@@ -0,0 +1,104 @@
+/**
+ * \file test/protocol/test_vcblockchain_protocol_wire.cpp
+ *
+ * Unit tests for the protocol wire cursors.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cstring>
+#include <minunit/minunit.h>
+
+#include "../../src/protocol/wire_internal.h"
+
+using namespace std;
+
+TEST_SUITE(test_vcblockchain_protocol_wire);
+
+/**
+ * Integers are written in network byte order.
+ */
+TEST(write_network_order)
+{
+    const uint8_t EXPECTED[12] = {
+        0x01, 0x02, 0x03, 0x04,
+        0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef };
+    uint8_t buffer[12];
+    vcblockchain_wire_writer writer;
+
+    vcblockchain_wire_writer_init(&writer, buffer, sizeof(buffer));
+    TEST_EXPECT(sizeof(buffer) == vcblockchain_wire_writer_remaining(&writer));
+
+    vcblockchain_wire_write_u32(&writer, 0x01020304);
+    vcblockchain_wire_write_u64(&writer, 0x0123456789abcdef);
+
+    /* the whole buffer was written. */
+    TEST_EXPECT(0U == vcblockchain_wire_writer_remaining(&writer));
+    TEST_EXPECT(0 == memcmp(EXPECTED, buffer, sizeof(EXPECTED)));
+}
+
+/**
+ * Integers are read from network byte order.
+ */
+TEST(read_network_order)
+{
+    const uint8_t INPUT[12] = {
+        0x01, 0x02, 0x03, 0x04,
+        0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef };
+    vcblockchain_wire_reader reader;
+
+    vcblockchain_wire_reader_init(&reader, INPUT, sizeof(INPUT));
+    TEST_EXPECT(sizeof(INPUT) == vcblockchain_wire_reader_remaining(&reader));
+
+    TEST_EXPECT(0x01020304U == vcblockchain_wire_read_u32(&reader));
+    TEST_EXPECT(0x0123456789abcdefUL == vcblockchain_wire_read_u64(&reader));
+
+    /* the whole payload was read. */
+    TEST_EXPECT(0U == vcblockchain_wire_reader_remaining(&reader));
+}
+
+/**
+ * Every field type survives a round trip.
+ */
+TEST(round_trip)
+{
+    const vpr_uuid EXPECTED_ID = { .data = {
+        0x9c, 0x4d, 0x0c, 0x8e, 0x2b, 0x31, 0x4c, 0x6d,
+        0x8a, 0x1e, 0x74, 0x55, 0x6e, 0x90, 0x21, 0xf7 } };
+    const uint8_t EXPECTED_BYTES[5] = { 0x10, 0x20, 0x30, 0x40, 0x50 };
+    uint8_t buffer[4 + 8 + 16 + 5];
+    vcblockchain_wire_writer writer;
+    vcblockchain_wire_reader reader;
+    vpr_uuid id;
+    uint8_t bytes[5];
+
+    /* write each field. */
+    vcblockchain_wire_writer_init(&writer, buffer, sizeof(buffer));
+    vcblockchain_wire_write_u32(&writer, 0xA000);
+    vcblockchain_wire_write_u64(&writer, 76);
+    vcblockchain_wire_write_uuid(&writer, &EXPECTED_ID);
+    vcblockchain_wire_write_bytes(
+        &writer, EXPECTED_BYTES, sizeof(EXPECTED_BYTES));
+    TEST_ASSERT(0U == vcblockchain_wire_writer_remaining(&writer));
+
+    /* read each field back. */
+    vcblockchain_wire_reader_init(&reader, buffer, sizeof(buffer));
+    TEST_EXPECT(0xA000U == vcblockchain_wire_read_u32(&reader));
+    TEST_EXPECT(76U == vcblockchain_wire_read_u64(&reader));
+    vcblockchain_wire_read_uuid(&reader, &id);
+    TEST_EXPECT(0 == memcmp(&EXPECTED_ID, &id, sizeof(id)));
+
+    /* the remaining bytes can be skipped in place. */
+    TEST_ASSERT(
+        sizeof(EXPECTED_BYTES) == vcblockchain_wire_reader_remaining(&reader));
+    const uint8_t* rest =
+        vcblockchain_wire_read_skip(&reader, sizeof(EXPECTED_BYTES));
+    TEST_EXPECT(0 == memcmp(EXPECTED_BYTES, rest, sizeof(EXPECTED_BYTES)));
+    TEST_EXPECT(0U == vcblockchain_wire_reader_remaining(&reader));
+
+    /* or copied out. */
+    vcblockchain_wire_reader_init(
+        &reader, buffer + sizeof(buffer) - sizeof(bytes), sizeof(bytes));
+    vcblockchain_wire_read_bytes(&reader, bytes, sizeof(bytes));
+    TEST_EXPECT(0 == memcmp(EXPECTED_BYTES, bytes, sizeof(bytes)));
+}
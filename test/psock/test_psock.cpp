@@ -275,3 +275,101 @@ TEST(psock_write_authed_data_happy_path)
             == resource_release(rcpr_allocator_resource_handle(rcpr_alloc)));
     dispose((disposable_t*)&alloc_opts);
 }
+
+/**
+ * \brief We can read an authed packet from a socket that was written by
+ * psock_write_authed_datav, and it holds the concatenation of the segments.
+ */
+TEST(psock_write_authed_datav_happy_path)
+{
+    int lhs, rhs;
+    const char TEST_STRING[] = "This is a test.";
+    const vcblockchain_psock_iovec vec[4] = {
+        { TEST_STRING, 5 },
+        { TEST_STRING + 5, 0 },
+        { TEST_STRING + 5, 3 },
+        { TEST_STRING + 8, strlen(TEST_STRING) - 8 } };
+    void* str = nullptr;
+    uint32_t str_size = 0;
+    uint64_t iv = 12345;
+    rcpr_allocator* rcpr_alloc;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t suite;
+
+    /* register the Velo V1 crypto suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* initialize the malloc allocator. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create the rcpr allocator. */
+    TEST_ASSERT(STATUS_SUCCESS == rcpr_malloc_allocator_create(&rcpr_alloc));
+
+    /* initialize the crypto suite. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == vccrypt_suite_options_init(
+                    &suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1));
+
+    /* create a socket pair for testing. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == socket_utility_socketpair(AF_UNIX, SOCK_STREAM, 0, &lhs, &rhs));
+
+    /* create a psock instance for the rhs. */
+    psock* lsock;
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == psock_create_from_descriptor(&lsock, rcpr_alloc, lhs));
+
+    /* create a psock instance for the rhs. */
+    psock* rsock;
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == psock_create_from_descriptor(&rsock, rcpr_alloc, rhs));
+
+    /* create key for stream cipher. */
+    /* TODO - there should be a suite method for this. */
+    vccrypt_buffer_t key;
+    TEST_ASSERT(
+        0
+            == vccrypt_buffer_init(
+                    &key, &alloc_opts, suite.stream_cipher_opts.key_size));
+
+    /* set a null key. */
+    memset(key.data, 0, key.size);
+
+    /* writing to the socket should succeed. */
+    TEST_ASSERT(
+        0
+            == psock_write_authed_datav(
+                    lsock, iv, vec, 4, &suite, &key));
+
+    /* read an authed packet from the rhs socket. */
+    TEST_ASSERT(
+        0
+            == psock_read_authed_data(
+                    rsock, rcpr_alloc, iv, &str, &str_size, &suite, &key));
+
+    /* the data is valid. */
+    TEST_ASSERT(nullptr != str);
+
+    /* the string size is the length of our string. */
+    TEST_ASSERT(strlen(TEST_STRING) == str_size);
+
+    /* the data is a copy of the test string. */
+    TEST_EXPECT(0 == memcmp(TEST_STRING, str, str_size));
+
+    /* clean up. */
+    TEST_ASSERT(STATUS_SUCCESS == rcpr_allocator_reclaim(rcpr_alloc, str));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(psock_resource_handle(lsock)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(psock_resource_handle(rsock)));
+    dispose((disposable_t*)&key);
+    dispose((disposable_t*)&suite);
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(rcpr_allocator_resource_handle(rcpr_alloc)));
+    dispose((disposable_t*)&alloc_opts);
+}
@@ -0,0 +1,466 @@
+/**
+ * \file test/send_queue/test_vcblockchain_send_queue_submit.cpp
+ *
+ * Unit tests for submitting packets to a send queue.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cstring>
+#include <minunit/minunit.h>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/psock.h>
+#include <vcblockchain/send_queue.h>
+#include <vector>
+#include <vpr/allocator/malloc_allocator.h>
+
+#include "../dummy_psock.h"
+
+using namespace std;
+
+RCPR_IMPORT_allocator_as(rcpr);
+RCPR_IMPORT_psock;
+RCPR_IMPORT_resource;
+
+TEST_SUITE(test_vcblockchain_send_queue_submit);
+
+/**
+ * Packets submitted out of order are written in IV order.
+ */
+TEST(out_of_order)
+{
+    const char* PAYLOADS[3] = { "first", "second", "third" };
+    const uint64_t START_IV = 17U;
+    vcblockchain_send_queue* send_queue;
+    uint64_t ivs[3];
+    psock* sock;
+    rcpr_allocator* alloc;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t suite;
+    vccrypt_buffer_t key;
+    queue<uint8_t> stream_bytes;
+    size_t write_count = 0U;
+
+    /* register the suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create an RCPR allocator instance. */
+    TEST_ASSERT(STATUS_SUCCESS == rcpr_malloc_allocator_create(&alloc));
+
+    /* create the crypto suite. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_options_init(
+                    &suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1));
+
+    /* create a null key for the stream cipher. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_buffer_init(
+                    &key, &alloc_opts, suite.stream_cipher_opts.key_size));
+    memset(key.data, 0, key.size);
+
+    /* create the dummy socket for writing the packets. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == dummy_psock_create(
+                    &sock, alloc,
+                    [&](psock*, void*, size_t*) -> int {
+                        return VCBLOCKCHAIN_ERROR_SSOCK_READ;
+                    },
+                    [&](psock*, const void* vbuf, size_t* s) -> int {
+                        const uint8_t* buf = (const uint8_t*)vbuf;
+
+                        ++write_count;
+                        for (size_t i = 0; i < *s; ++i)
+                        {
+                            stream_bytes.push(buf[i]);
+                        }
+
+                        return VCBLOCKCHAIN_STATUS_SUCCESS;
+                    }));
+
+    /* create the send queue. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_send_queue_create(
+                    &send_queue, &alloc_opts, sock, &suite, &key, START_IV,
+                    4U));
+
+    /* reserve three IVs. */
+    for (int i = 0; i < 3; ++i)
+    {
+        TEST_ASSERT(
+            VCBLOCKCHAIN_STATUS_SUCCESS
+                == vcblockchain_send_queue_reserve(send_queue, &ivs[i]));
+        TEST_EXPECT(START_IV + i == ivs[i]);
+    }
+    TEST_EXPECT(START_IV + 3 == vcblockchain_send_queue_client_iv(send_queue));
+
+    /* the last packet waits for the packets before it. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_send_queue_submit(
+                    send_queue, ivs[2], PAYLOADS[2], strlen(PAYLOADS[2])));
+    TEST_EXPECT(0U == write_count);
+
+    /* the first packet is written at once. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_send_queue_submit(
+                    send_queue, ivs[0], PAYLOADS[0], strlen(PAYLOADS[0])));
+    TEST_EXPECT(1U == write_count);
+
+    /* the second packet releases the third. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_send_queue_submit(
+                    send_queue, ivs[1], PAYLOADS[1], strlen(PAYLOADS[1])));
+    TEST_EXPECT(3U == write_count);
+
+    /* reset the dummy socket to read the packets back. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(
+                    vcblockchain_send_queue_resource_handle(send_queue)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(psock_resource_handle(sock)));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == dummy_psock_create(
+                    &sock, alloc,
+                    [&](psock*, void* vbuf, size_t* s) -> int {
+                        uint8_t* buf = (uint8_t*)vbuf;
+
+                        if (stream_bytes.size() < *s)
+                            return VCBLOCKCHAIN_ERROR_SSOCK_READ;
+
+                        for (size_t i = 0; i < *s; ++i)
+                        {
+                            buf[i] = stream_bytes.front();
+                            stream_bytes.pop();
+                        }
+
+                        return VCBLOCKCHAIN_STATUS_SUCCESS;
+                    },
+                    [&](psock*, const void*, size_t*) -> int {
+                        return VCBLOCKCHAIN_ERROR_SSOCK_WRITE;
+                    }));
+
+    /* the packets arrive in IV order. */
+    for (int i = 0; i < 3; ++i)
+    {
+        void* val = nullptr;
+        uint32_t size = 0U;
+
+        TEST_ASSERT(
+            VCBLOCKCHAIN_STATUS_SUCCESS
+                == psock_read_authed_data(
+                        sock, alloc, ivs[i], &val, &size, &suite, &key));
+        TEST_EXPECT(strlen(PAYLOADS[i]) == size);
+        TEST_EXPECT(0 == memcmp(PAYLOADS[i], val, size));
+        TEST_ASSERT(STATUS_SUCCESS == rcpr_allocator_reclaim(alloc, val));
+    }
+    TEST_EXPECT(stream_bytes.empty());
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(psock_resource_handle(sock)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(rcpr_allocator_resource_handle(alloc)));
+    dispose((disposable_t*)&key);
+    dispose((disposable_t*)&suite);
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * An abandoned reservation fails the queue, and no later packet is written.
+ */
+TEST(abandoned)
+{
+    const char PAYLOAD[] = "payload";
+    vcblockchain_send_queue* send_queue;
+    uint64_t first_iv, second_iv;
+    psock* sock;
+    rcpr_allocator* alloc;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t suite;
+    vccrypt_buffer_t key;
+    size_t write_count = 0U;
+
+    /* register the suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create an RCPR allocator instance. */
+    TEST_ASSERT(STATUS_SUCCESS == rcpr_malloc_allocator_create(&alloc));
+
+    /* create the crypto suite. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_options_init(
+                    &suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1));
+
+    /* create a null key for the stream cipher. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_buffer_init(
+                    &key, &alloc_opts, suite.stream_cipher_opts.key_size));
+    memset(key.data, 0, key.size);
+
+    /* create a dummy socket that counts writes. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == dummy_psock_create(
+                    &sock, alloc,
+                    [&](psock*, void*, size_t*) -> int {
+                        return VCBLOCKCHAIN_ERROR_SSOCK_READ;
+                    },
+                    [&](psock*, const void*, size_t*) -> int {
+                        ++write_count;
+
+                        return VCBLOCKCHAIN_STATUS_SUCCESS;
+                    }));
+
+    /* create the send queue. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_send_queue_create(
+                    &send_queue, &alloc_opts, sock, &suite, &key, 0U, 0U));
+
+    /* reserve two IVs. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_send_queue_reserve(send_queue, &first_iv));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_send_queue_reserve(send_queue, &second_iv));
+
+    /* the second packet waits for the first. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_send_queue_submit(
+                    send_queue, second_iv, PAYLOAD, sizeof(PAYLOAD)));
+
+    /* abandoning the first reservation fails the queue. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_SSOCK_WRITE
+            == vcblockchain_send_queue_submit(
+                    send_queue, first_iv, nullptr, 0U));
+
+    /* later sends report the failure, and nothing is written. */
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_SSOCK_WRITE
+            == vcblockchain_send_queue_send(
+                    send_queue, PAYLOAD, sizeof(PAYLOAD)));
+    TEST_EXPECT(0U == write_count);
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(
+                    vcblockchain_send_queue_resource_handle(send_queue)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(psock_resource_handle(sock)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(rcpr_allocator_resource_handle(alloc)));
+    dispose((disposable_t*)&key);
+    dispose((disposable_t*)&suite);
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * Packets reserved, sealed, and submitted by several threads at once are each
+ * written exactly once, in IV order.
+ */
+TEST(concurrent)
+{
+    const int THREAD_COUNT = 4;
+    const int PACKETS_PER_THREAD = 64;
+    const size_t PACKET_COUNT = THREAD_COUNT * PACKETS_PER_THREAD;
+    const uint64_t START_IV = 5U;
+    vcblockchain_send_queue* send_queue;
+    psock* sock;
+    rcpr_allocator* alloc;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t suite;
+    vccrypt_buffer_t key;
+    mutex write_lock;
+    vector<vector<uint8_t>> writes;
+    vector<string> payloads(PACKET_COUNT);
+    vector<int> results(THREAD_COUNT, -1);
+    vector<thread> threads;
+    queue<uint8_t> stream_bytes;
+
+    /* register the suite. */
+    vccrypt_suite_register_velo_v1();
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create an RCPR allocator instance. */
+    TEST_ASSERT(STATUS_SUCCESS == rcpr_malloc_allocator_create(&alloc));
+
+    /* create the crypto suite. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_suite_options_init(
+                    &suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1));
+
+    /* create a null key for the stream cipher. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == vccrypt_buffer_init(
+                    &key, &alloc_opts, suite.stream_cipher_opts.key_size));
+    memset(key.data, 0, key.size);
+
+    /* create a dummy socket that captures each write. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == dummy_psock_create(
+                    &sock, alloc,
+                    [&](psock*, void*, size_t*) -> int {
+                        return VCBLOCKCHAIN_ERROR_SSOCK_READ;
+                    },
+                    [&](psock*, const void* vbuf, size_t* s) -> int {
+                        const uint8_t* buf = (const uint8_t*)vbuf;
+                        lock_guard<mutex> guard(write_lock);
+
+                        writes.emplace_back(buf, buf + *s);
+
+                        return VCBLOCKCHAIN_STATUS_SUCCESS;
+                    }));
+
+    /* create a shallow send queue, so that the ring fills and wraps. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_send_queue_create(
+                    &send_queue, &alloc_opts, sock, &suite, &key, START_IV,
+                    8U));
+
+    /* each thread reserves, seals, and submits its own packets. */
+    for (int t = 0; t < THREAD_COUNT; ++t)
+    {
+        threads.emplace_back([&, t]() {
+            int retval = VCBLOCKCHAIN_STATUS_SUCCESS;
+
+            for (int i = 0; i < PACKETS_PER_THREAD; ++i)
+            {
+                uint64_t iv;
+
+                retval = vcblockchain_send_queue_reserve(send_queue, &iv);
+                if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+                {
+                    break;
+                }
+
+                /* each IV is reserved once, so its payload slot is ours. */
+                string& payload = payloads[iv - START_IV];
+                payload =
+                    "thread " + to_string(t) + " packet " + to_string(i);
+
+                retval =
+                    vcblockchain_send_queue_submit(
+                        send_queue, iv, payload.data(), payload.size());
+                if (VCBLOCKCHAIN_STATUS_SUCCESS != retval)
+                {
+                    break;
+                }
+            }
+
+            results[t] = retval;
+        });
+    }
+
+    /* wait for every thread to finish. */
+    for (auto& th : threads)
+    {
+        th.join();
+    }
+
+    /* every thread succeeded. */
+    for (int t = 0; t < THREAD_COUNT; ++t)
+    {
+        TEST_EXPECT(VCBLOCKCHAIN_STATUS_SUCCESS == results[t]);
+    }
+
+    /* every IV was reserved, and every packet was written exactly once. */
+    TEST_EXPECT(
+        START_IV + PACKET_COUNT
+            == vcblockchain_send_queue_client_iv(send_queue));
+    TEST_ASSERT(PACKET_COUNT == writes.size());
+
+    /* reset the dummy socket to read the packets back. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(
+                    vcblockchain_send_queue_resource_handle(send_queue)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(psock_resource_handle(sock)));
+    for (const auto& write : writes)
+    {
+        for (uint8_t byte : write)
+        {
+            stream_bytes.push(byte);
+        }
+    }
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == dummy_psock_create(
+                    &sock, alloc,
+                    [&](psock*, void* vbuf, size_t* s) -> int {
+                        uint8_t* buf = (uint8_t*)vbuf;
+
+                        if (stream_bytes.size() < *s)
+                            return VCBLOCKCHAIN_ERROR_SSOCK_READ;
+
+                        for (size_t i = 0; i < *s; ++i)
+                        {
+                            buf[i] = stream_bytes.front();
+                            stream_bytes.pop();
+                        }
+
+                        return VCBLOCKCHAIN_STATUS_SUCCESS;
+                    },
+                    [&](psock*, const void*, size_t*) -> int {
+                        return VCBLOCKCHAIN_ERROR_SSOCK_WRITE;
+                    }));
+
+    /* the packets arrive in IV order, each with the payload for its IV. */
+    for (size_t i = 0; i < PACKET_COUNT; ++i)
+    {
+        void* val = nullptr;
+        uint32_t size = 0U;
+
+        TEST_ASSERT(
+            VCBLOCKCHAIN_STATUS_SUCCESS
+                == psock_read_authed_data(
+                        sock, alloc, START_IV + i, &val, &size, &suite,
+                        &key));
+        TEST_EXPECT(payloads[i].size() == size);
+        TEST_EXPECT(0 == memcmp(payloads[i].data(), val, size));
+        TEST_ASSERT(STATUS_SUCCESS == rcpr_allocator_reclaim(alloc, val));
+    }
+    TEST_EXPECT(stream_bytes.empty());
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(psock_resource_handle(sock)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(rcpr_allocator_resource_handle(alloc)));
+    dispose((disposable_t*)&key);
+    dispose((disposable_t*)&suite);
+    dispose((disposable_t*)&alloc_opts);
+}
@@ -0,0 +1,252 @@
+/**
+ * \file test/stream/test_vcblockchain_stream_reader_input.cpp
+ *
+ * Unit tests for reassembling payloads from stream frames.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <arpa/inet.h>
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/byteswap.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/protocol/data.h>
+#include <vcblockchain/stream.h>
+#include <vector>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+RCPR_IMPORT_resource;
+
+TEST_SUITE(test_vcblockchain_stream_reader_input);
+
+/**
+ * \brief Build a frame by hand.
+ */
+static vector<uint8_t> build_frame(
+    uint32_t request_id, uint32_t stream_id, uint32_t flags,
+    uint64_t payload_size, size_t chunk_size)
+{
+    vector<uint8_t> frame;
+    uint32_t net_request_id = htonl(request_id);
+    uint32_t net_stream_id = htonl(stream_id);
+    uint32_t net_flags = htonl(flags);
+    uint64_t net_payload_size = htonll(payload_size);
+    const uint8_t* p;
+
+    p = (const uint8_t*)&net_request_id;
+    frame.insert(frame.end(), p, p + sizeof(net_request_id));
+    p = (const uint8_t*)&net_stream_id;
+    frame.insert(frame.end(), p, p + sizeof(net_stream_id));
+    p = (const uint8_t*)&net_flags;
+    frame.insert(frame.end(), p, p + sizeof(net_flags));
+    if (flags & VCBLOCKCHAIN_STREAM_FRAME_FLAG_START)
+    {
+        p = (const uint8_t*)&net_payload_size;
+        frame.insert(frame.end(), p, p + sizeof(net_payload_size));
+    }
+    frame.insert(frame.end(), chunk_size, 0x5A);
+
+    return frame;
+}
+
+/**
+ * Frames that break the framing are rejected.
+ */
+TEST(bad_frames)
+{
+    vcblockchain_stream_reader* reader;
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t payload;
+    uint32_t stream_id;
+    bool complete;
+    vector<uint8_t> frame;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create a reader with room for one stream of up to 16 bytes. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_stream_reader_create(
+                    &reader, &alloc_opts, 1U, 16U));
+
+    /* a truncated header is rejected. */
+    frame =
+        build_frame(
+            PROTOCOL_REQ_ID_STREAM_FRAME, 1U,
+            VCBLOCKCHAIN_STREAM_FRAME_FLAG_START, 8U, 0U);
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE
+            == vcblockchain_stream_reader_input(
+                    reader, frame.data(), frame.size() - 1, &stream_id,
+                    &payload, &complete));
+
+    /* a frame with the wrong request id is rejected. */
+    frame =
+        build_frame(
+            PROTOCOL_REQ_ID_LATEST_BLOCK_ID_GET, 1U,
+            VCBLOCKCHAIN_STREAM_FRAME_FLAG_START, 8U, 8U);
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE
+            == vcblockchain_stream_reader_input(
+                    reader, frame.data(), frame.size(), &stream_id, &payload,
+                    &complete));
+
+    /* a frame for a stream that was never opened is rejected. */
+    frame = build_frame(PROTOCOL_REQ_ID_STREAM_FRAME, 1U, 0U, 0U, 8U);
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE
+            == vcblockchain_stream_reader_input(
+                    reader, frame.data(), frame.size(), &stream_id, &payload,
+                    &complete));
+
+    /* a stream larger than the reader allows is rejected. */
+    frame =
+        build_frame(
+            PROTOCOL_REQ_ID_STREAM_FRAME, 1U,
+            VCBLOCKCHAIN_STREAM_FRAME_FLAG_START, 17U, 8U);
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE
+            == vcblockchain_stream_reader_input(
+                    reader, frame.data(), frame.size(), &stream_id, &payload,
+                    &complete));
+
+    /* open a stream of 16 bytes. */
+    frame =
+        build_frame(
+            PROTOCOL_REQ_ID_STREAM_FRAME, 1U,
+            VCBLOCKCHAIN_STREAM_FRAME_FLAG_START, 16U, 8U);
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_stream_reader_input(
+                    reader, frame.data(), frame.size(), &stream_id, &payload,
+                    &complete));
+    TEST_EXPECT(1U == stream_id);
+    TEST_EXPECT(!complete);
+
+    /* the table is full, so a second stream is refused. */
+    frame =
+        build_frame(
+            PROTOCOL_REQ_ID_STREAM_FRAME, 2U,
+            VCBLOCKCHAIN_STREAM_FRAME_FLAG_START, 8U, 8U);
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_STREAM_TABLE_FULL
+            == vcblockchain_stream_reader_input(
+                    reader, frame.data(), frame.size(), &stream_id, &payload,
+                    &complete));
+
+    /* a chunk that overruns the declared size is rejected. */
+    frame = build_frame(PROTOCOL_REQ_ID_STREAM_FRAME, 1U, 0U, 0U, 9U);
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE
+            == vcblockchain_stream_reader_input(
+                    reader, frame.data(), frame.size(), &stream_id, &payload,
+                    &complete));
+
+    /* the overrun closed the stream, so open it again. */
+    frame =
+        build_frame(
+            PROTOCOL_REQ_ID_STREAM_FRAME, 1U,
+            VCBLOCKCHAIN_STREAM_FRAME_FLAG_START, 16U, 8U);
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_stream_reader_input(
+                    reader, frame.data(), frame.size(), &stream_id, &payload,
+                    &complete));
+    TEST_EXPECT(!complete);
+
+    /* the last chunk must be flagged as the last. */
+    frame = build_frame(PROTOCOL_REQ_ID_STREAM_FRAME, 1U, 0U, 0U, 8U);
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE
+            == vcblockchain_stream_reader_input(
+                    reader, frame.data(), frame.size(), &stream_id, &payload,
+                    &complete));
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(
+                    vcblockchain_stream_reader_resource_handle(reader)));
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * A malformed chunk closes its stream and releases its partial payload.
+ */
+TEST(malformed_chunk_after_start)
+{
+    vcblockchain_stream_reader* reader;
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t payload;
+    uint32_t stream_id;
+    bool complete;
+    vector<uint8_t> frame;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create a reader with room for one stream of up to 16 bytes. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_stream_reader_create(
+                    &reader, &alloc_opts, 1U, 16U));
+
+    /* a first frame whose chunk overruns its declared size is rejected. */
+    frame =
+        build_frame(
+            PROTOCOL_REQ_ID_STREAM_FRAME, 1U,
+            VCBLOCKCHAIN_STREAM_FRAME_FLAG_START, 8U, 9U);
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_PAYLOAD_SIZE
+            == vcblockchain_stream_reader_input(
+                    reader, frame.data(), frame.size(), &stream_id, &payload,
+                    &complete));
+
+    /* the stream was closed, so its next frame is rejected. */
+    frame = build_frame(PROTOCOL_REQ_ID_STREAM_FRAME, 1U, 0U, 0U, 4U);
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE
+            == vcblockchain_stream_reader_input(
+                    reader, frame.data(), frame.size(), &stream_id, &payload,
+                    &complete));
+
+    /* a first frame flagged as the last, but short of its declared size, is
+     * rejected. */
+    frame =
+        build_frame(
+            PROTOCOL_REQ_ID_STREAM_FRAME, 1U,
+            VCBLOCKCHAIN_STREAM_FRAME_FLAG_START
+                | VCBLOCKCHAIN_STREAM_FRAME_FLAG_FIN, 16U, 8U);
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_PROTOCOL_UNEXPECTED_VALUE
+            == vcblockchain_stream_reader_input(
+                    reader, frame.data(), frame.size(), &stream_id, &payload,
+                    &complete));
+
+    /* the entry was freed, so the same stream can be opened again. */
+    frame =
+        build_frame(
+            PROTOCOL_REQ_ID_STREAM_FRAME, 1U,
+            VCBLOCKCHAIN_STREAM_FRAME_FLAG_START
+                | VCBLOCKCHAIN_STREAM_FRAME_FLAG_FIN, 8U, 8U);
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_stream_reader_input(
+                    reader, frame.data(), frame.size(), &stream_id, &payload,
+                    &complete));
+    TEST_EXPECT(1U == stream_id);
+    TEST_ASSERT(complete);
+    TEST_EXPECT(8U == payload.size);
+
+    /* clean up. */
+    dispose((disposable_t*)&payload);
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(
+                    vcblockchain_stream_reader_resource_handle(reader)));
+    dispose((disposable_t*)&alloc_opts);
+}
@@ -0,0 +1,230 @@
+/**
+ * \file test/stream/test_vcblockchain_stream_writer_next_frame.cpp
+ *
+ * Unit tests for framing payloads on logical streams.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <arpa/inet.h>
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vcblockchain/error_codes.h>
+#include <vcblockchain/stream.h>
+#include <vector>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+RCPR_IMPORT_resource;
+
+TEST_SUITE(test_vcblockchain_stream_writer_next_frame);
+
+/**
+ * \brief Create a payload of the given size, filled with the given byte.
+ */
+static int payload_create(
+    vccrypt_buffer_t* payload, allocator_options_t* alloc_opts, size_t size,
+    uint8_t fill)
+{
+    int retval = vccrypt_buffer_init(payload, alloc_opts, size);
+    if (VCCRYPT_STATUS_SUCCESS == retval)
+    {
+        memset(payload->data, fill, size);
+    }
+
+    return retval;
+}
+
+/**
+ * \brief Get the stream id of a frame.
+ */
+static uint32_t frame_stream_id(const void* frame)
+{
+    uint32_t net_stream_id;
+
+    memcpy(
+        &net_stream_id, (const uint8_t*)frame + sizeof(uint32_t),
+        sizeof(net_stream_id));
+
+    return ntohl(net_stream_id);
+}
+
+/**
+ * An interactive stream opened while a bulk stream is being framed is sent
+ * ahead of the rest of the bulk stream, bulk streams take turns, and the
+ * reader reassembles every payload.
+ */
+TEST(priority_lanes)
+{
+    vcblockchain_stream_writer* writer;
+    vcblockchain_stream_reader* reader;
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t payload;
+    vector<uint32_t> order;
+    vector<uint32_t> completed;
+    const void* frame;
+    size_t frame_size;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create a writer that carries 10 payload bytes per frame. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_stream_writer_create(
+                    &writer, &alloc_opts, 4U, 10U));
+
+    /* create a reader. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_stream_reader_create(
+                    &reader, &alloc_opts, 4U, 1024U));
+
+    /* with no stream open, there is nothing to send. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_stream_writer_next_frame(
+                    writer, &frame, &frame_size));
+    TEST_EXPECT(0U == frame_size);
+
+    /* open two bulk streams of three frames each. */
+    for (uint32_t id = 1; id <= 2; ++id)
+    {
+        TEST_ASSERT(
+            VCCRYPT_STATUS_SUCCESS
+                == payload_create(&payload, &alloc_opts, 25U, (uint8_t)id));
+        TEST_ASSERT(
+            VCBLOCKCHAIN_STATUS_SUCCESS
+                == vcblockchain_stream_writer_submit(
+                        writer, id, VCBLOCKCHAIN_STREAM_PRIORITY_BULK,
+                        &payload));
+    }
+
+    /* a stream id can't be reused while its stream is open. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == payload_create(&payload, &alloc_opts, 5U, 0xFF));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_INVALID_ARG
+            == vcblockchain_stream_writer_submit(
+                    writer, 1U, VCBLOCKCHAIN_STREAM_PRIORITY_BULK, &payload));
+    dispose((disposable_t*)&payload);
+
+    /* send every frame, opening an interactive stream after the first. */
+    for (;;)
+    {
+        TEST_ASSERT(
+            VCBLOCKCHAIN_STATUS_SUCCESS
+                == vcblockchain_stream_writer_next_frame(
+                        writer, &frame, &frame_size));
+        if (0U == frame_size)
+        {
+            break;
+        }
+
+        TEST_ASSERT(
+            frame_size
+                <= VCBLOCKCHAIN_STREAM_FRAME_START_HEADER_SIZE + 10U);
+        order.push_back(frame_stream_id(frame));
+
+        if (1U == order.size())
+        {
+            TEST_ASSERT(
+                VCCRYPT_STATUS_SUCCESS
+                    == payload_create(&payload, &alloc_opts, 5U, 3U));
+            TEST_ASSERT(
+                VCBLOCKCHAIN_STATUS_SUCCESS
+                    == vcblockchain_stream_writer_submit(
+                            writer, 3U,
+                            VCBLOCKCHAIN_STREAM_PRIORITY_INTERACTIVE,
+                            &payload));
+        }
+
+        /* reassemble the frame on the other side. */
+        uint32_t stream_id;
+        bool complete;
+        TEST_ASSERT(
+            VCBLOCKCHAIN_STATUS_SUCCESS
+                == vcblockchain_stream_reader_input(
+                        reader, frame, frame_size, &stream_id, &payload,
+                        &complete));
+        TEST_EXPECT(order.back() == stream_id);
+        if (complete)
+        {
+            size_t expected_size = 3U == stream_id ? 5U : 25U;
+            TEST_ASSERT(expected_size == payload.size);
+            for (size_t i = 0; i < payload.size; ++i)
+            {
+                TEST_EXPECT(
+                    stream_id == ((const uint8_t*)payload.data)[i]);
+            }
+            completed.push_back(stream_id);
+            dispose((disposable_t*)&payload);
+        }
+    }
+
+    /* the interactive stream jumped the queue, and the bulk streams took
+     * turns. */
+    const vector<uint32_t> EXPECTED_ORDER = { 1, 3, 2, 1, 2, 1, 2 };
+    TEST_EXPECT(EXPECTED_ORDER == order);
+    const vector<uint32_t> EXPECTED_COMPLETED = { 3, 1, 2 };
+    TEST_EXPECT(EXPECTED_COMPLETED == completed);
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(
+                    vcblockchain_stream_reader_resource_handle(reader)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(
+                    vcblockchain_stream_writer_resource_handle(writer)));
+    dispose((disposable_t*)&alloc_opts);
+}
+
+/**
+ * A writer refuses to open more streams than it allows.
+ */
+TEST(table_full)
+{
+    vcblockchain_stream_writer* writer;
+    allocator_options_t alloc_opts;
+    vccrypt_buffer_t payload;
+
+    /* create an allocator instance. */
+    malloc_allocator_options_init(&alloc_opts);
+
+    /* create a writer with room for one stream. */
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_stream_writer_create(
+                    &writer, &alloc_opts, 1U, 0U));
+
+    /* open the only stream. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == payload_create(&payload, &alloc_opts, 5U, 1U));
+    TEST_ASSERT(
+        VCBLOCKCHAIN_STATUS_SUCCESS
+            == vcblockchain_stream_writer_submit(
+                    writer, 1U, VCBLOCKCHAIN_STREAM_PRIORITY_BULK, &payload));
+
+    /* a second stream is refused, and its payload is left with the caller. */
+    TEST_ASSERT(
+        VCCRYPT_STATUS_SUCCESS
+            == payload_create(&payload, &alloc_opts, 5U, 2U));
+    TEST_EXPECT(
+        VCBLOCKCHAIN_ERROR_STREAM_TABLE_FULL
+            == vcblockchain_stream_writer_submit(
+                    writer, 2U, VCBLOCKCHAIN_STREAM_PRIORITY_BULK, &payload));
+    TEST_EXPECT(nullptr != payload.data);
+    dispose((disposable_t*)&payload);
+
+    /* clean up; the unsent stream is released with the writer. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(
+                    vcblockchain_stream_writer_resource_handle(writer)));
+    dispose((disposable_t*)&alloc_opts);
+}